@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""
+Deterministic instruction counts per function and message under QEMU.
+
+Boots a kernel image (by default build/bench.img from make bench) with
+scripts/icount_plugin.c loaded, splits the run at every entry to the
+split function (bench_vector: one phase per message), attributes the
+executed instructions to functions from the image's symbols and writes
+a JSON report.  Given a baseline report it fails when the total of a
+message, or a hot function in it, grew by more than the threshold.
+
+Usage (normally through make icount):
+    scripts/icount.py -o results/icount.json build/bench.img
+    scripts/icount.py --baseline results/icount.base.json build/bench.img
+
+kernel1.img works too, split at unified_decrypt and with its closing
+message as the done line:
+    scripts/icount.py --split unified_decrypt --done "Exit via" build/kernel1.img
+"""
+
+import argparse
+import bisect
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+
+BENCH_LINE = re.compile(r"^bench name=(\S+) bytes=(\d+) iters=(\d+) .* (ok|FAIL.*)$")
+
+
+def read_functions(nm, image):
+    """
+    Return (starts, ends, names) of the functions in IMAGE, sorted by
+    address.  Functions without a size end where the next one starts.
+    """
+    out = subprocess.run([nm, "-n", "-S", "--defined-only", image],
+                         capture_output=True, text=True, check=True).stdout
+    funcs = []
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) == 4 and parts[2] in "tTwW":
+            funcs.append((int(parts[0], 16), int(parts[1], 16), parts[3]))
+        elif len(parts) == 3 and parts[1] in "tT" and not parts[2].startswith("$"):
+            funcs.append((int(parts[0], 16), 0, parts[2]))
+    funcs.sort()
+
+    starts, ends, names = [], [], []
+    for i, (addr, size, name) in enumerate(funcs):
+        if starts and starts[-1] == addr:
+            continue    # Aliases: keep the first name
+        end = addr + size if size else (funcs[i + 1][0] if i + 1 < len(funcs) else addr + 4)
+        starts.append(addr)
+        ends.append(end)
+        names.append(name)
+    return starts, ends, names
+
+
+def function_address(funcs, name):
+    """Return the address of function NAME in FUNCS."""
+    starts, _, names = funcs
+    for addr, n in zip(starts, names):
+        if n == name:
+            return addr
+    sys.exit(f"icount: no function {name} in the image")
+
+
+def run_qemu(args, split, stop):
+    """
+    Boot the image until the done line and the plugin's counts, and
+    return (serial lines, plugin output lines).
+    """
+    with tempfile.TemporaryDirectory() as tmp:
+        out = os.path.join(tmp, "icount.txt")
+        cmd = ([args.qemu] + shlex.split(args.machine) +
+               ["-kernel", args.image, "-display", "none", "-monitor", "none",
+                "-serial", "stdio", "-icount", "shift=0",
+                "-plugin", f"{args.plugin},out={out},split={split:#x},stop={stop:#x}"])
+        proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, text=True,
+                                errors="replace")
+        timer = threading.Timer(args.timeout, proc.terminate)
+        timer.start()
+        serial = []
+        for line in proc.stdout:
+            line = line.rstrip("\r\n")
+            serial.append(line)
+            if args.verbose:
+                print(line)
+            if args.done in line:
+                break
+        # The plugin writes its counts once main has returned to the hang
+        # loop in start.s, or else when QEMU exits, a signal included.
+        for _ in range(100):
+            if os.path.exists(out) or proc.poll() is not None:
+                break
+            time.sleep(0.1)
+        timer.cancel()
+        proc.terminate()
+        proc.wait()
+        if not any(args.done in line for line in serial):
+            sys.exit(f"icount: no '{args.done}' line from {args.image}")
+        if not os.path.exists(out):
+            sys.exit("icount: the plugin wrote no counts")
+        with open(out) as f:
+            return serial, f.readlines()
+
+
+def attribute(lines, funcs):
+    """
+    Sum the plugin's block counts into {phase: {function: instructions}}.
+    """
+    starts, ends, names = funcs
+    phases = {}
+    for line in lines:
+        fields = line.split()
+        phase, count = int(fields[0], 16), int(fields[1], 16)
+        counts = phases.setdefault(phase, {})
+        for vaddr in fields[2:]:
+            addr = int(vaddr, 16)
+            i = bisect.bisect_right(starts, addr) - 1
+            name = names[i] if i >= 0 and addr < ends[i] else f"{addr:#x}"
+            counts[name] = counts.get(name, 0) + count
+    return phases
+
+
+def build_report(args, serial, phases):
+    """
+    Name the phases after the bench lines, or number them, and return
+    the report.
+    """
+    bench = [BENCH_LINE.match(line) for line in serial]
+    bench = [m for m in bench if m]
+    report = {"image": args.image, "split": args.split, "messages": {}}
+    for phase in sorted(phases):
+        counts = phases[phase]
+        entry = {"instructions": sum(counts.values()),
+                 "functions": dict(sorted(counts.items(), key=lambda kv: -kv[1]))}
+        if phase == 0:
+            report["boot"] = entry
+            continue
+        name = str(phase)
+        if phase <= len(bench):
+            m = bench[phase - 1]
+            name = m.group(1)
+            entry["bytes"] = int(m.group(2))
+            entry["iters"] = int(m.group(3))
+            entry["result"] = m.group(4)
+        report["messages"][name] = entry
+    return report
+
+
+def compare(report, baseline, threshold, hot):
+    """
+    Print the hot functions of every message against BASELINE and
+    return the regressions found.
+    """
+    failures = []
+    for name, base in baseline["messages"].items():
+        cur = report["messages"].get(name)
+        if cur is None:
+            failures.append(f"{name}: missing")
+            continue
+        if cur.get("iters") != base.get("iters"):
+            failures.append(f"{name}: {cur.get('iters')} iterations, baseline {base.get('iters')}")
+            continue
+        rows = [("total", base["instructions"], cur["instructions"])]
+        for func, count in base["functions"].items():
+            if count * 100 >= base["instructions"] * hot:
+                rows.append((func, count, cur["functions"].get(func, 0)))
+        print(f"{name}:")
+        for func, old, new in rows:
+            change = (new - old) * 100.0 / old if old else 0.0
+            flag = ""
+            if change > threshold:
+                flag = "  REGRESSION"
+                failures.append(f"{name}: {func} {old} -> {new} (+{change:.2f}%)")
+            print(f"  {func:<32} {old:>14} {new:>14} {change:+8.2f}%{flag}")
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("image", nargs="?", default="build/bench.img")
+    parser.add_argument("-o", "--output", default="results/icount.json",
+                        help="report to write")
+    parser.add_argument("--baseline", help="report to compare against")
+    parser.add_argument("--threshold", type=float, default=2.0,
+                        help="allowed growth, in percent")
+    parser.add_argument("--hot", type=float, default=1.0,
+                        help="compare functions with at least this percentage "
+                             "of a message's baseline instructions")
+    parser.add_argument("--split", default="bench_vector",
+                        help="function whose entry starts the next message")
+    parser.add_argument("--stop", default="hang",
+                        help="where counting ends (start.s, after main)")
+    parser.add_argument("--done", default="# bench done",
+                        help="serial output that ends the run")
+    parser.add_argument("--qemu", default="qemu-system-arm")
+    parser.add_argument("--machine", default="-M versatilepb -cpu cortex-a7")
+    parser.add_argument("--plugin", default="build/icount_plugin.so")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--timeout", type=float, default=1800,
+                        help="seconds to wait for the done line")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="echo the serial output")
+    args = parser.parse_args()
+
+    funcs = read_functions(args.nm, args.image)
+    split = function_address(funcs, args.split)
+    stop = function_address(funcs, args.stop)
+    serial, lines = run_qemu(args, split, stop)
+    report = build_report(args, serial, attribute(lines, funcs))
+
+    os.makedirs(os.path.dirname(args.output) or ".", exist_ok=True)
+    with open(args.output, "w") as f:
+        json.dump(report, f, indent=1)
+        f.write("\n")
+    for name, entry in report["messages"].items():
+        print(f"{name:<8} {entry['instructions']:>14} instructions  {entry.get('result', '')}")
+    print(f"Report written to {args.output}")
+
+    failures = [f"{name}: {e['result']}" for name, e in report["messages"].items()
+                if e.get("result", "ok") != "ok"]
+    if args.baseline:
+        with open(args.baseline) as f:
+            failures += compare(report, json.load(f), args.threshold, args.hot)
+    for failure in failures:
+        print(f"FAIL {failure}")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
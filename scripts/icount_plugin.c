@@ -0,0 +1,183 @@
+/*
+ * icount_plugin.c - QEMU TCG plugin counting executed guest instructions
+ *
+ * Every translated block is recorded with the addresses of its
+ * instructions and counted each time it runs.  Executing the block at
+ * split=ADDR (a function entry) starts a new phase, so that one boot
+ * can be broken up per message; phase 0 is everything before the first
+ * split.  Executing stop=ADDR (where the kernel idles once main has
+ * returned) ends counting.  Then, or at exit if it never gets there,
+ * out=FILE gets one line per block and phase:
+ *
+ *   <phase> <executions> <insn vaddr> <insn vaddr> ...
+ *
+ * in hex, which scripts/icount.py attributes to functions.  Build with
+ * make build/icount_plugin.so (QEMU_PLUGIN_INCLUDE names the directory
+ * holding qemu-plugin.h) and load with
+ *
+ *   -plugin build/icount_plugin.so,out=icount.txt,split=0x10a2c,stop=0x8030
+ *
+ * Phases are only meaningful with one vCPU.
+ */
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define MAX_PHASES 64
+#define HASH_SIZE 65536
+
+struct block
+{
+    struct block *next;         /* In the same hash bucket */
+    uint64_t vaddr;
+    size_t n_insns;
+    uint64_t *insn_vaddr;
+    uint64_t count[MAX_PHASES];
+};
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static struct block *blocks[HASH_SIZE];
+static uint64_t split_vaddr = UINT64_MAX;
+static uint64_t stop_vaddr = UINT64_MAX;
+static unsigned int phase;
+static int stopped;
+static char *out_path;
+
+static void write_counts (void);
+
+static void
+vcpu_tb_exec (unsigned int vcpu_index, void *udata)
+{
+    struct block *b = udata;
+    unsigned int p;
+
+    if (__atomic_load_n (&stopped, __ATOMIC_RELAXED))
+        return;
+    if (b->vaddr == stop_vaddr)
+    {
+        if (!__atomic_exchange_n (&stopped, 1, __ATOMIC_RELAXED))
+            write_counts ();
+        return;
+    }
+    if (b->vaddr == split_vaddr && __atomic_load_n (&phase, __ATOMIC_RELAXED) < MAX_PHASES - 1)
+        __atomic_add_fetch (&phase, 1, __ATOMIC_RELAXED);
+    p = __atomic_load_n (&phase, __ATOMIC_RELAXED);
+    __atomic_add_fetch (&b->count[p], 1, __ATOMIC_RELAXED);
+}
+
+static void
+vcpu_tb_trans (qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    uint64_t vaddr = qemu_plugin_tb_vaddr (tb);
+    size_t n = qemu_plugin_tb_n_insns (tb), i;
+    struct block **head = &blocks[(vaddr >> 1) % HASH_SIZE];
+    struct block *b;
+
+    /* The same code is translated again after a flush, or shorter when
+       -icount ends a block early; both keep one record per shape.  */
+    pthread_mutex_lock (&lock);
+    for (b = *head; b; b = b->next)
+        if (b->vaddr == vaddr && b->n_insns == n)
+            break;
+    if (!b)
+    {
+        b = calloc (1, sizeof *b);
+        if (!b || !(b->insn_vaddr = malloc (n * sizeof *b->insn_vaddr)))
+            abort ();
+        b->vaddr = vaddr;
+        b->n_insns = n;
+        for (i = 0; i < n; i++)
+            b->insn_vaddr[i] = qemu_plugin_insn_vaddr (qemu_plugin_tb_get_insn (tb, i));
+        b->next = *head;
+        *head = b;
+    }
+    pthread_mutex_unlock (&lock);
+
+    qemu_plugin_register_vcpu_tb_exec_cb (tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, b);
+}
+
+/* Written under another name and renamed, so that a reader polling
+   for OUT_PATH never sees half of it.  */
+static void
+write_counts (void)
+{
+    struct block *b;
+    char *tmp;
+    FILE *f;
+    unsigned int h, ph;
+    size_t i;
+
+    tmp = malloc (strlen (out_path) + 5);
+    if (!tmp)
+        abort ();
+    strcpy (tmp, out_path);
+    strcat (tmp, ".tmp");
+    f = fopen (tmp, "w");
+    if (!f)
+    {
+        qemu_plugin_outs ("icount: cannot write the output file\n");
+        free (tmp);
+        return;
+    }
+    pthread_mutex_lock (&lock);
+    for (h = 0; h < HASH_SIZE; h++)
+        for (b = blocks[h]; b; b = b->next)
+            for (ph = 0; ph < MAX_PHASES; ph++)
+            {
+                if (!b->count[ph])
+                    continue;
+                fprintf (f, "%x %" PRIx64, ph, b->count[ph]);
+                for (i = 0; i < b->n_insns; i++)
+                    fprintf (f, " %" PRIx64, b->insn_vaddr[i]);
+                fputc ('\n', f);
+            }
+    pthread_mutex_unlock (&lock);
+    fclose (f);
+    rename (tmp, out_path);
+    free (tmp);
+}
+
+static void
+plugin_exit (qemu_plugin_id_t id, void *p)
+{
+    if (!__atomic_exchange_n (&stopped, 1, __ATOMIC_RELAXED))
+        write_counts ();
+}
+
+QEMU_PLUGIN_EXPORT int
+qemu_plugin_install (qemu_plugin_id_t id, const qemu_info_t *info,
+                     int argc, char **argv)
+{
+    int i;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (!strncmp (argv[i], "out=", 4))
+            out_path = strdup (argv[i] + 4);
+        else if (!strncmp (argv[i], "split=", 6))
+            split_vaddr = strtoull (argv[i] + 6, NULL, 0);
+        else if (!strncmp (argv[i], "stop=", 5))
+            stop_vaddr = strtoull (argv[i] + 5, NULL, 0);
+        else
+        {
+            fprintf (stderr, "icount: unknown argument %s\n", argv[i]);
+            return -1;
+        }
+    }
+    if (!out_path)
+    {
+        fprintf (stderr, "icount: out=FILE is required\n");
+        return -1;
+    }
+
+    qemu_plugin_register_vcpu_tb_trans_cb (id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb (id, plugin_exit, NULL);
+    return 0;
+}
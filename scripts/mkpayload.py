@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Wrap an OpenPGP message in a payload header for the kernel to load.
+
+The output is the struct payload_header of src/payload.h followed by
+the message, for QEMU's generic loader to put at PAYLOAD_ADDR:
+
+    -device loader,file=msg.payload,addr=0x04000000,force-raw=on
+
+which make run PAYLOAD=msg.payload (or run-bench, icount) adds.  The
+kernel finds the header there and decrypts the message in place with
+the passphrase or session key from the header; given the plaintext,
+the header also carries its length and CRC-32 for the kernel to check.
+
+Usage:
+    scripts/mkpayload.py --passphrase password -o 10k.payload msg.gpg
+    scripts/mkpayload.py --session-key 693b7847fa44cdc6e1c403f5e44e95c1 \\
+        --plaintext 10k.txt -o 10k.payload encrypted.10k.gpg
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+
+MAGIC = b"GPGLOAD1"
+KEY_MAX = 128
+UNKNOWN = 0xffffffff
+OUTPUT = 1
+KEY_PASSPHRASE, KEY_SESSION = 0, 1
+
+# magic, header_size, addr, length, flags, key_kind, key_len, key,
+# text_len, text_crc, out_addr, out_size, result_rc, result_len,
+# result_crc, result_out
+HEADER = struct.Struct(f"<8s6I{KEY_MAX}s8I")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("message", help="binary or armored OpenPGP message")
+    parser.add_argument("-o", "--output", required=True)
+    key = parser.add_mutually_exclusive_group(required=True)
+    key.add_argument("--passphrase")
+    key.add_argument("--session-key", metavar="HEX",
+                     help="symmetric key as gpg --show-session-key prints "
+                          "it, without the algorithm")
+    parser.add_argument("--plaintext", metavar="FILE",
+                        help="expected plaintext, for the kernel to check")
+    parser.add_argument("--output-text", action="store_true",
+                        help="have the kernel keep the plaintext in RAM "
+                             "after the message")
+    args = parser.parse_args()
+
+    with open(args.message, "rb") as f:
+        message = f.read()
+    if not message:
+        sys.exit(f"mkpayload: {args.message} is empty")
+
+    if args.passphrase is not None:
+        kind, key = KEY_PASSPHRASE, args.passphrase.encode()
+    else:
+        kind, key = KEY_SESSION, bytes.fromhex(args.session_key)
+        if len(key) not in (16, 24, 32):
+            sys.exit("mkpayload: a session key is 16, 24 or 32 bytes")
+    # The kernel hands the key on as a C string (do_proc_packets).
+    if not key or len(key) > KEY_MAX or 0 in key:
+        sys.exit(f"mkpayload: the key must be 1 to {KEY_MAX} bytes without a 0 byte")
+
+    text_len = text_crc = UNKNOWN
+    if args.plaintext:
+        with open(args.plaintext, "rb") as f:
+            text = f.read()
+        text_len, text_crc = len(text), zlib.crc32(text)
+
+    header = HEADER.pack(MAGIC, HEADER.size, 0, len(message),
+                         OUTPUT if args.output_text else 0, kind, len(key), key,
+                         text_len, text_crc, 0, 0, UNKNOWN, 0, 0, 0)
+    with open(args.output, "wb") as f:
+        f.write(header + message)
+    print(f"{args.output}: {len(message)} byte message after a {HEADER.size} byte header")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Function order for the linker from a QEMU instruction-count report.
+
+Reads the report of scripts/icount.py (make icount) and writes a linker
+script fragment, src/section-order.ld, that src/linker.ld includes at
+the start of .text: every function that ran, the hottest first, so that
+the CAST5 rounds, the CFB loops, the iobuf fast paths and memcpy share
+as few cache lines and pages as possible.  Functions that never ran
+(most of gnupg's common code) are left to the catch-all rules after it.
+
+Each message counts equally: a function's weight is the sum over the
+messages of its share of that message's instructions, so the S2K of a
+single passphrase message does not drown out the rest.
+
+Usage (normally through make pgo):
+    scripts/section_order.py -o src/section-order.ld results/icount.json
+"""
+
+import argparse
+import json
+import sys
+
+
+HEADER = """\
+/* Function order for .text, hottest first (src/linker.ld includes this
+ * after the boot code).  Generated by make pgo (scripts/section_order.py)
+ * from {source}.
+ *
+ * Each line takes a function's own section, its clones
+ * (.constprop, .isra, .part) and the .text.hot/.text.unlikely variants
+ * GCC emits at -O2.  Functions that never ran are not listed.
+ */
+"""
+
+
+def weights(report, skip):
+    """Return {function: weight} over the messages of REPORT."""
+    total = {}
+    for entry in report["messages"].values():
+        if not entry["instructions"]:
+            continue
+        for func, count in entry["functions"].items():
+            if func in skip or func.startswith("0x"):
+                continue
+            total[func] = total.get(func, 0.0) + count / entry["instructions"]
+    return total
+
+
+def section_patterns(func):
+    """Return the input section patterns of FUNC."""
+    # GCC names the section of a clone after the clone, f.constprop.0
+    # for f; the report has whichever name the image had.
+    base = func.split(".")[0]
+    names = [func] if base == func else [func, base]
+    pats = []
+    for name in names:
+        pats += [f".text.{name}", f".text.{name}.*",
+                 f".text.hot.{name}", f".text.unlikely.{name}"]
+    return pats
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("report", help="scripts/icount.py report")
+    parser.add_argument("-o", "--output", default="src/section-order.ld")
+    parser.add_argument("--skip", default="_start,hang,main",
+                        help="functions placed by linker.ld itself")
+    args = parser.parse_args()
+
+    with open(args.report) as f:
+        report = json.load(f)
+    w = weights(report, set(args.skip.split(",")))
+    if not w:
+        sys.exit(f"section_order: no counts in {args.report}")
+    order = sorted(w, key=lambda func: (-w[func], func))
+
+    seen = set()
+    lines = []
+    for func in order:
+        pats = [p for p in section_patterns(func) if p not in seen]
+        seen.update(pats)
+        if pats:
+            lines.append(f"*({' '.join(pats)})")
+
+    with open(args.output, "w") as f:
+        f.write(HEADER.format(source=f"{args.report}, counted on {report.get('image', '?')}"))
+        f.write("\n".join(lines) + "\n")
+    print(f"{len(lines)} functions ordered in {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
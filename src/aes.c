@@ -0,0 +1,882 @@
+#include "aes.h"
+#include "gpg-error.h"
+#include "memory.h"
+#include "trace.h"
+
+typedef uint8_t byte;
+typedef uint32_t u32;
+
+// FIPS-197 S-box, and te[x] = S[x] * {02, 01, 01, 03} as a big-endian
+// word; rotating it right by 8, 16 and 24 gives the other three columns.
+static const byte sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static const u32 te[256] = {
+    0xc66363a5, 0xf87c7c84, 0xee777799, 0xf67b7b8d, 0xfff2f20d, 0xd66b6bbd, 0xde6f6fb1, 0x91c5c554,
+    0x60303050, 0x02010103, 0xce6767a9, 0x562b2b7d, 0xe7fefe19, 0xb5d7d762, 0x4dababe6, 0xec76769a,
+    0x8fcaca45, 0x1f82829d, 0x89c9c940, 0xfa7d7d87, 0xeffafa15, 0xb25959eb, 0x8e4747c9, 0xfbf0f00b,
+    0x41adadec, 0xb3d4d467, 0x5fa2a2fd, 0x45afafea, 0x239c9cbf, 0x53a4a4f7, 0xe4727296, 0x9bc0c05b,
+    0x75b7b7c2, 0xe1fdfd1c, 0x3d9393ae, 0x4c26266a, 0x6c36365a, 0x7e3f3f41, 0xf5f7f702, 0x83cccc4f,
+    0x6834345c, 0x51a5a5f4, 0xd1e5e534, 0xf9f1f108, 0xe2717193, 0xabd8d873, 0x62313153, 0x2a15153f,
+    0x0804040c, 0x95c7c752, 0x46232365, 0x9dc3c35e, 0x30181828, 0x379696a1, 0x0a05050f, 0x2f9a9ab5,
+    0x0e070709, 0x24121236, 0x1b80809b, 0xdfe2e23d, 0xcdebeb26, 0x4e272769, 0x7fb2b2cd, 0xea75759f,
+    0x1209091b, 0x1d83839e, 0x582c2c74, 0x341a1a2e, 0x361b1b2d, 0xdc6e6eb2, 0xb45a5aee, 0x5ba0a0fb,
+    0xa45252f6, 0x763b3b4d, 0xb7d6d661, 0x7db3b3ce, 0x5229297b, 0xdde3e33e, 0x5e2f2f71, 0x13848497,
+    0xa65353f5, 0xb9d1d168, 0x00000000, 0xc1eded2c, 0x40202060, 0xe3fcfc1f, 0x79b1b1c8, 0xb65b5bed,
+    0xd46a6abe, 0x8dcbcb46, 0x67bebed9, 0x7239394b, 0x944a4ade, 0x984c4cd4, 0xb05858e8, 0x85cfcf4a,
+    0xbbd0d06b, 0xc5efef2a, 0x4faaaae5, 0xedfbfb16, 0x864343c5, 0x9a4d4dd7, 0x66333355, 0x11858594,
+    0x8a4545cf, 0xe9f9f910, 0x04020206, 0xfe7f7f81, 0xa05050f0, 0x783c3c44, 0x259f9fba, 0x4ba8a8e3,
+    0xa25151f3, 0x5da3a3fe, 0x804040c0, 0x058f8f8a, 0x3f9292ad, 0x219d9dbc, 0x70383848, 0xf1f5f504,
+    0x63bcbcdf, 0x77b6b6c1, 0xafdada75, 0x42212163, 0x20101030, 0xe5ffff1a, 0xfdf3f30e, 0xbfd2d26d,
+    0x81cdcd4c, 0x180c0c14, 0x26131335, 0xc3ecec2f, 0xbe5f5fe1, 0x359797a2, 0x884444cc, 0x2e171739,
+    0x93c4c457, 0x55a7a7f2, 0xfc7e7e82, 0x7a3d3d47, 0xc86464ac, 0xba5d5de7, 0x3219192b, 0xe6737395,
+    0xc06060a0, 0x19818198, 0x9e4f4fd1, 0xa3dcdc7f, 0x44222266, 0x542a2a7e, 0x3b9090ab, 0x0b888883,
+    0x8c4646ca, 0xc7eeee29, 0x6bb8b8d3, 0x2814143c, 0xa7dede79, 0xbc5e5ee2, 0x160b0b1d, 0xaddbdb76,
+    0xdbe0e03b, 0x64323256, 0x743a3a4e, 0x140a0a1e, 0x924949db, 0x0c06060a, 0x4824246c, 0xb85c5ce4,
+    0x9fc2c25d, 0xbdd3d36e, 0x43acacef, 0xc46262a6, 0x399191a8, 0x319595a4, 0xd3e4e437, 0xf279798b,
+    0xd5e7e732, 0x8bc8c843, 0x6e373759, 0xda6d6db7, 0x018d8d8c, 0xb1d5d564, 0x9c4e4ed2, 0x49a9a9e0,
+    0xd86c6cb4, 0xac5656fa, 0xf3f4f407, 0xcfeaea25, 0xca6565af, 0xf47a7a8e, 0x47aeaee9, 0x10080818,
+    0x6fbabad5, 0xf0787888, 0x4a25256f, 0x5c2e2e72, 0x381c1c24, 0x57a6a6f1, 0x73b4b4c7, 0x97c6c651,
+    0xcbe8e823, 0xa1dddd7c, 0xe874749c, 0x3e1f1f21, 0x964b4bdd, 0x61bdbddc, 0x0d8b8b86, 0x0f8a8a85,
+    0xe0707090, 0x7c3e3e42, 0x71b5b5c4, 0xcc6666aa, 0x904848d8, 0x06030305, 0xf7f6f601, 0x1c0e0e12,
+    0xc26161a3, 0x6a35355f, 0xae5757f9, 0x69b9b9d0, 0x17868691, 0x99c1c158, 0x3a1d1d27, 0x279e9eb9,
+    0xd9e1e138, 0xebf8f813, 0x2b9898b3, 0x22111133, 0xd26969bb, 0xa9d9d970, 0x078e8e89, 0x339494a7,
+    0x2d9b9bb6, 0x3c1e1e22, 0x15878792, 0xc9e9e920, 0x87cece49, 0xaa5555ff, 0x50282878, 0xa5dfdf7a,
+    0x038c8c8f, 0x59a1a1f8, 0x09898980, 0x1a0d0d17, 0x65bfbfda, 0xd7e6e631, 0x844242c6, 0xd06868b8,
+    0x824141c3, 0x299999b0, 0x5a2d2d77, 0x1e0f0f11, 0x7bb0b0cb, 0xa85454fc, 0x6dbbbbd6, 0x2c16163a,
+};
+
+// Inverse S-box, and td[x] = S^-1[x] * {0e, 09, 0d, 0b} for the equivalent
+// inverse cipher (FIPS-197 5.3.5).
+static const byte inv_sbox[256] = {
+    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
+    0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
+    0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49, 0x6d, 0x8b, 0xd1, 0x25,
+    0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92,
+    0x6c, 0x70, 0x48, 0x50, 0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05, 0xb8, 0xb3, 0x45, 0x06,
+    0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02, 0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b,
+    0x3a, 0x91, 0x11, 0x41, 0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8, 0x1c, 0x75, 0xdf, 0x6e,
+    0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89, 0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b,
+    0xfc, 0x56, 0x3e, 0x4b, 0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xec, 0x5f,
+    0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d, 0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef,
+    0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d,
+};
+
+static const u32 td[256] = {
+    0x51f4a750, 0x7e416553, 0x1a17a4c3, 0x3a275e96, 0x3bab6bcb, 0x1f9d45f1, 0xacfa58ab, 0x4be30393,
+    0x2030fa55, 0xad766df6, 0x88cc7691, 0xf5024c25, 0x4fe5d7fc, 0xc52acbd7, 0x26354480, 0xb562a38f,
+    0xdeb15a49, 0x25ba1b67, 0x45ea0e98, 0x5dfec0e1, 0xc32f7502, 0x814cf012, 0x8d4697a3, 0x6bd3f9c6,
+    0x038f5fe7, 0x15929c95, 0xbf6d7aeb, 0x955259da, 0xd4be832d, 0x587421d3, 0x49e06929, 0x8ec9c844,
+    0x75c2896a, 0xf48e7978, 0x99583e6b, 0x27b971dd, 0xbee14fb6, 0xf088ad17, 0xc920ac66, 0x7dce3ab4,
+    0x63df4a18, 0xe51a3182, 0x97513360, 0x62537f45, 0xb16477e0, 0xbb6bae84, 0xfe81a01c, 0xf9082b94,
+    0x70486858, 0x8f45fd19, 0x94de6c87, 0x527bf8b7, 0xab73d323, 0x724b02e2, 0xe31f8f57, 0x6655ab2a,
+    0xb2eb2807, 0x2fb5c203, 0x86c57b9a, 0xd33708a5, 0x302887f2, 0x23bfa5b2, 0x02036aba, 0xed16825c,
+    0x8acf1c2b, 0xa779b492, 0xf307f2f0, 0x4e69e2a1, 0x65daf4cd, 0x0605bed5, 0xd134621f, 0xc4a6fe8a,
+    0x342e539d, 0xa2f355a0, 0x058ae132, 0xa4f6eb75, 0x0b83ec39, 0x4060efaa, 0x5e719f06, 0xbd6e1051,
+    0x3e218af9, 0x96dd063d, 0xdd3e05ae, 0x4de6bd46, 0x91548db5, 0x71c45d05, 0x0406d46f, 0x605015ff,
+    0x1998fb24, 0xd6bde997, 0x894043cc, 0x67d99e77, 0xb0e842bd, 0x07898b88, 0xe7195b38, 0x79c8eedb,
+    0xa17c0a47, 0x7c420fe9, 0xf8841ec9, 0x00000000, 0x09808683, 0x322bed48, 0x1e1170ac, 0x6c5a724e,
+    0xfd0efffb, 0x0f853856, 0x3daed51e, 0x362d3927, 0x0a0fd964, 0x685ca621, 0x9b5b54d1, 0x24362e3a,
+    0x0c0a67b1, 0x9357e70f, 0xb4ee96d2, 0x1b9b919e, 0x80c0c54f, 0x61dc20a2, 0x5a774b69, 0x1c121a16,
+    0xe293ba0a, 0xc0a02ae5, 0x3c22e043, 0x121b171d, 0x0e090d0b, 0xf28bc7ad, 0x2db6a8b9, 0x141ea9c8,
+    0x57f11985, 0xaf75074c, 0xee99ddbb, 0xa37f60fd, 0xf701269f, 0x5c72f5bc, 0x44663bc5, 0x5bfb7e34,
+    0x8b432976, 0xcb23c6dc, 0xb6edfc68, 0xb8e4f163, 0xd731dcca, 0x42638510, 0x13972240, 0x84c61120,
+    0x854a247d, 0xd2bb3df8, 0xaef93211, 0xc729a16d, 0x1d9e2f4b, 0xdcb230f3, 0x0d8652ec, 0x77c1e3d0,
+    0x2bb3166c, 0xa970b999, 0x119448fa, 0x47e96422, 0xa8fc8cc4, 0xa0f03f1a, 0x567d2cd8, 0x223390ef,
+    0x87494ec7, 0xd938d1c1, 0x8ccaa2fe, 0x98d40b36, 0xa6f581cf, 0xa57ade28, 0xdab78e26, 0x3fadbfa4,
+    0x2c3a9de4, 0x5078920d, 0x6a5fcc9b, 0x547e4662, 0xf68d13c2, 0x90d8b8e8, 0x2e39f75e, 0x82c3aff5,
+    0x9f5d80be, 0x69d0937c, 0x6fd52da9, 0xcf2512b3, 0xc8ac993b, 0x10187da7, 0xe89c636e, 0xdb3bbb7b,
+    0xcd267809, 0x6e5918f4, 0xec9ab701, 0x834f9aa8, 0xe6956e65, 0xaaffe67e, 0x21bccf08, 0xef15e8e6,
+    0xbae79bd9, 0x4a6f36ce, 0xea9f09d4, 0x29b07cd6, 0x31a4b2af, 0x2a3f2331, 0xc6a59430, 0x35a266c0,
+    0x744ebc37, 0xfc82caa6, 0xe090d0b0, 0x33a7d815, 0xf104984a, 0x41ecdaf7, 0x7fcd500e, 0x1791f62f,
+    0x764dd68d, 0x43efb04d, 0xccaa4d54, 0xe49604df, 0x9ed1b5e3, 0x4c6a881b, 0xc12c1fb8, 0x4665517f,
+    0x9d5eea04, 0x018c355d, 0xfa877473, 0xfb0b412e, 0xb3671d5a, 0x92dbd252, 0xe9105633, 0x6dd64713,
+    0x9ad7618c, 0x37a10c7a, 0x59f8148e, 0xeb133c89, 0xcea927ee, 0xb761c935, 0xe11ce5ed, 0x7a47b13c,
+    0x9cd2df59, 0x55f2733f, 0x1814ce79, 0x73c737bf, 0x53f7cdea, 0x5ffdaa5b, 0xdf3d6f14, 0x7844db86,
+    0xcaaff381, 0xb968c43e, 0x3824342c, 0xc2a3405f, 0x161dc372, 0xbce2250c, 0x283c498b, 0xff0d9541,
+    0x39a80171, 0x080cb3de, 0xd8b4e49c, 0x6456c190, 0x7bcb8461, 0xd532b670, 0x486c5c74, 0xd0b85742,
+};
+
+#define ror32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+// Byte loads and stores: with the MMU off an unaligned LDR faults.
+static u32 load_be32(const byte* p) {
+    return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | p[3];
+}
+
+static void store_be32(byte* p, u32 v) {
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static u32 sub_word(u32 w) {
+    return ((u32)sbox[w >> 24] << 24) | ((u32)sbox[(w >> 16) & 0xff] << 16)
+        | ((u32)sbox[(w >> 8) & 0xff] << 8) | sbox[w & 0xff];
+}
+
+// T-table
+
+void aes_encrypt(void* context, unsigned char* out, const unsigned char* in) {
+    const AES_context* ctx = context;
+    const u32* rk = ctx->rk;
+    u32 s0, s1, s2, s3, t0, t1, t2, t3;
+    int r;
+
+    s0 = load_be32(in) ^ rk[0];
+    s1 = load_be32(in + 4) ^ rk[1];
+    s2 = load_be32(in + 8) ^ rk[2];
+    s3 = load_be32(in + 12) ^ rk[3];
+
+    for (r = 1; r < ctx->rounds; r++) {
+        rk += 4;
+        t0 = te[s0 >> 24] ^ ror32(te[(s1 >> 16) & 0xff], 8)
+            ^ ror32(te[(s2 >> 8) & 0xff], 16) ^ ror32(te[s3 & 0xff], 24) ^ rk[0];
+        t1 = te[s1 >> 24] ^ ror32(te[(s2 >> 16) & 0xff], 8)
+            ^ ror32(te[(s3 >> 8) & 0xff], 16) ^ ror32(te[s0 & 0xff], 24) ^ rk[1];
+        t2 = te[s2 >> 24] ^ ror32(te[(s3 >> 16) & 0xff], 8)
+            ^ ror32(te[(s0 >> 8) & 0xff], 16) ^ ror32(te[s1 & 0xff], 24) ^ rk[2];
+        t3 = te[s3 >> 24] ^ ror32(te[(s0 >> 16) & 0xff], 8)
+            ^ ror32(te[(s1 >> 8) & 0xff], 16) ^ ror32(te[s2 & 0xff], 24) ^ rk[3];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    // Last round: SubBytes and ShiftRows only
+    rk += 4;
+    t0 = ((u32)sbox[s0 >> 24] << 24) | ((u32)sbox[(s1 >> 16) & 0xff] << 16)
+        | ((u32)sbox[(s2 >> 8) & 0xff] << 8) | sbox[s3 & 0xff];
+    t1 = ((u32)sbox[s1 >> 24] << 24) | ((u32)sbox[(s2 >> 16) & 0xff] << 16)
+        | ((u32)sbox[(s3 >> 8) & 0xff] << 8) | sbox[s0 & 0xff];
+    t2 = ((u32)sbox[s2 >> 24] << 24) | ((u32)sbox[(s3 >> 16) & 0xff] << 16)
+        | ((u32)sbox[(s0 >> 8) & 0xff] << 8) | sbox[s1 & 0xff];
+    t3 = ((u32)sbox[s3 >> 24] << 24) | ((u32)sbox[(s0 >> 16) & 0xff] << 16)
+        | ((u32)sbox[(s1 >> 8) & 0xff] << 8) | sbox[s2 & 0xff];
+    store_be32(out, t0 ^ rk[0]);
+    store_be32(out + 4, t1 ^ rk[1]);
+    store_be32(out + 8, t2 ^ rk[2]);
+    store_be32(out + 12, t3 ^ rk[3]);
+}
+
+void aes_decrypt(void* context, unsigned char* out, const unsigned char* in) {
+    const AES_context* ctx = context;
+    const u32* rk = ctx->drk;
+    u32 s0, s1, s2, s3, t0, t1, t2, t3;
+    int r;
+
+    s0 = load_be32(in) ^ rk[0];
+    s1 = load_be32(in + 4) ^ rk[1];
+    s2 = load_be32(in + 8) ^ rk[2];
+    s3 = load_be32(in + 12) ^ rk[3];
+
+    for (r = 1; r < ctx->rounds; r++) {
+        rk += 4;
+        t0 = td[s0 >> 24] ^ ror32(td[(s3 >> 16) & 0xff], 8)
+            ^ ror32(td[(s2 >> 8) & 0xff], 16) ^ ror32(td[s1 & 0xff], 24) ^ rk[0];
+        t1 = td[s1 >> 24] ^ ror32(td[(s0 >> 16) & 0xff], 8)
+            ^ ror32(td[(s3 >> 8) & 0xff], 16) ^ ror32(td[s2 & 0xff], 24) ^ rk[1];
+        t2 = td[s2 >> 24] ^ ror32(td[(s1 >> 16) & 0xff], 8)
+            ^ ror32(td[(s0 >> 8) & 0xff], 16) ^ ror32(td[s3 & 0xff], 24) ^ rk[2];
+        t3 = td[s3 >> 24] ^ ror32(td[(s2 >> 16) & 0xff], 8)
+            ^ ror32(td[(s1 >> 8) & 0xff], 16) ^ ror32(td[s0 & 0xff], 24) ^ rk[3];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    rk += 4;
+    t0 = ((u32)inv_sbox[s0 >> 24] << 24) | ((u32)inv_sbox[(s3 >> 16) & 0xff] << 16)
+        | ((u32)inv_sbox[(s2 >> 8) & 0xff] << 8) | inv_sbox[s1 & 0xff];
+    t1 = ((u32)inv_sbox[s1 >> 24] << 24) | ((u32)inv_sbox[(s0 >> 16) & 0xff] << 16)
+        | ((u32)inv_sbox[(s3 >> 8) & 0xff] << 8) | inv_sbox[s2 & 0xff];
+    t2 = ((u32)inv_sbox[s2 >> 24] << 24) | ((u32)inv_sbox[(s1 >> 16) & 0xff] << 16)
+        | ((u32)inv_sbox[(s0 >> 8) & 0xff] << 8) | inv_sbox[s3 & 0xff];
+    t3 = ((u32)inv_sbox[s3 >> 24] << 24) | ((u32)inv_sbox[(s2 >> 16) & 0xff] << 16)
+        | ((u32)inv_sbox[(s1 >> 8) & 0xff] << 8) | inv_sbox[s0 & 0xff];
+    store_be32(out, t0 ^ rk[0]);
+    store_be32(out + 4, t1 ^ rk[1]);
+    store_be32(out + 8, t2 ^ rk[2]);
+    store_be32(out + 12, t3 ^ rk[3]);
+}
+
+#if USE_AES_BITSLICE
+
+// Bit-sliced, after BearSSL's aes_ct64 (Thomas Pornin, MIT licence).
+// Four blocks share a 64-bit lane; the vector holds two lanes, so every
+// operation below works on eight blocks at once.  Q[i] holds bit i of
+// every byte.
+
+typedef aes_bs_word bs;
+
+// The S-box circuit of Boyar and Peralta, "A new combinational logic
+// minimization technique with applications to cryptology"
+// (https://eprint.iacr.org/2009/191.pdf).  x0 is the high bit.
+static void bs_sbox(bs* q) {
+    bs x0, x1, x2, x3, x4, x5, x6, x7;
+    bs y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    bs y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    bs y20, y21;
+    bs z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    bs z10, z11, z12, z13, z14, z15, z16, z17;
+    bs t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    bs t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    bs t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    bs t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    bs t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    bs t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    bs t60, t61, t62, t63, t64, t65, t66, t67;
+    bs s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    // Top linear transformation
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    // Non-linear section
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    // Bottom linear transformation
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+// Transpose between "one block per word pair" and bit planes.
+static void bs_ortho(bs* q) {
+#define SWAPN(cl, ch, s, x, y)                              \
+    do {                                                    \
+        bs a = (x), b = (y);                                \
+        (x) = (a & (uint64_t)(cl)) | ((b & (uint64_t)(cl)) << (s)); \
+        (y) = ((a & (uint64_t)(ch)) >> (s)) | (b & (uint64_t)(ch)); \
+    } while (0)
+#define SWAP2(x, y) SWAPN(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, x, y)
+#define SWAP4(x, y) SWAPN(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, x, y)
+#define SWAP8(x, y) SWAPN(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, x, y)
+
+    SWAP2(q[0], q[1]);
+    SWAP2(q[2], q[3]);
+    SWAP2(q[4], q[5]);
+    SWAP2(q[6], q[7]);
+
+    SWAP4(q[0], q[2]);
+    SWAP4(q[1], q[3]);
+    SWAP4(q[4], q[6]);
+    SWAP4(q[5], q[7]);
+
+    SWAP8(q[0], q[4]);
+    SWAP8(q[1], q[5]);
+    SWAP8(q[2], q[6]);
+    SWAP8(q[3], q[7]);
+
+#undef SWAP8
+#undef SWAP4
+#undef SWAP2
+#undef SWAPN
+}
+
+// Spread the little-endian words W[0..3] of one block over two words;
+// each lane of the vectors carries a different block.
+static void interleave_in(bs* q0, bs* q1, const bs* w) {
+    bs x0 = w[0], x1 = w[1], x2 = w[2], x3 = w[3];
+
+    x0 |= x0 << 16;
+    x1 |= x1 << 16;
+    x2 |= x2 << 16;
+    x3 |= x3 << 16;
+    x0 &= 0x0000FFFF0000FFFFULL;
+    x1 &= 0x0000FFFF0000FFFFULL;
+    x2 &= 0x0000FFFF0000FFFFULL;
+    x3 &= 0x0000FFFF0000FFFFULL;
+    x0 |= x0 << 8;
+    x1 |= x1 << 8;
+    x2 |= x2 << 8;
+    x3 |= x3 << 8;
+    x0 &= 0x00FF00FF00FF00FFULL;
+    x1 &= 0x00FF00FF00FF00FFULL;
+    x2 &= 0x00FF00FF00FF00FFULL;
+    x3 &= 0x00FF00FF00FF00FFULL;
+    *q0 = x0 | (x2 << 8);
+    *q1 = x1 | (x3 << 8);
+}
+
+static void interleave_out(bs* w, bs q0, bs q1) {
+    bs x0, x1, x2, x3;
+
+    x0 = q0 & 0x00FF00FF00FF00FFULL;
+    x1 = q1 & 0x00FF00FF00FF00FFULL;
+    x2 = (q0 >> 8) & 0x00FF00FF00FF00FFULL;
+    x3 = (q1 >> 8) & 0x00FF00FF00FF00FFULL;
+    x0 |= x0 >> 8;
+    x1 |= x1 >> 8;
+    x2 |= x2 >> 8;
+    x3 |= x3 >> 8;
+    x0 &= 0x0000FFFF0000FFFFULL;
+    x1 &= 0x0000FFFF0000FFFFULL;
+    x2 &= 0x0000FFFF0000FFFFULL;
+    x3 &= 0x0000FFFF0000FFFFULL;
+    w[0] = (x0 | (x0 >> 16)) & 0xFFFFFFFFULL;
+    w[1] = (x1 | (x1 >> 16)) & 0xFFFFFFFFULL;
+    w[2] = (x2 | (x2 >> 16)) & 0xFFFFFFFFULL;
+    w[3] = (x3 | (x3 >> 16)) & 0xFFFFFFFFULL;
+}
+
+static u32 load_le32(const byte* p) {
+    return p[0] | ((u32)p[1] << 8) | ((u32)p[2] << 16) | ((u32)p[3] << 24);
+}
+
+static void store_le32(byte* p, u32 v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+// Eight 16-byte blocks at SRC to bit planes; block k goes to lane k / 4.
+static void bs_load(bs* q, const byte* src) {
+    bs w[4];
+    int k, j;
+
+    for (k = 0; k < 4; k++) {
+        for (j = 0; j < 4; j++)
+            w[j] = (bs){ load_le32(src + 16 * k + 4 * j),
+                         load_le32(src + 16 * (k + 4) + 4 * j) };
+        interleave_in(&q[k], &q[k + 4], w);
+    }
+    bs_ortho(q);
+}
+
+static void bs_store(byte* dst, bs* q) {
+    bs w[4];
+    int k, j;
+
+    bs_ortho(q);
+    for (k = 0; k < 4; k++) {
+        interleave_out(w, q[k], q[k + 4]);
+        for (j = 0; j < 4; j++) {
+            store_le32(dst + 16 * k + 4 * j, w[j][0]);
+            store_le32(dst + 16 * (k + 4) + 4 * j, w[j][1]);
+        }
+    }
+}
+
+static void bs_add_round_key(bs* q, const bs* sk) {
+    int i;
+
+    for (i = 0; i < 8; i++)
+        q[i] ^= sk[i];
+}
+
+static void bs_shift_rows(bs* q) {
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        bs x = q[i];
+
+        q[i] = (x & 0x000000000000FFFFULL)
+            | ((x & 0x00000000FFF00000ULL) >> 4)
+            | ((x & 0x00000000000F0000ULL) << 12)
+            | ((x & 0x0000FF0000000000ULL) >> 8)
+            | ((x & 0x000000FF00000000ULL) << 8)
+            | ((x & 0xF000000000000000ULL) >> 12)
+            | ((x & 0x0FFF000000000000ULL) << 4);
+    }
+}
+
+#define rotr32x2(x) (((x) << 32) | ((x) >> 32))
+
+static void bs_mix_columns(bs* q) {
+    bs q0, q1, q2, q3, q4, q5, q6, q7;
+    bs r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> 16) | (q0 << 48);
+    r1 = (q1 >> 16) | (q1 << 48);
+    r2 = (q2 >> 16) | (q2 << 48);
+    r3 = (q3 >> 16) | (q3 << 48);
+    r4 = (q4 >> 16) | (q4 << 48);
+    r5 = (q5 >> 16) | (q5 << 48);
+    r6 = (q6 >> 16) | (q6 << 48);
+    r7 = (q7 >> 16) | (q7 << 48);
+
+    q[0] = q7 ^ r7 ^ r0 ^ rotr32x2(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr32x2(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ rotr32x2(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr32x2(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr32x2(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ rotr32x2(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ rotr32x2(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ rotr32x2(q7 ^ r7);
+}
+
+// S^-1(x) = B(S(B(x ^ 63)) ^ 63), B being the inverse of the S-box's
+// affine map; bit i of B(x) ^ 05 is x[i+2] ^ x[i+5] ^ x[i+7] ^ (05 >> i).
+static void bs_inv_affine(bs* q) {
+    bs x[8];
+    int i;
+
+    for (i = 0; i < 8; i++)
+        x[i] = q[i];
+    for (i = 0; i < 8; i++)
+        q[i] = x[(i + 2) & 7] ^ x[(i + 5) & 7] ^ x[(i + 7) & 7];
+    q[0] = ~q[0];
+    q[2] = ~q[2];
+}
+
+static void bs_inv_sbox(bs* q) {
+    bs_inv_affine(q);
+    bs_sbox(q);
+    bs_inv_affine(q);
+}
+
+static void bs_inv_shift_rows(bs* q) {
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        bs x = q[i];
+
+        q[i] = (x & 0x000000000000FFFFULL)
+            | ((x & 0x000000000FFF0000ULL) << 4)
+            | ((x & 0x00000000F0000000ULL) >> 12)
+            | ((x & 0x000000FF00000000ULL) << 8)
+            | ((x & 0x0000FF0000000000ULL) >> 8)
+            | ((x & 0x000F000000000000ULL) << 12)
+            | ((x & 0xFFF0000000000000ULL) >> 4);
+    }
+}
+
+// {0e, 0b, 0d, 09} = {02, 03, 01, 01} x {05, 00, 04, 00} as circulants,
+// so apply a ^= 04 * (a ^ a[row + 2]) and then MixColumns.
+static void bs_inv_mix_columns(bs* q) {
+    bs d[8], t;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        d[i] = q[i] ^ rotr32x2(q[i]);
+    // Two xtimes: planes move up one bit, the top one folding into 0x1b
+    for (i = 0; i < 2; i++) {
+        t = d[7];
+        d[7] = d[6];
+        d[6] = d[5];
+        d[5] = d[4];
+        d[4] = d[3] ^ t;
+        d[3] = d[2] ^ t;
+        d[2] = d[1];
+        d[1] = d[0] ^ t;
+        d[0] = t;
+    }
+    for (i = 0; i < 8; i++)
+        q[i] ^= d[i];
+    bs_mix_columns(q);
+}
+
+// Encrypt the eight blocks at BUF in place.
+static void bs_encrypt8(const AES_context* ctx, byte* buf) {
+    const bs* sk = ctx->bskey;
+    bs q[8];
+    int r;
+
+    bs_load(q, buf);
+    bs_add_round_key(q, sk);
+    for (r = 1; r < ctx->rounds; r++) {
+        bs_sbox(q);
+        bs_shift_rows(q);
+        bs_mix_columns(q);
+        bs_add_round_key(q, sk + 8 * r);
+    }
+    bs_sbox(q);
+    bs_shift_rows(q);
+    bs_add_round_key(q, sk + 8 * ctx->rounds);
+    bs_store(buf, q);
+    wipememory(q, sizeof q);
+}
+
+// Decrypt the eight blocks at BUF in place, with the encryption round keys.
+static void bs_decrypt8(const AES_context* ctx, byte* buf) {
+    const bs* sk = ctx->bskey;
+    bs q[8];
+    int r;
+
+    bs_load(q, buf);
+    bs_add_round_key(q, sk + 8 * ctx->rounds);
+    for (r = ctx->rounds - 1; r > 0; r--) {
+        bs_inv_shift_rows(q);
+        bs_inv_sbox(q);
+        bs_add_round_key(q, sk + 8 * r);
+        bs_inv_mix_columns(q);
+    }
+    bs_inv_shift_rows(q);
+    bs_inv_sbox(q);
+    bs_add_round_key(q, sk);
+    bs_store(buf, q);
+    wipememory(q, sizeof q);
+}
+
+// Round key R, replicated into all eight blocks, as bit planes.
+static void bs_expand_key(AES_context* ctx) {
+    byte rk[8 * AES_BLOCKSIZE];
+    int r, k;
+
+    for (r = 0; r <= ctx->rounds; r++) {
+        for (k = 0; k < 4; k++)
+            store_be32(rk + 4 * k, ctx->rk[4 * r + k]);
+        for (k = 1; k < 8; k++)
+            memcpy(rk + AES_BLOCKSIZE * k, rk, AES_BLOCKSIZE);
+        bs_load(ctx->bskey + 8 * r, rk);
+    }
+    wipememory(rk, sizeof rk);
+}
+
+#endif /* USE_AES_BITSLICE */
+
+void aes_cfb_dec(void* context, unsigned char* iv, void* outbuf_arg,
+                 const void* inbuf_arg, size_t nblocks) {
+    const AES_context* ctx = context;
+    byte* outbuf = outbuf_arg;
+    const byte* inbuf = inbuf_arg;
+    size_t i;
+
+#if USE_AES_BITSLICE
+    // Block k's keystream is E(C[k-1]): eight at a time.
+    if (nblocks >= 8) {
+        byte ks[8 * AES_BLOCKSIZE];
+
+        for (; nblocks >= 8; nblocks -= 8) {
+            memcpy(ks, iv, AES_BLOCKSIZE);
+            memcpy(ks + AES_BLOCKSIZE, inbuf, 7 * AES_BLOCKSIZE);
+            memcpy(iv, inbuf + 7 * AES_BLOCKSIZE, AES_BLOCKSIZE);
+            bs_encrypt8(ctx, ks);
+            for (i = 0; i < sizeof ks; i++)
+                outbuf[i] = inbuf[i] ^ ks[i];
+            outbuf += sizeof ks;
+            inbuf += sizeof ks;
+        }
+        wipememory(ks, sizeof ks);
+    }
+#endif
+
+    for (; nblocks; nblocks--) {
+        aes_encrypt(context, iv, iv);
+        for (i = 0; i < AES_BLOCKSIZE; i++) {
+            byte c = inbuf[i];
+
+            outbuf[i] = iv[i] ^ c;
+            iv[i] = c;
+        }
+        outbuf += AES_BLOCKSIZE;
+        inbuf += AES_BLOCKSIZE;
+    }
+}
+
+void aes_ecb_enc(void* context, void* outbuf_arg, const void* inbuf_arg,
+                 size_t nblocks) {
+    byte* outbuf = outbuf_arg;
+    const byte* inbuf = inbuf_arg;
+
+#if USE_AES_BITSLICE
+    for (; nblocks >= 8; nblocks -= 8) {
+        if (outbuf != inbuf)
+            memcpy(outbuf, inbuf, 8 * AES_BLOCKSIZE);
+        bs_encrypt8(context, outbuf);
+        outbuf += 8 * AES_BLOCKSIZE;
+        inbuf += 8 * AES_BLOCKSIZE;
+    }
+#endif
+    for (; nblocks; nblocks--) {
+        aes_encrypt(context, outbuf, inbuf);
+        outbuf += AES_BLOCKSIZE;
+        inbuf += AES_BLOCKSIZE;
+    }
+}
+
+void aes_ecb_dec(void* context, void* outbuf_arg, const void* inbuf_arg,
+                 size_t nblocks) {
+    byte* outbuf = outbuf_arg;
+    const byte* inbuf = inbuf_arg;
+
+#if USE_AES_BITSLICE
+    for (; nblocks >= 8; nblocks -= 8) {
+        if (outbuf != inbuf)
+            memcpy(outbuf, inbuf, 8 * AES_BLOCKSIZE);
+        bs_decrypt8(context, outbuf);
+        outbuf += 8 * AES_BLOCKSIZE;
+        inbuf += 8 * AES_BLOCKSIZE;
+    }
+#endif
+    for (; nblocks; nblocks--) {
+        aes_decrypt(context, outbuf, inbuf);
+        outbuf += AES_BLOCKSIZE;
+        inbuf += AES_BLOCKSIZE;
+    }
+}
+
+// Key schedule and self-test
+
+// InvMixColumns of one word, for the decryption round keys: td undoes
+// the S-box, so feed it S[x].
+static u32 inv_mix_word(u32 w) {
+    return td[sbox[w >> 24]] ^ ror32(td[sbox[(w >> 16) & 0xff]], 8)
+        ^ ror32(td[sbox[(w >> 8) & 0xff]], 16) ^ ror32(td[sbox[w & 0xff]], 24);
+}
+
+static int do_setkey(AES_context* ctx, const byte* key, size_t keylen) {
+    int nk, i;
+    u32 t, rcon = 1;
+
+    if (keylen != 16 && keylen != 24 && keylen != 32)
+        return GPG_ERR_INV_KEYLEN;
+    nk = keylen / 4;
+    ctx->rounds = nk + 6;
+
+    for (i = 0; i < nk; i++)
+        ctx->rk[i] = load_be32(key + 4 * i);
+    for (; i < 4 * (ctx->rounds + 1); i++) {
+        t = ctx->rk[i - 1];
+        if (i % nk == 0) {
+            t = sub_word((t << 8) | (t >> 24)) ^ (rcon << 24);
+            rcon = (rcon << 1) ^ (rcon & 0x80 ? 0x1b : 0);
+        } else if (nk > 6 && i % nk == 4) {
+            t = sub_word(t);
+        }
+        ctx->rk[i] = ctx->rk[i - nk] ^ t;
+    }
+    // Equivalent inverse cipher: the rounds reversed, inner ones mixed
+    for (i = 0; i <= ctx->rounds; i++) {
+        int j;
+
+        for (j = 0; j < 4; j++) {
+            t = ctx->rk[4 * (ctx->rounds - i) + j];
+            ctx->drk[4 * i + j] = i && i < ctx->rounds ? inv_mix_word(t) : t;
+        }
+    }
+#if USE_AES_BITSLICE
+    bs_expand_key(ctx);
+#endif
+    return 0;
+}
+
+static const char* selftest(void) {
+    // FIPS-197 appendix C both ways, and eight blocks through both
+    // implementations
+    static const byte pt[16] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+    };
+    static const byte ct[3][16] = {
+        { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+          0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+        { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+          0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+        { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+          0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 }
+    };
+    AES_context ctx;
+    byte key[32], buf[8 * AES_BLOCKSIZE];
+#if USE_AES_BITSLICE
+    byte ref[8 * AES_BLOCKSIZE];
+#endif
+    int i, k;
+
+    for (i = 0; i < 32; i++)
+        key[i] = i;
+    for (k = 0; k < 3; k++) {
+        if (do_setkey(&ctx, key, 16 + 8 * k))
+            return "setkey";
+        aes_encrypt(&ctx, buf, pt);
+        if (memcmp(buf, ct[k], AES_BLOCKSIZE))
+            return "T-table";
+        aes_decrypt(&ctx, buf, buf);
+        if (memcmp(buf, pt, AES_BLOCKSIZE))
+            return "T-table decrypt";
+#if USE_AES_BITSLICE
+        for (i = 0; i < (int)sizeof buf; i++)
+            buf[i] = pt[i % AES_BLOCKSIZE] ^ (i / AES_BLOCKSIZE);
+        for (i = 0; i < 8; i++)
+            aes_encrypt(&ctx, ref + AES_BLOCKSIZE * i, buf + AES_BLOCKSIZE * i);
+        bs_encrypt8(&ctx, buf);
+        if (memcmp(buf, ref, sizeof ref))
+            return "bit-sliced";
+        for (i = 0; i < 8; i++)
+            aes_decrypt(&ctx, ref + AES_BLOCKSIZE * i, buf + AES_BLOCKSIZE * i);
+        bs_decrypt8(&ctx, buf);
+        if (memcmp(buf, ref, sizeof ref))
+            return "bit-sliced decrypt";
+#endif
+    }
+    wipememory(&ctx, sizeof ctx);
+    return NULL;
+}
+
+int aes_setkey(void* context, const unsigned char* key, size_t keylen) {
+    static int initialized;
+    static const char* selftest_failed;
+
+    if (!initialized) {
+        initialized = 1;
+        selftest_failed = selftest();
+        if (selftest_failed)
+            TRACE(TRACE_ERROR, "AES selftest failed (%s)\n", selftest_failed);
+    }
+    if (selftest_failed)
+        return GPG_ERR_SELFTEST_FAILED;
+    return do_setkey(context, key, keylen);
+}
@@ -0,0 +1,65 @@
+/* aes.h - AES-128/192/256 block cipher for the modes in libgcrypt.c
+ *
+ * Single blocks go through a T-table implementation: one 1 KiB table,
+ * the other three columns being rotations of it, which ARM folds into
+ * the EOR, and its inverse for decryption.  CFB decryption and the OCB
+ * and EAX bulk paths are parallel across blocks, so runs of eight are
+ * handed to a bit-sliced implementation (Boyar-Peralta S-box,
+ * BearSSL's ct64 layout) written with GCC vector types: two 64-bit
+ * lanes of four blocks each, i.e. one NEON q register per bit plane on
+ * the Cortex-A7 and one SSE register in the host build.  It is
+ * constant time and needs no tables.
+ *
+ * USE_AES_BITSLICE defaults to on where the compiler has 128-bit
+ * vectors; the Makefile builds aes.o with NEON enabled.
+ */
+#ifndef AES_H
+#define AES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef USE_AES_BITSLICE
+#if defined(__ARM_NEON) || defined(__SSE2__)
+#define USE_AES_BITSLICE 1
+#else
+#define USE_AES_BITSLICE 0
+#endif
+#endif
+
+#define AES_BLOCKSIZE 16
+#define AES_MAXROUNDS 14
+
+/* Eight bit planes of eight blocks.  The handle comes from the TLSF heap,
+   which only guarantees 8-byte alignment, so the type must not assume
+   more. */
+typedef uint64_t aes_bs_word __attribute__((vector_size(16), aligned(8)));
+
+/* Only aes.o is built with NEON, so the layout must not depend on
+   USE_AES_BITSLICE: the rest of the kernel sizes handles from it too. */
+typedef struct {
+    int rounds;                                 // 10, 12 or 14
+    uint32_t rk[4 * (AES_MAXROUNDS + 1)];       // Big-endian round key words
+    uint32_t drk[4 * (AES_MAXROUNDS + 1)];      // Same for aes_decrypt
+    aes_bs_word bskey[8 * (AES_MAXROUNDS + 1)]; // Round keys, bit-sliced
+} AES_context;
+
+// Expand a 16, 24 or 32 byte KEY; 0 or a GPG_ERR_ code.
+int aes_setkey(void* ctx, const unsigned char* key, size_t keylen);
+
+// Encrypt the block at IN to OUT; they may be the same.
+void aes_encrypt(void* ctx, unsigned char* out, const unsigned char* in);
+
+// Decrypt the block at IN to OUT; they may be the same.
+void aes_decrypt(void* ctx, unsigned char* out, const unsigned char* in);
+
+// Encrypt or decrypt NBLOCKS independent blocks, bit-sliced eight at a
+// time; for the OCB and EAX modes.  OUT may equal IN.
+void aes_ecb_enc(void* ctx, void* out, const void* in, size_t nblocks);
+void aes_ecb_dec(void* ctx, void* out, const void* in, size_t nblocks);
+
+// CFB-decrypt NBLOCKS full blocks from IN to OUT, updating IV.
+void aes_cfb_dec(void* ctx, unsigned char* iv, void* out, const void* in,
+                 size_t nblocks);
+
+#endif /* AES_H */
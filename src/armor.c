@@ -0,0 +1,434 @@
+/* armor.c - Decode ASCII armored OpenPGP messages
+ *
+ * armor_filter turns "-----BEGIN PGP MESSAGE-----", its header lines,
+ * the radix-64 body and the CRC-24 line back into the binary message.
+ * Text before the BEGIN line is skipped; the CRC line is optional.
+ *
+ * The body is decoded four characters at a time through four lookup
+ * tables that place each character's sextet at its final bit position
+ * and mark invalid characters in the top byte, so one OR and one test
+ * per group decide between the fast path and the character loop that
+ * handles line ends, padding and the CRC.  Where the compiler has
+ * 128-bit vectors (NEON on the Cortex-A7, SSE2 on the host) sixteen
+ * characters at a time are translated and packed in registers first.
+ * The CRC-24 is computed over the decoded bytes of each underflow while
+ * they are still in the cache, four bytes per step (slice-by-4).
+ */
+
+#include "common/config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memory.h"
+#include "gpg.h"
+#include "printf.h"
+#include "trace.h"
+#include "filter.h"
+
+#ifndef USE_ARMOR_SIMD
+#if defined(__ARM_NEON) || defined(__SSE2__)
+#define USE_ARMOR_SIMD 1
+#else
+#define USE_ARMOR_SIMD 0
+#endif
+#endif
+
+#define CRCINIT 0xB704CE
+#define CRCPOLY 0x864CFB
+
+enum
+  {
+    ARMOR_BEGIN,        /* Looking for the BEGIN line */
+    ARMOR_HEADERS,      /* Header lines up to the empty one */
+    ARMOR_BODY,
+    ARMOR_PAD,          /* In the '=' padding; quad counts what is left */
+    ARMOR_CRC,          /* In the "=XXXX" line */
+    ARMOR_DONE
+  };
+
+static int initialized;
+
+/* asctobin[k][c] is the sextet of C shifted into group position K
+   (0 is the first character) or 0xff000000 if C is not radix-64.  */
+static u32 asctobin[4][256];
+
+/* crc_table[k][i] advances a CRC-24, held in the top three bytes of a
+   word, over byte I followed by K zero bytes.  */
+static u32 crc_table[4][256];
+
+static void
+initialize (void)
+{
+  static const char bintoasc[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  u32 r;
+  int i, j, k;
+
+  for (i = 0; i < 256; i++)
+    for (k = 0; k < 4; k++)
+      asctobin[k][i] = 0xff000000;
+  for (i = 0; i < 64; i++)
+    for (k = 0; k < 4; k++)
+      asctobin[k][(byte)bintoasc[i]] = (u32)i << (6 * (3 - k));
+
+  for (i = 0; i < 256; i++)
+    {
+      r = (u32)i << 24;
+      for (j = 0; j < 8; j++)
+        r = (r & 0x80000000) ? (r << 1) ^ (CRCPOLY << 8) : r << 1;
+      crc_table[0][i] = r;
+    }
+  for (k = 1; k < 4; k++)
+    for (i = 0; i < 256; i++)
+      {
+        r = crc_table[k - 1][i];
+        crc_table[k][i] = (r << 8) ^ crc_table[0][r >> 24];
+      }
+  initialized = 1;
+}
+
+static u32
+crc24_update (u32 crc, const byte *p, size_t n)
+{
+  u32 s = crc << 8;
+
+  for (; n >= 4; n -= 4, p += 4)
+    {
+      s ^= (u32)p[0] << 24 | (u32)p[1] << 16 | (u32)p[2] << 8 | p[3];
+      s = (crc_table[3][s >> 24] ^ crc_table[2][(s >> 16) & 0xff]
+           ^ crc_table[1][(s >> 8) & 0xff] ^ crc_table[0][s & 0xff]);
+    }
+  for (; n; n--)
+    s = (s << 8) ^ crc_table[0][(s >> 24) ^ *p++];
+  return s >> 8;
+}
+
+#if USE_ARMOR_SIMD
+/* Byte-aligned, so loads and stores need no alignment (vld1.8).  */
+typedef byte armor_v16 __attribute__((vector_size(16), aligned(1)));
+typedef u32 armor_v4 __attribute__((vector_size(16)));
+typedef unsigned long long armor_v2 __attribute__((vector_size(16)));
+
+/* Decode the 16 characters at IN to 12 bytes at OUT, which must have
+   room for 16.  Returns 0, writing nothing, if one of them is not
+   radix-64.  */
+static int
+decode16 (const byte *in, byte *out)
+{
+  static const armor_v16 order =
+    { 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0, 0, 0, 0 };
+  armor_v16 c = *(const armor_v16 *)in;
+  armor_v16 d, m, val, ok;
+  armor_v2 all;
+  armor_v4 w;
+
+  d = c - 'A';
+  ok = m = (armor_v16)(d < 26);
+  val = m & d;
+  d = c - 'a';
+  ok |= m = (armor_v16)(d < 26);
+  val |= m & (d + 26);
+  d = c - '0';
+  ok |= m = (armor_v16)(d < 10);
+  val |= m & (d + 52);
+  ok |= m = (armor_v16)(c == '+');
+  val |= m & 62;
+  ok |= m = (armor_v16)(c == '/');
+  val |= m & 63;
+  all = (armor_v2)ok;
+  if ((all[0] & all[1]) != ~0ULL)
+    return 0;
+
+  /* Each word holds one group, first sextet in the low byte.  */
+  w = (armor_v4)val;
+  w = (w & 0x3f) << 18 | (w & 0x3f00) << 4 | ((w >> 10) & 0xfc0) | w >> 24;
+  *(armor_v16 *)out = __builtin_shuffle ((armor_v16)w, order);
+  return 1;
+}
+#endif /* USE_ARMOR_SIMD */
+
+armor_filter_context_t *
+new_armor_context (void)
+{
+  armor_filter_context_t *afx;
+
+  if (!initialized)
+    initialize ();
+  afx = xtrycalloc (1, sizeof *afx);
+  if (afx)
+    {
+      afx->refcount = 1;
+      afx->crc = CRCINIT;
+    }
+  return afx;
+}
+
+void
+release_armor_context (armor_filter_context_t *afx)
+{
+  if (!afx)
+    return;
+  if (--afx->refcount)
+    return;
+  xfree (afx);
+}
+
+int
+push_armor_filter (armor_filter_context_t *afx, iobuf_t iobuf)
+{
+  int rc;
+
+  afx->refcount++;
+  rc = iobuf_push_filter (iobuf, armor_filter, afx);
+  if (rc)
+    afx->refcount--;
+  return rc;
+}
+
+/* Binary OpenPGP starts with a packet tag, which has the high bit
+   set; anything else is taken to be armored.  */
+int
+use_armor_filter( iobuf_t a )
+{
+  byte buf[1];
+  int n;
+
+  n = iobuf_peek (a, buf, 1);
+  if (n == -1)
+    return 0; /* EOF, doesn't matter whether armored or not.  */
+  if (!n)
+    return 1; /* Can't check it: try armored.  */
+  return !(*buf & 0x80);
+}
+
+/* A complete line of the BEGIN or HEADERS state is in afx->line.  */
+static void
+header_line (armor_filter_context_t *afx)
+{
+  static const char begin[] = "-----BEGIN PGP ";
+  char *line = afx->line;
+  unsigned int n = afx->linelen;
+
+  while (n && (line[n-1] == '\r' || line[n-1] == ' ' || line[n-1] == '\t'))
+    n--;
+  afx->linelen = 0;
+
+  if (afx->state == ARMOR_BEGIN)
+    {
+      if (n < sizeof begin - 1 || memcmp (line, begin, sizeof begin - 1))
+        return;
+      line += sizeof begin - 1;
+      n -= sizeof begin - 1;
+      if (n == 12 && !memcmp (line, "MESSAGE-----", 12))
+        afx->state = ARMOR_HEADERS;
+      else
+        {
+          TRACE (TRACE_ERROR, "armor: not a PGP MESSAGE\n");
+          afx->err = gpg_error (GPG_ERR_NO_DATA);
+        }
+    }
+  else if (!n)
+    {
+      afx->state = ARMOR_BODY;
+      afx->at_bol = 1;
+    }
+  else if (!memchr (line, ':', n))
+    {
+      TRACE (TRACE_ERROR, "armor: invalid header line\n");
+      afx->err = gpg_error (GPG_ERR_INV_ARMOR);
+    }
+}
+
+/* Store the N decoded bytes at P, keeping what does not fit in BUF for
+   the next underflow.  */
+static void
+emit (armor_filter_context_t *afx, byte *buf, size_t *pos, size_t size,
+      const byte *p, unsigned int n)
+{
+  while (n && *pos < size)
+    {
+      buf[(*pos)++] = *p++;
+      n--;
+    }
+  while (n--)
+    afx->pend[afx->npend++] = *p++;
+}
+
+/* Feed one body, padding or CRC character C.  */
+static void
+body_char (armor_filter_context_t *afx, int c, byte *buf, size_t *pos,
+           size_t size, size_t crcpos)
+{
+  u32 v = asctobin[3][c];
+  byte tmp[3];
+
+  if (afx->state == ARMOR_BODY && v < 64)
+    {
+      afx->quad = afx->quad << 6 | v;
+      if (++afx->nquad == 4)
+        {
+          tmp[0] = afx->quad >> 16;
+          tmp[1] = afx->quad >> 8;
+          tmp[2] = afx->quad;
+          emit (afx, buf, pos, size, tmp, 3);
+          afx->quad = afx->nquad = 0;
+        }
+      afx->at_bol = 0;
+    }
+  else if (afx->state == ARMOR_CRC && v < 64)
+    {
+      afx->quad = afx->quad << 6 | v;
+      if (++afx->nquad == 4)
+        {
+          afx->crc = crc24_update (afx->crc, buf + crcpos, *pos - crcpos);
+          if (afx->quad != afx->crc)
+            {
+              TRACE (TRACE_ERROR, "armor: CRC error; %06x - %06x\n",
+                     (unsigned)afx->crc, afx->quad);
+              afx->err = gpg_error (GPG_ERR_INV_ARMOR);
+            }
+          afx->state = ARMOR_DONE;
+        }
+    }
+  else if (c == '\n')
+    afx->at_bol = 1;
+  else if (c == '\r' || c == ' ' || c == '\t')
+    ;
+  else if (afx->state == ARMOR_CRC)
+    afx->err = gpg_error (GPG_ERR_INV_ARMOR);
+  else if (c == '=' && afx->state == ARMOR_PAD && afx->quad)
+    afx->quad--;
+  else if (c == '=' && afx->at_bol && !afx->nquad)
+    {
+      afx->state = ARMOR_CRC;
+      afx->quad = 0;
+    }
+  else if (c == '-' && afx->at_bol && !afx->nquad)
+    afx->state = ARMOR_DONE;   /* END line, no CRC */
+  else if (c == '=' && afx->state == ARMOR_BODY && afx->nquad >= 2)
+    {
+      /* Two sextets make one byte and are followed by one more '=',
+         three make two.  */
+      tmp[0] = afx->quad >> (afx->nquad == 2 ? 4 : 10);
+      tmp[1] = afx->quad >> 2;
+      emit (afx, buf, pos, size, tmp, afx->nquad - 1);
+      afx->quad = afx->nquad == 2;
+      afx->nquad = 0;
+      afx->state = ARMOR_PAD;
+      afx->at_bol = 0;
+    }
+  else
+    {
+      TRACE (TRACE_ERROR, "armor: invalid radix64 character %02x\n", c);
+      afx->err = gpg_error (GPG_ERR_INV_ARMOR);
+    }
+}
+
+/* Decode into BUF until it is full, the input ends or the armor does.  */
+static size_t
+armor_read (armor_filter_context_t *afx, iobuf_t a, byte *buf, size_t size)
+{
+  const byte *in = afx->inbuf;
+  size_t o = 0, crcpos = 0, i, end;
+  int n, c;
+  u32 v;
+
+  /* What did not fit last time, as much as fits now.  */
+  for (i = 0; i < afx->npend && o < size; i++)
+    buf[o++] = afx->pend[i];
+  afx->npend -= i;
+  memmove (afx->pend, afx->pend + i, afx->npend);
+
+  while (o < size && !afx->npend && !afx->err && afx->state != ARMOR_DONE)
+    {
+      if (afx->inpos == afx->inlen)
+        {
+          n = iobuf_read (a, afx->inbuf, sizeof afx->inbuf);
+          if (n == -1)
+            {
+              TRACE (TRACE_ERROR, "armor: premature EOF\n");
+              afx->err = gpg_error (afx->state == ARMOR_BEGIN
+                                    ? GPG_ERR_NO_DATA : GPG_ERR_INV_ARMOR);
+              break;
+            }
+          afx->inpos = 0;
+          afx->inlen = n;
+        }
+
+      if (afx->state == ARMOR_BODY && !afx->nquad)
+        {
+          i = afx->inpos;
+          end = afx->inlen;
+#if USE_ARMOR_SIMD
+          while (end - i >= 16 && size - o >= 16 && decode16 (in + i, buf + o))
+            {
+              i += 16;
+              o += 12;
+            }
+#endif
+          while (end - i >= 4 && size - o >= 3)
+            {
+              v = (asctobin[0][in[i]] | asctobin[1][in[i+1]]
+                   | asctobin[2][in[i+2]] | asctobin[3][in[i+3]]);
+              if (v >> 24)
+                break;
+              buf[o++] = v >> 16;
+              buf[o++] = v >> 8;
+              buf[o++] = v;
+              i += 4;
+            }
+          if (i != afx->inpos)
+            {
+              afx->at_bol = 0;
+              afx->inpos = i;
+              continue;
+            }
+        }
+
+      c = in[afx->inpos++];
+      if (afx->state >= ARMOR_BODY)
+        body_char (afx, c, buf, &o, size, crcpos);
+      else if (c == '\n')
+        header_line (afx);
+      else if (afx->linelen < sizeof afx->line)
+        afx->line[afx->linelen++] = c;
+
+      if (afx->state == ARMOR_DONE)
+        crcpos = o;     /* Already in afx->crc */
+    }
+
+  afx->crc = crc24_update (afx->crc, buf + crcpos, o - crcpos);
+  return o;
+}
+
+int
+armor_filter( void *opaque, int control,
+              iobuf_t a, byte *buf, size_t *ret_len)
+{
+  armor_filter_context_t *afx = opaque;
+  int rc = 0;
+
+  if (control == IOBUFCTRL_UNDERFLOW
+      && !afx->npend && (afx->err || afx->state == ARMOR_DONE))
+    {
+      *ret_len = 0;
+      rc = -1;
+    }
+  else if (control == IOBUFCTRL_UNDERFLOW)
+    {
+      /* An error is only reported by the caller, through afx->err; as
+         a return value it would stick to the iobuf.  */
+      *ret_len = armor_read (afx, a, buf, *ret_len);
+      if (!*ret_len)
+        rc = -1;
+    }
+  else if (control == IOBUFCTRL_FREE)
+    {
+      release_armor_context (afx);
+    }
+  else if (control == IOBUFCTRL_DESC)
+    {
+      // mem2str (buf, "armor_filter", *ret_len);
+    }
+  return rc;
+}
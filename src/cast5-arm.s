@@ -0,0 +1,171 @@
+/* cast5-arm.s - ARM assembly CAST5-CFB bulk decryption for Cortex-A7
+ *
+ * Modelled on libgcrypt's cipher/cast5-arm.S: two blocks are run through
+ * the sixteen rounds side by side so the S-box loads of one block fill the
+ * load-use shadow of the other.  NEON does the byte order conversion and
+ * the CFB XOR with the ciphertext; it cannot help with the rounds
+ * themselves since it has no 32-bit table gather.
+ *
+ * Built only with USE_ARM_ASM=1 (see Makefile).  The key schedule layout
+ * must match KeySchedule in libgcrypt.h: uint32_t Km[16] followed by
+ * uint8_t Kr[16].  The function sits in .text.cast5_arm_cfb_dec, as
+ * -ffunction-sections would name it, so that src/section-order.ld can
+ * place it.
+ */
+
+    .syntax unified
+    .arm
+    .fpu neon-vfpv4
+
+/* Round registers.  RT0/RT1 reuse RKM/RKR once I has been computed. */
+RKM .req r0
+RKR .req r1
+RT0 .req r0
+RT1 .req r1
+RL0 .req r2
+RR0 .req r3
+RL1 .req r4
+RR1 .req r5
+RS1 .req r6
+RS2 .req r7
+RS3 .req r8
+RS4 .req r9
+RI0 .req r10
+RI1 .req r11
+RF0 .req ip
+RF1 .req lr
+
+/* Stack frame after the prologue. */
+.equ STK_KS,      0
+.equ STK_DST,     4
+.equ STK_SRC,     8
+.equ STK_IV,      12
+.equ STK_NBLOCKS, 56
+
+.equ KS_KR, 64          /* offsetof(KeySchedule, Kr) */
+
+/* One round on both blocks.  OPI combines Km with the right half, OPA..OPC
+ * fold in S2..S4; together they select f1, f2 or f3 (RFC 2144, 2.2). */
+.macro round2 n, opi, opa, opb, opc, l0, r0, l1, r1
+    ldr     RKM, [sp, #STK_KS]
+    ldrb    RKR, [RKM, #(KS_KR + \n)]
+    ldr     RKM, [RKM, #(4 * \n)]
+    rsb     RKR, RKR, #32               /* rol(x, n) == ror(x, 32 - n) */
+    \opi    RI0, RKM, \r0
+    \opi    RI1, RKM, \r1
+    ror     RI0, RI0, RKR
+    ror     RI1, RI1, RKR
+
+    lsr     RT0, RI0, #24
+    lsr     RT1, RI1, #24
+    ldr     RF0, [RS1, RT0, lsl #2]
+    ldr     RF1, [RS1, RT1, lsl #2]
+    ubfx    RT0, RI0, #16, #8
+    ubfx    RT1, RI1, #16, #8
+    ldr     RT0, [RS2, RT0, lsl #2]
+    ldr     RT1, [RS2, RT1, lsl #2]
+    \opa    RF0, RF0, RT0
+    \opa    RF1, RF1, RT1
+    ubfx    RT0, RI0, #8, #8
+    ubfx    RT1, RI1, #8, #8
+    ldr     RT0, [RS3, RT0, lsl #2]
+    ldr     RT1, [RS3, RT1, lsl #2]
+    \opb    RF0, RF0, RT0
+    \opb    RF1, RF1, RT1
+    uxtb    RT0, RI0
+    uxtb    RT1, RI1
+    ldr     RT0, [RS4, RT0, lsl #2]
+    ldr     RT1, [RS4, RT1, lsl #2]
+    \opc    RF0, RF0, RT0
+    \opc    RF1, RF1, RT1
+
+    eor     \l0, \l0, RF0
+    eor     \l1, \l1, RF1
+.endm
+
+/* L/R swap roles every round instead of being moved. */
+.macro f1_round2 n, l0, r0, l1, r1
+    round2  \n, add, eor, sub, add, \l0, \r0, \l1, \r1
+.endm
+.macro f2_round2 n, l0, r0, l1, r1
+    round2  \n, eor, sub, add, eor, \l0, \r0, \l1, \r1
+.endm
+.macro f3_round2 n, l0, r0, l1, r1
+    round2  \n, sub, add, eor, sub, \l0, \r0, \l1, \r1
+.endm
+
+/* void cast5_arm_cfb_dec(const KeySchedule *ks, unsigned char *outbuf,
+ *                        const unsigned char *inbuf, unsigned char *iv,
+ *                        size_t nblocks);
+ *
+ * CFB-decrypt NBLOCKS (even, non-zero) 8-byte blocks from INBUF to OUTBUF
+ * and leave the last ciphertext block in IV.  Buffers may be unaligned;
+ * all memory traffic goes through byte-element VLD1/VST1, which never
+ * raises an alignment fault even with the MMU off. */
+    .section .text.cast5_arm_cfb_dec,"ax",%progbits
+    .align 3
+    .global cast5_arm_cfb_dec
+    .type   cast5_arm_cfb_dec, %function
+cast5_arm_cfb_dec:
+    push    {r4-r11, ip, lr}
+    push    {r0-r3}
+
+    ldr     RS1, =S1
+    ldr     RS2, =S2
+    ldr     RS3, =S3
+    ldr     RS4, =S4
+
+    vld1.8  {d0}, [r3]                  /* d0: running IV */
+
+.Lcfb_dec_loop:
+    ldr     r1, [sp, #STK_SRC]
+    vld1.8  {d2-d3}, [r1]!              /* q1: C0, C1 */
+    str     r1, [sp, #STK_SRC]
+
+    /* Keystream input is IV, C0; load both big endian. */
+    vmov    d16, d0
+    vmov    d17, d2
+    vrev32.8 q8, q8
+    vmov    RL0, RR0, d16
+    vmov    RL1, RR1, d17
+
+    f1_round2  0, RL0, RR0, RL1, RR1
+    f2_round2  1, RR0, RL0, RR1, RL1
+    f3_round2  2, RL0, RR0, RL1, RR1
+    f1_round2  3, RR0, RL0, RR1, RL1
+    f2_round2  4, RL0, RR0, RL1, RR1
+    f3_round2  5, RR0, RL0, RR1, RL1
+    f1_round2  6, RL0, RR0, RL1, RR1
+    f2_round2  7, RR0, RL0, RR1, RL1
+    f3_round2  8, RL0, RR0, RL1, RR1
+    f1_round2  9, RR0, RL0, RR1, RL1
+    f2_round2 10, RL0, RR0, RL1, RR1
+    f3_round2 11, RR0, RL0, RR1, RL1
+    f1_round2 12, RL0, RR0, RL1, RR1
+    f2_round2 13, RR0, RL0, RR1, RL1
+    f3_round2 14, RL0, RR0, RL1, RR1
+    f1_round2 15, RR0, RL0, RR1, RL1
+
+    /* Output block is R16 || L16. */
+    vmov    d16, RR0, RL0
+    vmov    d17, RR1, RL1
+    vrev32.8 q8, q8
+    veor    q8, q8, q1
+
+    ldr     r1, [sp, #STK_DST]
+    vst1.8  {d16-d17}, [r1]!
+    str     r1, [sp, #STK_DST]
+    vmov    d0, d3                      /* IV = C1 */
+
+    ldr     r0, [sp, #STK_NBLOCKS]
+    subs    r0, r0, #2
+    str     r0, [sp, #STK_NBLOCKS]
+    bne     .Lcfb_dec_loop
+
+    ldr     r3, [sp, #STK_IV]
+    vst1.8  {d0}, [r3]
+
+    add     sp, sp, #16
+    pop     {r4-r11, ip, pc}
+    .ltorg
+    .size   cast5_arm_cfb_dec, .-cast5_arm_cfb_dec
@@ -0,0 +1,207 @@
+/* cipher-eax.c - EAX decryption (Bellare, Rogaway and Wagner), for
+ * OpenPGP AEAD packets (AEAD_ALGO_EAX).
+ *
+ * EAX is CTR encryption plus three OMACs (CMAC with a one-block tweak
+ * prefix): N' over the nonce, which is also the initial counter, H'
+ * over the additional data and C' over the ciphertext; the tag is
+ * their XOR.  The keystream is generated EAX_BATCH blocks at a time
+ * by the cipher's bulk ECB encryption; the OMAC over the ciphertext is
+ * CBC-like and stays one block at a time.
+ */
+#include "gcrypt.h"
+#include "gpg-error.h"
+#include "libgcrypt.h"
+#include "memory.h"
+#include "trace.h"
+
+#define EAX_BLOCK_LEN 16
+#define EAX_BATCH 8
+
+static void eax_xor(unsigned char *dst, const unsigned char *a,
+                    const unsigned char *b)
+{
+    int i;
+
+    for (i = 0; i < EAX_BLOCK_LEN; i++)
+        dst[i] = a[i] ^ b[i];
+}
+
+/* Multiply by x in GF(2^128), big-endian. */
+static void eax_double(unsigned char *dst, const unsigned char *src)
+{
+    unsigned char carry = src[0] >> 7;
+    int i;
+
+    for (i = 0; i < EAX_BLOCK_LEN - 1; i++)
+        dst[i] = (src[i] << 1) | (src[i + 1] >> 7);
+    dst[EAX_BLOCK_LEN - 1] = (src[EAX_BLOCK_LEN - 1] << 1) ^ (carry * 0x87);
+}
+
+/* Start OMAC^T: the first block is T as a 16-byte big-endian number. */
+static void cmac_init(eax_cmac_t *m, unsigned char t)
+{
+    memset(m, 0, sizeof *m);
+    m->buf[EAX_BLOCK_LEN - 1] = t;
+    m->buflen = EAX_BLOCK_LEN;
+}
+
+static void cmac_write(gcry_cipher_hd_t c, eax_cmac_t *m,
+                       const unsigned char *data, size_t len)
+{
+    size_t n;
+
+    while (len)
+    {
+        /* A full block is only processed once more data follows, as
+           the last one is masked differently. */
+        if (m->buflen == EAX_BLOCK_LEN)
+        {
+            eax_xor(m->iv, m->iv, m->buf);
+            c->spec->encrypt(&c->context, m->iv, m->iv);
+            m->buflen = 0;
+        }
+        n = EAX_BLOCK_LEN - m->buflen;
+        if (n > len)
+            n = len;
+        memcpy(m->buf + m->buflen, data, n);
+        m->buflen += n;
+        data += n;
+        len -= n;
+    }
+}
+
+static void cmac_final(gcry_cipher_hd_t c, eax_cmac_t *m, unsigned char *mac)
+{
+    if (m->buflen == EAX_BLOCK_LEN)
+        eax_xor(m->iv, m->iv, c->u_mode.eax.subkeys[0]);
+    else
+    {
+        m->buf[m->buflen] = 0x80;
+        memset(m->buf + m->buflen + 1, 0, EAX_BLOCK_LEN - m->buflen - 1);
+        eax_xor(m->iv, m->iv, c->u_mode.eax.subkeys[1]);
+    }
+    eax_xor(m->iv, m->iv, m->buf);
+    c->spec->encrypt(&c->context, mac, m->iv);
+}
+
+void _gcry_cipher_eax_setkey(gcry_cipher_hd_t c)
+{
+    unsigned char l[EAX_BLOCK_LEN];
+
+    memset(l, 0, sizeof l);
+    c->spec->encrypt(&c->context, l, l);
+    eax_double(c->u_mode.eax.subkeys[0], l);
+    eax_double(c->u_mode.eax.subkeys[1], c->u_mode.eax.subkeys[0]);
+    wipememory(l, sizeof l);
+}
+
+int _gcry_cipher_eax_set_nonce(gcry_cipher_hd_t c, const unsigned char *nonce,
+                               size_t noncelen)
+{
+    eax_cmac_t m;
+
+    if (!nonce && noncelen)
+        return GPG_ERR_INV_ARG;
+
+    cmac_init(&m, 0);
+    cmac_write(c, &m, nonce, noncelen);
+    cmac_final(c, &m, c->u_mode.eax.nonce_mac);
+    wipememory(&m, sizeof m);
+
+    memcpy(c->u_mode.eax.ctr, c->u_mode.eax.nonce_mac, EAX_BLOCK_LEN);
+    c->u_mode.eax.unused = 0;
+    cmac_init(&c->u_mode.eax.cmac_header, 1);
+    cmac_init(&c->u_mode.eax.cmac_ciphertext, 2);
+    return 0;
+}
+
+int _gcry_cipher_eax_authenticate(gcry_cipher_hd_t c, const unsigned char *abuf,
+                                  size_t abuflen)
+{
+    if (c->marks.tag)
+        return GPG_ERR_INV_STATE;
+    cmac_write(c, &c->u_mode.eax.cmac_header, abuf, abuflen);
+    return 0;
+}
+
+static void ctr_increment(unsigned char *ctr)
+{
+    int i;
+
+    for (i = EAX_BLOCK_LEN - 1; i >= 0; i--)
+        if (++ctr[i])
+            break;
+}
+
+int _gcry_cipher_eax_decrypt(gcry_cipher_hd_t c, unsigned char *outbuf,
+                             size_t outbuflen, const unsigned char *inbuf,
+                             size_t inbuflen)
+{
+    unsigned char ks[EAX_BATCH * EAX_BLOCK_LEN];
+    unsigned char *keystream = c->u_mode.eax.keystream;
+    size_t n, i;
+
+    if (outbuflen < inbuflen)
+        return GPG_ERR_BUFFER_TOO_SHORT;
+    if (c->marks.tag)
+        return GPG_ERR_INV_STATE;
+
+    /* The MAC is over the ciphertext, so before it is overwritten. */
+    cmac_write(c, &c->u_mode.eax.cmac_ciphertext, inbuf, inbuflen);
+
+    /* Leftover keystream from a previous partial block. */
+    for (; inbuflen && c->u_mode.eax.unused; inbuflen--, c->u_mode.eax.unused--)
+        *outbuf++ = *inbuf++ ^ keystream[EAX_BLOCK_LEN - c->u_mode.eax.unused];
+
+    while (inbuflen >= EAX_BLOCK_LEN)
+    {
+        n = inbuflen / EAX_BLOCK_LEN;
+        if (n > EAX_BATCH)
+            n = EAX_BATCH;
+        for (i = 0; i < n; i++)
+        {
+            memcpy(ks + i * EAX_BLOCK_LEN, c->u_mode.eax.ctr, EAX_BLOCK_LEN);
+            ctr_increment(c->u_mode.eax.ctr);
+        }
+        c->spec->ecb_enc(&c->context, ks, ks, n);
+        for (i = 0; i < n * EAX_BLOCK_LEN; i++)
+            outbuf[i] = inbuf[i] ^ ks[i];
+        outbuf += n * EAX_BLOCK_LEN;
+        inbuf += n * EAX_BLOCK_LEN;
+        inbuflen -= n * EAX_BLOCK_LEN;
+    }
+    wipememory(ks, sizeof ks);
+
+    if (inbuflen)
+    {
+        c->spec->encrypt(&c->context, keystream, c->u_mode.eax.ctr);
+        ctr_increment(c->u_mode.eax.ctr);
+        for (i = 0; i < inbuflen; i++)
+            outbuf[i] = inbuf[i] ^ keystream[i];
+        c->u_mode.eax.unused = EAX_BLOCK_LEN - inbuflen;
+    }
+    return 0;
+}
+
+int _gcry_cipher_eax_check_tag(gcry_cipher_hd_t c, const unsigned char *intag,
+                               size_t taglen)
+{
+    unsigned char *tag = c->u_mode.eax.tag;
+    unsigned char mac[EAX_BLOCK_LEN];
+    unsigned char diff = 0;
+    size_t i;
+
+    if (!c->marks.tag)
+    {
+        cmac_final(c, &c->u_mode.eax.cmac_header, tag);
+        cmac_final(c, &c->u_mode.eax.cmac_ciphertext, mac);
+        eax_xor(tag, tag, mac);
+        eax_xor(tag, tag, c->u_mode.eax.nonce_mac);
+        c->marks.tag = 1;
+    }
+    if (!taglen || taglen > EAX_BLOCK_LEN)
+        return GPG_ERR_INV_LENGTH;
+    for (i = 0; i < taglen; i++)
+        diff |= tag[i] ^ intag[i];
+    return diff ? GPG_ERR_CHECKSUM : 0;
+}
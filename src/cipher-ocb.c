@@ -0,0 +1,282 @@
+/* cipher-ocb.c - OCB3 (RFC 7253) decryption with a 128-bit tag, for
+ * OpenPGP AEAD packets (AEAD_ALGO_OCB).
+ *
+ * Every block is decrypted independently once its offset is known, and
+ * the offsets are a cheap XOR chain, so runs of OCB_BATCH blocks are
+ * masked, handed to the cipher's bulk ECB decryption (bit-sliced for
+ * AES) and unmasked.  Only the nonce, the additional data and the tag
+ * go through single-block encryption.
+ */
+#include "gcrypt.h"
+#include "gpg-error.h"
+#include "libgcrypt.h"
+#include "memory.h"
+#include "trace.h"
+
+/* Blocks per call to the bulk decryption; one bit-sliced AES batch. */
+#define OCB_BATCH 8
+
+static void ocb_xor(unsigned char *dst, const unsigned char *a,
+                    const unsigned char *b)
+{
+    int i;
+
+    for (i = 0; i < OCB_BLOCK_LEN; i++)
+        dst[i] = a[i] ^ b[i];
+}
+
+/* Multiply by x in GF(2^128), big-endian. */
+static void ocb_double(unsigned char *dst, const unsigned char *src)
+{
+    unsigned char carry = src[0] >> 7;
+    int i;
+
+    for (i = 0; i < OCB_BLOCK_LEN - 1; i++)
+        dst[i] = (src[i] << 1) | (src[i + 1] >> 7);
+    dst[OCB_BLOCK_LEN - 1] = (src[OCB_BLOCK_LEN - 1] << 1) ^ (carry * 0x87);
+}
+
+/* L_{ntz(N)}, the offset increment for block N (counting from 1).
+   TMP receives it when it lies beyond the table. */
+static const unsigned char *ocb_get_l(gcry_cipher_hd_t c, unsigned char *tmp,
+                                      uint64_t n)
+{
+    unsigned int ntz = __builtin_ctzll(n);
+
+    if (ntz < OCB_L_TABLE_SIZE)
+        return c->u_mode.ocb.L[ntz];
+    ocb_double(tmp, c->u_mode.ocb.L[OCB_L_TABLE_SIZE - 1]);
+    for (ntz -= OCB_L_TABLE_SIZE; ntz; ntz--)
+        ocb_double(tmp, tmp);
+    return tmp;
+}
+
+void _gcry_cipher_ocb_setkey(gcry_cipher_hd_t c)
+{
+    unsigned char zero[OCB_BLOCK_LEN];
+    int i;
+
+    memset(zero, 0, sizeof zero);
+    c->spec->encrypt(&c->context, c->u_mode.ocb.L_star, zero);
+    ocb_double(c->u_mode.ocb.L_dollar, c->u_mode.ocb.L_star);
+    ocb_double(c->u_mode.ocb.L[0], c->u_mode.ocb.L_dollar);
+    for (i = 1; i < OCB_L_TABLE_SIZE; i++)
+        ocb_double(c->u_mode.ocb.L[i], c->u_mode.ocb.L[i - 1]);
+}
+
+int _gcry_cipher_ocb_set_nonce(gcry_cipher_hd_t c, const unsigned char *nonce,
+                               size_t noncelen)
+{
+    unsigned char ktop[OCB_BLOCK_LEN], stretch[OCB_BLOCK_LEN + 8];
+    unsigned int bottom, shift;
+    int i;
+
+    /* 8 to 15 bytes, as libgcrypt; the 128-bit tag makes the top seven
+       bits zero. */
+    if (!nonce || noncelen < 8 || noncelen > 15)
+        return GPG_ERR_INV_LENGTH;
+
+    memset(ktop, 0, sizeof ktop);
+    memcpy(ktop + OCB_BLOCK_LEN - noncelen, nonce, noncelen);
+    ktop[OCB_BLOCK_LEN - 1 - noncelen] |= 1;
+    bottom = ktop[OCB_BLOCK_LEN - 1] & 0x3f;
+    ktop[OCB_BLOCK_LEN - 1] &= 0xc0;
+    c->spec->encrypt(&c->context, ktop, ktop);
+
+    /* Stretch = Ktop || (Ktop[1..64] xor Ktop[9..72]);
+       Offset_0 = Stretch[1+bottom..128+bottom]. */
+    memcpy(stretch, ktop, OCB_BLOCK_LEN);
+    for (i = 0; i < 8; i++)
+        stretch[OCB_BLOCK_LEN + i] = ktop[i] ^ ktop[i + 1];
+    shift = bottom % 8;
+    for (i = 0; i < OCB_BLOCK_LEN; i++)
+    {
+        const unsigned char *p = stretch + bottom / 8 + i;
+
+        c->u_mode.ocb.offset[i] = shift ? (p[0] << shift) | (p[1] >> (8 - shift))
+                                        : p[0];
+    }
+    wipememory(ktop, sizeof ktop);
+    wipememory(stretch, sizeof stretch);
+
+    memset(c->u_mode.ocb.checksum, 0, OCB_BLOCK_LEN);
+    memset(c->u_mode.ocb.aad_offset, 0, OCB_BLOCK_LEN);
+    memset(c->u_mode.ocb.aad_sum, 0, OCB_BLOCK_LEN);
+    c->u_mode.ocb.data_nblocks = 0;
+    c->u_mode.ocb.aad_nblocks = 0;
+    c->u_mode.ocb.aad_nleftover = 0;
+    c->u_mode.ocb.data_finalized = 0;
+    c->u_mode.ocb.aad_finalized = 0;
+    return 0;
+}
+
+/* Sum ^= E(A_i ^ Offset_i) for one full block of additional data. */
+static void ocb_aad_block(gcry_cipher_hd_t c, const unsigned char *abuf)
+{
+    unsigned char tmp[OCB_BLOCK_LEN], l_tmp[OCB_BLOCK_LEN];
+
+    c->u_mode.ocb.aad_nblocks++;
+    ocb_xor(c->u_mode.ocb.aad_offset, c->u_mode.ocb.aad_offset,
+            ocb_get_l(c, l_tmp, c->u_mode.ocb.aad_nblocks));
+    ocb_xor(tmp, c->u_mode.ocb.aad_offset, abuf);
+    c->spec->encrypt(&c->context, tmp, tmp);
+    ocb_xor(c->u_mode.ocb.aad_sum, c->u_mode.ocb.aad_sum, tmp);
+}
+
+int _gcry_cipher_ocb_authenticate(gcry_cipher_hd_t c, const unsigned char *abuf,
+                                  size_t abuflen)
+{
+    size_t n;
+
+    if (c->marks.tag || c->u_mode.ocb.aad_finalized)
+        return GPG_ERR_INV_STATE;
+
+    if (c->u_mode.ocb.aad_nleftover)
+    {
+        n = OCB_BLOCK_LEN - c->u_mode.ocb.aad_nleftover;
+        if (n > abuflen)
+            n = abuflen;
+        memcpy(c->u_mode.ocb.aad_leftover + c->u_mode.ocb.aad_nleftover, abuf, n);
+        c->u_mode.ocb.aad_nleftover += n;
+        abuf += n;
+        abuflen -= n;
+        /* Only a full block followed by more data is known not to be
+           the last one. */
+        if (c->u_mode.ocb.aad_nleftover < OCB_BLOCK_LEN || !abuflen)
+            return 0;
+        ocb_aad_block(c, c->u_mode.ocb.aad_leftover);
+        c->u_mode.ocb.aad_nleftover = 0;
+    }
+    for (; abuflen > OCB_BLOCK_LEN; abuf += OCB_BLOCK_LEN, abuflen -= OCB_BLOCK_LEN)
+        ocb_aad_block(c, abuf);
+    memcpy(c->u_mode.ocb.aad_leftover, abuf, abuflen);
+    c->u_mode.ocb.aad_nleftover = abuflen;
+    return 0;
+}
+
+/* The last, possibly partial, block of additional data. */
+static void ocb_aad_finalize(gcry_cipher_hd_t c)
+{
+    unsigned char tmp[OCB_BLOCK_LEN];
+    size_t n = c->u_mode.ocb.aad_nleftover;
+
+    if (c->u_mode.ocb.aad_finalized)
+        return;
+    c->u_mode.ocb.aad_finalized = 1;
+    if (n == OCB_BLOCK_LEN)
+        ocb_aad_block(c, c->u_mode.ocb.aad_leftover);
+    else if (n)
+    {
+        ocb_xor(c->u_mode.ocb.aad_offset, c->u_mode.ocb.aad_offset,
+                c->u_mode.ocb.L_star);
+        memset(tmp, 0, sizeof tmp);
+        memcpy(tmp, c->u_mode.ocb.aad_leftover, n);
+        tmp[n] = 0x80;
+        ocb_xor(tmp, tmp, c->u_mode.ocb.aad_offset);
+        c->spec->encrypt(&c->context, tmp, tmp);
+        ocb_xor(c->u_mode.ocb.aad_sum, c->u_mode.ocb.aad_sum, tmp);
+    }
+    c->u_mode.ocb.aad_nleftover = 0;
+}
+
+/* P_i = Offset_i ^ D(C_i ^ Offset_i) for NBLOCKS full blocks. */
+static void ocb_decrypt_blocks(gcry_cipher_hd_t c, unsigned char *outbuf,
+                               const unsigned char *inbuf, size_t nblocks)
+{
+    unsigned char buf[OCB_BATCH * OCB_BLOCK_LEN];
+    unsigned char offs[OCB_BATCH * OCB_BLOCK_LEN];
+    unsigned char l_tmp[OCB_BLOCK_LEN];
+    unsigned char *offset = c->u_mode.ocb.offset;
+    unsigned char *checksum = c->u_mode.ocb.checksum;
+    size_t n, i;
+
+    while (nblocks)
+    {
+        n = nblocks < OCB_BATCH ? nblocks : OCB_BATCH;
+        for (i = 0; i < n; i++)
+        {
+            c->u_mode.ocb.data_nblocks++;
+            ocb_xor(offset, offset, ocb_get_l(c, l_tmp, c->u_mode.ocb.data_nblocks));
+            memcpy(offs + i * OCB_BLOCK_LEN, offset, OCB_BLOCK_LEN);
+            ocb_xor(buf + i * OCB_BLOCK_LEN, inbuf + i * OCB_BLOCK_LEN, offset);
+        }
+        c->spec->ecb_dec(&c->context, buf, buf, n);
+        for (i = 0; i < n; i++)
+        {
+            ocb_xor(outbuf + i * OCB_BLOCK_LEN, buf + i * OCB_BLOCK_LEN,
+                    offs + i * OCB_BLOCK_LEN);
+            ocb_xor(checksum, checksum, outbuf + i * OCB_BLOCK_LEN);
+        }
+        outbuf += n * OCB_BLOCK_LEN;
+        inbuf += n * OCB_BLOCK_LEN;
+        nblocks -= n;
+    }
+    wipememory(buf, sizeof buf);
+}
+
+int _gcry_cipher_ocb_decrypt(gcry_cipher_hd_t c, unsigned char *outbuf,
+                             size_t outbuflen, const unsigned char *inbuf,
+                             size_t inbuflen)
+{
+    unsigned char pad[OCB_BLOCK_LEN];
+    size_t nblocks = inbuflen / OCB_BLOCK_LEN;
+    size_t n, i;
+
+    if (outbuflen < inbuflen)
+        return GPG_ERR_BUFFER_TOO_SHORT;
+    if (c->marks.tag || c->u_mode.ocb.data_finalized)
+        return GPG_ERR_INV_STATE;
+    /* Only the last call may end in a partial block. */
+    if (!c->marks.finalize && (inbuflen % OCB_BLOCK_LEN))
+        return GPG_ERR_INV_LENGTH;
+
+    ocb_aad_finalize(c);
+    TRACE(TRACE_BLOCK, "ocb_decrypt %zu blocks%s\n", nblocks,
+          c->marks.finalize ? " (final)" : "");
+    ocb_decrypt_blocks(c, outbuf, inbuf, nblocks);
+
+    n = inbuflen % OCB_BLOCK_LEN;
+    if (n)
+    {
+        /* Offset_* = Offset_m ^ L_*; P_* = C_* ^ E(Offset_*) */
+        outbuf += nblocks * OCB_BLOCK_LEN;
+        inbuf += nblocks * OCB_BLOCK_LEN;
+        ocb_xor(c->u_mode.ocb.offset, c->u_mode.ocb.offset, c->u_mode.ocb.L_star);
+        c->spec->encrypt(&c->context, pad, c->u_mode.ocb.offset);
+        for (i = 0; i < n; i++)
+        {
+            outbuf[i] = inbuf[i] ^ pad[i];
+            c->u_mode.ocb.checksum[i] ^= outbuf[i];
+        }
+        c->u_mode.ocb.checksum[n] ^= 0x80;
+        wipememory(pad, sizeof pad);
+    }
+    if (c->marks.finalize)
+        c->u_mode.ocb.data_finalized = 1;
+    return 0;
+}
+
+int _gcry_cipher_ocb_check_tag(gcry_cipher_hd_t c, const unsigned char *intag,
+                               size_t taglen)
+{
+    unsigned char *tag = c->u_mode.ocb.tag;
+    unsigned char diff = 0;
+    size_t i;
+
+    if (!c->marks.tag)
+    {
+        /* Tag = E(Checksum ^ Offset ^ L_$) ^ HASH(K, A) */
+        ocb_aad_finalize(c);
+        ocb_xor(tag, c->u_mode.ocb.checksum, c->u_mode.ocb.offset);
+        ocb_xor(tag, tag, c->u_mode.ocb.L_dollar);
+        c->spec->encrypt(&c->context, tag, tag);
+        ocb_xor(tag, tag, c->u_mode.ocb.aad_sum);
+        c->u_mode.ocb.data_finalized = 1;
+        c->marks.tag = 1;
+    }
+    if (taglen != OCB_BLOCK_LEN)
+        return GPG_ERR_INV_LENGTH;
+    for (i = 0; i < taglen; i++)
+        diff |= tag[i] ^ intag[i];
+    return diff ? GPG_ERR_CHECKSUM : 0;
+}
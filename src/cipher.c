@@ -4,6 +4,7 @@
 #include "libgcrypt.h"
 #include "packet.h"
 #include "printf.h"
+#include "trace.h"
 
 
 static void
@@ -17,10 +18,12 @@ write_cfb_header (cipher_filter_context_t *cfx, iobuf_t a)
   unsigned int blocksize;
   unsigned int nprefix;
 
-  blocksize = 8;// CAST5
-  //openpgp_cipher_get_algo_blklen (cfx->dek->algo);
+  blocksize = gcry_cipher_get_algo_blklen (cfx->dek->algo);
   if ( blocksize < 8 || blocksize > 16 )
-    log_fatal ("unsupported blocksize %u\n", blocksize);
+    {
+      printf ("unsupported blocksize %u\n", blocksize);
+      return;
+    }
 
   memset (&ed, 0, sizeof ed);
   ed.len = cfx->datalen;
@@ -53,7 +56,8 @@ write_cfb_header (cipher_filter_context_t *cfx, iobuf_t a)
   nprefix = blocksize;
   // gcry_randomize (temp, nprefix, GCRY_STRONG_RANDOM );
   printf("Fixing random %d bytes\n", nprefix);
-  const unsigned char fixed_random[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF}; // Example fixed bytes
+  const unsigned char fixed_random[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+                                        0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF}; // Example fixed bytes
 memcpy(temp, fixed_random, nprefix);
   temp[nprefix] = temp[nprefix-2];
   temp[nprefix+1] = temp[nprefix-1];
@@ -73,11 +77,10 @@ memcpy(temp, fixed_random, nprefix);
   //   }
     //log_printhex (cfx->dek->key, cfx->dek->keylen, "KEY:");
   _gcry_cipher_setkey (cfx->cipher_hd, cfx->dek->key, cfx->dek->keylen);
-  log_hexdump(&cfx->cipher_hd->key, 16);
 
-  _gcry_cipher_setiv (cfx->cipher_hd, NULL, 8);
+  _gcry_cipher_setiv (cfx->cipher_hd, NULL, blocksize);
 
-  log_hexdump(&cfx->cipher_hd->u_iv, 8);
+  log_hexdump(cfx->cipher_hd->u_iv.iv, blocksize);
   // if (cfx->mdc_hash) /* Hash the "IV". */{
   //   printf("Hashing IV\n");
   //   gcry_md_write (cfx->mdc_hash, temp, nprefix+2 );
@@ -107,7 +110,7 @@ int
 _gcry_cipher_encrypt (gcry_cipher_hd_t h, void *out, size_t outsize,
                       const void *in, size_t inlen)
 {
-  printf("_gcry_cipher_encrypt inlen: %d, outSize: %d, unused: %d\n", inlen, outsize, h->unused);
+  TRACE(TRACE_DEBUG, "_gcry_cipher_encrypt inlen: %d, outSize: %d, unused: %d\n", inlen, outsize, h->unused);
   int rc;
 
   if (!in)  /* Caller requested in-place encryption.  */
@@ -121,95 +121,95 @@
 // #define ARGPARSE_TYPE_MASK  7  /* Mask for the type values (internal).  */
 
 // /* A set of macros to make option definitions easier to read.  */
-// #define ARGPARSE_x(s,l,t,f,d) \
+// #define ARGPARSE_x(s,l,t,f,d)
 //      { (s), (l), ARGPARSE_TYPE_ ## t | (f), (d) }
 
-// #define ARGPARSE_s(s,l,t,d) \
+// #define ARGPARSE_s(s,l,t,d)
 //      { (s), (l), ARGPARSE_TYPE_ ## t, (d) }
-// #define ARGPARSE_s_n(s,l,d) \
+// #define ARGPARSE_s_n(s,l,d)
 //      { (s), (l), ARGPARSE_TYPE_NONE, (d) }
-// #define ARGPARSE_s_i(s,l,d) \
+// #define ARGPARSE_s_i(s,l,d)
 //      { (s), (l), ARGPARSE_TYPE_INT, (d) }
-// #define ARGPARSE_s_s(s,l,d) \
+// #define ARGPARSE_s_s(s,l,d)
 //      { (s), (l), ARGPARSE_TYPE_STRING, (d) }
-// #define ARGPARSE_s_l(s,l,d) \
+// #define ARGPARSE_s_l(s,l,d)
 //      { (s), (l), ARGPARSE_TYPE_LONG, (d) }
-// #define ARGPARSE_s_u(s,l,d) \
+// #define ARGPARSE_s_u(s,l,d)
 //      { (s), (l), ARGPARSE_TYPE_ULONG, (d) }
 
-// #define ARGPARSE_o(s,l,t,d) \
+// #define ARGPARSE_o(s,l,t,d)
 //      { (s), (l), (ARGPARSE_TYPE_ ## t  | ARGPARSE_OPT_OPTIONAL), (d) }
-// #define ARGPARSE_o_n(s,l,d) \
+// #define ARGPARSE_o_n(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_NONE   | ARGPARSE_OPT_OPTIONAL), (d) }
-// #define ARGPARSE_o_i(s,l,d) \
+// #define ARGPARSE_o_i(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_INT    | ARGPARSE_OPT_OPTIONAL), (d) }
-// #define ARGPARSE_o_s(s,l,d) \
+// #define ARGPARSE_o_s(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_STRING | ARGPARSE_OPT_OPTIONAL), (d) }
-// #define ARGPARSE_o_l(s,l,d) \
+// #define ARGPARSE_o_l(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_LONG   | ARGPARSE_OPT_OPTIONAL), (d) }
-// #define ARGPARSE_o_u(s,l,d) \
+// #define ARGPARSE_o_u(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_ULONG  | ARGPARSE_OPT_OPTIONAL), (d) }
 
-// #define ARGPARSE_p(s,l,t,d) \
+// #define ARGPARSE_p(s,l,t,d)
 //      { (s), (l), (ARGPARSE_TYPE_ ## t  | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_p_n(s,l,d) \
+// #define ARGPARSE_p_n(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_NONE   | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_p_i(s,l,d) \
+// #define ARGPARSE_p_i(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_INT    | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_p_s(s,l,d) \
+// #define ARGPARSE_p_s(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_STRING | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_p_l(s,l,d) \
+// #define ARGPARSE_p_l(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_LONG   | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_p_u(s,l,d) \
+// #define ARGPARSE_p_u(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_ULONG  | ARGPARSE_OPT_PREFIX), (d) }
 
-// #define ARGPARSE_op(s,l,t,d) \
-//      { (s), (l), (ARGPARSE_TYPE_ ## t \
+// #define ARGPARSE_op(s,l,t,d)
+//      { (s), (l), (ARGPARSE_TYPE_ ## t
 //                   | ARGPARSE_OPT_OPTIONAL | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_op_n(s,l,d) \
-//      { (s), (l), (ARGPARSE_TYPE_NONE \
+// #define ARGPARSE_op_n(s,l,d)
+//      { (s), (l), (ARGPARSE_TYPE_NONE
 //                   | ARGPARSE_OPT_OPTIONAL | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_op_i(s,l,d) \
-//      { (s), (l), (ARGPARSE_TYPE_INT \
+// #define ARGPARSE_op_i(s,l,d)
+//      { (s), (l), (ARGPARSE_TYPE_INT
 //                   | ARGPARSE_OPT_OPTIONAL | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_op_s(s,l,d) \
-//      { (s), (l), (ARGPARSE_TYPE_STRING \
+// #define ARGPARSE_op_s(s,l,d)
+//      { (s), (l), (ARGPARSE_TYPE_STRING
 //                   | ARGPARSE_OPT_OPTIONAL | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_op_l(s,l,d) \
-//      { (s), (l), (ARGPARSE_TYPE_LONG \
+// #define ARGPARSE_op_l(s,l,d)
+//      { (s), (l), (ARGPARSE_TYPE_LONG
 //                   | ARGPARSE_OPT_OPTIONAL | ARGPARSE_OPT_PREFIX), (d) }
-// #define ARGPARSE_op_u(s,l,d) \
-//      { (s), (l), (ARGPARSE_TYPE_ULONG \
+// #define ARGPARSE_op_u(s,l,d)
+//      { (s), (l), (ARGPARSE_TYPE_ULONG
 //                   | ARGPARSE_OPT_OPTIONAL | ARGPARSE_OPT_PREFIX), (d) }
 
-// #define ARGPARSE_c(s,l,d) \
+// #define ARGPARSE_c(s,l,d)
 //      { (s), (l), (ARGPARSE_TYPE_NONE | ARGPARSE_OPT_COMMAND), (d) }
 
-// #define ARGPARSE_conffile(s,l,d) \
+// #define ARGPARSE_conffile(s,l,d)
 //   { (s), (l), (ARGPARSE_TYPE_STRING|ARGPARSE_OPT_CONFFILE), (d) }
 
-// #define ARGPARSE_noconffile(s,l,d) \
+// #define ARGPARSE_noconffile(s,l,d)
 //   { (s), (l), (ARGPARSE_TYPE_NONE|ARGPARSE_OPT_CONFFILE), (d) }
 
-// #define ARGPARSE_ignore(s,l) \
+// #define ARGPARSE_ignore(s,l)
 //      { (s), (l), (ARGPARSE_OPT_IGNORE), "@" }
 
-// #define ARGPARSE_group(s,d) \
+// #define ARGPARSE_group(s,d)
 //      { (s), NULL, 0, (d) }
 
 // /* Verbatim print the string D in the help output.  It does not make
 //  * use of the "@" hack as ARGPARSE_group does.  */
-// #define ARGPARSE_verbatim(d) \
+// #define ARGPARSE_verbatim(d)
 //   { 1, NULL, (ARGPARSE_OPT_VERBATIM), (d) }
 
 // /* Same as ARGPARSE_verbatim but also print a colon and a LF.  N can
 //  * be used give a symbolic name to the header.  Nothing is printed if
 //  * D is the empty string.  */
-// #define ARGPARSE_header(n,d) \
+// #define ARGPARSE_header(n,d)
 //   { 1, (n), (ARGPARSE_OPT_HEADER), (d) }
 
 // /* Mark the end of the list (mandatory).  */
-// #define ARGPARSE_end() \
+// #define ARGPARSE_end()
 //   { 0, NULL, 0, NULL }
 
 
@@ -58,6 +58,8 @@
 #include "iobuf.h"
 #include "../memory.h"
 #include "../printf.h"
+#include "../trace.h"
+#include "../prof.h"
 /*-- Begin configurable part.  --*/
 
 /* The size of the internal buffers.
@@ -65,6 +67,12 @@
    test "armored_key_8192" in armor.test! */
 #define IOBUF_BUFFER_SIZE  8192
 
+/* Files are read and written in whole blocks of FILE_BLOCK_SIZE from a
+   block boundary on, through buffers of IOBUF_FILE_BUFFER_SIZE: every
+   read or write is a semihosting trap on the target (semihost.c).  */
+#define FILE_BLOCK_SIZE  4096
+#define IOBUF_FILE_BUFFER_SIZE  (16 * FILE_BLOCK_SIZE)
+
 /* To avoid a potential DoS with compression packets we better limit
    the number of filters in a chain.  */
 #define MAX_NESTING_FILTER 64
@@ -163,6 +171,8 @@ int translate_file_handle (int fd, int for_write);
    May only be called on an IOBUF_OUTPUT or IOBUF_OUTPUT_TEMP filters.  */
 static int filter_flush (iobuf_t a);
 
+static void release_buffer (iobuf_t a);
+
 
 
 /* This is a replacement for strcmp.  Under W32 it does not
@@ -193,7 +203,6 @@ fd_cache_invalidate (const char *fname)
   close_cache_t cc;
   int rc = 0;
 
-  printf (fname);
   if (DBG_IOBUF)
     printf ("fd_cache_invalidate (%s)\n", fname);
 
@@ -207,7 +216,7 @@ fd_cache_invalidate (const char *fname)
 	  if (!CloseHandle (cc->fp))
             rc = -1;
 #else
-// 	  rc = close (cc->fp);
+	  rc = close (cc->fp);
 #endif
 	  cc->fp = GNUPG_INVALID_FD;
 	}
@@ -348,47 +357,46 @@ direct_open (const char *fname, const char *mode, int mode700)
 }
 
 
-// /*
-//  * Instead of closing an FD we keep it open and cache it for later reuse
-//  * Note that this caching strategy only works if the process does not chdir.
-//  */
-// static void
-// fd_cache_close (const char *fname, gnupg_fd_t fp)
-// {
-//   close_cache_t cc;
+/*
+ * Instead of closing an FD we keep it open and cache it for later reuse
+ * Note that this caching strategy only works if the process does not chdir.
+ */
+static void
+fd_cache_close (const char *fname, gnupg_fd_t fp)
+{
+  close_cache_t cc;
 
-//   printf (fp);
-//   if (!fname || !*fname)
-//     {
-// #ifdef HAVE_W32_SYSTEM
-//       CloseHandle (fp);
-// #else
-//       close (fp);
-// #endif
-//       if (DBG_IOBUF)
-// 	printf ("fd_cache_close (%d) real\n", (int)fp);
-//       return;
-//     }
-//   /* try to reuse a slot */
-//   for (cc = close_cache; cc; cc = cc->next)
-//     {
-//       if (cc->fp == GNUPG_INVALID_FD && !fd_cache_strcmp (cc->fname, fname))
-// 	{
-// 	  cc->fp = fp;
-// 	  if (DBG_IOBUF)
-// 	    printf ("fd_cache_close (%s) used existing slot\n", fname);
-// 	  return;
-// 	}
-//     }
-//   /* add a new one */
-//   if (DBG_IOBUF)
-//     printf ("fd_cache_close (%s) new slot created\n", fname);
-//   cc = xcalloc (1, sizeof *cc + strlen (fname));
-//   strcpy (cc->fname, fname);
-//   cc->fp = fp;
-//   cc->next = close_cache;
-//   close_cache = cc;
-// }
+  if (!fname || !*fname)
+    {
+#ifdef HAVE_W32_SYSTEM
+      CloseHandle (fp);
+#else
+      close (fp);
+#endif
+      if (DBG_IOBUF)
+	printf ("fd_cache_close (%d) real\n", (int)fp);
+      return;
+    }
+  /* try to reuse a slot */
+  for (cc = close_cache; cc; cc = cc->next)
+    {
+      if (cc->fp == GNUPG_INVALID_FD && !fd_cache_strcmp (cc->fname, fname))
+	{
+	  cc->fp = fp;
+	  if (DBG_IOBUF)
+	    printf ("fd_cache_close (%s) used existing slot\n", fname);
+	  return;
+	}
+    }
+  /* add a new one */
+  if (DBG_IOBUF)
+    printf ("fd_cache_close (%s) new slot created\n", fname);
+  cc = xcalloc (1, sizeof *cc + strlen (fname));
+  strcpy (cc->fname, fname);
+  cc->fp = fp;
+  cc->next = close_cache;
+  close_cache = cc;
+}
 
 /*
  * Do a direct_open on FNAME but first try to reuse one from the fd_cache
@@ -415,18 +423,17 @@ fd_cache_open (const char *fname, const char *mode)
 	      fp = GNUPG_INVALID_FD;
 	    }
 #else
-	  // if (lseek (fp, 0, SEEK_SET) == (off_t) - 1)
-	  //   {
-	  //     printf ("can't rewind fd %d: %s\n", fp, strerror (errno));
-	  //     fp = GNUPG_INVALID_FD;
-	  //   }
-      printf("COMMMENTED OUT\n");
+	  if (lseek (fp, 0, SEEK_SET) == (off_t) - 1)
+	    {
+	      printf ("can't rewind fd %d\n", fp);
+	      fp = GNUPG_INVALID_FD;
+	    }
 #endif
 	  return fp;
 	}
     }
-  // if (DBG_IOBUF)
-  printf ("fd_cache_open (%s) not cached\n", fname);
+  if (DBG_IOBUF)
+    printf ("fd_cache_open (%s) not cached\n", fname);
   return direct_open (fname, mode, 0);
 }
 
@@ -654,7 +661,6 @@ block_filter (void *opaque, int control, iobuf_t chain, byte * buffer,
       size_t n = 0;
 
       p = buf;
-      printf (size);	/* need a buffer */
       if (a->eof)		/* don't read any further */
 	rc = -1;
       while (!rc && size)
@@ -801,12 +807,10 @@ block_filter (void *opaque, int control, iobuf_t chain, byte * buffer,
 		  blen /= 2;
 		  c--;
 		  /* write the partial length header */
-		  printf (c <= 0x1f);	/*;-) */
 		  c |= 0xe0;
 		  iobuf_put (chain, c);
 		  if ((n = a->buflen))
 		    {		/* write stuff from the buffer */
-		      printf (n == OP_MIN_PARTIAL_CHUNK);
 		      if (iobuf_write (chain, a->buffer, n))
 			rc = gpg_error_from_syserror ();
 		      a->buflen = 0;
@@ -970,11 +974,53 @@ iobuf_print_chain (iobuf_t a)
   return 0;
 }
 
+/* Source of iobuf_struct.no.  */
+static int number;
+
+/* Buffers of IOBUF_BUFFER_SIZE that iobufs and handle_plaintext gave
+   back, wiped, for the next message to take instead of allocating and
+   clearing new ones.  Off (a limit of 0) unless a decrypt session
+   (session.h) turns it on with iobuf_buffer_cache.  */
+#define IOBUF_BUFFER_CACHE_MAX 8
+static byte *buffer_cache[IOBUF_BUFFER_CACHE_MAX];
+static unsigned buffer_cache_len;
+static unsigned buffer_cache_limit;
+
+void
+iobuf_buffer_cache (unsigned n)
+{
+  if (n > IOBUF_BUFFER_CACHE_MAX)
+    n = IOBUF_BUFFER_CACHE_MAX;
+  buffer_cache_limit = n;
+  while (buffer_cache_len > n)
+    xfree (buffer_cache[--buffer_cache_len]);
+}
+
+void *
+iobuf_buffer_get (size_t size)
+{
+  if (size == IOBUF_BUFFER_SIZE && buffer_cache_len)
+    return buffer_cache[--buffer_cache_len];
+  return xmalloc (size);
+}
+
+void
+iobuf_buffer_put (void *buf, size_t size)
+{
+  if (!buf)
+    return;
+  /* It may have held plaintext, for the cache as much as for xfree.  */
+  wipememory (buf, size);
+  if (size == IOBUF_BUFFER_SIZE && buffer_cache_len < buffer_cache_limit)
+    buffer_cache[buffer_cache_len++] = buf;
+  else
+    xfree (buf);
+}
+
 iobuf_t
 iobuf_alloc (int use, size_t bufsize)
 {
   iobuf_t a;
-  static int number = 0;
 
   printf ("iobuf_alloc use:%d %d\n",use, use == IOBUF_INPUT || use == IOBUF_INPUT_TEMP || use == IOBUF_OUTPUT || use == IOBUF_OUTPUT_TEMP);
   if (bufsize == 0)
@@ -990,7 +1036,7 @@ iobuf_alloc (int use, size_t bufsize)
   //   printf("Warning: reducing bufsize from %zu to 64000\n", bufsize);
   //   bufsize = 64000;
   // }
-  a->d.buf = xmalloc (bufsize);
+  a->d.buf = iobuf_buffer_get (bufsize);
   a->d.size = bufsize;
   a->no = ++number;
   a->subno = 0;
@@ -1013,8 +1059,8 @@ iobuf_close (iobuf_t a)
 
       a_chain = a->chain;
 
-  //     if (a->use == IOBUF_OUTPUT && (rc = filter_flush (a)))
-	// printf ("filter_flush failed on close: %s\n", gpg_strerror (rc));
+      if (a->use == IOBUF_OUTPUT && (rc = filter_flush (a)))
+	printf ("filter_flush failed on close: %d\n", rc);
 
       if (DBG_IOBUF)
 	printf ("iobuf-%d.%d: close '%s'\n",
@@ -1029,11 +1075,8 @@ iobuf_close (iobuf_t a)
 	rc = rc2;
 
       xfree (a->real_fname);
-      if (a->d.buf)
-	{
-	  memset (a->d.buf, 0, a->d.size);	/* erase the buffer */
-	  xfree (a->d.buf);
-	}
+      if (a->d.buf && !a->d_borrowed)
+	iobuf_buffer_put (a->d.buf, a->d.size);	/* erases the buffer */
       xfree (a);
     }
   return rc;
@@ -1106,6 +1149,23 @@ iobuf_temp_with_content (const char *buffer, size_t length)
   return a;
 }
 
+iobuf_t
+iobuf_temp_with_buffer (const void *buffer, size_t length)
+{
+  iobuf_t a;
+
+  a = xcalloc (1, sizeof *a);
+  a->use = IOBUF_INPUT_TEMP;
+  /* Never written: underflow returns EOF for IOBUF_INPUT_TEMP rather
+     than refilling the buffer, and iobuf_close leaves it alone.  */
+  a->d.buf = (byte *) buffer;
+  a->d.size = length;
+  a->d.len = length;
+  a->d_borrowed = 1;
+  a->no = ++number;
+  return a;
+}
+
 
 int
 iobuf_is_pipe_filename (const char *fname)
@@ -1121,8 +1181,6 @@ static iobuf_t
 do_open (const char *fname, int special_filenames,
 	 int use, const char *opentype, int mode700)
 {
-
-  printf("do_open %s %d %s", fname, use, opentype);
   iobuf_t a;
   gnupg_fd_t fp;
   file_filter_ctx_t *fcx;
@@ -1131,8 +1189,6 @@ do_open (const char *fname, int special_filenames,
   int fd;
   byte desc[MAX_IOBUF_DESC];
 
-  printf (use == IOBUF_INPUT || use == IOBUF_OUTPUT);
-
   if (special_filenames
       /* NULL or '-'.  */
       && (!fname || (*fname == '-' && !fname[1])))
@@ -1157,21 +1213,21 @@ do_open (const char *fname, int special_filenames,
 	// 		 opentype);
   else
     {
-  //     if (use == IOBUF_INPUT)
-	// fp = fd_cache_open (fname, opentype);
-  //     else
-	// fp = direct_open (fname, opentype, mode700);
+      if (use == IOBUF_INPUT)
+	fp = fd_cache_open (fname, opentype);
+      else
+	fp = direct_open (fname, opentype, mode700);
       if (fp == GNUPG_INVALID_FD)
 	return NULL;
     }
 
-  a = iobuf_alloc (use, IOBUF_BUFFER_SIZE);
+  a = iobuf_alloc (use, print_only ? IOBUF_BUFFER_SIZE : IOBUF_FILE_BUFFER_SIZE);
   fcx = xmalloc (sizeof *fcx + strlen (fname));
   fcx->fp = fp;
   fcx->print_only_name = print_only;
-//  strcpy (fcx->fname, fname);
-  // if (!print_only)
-  //   a->real_fname = xstrdup (fname);
+  strcpy (fcx->fname, fname);
+  if (!print_only)
+    a->real_fname = xstrdup (fname);
   a->filter = file_filter;
   a->filter_ov = fcx;
   file_filter (fcx, IOBUFCTRL_INIT, NULL, NULL, &len);
@@ -1480,7 +1536,7 @@ iobuf_push_filter2 (iobuf_t a,
   /* fixme: it is stupid to keep a copy of the name at every level
    * but we need the name somewhere because the name known by file_filter
    * may have been released when we need the name of the file */
-//   b->real_fname = a->real_fname ? xstrdup (a->real_fname) : NULL;
+  b->real_fname = a->real_fname ? xstrdup (a->real_fname) : NULL;
   /* remove the filter stuff from the new stream */
   a->filter = NULL;
   a->filter_ov = NULL;
@@ -1508,6 +1564,9 @@ iobuf_push_filter2 (iobuf_t a,
       a->use = IOBUF_INPUT;
       a->d.size = IOBUF_BUFFER_SIZE;
     }
+  else if (b->filter == file_filter)
+    /* Only the file itself needs the large transfers.  */
+    a->d.size = IOBUF_BUFFER_SIZE;
 
   /* The new filter (A) gets a new buffer.
 
@@ -1520,9 +1579,10 @@ iobuf_push_filter2 (iobuf_t a,
      the new filter (A) means that data that has read from (B), but
      not yet read from the pipeline won't be processed by the new
      filter (A)!  That's certainly not what we want.  */
-  a->d.buf = xmalloc (a->d.size);
+  a->d.buf = iobuf_buffer_get (a->d.size);
   a->d.len = 0;
   a->d.start = 0;
+  a->d_borrowed = 0;
 
   /* disable nlimit for the new stream */
   a->ntotal = b->ntotal + b->nbytes;
@@ -1573,14 +1633,12 @@ iobuf_pop_filter (iobuf_t a, int (*f) (void *opaque, int control,
   if (a->use == IOBUF_INPUT_TEMP || a->use == IOBUF_OUTPUT_TEMP)
     {
       /* This should be the last filter in the pipeline.  */
-      printf (! a->chain);
       return 0;
     }
   if (!a->filter)
     {				/* this is simple */
       b = a->chain;
-      printf (b);
-      xfree (a->d.buf);
+      release_buffer (a);
       xfree (a->real_fname);
       printf ("iobuf_pop_filter: no filter %d\n",sizeof *a);
       memcpy (a, b, sizeof *a);
@@ -1623,7 +1681,7 @@ iobuf_pop_filter (iobuf_t a, int (*f) (void *opaque, int control,
        * a flush has been done on the to be removed entry
        */
       b = a->chain;
-      xfree (a->d.buf);
+      release_buffer (a);
       xfree (a->real_fname);
       memcpy (a, b, sizeof *a);
       xfree (b);
@@ -1644,6 +1702,16 @@ iobuf_pop_filter (iobuf_t a, int (*f) (void *opaque, int control,
 }
 
 
+/* Free A's buffer unless it belongs to the caller.  */
+static void
+release_buffer (iobuf_t a)
+{
+  if (!a->d_borrowed)
+    iobuf_buffer_put (a->d.buf, a->d.size);
+  a->d.buf = NULL;
+}
+
+
 /****************
  * read underflow: read at least one byte into the buffer and return
  * the first byte or -1 on EOF.
@@ -1651,7 +1719,13 @@ iobuf_pop_filter (iobuf_t a, int (*f) (void *opaque, int control,
 static int
 underflow (iobuf_t a, int clear_pending_eof)
 {
-  return underflow_target (a, clear_pending_eof, 1);
+  int c;
+
+  PROF_BEGIN (PROF_UNDERFLOW);
+  c = underflow_target (a, clear_pending_eof, 1);
+  /* Counts what the filters delivered; D.LEN is 0 after EOF.  */
+  PROF_END (PROF_UNDERFLOW, a->d.len);
+  return c;
 }
 
 
@@ -1705,7 +1779,7 @@ underflow_target (iobuf_t a, int clear_pending_eof, size_t target)
 	  // if (DBG_IOBUF)
 	  //   printf ("iobuf-%d.%d: filter popped (pending EOF returned)\n",
 		       // a->no, a->subno);
-	  xfree (a->d.buf);
+	  release_buffer (a);
 	  xfree (a->real_fname);
 	  memcpy (a, b, sizeof *a);
 	  xfree (b);
@@ -1784,7 +1858,7 @@ underflow_target (iobuf_t a, int clear_pending_eof, size_t target)
 	  //     if (DBG_IOBUF)
 		// printf ("iobuf-%d.%d: pop in underflow (nothing buffered, got EOF)\n",
 			   // a->no, a->subno);
-	      xfree (a->d.buf);
+	      release_buffer (a);
 	      xfree (a->real_fname);
 	      memcpy (a, b, sizeof *a);
 	      xfree (b);
@@ -1891,7 +1965,7 @@ iobuf_readbyte (iobuf_t a)
 int
 iobuf_read (iobuf_t a, void *buffer, unsigned int buflen)
 {
-  printf("iobuf_read %d a->nlimit %d\n",buflen,a->nlimit);
+  TRACE(TRACE_DEBUG, "iobuf_read %d a->nlimit %d\n",buflen,a->nlimit);
   unsigned char *buf = (unsigned char *)buffer;
   int c, n;
 
@@ -1943,13 +2017,13 @@ iobuf_read (iobuf_t a, void *buffer, unsigned int buflen)
 	   underflow to read more data into the filter's internal
 	   buffer.  */
 	{
-	  // if ((c = underflow (a, 1)) == -1)
-	  //   /* EOF.  If we managed to read something, don't return EOF
-	  //      now.  */
-	  //   {
-	  //     a->nbytes += n;
-	  //     return n ? n : -1 /*EOF*/;
-	  //   }
+	  if ((c = underflow (a, 1)) == -1)
+	    /* EOF.  If we managed to read something, don't return EOF
+	       now.  */
+	    {
+	      a->nbytes += n;
+	      return n ? n : -1 /*EOF*/;
+	    }
 	  if (buf)
 	    *buf++ = c;
 	  n++;
@@ -1978,9 +2052,9 @@ iobuf_peek (iobuf_t a, byte * buf, unsigned buflen)
      request.  */
   while (buflen > a->d.len - a->d.start)
     {
-//      if (underflow_target (a, 0, buflen) == -1)
+      if (underflow_target (a, 0, buflen) == -1)
 	/* EOF.  We can't read any more.  */
-	//break;
+	break;
 
       /* Underflow consumes the first character (it's the return
 	 value).  unget() it by resetting the "file position".  */
@@ -2076,7 +2150,6 @@ iobuf_writebyte (iobuf_t a, unsigned int c)
       printf("filter_flush\n");
       return rc;
     }
-  printf (a->d.len < a->d.size);
   a->d.buf[a->d.len++] = c;
   // log_printhex(a->d.buf,a->d.len,"iobuf_writebyte");
   // printf("iobuf_write");
@@ -2089,7 +2162,6 @@ iobuf_writebyte (iobuf_t a, unsigned int c)
 int
 iobuf_write (iobuf_t a, const void *buffer, unsigned int buflen)
 {
-  printf("iobuf_write %d",buflen);
   const unsigned char *buf = (const unsigned char *)buffer;
   int rc;
 
@@ -2108,7 +2180,6 @@ iobuf_write (iobuf_t a, const void *buffer, unsigned int buflen)
 	    size = buflen;
 	  memcpy (a->d.buf + a->d.len, buf, size);
 
-  printf("iobuf_WROTE: %d bytes\n", size);
 	  buflen -= size;
 	  buf += size;
 	  a->d.len += size;
@@ -2270,9 +2341,9 @@ iobuf_get_filelength (iobuf_t a)
 #else /*!HAVE_W32_SYSTEM*/
     struct stat st;
 
-    // if ( !fstat (fp, &st) )
-//      return st.st_size;
-    printf("fstat() failed: %s\n");//, strerror(errno) );
+    if ( !fstat (fp, &st) )
+      return st.st_size;
+    printf("fstat() failed\n");
 #endif /*!HAVE_W32_SYSTEM*/
   }
 
@@ -2458,7 +2529,6 @@ iobuf_set_partial_body_length_mode (iobuf_t a, size_t len)
 		   " - please report\n");
       
       printf ("iobuf_pop_filter called in set_partial_block_mode");
-      printf (a->filter == block_filter);
       iobuf_pop_filter (a, block_filter, NULL);
     }
   else
@@ -2653,7 +2723,6 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
 
   if (control == IOBUFCTRL_UNDERFLOW)
     {
-      printf (size); /* We need a buffer.  */
       if (a->npeeked > a->upeeked)
         {
           nbytes = a->npeeked - a->upeeked;
@@ -2697,21 +2766,21 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
 #else
 
 	  int n;
+	  size_t tail = (a->pos + size) % FILE_BLOCK_SIZE;
 
+	  /* End on a block boundary where the buffer allows, which also
+	     lines the reads up again after a peek or a short read.  */
+	  if (size > tail)
+	    size -= tail;
 	  nbytes = 0;
-	  // do
-	  //   {
-	  //     n = read (f, buf, size);
-	  //   }
-	  // while (n == -1 && errno == EINTR);
+	  if (f == GNUPG_INVALID_FD)
+	    n = 0;  /* No file behind it (decrypt_memory): EOF.  */
+	  else
+	    n = read (f, buf, size);
 	  if (n == -1)
 	    {			/* error */
-	  //     if (errno != EPIPE)
-		// {
-		//   rc = gpg_error_from_syserror ();
-		//   // printf ("%s: read error: %s\n",
-		// 	//      a->fname, strerror (errno));
-		// }
+	      rc = gpg_error (GPG_ERR_EIO);
+	      printf ("%s: read error\n", a->fname);
 	    }
 	  else if (!n)
 	    {			/* eof */
@@ -2721,6 +2790,7 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
 	  else
 	    {
 	      nbytes = n;
+	      a->pos += n;
 	    }
 #endif
 	  *ret_len = nbytes;
@@ -2755,24 +2825,20 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
 	  int n;
 
 	  nbytes = size;
-	//  do
-// 	    {
-// 	      do
-// 		{
-// //		  n = write (f, p, nbytes);
-// 		}
-// 	      while (n == -1 && errno == EINTR);
-	  //     if (n > 0)
-		// {
-		//   p += n;
-		//   nbytes -= n;
-		// }
-	  //   }
-	  // while (n != -1 && nbytes);
-	  if (n == -1)
+	  do
+	    {
+	      n = write (f, p, nbytes);
+	      if (n > 0)
+		{
+		  p += n;
+		  nbytes -= n;
+		}
+	    }
+	  while (n > 0 && nbytes);
+	  if (n <= 0)
 	    {
-	      rc = gpg_error_from_syserror ();
-//	      printf ("%s: write error: %s\n", a->fname, strerror (errno));
+	      rc = gpg_error (GPG_ERR_EIO);
+	      printf ("%s: write error\n", a->fname);
 	    }
 	  nbytes = p - buf;
 #endif
@@ -2786,6 +2852,7 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
       a->no_cache = 0;
       a->npeeked = 0;
       a->upeeked = 0;
+      a->pos = 0;
     }
   else if (control == IOBUFCTRL_PEEK)
     {
@@ -2820,14 +2887,14 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
       int n;
 
     peek_more:
-//       do
-//         {
-// //          n = read (f, a->peeked + a->npeeked, sizeof a->peeked - a->npeeked);
-//         }
-//       while (n == -1 && errno == EINTR);
+      if (f == GNUPG_INVALID_FD)
+        n = 0;
+      else
+        n = read (f, a->peeked + a->npeeked, sizeof a->peeked - a->npeeked);
       if (n > 0)
         {
           a->npeeked += n;
+          a->pos += n;
           if (a->npeeked < sizeof a->peeked)
             goto peek_more;
         }
@@ -2837,9 +2904,8 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
         }
       else /* error */
         {
-          rc = gpg_error_from_syserror ();
-          // if (gpg_err_code (rc) != GPG_ERR_EPIPE)
-          //   printf ("%s: read error: %s\n", a->fname, gpg_strerror (rc));
+          rc = gpg_error (GPG_ERR_EIO);
+          printf ("%s: read error\n", a->fname);
         }
 #endif /* Unix */
 
@@ -2854,12 +2920,12 @@ file_filter (void *opaque, int control, iobuf_t chain, byte * buf,
     }
   else if (control == IOBUFCTRL_FREE)
     {
-      if (f != FD_FOR_STDIN && f != FD_FOR_STDOUT)
+      if (f != FD_FOR_STDIN && f != FD_FOR_STDOUT && f != GNUPG_INVALID_FD)
 	{
 	  if (DBG_IOBUF)
 	    printf ("%s: close fd/handle %d\n", a->fname, FD2INT (f));
-	  // if (!a->keep_open)
-	  //   fd_cache_close (a->no_cache ? NULL : a->fname, f);
+	  if (!a->keep_open)
+	    fd_cache_close (a->no_cache ? NULL : a->fname, f);
 	}
       xfree (a); /* We can free our context now. */
     }
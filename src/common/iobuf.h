@@ -49,7 +49,8 @@
    There are number of predefined filters.  iobuf_open(), for
    instance, creates a filter that reads from a specified file.  And,
    iobuf_temp_with_content() creates a filter that returns some
-   specified contents.  There are also filters for writing content.
+   specified contents; iobuf_temp_with_buffer() does the same without
+   copying them.  There are also filters for writing content.
    iobuf_openrw opens a file for writing.  iobuf_temp creates a filter
    that writes data to a fixed-sized buffer.
 
@@ -89,6 +90,8 @@
    EOF, the EOF is returned to the user exactly once and then the
    filter is removed from the pipeline.)  */
 
+#include <stdint.h>
+
 /* For estream_t.  */
 #include "../gpg-error.h"
 
@@ -109,6 +112,7 @@ typedef struct
   char peeked[32];     /* Read ahead buffer.  */
   byte npeeked;        /* Number of bytes valid in peeked.  */
   byte upeeked;        /* Number of bytes used from peeked.  */
+  size_t pos;          /* Bytes read so far (modulo the block size).  */
   char fname[1];       /* Name of the file.  */
 } file_filter_ctx_t;
 
@@ -220,6 +224,10 @@ struct iobuf_struct
     byte *buf;
   } d;
 
+  /* Whether D.BUF is caller-owned memory (iobuf_temp_with_buffer) that
+     must be neither written to nor freed.  */
+  int d_borrowed;
+
   /* When FILTER is called to read some data, it may read some data
      and then return EOF.  We can't return the EOF immediately.
      Instead, we note that we observed the EOF and when the buffer is
@@ -289,6 +297,18 @@ int  iobuf_is_pipe_filename (const char *fname);
    the typical read / write request).  */
 iobuf_t iobuf_alloc (int use, size_t bufsize);
 
+/* Keep up to N (at most 8) buffers of the default size when they are
+   released, for the next iobuf or iobuf_buffer_get to take; 0 frees
+   the kept ones and turns this off, which is the default.  */
+void iobuf_buffer_cache (unsigned n);
+
+/* A buffer of SIZE bytes, from the cache if it has one of that size.
+   Unlike those from xmalloc it is not cleared, only wiped when it was
+   given back.  Give it back with iobuf_buffer_put and the same SIZE,
+   which wipes it before caching or freeing it.  */
+void *iobuf_buffer_get (size_t size);
+void iobuf_buffer_put (void *buf, size_t size);
+
 /* Create an output filter that simply buffers data written to it.
    This is useful for collecting data for later processing.  The
    buffer can be written to in the usual way (iobuf_write, etc.).  The
@@ -299,6 +319,11 @@ iobuf_t iobuf_temp (void);
 /* Create an input filter that contains some data for reading.  */
 iobuf_t iobuf_temp_with_content (const char *buffer, size_t length);
 
+/* Like iobuf_temp_with_content, but serve reads straight from BUFFER
+   instead of a copy.  BUFFER stays owned by the caller and must not
+   change or go away before the pipeline is closed.  */
+iobuf_t iobuf_temp_with_buffer (const void *buffer, size_t length);
+
 /* Create an input file filter that reads from a file.  If FNAME is
    '-', reads from stdin.  If special filenames are enabled
    (iobuf_enable_special_filenames), then interprets special
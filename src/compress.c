@@ -0,0 +1,188 @@
+/* compress.c - Decompress compressed data packets
+ *
+ * Only decompression of COMPRESS_ALGO_ZIP and COMPRESS_ALGO_ZLIB is
+ * supported; BZIP2 needs over 2 MB at its default block size, more than
+ * the whole heap, and is rejected with GPG_ERR_COMPR_ALGO.  The decoder
+ * state, 32 KiB window included, is taken from a small static pool so
+ * that a compressed packet does not take a large slice of the heap, and
+ * it has a fixed size however large the message is.
+ */
+
+#include "common/config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memory.h"
+#include "gpg.h"
+#include "printf.h"
+#include "trace.h"
+#include "packet.h"
+#include "filter.h"
+#include "inflate.h"
+
+/* Decoders in .bss; a nested compressed packet beyond these gets one
+   from the heap.  */
+#define COMPRESS_POOL_SIZE 2
+
+static inflate_t inflate_pool[COMPRESS_POOL_SIZE];
+static int inflate_pool_busy[COMPRESS_POOL_SIZE];
+
+static inflate_t *
+inflate_alloc (void)
+{
+  int i;
+
+  for (i = 0; i < COMPRESS_POOL_SIZE; i++)
+    if (!inflate_pool_busy[i])
+      {
+        inflate_pool_busy[i] = 1;
+        return &inflate_pool[i];
+      }
+  return xtrycalloc (1, sizeof (inflate_t));
+}
+
+static void
+inflate_free (inflate_t *z)
+{
+  if (z >= inflate_pool && z < inflate_pool + COMPRESS_POOL_SIZE)
+    inflate_pool_busy[z - inflate_pool] = 0;
+  else
+    xfree (z);
+}
+
+static void
+release_zfx_context (compress_filter_context_t *zfx)
+{
+  if (!zfx)
+    return;
+
+  if (!--zfx->refcount)
+    {
+      if (zfx->z)
+        inflate_free (zfx->z);
+      xfree (zfx);
+    }
+}
+
+/* The inflate_read_t for the compressed stream below the filter.  */
+static size_t
+inflate_source (void *opaque, unsigned char *buf, size_t size)
+{
+  compress_filter_context_t *zfx = opaque;
+  int n;
+
+  n = iobuf_read (zfx->chain, buf, size);
+  return n < 0 ? 0 : n;
+}
+
+/* The compressed data runs to the end of the enclosing packet, so
+   after an error nothing behind it can be parsed either.  Read A up to
+   that end (free_compressed in GnuPG), which also lets an MDC or AEAD
+   filter below see all of its data.  */
+static void
+skip_rest (iobuf_t a)
+{
+  while (iobuf_read (a, NULL, 1 << 30) != -1)
+    ;
+}
+
+int
+compress_filter (void *opaque, int control, iobuf_t a,
+                 byte *buf, size_t *ret_len)
+{
+  compress_filter_context_t *zfx = opaque;
+  size_t n = 0;
+  int rc = 0, err;
+
+  if (control == IOBUFCTRL_UNDERFLOW && (zfx->eof_seen || zfx->err))
+    {
+      *ret_len = 0;
+      rc = -1;
+    }
+  else if (control == IOBUFCTRL_UNDERFLOW)
+    {
+      zfx->chain = a;
+      err = inflate_read (zfx->z, buf, *ret_len, &n);
+      zfx->chain = NULL;
+      if (err == GPG_ERR_EOF)
+        {
+          zfx->eof_seen = 1;
+          if (!n)
+            rc = -1;
+        }
+      else if (err)
+        {
+          /* Hand out what was decoded before the error and then EOF;
+             handle_compressed reports the error.  An error return
+             would stick to the iobuf and keep this filter pushed.  */
+          TRACE (TRACE_ERROR, "inflate failed: %d\n", err);
+          zfx->err = gpg_error (GPG_ERR_BAD_DATA);
+          skip_rest (a);
+          if (!n)
+            rc = -1;
+        }
+      *ret_len = n;
+    }
+  else if (control == IOBUFCTRL_FREE)
+    {
+      release_zfx_context (zfx);
+    }
+  else if (control == IOBUFCTRL_DESC)
+    {
+      // mem2str (buf, "compress_filter", *ret_len);
+    }
+  return rc;
+}
+
+/* Process the packets inside the compressed data packet CD, either
+   with CALLBACK or with proc_packets.  Returns GPG_ERR_BAD_DATA if the
+   data could not be decompressed.  */
+int
+handle_compressed (ctrl_t ctrl, void *procctx, PKT_compressed *cd,
+                   int (*callback)(iobuf_t, void *), void *passthru)
+{
+  compress_filter_context_t *zfx;
+  iobuf_t a = cd->buf;
+  int rc;
+
+  if (cd->algorithm != COMPRESS_ALGO_ZIP
+      && cd->algorithm != COMPRESS_ALGO_ZLIB)
+    {
+      skip_rest (a);
+      cd->buf = NULL;
+      return gpg_error (GPG_ERR_COMPR_ALGO);
+    }
+
+  zfx = xtrycalloc (1, sizeof *zfx);
+  if (!zfx)
+    return gpg_error_from_syserror ();
+  zfx->z = inflate_alloc ();
+  if (!zfx->z)
+    {
+      xfree (zfx);
+      return gpg_error_from_syserror ();
+    }
+  inflate_init (zfx->z, cd->algorithm == COMPRESS_ALGO_ZLIB,
+                inflate_source, zfx);
+
+  /* One reference for the filter and one for us, so that the error is
+     still there if the filter has been popped at EOF.  */
+  zfx->refcount = 2;
+  iobuf_push_filter (a, compress_filter, zfx);
+  if (callback)
+    rc = callback (a, passthru);
+  else
+    rc = proc_packets (ctrl, procctx, a);
+  cd->buf = NULL;
+
+  if (zfx->err)
+    rc = zfx->err;
+
+  /* Whatever has not been read is not needed; give the decoder back
+     now instead of when the iobuf is closed.  */
+  zfx->eof_seen = 1;
+  inflate_free (zfx->z);
+  zfx->z = NULL;
+  release_zfx_context (zfx);
+  return rc;
+}
@@ -28,12 +28,16 @@
 #include "gpg.h"
 #include "common/util.h"
 #include "printf.h"
+#include "trace.h"
 #include "packet.h"
 // #include "options.h"
 #include "common/i18n.h"
 #include "common/status.h"
 #include "common/compliance.h"
 #include "libgcrypt.h"
+#include "sha1.h"
+#include "session.h"
+#include "smp.h"
 
 static int aead_decode_filter(void *opaque, int control, iobuf_t a,
                               byte *buf, size_t *ret_len);
@@ -53,8 +57,11 @@ struct decode_filter_context_s
   /* The cipher handle.  */
   gcry_cipher_hd_t cipher_hd;
 
-  /* The hash handle for use in MDC mode.  */
-  gcry_md_hd_t mdc_hash;
+  /* CIPHER_HD is the decrypt session's, not ours to close.  */
+  unsigned int cipher_borrowed : 1;
+
+  /* The hash context for use in MDC mode.  */
+  SHA1_CTX *mdc_hash;
 
   /* The start IV for AEAD encryption.   */
   byte startiv[16];
@@ -98,6 +105,11 @@ struct decode_filter_context_s
   /* Remaining bytes in the packet according to the packet header.
    * Not used if PARTIAL is true.  */
   size_t length;
+
+  /* The first error from aead_underflow.  The iobuf turns a filter
+   * error into a plain EOF for its reader, so decrypt_data takes it
+   * from here.  */
+  gpg_error_t aead_err;
 };
 typedef struct decode_filter_context_s *decode_filter_ctx_t;
 
@@ -108,111 +120,129 @@ release_dfx_context(decode_filter_ctx_t dfx)
   if (!dfx)
     return;
 
-  printf(dfx->refcount);
   if (!--dfx->refcount)
   {
-    // gcry_cipher_close (dfx->cipher_hd);
-    xfree(dfx->cipher_hd);
+    if (!dfx->cipher_borrowed)
+      _gcry_cipher_close (dfx->cipher_hd);
     dfx->cipher_hd = NULL;
     // gcry_md_close (dfx->mdc_hash);
+    if (dfx->mdc_hash)
+      wipememory(dfx->mdc_hash, sizeof *dfx->mdc_hash);
     xfree(dfx->mdc_hash);
     dfx->mdc_hash = NULL;
     xfree(dfx);
   }
 }
 
-// /* Set the nonce and the additional data for the current chunk.  This
-//  * also reset the decryption machinery so that the handle can be
-//  * used for a new chunk.  If FINAL is set the final AEAD chunk is
-//  * processed.  */
-// static gpg_error_t
-// aead_set_nonce_and_ad (decode_filter_ctx_t dfx, int final)
-// {
-//   gpg_error_t err;
-//   unsigned char ad[21];
-//   unsigned char nonce[16];
-//   int i;
-
-//   switch (dfx->aead_algo)
-//     {
-//     case AEAD_ALGO_OCB:
-//       memcpy (nonce, dfx->startiv, 15);
-//       i = 7;
-//       break;
-
-//     case AEAD_ALGO_EAX:
-//       memcpy (nonce, dfx->startiv, 16);
-//       i = 8;
-//       break;
-
-//     default:
-//       BUG ();
-//     }
-//   nonce[i++] ^= dfx->chunkindex >> 56;
-//   nonce[i++] ^= dfx->chunkindex >> 48;
-//   nonce[i++] ^= dfx->chunkindex >> 40;
-//   nonce[i++] ^= dfx->chunkindex >> 32;
-//   nonce[i++] ^= dfx->chunkindex >> 24;
-//   nonce[i++] ^= dfx->chunkindex >> 16;
-//   nonce[i++] ^= dfx->chunkindex >>  8;
-//   nonce[i++] ^= dfx->chunkindex;
-
-//   if (DBG_CRYPTO)
-//     printf (nonce, i, "nonce:");
-//   err = gcry_cipher_setiv (dfx->cipher_hd, nonce, i);
-//   if (err)
-//     return err;
-
-//   ad[0] = (0xc0 | PKT_ENCRYPTED_AEAD);
-//   ad[1] = 1;
-//   ad[2] = dfx->cipher_algo;
-//   ad[3] = dfx->aead_algo;
-//   ad[4] = dfx->chunkbyte;
-//   ad[5] = dfx->chunkindex >> 56;
-//   ad[6] = dfx->chunkindex >> 48;
-//   ad[7] = dfx->chunkindex >> 40;
-//   ad[8] = dfx->chunkindex >> 32;
-//   ad[9] = dfx->chunkindex >> 24;
-//   ad[10]= dfx->chunkindex >> 16;
-//   ad[11]= dfx->chunkindex >>  8;
-//   ad[12]= dfx->chunkindex;
-//   if (final)
-//     {
-//       ad[13] = dfx->total >> 56;
-//       ad[14] = dfx->total >> 48;
-//       ad[15] = dfx->total >> 40;
-//       ad[16] = dfx->total >> 32;
-//       ad[17] = dfx->total >> 24;
-//       ad[18] = dfx->total >> 16;
-//       ad[19] = dfx->total >>  8;
-//       ad[20] = dfx->total;
-//     }
-//   if (DBG_CRYPTO)
-//     printf (ad, final? 21 : 13, "authdata:");
-//   return gcry_cipher_authenticate (dfx->cipher_hd, ad, final? 21 : 13);
-// }
-
-// /* Helper to check the 16 byte tag in TAGBUF.  The FINAL flag is only
-//  * for debug messages.  */
-// static gpg_error_t
-// aead_checktag (decode_filter_ctx_t dfx, int final, const void *tagbuf)
-// {
-//   gpg_error_t err;
-
-//   if (DBG_FILTER)
-//     printf (tagbuf, 16, "tag:");
-//   err = gcry_cipher_checktag (dfx->cipher_hd, tagbuf, 16);
-//   if (err)
-//     {
-//       printf ("gcry_cipher_checktag%s failed: %s\n",
-//                  final? " (final)":"", gpg_strerror (err));
-//       write_status_error ("aead_checktag", err);
-//       return err;
-//     }
-//   if (DBG_FILTER)
-//     printf ("%stag is valid\n", final?"final ":"");
-//   return 0;
-// }
+/* Open DFX's cipher for ALGO in MODE and key it with DEK, or borrow
+   the handle of the decrypt session the message is part of.  */
+static int
+open_cipher (ctrl_t ctrl, decode_filter_ctx_t dfx, int algo, int mode,
+             DEK *dek)
+{
+  int rc;
+
+  if (ctrl->session)
+    {
+      rc = session_cipher (ctrl->session, &dfx->cipher_hd, algo, mode,
+                           dek->key, dek->keylen);
+      if (rc || dfx->cipher_hd)
+        {
+          dfx->cipher_borrowed = !rc;
+          return rc;
+        }
+    }
+  rc = _gcry_cipher_open (&dfx->cipher_hd, algo, mode);
+  if (rc)
+    return rc; /* Should never happen.  */
+  return _gcry_cipher_setkey (dfx->cipher_hd, dek->key, dek->keylen);
+}
+
+/* Set the nonce and the additional data for the current chunk.  This
+ * also reset the decryption machinery so that the handle can be
+ * used for a new chunk.  If FINAL is set the final AEAD chunk is
+ * processed.  */
+static gpg_error_t
+aead_set_nonce_and_ad (decode_filter_ctx_t dfx, int final)
+{
+  gpg_error_t err;
+  unsigned char ad[21];
+  unsigned char nonce[16];
+  int i;
+
+  switch (dfx->aead_algo)
+    {
+    case AEAD_ALGO_OCB:
+      memcpy (nonce, dfx->startiv, 15);
+      i = 7;
+      break;
+
+    case AEAD_ALGO_EAX:
+      memcpy (nonce, dfx->startiv, 16);
+      i = 8;
+      break;
+
+    default:
+      return gpg_error (GPG_ERR_INV_CIPHER_MODE);
+    }
+  nonce[i++] ^= dfx->chunkindex >> 56;
+  nonce[i++] ^= dfx->chunkindex >> 48;
+  nonce[i++] ^= dfx->chunkindex >> 40;
+  nonce[i++] ^= dfx->chunkindex >> 32;
+  nonce[i++] ^= dfx->chunkindex >> 24;
+  nonce[i++] ^= dfx->chunkindex >> 16;
+  nonce[i++] ^= dfx->chunkindex >>  8;
+  nonce[i++] ^= dfx->chunkindex;
+
+  err = gpg_error (_gcry_cipher_setiv (dfx->cipher_hd, nonce, i));
+  if (err)
+    return err;
+
+  ad[0] = (0xc0 | PKT_ENCRYPTED_AEAD);
+  ad[1] = 1;
+  ad[2] = dfx->cipher_algo;
+  ad[3] = dfx->aead_algo;
+  ad[4] = dfx->chunkbyte;
+  ad[5] = dfx->chunkindex >> 56;
+  ad[6] = dfx->chunkindex >> 48;
+  ad[7] = dfx->chunkindex >> 40;
+  ad[8] = dfx->chunkindex >> 32;
+  ad[9] = dfx->chunkindex >> 24;
+  ad[10]= dfx->chunkindex >> 16;
+  ad[11]= dfx->chunkindex >>  8;
+  ad[12]= dfx->chunkindex;
+  if (final)
+    {
+      ad[13] = dfx->total >> 56;
+      ad[14] = dfx->total >> 48;
+      ad[15] = dfx->total >> 40;
+      ad[16] = dfx->total >> 32;
+      ad[17] = dfx->total >> 24;
+      ad[18] = dfx->total >> 16;
+      ad[19] = dfx->total >>  8;
+      ad[20] = dfx->total;
+    }
+  return gpg_error (_gcry_cipher_authenticate (dfx->cipher_hd, ad,
+                                               final? 21 : 13));
+}
+
+/* Helper to check the 16 byte tag in TAGBUF.  The FINAL flag is only
+ * for debug messages.  */
+static gpg_error_t
+aead_checktag (decode_filter_ctx_t dfx, int final, const void *tagbuf)
+{
+  gpg_error_t err;
+
+  err = gpg_error (_gcry_cipher_checktag (dfx->cipher_hd, tagbuf, 16));
+  if (err)
+    {
+      TRACE (TRACE_ERROR, "AEAD checktag%s failed (chunk %u)\n",
+             final? " (final)":"", (unsigned int)dfx->chunkindex);
+      return err;
+    }
+  TRACE (TRACE_DEBUG, "%stag is valid\n", final?"final ":"");
+  return 0;
+}
 
 /****************
  * Decrypt the data, specified by ED with the key DEK.  On return
@@ -282,15 +312,19 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
   //     dek->algo_info_printed = 1;
   //   }
 
-  // if (ed->aead_algo)
-  //   {
-  //     rc = openpgp_aead_algo_info (ed->aead_algo, &ciphermode, &startivlen);
-  //     if (rc)
-  //       goto leave;
-  //     printf (startivlen <= sizeof dfx->startiv);
-  //   }
-  // else
-  ciphermode = GCRY_CIPHER_MODE_CFB;
+  if (ed->aead_algo)
+    {
+      rc = openpgp_aead_algo_info (ed->aead_algo, &ciphermode, &startivlen);
+      if (rc)
+        goto leave;
+      if (startivlen > sizeof dfx->startiv)
+        {
+          rc = gpg_error (GPG_ERR_INV_LENGTH);
+          goto leave;
+        }
+    }
+  else
+    ciphermode = GCRY_CIPHER_MODE_CFB;
 
   /* Check compliance.  */
   // if (!gnupg_cipher_is_allowed (opt.compliance, 0, dek->algo, ciphermode))
@@ -308,9 +342,6 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
   //       }
   //   }
 
-  printf(STATUS_DECRYPTION_INFO, "%d %d %d",
-         ed->mdc_method, dek->algo, 0);
-
   // if (opt.show_session_key)
   //   {
   //     char numbuf[25];
@@ -334,89 +365,78 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
   // rc = openpgp_cipher_test_algo (dek->algo);
   // if (rc)
   //   goto leave;
-  blocksize = 8; // openpgp_cipher_get_algo_blklen (dek->algo);
+  blocksize = gcry_cipher_get_algo_blklen (dek->algo);
   if (!blocksize || blocksize > 16)
-    printf("unsupported blocksize %u\n", blocksize);
+    {
+      printf("unsupported cipher algorithm %d\n", dek->algo);
+      rc = gpg_error (GPG_ERR_CIPHER_ALGO);
+      goto leave;
+    }
 
   if (ed->aead_algo)
   {
-    // if (blocksize != 16)
-    // {
-    //   rc = gpg_error(GPG_ERR_CIPHER_ALGO);
-    //   goto leave;
-    // }
-
-    // if (ed->chunkbyte > 56)
-    // {
-    //   printf("invalid AEAD chunkbyte %u\n", ed->chunkbyte);
-    //   rc = gpg_error(GPG_ERR_INV_PACKET);
-    //   goto leave;
-    // }
-
-    // /* Read the Start-IV. */
-    // if (ed->len)
-    // {
-    //   for (i = 0; i < startivlen && ed->len; i++, ed->len--)
-    //   {
-    //     if ((c = iobuf_get(ed->buf)) == -1)
-    //       break;
-    //     dfx->startiv[i] = c;
-    //   }
-    // }
-    // else
-    // {
-    //   for (i = 0; i < startivlen; i++)
-    //     if ((c = iobuf_get(ed->buf)) == -1)
-    //       break;
-    //     else
-    //       dfx->startiv[i] = c;
-    // }
-    // if (i != startivlen)
-    // {
-    //   printf("Start-IV in AEAD packet too short (%d/%u)\n",
-    //          i, startivlen);
-    //   rc = gpg_error(GPG_ERR_TOO_SHORT);
-    //   goto leave;
-    // }
-
-    // dfx->cipher_algo = ed->cipher_algo;
-    // dfx->aead_algo = ed->aead_algo;
-    // dfx->chunkbyte = ed->chunkbyte;
-    // dfx->chunksize = (uint64_t)1 << (dfx->chunkbyte + 6);
-
-    // if (dek->algo != dfx->cipher_algo)
-    //   printf("COMMMENTED OUT\n");
-    //   // printf("Note: different cipher algorithms used (%s/%s)\n",
-    //   //        openpgp_cipher_algo_name(dek->algo),
-    //   //        openpgp_cipher_algo_name(dfx->cipher_algo));
-
-    // rc = openpgp_cipher_open(&dfx->cipher_hd,
-    //                          dfx->cipher_algo,
-    //                          ciphermode,
-    //                          GCRY_CIPHER_SECURE);
-    // if (rc)
-    //   goto leave; /* Should never happen.  */
-
-    // // if (DBG_CRYPTO)
-    // //   printf (dek->key, dek->keylen, "thekey:");
-    // rc = gcry_cipher_setkey(dfx->cipher_hd, dek->key, dek->keylen);
-    // if (gpg_err_code(rc) == GPG_ERR_WEAK_KEY)
-    // {
-    //   printf(("WARNING: message was encrypted with"
-    //           " a weak key in the symmetric cipher.\n"));
-    //   rc = 0;
-    // }
-    // else if (rc)
-    // {
-    //   printf("key setup failed: %s\n", gpg_strerror(rc));
-    //   goto leave;
-    // }
-
-    // if (!ed->buf)
-    // {
-    //   printf(("problem handling encrypted packet\n"));
-    //   goto leave;
-    // }
+    if (blocksize != 16)
+    {
+      rc = gpg_error(GPG_ERR_CIPHER_ALGO);
+      goto leave;
+    }
+
+    if (ed->chunkbyte > 56)
+    {
+      printf("invalid AEAD chunkbyte %u\n", ed->chunkbyte);
+      rc = gpg_error(GPG_ERR_INV_PACKET);
+      goto leave;
+    }
+
+    if (!ed->buf)
+    {
+      printf(("problem handling encrypted packet\n"));
+      rc = gpg_error(GPG_ERR_INV_PACKET);
+      goto leave;
+    }
+
+    /* Read the Start-IV. */
+    if (ed->len)
+    {
+      for (i = 0; i < startivlen && ed->len; i++, ed->len--)
+      {
+        if ((c = iobuf_get(ed->buf)) == -1)
+          break;
+        dfx->startiv[i] = c;
+      }
+    }
+    else
+    {
+      for (i = 0; i < startivlen; i++)
+        if ((c = iobuf_get(ed->buf)) == -1)
+          break;
+        else
+          dfx->startiv[i] = c;
+    }
+    if (i != startivlen)
+    {
+      printf("Start-IV in AEAD packet too short (%d/%u)\n",
+             i, startivlen);
+      rc = gpg_error(GPG_ERR_TOO_SHORT);
+      goto leave;
+    }
+
+    dfx->cipher_algo = ed->cipher_algo;
+    dfx->aead_algo = ed->aead_algo;
+    dfx->chunkbyte = ed->chunkbyte;
+    dfx->chunksize = (uint64_t)1 << (dfx->chunkbyte + 6);
+
+    if (dek->algo != dfx->cipher_algo)
+      printf("Note: different cipher algorithms used (%d/%d)\n",
+             dek->algo, dfx->cipher_algo);
+
+    rc = open_cipher (ctrl, dfx, dfx->cipher_algo, ciphermode, dek);
+    if (rc)
+    {
+      printf("key setup failed: %d\n", rc);
+      rc = gpg_error (rc);
+      goto leave;
+    }
   }
   else /* CFB encryption.  */
   {
@@ -429,48 +449,36 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
       goto leave;
     }
 
-    // if ( ed->mdc_method )
-    //   {
-    //     if (gcry_md_open (&dfx->mdc_hash, ed->mdc_method, 0 ))
-    //       BUG ();
-    //     if ( DBG_HASHING )
-    //       gcry_md_debug (dfx->mdc_hash, "checkmdc");
-    //   }
-    memset(&dfx, 0, sizeof dfx);
-
-    dfx->cipher_hd = malloc(sizeof(struct gcry_cipher_handle));
-    if (!dfx->cipher_hd)
-    {
-      return -1; // Handle allocation failure
-    }
-    memset(dfx->cipher_hd, 0, sizeof(struct gcry_cipher_handle));
-
+    if ( ed->mdc_method )
+      {
+        if (ed->mdc_method != DIGEST_ALGO_SHA1)
+          {
+            rc = gpg_error(GPG_ERR_DIGEST_ALGO);
+            goto leave;
+          }
+        dfx->mdc_hash = xmalloc(sizeof *dfx->mdc_hash);
+        SHA1Init(dfx->mdc_hash);
+      }
     // rc = openpgp_cipher_open (&dfx->cipher_hd, dek->algo,
     //                           GCRY_CIPHER_MODE_CFB,
     //                           (GCRY_CIPHER_SECURE
     //                            | ((ed->mdc_method || dek->algo >= 100)?
     //                               0 : GCRY_CIPHER_ENABLE_SYNC)));
-    if (rc)
-    {
-      /* We should never get an error here cause we already checked
-       * that the algorithm is available.  */
-
-      printf("COMMMENTED OUT\n");//      BUG();
-    }
-
     /* log_hexdump( "thekey", dek->key, dek->keylen );*/
-    rc = _gcry_cipher_setkey(dfx->cipher_hd, dek->key, dek->keylen);
+    rc = open_cipher (ctrl, dfx, dek->algo, GCRY_CIPHER_MODE_CFB, dek);
     // if ( gpg_err_code (rc) == GPG_ERR_WEAK_KEY )
     //   {
     //     printf (("WARNING: message was encrypted with"
     //                 " a weak key in the symmetric cipher.\n"));
     //     rc = 0;
     //   }
-    // else if (rc)
-    //   {
-    //     printf("key setup failed: %s\n", gpg_strerror (rc) );
-    //     goto leave;
-    //   }
+    // else
+    if (rc)
+      {
+        printf("key setup failed: %d\n", rc);
+        rc = gpg_error (rc);
+        goto leave;
+      }
 
     if (!ed->buf)
     {
@@ -479,7 +487,7 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
       goto leave;
     }
 
-    _gcry_cipher_setiv(dfx->cipher_hd, NULL, 8);
+    _gcry_cipher_setiv(dfx->cipher_hd, NULL, blocksize);
 
     if (ed->len)
     {
@@ -508,7 +516,10 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
     }
 
     _gcry_cipher_decrypt(dfx->cipher_hd, temp, nprefix + 2, NULL, 0);
-    cipher_sync(dfx->cipher_hd);
+    /* The resync after the prefix is only done without MDC
+       (GCRY_CIPHER_ENABLE_SYNC upstream).  */
+    if (!ed->mdc_method)
+      cipher_sync(dfx->cipher_hd);
     p = temp;
     /* log_hexdump( "prefix", temp, nprefix+2 ); */
     if (dek->symmetric && (p[nprefix - 2] != p[nprefix] || p[nprefix - 1] != p[nprefix + 1]))
@@ -522,8 +533,8 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
     }
 
 
-    // if ( dfx->mdc_hash )
-    //   gcry_md_write (dfx->mdc_hash, temp, nprefix+2);
+    if ( dfx->mdc_hash )
+      SHA1Update(dfx->mdc_hash, temp, nprefix+2);
   }
 
       // goto leave; // to inspect why no DEK derivation between binaries
@@ -531,16 +542,16 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
   dfx->refcount++;
   dfx->partial = !!ed->is_partial;
   dfx->length = ed->len;
-  // if (ed->aead_algo)
-  //   iobuf_push_filter ( ed->buf, aead_decode_filter, dfx );
-  // else if (ed->mdc_method)
-  //   iobuf_push_filter ( ed->buf, mdc_decode_filter, dfx );
-  // else
 
   // OVERWITING HERE:
   // dfx->length = ctrl->enc_length;
 
-  iobuf_push_filter(ed->buf, decode_filter, dfx);
+  if (ed->aead_algo)
+    iobuf_push_filter ( ed->buf, aead_decode_filter, dfx );
+  else if (ed->mdc_method)
+    iobuf_push_filter ( ed->buf, mdc_decode_filter, dfx );
+  else
+    iobuf_push_filter(ed->buf, decode_filter, dfx);
 
   // if (opt.unwrap_encryption)
   //   {
@@ -578,39 +589,40 @@ int decrypt_data(ctrl_t ctrl, void *procctx, PKT_encrypted *ed, DEK *dek,
   proc_packets(ctrl, procctx, ed->buf);
 
   ed->buf = NULL;
-  if (dfx->eof_seen > 1)
+  if (dfx->aead_err)
+    rc = dfx->aead_err;
+  else if (ed->aead_algo && !dfx->eof_seen)
+    rc = gpg_error (GPG_ERR_TRUNCATED); /* Final tag never checked.  */
+  else if (dfx->eof_seen > 1)
     rc = gpg_error(GPG_ERR_INV_PACKET);
-  // else if ( ed->mdc_method )
-  //   {
-  //     /* We used to let parse-packet.c handle the MDC packet but this
-  //        turned out to be a problem with compressed packets: With old
-  //        style packets there is no length information available and
-  //        the decompressor uses an implicit end.  However we can't know
-  //        this implicit end beforehand (:-) and thus may feed the
-  //        decompressor with more bytes than actually needed.  It would
-  //        be possible to unread the extra bytes but due to our weird
-  //        iobuf system any unread is non reliable due to filters
-  //        already popped off.  The easy and sane solution is to care
-  //        about the MDC packet only here and never pass it to the
-  //        packet parser.  Fortunatley the OpenPGP spec requires a
-  //        strict format for the MDC packet so that we know that 22
-  //        bytes are appended.  */
-  //     int datalen = gcry_md_get_algo_dlen (ed->mdc_method);
-
-  //     printf (dfx->cipher_hd);
-  //     printf (dfx->mdc_hash);
-  //     gcry_cipher_decrypt (dfx->cipher_hd, dfx->holdback, 22, NULL, 0);
-  //     gcry_md_write (dfx->mdc_hash, dfx->holdback, 2);
-  //     gcry_md_final (dfx->mdc_hash);
-
-  //     if (   dfx->holdback[0] != '\xd3'
-  //         || dfx->holdback[1] != '\x14'
-  //         || datalen != 20
-  //         || memcmp (gcry_md_read (dfx->mdc_hash, 0), dfx->holdback+2, datalen))
-  //       rc = gpg_error (GPG_ERR_BAD_SIGNATURE);
-  //     /* printf(dfx->holdback, 22, "MDC message:"); */
-  //     /* printf(gcry_md_read (dfx->mdc_hash,0), datalen, "MDC calc:"); */
-  //   }
+  else if ( ed->mdc_method )
+    {
+      /* We used to let parse-packet.c handle the MDC packet but this
+         turned out to be a problem with compressed packets: With old
+         style packets there is no length information available and
+         the decompressor uses an implicit end.  However we can't know
+         this implicit end beforehand (:-) and thus may feed the
+         decompressor with more bytes than actually needed.  It would
+         be possible to unread the extra bytes but due to our weird
+         iobuf system any unread is non reliable due to filters
+         already popped off.  The easy and sane solution is to care
+         about the MDC packet only here and never pass it to the
+         packet parser.  Fortunatley the OpenPGP spec requires a
+         strict format for the MDC packet so that we know that 22
+         bytes are appended.  */
+      byte digest[20];
+
+      _gcry_cipher_decrypt (dfx->cipher_hd, dfx->holdback, 22, NULL, 0);
+      SHA1Update (dfx->mdc_hash, (byte *)dfx->holdback, 2);
+      SHA1Final (digest, dfx->mdc_hash);
+
+      if (   dfx->holdback[0] != '\xd3'
+          || dfx->holdback[1] != '\x14'
+          || memcmp (digest, dfx->holdback+2, sizeof digest))
+        rc = gpg_error (GPG_ERR_BAD_SIGNATURE);
+      TRACE (TRACE_DEBUG, "MDC %s\n", rc ? "bad" : "good");
+      wipememory (digest, sizeof digest);
+    }
 
 leave:
   release_dfx_context(dfx);
@@ -625,14 +637,14 @@ static size_t
 fill_buffer(decode_filter_ctx_t dfx, iobuf_t stream,
             byte *buffer, size_t nbytes, size_t offset)
 {
-  printf("fill_buffer\n");
+  TRACE(TRACE_DEBUG, "fill_buffer\n");
   size_t nread = offset;
   size_t curr;
   int ret;
 
   if (dfx->partial)
   {
-      printf("dfx->partial nread=%zu nbytes=%zu\n", nread, nbytes);
+      TRACE(TRACE_DEBUG, "dfx->partial nread=%zu nbytes=%zu\n", nread, nbytes);
     while (nread < nbytes)
     {
       curr = nbytes - nread;
@@ -672,380 +684,400 @@ fill_buffer(decode_filter_ctx_t dfx, iobuf_t stream,
   return nread;
 }
 
-// /* The core of the AEAD decryption.  This is the underflow function of
-//  * the aead_decode_filter.  */
-// static gpg_error_t
-// aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
-// {
-//   const size_t size = *ret_len; /* The allocated size of BUF.  */
-//   gpg_error_t err;
-//   size_t totallen = 0; /* The number of bytes to return on success or EOF.  */
-//   size_t off = 0;      /* The offset into the buffer.  */
-//   size_t len;          /* The current number of bytes in BUF+OFF.  */
-
-//   printf (size > 48); /* Our code requires at least this size.  */
-
-//   /* Copy the rest from the last call of this function into BUF.  */
-//   len = dfx->holdbacklen;
-//   dfx->holdbacklen = 0;
-//   memcpy (buf, dfx->holdback, len);
-
-//   if (DBG_FILTER)
-//     printf ("aead_underflow: size=%zu len=%zu%s%s\n", size, len,
-//                dfx->partial? " partial":"", dfx->eof_seen? " eof":"");
-
-//   /* Read and fill up BUF.  We need to watch out for an EOF so that we
-//    * can detect the last chunk which is commonly shorter than the
-//    * chunksize.  After the last data byte from the last chunk 32 more
-//    * bytes are expected for the last chunk's tag and the following
-//    * final chunk's tag.  To detect the EOF we need to try reading at least
-//    * one further byte; however we try to read 16 extra bytes to avoid
-//    * single byte reads in some lower layers.  The outcome is that we
-//    * have up to 48 extra extra octets which we will later put into the
-//    * holdback buffer for the next invocation (which handles the EOF
-//    * case).  */
-//   len = fill_buffer (dfx, a, buf, size, len);
-//   if (len < 32)
-//     {
-//       /* Not enough data for the last two tags.  */
-//       err = gpg_error (GPG_ERR_TRUNCATED);
-//       goto leave;
-//     }
-//   if (dfx->eof_seen)
-//     {
-//       /* If have seen an EOF we copy only the last two auth tags into
-//        * the holdback buffer.  */
-//       dfx->holdbacklen = 32;
-//       memcpy (dfx->holdback, buf+len-32, 32);
-//       len -= 32;
-//     }
-//   else
-//     {
-//       /* If have not seen an EOF we copy the entire extra 48 bytes
-//        * into the holdback buffer for processing at the next call of
-//        * this function.  */
-//       dfx->holdbacklen = len > 48? 48 : len;
-//       memcpy (dfx->holdback, buf+len-dfx->holdbacklen, dfx->holdbacklen);
-//       len -= dfx->holdbacklen;
-//     }
-//   /* printf (dfx->holdback, dfx->holdbacklen, "holdback:"); */
-
-//   /* Decrypt the buffer.  This first requires a loop to handle the
-//    * case when a chunk ends within the buffer.  */
-//   if (DBG_FILTER)
-//     printf ("decrypt: chunklen=%ju total=%ju size=%zu len=%zu%s\n",
-//                dfx->chunklen, dfx->total, size, len,
-//                dfx->eof_seen? " eof":"");
-
-//   while (len && dfx->chunklen + len >= dfx->chunksize)
-//     {
-//       size_t n = dfx->chunksize - dfx->chunklen;
-//       byte tagbuf[16];
-
-//       if (DBG_FILTER)
-//         printf ("chunksize will be reached: n=%zu\n", n);
-
-//       if (!dfx->chunklen)
-//         {
-//           /* First data for this chunk - prepare.  */
-//           err = aead_set_nonce_and_ad (dfx, 0);
-//           if (err)
-//             goto leave;
-//         }
-
-//       /* printf (buf, n, "ciph:"); */
-//       gcry_cipher_final (dfx->cipher_hd);
-//       err = gcry_cipher_decrypt (dfx->cipher_hd, buf+off, n, NULL, 0);
-//       if (err)
-//         {
-//           printf ("gcry_cipher_decrypt failed (1): %s\n",
-//                      gpg_strerror (err));
-//           goto leave;
-//         }
-//       /* printf (buf, n, "plai:"); */
-//       totallen += n;
-//       dfx->chunklen += n;
-//       dfx->total += n;
-//       off += n;
-//       len -= n;
-
-//       if (DBG_FILTER)
-//         printf ("ndecrypted: %zu (nchunk=%ju) bytes left: %zu at off=%zu\n",
-//                    totallen, dfx->chunklen, len, off);
-
-//       /* Check the tag.  */
-//       if (len < 16)
-//         {
-//           /* The tag is not entirely in the buffer.  Read the rest of
-//            * the tag from the holdback buffer.  Then shift the holdback
-//            * buffer and fill it up again.  */
-//           memcpy (tagbuf, buf+off, len);
-//           memcpy (tagbuf + len, dfx->holdback, 16 - len);
-//           dfx->holdbacklen -= 16-len;
-//           memmove (dfx->holdback, dfx->holdback + (16-len), dfx->holdbacklen);
-
-//           if (dfx->eof_seen)
-//             {
-//               /* We should have the last chunk's tag in TAGBUF and the
-//                * final tag in HOLDBACKBUF.  */
-//               if (len || dfx->holdbacklen != 16)
-//                 {
-//                   /* Not enough data for the last two tags.  */
-//                   err = gpg_error (GPG_ERR_TRUNCATED);
-//                   goto leave;
-//                 }
-//             }
-//           else
-//             {
-//               len = 0;
-//               dfx->holdbacklen = fill_buffer (dfx, a, dfx->holdback, 48,
-//                                               dfx->holdbacklen);
-//               if (dfx->holdbacklen < 32)
-//                 {
-//                   /* Not enough data for the last two tags.  */
-//                   err = gpg_error (GPG_ERR_TRUNCATED);
-//                   goto leave;
-//                 }
-//             }
-//         }
-//       else /* We already have the full tag.  */
-//         {
-//           memcpy (tagbuf, buf+off, 16);
-//           /* Remove that tag from the output.  */
-//           memmove (buf + off, buf + off + 16, len - 16);
-//           len -= 16;
-//         }
-//       err = aead_checktag (dfx, 0, tagbuf);
-//       if (err)
-//         goto leave;
-//       dfx->chunklen = 0;
-//       dfx->chunkindex++;
-
-//       continue;
-//     }
-
-//   /* The bulk decryption of our buffer.  */
-//   if (len)
-//     {
-//       if (!dfx->chunklen)
-//         {
-//           /* First data for this chunk - prepare.  */
-//           err = aead_set_nonce_and_ad (dfx, 0);
-//           if (err)
-//             goto leave;
-//         }
-
-//       if (dfx->eof_seen)
-//         {
-//           /* This is the last block of the last chunk.  Its length may
-//            * not be a multiple of the block length.  */
-//           gcry_cipher_final (dfx->cipher_hd);
-//         }
-//       err = gcry_cipher_decrypt (dfx->cipher_hd, buf + off, len, NULL, 0);
-//       if (err)
-//         {
-//           printf ("gcry_cipher_decrypt failed (2): %s\n",
-//                      gpg_strerror (err));
-//           goto leave;
-//         }
-//       totallen += len;
-//       dfx->chunklen += len;
-//       dfx->total += len;
-//       if (DBG_FILTER)
-//         printf ("ndecrypted: %zu (nchunk=%ju)\n", totallen, dfx->chunklen);
-//     }
-
-//   if (dfx->eof_seen)
-//     {
-
-//       if (dfx->chunklen)
-//         {
-//           if (DBG_FILTER)
-//             printf ("eof seen: holdback has the last and final tag\n");
-//           printf (dfx->holdbacklen >= 32);
-//           err = aead_checktag (dfx, 0, dfx->holdback);
-//           if (err)
-//             goto leave;
-//           dfx->chunklen = 0;
-//           dfx->chunkindex++;
-//           off = 16;
-//         }
-//       else
-//         {
-//           if (DBG_FILTER)
-//             printf ("eof seen: holdback has the final tag\n");
-//           printf (dfx->holdbacklen >= 16);
-//           off = 0;
-//         }
-
-//       /* Check the final chunk.  */
-//       err = aead_set_nonce_and_ad (dfx, 1);
-//       if (err)
-//         goto leave;
-//       gcry_cipher_final (dfx->cipher_hd);
-//       /* Decrypt an empty string (using HOLDBACK as a dummy).  */
-//       err = gcry_cipher_decrypt (dfx->cipher_hd, dfx->holdback, 0, NULL, 0);
-//       if (err)
-//         {
-//           printf ("gcry_cipher_decrypt failed (final): %s\n",
-//                      gpg_strerror (err));
-//           goto leave;
-//         }
-//       err = aead_checktag (dfx, 1, dfx->holdback+off);
-//       if (err)
-//         goto leave;
-//       err = gpg_error (GPG_ERR_EOF);
-//     }
-
-//  leave:
-//   if (DBG_FILTER)
-//     printf ("aead_underflow: returning %zu (%s)\n",
-//                totallen, gpg_strerror (err));
-
-//   /* In case of an auth error we map the error code to the same as
-//    * used by the MDC decryption.  */
-//   if (gpg_err_code (err) == GPG_ERR_CHECKSUM)
-//     err = gpg_error (GPG_ERR_BAD_SIGNATURE);
-
-//   /* In case of an error we better wipe out the buffer than to convey
-//    * partly decrypted data.  */
-//   if (err && gpg_err_code (err) != GPG_ERR_EOF)
-//     memset (buf, 0, size);
-
-//   *ret_len = totallen;
-
-//   return err;
-// }
-
-// /* The IOBUF filter used to decrypt AEAD encrypted data.  */
-// static int
-// aead_decode_filter (void *opaque, int control, IOBUF a,
-//                     byte *buf, size_t *ret_len)
-// {
-//   decode_filter_ctx_t dfx = opaque;
-//   int rc = 0;
-
-//   if ( control == IOBUFCTRL_UNDERFLOW && dfx->eof_seen )
-//     {
-//       *ret_len = 0;
-//       rc = -1;
-//     }
-//   else if ( control == IOBUFCTRL_UNDERFLOW )
-//     {
-//       printf (a);
-
-//       rc = aead_underflow (dfx, a, buf, ret_len);
-//       if (gpg_err_code (rc) == GPG_ERR_EOF)
-//         rc = -1; /* We need to use the old convention in the filter.  */
-
-//     }
-//   else if ( control == IOBUFCTRL_FREE )
-//     {
-//       release_dfx_context (dfx);
-//     }
-//   else if ( control == IOBUFCTRL_DESC )
-//     {
-//       mem2str (buf, "aead_decode_filter", *ret_len);
-//     }
-
-//   return rc;
-// }
-
-// static int
-// mdc_decode_filter (void *opaque, int control, IOBUF a,
-//                    byte *buf, size_t *ret_len)
-// {
-//   decode_filter_ctx_t dfx = opaque;
-//   size_t n, size = *ret_len;
-//   int rc = 0;
-
-//   /* Note: We need to distinguish between a partial and a fixed length
-//      packet.  The first is the usual case as created by GPG.  However
-//      for short messages the format degrades to a fixed length packet
-//      and other implementations might use fixed length as well.  Only
-//      looking for the EOF on fixed data works only if the encrypted
-//      packet is not followed by other data.  This used to be a long
-//      standing bug which was fixed on 2009-10-02.  */
-
-//   if ( control == IOBUFCTRL_UNDERFLOW && dfx->eof_seen )
-//     {
-//       *ret_len = 0;
-//       rc = -1;
-//     }
-//   else if( control == IOBUFCTRL_UNDERFLOW )
-//     {
-//       printf (a);
-//       printf (size > 44); /* Our code requires at least this size.  */
-
-//       /* Get at least 22 bytes and put it ahead in the buffer.  */
-//       n = fill_buffer (dfx, a, buf, 44, 22);
-//       if (n == 44)
-//         {
-//           /* We have enough stuff - flush the deferred stuff.  */
-//           if ( !dfx->holdbacklen )  /* First time. */
-//             {
-//               memcpy (buf, buf+22, 22);
-//               n = 22;
-// 	    }
-//           else
-//             {
-//               memcpy (buf, dfx->holdback, 22);
-// 	    }
-//           /* Fill up the buffer. */
-//           n = fill_buffer (dfx, a, buf, size, n);
-
-//           /* Move the trailing 22 bytes back to the holdback buffer.  We
-//              have at least 44 bytes thus a memmove is not needed.  */
-//           n -= 22;
-//           memcpy (dfx->holdback, buf+n, 22 );
-//           dfx->holdbacklen = 22;
-// 	}
-//       else if ( !dfx->holdbacklen )  /* EOF seen but empty holdback buffer. */
-//         {
-//           /* This is bad because it means an incomplete hash. */
-//           n -= 22;
-//           memcpy (buf, buf+22, n );
-//           dfx->eof_seen = 2; /* EOF with incomplete hash.  */
-// 	}
-//       else  /* EOF seen (i.e. read less than 22 bytes). */
-//         {
-//           memcpy (buf, dfx->holdback, 22 );
-//           n -= 22;
-//           memcpy (dfx->holdback, buf+n, 22 );
-//           dfx->eof_seen = 1; /* Normal EOF. */
-// 	}
-
-//       if ( n )
-//         {
-//           if ( dfx->cipher_hd )
-//             gcry_cipher_decrypt (dfx->cipher_hd, buf, n, NULL, 0);
-//           // if ( dfx->mdc_hash )
-//           //   gcry_md_write (dfx->mdc_hash, buf, n);
-// 	}
-//       else
-//         {
-//           printf ( dfx->eof_seen );
-//           rc = -1; /* Return EOF.  */
-// 	}
-//       *ret_len = n;
-//     }
-//   else if ( control == IOBUFCTRL_FREE )
-//     {
-//       release_dfx_context (dfx);
-//     }
-//   else if ( control == IOBUFCTRL_DESC )
-//     {
-//       mem2str (buf, "mdc_decode_filter", *ret_len);
-//     }
-//   return rc;
-// }
+/* The core of the AEAD decryption.  This is the underflow function of
+ * the aead_decode_filter.  */
+static gpg_error_t
+aead_underflow (decode_filter_ctx_t dfx, iobuf_t a, byte *buf, size_t *ret_len)
+{
+  const size_t size = *ret_len; /* The allocated size of BUF.  */
+  gpg_error_t err = 0;
+  size_t totallen = 0; /* The number of bytes to return on success or EOF.  */
+  size_t off = 0;      /* The offset into the buffer.  */
+  size_t len;          /* The current number of bytes in BUF+OFF.  */
+
+  if (size <= 48) /* Our code requires at least this size.  */
+    {
+      *ret_len = 0;
+      return gpg_error (GPG_ERR_BUFFER_TOO_SHORT);
+    }
+
+  /* Copy the rest from the last call of this function into BUF.  */
+  len = dfx->holdbacklen;
+  dfx->holdbacklen = 0;
+  memcpy (buf, dfx->holdback, len);
+
+  TRACE (TRACE_DEBUG, "aead_underflow: size=%zu len=%zu%s%s\n", size, len,
+         dfx->partial? " partial":"", dfx->eof_seen? " eof":"");
+
+  /* Read and fill up BUF.  We need to watch out for an EOF so that we
+   * can detect the last chunk which is commonly shorter than the
+   * chunksize.  After the last data byte from the last chunk 32 more
+   * bytes are expected for the last chunk's tag and the following
+   * final chunk's tag.  To detect the EOF we need to try reading at least
+   * one further byte; however we try to read 16 extra bytes to avoid
+   * single byte reads in some lower layers.  The outcome is that we
+   * have up to 48 extra extra octets which we will later put into the
+   * holdback buffer for the next invocation (which handles the EOF
+   * case).  */
+  len = fill_buffer (dfx, a, buf, size, len);
+  if (len < 32)
+    {
+      /* Not enough data for the last two tags.  */
+      err = gpg_error (GPG_ERR_TRUNCATED);
+      goto leave;
+    }
+  if (dfx->eof_seen)
+    {
+      /* If have seen an EOF we copy only the last two auth tags into
+       * the holdback buffer.  */
+      dfx->holdbacklen = 32;
+      memcpy (dfx->holdback, buf+len-32, 32);
+      len -= 32;
+    }
+  else
+    {
+      /* If have not seen an EOF we copy the entire extra 48 bytes
+       * into the holdback buffer for processing at the next call of
+       * this function.  */
+      dfx->holdbacklen = len > 48? 48 : len;
+      memcpy (dfx->holdback, buf+len-dfx->holdbacklen, dfx->holdbacklen);
+      len -= dfx->holdbacklen;
+    }
+
+  /* Decrypt the buffer.  This first requires a loop to handle the
+   * case when a chunk ends within the buffer.  */
+  TRACE (TRACE_DEBUG, "decrypt: chunklen=%u total=%u size=%zu len=%zu%s\n",
+         (unsigned int)dfx->chunklen, (unsigned int)dfx->total, size, len,
+         dfx->eof_seen? " eof":"");
+
+  while (len && dfx->chunklen + len >= dfx->chunksize)
+    {
+      size_t n = dfx->chunksize - dfx->chunklen;
+      byte tagbuf[16];
+
+      if (!dfx->chunklen)
+        {
+          /* First data for this chunk - prepare.  */
+          err = aead_set_nonce_and_ad (dfx, 0);
+          if (err)
+            goto leave;
+        }
+
+      _gcry_cipher_final (dfx->cipher_hd);
+      err = gpg_error (_gcry_cipher_decrypt (dfx->cipher_hd, buf+off, n,
+                                             NULL, 0));
+      if (err)
+        {
+          TRACE (TRACE_ERROR, "_gcry_cipher_decrypt failed (1): %d\n", err);
+          goto leave;
+        }
+      totallen += n;
+      dfx->chunklen += n;
+      dfx->total += n;
+      off += n;
+      len -= n;
+
+      /* Check the tag.  */
+      if (len < 16)
+        {
+          /* The tag is not entirely in the buffer.  Read the rest of
+           * the tag from the holdback buffer.  Then shift the holdback
+           * buffer and fill it up again.  */
+          memcpy (tagbuf, buf+off, len);
+          memcpy (tagbuf + len, dfx->holdback, 16 - len);
+          dfx->holdbacklen -= 16-len;
+          memmove (dfx->holdback, dfx->holdback + (16-len), dfx->holdbacklen);
+
+          if (dfx->eof_seen)
+            {
+              /* We should have the last chunk's tag in TAGBUF and the
+               * final tag in HOLDBACKBUF.  */
+              if (len || dfx->holdbacklen != 16)
+                {
+                  /* Not enough data for the last two tags.  */
+                  err = gpg_error (GPG_ERR_TRUNCATED);
+                  goto leave;
+                }
+            }
+          else
+            {
+              len = 0;
+              dfx->holdbacklen = fill_buffer (dfx, a, dfx->holdback, 48,
+                                              dfx->holdbacklen);
+              if (dfx->holdbacklen < 32)
+                {
+                  /* Not enough data for the last two tags.  */
+                  err = gpg_error (GPG_ERR_TRUNCATED);
+                  goto leave;
+                }
+              if (dfx->eof_seen)
+                {
+                  /* The refill hit the EOF, so everything before the
+                   * two tags belongs to the next chunk.  There is room
+                   * for it: we held back 48 bytes from BUF.  */
+                  len = dfx->holdbacklen - 32;
+                  memcpy (buf + off, dfx->holdback, len);
+                  memmove (dfx->holdback, dfx->holdback + len, 32);
+                  dfx->holdbacklen = 32;
+                }
+            }
+        }
+      else /* We already have the full tag.  */
+        {
+          memcpy (tagbuf, buf+off, 16);
+          /* Remove that tag from the output.  */
+          memmove (buf + off, buf + off + 16, len - 16);
+          len -= 16;
+        }
+      err = aead_checktag (dfx, 0, tagbuf);
+      if (err)
+        goto leave;
+      dfx->chunklen = 0;
+      dfx->chunkindex++;
+    }
+
+  /* The bulk decryption of our buffer.  */
+  if (len)
+    {
+      if (!dfx->chunklen)
+        {
+          /* First data for this chunk - prepare.  */
+          err = aead_set_nonce_and_ad (dfx, 0);
+          if (err)
+            goto leave;
+        }
+
+      if (dfx->eof_seen)
+        {
+          /* This is the last block of the last chunk.  Its length may
+           * not be a multiple of the block length.  */
+          _gcry_cipher_final (dfx->cipher_hd);
+        }
+      err = gpg_error (_gcry_cipher_decrypt (dfx->cipher_hd, buf + off, len,
+                                             NULL, 0));
+      if (err)
+        {
+          TRACE (TRACE_ERROR, "_gcry_cipher_decrypt failed (2): %d\n", err);
+          goto leave;
+        }
+      totallen += len;
+      dfx->chunklen += len;
+      dfx->total += len;
+    }
+
+  if (dfx->eof_seen)
+    {
+      if (dfx->chunklen)
+        {
+          /* The holdback buffer has the last and the final tag.  */
+          if (dfx->holdbacklen < 32)
+            {
+              err = gpg_error (GPG_ERR_TRUNCATED);
+              goto leave;
+            }
+          err = aead_checktag (dfx, 0, dfx->holdback);
+          if (err)
+            goto leave;
+          dfx->chunklen = 0;
+          dfx->chunkindex++;
+          off = 16;
+        }
+      else
+        {
+          /* The holdback buffer has only the final tag.  */
+          if (dfx->holdbacklen < 16)
+            {
+              err = gpg_error (GPG_ERR_TRUNCATED);
+              goto leave;
+            }
+          off = 0;
+        }
+
+      /* Check the final chunk.  */
+      err = aead_set_nonce_and_ad (dfx, 1);
+      if (err)
+        goto leave;
+      _gcry_cipher_final (dfx->cipher_hd);
+      /* Decrypt an empty string (using HOLDBACK as a dummy).  */
+      err = gpg_error (_gcry_cipher_decrypt (dfx->cipher_hd, dfx->holdback, 0,
+                                             NULL, 0));
+      if (err)
+        {
+          TRACE (TRACE_ERROR, "_gcry_cipher_decrypt failed (final): %d\n",
+                 err);
+          goto leave;
+        }
+      err = aead_checktag (dfx, 1, dfx->holdback+off);
+      if (err)
+        goto leave;
+      err = gpg_error (GPG_ERR_EOF);
+    }
+
+ leave:
+  TRACE (TRACE_DEBUG, "aead_underflow: returning %zu (%d)\n", totallen, err);
+
+  /* In case of an auth error we map the error code to the same as
+   * used by the MDC decryption.  */
+  if (gpg_err_code (err) == GPG_ERR_CHECKSUM)
+    err = gpg_error (GPG_ERR_BAD_SIGNATURE);
+
+  /* In case of an error we better wipe out the buffer than to convey
+   * partly decrypted data.  */
+  if (err && gpg_err_code (err) != GPG_ERR_EOF)
+    {
+      memset (buf, 0, size);
+      totallen = 0;
+    }
+
+  *ret_len = totallen;
+
+  return err;
+}
+
+/* The IOBUF filter used to decrypt AEAD encrypted data.  */
+static int
+aead_decode_filter (void *opaque, int control, IOBUF a,
+                    byte *buf, size_t *ret_len)
+{
+  decode_filter_ctx_t dfx = opaque;
+  int rc = 0;
+
+  if ( control == IOBUFCTRL_UNDERFLOW && (dfx->eof_seen || dfx->aead_err) )
+    {
+      *ret_len = 0;
+      rc = -1;
+    }
+  else if ( control == IOBUFCTRL_UNDERFLOW )
+    {
+      rc = aead_underflow (dfx, a, buf, ret_len);
+      if (gpg_err_code (rc) == GPG_ERR_EOF)
+        rc = -1; /* We need to use the old convention in the filter.  */
+      else if (rc)
+        dfx->aead_err = rc;
+    }
+  else if ( control == IOBUFCTRL_FREE )
+    {
+      release_dfx_context (dfx);
+    }
+  else if ( control == IOBUFCTRL_DESC )
+    {
+      // mem2str (buf, "aead_decode_filter", *ret_len);
+    }
+
+  return rc;
+}
+
+/* Decrypt N bytes at BUF in place and feed them to the MDC hash.  The
+ * two passes alternate over slices small enough to stay in the L1
+ * data cache, so the hash reads the plaintext the cipher just wrote
+ * instead of fetching the whole buffer again.  With more than one core
+ * a slice is CFB_SMP_MIN_BYTES for each of them, so that the cipher
+ * can split it (an 8 KiB chunk on raspi2b).  */
+#define MDC_SLICE 2048
+
+static void
+mdc_decrypt (decode_filter_ctx_t dfx, byte *buf, size_t n)
+{
+  unsigned int cpus = smp_cpus ();
+  size_t slice = cpus > 1 ? cpus * CFB_SMP_MIN_BYTES : MDC_SLICE;
+  size_t k;
+
+  for (; n; buf += k, n -= k)
+    {
+      k = n < slice ? n : slice;
+      _gcry_cipher_decrypt (dfx->cipher_hd, buf, k, NULL, 0);
+      SHA1Update (dfx->mdc_hash, buf, k);
+    }
+}
+
+static int
+mdc_decode_filter (void *opaque, int control, IOBUF a,
+                   byte *buf, size_t *ret_len)
+{
+  decode_filter_ctx_t dfx = opaque;
+  size_t n, size = *ret_len;
+  int rc = 0;
+
+  /* Note: We need to distinguish between a partial and a fixed length
+     packet.  The first is the usual case as created by GPG.  However
+     for short messages the format degrades to a fixed length packet
+     and other implementations might use fixed length as well.  Only
+     looking for the EOF on fixed data works only if the encrypted
+     packet is not followed by other data.  This used to be a long
+     standing bug which was fixed on 2009-10-02.  */
+
+  if ( control == IOBUFCTRL_UNDERFLOW && dfx->eof_seen )
+    {
+      *ret_len = 0;
+      rc = -1;
+    }
+  else if( control == IOBUFCTRL_UNDERFLOW )
+    {
+      TRACE (TRACE_DEBUG, "mdc_decode_filter size=%d\n", (int)size);
+      if (size <= 44) /* Our code requires at least this size.  */
+        return gpg_error (GPG_ERR_BUFFER_TOO_SHORT);
+
+      /* Get at least 22 bytes and put it ahead in the buffer.  */
+      n = fill_buffer (dfx, a, buf, 44, 22);
+      if (n == 44)
+        {
+          /* We have enough stuff - flush the deferred stuff.  */
+          if ( !dfx->holdbacklen )  /* First time. */
+            {
+              memcpy (buf, buf+22, 22);
+              n = 22;
+	    }
+          else
+            {
+              memcpy (buf, dfx->holdback, 22);
+	    }
+          /* Fill up the buffer. */
+          n = fill_buffer (dfx, a, buf, size, n);
+
+          /* Move the trailing 22 bytes back to the holdback buffer.  We
+             have at least 44 bytes thus a memmove is not needed.  */
+          n -= 22;
+          memcpy (dfx->holdback, buf+n, 22 );
+          dfx->holdbacklen = 22;
+	}
+      else if ( !dfx->holdbacklen )  /* EOF seen but empty holdback buffer. */
+        {
+          /* This is bad because it means an incomplete hash. */
+          n -= 22;
+          memmove (buf, buf+22, n );
+          dfx->eof_seen = 2; /* EOF with incomplete hash.  */
+	}
+      else  /* EOF seen (i.e. read less than 22 bytes). */
+        {
+          memcpy (buf, dfx->holdback, 22 );
+          n -= 22;
+          memcpy (dfx->holdback, buf+n, 22 );
+          dfx->eof_seen = 1; /* Normal EOF. */
+	}
+
+      if ( n )
+        mdc_decrypt (dfx, buf, n);
+      else
+        rc = -1; /* Return EOF.  */
+      *ret_len = n;
+    }
+  else if ( control == IOBUFCTRL_FREE )
+    {
+      release_dfx_context (dfx);
+    }
+  else if ( control == IOBUFCTRL_DESC )
+    {
+      // mem2str (buf, "mdc_decode_filter", *ret_len);
+    }
+  return rc;
+}
 
 static int
 decode_filter(void *opaque, int control, IOBUF a, byte *buf, size_t *ret_len)
 {
     decode_filter_ctx_t fc = opaque;
 
-  printf("decode_filter control %d, ret_len=%d len=%d\n",control,*ret_len, fc->length);
+  TRACE(TRACE_DEBUG, "decode_filter control %d, ret_len=%d len=%d\n",control,*ret_len, fc->length);
   size_t size = *ret_len;
   // size_t size = fc->length;//*ret_len;
   size_t n;
@@ -1053,19 +1085,19 @@ decode_filter(void *opaque, int control, IOBUF a, byte *buf, size_t *ret_len)
 
   if (control == IOBUFCTRL_UNDERFLOW && fc->eof_seen)
   {
-    printf("IOBUFCTRL_UNDERFLOW && fc->eof_seen\n");;
+    TRACE(TRACE_DEBUG, "IOBUFCTRL_UNDERFLOW && fc->eof_seen\n");
     *ret_len = 0;
     rc = -1;
   }
   else if (control == IOBUFCTRL_UNDERFLOW)
   {
-    printf("control == IOBUFCTRL_UNDERFLOW\n");
+    TRACE(TRACE_DEBUG, "control == IOBUFCTRL_UNDERFLOW\n");
 
     n = fill_buffer(fc, a, buf, size, 0);
     if (n)
     {
       if (fc->cipher_hd)
-          printf("cipher_hd is allocated\n");
+          TRACE(TRACE_DEBUG, "cipher_hd is allocated\n");
         _gcry_cipher_decrypt (fc->cipher_hd, buf, n, NULL, 0);
         // _gcry_cipher_decrypt (fc->cipher_hd, buf, n, NULL, size);
         // printf("cipher_hd is allocated\n");
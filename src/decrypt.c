@@ -38,36 +38,39 @@
 #include "fwddecl.h"
 #include "printf.h"
 #include "memory.h"
+#include "trace.h"
+#include "filter.h"
+#include "prof.h"
 
 
 int decrypt_memory(ctrl_t ctrl, const unsigned char* data, size_t length) {
     printf("decrypt_memory\n");
+    PROF_BEGIN(PROF_DECRYPT);
     // printf("Decrypt params:\n");
     // printf("Data ptr: %p\n", (void*)data);
     // printf("Session key: %s\n", ctrl->session_key);
     ctrl->enc_length=length;
+    /* Each call is a new message */
+    reset_literals_seen();
     // printf("Decrypt params: %d\n",ctrl->enc_length);
     iobuf_t a;
     int rc;
     gnupg_fd_t fp;
     file_filter_ctx_t *fcx;
+    armor_filter_context_t *afx = NULL;
     size_t len = 0;
     int print_only = 0;
 
-    const char *opentype = "rb";
-    const char *fname = NULL;
-    int fd = 0;
-    int use = 0;
-    /* Create input iobuf from memory */
-    a = iobuf_temp_with_content((const char*)data, length);
+    const char *fname = "[memory]";  /* strlen/strcpy/xstrdup need a name */
+    /* Read the message in place; DATA outlives the pipeline.  */
+    a = iobuf_temp_with_buffer(data, length);
     
     if (!a) {
+        PROF_END(PROF_DECRYPT, 0);
         return gpg_error_from_syserror();
     }
-    iobuf_fdopen (translate_file_handle (fd, use == IOBUF_INPUT ? 0 : 1),
-			 opentype);
-
-	  fp = fd_cache_open (NULL, opentype);
+    /* Nothing to open: file_filter reports EOF without a file.  */
+    fp = GNUPG_INVALID_FD;
     fcx = xmalloc (sizeof *fcx + strlen (fname));
     fcx->fp = fp;
     fcx->print_only_name = print_only;
@@ -90,12 +93,32 @@ int decrypt_memory(ctrl_t ctrl, const unsigned char* data, size_t length) {
     //     return rc;
     // }
 
+    /* The whole message is in memory, so the peek cannot block.  */
+    if (use_armor_filter(a)) {
+        afx = new_armor_context();
+        if (!afx || push_armor_filter(afx, a)) {
+            rc = afx ? gpg_error(GPG_ERR_GENERAL) : gpg_error_from_syserror();
+            release_armor_context(afx);
+            iobuf_close(a);
+            PROF_END(PROF_DECRYPT, 0);
+            return rc;
+        }
+    }
+
     /* Process encryption packets */
     rc = proc_encryption_packets(ctrl, NULL, a);
+    /* A broken armor cuts the packets short or corrupts them; report
+       the cause rather than what the parser made of it.  */
+    if (afx && afx->err)
+        rc = afx->err;
     // return -1;
     // printf("\n\nEND decrypt_memory\n\n");
     /* Clean up */
-    // iobuf_close(a);
+    iobuf_close(a);
+    release_armor_context(afx);
+    PROF_END(PROF_DECRYPT, length);
+    /* Print what the message traced before returning to the caller */
+    trace_drain();
     return rc;
 }
 
@@ -109,61 +132,48 @@ int decrypt_memory(ctrl_t ctrl, const unsigned char* data, size_t length) {
 int
 decrypt_message (ctrl_t ctrl, const char *filename)
 {
-  printf("decrypt_message filename:%s\n",filename);
   IOBUF fp;
-//   armor_filter_context_t *afx = NULL;
-//   progress_filter_context_t *pfx;
+  armor_filter_context_t *afx = NULL;
   int rc;
 
-//   pfx = new_progress_context ();
+  PROF_BEGIN(PROF_DECRYPT);
+  /* Each call is a new message */
+  reset_literals_seen ();
 
-  /* Open the message file.  */
+  /* Open the message file; it is streamed through file_filter
+     (semihosting on the target, semihost.c) and never held whole.  */
   fp = iobuf_open (filename);
-//   if (fp && is_secured_file (iobuf_get_fd (fp)))
-//     {
-//       iobuf_close (fp);
-//       fp = NULL;
-// //      gpg_err_set_errno (-1);//EPERM);
-//     }else{
-//       printf("ELSE\n");
-//     }
-
-// instead:
-iobuf_get_fd (fp);
   if ( !fp )
     {
-      rc = gpg_error_from_syserror ();
-//      printf (("can't open '%s': %s\n"), print_fname_stdin(filename),
-                 // gpg_strerror (rc));
-    //   release_progress_context (pfx);
+      rc = gpg_error (GPG_ERR_ENOENT);
+      printf ("can't open '%s'\n", filename);
+      PROF_END(PROF_DECRYPT, 0);
       return rc;
     }
+  iobuf_ioctl (fp, IOBUF_IOCTL_NO_CACHE, 1, NULL);
 
-//   handle_progress (pfx, fp, filename);
-
-//   if ( !opt.no_armor )
-//     {
-//     //   if ( use_armor_filter( fp ) )
-//         {
-//         //   afx = new_armor_context ();
-//         //   push_armor_filter ( afx, fp );
-// 	}
-//     }
+  if (use_armor_filter (fp))
+    {
+      afx = new_armor_context ();
+      if (!afx || push_armor_filter (afx, fp))
+        {
+          rc = afx ? gpg_error (GPG_ERR_GENERAL) : gpg_error_from_syserror ();
+          release_armor_context (afx);
+          iobuf_close (fp);
+          PROF_END(PROF_DECRYPT, 0);
+          return rc;
+        }
+    }
 
-//   if (!opt.outfile)
-//     {
-//       opt.outfile = "-";
-//       opt.flags.dummy_outfile = 1;
-//     }
-//   else
-//     opt.flags.dummy_outfile = 0;
-  printf("opt.outfile:%s\n",opt.outfile);
-  rc = proc_encryption_packets (ctrl, NULL, fp );
-//   if (opt.flags.dummy_outfile)
-//     opt.outfile = NULL;
+  ctrl->enc_length = iobuf_get_filelength (fp);
+  rc = proc_encryption_packets (ctrl, NULL, fp);
+  /* As in decrypt_memory.  */
+  if (afx && afx->err)
+    rc = afx->err;
 
   iobuf_close (fp);
-//   release_armor_context (afx);
-//   release_progress_context (pfx);
+  release_armor_context (afx);
+  PROF_END(PROF_DECRYPT, ctrl->enc_length);
+  trace_drain ();
   return rc;
 }
@@ -19,6 +19,8 @@
 #ifndef G10_DEK_H
 #define G10_DEK_H
 
+#include <stdint.h>
+
 typedef uint8_t byte;
 typedef struct
 {
@@ -0,0 +1,681 @@
+unsigned char encrypted_aes128_10k_gpg[] = {
+  0x8c, 0x0d, 0x04, 0x07, 0x03, 0x02, 0xd8, 0x93, 0xd0, 0x49, 0x39, 0xe6,
+  0xec, 0x2d, 0xff, 0xd2, 0xde, 0xf4, 0x01, 0x05, 0x09, 0xca, 0xe7, 0x89,
+  0x40, 0xb2, 0xff, 0xe0, 0xe8, 0x7a, 0xcf, 0x4e, 0xf6, 0xb1, 0x6f, 0x76,
+  0x60, 0x38, 0xa8, 0x7c, 0xb0, 0xf5, 0x14, 0xfb, 0x31, 0x10, 0xc9, 0x96,
+  0x67, 0x56, 0xd1, 0x68, 0xd5, 0xf8, 0x0a, 0x52, 0xd3, 0x8f, 0x59, 0x3f,
+  0xf7, 0xc8, 0x1c, 0x32, 0x2a, 0x9a, 0xe9, 0x7e, 0xe8, 0x3b, 0x18, 0x4f,
+  0x72, 0xf5, 0x7a, 0xb8, 0x07, 0xfa, 0xd7, 0x04, 0x5e, 0x21, 0xf1, 0x60,
+  0x78, 0xe8, 0x9c, 0xc8, 0xc7, 0x7c, 0xbc, 0x13, 0x16, 0x58, 0x86, 0x67,
+  0xd6, 0x8b, 0xa7, 0x85, 0xa7, 0x6d, 0x79, 0x93, 0x7a, 0xd0, 0x8c, 0x33,
+  0x73, 0x2d, 0x2f, 0x1e, 0x96, 0x17, 0xfe, 0xab, 0x5b, 0xd3, 0x67, 0x52,
+  0x6d, 0x14, 0x96, 0xa2, 0xd2, 0x9e, 0xc0, 0x5d, 0x99, 0x05, 0x1f, 0x1c,
+  0x7f, 0xc0, 0xc2, 0x4a, 0x17, 0x7b, 0x6a, 0x9a, 0xf8, 0x0c, 0xb1, 0x3f,
+  0x58, 0xf3, 0xfb, 0x7e, 0x22, 0x86, 0xd1, 0xf6, 0x5b, 0x6b, 0xe2, 0x3e,
+  0xa0, 0xce, 0xd1, 0xa8, 0xef, 0x9b, 0xac, 0x23, 0x37, 0x73, 0x86, 0x4e,
+  0x8b, 0xea, 0xfa, 0x8d, 0x11, 0x9f, 0x96, 0xc8, 0xb8, 0xa4, 0x0d, 0xd8,
+  0xfe, 0x39, 0x8e, 0x69, 0x4a, 0x66, 0xfc, 0x73, 0x37, 0x17, 0x4b, 0x4c,
+  0x97, 0xf4, 0x68, 0x1c, 0x60, 0x8a, 0x68, 0xa9, 0x6a, 0xc4, 0x05, 0x8d,
+  0x8b, 0x27, 0xa2, 0xef, 0xd2, 0xab, 0x0f, 0x14, 0x9d, 0xf4, 0x8c, 0x69,
+  0x65, 0x6e, 0xf7, 0xaa, 0x31, 0x96, 0x97, 0x44, 0x15, 0x32, 0x8b, 0xff,
+  0x56, 0x9e, 0x9e, 0x00, 0xdc, 0x57, 0xf1, 0x7e, 0x22, 0xf3, 0x5c, 0x9f,
+  0x70, 0xac, 0x82, 0x8b, 0x36, 0x54, 0x7a, 0x4f, 0x0c, 0xe8, 0xda, 0x7c,
+  0x4a, 0x9e, 0xcd, 0xd4, 0x65, 0x6c, 0x5c, 0x8a, 0x06, 0x26, 0x92, 0x5b,
+  0x04, 0x44, 0xcb, 0x05, 0xc4, 0x62, 0x62, 0x3b, 0xda, 0xa5, 0x8f, 0xfe,
+  0xcd, 0x04, 0x9c, 0x36, 0xfd, 0xab, 0x1e, 0x11, 0x8b, 0xfc, 0x11, 0x90,
+  0x68, 0x4f, 0x7b, 0xad, 0x31, 0x50, 0x99, 0x7c, 0x11, 0xb6, 0x20, 0x9a,
+  0xf3, 0xc2, 0x88, 0x04, 0x88, 0x49, 0xfe, 0x93, 0x65, 0x69, 0x88, 0x2b,
+  0x98, 0x4d, 0xed, 0x41, 0xe5, 0x1b, 0x76, 0xb2, 0xec, 0x74, 0x90, 0xc6,
+  0x49, 0x4c, 0x36, 0x91, 0xe5, 0x9c, 0xa0, 0x31, 0x0e, 0xc8, 0x21, 0x76,
+  0x66, 0xe5, 0x8e, 0x6f, 0xd1, 0x3f, 0xc8, 0x68, 0x20, 0xae, 0xe2, 0x01,
+  0xec, 0xe7, 0x21, 0xff, 0xec, 0x25, 0x3d, 0xd7, 0xe2, 0x48, 0xc3, 0x75,
+  0xdc, 0x3a, 0x59, 0xc9, 0xce, 0x25, 0x93, 0x85, 0xa4, 0x1c, 0x71, 0x6a,
+  0x53, 0x16, 0x3d, 0x34, 0x99, 0x93, 0xa5, 0x6e, 0xb1, 0x98, 0x57, 0x3a,
+  0x06, 0x42, 0x8a, 0x5d, 0x92, 0xc5, 0x97, 0x43, 0x57, 0x16, 0x1b, 0xb2,
+  0x30, 0xb5, 0xc9, 0xb9, 0xf7, 0x3d, 0xc5, 0x69, 0x70, 0x8d, 0x30, 0xe1,
+  0x4d, 0xd2, 0xca, 0x53, 0x30, 0x17, 0xa0, 0x48, 0x58, 0xe2, 0xfd, 0x3d,
+  0xb1, 0xbf, 0x0d, 0xc3, 0x76, 0xb3, 0xb1, 0x32, 0x90, 0xf6, 0xfa, 0xe3,
+  0x7f, 0xda, 0xab, 0x01, 0x8f, 0x04, 0xe4, 0x8d, 0x59, 0x3f, 0x5f, 0x4e,
+  0x2e, 0xb6, 0x0e, 0x72, 0x76, 0x97, 0xb9, 0xb8, 0xd6, 0x1b, 0xd7, 0x3b,
+  0x8c, 0x0a, 0x7f, 0xc3, 0x7d, 0xa5, 0xf9, 0x97, 0x47, 0xed, 0x99, 0x6a,
+  0x82, 0x92, 0x23, 0xac, 0xf2, 0xe9, 0x74, 0xb8, 0xcf, 0xb3, 0x34, 0x64,
+  0xa5, 0x6e, 0xb6, 0x79, 0xdd, 0x9b, 0x5d, 0x58, 0x1b, 0xfe, 0xf7, 0xd3,
+  0xf3, 0x4e, 0xed, 0x00, 0x2e, 0x6e, 0x33, 0xba, 0x23, 0xfc, 0x10, 0xea,
+  0xa6, 0x2b, 0xce, 0x55, 0x6e, 0xc2, 0xa1, 0xe8, 0x9a, 0x98, 0x1f, 0xee,
+  0x4e, 0x5f, 0xaf, 0xeb, 0xb7, 0x20, 0xc2, 0x6c, 0xc9, 0x11, 0x02, 0x88,
+  0xe5, 0x38, 0xf9, 0xc1, 0xe1, 0x56, 0x6e, 0xc8, 0xd6, 0xee, 0xc9, 0x8e,
+  0x2e, 0x4c, 0x70, 0xe8, 0xb5, 0xfc, 0x72, 0xa6, 0x4d, 0x8e, 0xf6, 0xa5,
+  0x09, 0xf0, 0x50, 0xb0, 0xaf, 0x80, 0x04, 0xe2, 0x21, 0x1d, 0x9e, 0x25,
+  0xf2, 0x3a, 0x82, 0x62, 0x17, 0x5c, 0xac, 0x37, 0xb1, 0xdf, 0xaa, 0xd2,
+  0x7d, 0xc9, 0xe2, 0xd3, 0x4f, 0xe8, 0x93, 0x7d, 0xc5, 0xd4, 0x9d, 0x47,
+  0xd7, 0x1c, 0xc5, 0x2e, 0x28, 0x0e, 0x72, 0xe3, 0x97, 0x75, 0xfc, 0x99,
+  0x8c, 0x4f, 0x5e, 0xab, 0x81, 0x53, 0xc7, 0xd2, 0xf0, 0xe4, 0x82, 0x85,
+  0x09, 0x14, 0xf1, 0x26, 0xc0, 0x18, 0x34, 0x8c, 0xb7, 0x0c, 0x6f, 0x40,
+  0x1e, 0x69, 0xd7, 0xf8, 0xfe, 0x99, 0xd6, 0x4f, 0xbe, 0xd2, 0xd3, 0x2a,
+  0x85, 0xa1, 0x41, 0x0e, 0x5a, 0xa0, 0x2d, 0x0f, 0x5d, 0x6c, 0xa0, 0x7d,
+  0x75, 0x48, 0x9a, 0x54, 0x5c, 0x7d, 0x4a, 0x76, 0x1c, 0x07, 0x5d, 0x71,
+  0xe0, 0x79, 0xd8, 0x49, 0xe2, 0x48, 0x08, 0x45, 0x6e, 0xf0, 0x40, 0x56,
+  0x8c, 0xa6, 0x3e, 0x39, 0xb5, 0x32, 0xbc, 0x51, 0x6b, 0x67, 0xd0, 0x29,
+  0x7e, 0x84, 0xe1, 0x06, 0xaf, 0xec, 0x88, 0xa7, 0xaf, 0x01, 0x9a, 0x6b,
+  0xa4, 0x16, 0xea, 0x61, 0x55, 0xe1, 0x7d, 0xad, 0x9d, 0xd2, 0x8b, 0xa4,
+  0xb3, 0xaf, 0xd1, 0xc8, 0xb2, 0x58, 0xd4, 0xdc, 0x7a, 0xa4, 0x08, 0xeb,
+  0x6e, 0x0b, 0x0f, 0x6d, 0x56, 0xaa, 0x7c, 0xe4, 0xec, 0x19, 0xea, 0xfc,
+  0x6d, 0x44, 0x7e, 0x89, 0xd7, 0x90, 0x0d, 0xe8, 0xd2, 0x82, 0x92, 0x4d,
+  0x25, 0x0c, 0x18, 0x5b, 0x09, 0x90, 0x56, 0xae, 0x1c, 0x68, 0x4d, 0x30,
+  0x12, 0x8b, 0x86, 0xef, 0xae, 0x77, 0xd2, 0xd5, 0xdd, 0x71, 0x4f, 0xe7,
+  0x8d, 0xe4, 0x95, 0xbd, 0x1c, 0xea, 0xd6, 0x1f, 0x8e, 0x6a, 0x42, 0x22,
+  0xe9, 0x10, 0x4d, 0xa7, 0xd6, 0xad, 0x35, 0x5c, 0x14, 0x33, 0x9d, 0x5f,
+  0xa5, 0x41, 0x10, 0xd7, 0x95, 0x1a, 0xcf, 0x91, 0x99, 0xd2, 0xa3, 0x57,
+  0xd0, 0x6e, 0xee, 0xc9, 0x8e, 0xf0, 0x4c, 0x91, 0x66, 0x65, 0x1c, 0xa9,
+  0xe8, 0x63, 0x71, 0xb6, 0x99, 0xc3, 0x6c, 0xeb, 0x52, 0xf0, 0x47, 0x8c,
+  0xd5, 0x02, 0xbe, 0x32, 0x69, 0x26, 0x1f, 0x09, 0x91, 0x3b, 0x57, 0xf1,
+  0x6c, 0x07, 0x19, 0x9a, 0x31, 0xb4, 0x26, 0x06, 0x07, 0xd9, 0xee, 0x15,
+  0xa7, 0xf7, 0x17, 0x17, 0xff, 0x5e, 0x5c, 0x64, 0x41, 0xd9, 0xa5, 0x18,
+  0xac, 0x10, 0xa2, 0xe2, 0x4f, 0x20, 0xaa, 0x4e, 0xad, 0x7b, 0xaa, 0x98,
+  0x40, 0x90, 0x7d, 0x2b, 0xd5, 0xd4, 0x28, 0x03, 0xa6, 0xbe, 0x92, 0x65,
+  0xde, 0x46, 0xc4, 0xd5, 0xd5, 0x49, 0x25, 0x8a, 0x98, 0x4a, 0x99, 0xe8,
+  0x7e, 0x2e, 0xc7, 0x8f, 0x93, 0xed, 0x09, 0x24, 0x4f, 0x9d, 0x2b, 0x8b,
+  0xb3, 0x20, 0xae, 0x64, 0xdb, 0x85, 0x07, 0xec, 0x40, 0xb9, 0xd0, 0x0b,
+  0x8b, 0xb1, 0x2a, 0xc3, 0xcc, 0x43, 0xe5, 0x71, 0x27, 0xef, 0x27, 0x56,
+  0x7f, 0x65, 0x53, 0x9f, 0x4e, 0x9b, 0xfb, 0xdb, 0xf4, 0x47, 0x90, 0x48,
+  0xd9, 0x4d, 0x31, 0x41, 0xc8, 0x36, 0x61, 0xcd, 0xb3, 0x0b, 0xd7, 0xb4,
+  0x1a, 0x00, 0xc1, 0xec, 0x08, 0xe1, 0x7e, 0x63, 0x0d, 0x7c, 0x2e, 0x21,
+  0x68, 0xfa, 0x75, 0xa5, 0x54, 0x4c, 0x0d, 0xca, 0xfc, 0xae, 0x9c, 0x42,
+  0x86, 0xe8, 0x33, 0x51, 0xff, 0xe8, 0xdd, 0xe3, 0x8e, 0xab, 0x2a, 0xc6,
+  0xa2, 0x32, 0xc3, 0x50, 0x89, 0x70, 0x7f, 0xe8, 0xa7, 0xff, 0x27, 0x44,
+  0x30, 0x84, 0xf0, 0x98, 0x77, 0x5c, 0x67, 0x26, 0x8d, 0x8b, 0x48, 0x33,
+  0xd1, 0x42, 0x3c, 0xfb, 0xd7, 0x2f, 0xd6, 0xe7, 0x9f, 0x44, 0xfa, 0x2c,
+  0xff, 0xdb, 0x2c, 0x84, 0xa0, 0x7a, 0x8f, 0xc9, 0x91, 0xdd, 0x31, 0xaa,
+  0x60, 0xcf, 0x2e, 0xf7, 0x98, 0x0c, 0xc4, 0xb4, 0x6c, 0x11, 0xed, 0x8f,
+  0x34, 0x6f, 0x48, 0x67, 0x70, 0x38, 0x57, 0xfd, 0x76, 0x3c, 0x2c, 0x4b,
+  0xd3, 0xb0, 0x0c, 0x0b, 0x12, 0x49, 0x1b, 0x8a, 0x0a, 0x48, 0xb5, 0xad,
+  0x7d, 0x82, 0x75, 0xf1, 0x38, 0x8d, 0xad, 0xc8, 0x8e, 0xdb, 0x2e, 0xcb,
+  0xc8, 0xa9, 0x1c, 0x92, 0x0c, 0xd2, 0xb2, 0x16, 0x99, 0xc8, 0x6f, 0xf2,
+  0x76, 0xf5, 0x65, 0x88, 0xbf, 0xeb, 0x19, 0xdc, 0x80, 0x69, 0x47, 0x95,
+  0x6c, 0xf2, 0xa0, 0x10, 0xbf, 0x90, 0x1d, 0x83, 0x7a, 0x33, 0x1c, 0x5e,
+  0xd3, 0x75, 0x42, 0xa0, 0x8c, 0xa7, 0xf7, 0x38, 0x6a, 0xa9, 0x84, 0xb4,
+  0x1f, 0xc3, 0x41, 0x2f, 0x14, 0x08, 0x5c, 0x24, 0xfb, 0xb8, 0x44, 0x62,
+  0xa2, 0x41, 0xe4, 0x5f, 0x4c, 0x12, 0xc5, 0xf6, 0x64, 0x8d, 0x54, 0xb7,
+  0xf1, 0x26, 0x10, 0x62, 0xa0, 0x4e, 0x48, 0xf7, 0x03, 0x8b, 0xbf, 0xf7,
+  0xae, 0xcb, 0x5d, 0xf8, 0xa5, 0x48, 0x7b, 0x7c, 0xcb, 0x99, 0x51, 0x57,
+  0xd3, 0xf4, 0x28, 0xa9, 0xa4, 0x37, 0xd5, 0xfd, 0x18, 0xa0, 0x31, 0x96,
+  0x35, 0x81, 0xc6, 0x08, 0xf8, 0x6a, 0xb2, 0xe6, 0xb9, 0xd3, 0xff, 0x89,
+  0xba, 0x0f, 0xaf, 0x29, 0x01, 0xe8, 0x22, 0x8c, 0x47, 0x32, 0x52, 0x93,
+  0xd7, 0x7a, 0x66, 0xdb, 0x99, 0x91, 0xff, 0x7c, 0x6f, 0xdb, 0x6f, 0x27,
+  0x0d, 0x32, 0x5d, 0xe1, 0x0d, 0xf1, 0x5a, 0x9e, 0xcd, 0x8e, 0x82, 0x93,
+  0x59, 0x69, 0xb2, 0xe0, 0x1d, 0x8c, 0x26, 0xd7, 0x2d, 0x41, 0xa3, 0xaa,
+  0x37, 0x51, 0x26, 0xc3, 0xfe, 0xb0, 0xd4, 0x43, 0xbd, 0xd7, 0x77, 0x07,
+  0x19, 0x2e, 0x84, 0x1e, 0x1a, 0x33, 0xef, 0x8f, 0xa2, 0x2b, 0xe9, 0x2b,
+  0x63, 0xaf, 0x53, 0xca, 0xce, 0xe6, 0x7f, 0xcf, 0xe7, 0xa7, 0x7f, 0xa7,
+  0x21, 0xe9, 0xf4, 0x45, 0x1c, 0x76, 0xbf, 0x62, 0x7b, 0x02, 0xf9, 0x10,
+  0x93, 0x44, 0xc5, 0x64, 0xd3, 0x5f, 0x1b, 0x67, 0x1b, 0x56, 0x7e, 0xa3,
+  0x8d, 0x55, 0xdc, 0xa8, 0x31, 0x79, 0x3f, 0x7b, 0x8d, 0x00, 0xfa, 0x9a,
+  0xaf, 0x3a, 0x85, 0x44, 0x7b, 0xa6, 0x27, 0x73, 0xdb, 0xf7, 0x2d, 0x3e,
+  0xd8, 0x95, 0x70, 0xd9, 0xdb, 0x32, 0xdd, 0x04, 0x6f, 0xc3, 0x65, 0xf1,
+  0x8e, 0xe4, 0x96, 0x4c, 0x64, 0xab, 0xe0, 0xa6, 0xd3, 0xc3, 0x44, 0x4c,
+  0xef, 0x90, 0x38, 0x21, 0x8a, 0xd5, 0xe3, 0xd9, 0x0c, 0xb6, 0x32, 0x55,
+  0x98, 0xe7, 0x0e, 0xde, 0x50, 0x79, 0xb7, 0x23, 0xe0, 0xcf, 0x9b, 0x66,
+  0x24, 0xc9, 0x7a, 0x5c, 0x86, 0xbb, 0xec, 0xe7, 0x6d, 0xbf, 0x10, 0xc0,
+  0x45, 0x1c, 0xe9, 0x42, 0x07, 0x25, 0xa3, 0x13, 0x63, 0xbd, 0xb2, 0x42,
+  0x57, 0x97, 0x94, 0xdf, 0x94, 0x7e, 0xa8, 0xed, 0xf0, 0x5f, 0x7e, 0xfd,
+  0x6d, 0xcf, 0x01, 0x36, 0xed, 0x30, 0x6c, 0x4c, 0x25, 0x9e, 0xa1, 0x84,
+  0x4d, 0xa4, 0x1b, 0x15, 0x31, 0xbc, 0xee, 0x7d, 0x30, 0x20, 0x27, 0xae,
+  0x57, 0x0a, 0x16, 0x64, 0xb2, 0x69, 0x3b, 0x45, 0x32, 0x3b, 0xad, 0x63,
+  0x10, 0xb1, 0x31, 0xcc, 0x31, 0x25, 0xa9, 0x87, 0x7d, 0x27, 0x6f, 0xb8,
+  0xd1, 0xee, 0x9c, 0x62, 0x27, 0xde, 0xe3, 0xa6, 0xc1, 0x17, 0xcc, 0xeb,
+  0xfc, 0x8d, 0x06, 0x48, 0xef, 0x5f, 0xff, 0x8e, 0x0d, 0x13, 0x74, 0x0f,
+  0x00, 0x26, 0x93, 0xa9, 0xdd, 0x95, 0x61, 0x82, 0x7d, 0x7d, 0x27, 0x12,
+  0x64, 0x61, 0x55, 0x8b, 0x2b, 0xd6, 0xf1, 0x96, 0xe3, 0x57, 0xcc, 0xe8,
+  0x27, 0x1b, 0x36, 0x6a, 0xb2, 0x8d, 0xde, 0x81, 0x19, 0x57, 0x90, 0x57,
+  0x85, 0xda, 0xb6, 0xf0, 0x21, 0xd5, 0xc1, 0x4a, 0x62, 0x02, 0x97, 0x3b,
+  0x7d, 0x5e, 0x5f, 0x53, 0x61, 0x3d, 0x50, 0x34, 0x58, 0xcb, 0x74, 0x1e,
+  0x2b, 0x19, 0x85, 0x96, 0x52, 0x27, 0x68, 0x84, 0x35, 0x57, 0x26, 0xfe,
+  0x96, 0xe8, 0x26, 0x96, 0x36, 0xe4, 0xfc, 0x80, 0x17, 0x20, 0x66, 0xfb,
+  0x65, 0xec, 0xd6, 0xcf, 0x9e, 0xe0, 0x62, 0x05, 0x55, 0xab, 0x02, 0xb0,
+  0x40, 0xea, 0x2c, 0xf6, 0xf2, 0x88, 0x7f, 0xac, 0x94, 0xa0, 0x7c, 0x67,
+  0x9b, 0x8e, 0xf6, 0x88, 0xed, 0xf4, 0x65, 0x33, 0x15, 0x91, 0x0a, 0xc0,
+  0xe6, 0xc7, 0x6d, 0x58, 0x8a, 0x34, 0xd4, 0xed, 0x44, 0x3b, 0x0b, 0x96,
+  0x1e, 0x19, 0x62, 0xc6, 0x2c, 0x81, 0x3f, 0x98, 0x43, 0x5d, 0x9a, 0x5e,
+  0xcf, 0xe3, 0x79, 0x98, 0x64, 0x49, 0x07, 0xd3, 0x6b, 0xe8, 0xb0, 0x4f,
+  0x8f, 0x4d, 0x96, 0xb0, 0x22, 0xc1, 0x71, 0xd2, 0x86, 0x13, 0x40, 0x42,
+  0x09, 0x2c, 0xf2, 0xfc, 0xf9, 0x68, 0x1f, 0xaa, 0xb9, 0x4a, 0x35, 0x37,
+  0x22, 0x09, 0xc4, 0x4b, 0x3d, 0x23, 0x8c, 0x2e, 0xa2, 0xed, 0xbd, 0x6f,
+  0x91, 0xaa, 0xab, 0xa6, 0xd5, 0xdd, 0xba, 0xf4, 0x36, 0xa7, 0x47, 0x04,
+  0x33, 0xc9, 0x1f, 0x3a, 0x11, 0x89, 0x50, 0x95, 0x3a, 0x50, 0x7f, 0x95,
+  0xa0, 0x92, 0x76, 0x8e, 0x96, 0x14, 0xe9, 0x07, 0xf3, 0x0f, 0x61, 0x42,
+  0x5c, 0xe5, 0x92, 0x0b, 0x17, 0x3f, 0xd3, 0x1b, 0x7d, 0xf2, 0x7d, 0x07,
+  0x30, 0x50, 0x6d, 0xf7, 0x0f, 0x59, 0xdd, 0x9b, 0x64, 0x04, 0x9b, 0xee,
+  0x19, 0xf9, 0xbd, 0x55, 0xda, 0x72, 0xe6, 0xc7, 0x81, 0x65, 0x1a, 0x8f,
+  0xd7, 0xf6, 0xb9, 0x9b, 0x5c, 0x1d, 0x3d, 0x66, 0xe6, 0x29, 0x4b, 0xfc,
+  0xca, 0x74, 0xbe, 0x1f, 0x99, 0xe4, 0xe4, 0x7e, 0xc4, 0x91, 0x86, 0xd7,
+  0x3b, 0x2a, 0xdd, 0xa0, 0x19, 0x56, 0xf7, 0xe2, 0xff, 0x6b, 0x55, 0xfc,
+  0x7e, 0x2c, 0x3d, 0x56, 0x19, 0x27, 0x54, 0x7f, 0xa6, 0xc2, 0x4f, 0x7a,
+  0x8e, 0xa2, 0xc0, 0x24, 0x75, 0x06, 0x59, 0xa2, 0x51, 0x75, 0x87, 0xd4,
+  0x00, 0x62, 0xc7, 0xe2, 0x34, 0xd5, 0x32, 0x7e, 0x9e, 0x06, 0x2b, 0xeb,
+  0xa1, 0xdf, 0x60, 0xaa, 0x21, 0x53, 0xd8, 0xbc, 0xe0, 0x4d, 0xda, 0x78,
+  0xf6, 0xf0, 0xfb, 0xd7, 0x4f, 0x5a, 0xcd, 0x6d, 0x0b, 0x9e, 0xaa, 0xff,
+  0x2a, 0x74, 0x34, 0x70, 0xf7, 0xa9, 0x7e, 0x21, 0x4a, 0xea, 0x1b, 0xbf,
+  0xbc, 0xca, 0xc4, 0x0a, 0x11, 0x77, 0x52, 0x83, 0xb7, 0xcc, 0xd0, 0x7a,
+  0x93, 0xb9, 0x9a, 0xa1, 0x33, 0x73, 0x5f, 0x66, 0x53, 0x4b, 0x14, 0x81,
+  0xa9, 0xe3, 0xcb, 0xe3, 0xa3, 0x3b, 0xe1, 0xb9, 0x7d, 0xc4, 0x04, 0xe6,
+  0xc0, 0x6e, 0xbf, 0x30, 0x28, 0x5a, 0xee, 0x56, 0x27, 0x31, 0xb2, 0x2f,
+  0x61, 0xf9, 0x8c, 0xa5, 0xb9, 0xd2, 0xed, 0x38, 0x03, 0xf6, 0x82, 0xbd,
+  0x5b, 0x23, 0x8f, 0xd1, 0xcf, 0x59, 0x48, 0x8f, 0x50, 0x6e, 0x4a, 0x5c,
+  0x09, 0x63, 0x53, 0xca, 0x35, 0xe5, 0x31, 0x17, 0x34, 0x6d, 0x25, 0xe3,
+  0x02, 0x59, 0xaa, 0xc5, 0x62, 0xf2, 0xd2, 0x25, 0x56, 0x5a, 0x68, 0x51,
+  0x10, 0xab, 0xee, 0x62, 0x02, 0x43, 0x31, 0xc7, 0xdb, 0xe7, 0x6f, 0x4f,
+  0x18, 0xad, 0xac, 0x23, 0xc4, 0x61, 0xbe, 0xc1, 0x85, 0xc3, 0x3d, 0xa3,
+  0x32, 0xb1, 0x89, 0xbd, 0x6e, 0xda, 0x68, 0x0f, 0x70, 0xd3, 0x46, 0x57,
+  0xe4, 0x73, 0x27, 0x05, 0x4f, 0x81, 0x00, 0x9b, 0x71, 0xcb, 0x5c, 0xbb,
+  0xc3, 0x16, 0x23, 0x63, 0x2e, 0x3f, 0xfe, 0xe6, 0x30, 0xec, 0x3d, 0xd8,
+  0xda, 0x93, 0x17, 0xc9, 0xdf, 0x0b, 0xe8, 0x89, 0x58, 0x7d, 0xf7, 0x61,
+  0xa9, 0xe6, 0x94, 0xce, 0x12, 0xa3, 0xef, 0xac, 0x1c, 0x1f, 0xaf, 0xcc,
+  0x8b, 0xb8, 0x98, 0x6e, 0x52, 0x35, 0xef, 0xfb, 0xc3, 0x87, 0xc9, 0xbc,
+  0x31, 0xe4, 0xf7, 0x87, 0x06, 0xb4, 0x15, 0x9d, 0x34, 0xfd, 0x9e, 0x91,
+  0x48, 0x30, 0x4b, 0x23, 0xf7, 0x5f, 0xee, 0x3d, 0x68, 0x16, 0xea, 0xab,
+  0x76, 0x2d, 0xad, 0x33, 0x9c, 0xba, 0x62, 0xdd, 0x2f, 0x2b, 0xa2, 0x53,
+  0x31, 0xd8, 0xa2, 0xd1, 0x41, 0x5c, 0xac, 0x48, 0x23, 0x88, 0xd7, 0x95,
+  0xbc, 0x32, 0x70, 0xe5, 0xec, 0x32, 0x22, 0x92, 0x68, 0xd5, 0x6c, 0xc7,
+  0x07, 0x6d, 0x47, 0x2e, 0x03, 0x2b, 0x3f, 0x1a, 0xf3, 0xc6, 0xe1, 0x98,
+  0xa0, 0x76, 0x1e, 0xc8, 0x1f, 0xc7, 0xf5, 0x57, 0x2d, 0x09, 0xd2, 0x15,
+  0x5c, 0xca, 0xbf, 0x60, 0x85, 0x6a, 0x41, 0x97, 0xb9, 0x0b, 0x88, 0xa5,
+  0x15, 0xdf, 0xf5, 0xf8, 0x3f, 0x7a, 0xde, 0x2b, 0xd4, 0x4a, 0xdb, 0x10,
+  0x62, 0x9c, 0x6c, 0x51, 0x87, 0x48, 0x55, 0xd5, 0x6f, 0x36, 0x46, 0x87,
+  0xab, 0xa0, 0x39, 0x4b, 0x62, 0xa8, 0x43, 0xc5, 0xe9, 0x58, 0xd3, 0xa6,
+  0x02, 0x16, 0x20, 0x1f, 0xed, 0xd2, 0xda, 0x1f, 0x95, 0x74, 0x4a, 0xe7,
+  0x1b, 0x4a, 0xa1, 0x5f, 0x51, 0xd9, 0xb4, 0xd6, 0xca, 0xeb, 0x7b, 0x08,
+  0x83, 0x5f, 0x85, 0x60, 0x8e, 0x15, 0xed, 0xf4, 0x8c, 0xe6, 0x69, 0x67,
+  0x9f, 0x7b, 0xfb, 0x99, 0xbf, 0x58, 0x92, 0x80, 0x0c, 0x32, 0x37, 0xcb,
+  0x52, 0x97, 0xae, 0xdc, 0xbd, 0xde, 0x43, 0x40, 0x9f, 0xe6, 0xe3, 0xbc,
+  0x39, 0xba, 0x45, 0x85, 0x65, 0xd6, 0x70, 0xe7, 0x2d, 0x52, 0xa0, 0x7c,
+  0x13, 0xc1, 0x2d, 0xd3, 0xa9, 0x24, 0xd2, 0xd6, 0xc1, 0x1e, 0x83, 0xdc,
+  0xb0, 0xa3, 0xb9, 0x69, 0x5d, 0x9d, 0x38, 0xde, 0x77, 0xcf, 0x5e, 0x3a,
+  0x33, 0x0a, 0x0a, 0x98, 0x15, 0x52, 0x28, 0x0f, 0x98, 0x55, 0x6a, 0x15,
+  0xbc, 0xdf, 0x72, 0x52, 0xc1, 0x25, 0xf9, 0x72, 0x62, 0xb5, 0x50, 0x16,
+  0xb2, 0xc0, 0x7e, 0x06, 0x26, 0x9c, 0x11, 0x7f, 0x1e, 0xb2, 0x00, 0x8b,
+  0x45, 0xa0, 0x4f, 0x2f, 0xbb, 0xdd, 0xa7, 0xdf, 0xa5, 0xb0, 0x07, 0x94,
+  0x3e, 0xfe, 0x4c, 0xde, 0x37, 0xc5, 0xf6, 0xd2, 0x7b, 0xe3, 0x5d, 0xd1,
+  0xd2, 0xf8, 0x13, 0x06, 0xe4, 0x2a, 0x34, 0xcb, 0xd4, 0x17, 0x4f, 0xa6,
+  0x88, 0x11, 0x5b, 0x5b, 0x59, 0x37, 0xef, 0xaa, 0x04, 0x8c, 0x2b, 0xb6,
+  0xc6, 0x67, 0x91, 0x42, 0x20, 0x03, 0x19, 0x45, 0xf3, 0x1e, 0x07, 0x04,
+  0x76, 0x1d, 0xca, 0xd6, 0xcc, 0xf9, 0x6f, 0x91, 0x6e, 0xa5, 0x7b, 0xd3,
+  0x75, 0x85, 0x6c, 0x89, 0x2e, 0xba, 0x26, 0x0a, 0x51, 0x4f, 0x14, 0xd8,
+  0x39, 0x38, 0x90, 0x33, 0xdb, 0xe5, 0x86, 0x83, 0xb7, 0x69, 0x27, 0xd3,
+  0x69, 0x75, 0x2b, 0x15, 0x63, 0x7f, 0x47, 0x28, 0x6d, 0x35, 0x1c, 0xf5,
+  0x71, 0x01, 0xdd, 0x3e, 0x07, 0x66, 0x14, 0xe8, 0x41, 0x2d, 0xee, 0xb6,
+  0xca, 0x5b, 0xf6, 0x39, 0x9f, 0x88, 0xcc, 0x32, 0xe3, 0x43, 0x27, 0x89,
+  0x21, 0x82, 0x28, 0x12, 0xa6, 0x2f, 0x06, 0xef, 0x1c, 0xd6, 0x7c, 0x41,
+  0x64, 0x13, 0x99, 0xc4, 0xbe, 0x5d, 0xde, 0xb8, 0x4d, 0xcb, 0x42, 0xb4,
+  0xaa, 0x11, 0x9f, 0x87, 0xe4, 0x95, 0xcc, 0xcc, 0xe6, 0x21, 0x21, 0xdb,
+  0xd9, 0xc6, 0x46, 0xa1, 0x3c, 0xa5, 0x20, 0x0d, 0x61, 0xda, 0xeb, 0x14,
+  0xeb, 0xff, 0x3d, 0x5a, 0x80, 0x0a, 0x89, 0x31, 0xa5, 0x05, 0xf4, 0x9a,
+  0xb5, 0x8f, 0xc2, 0x1b, 0x48, 0xf8, 0xf3, 0xb9, 0x8c, 0x65, 0xa3, 0xf1,
+  0x59, 0x70, 0xfe, 0x48, 0xc8, 0x3e, 0x45, 0x3c, 0x84, 0xb2, 0x7f, 0x69,
+  0xd1, 0x34, 0xb3, 0x08, 0x45, 0x15, 0x6f, 0x56, 0x90, 0xb5, 0x20, 0xa9,
+  0x85, 0xe4, 0xc1, 0xfa, 0x63, 0x6e, 0xee, 0x1f, 0x63, 0xdb, 0xde, 0xaf,
+  0x0f, 0x45, 0xae, 0x97, 0xb7, 0x8f, 0x33, 0xa5, 0x09, 0x2c, 0x4a, 0xfd,
+  0xd9, 0x5d, 0xbe, 0x44, 0x2b, 0x24, 0x76, 0x3a, 0x82, 0x38, 0x92, 0x5d,
+  0x0e, 0x53, 0x4b, 0x1b, 0x4d, 0x7f, 0x52, 0x4d, 0x5e, 0x20, 0x50, 0x6a,
+  0xd3, 0x48, 0xba, 0x74, 0x3d, 0xc1, 0x49, 0x31, 0x80, 0x9b, 0x31, 0x27,
+  0x76, 0xb0, 0xa6, 0x44, 0xed, 0xcc, 0x5c, 0xf2, 0xd9, 0x8a, 0x3b, 0x8e,
+  0xd0, 0xb5, 0x2e, 0x0e, 0x37, 0xdf, 0xd3, 0x3e, 0x52, 0xbf, 0x16, 0x2b,
+  0xd0, 0x3a, 0x05, 0x07, 0x4b, 0x14, 0xb3, 0xde, 0x80, 0x0c, 0xc4, 0x0d,
+  0xff, 0xe5, 0x6b, 0xd4, 0x79, 0x51, 0xe5, 0x34, 0x83, 0xb2, 0xe4, 0x71,
+  0xeb, 0xf5, 0x3f, 0x4e, 0x74, 0x1f, 0xba, 0x61, 0xf4, 0xe0, 0xc7, 0xb8,
+  0xf4, 0x56, 0x28, 0xe0, 0x2d, 0xd4, 0xc8, 0x1c, 0x00, 0x8c, 0xd0, 0xd2,
+  0x9c, 0xea, 0x66, 0x8a, 0xf1, 0xbc, 0x3b, 0xa2, 0x98, 0x6d, 0x2c, 0x81,
+  0xe6, 0x48, 0xba, 0x92, 0x6f, 0x44, 0x0f, 0xe9, 0xd6, 0x67, 0x76, 0xb3,
+  0x69, 0x88, 0x3f, 0xf8, 0x13, 0x2c, 0xb9, 0x6e, 0xac, 0xd0, 0x0b, 0x6b,
+  0x3c, 0xe3, 0xa7, 0x28, 0xda, 0x9b, 0xc5, 0xbb, 0xc0, 0x62, 0x48, 0x55,
+  0xb4, 0x32, 0x4e, 0x9c, 0x10, 0x27, 0xac, 0xe0, 0xc4, 0x16, 0x0f, 0xa7,
+  0xec, 0x55, 0xdd, 0xe7, 0x88, 0xda, 0x24, 0x2b, 0x6d, 0x80, 0x47, 0x9f,
+  0xde, 0x17, 0x10, 0x2e, 0xca, 0xa0, 0xab, 0x6d, 0x38, 0x29, 0xc7, 0xdb,
+  0xcc, 0x84, 0x71, 0x13, 0xd3, 0x83, 0x98, 0x30, 0x2f, 0x61, 0x71, 0xf1,
+  0x5e, 0xa5, 0xa4, 0x28, 0x46, 0x4e, 0xdc, 0x06, 0x5a, 0x7a, 0x2d, 0x90,
+  0x71, 0x24, 0x1d, 0x0c, 0x13, 0x69, 0x97, 0x63, 0xcc, 0xfe, 0x96, 0xfe,
+  0xaf, 0x79, 0x6f, 0x48, 0x62, 0x94, 0xcb, 0xb3, 0xcb, 0x17, 0x33, 0x09,
+  0x80, 0xb3, 0x31, 0x19, 0xd3, 0x8a, 0x77, 0x65, 0xc4, 0x77, 0x1c, 0x25,
+  0xe4, 0x0d, 0xac, 0x23, 0xf5, 0xe8, 0x9b, 0x08, 0xd7, 0x41, 0x54, 0x90,
+  0x3b, 0x7d, 0x88, 0xa8, 0xc9, 0xe7, 0x2e, 0x7c, 0x4d, 0x6b, 0x69, 0xfe,
+  0x16, 0xb4, 0x5c, 0xb1, 0x6b, 0x60, 0x1e, 0x35, 0x59, 0x96, 0x30, 0xff,
+  0xe6, 0xef, 0x25, 0x89, 0x85, 0x56, 0x62, 0xde, 0x61, 0xc0, 0x1e, 0x7c,
+  0x66, 0x5c, 0x1e, 0x3e, 0x0d, 0xbc, 0x3f, 0x11, 0x87, 0x2b, 0x81, 0xf4,
+  0x96, 0xec, 0x8f, 0x7a, 0x77, 0x26, 0x30, 0xb0, 0xe6, 0x63, 0x0d, 0x52,
+  0xb7, 0xf8, 0x45, 0xd9, 0x23, 0xe8, 0x95, 0x20, 0xa4, 0x04, 0xb3, 0xc2,
+  0x5e, 0x10, 0x36, 0xba, 0xd2, 0xd4, 0x54, 0x7a, 0x24, 0x32, 0x11, 0x6b,
+  0xc4, 0x80, 0x81, 0x33, 0x0b, 0x95, 0xc9, 0x4c, 0x95, 0x93, 0xcf, 0x9b,
+  0x0c, 0x71, 0x55, 0x00, 0x9d, 0xc4, 0x93, 0xd0, 0xf4, 0x3e, 0x08, 0xbf,
+  0x47, 0xd2, 0x1b, 0x35, 0xd4, 0x2c, 0xc5, 0xf6, 0xb5, 0x66, 0xa8, 0xce,
+  0x95, 0xce, 0xdf, 0xa5, 0x03, 0xad, 0x72, 0x19, 0xdb, 0xbf, 0x50, 0xcd,
+  0xfd, 0x8e, 0xa2, 0xe9, 0x26, 0x1c, 0x4f, 0xf7, 0x0d, 0x58, 0x4a, 0x11,
+  0x79, 0x49, 0x48, 0x9c, 0x56, 0xec, 0xe7, 0x2f, 0x0f, 0x22, 0x10, 0x95,
+  0x77, 0x5e, 0xb5, 0x96, 0xdf, 0x0b, 0xcf, 0xe8, 0x5b, 0x7c, 0xf0, 0x10,
+  0x09, 0xba, 0xd6, 0x99, 0x84, 0xae, 0xdc, 0x1b, 0x34, 0x21, 0x80, 0x68,
+  0x59, 0x82, 0x9c, 0x1c, 0x62, 0x72, 0xa6, 0x80, 0x0c, 0x60, 0xf4, 0x47,
+  0x37, 0xd8, 0x3c, 0x8a, 0x0d, 0x8b, 0x36, 0x4c, 0x1a, 0x1c, 0xeb, 0xac,
+  0xff, 0x51, 0x1a, 0x3d, 0x30, 0x83, 0x95, 0x9d, 0xae, 0x66, 0x2d, 0x76,
+  0xf1, 0x30, 0xc8, 0x74, 0x94, 0x81, 0x16, 0x13, 0x84, 0x6e, 0x46, 0xde,
+  0xcf, 0x15, 0x99, 0xdf, 0x6b, 0xc8, 0xd3, 0xae, 0x20, 0xaa, 0x46, 0x27,
+  0xe2, 0x91, 0x64, 0x9d, 0x49, 0x7e, 0xa6, 0xbb, 0x58, 0xd9, 0x06, 0x89,
+  0x4c, 0x3f, 0x4d, 0xdb, 0xa2, 0x4d, 0x39, 0xa9, 0x4e, 0xe9, 0x44, 0xa4,
+  0x99, 0x5a, 0xf5, 0xdc, 0xf8, 0x0e, 0x2d, 0xf2, 0x78, 0x8e, 0xe0, 0x34,
+  0x9f, 0x0e, 0xc0, 0x67, 0x94, 0xc2, 0x93, 0xad, 0xaf, 0x69, 0x15, 0x45,
+  0xff, 0xb8, 0x71, 0x35, 0x57, 0xb8, 0x0c, 0xf5, 0x90, 0xc6, 0xed, 0x8a,
+  0x1d, 0x7b, 0x46, 0x25, 0x7c, 0xe2, 0x19, 0xc0, 0x6c, 0x54, 0x40, 0xf7,
+  0x6b, 0x2e, 0xde, 0x31, 0x29, 0x6c, 0x48, 0xfd, 0x9e, 0xa0, 0xdc, 0x3b,
+  0xf3, 0x26, 0x6d, 0x5f, 0xbc, 0xad, 0x9c, 0xa7, 0x3d, 0xec, 0xd8, 0xbe,
+  0xba, 0x41, 0x06, 0xd9, 0xe7, 0x39, 0x1d, 0xc4, 0x95, 0x18, 0xb7, 0x9f,
+  0xc8, 0x30, 0x9d, 0x75, 0x81, 0x67, 0x12, 0xa9, 0x0e, 0xc5, 0xa6, 0x72,
+  0x00, 0x46, 0x09, 0xd2, 0xf7, 0x5f, 0x97, 0x78, 0x1a, 0x02, 0xdf, 0xfc,
+  0x2e, 0xe9, 0xcd, 0x4c, 0xc3, 0x44, 0xa8, 0xdf, 0x8f, 0x63, 0xcb, 0x63,
+  0xf7, 0xd1, 0x68, 0xdd, 0xf0, 0x49, 0xe2, 0x0e, 0x99, 0x2f, 0x8a, 0x0f,
+  0x4b, 0x7b, 0xa7, 0x26, 0x4b, 0x98, 0x94, 0x2c, 0xd9, 0x60, 0xae, 0xb6,
+  0x2f, 0xb7, 0x21, 0x09, 0x92, 0x19, 0xd9, 0x06, 0xcb, 0x79, 0x6e, 0x1b,
+  0x7a, 0x96, 0x86, 0x25, 0x81, 0x3f, 0x7a, 0xdc, 0x11, 0x38, 0xf2, 0x68,
+  0x4f, 0x44, 0xd8, 0xd8, 0x8e, 0x5a, 0x9c, 0x7a, 0xab, 0x6e, 0x8c, 0xd7,
+  0x7e, 0xaa, 0x7e, 0xeb, 0xff, 0xc6, 0x72, 0x4c, 0x2e, 0x0a, 0xb9, 0x9a,
+  0x97, 0xf6, 0xd0, 0xd4, 0xfc, 0x42, 0x82, 0xe5, 0x32, 0x52, 0x2e, 0xc5,
+  0x9a, 0x80, 0x7e, 0x68, 0xad, 0x31, 0x85, 0xe2, 0xa4, 0xdd, 0x20, 0xad,
+  0x26, 0x1a, 0x35, 0x8d, 0xfb, 0xfc, 0xbd, 0xe7, 0x3a, 0x8a, 0xa7, 0x48,
+  0xc6, 0xf9, 0xa5, 0x82, 0xf1, 0xe4, 0x89, 0xec, 0xf3, 0x3c, 0x1d, 0x51,
+  0x24, 0xcd, 0xe6, 0x7e, 0x18, 0x98, 0x5b, 0x13, 0xb0, 0xd7, 0x83, 0x14,
+  0x97, 0xc7, 0x9c, 0x02, 0x6f, 0x04, 0x96, 0x57, 0x1f, 0x11, 0x00, 0x4d,
+  0x6d, 0x81, 0xf8, 0x8b, 0x0d, 0x0c, 0xc6, 0x23, 0xc8, 0xc5, 0x1f, 0xf3,
+  0x09, 0x25, 0x96, 0x02, 0x9a, 0x80, 0x8a, 0x5c, 0x84, 0x8e, 0x43, 0x17,
+  0x8f, 0x7a, 0x1e, 0xcf, 0xf1, 0x77, 0xef, 0x98, 0x86, 0x69, 0x6b, 0xb9,
+  0xad, 0x85, 0x76, 0x9e, 0xd8, 0xdd, 0xd8, 0xe7, 0x7c, 0x1c, 0xb1, 0xf0,
+  0x7f, 0x96, 0xba, 0xfb, 0x1a, 0x91, 0x3a, 0xaf, 0x27, 0xdd, 0x1b, 0x3e,
+  0x3a, 0x19, 0x55, 0xfe, 0xef, 0x6b, 0xd2, 0x05, 0x6f, 0xc9, 0x08, 0xe6,
+  0x73, 0x1b, 0x80, 0x94, 0x99, 0xc8, 0xb4, 0x41, 0x6d, 0x85, 0x23, 0xa4,
+  0x52, 0x2b, 0x94, 0x09, 0xaa, 0x49, 0x14, 0xc9, 0xc6, 0x51, 0x9c, 0xcb,
+  0xc9, 0xfb, 0xfa, 0xdc, 0xdc, 0x9e, 0x5a, 0x68, 0xe0, 0x73, 0x82, 0xdd,
+  0x7b, 0x56, 0xdd, 0x92, 0xb0, 0x79, 0x09, 0x03, 0x03, 0x65, 0x8b, 0x26,
+  0x7c, 0x5a, 0x43, 0x96, 0xa9, 0x13, 0x0e, 0x1c, 0x3e, 0xdd, 0x23, 0xc8,
+  0x14, 0x16, 0x36, 0x9d, 0xd6, 0x61, 0x6d, 0x2c, 0x29, 0xcc, 0xce, 0x6d,
+  0x90, 0xbd, 0xc3, 0xed, 0x90, 0x83, 0x34, 0xc1, 0xae, 0x11, 0x5a, 0x7d,
+  0x53, 0x56, 0x2f, 0x9e, 0xe4, 0xdb, 0x66, 0xe9, 0xe0, 0x8e, 0xd6, 0x9e,
+  0x5d, 0x4d, 0x46, 0xa1, 0x0d, 0x88, 0xe0, 0x96, 0x84, 0x11, 0xe5, 0x2a,
+  0x42, 0xc7, 0x9f, 0x60, 0x07, 0x47, 0x95, 0xbd, 0xcc, 0x4b, 0x8c, 0x44,
+  0x1a, 0x6c, 0xda, 0xf5, 0x4a, 0xca, 0x41, 0x6d, 0x10, 0x8e, 0xc5, 0x7a,
+  0xc8, 0x36, 0xfd, 0xce, 0xc1, 0x4d, 0x58, 0x3f, 0x7a, 0x5b, 0xbd, 0x3c,
+  0xc7, 0x6a, 0x93, 0x8d, 0xd0, 0x59, 0xd6, 0x2f, 0x20, 0x5a, 0x40, 0x04,
+  0x2e, 0xb5, 0xbf, 0x7a, 0xe5, 0xe8, 0xdc, 0x85, 0x92, 0x6c, 0x56, 0x5c,
+  0x22, 0x0d, 0xcd, 0xd8, 0xfc, 0xc0, 0x14, 0x25, 0xa8, 0x61, 0xa4, 0xb1,
+  0x95, 0xea, 0x94, 0xef, 0xf3, 0x57, 0xc2, 0x64, 0xa9, 0xd5, 0xde, 0xe2,
+  0xa1, 0x1a, 0x9b, 0x33, 0x4f, 0x2e, 0xdc, 0xc9, 0xd6, 0xc8, 0x74, 0x3b,
+  0x4d, 0x2e, 0x46, 0x2b, 0xab, 0x40, 0x87, 0xe6, 0x22, 0x8d, 0x19, 0xb3,
+  0x61, 0x38, 0xd9, 0x93, 0xee, 0xeb, 0xdd, 0x9a, 0x0b, 0x0f, 0xee, 0x21,
+  0x5c, 0xa9, 0xc5, 0xd8, 0x74, 0x87, 0x9a, 0xeb, 0x48, 0x50, 0xee, 0xee,
+  0x18, 0x7a, 0x39, 0x81, 0x54, 0x51, 0x3a, 0xa5, 0xc2, 0x00, 0x82, 0x8a,
+  0x90, 0x44, 0x25, 0x6e, 0x8e, 0x00, 0xce, 0x8a, 0xa3, 0x10, 0xc8, 0x1a,
+  0xbc, 0x4e, 0x24, 0x1f, 0x50, 0x2f, 0x31, 0xae, 0x40, 0x11, 0xc2, 0x97,
+  0x3c, 0xad, 0x4a, 0x23, 0x1c, 0xf1, 0xb3, 0x88, 0xa6, 0xa9, 0x25, 0x7a,
+  0x8d, 0x7d, 0xe1, 0x30, 0x25, 0xf0, 0x84, 0x7b, 0x80, 0xa2, 0x1e, 0x1c,
+  0x09, 0x1b, 0x64, 0x8f, 0x25, 0xeb, 0xe0, 0x90, 0x93, 0xb8, 0x00, 0x21,
+  0x2b, 0xf8, 0x23, 0x75, 0xa6, 0x3b, 0xdb, 0xb2, 0x9a, 0x3a, 0x84, 0x6e,
+  0x28, 0xee, 0x4a, 0x11, 0x3f, 0x9b, 0xa8, 0x4b, 0x08, 0x2d, 0x87, 0xcb,
+  0xa7, 0xad, 0xa8, 0x57, 0x81, 0xc6, 0xf3, 0x7b, 0xae, 0x0f, 0xbf, 0x2c,
+  0x43, 0x3e, 0xdd, 0xdb, 0x0c, 0xd7, 0xbf, 0x66, 0x1b, 0xce, 0xb1, 0x92,
+  0x76, 0x9d, 0xd9, 0x51, 0x78, 0x86, 0x33, 0x59, 0xd7, 0xdd, 0x4d, 0x51,
+  0x62, 0xaa, 0x2e, 0xa6, 0x62, 0x96, 0x7b, 0x0b, 0x3b, 0xa7, 0xed, 0xeb,
+  0x02, 0xf8, 0x1e, 0x17, 0x6e, 0x88, 0x0c, 0xee, 0x00, 0x00, 0x9d, 0x61,
+  0x95, 0x2e, 0xf8, 0x4d, 0xe2, 0x8b, 0x82, 0x63, 0x9a, 0x4c, 0x77, 0x65,
+  0x72, 0x53, 0xf1, 0x4b, 0x5c, 0x43, 0x43, 0x9e, 0xfd, 0xfc, 0x6a, 0x37,
+  0x4a, 0x2a, 0xa0, 0xaa, 0xef, 0x5a, 0xd7, 0x43, 0xf8, 0xb4, 0x03, 0x01,
+  0x83, 0x19, 0xdd, 0xa7, 0xb3, 0xe4, 0x5e, 0xa4, 0x6a, 0xa9, 0x6c, 0x06,
+  0x62, 0x00, 0x69, 0x7a, 0xb4, 0xc9, 0x36, 0xe5, 0x69, 0x09, 0x85, 0xea,
+  0x98, 0x60, 0xcc, 0x98, 0xe3, 0xb7, 0x21, 0xa7, 0x15, 0xa4, 0x2f, 0x9a,
+  0xf4, 0x4d, 0x37, 0xb1, 0x85, 0x70, 0xdd, 0x2b, 0xd2, 0x7b, 0xe2, 0x8c,
+  0xb6, 0xa6, 0xd3, 0x0f, 0xd0, 0x7a, 0x8f, 0xaa, 0x3b, 0xf6, 0x8c, 0x0c,
+  0x4d, 0xbd, 0x8c, 0x61, 0x9b, 0x1d, 0xa7, 0xca, 0x31, 0xe9, 0x8b, 0xa5,
+  0xb4, 0xd4, 0xd8, 0xd4, 0xd0, 0x1a, 0x08, 0x8d, 0x72, 0x29, 0xd1, 0xfd,
+  0x83, 0xd5, 0xe8, 0xe6, 0x2f, 0xb8, 0x74, 0x2d, 0x7e, 0x0b, 0xd3, 0x56,
+  0x4f, 0xb4, 0xc3, 0x04, 0x45, 0x12, 0x4a, 0xee, 0x8c, 0xe6, 0x26, 0xb1,
+  0x24, 0xbd, 0x69, 0x82, 0xae, 0x42, 0x25, 0x38, 0xd5, 0x02, 0x62, 0x55,
+  0xe2, 0x56, 0x68, 0xfd, 0x28, 0xe0, 0x09, 0x04, 0x90, 0xaa, 0x85, 0xe0,
+  0xc6, 0x0a, 0x26, 0x6d, 0x2c, 0x9e, 0xdc, 0x99, 0xc8, 0x0d, 0xab, 0x88,
+  0x91, 0x77, 0xbc, 0xd3, 0x8a, 0x6f, 0x70, 0x1a, 0x56, 0xe8, 0xb1, 0xb1,
+  0xba, 0xa8, 0x7e, 0x33, 0xac, 0xf9, 0x9f, 0x40, 0xb5, 0x0f, 0x3b, 0x60,
+  0x3c, 0x38, 0xc3, 0x36, 0x5e, 0x6d, 0xa7, 0x0d, 0xf6, 0xc2, 0x99, 0x95,
+  0x50, 0x34, 0xce, 0x41, 0x88, 0x41, 0xbd, 0xad, 0x5f, 0x20, 0xe1, 0xcd,
+  0x49, 0x39, 0xee, 0xb4, 0x20, 0x14, 0x25, 0xfa, 0xb4, 0x7c, 0x95, 0x6e,
+  0xdb, 0x3a, 0x6d, 0xaf, 0xa2, 0x5c, 0x57, 0x0e, 0x28, 0x89, 0xaf, 0xfd,
+  0xb1, 0x68, 0x28, 0xbf, 0x23, 0xb1, 0x93, 0x4d, 0x3b, 0xb2, 0x85, 0xab,
+  0x4d, 0x34, 0xba, 0x9d, 0x87, 0x99, 0x15, 0xa8, 0xef, 0xa7, 0x79, 0x2b,
+  0x04, 0xbf, 0xdc, 0xc2, 0x4b, 0x68, 0x32, 0x43, 0x0b, 0x9f, 0x31, 0xf5,
+  0x24, 0xc3, 0xdf, 0x47, 0x4a, 0xf8, 0x46, 0x84, 0x08, 0x1c, 0x4d, 0x67,
+  0x86, 0xfc, 0x93, 0x2f, 0x5f, 0xf7, 0xe9, 0x5f, 0xa7, 0xab, 0xa8, 0x5a,
+  0x4e, 0x2e, 0x01, 0x6a, 0xc7, 0x34, 0x7b, 0xb0, 0x5a, 0x3e, 0x57, 0x92,
+  0x59, 0x6c, 0x02, 0x92, 0x4d, 0xfa, 0x21, 0x34, 0x72, 0x86, 0xc2, 0xbf,
+  0xf5, 0xd4, 0xfd, 0x87, 0xe0, 0x9f, 0x2d, 0x04, 0xb9, 0xe5, 0xca, 0x81,
+  0x99, 0x9e, 0x8d, 0xdb, 0x70, 0xdb, 0x3a, 0x5b, 0x19, 0xf8, 0x1f, 0x65,
+  0x37, 0xde, 0x9e, 0xf0, 0x94, 0x7c, 0xd8, 0xc2, 0xbf, 0x0e, 0x00, 0x39,
+  0x54, 0xcf, 0xd1, 0xd9, 0x0f, 0xc5, 0x20, 0xcb, 0x87, 0xcb, 0x7b, 0x59,
+  0x37, 0x19, 0x4e, 0xf4, 0x51, 0x4a, 0xc6, 0x4c, 0x11, 0x56, 0x21, 0xb2,
+  0xe3, 0xd6, 0xeb, 0xf1, 0xa3, 0xdc, 0xdb, 0x25, 0xf8, 0xb6, 0xce, 0xd0,
+  0xed, 0xbc, 0x61, 0x31, 0x3f, 0xc6, 0x83, 0x53, 0xf2, 0x78, 0xe4, 0xc6,
+  0x1a, 0xe7, 0xe6, 0x52, 0xbe, 0x32, 0x9f, 0xcc, 0xa0, 0x8d, 0x60, 0x95,
+  0xb8, 0x67, 0xe3, 0x2e, 0x10, 0xe6, 0xd7, 0xd4, 0xe8, 0x53, 0x5c, 0xa7,
+  0x83, 0x7d, 0x59, 0x47, 0x26, 0x73, 0x76, 0xa1, 0x15, 0x7b, 0x77, 0xc0,
+  0x72, 0x2d, 0x6b, 0x56, 0x4a, 0x99, 0x82, 0x67, 0x17, 0x6c, 0x4f, 0x72,
+  0x12, 0xc7, 0x08, 0xdc, 0xbd, 0xa5, 0xb6, 0xea, 0xdd, 0x97, 0xf8, 0x15,
+  0xcb, 0xa0, 0x32, 0x18, 0x96, 0x16, 0x52, 0x5d, 0xbb, 0x92, 0x74, 0xca,
+  0xb8, 0x3a, 0xbc, 0x40, 0xc2, 0xb2, 0x88, 0x9a, 0xe1, 0x5b, 0xd0, 0xa7,
+  0x62, 0xc5, 0x06, 0xe0, 0x76, 0xf9, 0x51, 0x14, 0xb7, 0xa9, 0xa5, 0x95,
+  0xa2, 0x28, 0x37, 0x2c, 0xe8, 0xc6, 0x1e, 0x55, 0xdf, 0x1a, 0x06, 0xf4,
+  0x5e, 0x3e, 0x1d, 0x3c, 0xa9, 0x2b, 0x0d, 0x0e, 0xbc, 0x2f, 0xd9, 0xaf,
+  0x18, 0x6a, 0x90, 0x6d, 0x6b, 0xf5, 0x92, 0xe8, 0x54, 0xbc, 0x8f, 0x97,
+  0x90, 0xf8, 0xd9, 0x2f, 0xca, 0x7f, 0x40, 0x1f, 0xb5, 0x62, 0x0d, 0xb4,
+  0xb0, 0x0b, 0x7c, 0xfe, 0xc4, 0x36, 0xfb, 0x2d, 0x06, 0xe1, 0xa5, 0xd2,
+  0x23, 0xf7, 0xeb, 0xc7, 0xf7, 0x31, 0xc0, 0xb5, 0x0a, 0x51, 0x5f, 0xf9,
+  0xab, 0x11, 0xda, 0xe3, 0xa5, 0x42, 0xf1, 0x72, 0xb5, 0x80, 0x47, 0xc8,
+  0x09, 0xd4, 0x4f, 0xb2, 0x96, 0x57, 0x6d, 0x46, 0xfc, 0x22, 0x2e, 0x0f,
+  0x55, 0x97, 0x75, 0x73, 0x37, 0x7a, 0x13, 0x8f, 0x47, 0x9e, 0xcc, 0x93,
+  0x4e, 0x91, 0x41, 0x2f, 0x0f, 0x67, 0x24, 0xca, 0x60, 0x87, 0xc5, 0xf4,
+  0x49, 0x6a, 0x33, 0xdc, 0x95, 0x58, 0xcd, 0x95, 0x24, 0x00, 0x6b, 0x45,
+  0x34, 0x49, 0xb0, 0x23, 0x7f, 0xfa, 0x55, 0xc6, 0x4f, 0xf2, 0xec, 0x13,
+  0x53, 0xa8, 0x33, 0x81, 0x1d, 0x14, 0xfc, 0x26, 0xf4, 0xc4, 0xe0, 0xd4,
+  0xcd, 0xaa, 0x98, 0x3c, 0x9d, 0x1e, 0xf7, 0x73, 0xcf, 0x8d, 0xc6, 0x91,
+  0xcf, 0xd1, 0x6a, 0x99, 0xd7, 0xba, 0x7b, 0x39, 0xc6, 0x20, 0xd8, 0x62,
+  0xf4, 0xfd, 0x38, 0x39, 0x51, 0x4f, 0xbe, 0x99, 0xef, 0x3c, 0xac, 0x1c,
+  0x79, 0xf0, 0x63, 0x2d, 0xcc, 0xfe, 0x97, 0x15, 0x99, 0x63, 0xab, 0xe7,
+  0x0d, 0xc4, 0xd6, 0x84, 0xa0, 0x23, 0x1a, 0xad, 0x25, 0xdb, 0xe9, 0xc5,
+  0x83, 0xae, 0x62, 0x95, 0xab, 0x00, 0xa1, 0xab, 0x26, 0x3d, 0x53, 0x7d,
+  0xc3, 0xeb, 0xd8, 0x7b, 0x8e, 0x84, 0x49, 0x58, 0xb0, 0x54, 0x17, 0x07,
+  0xeb, 0xc4, 0x97, 0x81, 0xd9, 0x7a, 0xa4, 0x37, 0x91, 0x7e, 0xc5, 0xcf,
+  0x60, 0x4c, 0x27, 0x35, 0xc7, 0x77, 0x3b, 0xec, 0x43, 0x62, 0xe9, 0xd3,
+  0x0d, 0xe9, 0x2a, 0x1c, 0xbc, 0x65, 0x7e, 0x3d, 0x8c, 0x9b, 0x9c, 0x2e,
+  0x9b, 0x8d, 0x34, 0xa1, 0x3d, 0xc4, 0x22, 0x83, 0x36, 0x8b, 0xa9, 0xca,
+  0x6b, 0xc2, 0x64, 0xa8, 0x97, 0xfe, 0x1f, 0xe4, 0x59, 0xb4, 0x91, 0x93,
+  0x60, 0xb9, 0x37, 0x4d, 0x90, 0x3c, 0x5f, 0xc8, 0xf1, 0xe5, 0xe1, 0x7f,
+  0xab, 0x67, 0x50, 0x2f, 0x4e, 0x6b, 0x72, 0xd1, 0x74, 0x3e, 0x3a, 0xdf,
+  0x96, 0x70, 0xc5, 0x9b, 0x6b, 0xb5, 0xea, 0x11, 0xd2, 0xc1, 0x70, 0x20,
+  0x94, 0x10, 0x05, 0x78, 0x6f, 0xd5, 0x85, 0xbd, 0x82, 0x23, 0x48, 0xcf,
+  0xc0, 0x74, 0x59, 0x8a, 0xb0, 0x65, 0x29, 0xe5, 0xed, 0x27, 0x61, 0xf4,
+  0x1e, 0x40, 0x7f, 0x56, 0xb9, 0x7b, 0x0d, 0x6d, 0x25, 0xa1, 0xdf, 0x1e,
+  0xd8, 0x20, 0xcc, 0x1e, 0xbb, 0x04, 0xec, 0x85, 0x61, 0xb9, 0x33, 0x87,
+  0x9b, 0x7d, 0x2c, 0x52, 0x99, 0xca, 0x86, 0x93, 0x82, 0xf6, 0x63, 0xd1,
+  0x0d, 0x82, 0x04, 0x51, 0xe0, 0x1b, 0x16, 0x68, 0x0c, 0xed, 0x55, 0x0e,
+  0x43, 0x5d, 0x65, 0x86, 0xab, 0x31, 0x8c, 0x34, 0x5a, 0xc8, 0x3c, 0x8f,
+  0xcb, 0xa7, 0x11, 0x4f, 0x4a, 0xc2, 0x51, 0xe1, 0xb0, 0x53, 0xbd, 0xd2,
+  0x0f, 0xdf, 0x8a, 0xdd, 0xd6, 0x97, 0xa5, 0xec, 0x01, 0x7b, 0xf0, 0x48,
+  0xae, 0xf2, 0x9e, 0x2f, 0x32, 0xfc, 0xd4, 0xa0, 0x2f, 0x17, 0xa8, 0xf9,
+  0x6b, 0x1a, 0x33, 0x16, 0x2c, 0xb3, 0x94, 0x66, 0x27, 0xd1, 0x80, 0x8a,
+  0x26, 0x66, 0xe9, 0x87, 0x04, 0x91, 0xab, 0x0a, 0x2f, 0xa8, 0xd4, 0x17,
+  0x1e, 0xeb, 0xef, 0x1a, 0x4d, 0x19, 0x83, 0x37, 0x04, 0xa7, 0x9e, 0x12,
+  0x48, 0x76, 0xe1, 0xd3, 0xae, 0xf3, 0xc4, 0xbc, 0x07, 0x05, 0x0e, 0x8c,
+  0x8f, 0xde, 0xac, 0xc7, 0x4c, 0x67, 0x33, 0x77, 0xa3, 0x98, 0xb4, 0x84,
+  0x00, 0xd3, 0xda, 0x5e, 0xe4, 0x8f, 0x3a, 0x70, 0x0c, 0x97, 0xa0, 0x76,
+  0x32, 0xd4, 0xbd, 0xd9, 0xc5, 0x5f, 0x67, 0xba, 0xcf, 0x1e, 0x8c, 0x4c,
+  0x1c, 0x5d, 0xbb, 0x67, 0x24, 0x65, 0x7a, 0x95, 0xb5, 0x8a, 0x44, 0x4f,
+  0x1f, 0xbc, 0x4a, 0xa9, 0x87, 0x42, 0x06, 0x90, 0x87, 0xdc, 0xdd, 0x06,
+  0x5a, 0x1b, 0x20, 0x43, 0xac, 0xcd, 0xff, 0x23, 0x1b, 0x3f, 0xd8, 0x30,
+  0x16, 0x62, 0x9d, 0xab, 0x7b, 0xc9, 0x6f, 0xef, 0xf0, 0x53, 0x55, 0x0a,
+  0x00, 0x9f, 0xcc, 0x32, 0x7b, 0x75, 0xf0, 0xd1, 0x63, 0xf3, 0x33, 0x87,
+  0xfa, 0x75, 0xe7, 0xca, 0x59, 0xc1, 0xff, 0x21, 0xf9, 0x15, 0xcd, 0x3f,
+  0x34, 0x68, 0x59, 0x94, 0x35, 0x6d, 0x12, 0xd5, 0x93, 0xb9, 0x85, 0xc6,
+  0xcc, 0x68, 0x6e, 0x17, 0x40, 0x0c, 0xb9, 0x5c, 0x1f, 0xfd, 0xcc, 0x06,
+  0x44, 0x44, 0xf0, 0x90, 0xea, 0x55, 0x36, 0x40, 0x63, 0x70, 0x14, 0xb3,
+  0x6d, 0x38, 0x41, 0xba, 0xe4, 0x85, 0x97, 0x57, 0x79, 0x22, 0xe0, 0x94,
+  0x12, 0xd7, 0xb4, 0xd4, 0xfc, 0x9c, 0x3d, 0xe1, 0x12, 0x2c, 0x02, 0x8f,
+  0x67, 0x47, 0xf1, 0xe4, 0xc6, 0x0b, 0xa0, 0xf3, 0x16, 0x02, 0xb5, 0xa1,
+  0x2e, 0x87, 0x2a, 0xe7, 0x54, 0x76, 0x8b, 0xd5, 0x65, 0xbb, 0x48, 0x1f,
+  0x4f, 0x47, 0x46, 0x73, 0x35, 0x6d, 0x40, 0x62, 0x9a, 0x28, 0x7f, 0x6c,
+  0xcc, 0x77, 0x53, 0x17, 0xb0, 0xe3, 0x44, 0x31, 0x07, 0x3b, 0x95, 0xb6,
+  0x35, 0x33, 0x3c, 0x3a, 0xa2, 0xe6, 0x3d, 0x20, 0x24, 0x3c, 0x6c, 0xf6,
+  0x89, 0x5a, 0xd8, 0xc3, 0x46, 0x51, 0x27, 0x03, 0xa0, 0x99, 0x05, 0xb1,
+  0xee, 0x77, 0xd2, 0x94, 0x6e, 0x7a, 0x1c, 0xb2, 0xe2, 0xc6, 0x74, 0xcc,
+  0x74, 0x8d, 0x9a, 0x14, 0x68, 0x7f, 0xa9, 0x43, 0x66, 0xb9, 0x01, 0x7b,
+  0x4f, 0xfd, 0xb5, 0xa6, 0x80, 0xc1, 0xa9, 0x00, 0xbc, 0x0c, 0x12, 0xba,
+  0x0b, 0xc5, 0xf4, 0x13, 0xba, 0x86, 0x7c, 0xb7, 0xed, 0xf4, 0x57, 0x8c,
+  0xbe, 0x92, 0xa9, 0xe2, 0xa1, 0x9b, 0xae, 0x7a, 0xd7, 0x42, 0xd1, 0x41,
+  0x9a, 0x61, 0x29, 0xf0, 0x23, 0x37, 0x34, 0xd5, 0xdf, 0x81, 0x99, 0x42,
+  0x56, 0xa4, 0x96, 0xe9, 0x32, 0x75, 0xca, 0x55, 0x79, 0x83, 0xd5, 0x48,
+  0x74, 0x90, 0x64, 0xa3, 0x90, 0xbe, 0xe6, 0x80, 0xda, 0xf1, 0x91, 0x88,
+  0x2e, 0x67, 0x20, 0xeb, 0x86, 0x58, 0x1f, 0x16, 0x16, 0x75, 0xe4, 0xcc,
+  0x2b, 0xd3, 0xc8, 0xc1, 0x57, 0xd9, 0xf5, 0xc9, 0xf3, 0x1a, 0x7d, 0x22,
+  0xb5, 0xa0, 0xff, 0x79, 0xb3, 0x58, 0x0e, 0x24, 0x9c, 0x23, 0xf7, 0xac,
+  0xba, 0x24, 0xf8, 0xb0, 0xf0, 0xe9, 0xbc, 0x0a, 0x2c, 0xa5, 0xac, 0x9e,
+  0x6c, 0x18, 0x2e, 0xd4, 0x27, 0xeb, 0xec, 0x68, 0x19, 0xdc, 0x12, 0x73,
+  0x7c, 0x01, 0x61, 0xce, 0xda, 0xfb, 0x77, 0xd8, 0xfc, 0xe8, 0x6f, 0x14,
+  0x92, 0xe1, 0x86, 0xf5, 0xb5, 0xd9, 0x3a, 0xab, 0x06, 0x0c, 0xfa, 0x67,
+  0x10, 0x92, 0x4e, 0x67, 0x3d, 0x36, 0x39, 0x09, 0xd2, 0xfd, 0x28, 0x8c,
+  0xeb, 0xa5, 0xff, 0x0b, 0x50, 0x4b, 0x1d, 0x08, 0x65, 0xa7, 0xf8, 0xc6,
+  0xc0, 0xe1, 0x90, 0xa0, 0x31, 0x83, 0x2e, 0xcb, 0x06, 0xef, 0x61, 0x76,
+  0xef, 0x66, 0xe3, 0x8c, 0x75, 0xcc, 0x47, 0xa3, 0xf5, 0x07, 0xbf, 0x64,
+  0xeb, 0x41, 0xa3, 0xa2, 0x80, 0xf9, 0x5a, 0xff, 0x47, 0x07, 0x0f, 0x72,
+  0xf1, 0x21, 0xf8, 0x12, 0x01, 0xa3, 0x32, 0x2e, 0xce, 0x6f, 0xa6, 0x3a,
+  0x1d, 0x1a, 0x71, 0x6c, 0xc8, 0xa3, 0xad, 0x86, 0xfd, 0xcf, 0x2f, 0xbb,
+  0xc5, 0x16, 0x21, 0x74, 0x8b, 0xfa, 0x59, 0x54, 0xbb, 0xfa, 0x63, 0xfc,
+  0xaa, 0xb2, 0x73, 0x8c, 0x9e, 0xe0, 0xe7, 0x39, 0x22, 0x8e, 0x57, 0x8f,
+  0xd2, 0xd9, 0x0d, 0xc9, 0xd2, 0x79, 0xb9, 0x4f, 0x6b, 0x75, 0x4c, 0xf7,
+  0x02, 0x7e, 0xe7, 0xe9, 0x57, 0xf9, 0x02, 0x5f, 0xab, 0xed, 0xad, 0xb1,
+  0x73, 0xff, 0x4f, 0x4b, 0xb8, 0xbf, 0x02, 0x6a, 0xe5, 0x55, 0xf6, 0x72,
+  0xd8, 0xbe, 0xc6, 0xdb, 0x5c, 0x2f, 0xd1, 0x95, 0xaf, 0x0a, 0x81, 0x42,
+  0x63, 0xf1, 0x89, 0x64, 0x43, 0x68, 0xac, 0x49, 0x19, 0x7c, 0xb3, 0xfe,
+  0x29, 0x95, 0x1a, 0x7f, 0x0e, 0xb5, 0x3e, 0xde, 0x2f, 0xa0, 0xce, 0xc2,
+  0x20, 0x0f, 0x19, 0xe5, 0xa0, 0x1a, 0x06, 0xea, 0xda, 0x3a, 0x4d, 0x72,
+  0x9e, 0x7e, 0x5e, 0xe6, 0xb3, 0xd5, 0xe2, 0xfb, 0xfe, 0xd0, 0x65, 0x6b,
+  0xb9, 0x1a, 0x94, 0x1e, 0x6c, 0x55, 0x98, 0x04, 0xc2, 0xf5, 0x95, 0xcd,
+  0x4f, 0x34, 0x51, 0x93, 0x8b, 0x97, 0x22, 0xdd, 0xfd, 0xa8, 0x46, 0xe4,
+  0x95, 0x1f, 0x87, 0xcc, 0x4d, 0xde, 0x9c, 0x0d, 0x6a, 0x6a, 0xb8, 0xde,
+  0x3c, 0x5b, 0x70, 0x56, 0x86, 0x58, 0x76, 0x78, 0x9e, 0xaf, 0xcc, 0x1c,
+  0x75, 0x58, 0xa6, 0x12, 0x0d, 0xdd, 0x63, 0xf3, 0x35, 0x42, 0x45, 0x06,
+  0x85, 0x52, 0x33, 0xf5, 0xf0, 0xa3, 0x97, 0x0a, 0x26, 0x60, 0xd9, 0xb5,
+  0x6e, 0x19, 0x54, 0x04, 0x6c, 0x69, 0x36, 0xe3, 0x06, 0x20, 0x78, 0xe0,
+  0xe4, 0x76, 0x7d, 0x97, 0xcc, 0x85, 0x51, 0x2a, 0x15, 0xe6, 0xbe, 0xd3,
+  0x50, 0xe6, 0x5b, 0x8a, 0x32, 0x0d, 0x51, 0x0a, 0x48, 0xd3, 0x50, 0x44,
+  0xf2, 0x51, 0xe9, 0x59, 0xd0, 0x36, 0xe2, 0x20, 0xd6, 0x7e, 0xf1, 0xdd,
+  0xa8, 0x2c, 0x39, 0x19, 0xa8, 0x08, 0x73, 0x74, 0x71, 0xa7, 0xb3, 0x2f,
+  0xfe, 0x56, 0xe6, 0x5b, 0xf4, 0xf6, 0x42, 0x3b, 0x01, 0x0e, 0x79, 0x22,
+  0x3c, 0xa7, 0xaa, 0x41, 0x46, 0x01, 0x46, 0xc2, 0x9f, 0xbe, 0x23, 0x9c,
+  0x16, 0xbf, 0xe2, 0x10, 0x3f, 0xc2, 0x1a, 0x21, 0x72, 0x43, 0xdb, 0xc1,
+  0x8e, 0xf2, 0x63, 0x69, 0x51, 0xc7, 0x47, 0x5d, 0x2f, 0xaa, 0x60, 0xa3,
+  0xf2, 0x25, 0xb3, 0xe5, 0xf6, 0xff, 0x64, 0xf0, 0x5c, 0xc2, 0x90, 0x7b,
+  0x9c, 0x3c, 0xf5, 0xd3, 0x94, 0x3e, 0x1d, 0x35, 0xd1, 0x3e, 0xc3, 0x54,
+  0x92, 0x10, 0xd4, 0x6c, 0x8b, 0xab, 0x9d, 0xfa, 0xa9, 0x6b, 0x40, 0xa9,
+  0x3d, 0x74, 0xe2, 0x99, 0x25, 0xe1, 0x59, 0x89, 0xab, 0x49, 0xd8, 0x9c,
+  0xc1, 0x2e, 0x91, 0xfd, 0x59, 0x33, 0x24, 0x08, 0x4d, 0x2b, 0xfc, 0x9d,
+  0x55, 0x43, 0x36, 0x76, 0xd9, 0xbe, 0xdc, 0xae, 0x01, 0x51, 0xba, 0x21,
+  0xac, 0xbf, 0xeb, 0xc3, 0x78, 0x6d, 0xbb, 0xa6, 0xeb, 0x1d, 0x0a, 0x9b,
+  0x7c, 0xe5, 0x62, 0x9e, 0x9a, 0x1c, 0x0e, 0x9a, 0xfe, 0x63, 0xaf, 0xd7,
+  0xdc, 0x5c, 0x9d, 0x46, 0x06, 0xef, 0x70, 0x97, 0x83, 0xd0, 0x2f, 0x1b,
+  0xfa, 0xc5, 0x88, 0xb0, 0xe6, 0x31, 0x6e, 0x18, 0x8e, 0x39, 0x38, 0xdf,
+  0x38, 0x58, 0x42, 0xe9, 0x88, 0x68, 0x5a, 0xc7, 0xd4, 0x8b, 0x89, 0x70,
+  0x3b, 0x49, 0x1e, 0x7c, 0xa1, 0xb7, 0xd5, 0x3b, 0x10, 0xed, 0x69, 0xa4,
+  0xc2, 0x35, 0xef, 0xc3, 0xec, 0xd5, 0x27, 0xb6, 0xdb, 0x44, 0x5b, 0x24,
+  0xb6, 0xf2, 0x60, 0x03, 0x68, 0x50, 0x46, 0x6b, 0xd1, 0x54, 0xb6, 0x51,
+  0x58, 0x1d, 0xe4, 0xb3, 0x11, 0x2e, 0xb3, 0xd0, 0x4b, 0xc6, 0x40, 0xd9,
+  0x45, 0xaa, 0xdf, 0xd6, 0x52, 0x58, 0x8b, 0xeb, 0x13, 0xd2, 0x67, 0xac,
+  0x37, 0x61, 0x61, 0xd2, 0xc9, 0xed, 0xbf, 0x37, 0x8a, 0x69, 0xe2, 0xfe,
+  0x2c, 0x76, 0xdf, 0xfe, 0xd7, 0x17, 0xf9, 0x92, 0x76, 0xdb, 0x4f, 0x6f,
+  0xc1, 0x6c, 0xf1, 0x8a, 0x10, 0x41, 0x2f, 0xfe, 0x2c, 0xfc, 0xbb, 0x0e,
+  0x2f, 0xce, 0x63, 0x29, 0xf0, 0x32, 0x63, 0x6d, 0x44, 0x14, 0x7d, 0x6d,
+  0x43, 0x88, 0x33, 0x51, 0x4e, 0x4c, 0xdd, 0x90, 0xb6, 0xa8, 0x6d, 0x18,
+  0xd6, 0xc7, 0x54, 0x14, 0x21, 0x9a, 0xa7, 0xec, 0xb2, 0xd6, 0x23, 0x1e,
+  0xbe, 0x9f, 0x44, 0xf2, 0xb7, 0x71, 0xf2, 0xaa, 0x8f, 0x1d, 0x3c, 0x1c,
+  0xe4, 0x25, 0xce, 0x25, 0xc6, 0x8b, 0x4f, 0x61, 0x63, 0x7e, 0x32, 0x7b,
+  0xe8, 0xa7, 0x97, 0xaf, 0x9f, 0x2a, 0x77, 0x87, 0xe8, 0x2d, 0xf7, 0x06,
+  0x0d, 0x23, 0x6a, 0x0f, 0xef, 0xbb, 0xe9, 0x31, 0xb8, 0x5d, 0xe6, 0x68,
+  0xf9, 0x05, 0x54, 0x4b, 0x89, 0xde, 0xeb, 0x4c, 0xd1, 0x91, 0xb4, 0xda,
+  0xa1, 0xbc, 0x73, 0x2c, 0xa1, 0x95, 0xd8, 0xc8, 0xeb, 0x8a, 0xa2, 0x82,
+  0x60, 0x73, 0x4f, 0xf7, 0x80, 0x96, 0x1a, 0x23, 0x10, 0x62, 0x07, 0xde,
+  0x0c, 0x38, 0xfc, 0x23, 0x4a, 0x69, 0xf3, 0x09, 0xdd, 0xd1, 0x2d, 0xc0,
+  0x52, 0xd8, 0xe9, 0x34, 0x9d, 0xc3, 0x21, 0xdf, 0x2a, 0xdd, 0x78, 0x92,
+  0xf9, 0x21, 0x0a, 0xf4, 0xbc, 0x61, 0x4e, 0x13, 0x03, 0xa3, 0x3e, 0x56,
+  0x20, 0x63, 0x0a, 0x18, 0x3b, 0x45, 0xee, 0x2f, 0x5c, 0x2e, 0x64, 0x79,
+  0x8e, 0x5f, 0xdf, 0x56, 0x3d, 0x0a, 0x44, 0xa1, 0xe0, 0x7d, 0xd6, 0x9c,
+  0xd7, 0xaf, 0xba, 0xfc, 0xf4, 0x64, 0xb8, 0x61, 0xe3, 0x69, 0x02, 0xb8,
+  0x16, 0x39, 0xc5, 0xae, 0x5c, 0xc3, 0xfe, 0x5e, 0xe5, 0xa0, 0xc4, 0xad,
+  0xe9, 0xdc, 0xd4, 0x91, 0x76, 0x7d, 0xd4, 0xb3, 0x82, 0x4d, 0x23, 0x39,
+  0x85, 0xf5, 0x17, 0x54, 0x59, 0xb2, 0x0c, 0x83, 0xfc, 0x5f, 0xba, 0x3c,
+  0xd3, 0x65, 0xf9, 0x86, 0x06, 0xc2, 0x95, 0x59, 0x5a, 0x1c, 0xf2, 0x1c,
+  0x2c, 0xe1, 0x6a, 0xc7, 0xd9, 0xf3, 0xc7, 0xe3, 0xdf, 0xff, 0xa7, 0xba,
+  0x66, 0x7b, 0x0b, 0x3f, 0x4f, 0x47, 0xbc, 0x7c, 0x7d, 0xf7, 0x0a, 0x9f,
+  0xae, 0x1c, 0xa6, 0xfd, 0xf1, 0x94, 0xe8, 0x3c, 0x47, 0x9d, 0x2a, 0xce,
+  0xfc, 0x04, 0xd5, 0x6c, 0x11, 0x11, 0xe6, 0x20, 0xca, 0xe0, 0xc5, 0x01,
+  0x31, 0x3b, 0x46, 0x16, 0xde, 0x85, 0x6d, 0x3c, 0xff, 0x27, 0x5f, 0x5a,
+  0x75, 0x13, 0x9a, 0x53, 0xc8, 0x89, 0x9b, 0x5f, 0x77, 0xde, 0x1d, 0xbc,
+  0xf7, 0x23, 0x6b, 0x1a, 0xeb, 0xa0, 0xd1, 0x79, 0x40, 0xb9, 0x0e, 0x89,
+  0x17, 0x29, 0x24, 0x6a, 0x13, 0x89, 0x1e, 0x6d, 0x5c, 0x8d, 0x48, 0x1f,
+  0x6b, 0x55, 0xeb, 0x64, 0x9e, 0x81, 0x6c, 0x43, 0x3b, 0x5e, 0x34, 0x86,
+  0x8d, 0x40, 0x0e, 0x92, 0x12, 0xd3, 0x64, 0x76, 0xe7, 0x7d, 0x07, 0xa1,
+  0x14, 0x39, 0xd2, 0x3e, 0x83, 0x69, 0x2e, 0x95, 0xb4, 0x1a, 0xf9, 0x1f,
+  0x60, 0x47, 0xf3, 0xe9, 0x85, 0x8c, 0xc4, 0xeb, 0x3c, 0xf8, 0x7d, 0xf0,
+  0xfe, 0x3a, 0x9e, 0x5e, 0x65, 0xb4, 0x5d, 0xbe, 0xf9, 0xe4, 0xa8, 0x5d,
+  0x4d, 0x56, 0x66, 0x01, 0x80, 0x8c, 0x72, 0x02, 0x85, 0xd2, 0xa6, 0x05,
+  0x9c, 0x0a, 0xf1, 0x35, 0xfa, 0xc6, 0x7c, 0xc5, 0x68, 0xd3, 0x2a, 0x51,
+  0x0a, 0xa4, 0x77, 0x29, 0x52, 0x91, 0x4c, 0x3d, 0x64, 0x9d, 0xab, 0x9b,
+  0xc3, 0x95, 0xf8, 0x83, 0x0e, 0x2c, 0x16, 0x5b, 0xd7, 0x69, 0xca, 0xf0,
+  0x6a, 0xdf, 0x72, 0x76, 0x14, 0xa2, 0x65, 0x67, 0xca, 0xe0, 0x47, 0x17,
+  0x4f, 0x31, 0xe9, 0x61, 0xc0, 0xf7, 0x68, 0x6d, 0xc1, 0x74, 0x6b, 0xbc,
+  0x6d, 0x31, 0xba, 0xfe, 0x81, 0x8d, 0x6e, 0x8f, 0xe0, 0xd0, 0xcc, 0x79,
+  0x30, 0xbf, 0xb1, 0xf3, 0xfe, 0x75, 0x4e, 0x3c, 0x0c, 0xec, 0xd6, 0xbf,
+  0x5b, 0x2c, 0xe7, 0x1a, 0x01, 0x52, 0x7d, 0xdb, 0xcc, 0x35, 0xcb, 0xfb,
+  0x15, 0xba, 0x66, 0xd2, 0x65, 0x09, 0x6e, 0xa5, 0x2b, 0xd0, 0x82, 0x13,
+  0x8d, 0x40, 0xe7, 0x83, 0x05, 0xc2, 0xd7, 0x0a, 0x1f, 0xbf, 0x1d, 0x92,
+  0xb4, 0x87, 0xb8, 0xba, 0x03, 0xfc, 0x35, 0x28, 0xda, 0x7e, 0x20, 0xce,
+  0x0a, 0xe1, 0xf8, 0x8d, 0xe7, 0x48, 0xf1, 0xb8, 0x07, 0x46, 0x2a, 0x43,
+  0x89, 0x3b, 0x10, 0xb8, 0x0b, 0x64, 0xb3, 0x83, 0xfa, 0x75, 0xea, 0x34,
+  0x1c, 0x57, 0xad, 0x02, 0xcb, 0x4c, 0xfc, 0xfc, 0x59, 0x65, 0xf7, 0x55,
+  0xde, 0xfe, 0xac, 0xbf, 0x4c, 0xd2, 0x41, 0xae, 0x75, 0x5c, 0xec, 0x0d,
+  0x21, 0xe9, 0x40, 0xad, 0x04, 0x68, 0x34, 0x64, 0x9e, 0xb0, 0xfd, 0x09,
+  0xa1, 0x7c, 0x0c, 0xb7, 0xdb, 0x3c, 0xe6, 0x90, 0x5c, 0x3a, 0xf4, 0xb0,
+  0xad, 0x97, 0x59, 0x2f, 0x77, 0x76, 0xa3, 0x03, 0xc2, 0x82, 0x22, 0xc2,
+  0x5e, 0x02, 0x2b, 0xa9, 0xca, 0xdb, 0x61, 0x05, 0xd7, 0x1e, 0xf6, 0x37,
+  0xad, 0x57, 0x85, 0xfc, 0xfa, 0x34, 0x4f, 0x2b, 0x68, 0xdd, 0x1e, 0xc2,
+  0x9e, 0x4e, 0xe0, 0x29, 0xac, 0x4c, 0x95, 0xd3, 0x3b, 0x19, 0x30, 0x1b,
+  0xfb, 0xaf, 0xc2, 0x54, 0xac, 0xdd, 0xf8, 0xb5, 0xe5, 0x0b, 0xee, 0xbd,
+  0xc7, 0x45, 0x00, 0x25, 0x6d, 0x11, 0x78, 0x05, 0xc9, 0xea, 0x56, 0x86,
+  0x67, 0x2b, 0x30, 0x52, 0xc9, 0x2d, 0x0a, 0x2c, 0x54, 0x97, 0x97, 0xd0,
+  0x8a, 0xbf, 0x7d, 0xb1, 0x1f, 0xc4, 0x1b, 0xe3, 0xd3, 0x94, 0x2d, 0x54,
+  0xb8, 0xc6, 0x78, 0xbc, 0x97, 0x95, 0xe8, 0x79, 0x8e, 0x88, 0x23, 0x7f,
+  0xf2, 0x86, 0x6f, 0x13, 0xe1, 0xb2, 0x29, 0x2c, 0xec, 0x76, 0xe4, 0x0e,
+  0x3d, 0xdf, 0x81, 0x65, 0x1c, 0x3c, 0x6e, 0x0c, 0xe3, 0xbb, 0x9e, 0xa2,
+  0xa7, 0x07, 0x7b, 0xe9, 0xf1, 0xc9, 0xa9, 0xb4, 0x61, 0x21, 0xe6, 0x7e,
+  0x25, 0xcf, 0xbd, 0xba, 0xdd, 0x35, 0x45, 0x62, 0xa0, 0x75, 0x84, 0x73,
+  0xce, 0xf0, 0xf8, 0x6b, 0xc7, 0xc5, 0xc2, 0x07, 0x36, 0x4b, 0x2a, 0xbe,
+  0x41, 0x52, 0x99, 0x06, 0x32, 0xfc, 0x6d, 0xb4, 0xfc, 0x9d, 0x14, 0xf1,
+  0x72, 0xfd, 0x83, 0x1c, 0x8b, 0x52, 0xf6, 0xa1, 0xcb, 0x94, 0x55, 0xaa,
+  0x18, 0xe3, 0x72, 0x98, 0xb2, 0xa0, 0xa8, 0x43, 0x98, 0xcc, 0xae, 0x26,
+  0xbf, 0xc4, 0xf9, 0x74, 0x2a, 0x31, 0xe9, 0xd1, 0xda, 0x42, 0x58, 0xb4,
+  0x94, 0xbf, 0x17, 0x53, 0x07, 0xb3, 0x25, 0xe1, 0xc3, 0xaa, 0x09, 0x7c,
+  0x52, 0x68, 0x0f, 0x4b, 0x8b, 0x28, 0xff, 0xed, 0x57, 0x1a, 0xf0, 0x0d,
+  0x71, 0x59, 0xec, 0x07, 0x9c, 0x29, 0x81, 0x11, 0x35, 0xcc, 0x0f, 0x94,
+  0x54, 0x01, 0x2a, 0xe2, 0xf7, 0x5f, 0x17, 0xda, 0x26, 0x50, 0x94, 0x27,
+  0x07, 0xbf, 0x6d, 0xb7, 0x42, 0xc8, 0xcd, 0x57, 0xa5, 0x76, 0xc5, 0x44,
+  0x8e, 0x42, 0x14, 0x1a, 0x15, 0xef, 0x52, 0x80, 0x0a, 0xa6, 0xc7, 0x42,
+  0x77, 0x4f, 0xa3, 0xb8, 0x1b, 0xef, 0xce, 0xa1, 0x74, 0x33, 0x2d, 0x71,
+  0xea, 0x06, 0xb8, 0x17, 0x81, 0x65, 0xfe, 0x36, 0x88, 0x57, 0xb7, 0xe1,
+  0x68, 0x9b, 0x08, 0x36, 0x67, 0xcd, 0x65, 0xdc, 0x9e, 0xdb, 0x43, 0xca,
+  0x84, 0x8a, 0x41, 0x42, 0xac, 0x31, 0xa8, 0xd0, 0xf1, 0x66, 0x41, 0x11,
+  0x06, 0xd2, 0x54, 0x7d, 0x2c, 0xcd, 0xab, 0x72, 0xd2, 0xe9, 0x4a, 0xb5,
+  0x48, 0x12, 0xed, 0x6d, 0xa3, 0x3c, 0xf6, 0xda, 0x09, 0x85, 0xdd, 0x34,
+  0xac, 0xbb, 0x3d, 0x41, 0x6e, 0x97, 0x22, 0xd6, 0x20, 0x2f, 0x1a, 0xa3,
+  0x51, 0x18, 0xf7, 0x9b, 0xe4, 0xd4, 0x0a, 0x1a, 0x91, 0xc8, 0x12, 0x80,
+  0x4a, 0xbf, 0xc4, 0xe6, 0x1c, 0xa5, 0xd8, 0xbd, 0x59, 0x34, 0x83, 0xd7,
+  0xd4, 0xf9, 0x6a, 0xd6, 0x62, 0xda, 0xbc, 0x7a, 0xcc, 0xb9, 0x29, 0x22,
+  0x6d, 0x34, 0x20, 0x89, 0xd7, 0xd8, 0xfa, 0xcb, 0x32, 0xab, 0xe9, 0xf8,
+  0x9e, 0x6d, 0xa8, 0x46, 0x70, 0xc1, 0x1d, 0x1a, 0x73, 0x03, 0xd9, 0xd8,
+  0x24, 0x6f, 0xbd, 0x7e, 0x6c, 0xf7, 0x91, 0xa6, 0x4b, 0x1f, 0xfa, 0xb7,
+  0x1a, 0xca, 0x34, 0x76, 0xab, 0x80, 0x39, 0x2b, 0x78, 0xe7, 0x7e, 0xd7,
+  0xfa, 0x40, 0xfe, 0xf5, 0x0a, 0x0d, 0x12, 0x42, 0x6c, 0x8b, 0x85, 0xa4,
+  0x32, 0x34, 0xaa, 0x4f, 0x92, 0x92, 0x9b, 0x56, 0x71, 0xfe, 0x21, 0x54,
+  0x54, 0x34, 0x90, 0x98, 0x52, 0x2a, 0x8f, 0xb6, 0xb7, 0x01, 0xea, 0x1d,
+  0x12, 0x97, 0x8b, 0x63, 0xac, 0x34, 0x80, 0xa4, 0x10, 0xe5, 0x07, 0x6c,
+  0x1a, 0xf1, 0xc3, 0x23, 0xdf, 0xa6, 0x9e, 0x6f, 0x90, 0xf3, 0x7c, 0x25,
+  0xe3, 0x89, 0x09, 0x45, 0x3f, 0xbb, 0x85, 0x00, 0xb2, 0xa8, 0xe5, 0xfc,
+  0x56, 0x73, 0x15, 0x68, 0x78, 0x32, 0xc9, 0x73, 0x92, 0x32, 0x69, 0xdf,
+  0xa4, 0xa4, 0x68, 0xac, 0x52, 0x8a, 0x0f, 0x8f, 0x30, 0x12, 0x4d, 0xf3,
+  0x50, 0xe9, 0xc2, 0xaf, 0x92, 0x06, 0x28, 0xd5, 0xa4, 0x00, 0x9b, 0x83,
+  0x09, 0xc0, 0xce, 0x5c, 0x0c, 0x64, 0x32, 0x40, 0xd0, 0xc7, 0x4f, 0x17,
+  0x24, 0x42, 0xb7, 0xea, 0x02, 0x4e, 0xed, 0xd5, 0x89, 0x77, 0xae, 0x42,
+  0x3f, 0xe5, 0x1c, 0x55, 0xe5, 0x5a, 0x70, 0x18, 0x0b, 0xbd, 0x7a, 0x30,
+  0x00, 0xa1, 0x87, 0x73, 0x45, 0x96, 0x94, 0x71, 0x01, 0xb9, 0x64, 0x42,
+  0x46, 0x9d, 0xe3, 0x07, 0xce, 0x28, 0x7c, 0xfb, 0x50, 0x90, 0xd4, 0x53,
+  0x1a, 0x68, 0x77, 0x15, 0x1b, 0x1f, 0x53, 0x93, 0xa1, 0x13, 0x8d, 0xed,
+  0xeb, 0xc0, 0x65, 0x22, 0xc1, 0x5c, 0x02, 0x94, 0x7b, 0xc2, 0xe4, 0x1e,
+  0xfb, 0x52, 0x46, 0x69, 0xf8, 0xde, 0x7c, 0xbf, 0xa4, 0xa1, 0x22, 0x0f,
+  0x66, 0x10, 0xbe, 0x6d, 0x00, 0x8e, 0x1d, 0x03, 0x3a, 0xda, 0x03, 0x69,
+  0xa9, 0xe3, 0x2d, 0x91, 0x3a, 0x67, 0x4d, 0x17, 0xa2, 0x33, 0xe0, 0x8b,
+  0x04, 0x27, 0x8d, 0x83, 0xc5, 0x1c, 0x4f, 0xb4, 0x9e, 0xf3, 0xb4, 0x6a,
+  0xae, 0x50, 0xa8, 0xf3, 0xc5, 0xc1, 0x68, 0x87, 0x83, 0x92, 0x91, 0x2a,
+  0x4e, 0x25, 0x27, 0x52, 0x7f, 0xf4, 0x83, 0xeb, 0x7b, 0xb3, 0xe9, 0x7a,
+  0xef, 0x83, 0x7a, 0x16, 0x51, 0xb2, 0xbe, 0xe2, 0x22, 0xd3, 0x80, 0xd3,
+  0x63, 0x6e, 0xb6, 0xe9, 0x40, 0xd4, 0xc9, 0x4b, 0x2c, 0x32, 0x46, 0x07,
+  0x26, 0x62, 0x31, 0x25, 0x52, 0x94, 0xb5, 0x6a, 0x55, 0x0d, 0x8f, 0x91,
+  0x39, 0xa0, 0x27, 0x62, 0x2a, 0x7b, 0xda, 0x19, 0x8b, 0xaa, 0xdf, 0x4d,
+  0x74, 0x37, 0x3b, 0x05, 0x4d, 0x8f, 0xfc, 0x1c, 0xdc, 0xde, 0x01, 0x06,
+  0x80, 0x0e, 0x7f, 0xa0, 0x54, 0x95, 0xed, 0xa7, 0x5c, 0x9f, 0x40, 0x2f,
+  0x22, 0xf0, 0xad, 0xd0, 0x62, 0x5c, 0x20, 0xec, 0xe8, 0x7c, 0x8d, 0xf2,
+  0x6d, 0xe0, 0x4c, 0x0d, 0x82, 0x51, 0xc8, 0xcc, 0x1d, 0x39, 0xe6, 0xc3,
+  0x7c, 0x00, 0x9d, 0xae, 0x50, 0x47, 0x9c, 0x07, 0x5a, 0x08, 0x9f, 0xe1,
+  0xd0, 0x93, 0xf9, 0x49, 0x55, 0x1f, 0x2e, 0xe9, 0xd4, 0x5d, 0xeb, 0x46,
+  0x20, 0x85, 0x36, 0xc0, 0x82, 0x89, 0x42, 0x8b, 0xcf, 0xa1, 0x31, 0xd0,
+  0x8f, 0xee, 0x07, 0x07, 0xfc, 0x2c, 0xfe, 0x73, 0xdb, 0xdb, 0x0c, 0x7a,
+  0x73, 0xaa, 0x6d, 0x14, 0xe7, 0xed, 0x9e, 0xb6, 0xcf, 0xc4, 0x3e, 0x44,
+  0x39, 0x09, 0xdd, 0xe1, 0x2c, 0x1f, 0x47, 0xee, 0x2f, 0xfe, 0x77, 0x9a,
+  0x9f, 0xe5, 0xe0, 0x23, 0x77, 0xd5, 0x4a, 0xd0, 0x51, 0x3a, 0x78, 0x7b,
+  0x73, 0xf2, 0xd9, 0xc9, 0x2c, 0x41, 0x3b, 0xe4, 0x79, 0x01, 0x5c, 0xba,
+  0xef, 0x5b, 0x33, 0xa9, 0xeb, 0xe0, 0x17, 0x93, 0xc1, 0xe5, 0x82, 0x76,
+  0x9d, 0xff, 0x50, 0xb4, 0x82, 0x17, 0x39, 0x37, 0xa1, 0x4e, 0x7c, 0x00,
+  0xd8, 0x3c, 0xda, 0x17, 0x06, 0x1e, 0x03, 0x24, 0x4c, 0xe6, 0xfe, 0x6e,
+  0x6e, 0xff, 0x5a, 0x30, 0xda, 0xf0, 0x45, 0x65, 0x35, 0xb5, 0x76, 0xbf,
+  0xb7, 0x3a, 0xcf, 0xea, 0xcf, 0xa9, 0x10, 0xcc, 0x1b, 0x2e, 0x75, 0x4d,
+  0x74, 0xd1, 0x38, 0x56, 0xa3, 0xa4, 0xdb, 0x70, 0x18, 0xc2, 0xd0, 0x64,
+  0x45, 0x52, 0x5c, 0xd7, 0xd5, 0x19, 0x79, 0xa8, 0x55, 0x64, 0x80, 0x58,
+  0xeb, 0x6f, 0x57, 0x3c, 0xf1, 0x7a, 0x10, 0x66, 0xf9, 0x83, 0xa3, 0x89,
+  0xb1, 0xd4, 0x77, 0xe1, 0xa7, 0xc8, 0xa4, 0x66, 0x96, 0xa4, 0x71, 0xaa,
+  0xa6, 0x54, 0x69, 0x85, 0xbf, 0x81, 0xed, 0xc1, 0x25, 0x24, 0x53, 0x93,
+  0x97, 0x66, 0x8a, 0xcd, 0x48, 0xb9, 0xab, 0x90, 0xea, 0xe1, 0xac, 0xe4,
+  0xbb, 0xbd, 0x4a, 0x51, 0x75, 0xe5, 0xf9, 0xb3, 0x61, 0x5f, 0xca, 0x0f,
+  0xbd, 0x94, 0x13, 0xcb, 0x8e, 0x4a, 0x02, 0xe0, 0x46, 0x38, 0x13, 0x11,
+  0x2b, 0x8c, 0x26, 0x85, 0x8d, 0xe4, 0x8e, 0x0f, 0x5b, 0x10, 0x7b, 0xf8,
+  0xf9, 0x58, 0xb5, 0xf9, 0xe4, 0x8c, 0xb1, 0x15, 0x0d, 0xe4, 0xa5, 0xdd,
+  0xf4, 0x2e, 0x29, 0xec, 0x20, 0xf6, 0x5a, 0x2e, 0xb9, 0x92, 0xea, 0xc3,
+  0x66, 0xc1, 0xdf, 0x06, 0x34, 0x00, 0x15, 0x86, 0x1c, 0xd6, 0x65, 0x66,
+  0xd6, 0xe0, 0xf4, 0x52, 0x1a, 0x11, 0xdc, 0xf7, 0x94, 0x92, 0x53, 0x6d,
+  0x4c, 0x83, 0x0b, 0x89, 0x0b, 0x6b, 0x79, 0xab, 0x24, 0x75, 0xb7, 0x59,
+  0xe8, 0x06, 0xdf, 0x6f, 0x08, 0x40, 0xb7, 0xcf, 0x38, 0x0e, 0x72, 0xfc,
+  0x21, 0xa2, 0x4f, 0x07, 0x2a, 0xff, 0x70, 0x3e, 0x7a, 0xd7, 0x53, 0xd5,
+  0x1f, 0x27, 0x72, 0x0d, 0x58, 0x54, 0x6d, 0x53, 0x92, 0x5c, 0xe6, 0x32,
+  0x2c, 0xc3, 0xe5, 0xb3, 0xf2, 0x77, 0xaf, 0x7e, 0x4a, 0x96, 0x40, 0x65,
+  0xf7, 0x1d, 0x99, 0x87, 0xfe, 0x26, 0x0f, 0xae, 0x12, 0x7a, 0xd1, 0x10,
+  0xd4, 0x52, 0x99, 0x4f, 0x38, 0xa0, 0xfc, 0xe1, 0xfc, 0x90, 0xcd, 0x01,
+  0xcf, 0xa0, 0xca, 0xa8, 0x19, 0xfe, 0xa6, 0x8a, 0x64, 0x6b, 0xf8, 0xef,
+  0x08, 0x9d, 0x35, 0x66, 0xff, 0x08, 0x12, 0x19, 0xc6, 0x4e, 0x6f, 0xcc,
+  0xd4, 0xbe, 0xda, 0xdb, 0x0e, 0xe1, 0x25, 0xc1, 0xd2, 0x3d, 0x00, 0xba,
+  0x14, 0xa6, 0x64, 0x3f, 0x72, 0x0f, 0x0d, 0x2a, 0xfe, 0x30, 0xe8, 0xe4,
+  0x26, 0x22, 0x54, 0x54, 0x44, 0xe7, 0x0f, 0xf3, 0x83, 0xb1, 0x47, 0x09,
+  0xf1, 0xcd, 0x24, 0x4a, 0x63, 0xee, 0x99, 0xfc, 0xf1, 0x8a, 0x78, 0x21,
+  0x01, 0xa9, 0xc6, 0x42, 0x58, 0xb5, 0x3e, 0xc4, 0x30, 0xd5, 0x25, 0x2c,
+  0x77, 0x5c, 0xf6, 0x69, 0xe7, 0xb2, 0x66, 0x05, 0xa7, 0xc9, 0x13, 0x0d,
+  0x57, 0xc8, 0xac, 0xd3, 0xaa, 0x05, 0xc1, 0x44, 0xc6, 0x66, 0xf4, 0x66,
+  0x5b, 0xd2, 0x44, 0xa5, 0xa4, 0x2a, 0xce, 0x37, 0x42, 0x3d, 0xcc, 0xc1,
+  0x97, 0x38, 0xfc, 0x73, 0xa1, 0x5a, 0x6f, 0x04, 0x3b, 0x4b, 0x47, 0x78,
+  0xb0, 0xa0, 0x6b, 0x0e, 0xbe, 0x28, 0x5b, 0xb3, 0x97, 0x1a, 0xb7, 0xcd,
+  0x18, 0x28, 0x41, 0x09, 0xa4, 0xf9, 0xd4, 0xad, 0x47, 0x8b, 0xcb, 0xd4,
+  0x87, 0x8a, 0x77, 0x1a, 0x7c, 0xb3, 0x5b, 0xda, 0xdb, 0xca, 0x3c, 0xa2,
+  0xf6, 0x15, 0xe4, 0xe1, 0x34, 0x46, 0x63, 0x16, 0x5b, 0x1d, 0x78, 0x79,
+  0xe6, 0xc7, 0x7e, 0x95, 0x11, 0x38, 0xfd, 0xd0, 0x36, 0x02, 0x13, 0x02,
+  0xe6, 0x75, 0xb3, 0x30, 0x58, 0x9b, 0x05, 0x04, 0x8a, 0x85, 0xfe, 0xe8,
+  0x72, 0x30, 0x28, 0xb6, 0x8c, 0x01, 0xa9, 0x2c, 0x99, 0x3c, 0x69, 0x6c,
+  0xcf, 0x8d, 0xb4, 0xb1, 0xa9, 0x98, 0xd3, 0x25, 0xd2, 0xe6, 0x1a, 0x7a,
+  0x6e, 0xbe, 0x8d, 0xa3, 0x4a, 0x63, 0x02, 0x11, 0xb2, 0xcc, 0xb9, 0x84,
+  0xc6, 0x29, 0x50, 0x44, 0x92, 0xdf, 0x35, 0xa0, 0xd0, 0xfa, 0xdc, 0x44,
+  0x96, 0xc5, 0x2f, 0x98, 0xf9, 0xfc, 0x48, 0xb9, 0x93, 0x76, 0xbc, 0xf2,
+  0x3a, 0x68, 0x6b, 0x9e, 0x82, 0x69, 0x3a, 0xec, 0x7f, 0x55, 0xb8, 0x68,
+  0x24, 0x0d, 0xdb, 0x39, 0x1a, 0x32, 0xcb, 0x04, 0x90, 0x03, 0x2b, 0x4e,
+  0xa8, 0xc8, 0xcc, 0xc2, 0x1a, 0x77, 0x23, 0x82, 0x2a, 0xd6, 0x1c, 0x2d,
+  0xdc, 0x0c, 0x5e, 0x82, 0x0c, 0x08, 0x9c, 0xa0, 0x5b, 0xd8, 0x5f, 0xd6,
+  0x66, 0x74, 0xbc, 0x20, 0x03, 0x4c, 0x6f, 0xfc, 0xf5, 0x2d, 0x49, 0xab,
+  0x47, 0x2b, 0xc4, 0xdb, 0x7e, 0x2d, 0x5a, 0xc7, 0x6e, 0x75, 0xb1, 0x26,
+  0x32, 0x2b, 0xc0, 0xba, 0xd3, 0x05, 0x87, 0x70, 0x88, 0xf2, 0x52, 0x53,
+  0xd9, 0x39, 0x0c, 0x3e, 0x35, 0x9a, 0xdd, 0x93, 0xd3, 0x5c, 0x18, 0x3e,
+  0x76, 0x80, 0xad, 0x2a, 0x61, 0x27, 0x77, 0x3f, 0xc5, 0xe5, 0x5a, 0xa0,
+  0x8f, 0x6a, 0x64, 0x34, 0xc7, 0x97, 0xbf, 0xfa, 0x7d, 0xaf, 0xd2, 0x0a,
+  0x78, 0xb8, 0x92, 0x17, 0xf1, 0xec, 0x52, 0x9f, 0x17, 0x60, 0xb3, 0x1f,
+  0x7b, 0xc9, 0x4c, 0x39, 0x1b, 0x78, 0x0f, 0x96, 0xfe, 0xd5, 0x0d, 0xc4,
+  0x81, 0x77, 0xfc, 0x01, 0x84, 0x21, 0x00, 0xfa, 0x50, 0x8b
+};
+unsigned int encrypted_aes128_10k_gpg_len = 8134;
@@ -0,0 +1,681 @@
+unsigned char encrypted_aes256_10k_gpg[] = {
+  0x8c, 0x0d, 0x04, 0x09, 0x03, 0x02, 0x28, 0x6f, 0x70, 0xc4, 0xe0, 0x9e,
+  0x6c, 0xec, 0xff, 0xd2, 0xde, 0xf4, 0x01, 0x63, 0x74, 0x6c, 0x33, 0x74,
+  0x9e, 0xc2, 0x6b, 0xc6, 0xf7, 0xb9, 0x9f, 0xd9, 0xf5, 0x42, 0xe5, 0xda,
+  0xbc, 0x9b, 0x80, 0xab, 0x26, 0x27, 0xc4, 0x68, 0xac, 0x21, 0x12, 0xd0,
+  0x5e, 0x15, 0xd3, 0xc0, 0x6b, 0xd6, 0x7f, 0xbf, 0xd0, 0x9e, 0x90, 0x9f,
+  0x54, 0x98, 0xed, 0xfd, 0x43, 0x19, 0xcd, 0xd0, 0xb4, 0xca, 0x39, 0x04,
+  0xbb, 0x0a, 0xa4, 0xa8, 0xdb, 0xa1, 0x2a, 0xec, 0x93, 0x7d, 0x9f, 0xf1,
+  0x69, 0x5d, 0x79, 0xa4, 0x2e, 0x78, 0x08, 0x90, 0xda, 0x81, 0x44, 0xc4,
+  0xbd, 0x9c, 0x59, 0xbd, 0x2f, 0xa8, 0x0d, 0x70, 0x86, 0x57, 0x4e, 0xd7,
+  0x00, 0x6b, 0x3b, 0xb0, 0xf1, 0xf2, 0xa2, 0xbf, 0x08, 0x26, 0x53, 0xdb,
+  0xb5, 0x78, 0x6d, 0xa4, 0xf2, 0x64, 0x89, 0x2f, 0x8e, 0x12, 0x4d, 0x5e,
+  0x01, 0xa3, 0xc9, 0x0b, 0x63, 0x4c, 0x67, 0xc9, 0x21, 0x91, 0xb8, 0x30,
+  0xf9, 0xd8, 0x24, 0x37, 0x7f, 0x7e, 0xbe, 0x0d, 0x8d, 0xc4, 0xa2, 0x99,
+  0x60, 0xf9, 0x25, 0x07, 0x75, 0x76, 0x89, 0x4f, 0xaa, 0x2d, 0x2f, 0x8a,
+  0x47, 0xce, 0x6a, 0x53, 0xc0, 0x5f, 0x02, 0x3f, 0x89, 0xb6, 0x92, 0x48,
+  0x7a, 0xae, 0x7d, 0xfa, 0xa0, 0x31, 0x44, 0x48, 0x00, 0xe5, 0x69, 0x25,
+  0xfe, 0x5a, 0xd9, 0xad, 0x1e, 0xeb, 0xd2, 0x85, 0xd6, 0x30, 0xd7, 0xb4,
+  0x98, 0x76, 0x5c, 0x64, 0xc2, 0x9d, 0x1b, 0xf1, 0xbb, 0xb2, 0x14, 0x3a,
+  0x84, 0xed, 0xe8, 0x6f, 0xc1, 0x99, 0xf6, 0x9a, 0xca, 0xb6, 0xea, 0x25,
+  0x35, 0x66, 0x0c, 0x4a, 0x2c, 0xd0, 0x01, 0x46, 0x48, 0xbc, 0x63, 0x98,
+  0xb1, 0x88, 0xfe, 0x0b, 0x05, 0xd7, 0xd7, 0x44, 0x2b, 0x6b, 0x19, 0x7f,
+  0x77, 0xa1, 0xb4, 0x5e, 0xc3, 0xc4, 0x77, 0x2e, 0x6a, 0x7d, 0xaf, 0xb6,
+  0x86, 0x7d, 0x25, 0x23, 0xec, 0x75, 0x32, 0x97, 0xac, 0xfe, 0x03, 0xbb,
+  0xd9, 0x25, 0x79, 0x46, 0x57, 0xb1, 0xa6, 0x4b, 0xcd, 0x63, 0x65, 0xc9,
+  0x62, 0x0b, 0x8a, 0x18, 0x3e, 0x7b, 0x5f, 0x05, 0x52, 0x93, 0x50, 0x03,
+  0x9a, 0x4c, 0xea, 0xda, 0xaa, 0x2a, 0xab, 0x27, 0xf6, 0x03, 0x8f, 0xa9,
+  0x4b, 0x4d, 0x52, 0xc7, 0x76, 0xb6, 0x50, 0x7d, 0x00, 0x06, 0x0f, 0x0b,
+  0x5a, 0x59, 0xea, 0xae, 0x02, 0xdb, 0x1d, 0xfd, 0xd1, 0x43, 0x40, 0x80,
+  0x99, 0x5e, 0xaf, 0x9c, 0xb2, 0x5d, 0x92, 0x69, 0x2d, 0xc3, 0xcd, 0x53,
+  0x57, 0x4b, 0x57, 0xb3, 0x99, 0x2b, 0x0d, 0x48, 0xcf, 0xb5, 0xbd, 0xf9,
+  0xbe, 0x96, 0x93, 0x5e, 0xd3, 0x0f, 0x08, 0xea, 0x5f, 0xf8, 0x72, 0x27,
+  0xf6, 0x37, 0x35, 0x66, 0xef, 0x32, 0x47, 0x18, 0x16, 0x55, 0xd7, 0x21,
+  0x77, 0x49, 0x88, 0xdc, 0xee, 0x65, 0xff, 0xf4, 0xfc, 0xdb, 0x55, 0xe8,
+  0x54, 0x01, 0x4b, 0x8d, 0xff, 0x53, 0x9f, 0xc0, 0xf9, 0xcf, 0xfe, 0xc9,
+  0x90, 0x98, 0xe5, 0x92, 0xcb, 0x26, 0xf8, 0x61, 0x08, 0xf7, 0x92, 0x04,
+  0x7e, 0xaf, 0x14, 0x5a, 0xfd, 0x9a, 0x0e, 0x7c, 0x1c, 0x84, 0x59, 0x14,
+  0xb2, 0x0f, 0x23, 0x61, 0xa7, 0x56, 0xad, 0xd6, 0x6e, 0x64, 0xc7, 0xec,
+  0x59, 0xdf, 0x17, 0x35, 0xe8, 0xdc, 0xef, 0xa3, 0xb1, 0xaa, 0xc0, 0x5e,
+  0xd8, 0xb6, 0x0a, 0x93, 0xf9, 0x00, 0x56, 0x89, 0x94, 0x66, 0x2c, 0x66,
+  0x7c, 0x15, 0xe6, 0xe6, 0x83, 0x14, 0x34, 0x03, 0xf2, 0xad, 0x99, 0xd8,
+  0xf4, 0x97, 0x96, 0x24, 0xfd, 0x56, 0xc0, 0x22, 0xee, 0x49, 0xa1, 0x2f,
+  0x0e, 0xb7, 0xff, 0x5d, 0x89, 0xe7, 0xdb, 0x0b, 0x44, 0x97, 0xa9, 0x9c,
+  0xde, 0xc9, 0x67, 0x08, 0x29, 0xf1, 0x2c, 0xae, 0x0e, 0x5c, 0xa3, 0x0a,
+  0xfa, 0x4b, 0xc6, 0xff, 0xae, 0xbd, 0xe0, 0x84, 0xca, 0x56, 0x84, 0x3e,
+  0x7f, 0x8e, 0x80, 0x71, 0xb0, 0x38, 0xe9, 0x7f, 0x19, 0x8a, 0x16, 0x89,
+  0x26, 0x81, 0x32, 0xdc, 0x3d, 0xe9, 0x6f, 0x65, 0xa2, 0xb9, 0x48, 0x30,
+  0xd2, 0x81, 0x86, 0x4a, 0x4f, 0x33, 0xb4, 0x2e, 0xae, 0xd5, 0xfe, 0xf4,
+  0xe5, 0xad, 0xdf, 0x9a, 0xa8, 0xf4, 0xe8, 0x3b, 0xdb, 0xb1, 0xc6, 0xdc,
+  0x9d, 0x79, 0xd3, 0xf5, 0xca, 0xf9, 0xde, 0xb2, 0xf1, 0x73, 0xd6, 0x87,
+  0xed, 0x22, 0xca, 0xf1, 0xea, 0x65, 0x6c, 0x35, 0xd2, 0x87, 0x84, 0x64,
+  0x95, 0x78, 0xba, 0x5d, 0xc7, 0x0f, 0x22, 0x2c, 0x4d, 0xaa, 0x8d, 0x70,
+  0x3c, 0x26, 0x7d, 0x3b, 0xda, 0x41, 0x57, 0x29, 0xb3, 0x18, 0x91, 0x34,
+  0x3e, 0x65, 0x87, 0x27, 0x92, 0x65, 0xb8, 0x22, 0xda, 0xf3, 0xb3, 0x44,
+  0x86, 0xec, 0x36, 0x49, 0xca, 0x02, 0xd1, 0x73, 0xce, 0x94, 0xe1, 0x15,
+  0x55, 0xeb, 0x7b, 0xcf, 0x0b, 0x3a, 0x1d, 0x7a, 0x83, 0xa4, 0xb7, 0xf5,
+  0x3f, 0xe1, 0x55, 0x6e, 0x19, 0x59, 0xcb, 0x1f, 0x38, 0x5c, 0xf4, 0x75,
+  0x13, 0x7d, 0xd0, 0xa2, 0x4a, 0x48, 0xf2, 0x93, 0x03, 0x9c, 0xab, 0xca,
+  0x36, 0x0d, 0xf3, 0xa0, 0x6b, 0x9c, 0x1e, 0xf0, 0x96, 0xb5, 0x31, 0xc2,
+  0xa9, 0x73, 0x1f, 0x37, 0x10, 0x0e, 0x47, 0xdb, 0xf8, 0xcc, 0x59, 0x3a,
+  0xb2, 0x52, 0xc8, 0xf0, 0xf1, 0x64, 0x5a, 0xf4, 0x30, 0x69, 0x47, 0x48,
+  0x6d, 0x0c, 0x0b, 0x0f, 0x1e, 0x24, 0x22, 0xcf, 0x87, 0x77, 0xb4, 0xed,
+  0x10, 0x61, 0x93, 0xc2, 0xd0, 0x6f, 0xde, 0x97, 0xf9, 0xfe, 0xc8, 0xda,
+  0x18, 0x34, 0x55, 0xff, 0x36, 0xe7, 0xdd, 0xa6, 0xc0, 0x3e, 0x06, 0x13,
+  0xc3, 0xb0, 0x4d, 0x09, 0xac, 0xda, 0x97, 0x46, 0xeb, 0x42, 0xec, 0xd7,
+  0x3a, 0x0b, 0xaa, 0xab, 0xea, 0xab, 0xe3, 0x4c, 0xd3, 0xe6, 0x3b, 0x89,
+  0x29, 0x38, 0x69, 0xa9, 0xd9, 0xcd, 0xc2, 0x01, 0x6a, 0x9d, 0xc7, 0xb5,
+  0x0d, 0xaa, 0x84, 0xeb, 0x97, 0x58, 0xf0, 0x2c, 0xac, 0x8d, 0x74, 0xfd,
+  0x53, 0x1a, 0xd4, 0xb7, 0xb0, 0xa5, 0x68, 0xd3, 0xef, 0xd2, 0x68, 0xad,
+  0x06, 0x5b, 0x38, 0x0e, 0x90, 0x7d, 0x6c, 0xee, 0xd5, 0x1f, 0x1f, 0x9f,
+  0x7c, 0x49, 0x38, 0x8e, 0x93, 0x8b, 0xdb, 0x34, 0xa7, 0xa8, 0x93, 0xdf,
+  0x31, 0x01, 0x6c, 0x14, 0xc6, 0x9c, 0x5c, 0xef, 0x7d, 0x8c, 0xdc, 0x97,
+  0xce, 0x66, 0xbb, 0x5f, 0xf0, 0xc7, 0xa4, 0x68, 0xe5, 0xb2, 0x66, 0xff,
+  0xa9, 0xcd, 0x1b, 0x3c, 0x6b, 0x57, 0xd0, 0xd6, 0x28, 0x35, 0x9e, 0x95,
+  0x11, 0x87, 0x93, 0xe0, 0x7d, 0x65, 0x3c, 0xf5, 0xea, 0x59, 0x5c, 0x65,
+  0xa2, 0x1d, 0xaf, 0x6b, 0x8b, 0x82, 0x64, 0xbc, 0x93, 0x45, 0x6a, 0x89,
+  0xf9, 0xf0, 0x1e, 0xcf, 0xe6, 0xed, 0xc7, 0x46, 0x5a, 0x6c, 0x66, 0x06,
+  0x38, 0x6d, 0x49, 0x6f, 0x0a, 0x3d, 0xf3, 0xce, 0xf8, 0x1d, 0xeb, 0xd0,
+  0x26, 0x20, 0xcd, 0x95, 0x25, 0x82, 0x3a, 0x85, 0xf7, 0xd2, 0x11, 0x91,
+  0xd2, 0xb9, 0x4a, 0x7a, 0x7c, 0x0e, 0x7a, 0x91, 0x0f, 0x1d, 0xd8, 0xb9,
+  0xef, 0xbb, 0x35, 0xbc, 0xf4, 0x72, 0xc8, 0x23, 0xfc, 0x2f, 0xdf, 0x55,
+  0x7d, 0xc5, 0xd5, 0xd5, 0x3f, 0x7a, 0x28, 0xfc, 0xf9, 0x6e, 0x70, 0xc2,
+  0xbd, 0xe4, 0x8d, 0x07, 0xd5, 0x28, 0x1b, 0x4b, 0x33, 0xee, 0xcc, 0xfb,
+  0xed, 0x6c, 0x2c, 0x10, 0xd2, 0xa0, 0x0c, 0x23, 0xf9, 0xb4, 0x03, 0xb9,
+  0x55, 0xad, 0x90, 0xe5, 0xdb, 0x60, 0xd0, 0x81, 0xd5, 0x48, 0xd2, 0x18,
+  0xe2, 0xa9, 0xbd, 0xda, 0x9c, 0x4c, 0x65, 0x01, 0x10, 0x34, 0xb9, 0x71,
+  0x31, 0x02, 0xd6, 0x86, 0xab, 0xdc, 0x6d, 0x1e, 0x29, 0xee, 0xf2, 0x35,
+  0xbb, 0xaf, 0x23, 0xb0, 0xd7, 0x05, 0x79, 0x15, 0x52, 0x95, 0x69, 0x85,
+  0x52, 0x20, 0xd3, 0xd2, 0x27, 0x29, 0x20, 0x1c, 0x7e, 0x5e, 0xc5, 0xe4,
+  0x89, 0xf8, 0xe6, 0x41, 0x28, 0x54, 0x6c, 0xb3, 0x70, 0xa8, 0x06, 0x6a,
+  0x88, 0x18, 0x38, 0xf9, 0x67, 0xad, 0x88, 0xe6, 0x6b, 0xff, 0xcd, 0x68,
+  0x22, 0x22, 0x88, 0x4f, 0x76, 0xf1, 0x0e, 0x74, 0x70, 0xc1, 0xaf, 0x4d,
+  0x01, 0x2a, 0x7e, 0x89, 0x81, 0x26, 0xfd, 0x1b, 0xc1, 0x95, 0x77, 0x85,
+  0x23, 0xd9, 0x99, 0xc6, 0xd8, 0x40, 0x2d, 0x1a, 0xff, 0x40, 0xc4, 0x2f,
+  0x1b, 0x73, 0xd7, 0x45, 0xe4, 0xf8, 0x80, 0xcf, 0xaa, 0x94, 0xc4, 0x02,
+  0x64, 0x1c, 0xac, 0x44, 0x2f, 0xca, 0x62, 0x1f, 0xf6, 0x7c, 0x3d, 0x75,
+  0xda, 0xc1, 0xca, 0xeb, 0x96, 0xe9, 0xde, 0x75, 0xf0, 0x6f, 0xbc, 0x62,
+  0xa0, 0x59, 0x00, 0x70, 0x83, 0x97, 0x9a, 0x51, 0x18, 0xce, 0x92, 0x1c,
+  0x91, 0x45, 0xdf, 0xd8, 0xbd, 0x17, 0x5d, 0x4d, 0xe5, 0xb3, 0x92, 0x80,
+  0x0c, 0x9c, 0x7a, 0xa0, 0x4a, 0x0f, 0x45, 0xb5, 0xf7, 0x7b, 0xe8, 0x0f,
+  0x45, 0x02, 0xe6, 0xf8, 0x28, 0x98, 0x27, 0x7b, 0x2d, 0x5a, 0xb7, 0x48,
+  0xeb, 0xce, 0x49, 0xa6, 0xff, 0xb4, 0xf5, 0xef, 0x05, 0x50, 0x57, 0x47,
+  0xf8, 0x88, 0xf1, 0x93, 0x7b, 0xcd, 0xb3, 0xba, 0x9d, 0xd5, 0xc1, 0xa9,
+  0x51, 0xf0, 0x16, 0x6b, 0x68, 0x4e, 0xc3, 0xbe, 0x2b, 0xd8, 0x1b, 0xfd,
+  0x39, 0xfa, 0x0d, 0x39, 0xad, 0xed, 0xf4, 0x88, 0x6f, 0x27, 0x12, 0xbb,
+  0x0a, 0x61, 0x0e, 0x29, 0x1c, 0x7f, 0x47, 0xb1, 0x4d, 0x62, 0x32, 0x33,
+  0xb0, 0x8f, 0xff, 0xe0, 0x01, 0x2a, 0x17, 0x45, 0x8e, 0xea, 0x67, 0x61,
+  0xee, 0xe1, 0x45, 0x2f, 0x18, 0x4b, 0x15, 0x32, 0xb9, 0x58, 0xcf, 0x64,
+  0x7f, 0x7c, 0xd2, 0x05, 0x4b, 0x7b, 0xbf, 0xac, 0x52, 0x41, 0xca, 0x63,
+  0x08, 0xea, 0x31, 0x40, 0x27, 0xed, 0x88, 0x43, 0x6b, 0x19, 0xc9, 0x26,
+  0xe8, 0x12, 0xf3, 0xbc, 0x78, 0xcc, 0xe7, 0x52, 0x67, 0x3f, 0xb8, 0xa3,
+  0x38, 0x06, 0xc1, 0x46, 0x15, 0xe6, 0xb6, 0x3d, 0x86, 0x3f, 0x46, 0xd7,
+  0x8e, 0xfb, 0x6d, 0x66, 0x79, 0xf2, 0xb4, 0x1b, 0xf7, 0x98, 0xd1, 0xb5,
+  0xf7, 0x94, 0xcb, 0xe5, 0xb3, 0x4c, 0x2f, 0x06, 0x83, 0x5d, 0xaa, 0x39,
+  0xe4, 0xfb, 0xd9, 0x92, 0xb3, 0xbe, 0x26, 0x77, 0x16, 0xc5, 0xc0, 0x51,
+  0x0a, 0x4d, 0x2c, 0x5f, 0xeb, 0x1c, 0x86, 0x38, 0x4e, 0xde, 0xe9, 0xee,
+  0x78, 0x2e, 0xa9, 0xf0, 0x0c, 0x3c, 0x3d, 0xf0, 0xfe, 0xa9, 0x5c, 0xfe,
+  0x23, 0x54, 0x98, 0x91, 0x34, 0xf5, 0x89, 0xda, 0xf9, 0x58, 0x85, 0x99,
+  0x06, 0x40, 0xf3, 0x45, 0xd3, 0x6c, 0x76, 0xd9, 0xd2, 0x3e, 0xfe, 0x3f,
+  0x72, 0x83, 0x9c, 0xed, 0xb1, 0xe7, 0xa6, 0x36, 0xa4, 0xd9, 0xf3, 0x16,
+  0x41, 0x00, 0x3b, 0xe0, 0x1b, 0x7e, 0xcd, 0x0d, 0x73, 0x3f, 0xab, 0xfc,
+  0x4d, 0x89, 0x7e, 0x63, 0x36, 0xbd, 0x9b, 0x74, 0xe4, 0x23, 0x73, 0xb1,
+  0x71, 0x9b, 0x4a, 0xdf, 0x02, 0x88, 0x8e, 0x61, 0xe1, 0xd0, 0x25, 0x31,
+  0xe8, 0x66, 0x08, 0xb9, 0x93, 0x36, 0xc5, 0x2f, 0x7f, 0x4a, 0xb5, 0xcb,
+  0x96, 0xa6, 0xb5, 0xbd, 0xbe, 0x6b, 0x74, 0xd0, 0xf0, 0x19, 0xf9, 0x64,
+  0xfe, 0xb9, 0x50, 0x0a, 0xb4, 0xe2, 0xc9, 0xb4, 0xab, 0x7e, 0xff, 0x0b,
+  0xdc, 0xa3, 0x14, 0x78, 0x0b, 0xb8, 0x24, 0x84, 0x6c, 0xc8, 0x9f, 0x90,
+  0xfd, 0x4a, 0xc5, 0x7e, 0x92, 0x10, 0xfb, 0x9e, 0xba, 0xa0, 0x02, 0x4c,
+  0x9e, 0xb0, 0x1a, 0xfb, 0x7a, 0xdb, 0x7f, 0x47, 0xea, 0x15, 0x50, 0x6d,
+  0xe9, 0x14, 0x5d, 0x1b, 0x4c, 0xd4, 0xa2, 0x42, 0xbb, 0xef, 0x77, 0xad,
+  0x14, 0x55, 0xd9, 0x77, 0x9d, 0x2b, 0x74, 0x60, 0x53, 0xdb, 0x7c, 0xc6,
+  0x51, 0xc3, 0x9e, 0x31, 0x5a, 0xfa, 0x4b, 0xe8, 0xfe, 0x5f, 0xe5, 0x69,
+  0x76, 0x09, 0x03, 0x5b, 0xe3, 0x5d, 0xfb, 0xc7, 0x3d, 0xe9, 0x66, 0x14,
+  0x23, 0xba, 0x52, 0xd5, 0x74, 0x20, 0x07, 0xac, 0x0a, 0x26, 0x6a, 0x55,
+  0x10, 0x54, 0xef, 0xf9, 0x81, 0xef, 0x9c, 0xaf, 0xc6, 0xff, 0x3f, 0x0e,
+  0x39, 0x10, 0x04, 0xd1, 0xdd, 0x7e, 0xde, 0xb5, 0xd1, 0xb4, 0x9f, 0x6b,
+  0x4c, 0x3b, 0xdd, 0xd4, 0x29, 0x25, 0x97, 0xd3, 0x6f, 0x99, 0xe2, 0x5f,
+  0x6f, 0x4c, 0xb6, 0x98, 0xfc, 0xe9, 0x81, 0x9c, 0x24, 0x5b, 0x5e, 0xa1,
+  0x4f, 0xbf, 0x44, 0xb3, 0x22, 0x5b, 0xa8, 0x54, 0xd7, 0xbd, 0xd7, 0xf6,
+  0x63, 0x04, 0xe9, 0x68, 0xd7, 0x22, 0xd5, 0x93, 0x4d, 0x4d, 0x1f, 0x7f,
+  0x6b, 0xd6, 0x3a, 0xc4, 0xf0, 0xba, 0xed, 0xf5, 0x4e, 0x05, 0x5c, 0xf0,
+  0xcd, 0x16, 0x34, 0xeb, 0x15, 0x1d, 0x90, 0x06, 0x3a, 0x4b, 0x37, 0xc7,
+  0x4d, 0xe8, 0xca, 0xc0, 0x8c, 0x7a, 0x44, 0x11, 0x43, 0xa6, 0x45, 0x77,
+  0x9f, 0x67, 0xde, 0x5b, 0x48, 0x7d, 0x47, 0x73, 0xee, 0xdc, 0x48, 0x24,
+  0xf7, 0x49, 0x03, 0x51, 0x3f, 0x22, 0x59, 0x91, 0x2a, 0xf9, 0x25, 0xf9,
+  0x34, 0x5b, 0x0e, 0x02, 0xd9, 0xa1, 0x9d, 0x22, 0x73, 0x1c, 0x1b, 0x78,
+  0x82, 0x00, 0x4f, 0xae, 0x4f, 0xa6, 0x7c, 0xa3, 0x3e, 0x15, 0xba, 0xbb,
+  0x99, 0xbe, 0x00, 0xf6, 0x81, 0x21, 0x37, 0x4c, 0x0f, 0x29, 0xce, 0xe0,
+  0x11, 0x0a, 0xe8, 0x04, 0x5c, 0x15, 0x27, 0x26, 0xeb, 0x83, 0xe4, 0x8c,
+  0x0f, 0x36, 0xed, 0xb3, 0x9e, 0x3d, 0x41, 0xa9, 0x84, 0x88, 0x93, 0xf0,
+  0x2e, 0x74, 0xa3, 0x9c, 0x37, 0x5a, 0x50, 0xdf, 0x6c, 0x3c, 0x5e, 0x48,
+  0xa5, 0x9b, 0x03, 0xf0, 0x66, 0xc4, 0x5b, 0xf0, 0xe4, 0x20, 0x4a, 0xba,
+  0xc3, 0xf1, 0x41, 0x95, 0x9f, 0x14, 0x7d, 0xbf, 0x44, 0xe0, 0x8b, 0x7a,
+  0x6e, 0xb8, 0x1e, 0x53, 0x85, 0xd9, 0xe4, 0x0d, 0x95, 0xd5, 0xf0, 0x63,
+  0xf4, 0xe8, 0x39, 0xd6, 0x5b, 0x24, 0x0e, 0x53, 0x55, 0xd5, 0xac, 0x4a,
+  0xd6, 0xc0, 0xdc, 0x05, 0x07, 0x89, 0x1a, 0x09, 0x60, 0x7b, 0x4d, 0x4c,
+  0x16, 0x21, 0x36, 0x18, 0xf6, 0x37, 0x4c, 0x69, 0x8d, 0x49, 0x87, 0x43,
+  0x53, 0x7d, 0xeb, 0x9a, 0x75, 0x2e, 0x6d, 0x34, 0x57, 0x0d, 0xc7, 0x6c,
+  0xd6, 0xab, 0x6e, 0xe1, 0xee, 0xe3, 0x88, 0x1e, 0xe7, 0x81, 0x7d, 0xae,
+  0xf8, 0x35, 0x7d, 0x6f, 0xd1, 0x79, 0xf2, 0x0a, 0x61, 0x3a, 0xc0, 0x97,
+  0x2c, 0x75, 0x06, 0xbc, 0xba, 0x80, 0x80, 0x68, 0x2c, 0xb1, 0x87, 0xa4,
+  0xd0, 0xf6, 0xd3, 0x51, 0x62, 0x74, 0xd5, 0x82, 0x94, 0x38, 0xa7, 0x82,
+  0x7c, 0xf8, 0x8c, 0x0c, 0xfc, 0xc5, 0x3a, 0x49, 0xd8, 0x81, 0x22, 0x90,
+  0x1b, 0xa6, 0x73, 0x7b, 0x7e, 0xa0, 0xc2, 0x4c, 0x7b, 0x8f, 0x88, 0x89,
+  0x02, 0xc3, 0x22, 0x95, 0x58, 0xf4, 0x95, 0xb9, 0x5a, 0xb3, 0x0d, 0x9c,
+  0xa8, 0xfb, 0x32, 0x5e, 0x42, 0x58, 0x10, 0x03, 0x46, 0x30, 0x18, 0xe1,
+  0x39, 0x22, 0xcc, 0x70, 0x49, 0xeb, 0x6b, 0xa3, 0x24, 0x0c, 0x29, 0x9f,
+  0x76, 0xa0, 0xbe, 0xfb, 0xa8, 0x5e, 0x3a, 0x37, 0x3a, 0xf0, 0xe7, 0xf2,
+  0xc8, 0x87, 0xea, 0xbb, 0x26, 0x34, 0x53, 0x31, 0xb1, 0xc6, 0xe8, 0x0a,
+  0xc5, 0xf0, 0xe9, 0x78, 0x02, 0x1f, 0x47, 0x7b, 0xb6, 0x17, 0x38, 0x4e,
+  0xe8, 0xb7, 0x51, 0xf7, 0xaf, 0x6f, 0xfe, 0xee, 0x08, 0x36, 0x3d, 0x31,
+  0xa4, 0xba, 0xd9, 0xbf, 0x5c, 0xd1, 0x34, 0xbc, 0x8c, 0x59, 0x47, 0x3d,
+  0x0e, 0xa8, 0xcb, 0x75, 0xe9, 0x9c, 0x8a, 0x8f, 0xe0, 0xd5, 0x79, 0x98,
+  0x26, 0x03, 0x5e, 0xb9, 0xe4, 0x2d, 0x0a, 0xf2, 0x54, 0x0c, 0xaf, 0x17,
+  0x2c, 0x94, 0xc2, 0x33, 0xae, 0xa1, 0x67, 0x43, 0x00, 0x07, 0x3f, 0xb7,
+  0x38, 0xaf, 0x80, 0xd9, 0xd7, 0x17, 0x7a, 0x9d, 0xe0, 0xce, 0x6c, 0xc6,
+  0x99, 0xdd, 0x72, 0x96, 0x09, 0xdf, 0x0f, 0x1c, 0x07, 0x82, 0x1d, 0x60,
+  0xbb, 0x65, 0xad, 0x42, 0x40, 0xa6, 0x66, 0x78, 0x80, 0xee, 0xe1, 0x3d,
+  0x61, 0xc8, 0xa4, 0x30, 0xf6, 0xf1, 0xdd, 0x2d, 0x9a, 0x5b, 0x2c, 0x84,
+  0xda, 0xa8, 0xb5, 0x13, 0xb0, 0x91, 0x08, 0xfb, 0x0e, 0x08, 0x84, 0x12,
+  0x21, 0x4b, 0x8b, 0x7f, 0xb1, 0x0a, 0xeb, 0x20, 0x4c, 0xba, 0xf4, 0x48,
+  0x0f, 0xb9, 0x19, 0x25, 0xcd, 0x87, 0x48, 0xab, 0x64, 0x12, 0xea, 0x7e,
+  0xea, 0x29, 0xf9, 0x87, 0xab, 0x50, 0x4e, 0xf1, 0xcf, 0xe3, 0x41, 0xe7,
+  0xb0, 0xc6, 0xdd, 0xf8, 0xac, 0xe4, 0xaa, 0xc4, 0xc7, 0xf6, 0xf8, 0x88,
+  0xdb, 0x03, 0x00, 0xee, 0x0e, 0xd8, 0x7a, 0x05, 0xdb, 0x5c, 0x27, 0x96,
+  0xfc, 0x50, 0xaf, 0x17, 0xfd, 0x56, 0x12, 0x8f, 0x58, 0xe6, 0xe0, 0xb8,
+  0x0c, 0x03, 0xb9, 0x0d, 0x0e, 0x4d, 0xf6, 0x0e, 0xe2, 0xa2, 0x8d, 0x97,
+  0x9b, 0x86, 0xb9, 0xa8, 0x05, 0x97, 0xef, 0xe2, 0xa2, 0xe5, 0x14, 0x1d,
+  0xf9, 0xc8, 0xe3, 0x2c, 0xa0, 0x2f, 0x98, 0x4b, 0x51, 0x0d, 0xc9, 0x47,
+  0xf7, 0x8d, 0x9c, 0x07, 0x8b, 0xf5, 0x13, 0x6e, 0x52, 0x03, 0x29, 0x61,
+  0xdd, 0xa0, 0x4c, 0x18, 0xda, 0x02, 0xd8, 0x4c, 0x9d, 0x9d, 0xb9, 0x6d,
+  0x33, 0x86, 0xf4, 0x83, 0xd6, 0x15, 0xd0, 0x2f, 0x85, 0x26, 0xad, 0xe3,
+  0x86, 0x5a, 0xb4, 0x61, 0xe2, 0x5a, 0xed, 0xd2, 0xe8, 0xc0, 0xd7, 0x6b,
+  0x7c, 0x5b, 0x05, 0x3e, 0x08, 0x6d, 0x9a, 0xb1, 0xe4, 0x24, 0xdf, 0xcb,
+  0x07, 0xe5, 0xc1, 0x8c, 0x9e, 0x3d, 0xcb, 0x77, 0x38, 0x9a, 0xd2, 0x62,
+  0x11, 0x3b, 0xb2, 0x61, 0xfb, 0xee, 0xcd, 0xd3, 0xa7, 0xb8, 0x06, 0x62,
+  0x1f, 0x64, 0xf5, 0x48, 0xa8, 0xc1, 0xfd, 0x7f, 0xe9, 0x44, 0xa9, 0xb6,
+  0x6a, 0x2b, 0xab, 0x0b, 0xc1, 0x6b, 0x7a, 0x95, 0x1e, 0x0d, 0xfb, 0x5c,
+  0x2a, 0x6b, 0x0d, 0x7e, 0x4f, 0x1c, 0xd9, 0xe7, 0x53, 0x3c, 0x65, 0xc7,
+  0xae, 0x2d, 0x0a, 0xf8, 0xb5, 0xe8, 0x81, 0xc7, 0xb9, 0xa0, 0x2c, 0x94,
+  0xb6, 0xe7, 0x26, 0x00, 0x71, 0x16, 0xf5, 0x66, 0xda, 0x55, 0xdf, 0x46,
+  0x53, 0xaf, 0x6c, 0x55, 0x71, 0xfc, 0xab, 0x9d, 0x6d, 0x76, 0xe3, 0xc4,
+  0x6a, 0xd4, 0x68, 0xc4, 0x2c, 0xd2, 0x85, 0x25, 0xd0, 0xc2, 0xbf, 0x40,
+  0x24, 0xbb, 0xab, 0x7f, 0x00, 0x74, 0x8d, 0xf5, 0x67, 0x3a, 0x17, 0x54,
+  0xc2, 0xca, 0xf6, 0x88, 0x41, 0x3c, 0xe0, 0x93, 0xbb, 0x27, 0x7e, 0x6d,
+  0x13, 0xcd, 0xa2, 0x0d, 0x80, 0x31, 0xd5, 0xc4, 0x5f, 0xe7, 0x33, 0x7b,
+  0x50, 0x01, 0x6d, 0x71, 0xe9, 0x28, 0x20, 0x69, 0xb9, 0xab, 0xde, 0x75,
+  0x0c, 0x55, 0x8d, 0xba, 0x53, 0x1e, 0x74, 0xc7, 0x16, 0xb9, 0x10, 0xf8,
+  0x28, 0x60, 0x21, 0xa2, 0xa5, 0xf7, 0x6e, 0x82, 0xa8, 0x66, 0x1a, 0xf8,
+  0x38, 0x0d, 0x35, 0x7e, 0x88, 0xe6, 0x0f, 0x71, 0xdd, 0xf7, 0x7c, 0x1c,
+  0x5f, 0xfc, 0x5f, 0x41, 0x90, 0xfe, 0x1c, 0xc1, 0x63, 0xf6, 0xb7, 0x4f,
+  0x4d, 0x1d, 0xfa, 0xef, 0xc8, 0x73, 0x86, 0x3b, 0x02, 0x2b, 0x3c, 0x29,
+  0xb9, 0x76, 0x0a, 0x8d, 0x70, 0x38, 0xff, 0xe2, 0xc0, 0x50, 0x09, 0x30,
+  0xa8, 0x81, 0x5c, 0xbd, 0xba, 0x54, 0x02, 0xd3, 0x6b, 0xcc, 0x93, 0xca,
+  0x16, 0xd9, 0x65, 0x49, 0x08, 0x38, 0xa9, 0x4d, 0x9f, 0xe3, 0xe5, 0x2e,
+  0x0d, 0xba, 0xbb, 0x41, 0xba, 0x49, 0xec, 0xaf, 0xdc, 0x8a, 0xaf, 0x5c,
+  0xe6, 0xc3, 0xa0, 0x58, 0x32, 0x32, 0xd8, 0x67, 0xa4, 0x17, 0xb8, 0xfd,
+  0xd3, 0xca, 0x00, 0xf8, 0x5e, 0xf7, 0x56, 0x4d, 0xd4, 0x69, 0xb1, 0x9e,
+  0x42, 0x11, 0xd5, 0x49, 0xb1, 0xa0, 0x2e, 0x78, 0x24, 0x4f, 0x7b, 0x26,
+  0x31, 0xc6, 0x07, 0x78, 0x60, 0xd5, 0x73, 0xd7, 0x9e, 0xc9, 0x25, 0x1f,
+  0xb8, 0xf6, 0x70, 0x45, 0x1f, 0x2a, 0xbb, 0xb2, 0x24, 0x8d, 0x9b, 0xd1,
+  0x7c, 0x85, 0xb9, 0xa5, 0x01, 0x81, 0x7a, 0x11, 0xf1, 0xd7, 0xd1, 0xf2,
+  0x87, 0x29, 0xc5, 0x12, 0x7e, 0x9c, 0xdd, 0x9d, 0x4e, 0xcf, 0x5e, 0x4a,
+  0x89, 0x6c, 0x76, 0x19, 0x30, 0x9a, 0x22, 0xc9, 0x50, 0x6b, 0xfe, 0xc0,
+  0x26, 0x8f, 0x70, 0x6a, 0x1a, 0x74, 0x58, 0x09, 0x60, 0xa4, 0xfd, 0x44,
+  0x9c, 0x3c, 0xc1, 0xca, 0xa0, 0xfc, 0x75, 0xc5, 0x97, 0x70, 0x55, 0x9e,
+  0xc7, 0xc3, 0x5d, 0x31, 0xa5, 0x2d, 0x48, 0xff, 0x93, 0x97, 0xd2, 0xab,
+  0x23, 0xc2, 0x48, 0xa1, 0x4d, 0x0f, 0xa9, 0xd2, 0xf6, 0x52, 0x6e, 0x71,
+  0x68, 0x75, 0xf9, 0xc7, 0xbe, 0x13, 0x81, 0xcd, 0xbf, 0xbd, 0x76, 0xc3,
+  0x08, 0x69, 0x7d, 0xe1, 0x87, 0x0c, 0xfe, 0x4b, 0x4d, 0xd5, 0x75, 0x38,
+  0x87, 0x2e, 0x31, 0x41, 0x53, 0x38, 0x98, 0x0c, 0x9a, 0x25, 0x51, 0x6a,
+  0x3a, 0xbe, 0xac, 0x09, 0x0f, 0x4a, 0xaa, 0x39, 0xe3, 0xad, 0x07, 0xc5,
+  0x61, 0x7e, 0x2d, 0xac, 0x00, 0x91, 0x72, 0x29, 0x42, 0xa3, 0x9e, 0x3e,
+  0x57, 0x46, 0xc7, 0xb4, 0x2d, 0x3a, 0xc6, 0x94, 0xad, 0x26, 0x6f, 0x9c,
+  0x8b, 0x40, 0x1b, 0xd3, 0x68, 0xf0, 0x69, 0xa6, 0xf7, 0xd4, 0x13, 0xfd,
+  0x4a, 0x15, 0x71, 0x97, 0x23, 0x2c, 0x48, 0x2f, 0x9d, 0xf9, 0x03, 0xf3,
+  0x25, 0x40, 0x34, 0x1d, 0x0a, 0x5b, 0x24, 0x29, 0xb2, 0xc1, 0x97, 0xc8,
+  0xad, 0x49, 0x88, 0x34, 0x3f, 0xb7, 0xf3, 0xb8, 0xb0, 0xc6, 0x0f, 0x0e,
+  0xce, 0x10, 0xe8, 0xdc, 0x7a, 0x01, 0xde, 0x49, 0xec, 0x84, 0x86, 0x8e,
+  0x96, 0xaa, 0x68, 0x0e, 0xac, 0x42, 0xa5, 0xe6, 0x59, 0x40, 0x93, 0x25,
+  0x7b, 0x23, 0xb2, 0x52, 0xd9, 0x89, 0x21, 0x7a, 0x9c, 0xda, 0x53, 0x8f,
+  0x86, 0x06, 0x5a, 0x73, 0xf4, 0x33, 0x9f, 0xbf, 0x08, 0x7d, 0x0a, 0xaf,
+  0x45, 0x16, 0xfd, 0xdd, 0x60, 0x75, 0xc8, 0xf8, 0xd6, 0x01, 0x61, 0xdf,
+  0x6c, 0x28, 0x3f, 0x72, 0xba, 0x1f, 0x1e, 0xbf, 0x8f, 0xdb, 0x4a, 0x01,
+  0x60, 0x6d, 0x21, 0x92, 0x65, 0x51, 0x2a, 0x30, 0x46, 0xa9, 0x21, 0x62,
+  0xaa, 0xb2, 0x74, 0xb4, 0x2c, 0x4d, 0x32, 0x85, 0x18, 0x46, 0x44, 0x32,
+  0xda, 0x5d, 0x42, 0x30, 0x47, 0xd5, 0x4c, 0x9b, 0x92, 0x50, 0xd3, 0x29,
+  0xe2, 0x2f, 0x07, 0x25, 0xb8, 0xab, 0x87, 0x87, 0xff, 0xef, 0x80, 0xb7,
+  0x5b, 0xd6, 0x09, 0x7c, 0x97, 0x05, 0x12, 0x1c, 0xcc, 0x6e, 0x04, 0x34,
+  0x27, 0x86, 0x0a, 0xaa, 0xed, 0x99, 0x25, 0x75, 0x22, 0xc6, 0xe4, 0xa3,
+  0x54, 0x56, 0x56, 0x57, 0xcc, 0x51, 0x0f, 0x9d, 0xee, 0xd0, 0x67, 0x1e,
+  0x93, 0xc5, 0x6c, 0xbc, 0x4a, 0x3d, 0x45, 0xd5, 0xd4, 0xc1, 0x22, 0x39,
+  0xdb, 0xa6, 0xd7, 0xed, 0xa1, 0x02, 0x51, 0x65, 0xe8, 0x50, 0xd1, 0x69,
+  0xcb, 0x11, 0xd4, 0x13, 0xdb, 0x55, 0x25, 0xcd, 0x45, 0xd5, 0xa7, 0x4f,
+  0xc4, 0x67, 0xd3, 0x2c, 0x92, 0x7b, 0x5b, 0xca, 0x5e, 0xaf, 0xb5, 0xee,
+  0x17, 0x7b, 0x68, 0x3d, 0xf6, 0xef, 0xfa, 0x7c, 0x95, 0x72, 0x7f, 0xdc,
+  0x91, 0xb5, 0xb3, 0x02, 0x48, 0xfb, 0xfa, 0x30, 0xce, 0x2b, 0xa5, 0xf7,
+  0x51, 0x33, 0x50, 0x69, 0xbe, 0x1f, 0x0d, 0x38, 0x96, 0x35, 0xcc, 0x92,
+  0xe9, 0x9b, 0x69, 0xbd, 0x81, 0xe8, 0x26, 0xb4, 0x8d, 0xcb, 0x33, 0x66,
+  0x3c, 0xcf, 0x64, 0x7a, 0xf3, 0xfe, 0x6b, 0xff, 0xd6, 0x90, 0xf9, 0x8d,
+  0x85, 0x1b, 0x87, 0x87, 0x84, 0x5a, 0x3b, 0x33, 0x7d, 0x5c, 0x32, 0xba,
+  0x80, 0x99, 0x32, 0x51, 0x17, 0x52, 0xf5, 0x58, 0x95, 0x3e, 0xde, 0x32,
+  0x7c, 0xcb, 0x6c, 0x5c, 0xb0, 0xae, 0x9a, 0xf0, 0xd5, 0x92, 0x33, 0x73,
+  0xbb, 0x00, 0x72, 0x95, 0xc1, 0x57, 0x2b, 0x66, 0x3e, 0x1f, 0xf8, 0xb6,
+  0xf2, 0x49, 0xb2, 0xa4, 0xfc, 0xbb, 0xe0, 0x44, 0xea, 0xe7, 0x62, 0x8b,
+  0xf5, 0x6a, 0xed, 0xfa, 0xca, 0x9a, 0xb8, 0x35, 0x1f, 0xe4, 0x82, 0x8a,
+  0xbb, 0x9c, 0x5a, 0x89, 0xae, 0xdf, 0xca, 0x44, 0xac, 0x6c, 0x28, 0x52,
+  0xee, 0x9a, 0xce, 0x06, 0xbb, 0x26, 0xb3, 0xf9, 0xbf, 0x3a, 0x49, 0x6b,
+  0x41, 0x26, 0x33, 0xc4, 0x54, 0x2c, 0x67, 0xc7, 0x95, 0x2e, 0xde, 0x5f,
+  0xa9, 0x7e, 0x72, 0x96, 0xe5, 0xda, 0x19, 0xe2, 0x8c, 0x04, 0x5d, 0x23,
+  0xee, 0xb4, 0xc1, 0x70, 0x60, 0x0e, 0x98, 0x51, 0xa0, 0x31, 0x9c, 0x0c,
+  0x7e, 0xcf, 0xbe, 0x58, 0x9a, 0xa7, 0x93, 0x26, 0x8b, 0x63, 0xe7, 0x4b,
+  0xff, 0xeb, 0xf9, 0x62, 0x1f, 0x71, 0x04, 0xf3, 0x46, 0x9d, 0xc0, 0x35,
+  0x9c, 0xd3, 0x85, 0x49, 0x9a, 0xab, 0xd5, 0x07, 0x87, 0x92, 0x01, 0x97,
+  0xbc, 0x47, 0xff, 0x49, 0xc4, 0x75, 0x6f, 0x6e, 0x53, 0x05, 0xff, 0x19,
+  0x99, 0x13, 0xc7, 0x9a, 0xeb, 0xc6, 0xae, 0x95, 0xd9, 0x03, 0x04, 0x94,
+  0xb8, 0x14, 0x3c, 0x65, 0xa1, 0x5a, 0x93, 0x1f, 0x15, 0x15, 0x2d, 0x29,
+  0x82, 0x91, 0x5e, 0xc5, 0xd8, 0x1f, 0x1a, 0xb7, 0x93, 0x72, 0x8c, 0x62,
+  0xad, 0x73, 0x98, 0xd2, 0x31, 0x37, 0x46, 0x70, 0x1f, 0x22, 0x59, 0xb6,
+  0x39, 0x08, 0xdc, 0xfc, 0x00, 0x11, 0x7f, 0xf4, 0x51, 0xac, 0xaa, 0x97,
+  0x02, 0x39, 0x60, 0x08, 0x7b, 0x9b, 0x71, 0x13, 0x1e, 0xa5, 0xb9, 0x9b,
+  0xfc, 0x11, 0xc1, 0xc4, 0x22, 0xcd, 0x0f, 0x05, 0x3b, 0xad, 0xca, 0x2e,
+  0x31, 0x0c, 0x1c, 0xa8, 0xcf, 0xd0, 0xf9, 0x50, 0x95, 0x15, 0x0c, 0xa9,
+  0x26, 0xdb, 0xc1, 0x82, 0xde, 0xd6, 0x94, 0x07, 0x79, 0x85, 0x8f, 0x26,
+  0x51, 0x68, 0x73, 0xde, 0x07, 0x90, 0x83, 0xde, 0x33, 0x4d, 0xf5, 0x06,
+  0x3d, 0x16, 0x7f, 0x56, 0xde, 0x61, 0x42, 0xaa, 0x5b, 0x3e, 0x5b, 0xc1,
+  0x95, 0xe0, 0x29, 0x8d, 0xc8, 0x46, 0xe2, 0xbb, 0x2b, 0x2d, 0x67, 0x66,
+  0xae, 0xdc, 0x5f, 0x94, 0x5c, 0x42, 0xfc, 0xe3, 0xce, 0x69, 0x63, 0xa4,
+  0x06, 0x00, 0xcb, 0x9a, 0xa4, 0xe4, 0xdd, 0xe5, 0xc7, 0x29, 0x09, 0xc7,
+  0x5a, 0x12, 0xeb, 0x15, 0x78, 0x28, 0xeb, 0x3d, 0x3e, 0xe1, 0x8d, 0xd1,
+  0xc1, 0xbe, 0xd7, 0x64, 0x82, 0x91, 0xae, 0xf2, 0x3f, 0x95, 0x8c, 0x8b,
+  0xeb, 0x50, 0xf0, 0xaa, 0x1e, 0xcc, 0xf2, 0xf3, 0xc9, 0x45, 0x37, 0xbc,
+  0x9b, 0xac, 0x33, 0x10, 0x28, 0x1f, 0xf2, 0xe8, 0xc3, 0xf4, 0x56, 0x89,
+  0x98, 0x63, 0xda, 0x3d, 0x4b, 0x85, 0x31, 0xbd, 0x54, 0x68, 0x39, 0xa0,
+  0x8b, 0x36, 0x70, 0x55, 0xfc, 0x68, 0x1d, 0xaa, 0xbc, 0x37, 0x82, 0x18,
+  0x10, 0x65, 0xdd, 0xd7, 0x1e, 0x09, 0xbd, 0x95, 0x37, 0xf4, 0x03, 0x79,
+  0xd7, 0x74, 0x63, 0xad, 0xc0, 0xda, 0x0f, 0xc9, 0xb4, 0x99, 0x53, 0xb2,
+  0x6a, 0x8c, 0x06, 0xcb, 0x89, 0x32, 0x3e, 0x36, 0x29, 0x82, 0x9f, 0x5e,
+  0x85, 0x0f, 0x86, 0xbf, 0x9a, 0x8f, 0xe1, 0xf7, 0xa4, 0xef, 0xcb, 0xce,
+  0xfc, 0x85, 0x18, 0x85, 0x35, 0x59, 0xd2, 0xd5, 0xb1, 0x0d, 0x41, 0xe3,
+  0xdf, 0x02, 0xb7, 0x35, 0x82, 0xb1, 0x8b, 0x72, 0x5d, 0x6a, 0xa8, 0xe7,
+  0x4d, 0x34, 0xdf, 0x6c, 0xcc, 0x05, 0x60, 0xb5, 0xf8, 0xb6, 0x6b, 0x92,
+  0x1c, 0xac, 0x0e, 0x3d, 0x43, 0x51, 0x03, 0x56, 0xbc, 0x09, 0xc0, 0x59,
+  0xc3, 0x95, 0xcb, 0x2b, 0x2c, 0xe1, 0xc4, 0x95, 0xd8, 0xdc, 0x07, 0x4b,
+  0x38, 0x37, 0x2b, 0xb3, 0x56, 0x7a, 0x38, 0x99, 0x19, 0x73, 0xf2, 0x31,
+  0xe9, 0x32, 0x03, 0x5b, 0xdc, 0x95, 0xb9, 0x32, 0x09, 0xdf, 0xe5, 0x85,
+  0x14, 0x43, 0x0d, 0xc4, 0x60, 0xbc, 0xe7, 0x34, 0x1d, 0x56, 0x74, 0xf6,
+  0xd7, 0x43, 0x88, 0xa4, 0xb8, 0x48, 0x79, 0x00, 0xd6, 0xe6, 0x6e, 0x5a,
+  0xc1, 0xed, 0xcb, 0x6a, 0xb0, 0x88, 0x70, 0xec, 0xa4, 0x9a, 0xa1, 0x6e,
+  0xb4, 0x61, 0x36, 0xca, 0xda, 0x6e, 0x22, 0x7a, 0x3f, 0xd9, 0x7d, 0xda,
+  0x8b, 0xb5, 0x54, 0x67, 0xc8, 0xa0, 0xaf, 0x54, 0x8f, 0x3d, 0x6b, 0x72,
+  0x25, 0xba, 0x92, 0x97, 0x0a, 0x9c, 0xbf, 0x7b, 0x4e, 0x31, 0x82, 0xba,
+  0xe9, 0x94, 0xa6, 0x55, 0x9c, 0x11, 0x55, 0xca, 0x82, 0xbe, 0x60, 0xdb,
+  0x6b, 0xa0, 0x1b, 0x51, 0x30, 0xe6, 0x2f, 0xa3, 0xca, 0x0c, 0xfb, 0x28,
+  0xf9, 0xe2, 0x4e, 0xd9, 0x19, 0xf3, 0x7c, 0xc9, 0x07, 0x0d, 0x9d, 0xb8,
+  0x48, 0xa6, 0xf8, 0xa5, 0xb9, 0x3e, 0x0a, 0x2c, 0x4e, 0x52, 0xe4, 0xb7,
+  0xe0, 0xad, 0x2c, 0x9d, 0x01, 0x62, 0x9f, 0xe7, 0xa0, 0x58, 0x0d, 0x2b,
+  0xac, 0x32, 0xf8, 0xed, 0xfd, 0xf8, 0x35, 0x84, 0xbb, 0xb2, 0xea, 0x36,
+  0x7a, 0xed, 0x30, 0x61, 0xa9, 0x68, 0xd6, 0xe2, 0x54, 0xa7, 0x3c, 0xf7,
+  0x28, 0x20, 0x2a, 0x06, 0x2d, 0x49, 0x03, 0x73, 0xf3, 0xb0, 0x0b, 0x1f,
+  0x10, 0x05, 0x0a, 0xc7, 0x87, 0x82, 0xdd, 0xef, 0x89, 0x4e, 0x28, 0x87,
+  0x18, 0x5a, 0x77, 0xd6, 0x2c, 0x0c, 0x2a, 0x48, 0xbd, 0x42, 0xb7, 0xfd,
+  0x1d, 0x25, 0x2d, 0x89, 0x69, 0x58, 0x76, 0x2b, 0x26, 0x0c, 0x57, 0x10,
+  0xe8, 0xce, 0x1e, 0xa0, 0x8c, 0x08, 0x14, 0x88, 0x77, 0x71, 0xd2, 0xe0,
+  0xd9, 0x0f, 0x05, 0x24, 0x90, 0xf7, 0x99, 0xc2, 0x88, 0xcc, 0x57, 0x99,
+  0x24, 0xef, 0x40, 0xc5, 0xe8, 0xfa, 0x83, 0x0c, 0xc4, 0x4f, 0xee, 0xc0,
+  0x1d, 0xfc, 0xb6, 0x39, 0x9e, 0x27, 0xd7, 0x6d, 0x51, 0xcb, 0x5d, 0x4c,
+  0x8d, 0x86, 0xed, 0x75, 0xe6, 0xd3, 0xa7, 0x76, 0x3f, 0x03, 0x4f, 0x18,
+  0x96, 0xf1, 0xa4, 0xf1, 0x3d, 0xb2, 0xdd, 0x16, 0xb6, 0x1e, 0x67, 0x04,
+  0x13, 0xe2, 0x65, 0xd5, 0x18, 0x6a, 0x4c, 0xc2, 0x7f, 0x16, 0x8b, 0x59,
+  0xbe, 0x18, 0xa5, 0xbd, 0x5d, 0x69, 0x7f, 0x0e, 0xd8, 0xf2, 0xed, 0xe6,
+  0xfd, 0xa9, 0xa1, 0xb4, 0x15, 0xfc, 0x68, 0x29, 0xbf, 0x09, 0x71, 0xcb,
+  0xc9, 0x13, 0x21, 0x06, 0xae, 0x71, 0x8a, 0x00, 0xf7, 0x31, 0x25, 0x73,
+  0xc5, 0x12, 0x07, 0x6d, 0x1e, 0xe6, 0x11, 0x23, 0x57, 0x8f, 0xf4, 0xaa,
+  0x92, 0xf6, 0x6a, 0x76, 0x8c, 0x98, 0xd5, 0x91, 0xf0, 0xfb, 0x37, 0x14,
+  0xa3, 0xcd, 0x23, 0x1b, 0xc1, 0x5d, 0xd8, 0x97, 0x28, 0x16, 0x1c, 0xbb,
+  0x06, 0x34, 0x81, 0x4e, 0x4f, 0xfb, 0xe9, 0x1a, 0xbe, 0xbd, 0xaf, 0x12,
+  0x10, 0xf8, 0x47, 0x17, 0xd9, 0x87, 0x24, 0xa0, 0x0b, 0x15, 0x8a, 0xb9,
+  0xa4, 0x1a, 0x0a, 0xef, 0x04, 0x69, 0xc3, 0x46, 0xb4, 0x20, 0xae, 0xa2,
+  0x3c, 0xb1, 0x82, 0x31, 0x35, 0x39, 0x57, 0xe7, 0x98, 0x38, 0x74, 0x35,
+  0x0e, 0xc2, 0x90, 0x5d, 0x3b, 0xa5, 0x5b, 0x6b, 0x9f, 0xf2, 0xc6, 0x29,
+  0x6e, 0x7e, 0xbe, 0x24, 0x63, 0xf2, 0x10, 0x43, 0x0d, 0x2d, 0x43, 0x86,
+  0x5c, 0x97, 0xf2, 0x1e, 0x49, 0x3c, 0x2e, 0x38, 0x28, 0xdc, 0xcc, 0x50,
+  0xa3, 0x5e, 0xca, 0x90, 0x68, 0xb0, 0x0d, 0x4b, 0x05, 0x50, 0x77, 0x4f,
+  0xd2, 0x84, 0xc2, 0xc0, 0x29, 0xd9, 0x43, 0xec, 0x52, 0xcc, 0x0b, 0x0d,
+  0x88, 0xba, 0xf7, 0x9b, 0x07, 0x1b, 0xec, 0x7d, 0xe3, 0xd0, 0x57, 0x8b,
+  0x77, 0x60, 0x6b, 0x65, 0x46, 0x90, 0x7d, 0x6d, 0x57, 0x77, 0x64, 0x72,
+  0xf8, 0x05, 0xd4, 0x98, 0xf0, 0x91, 0xeb, 0x95, 0x9c, 0x27, 0x60, 0x04,
+  0x5e, 0xef, 0xad, 0x17, 0x8a, 0xf0, 0x7d, 0xf9, 0xa3, 0xb4, 0x02, 0xa1,
+  0x76, 0x4f, 0x95, 0xbb, 0x9b, 0x53, 0x15, 0x97, 0xe1, 0x2c, 0x70, 0xfc,
+  0x24, 0x10, 0x59, 0x1a, 0x6d, 0x00, 0xc0, 0xc4, 0xd1, 0xf6, 0xdd, 0x14,
+  0x0e, 0xab, 0x19, 0xc6, 0x27, 0x90, 0x19, 0xd2, 0xad, 0x42, 0x19, 0x5f,
+  0xeb, 0xb8, 0xcb, 0xe8, 0xf7, 0x88, 0xbc, 0x35, 0x95, 0x36, 0xed, 0xc3,
+  0xf7, 0x74, 0x21, 0xef, 0x1d, 0x29, 0xb6, 0xb8, 0x97, 0xad, 0x73, 0x81,
+  0x8a, 0xb6, 0x25, 0xeb, 0x98, 0xc8, 0x96, 0x06, 0xb8, 0x31, 0x32, 0x3e,
+  0xb0, 0xf0, 0xba, 0xf0, 0xdc, 0x0a, 0xb3, 0xea, 0x79, 0x0d, 0x8c, 0xb9,
+  0x20, 0x84, 0xca, 0x7b, 0x76, 0xd7, 0x2f, 0x60, 0xf1, 0x2d, 0x01, 0x57,
+  0xa0, 0x35, 0x69, 0x9b, 0x1c, 0x8b, 0x08, 0xdb, 0x2d, 0xd3, 0x1d, 0x15,
+  0xd3, 0x60, 0x71, 0x40, 0x93, 0xc7, 0x01, 0x2b, 0xb9, 0x6a, 0x0b, 0x70,
+  0xe7, 0xd5, 0x11, 0x25, 0x33, 0x91, 0xe5, 0xac, 0xc0, 0x37, 0xcc, 0x2d,
+  0xf7, 0xe5, 0x23, 0x99, 0xb2, 0x2e, 0x07, 0x88, 0x38, 0x3b, 0xa9, 0x0e,
+  0x57, 0x0b, 0xdd, 0x57, 0xe5, 0x43, 0x9d, 0x3e, 0xf3, 0x8a, 0x57, 0x85,
+  0x76, 0x37, 0x93, 0xfd, 0x0d, 0xb9, 0x71, 0xe8, 0xd4, 0x65, 0x67, 0x1b,
+  0x74, 0xb1, 0xb3, 0x50, 0x59, 0xdc, 0xd4, 0x21, 0x96, 0x78, 0x0c, 0xa1,
+  0xe3, 0xa4, 0x44, 0x8b, 0x54, 0x95, 0x68, 0x68, 0x90, 0xbb, 0xbc, 0xce,
+  0x48, 0xdb, 0xf1, 0xba, 0x2b, 0xaf, 0x1f, 0xc9, 0x4b, 0xde, 0xd6, 0x79,
+  0xb9, 0xb2, 0x92, 0xc2, 0x32, 0x2f, 0x54, 0x82, 0x27, 0x67, 0xbb, 0x76,
+  0xf7, 0x99, 0x73, 0xc5, 0xbf, 0x01, 0xaa, 0x22, 0xa0, 0x1c, 0x5a, 0x6a,
+  0x68, 0x9e, 0x68, 0x4b, 0xee, 0x47, 0xf0, 0x9f, 0xa3, 0xc9, 0x29, 0x06,
+  0x98, 0x63, 0xe3, 0xc6, 0xdf, 0xd2, 0x00, 0x04, 0xdf, 0xee, 0x46, 0x69,
+  0xb8, 0xf5, 0x5f, 0xa2, 0x79, 0xec, 0xdb, 0x3c, 0xfe, 0xdc, 0x53, 0x3f,
+  0xb3, 0xf6, 0xd2, 0xbb, 0x5e, 0xd1, 0x38, 0x41, 0x77, 0x61, 0x6b, 0xe7,
+  0x5c, 0xd2, 0x4b, 0xe6, 0xc0, 0x82, 0xe2, 0xec, 0xd4, 0x2e, 0xeb, 0xf9,
+  0x5d, 0xa7, 0xf6, 0x50, 0x37, 0x60, 0xf7, 0xfa, 0x60, 0x01, 0xd9, 0xb7,
+  0xfc, 0x93, 0x77, 0xbb, 0xe2, 0x2d, 0xca, 0xd0, 0x59, 0xbb, 0xf0, 0xd7,
+  0x24, 0xd1, 0xa2, 0x82, 0xbf, 0x81, 0x69, 0xeb, 0xc3, 0x3e, 0x87, 0x90,
+  0x64, 0xa2, 0x5f, 0x2a, 0x01, 0x05, 0x87, 0x70, 0x32, 0x48, 0x08, 0xb4,
+  0xea, 0x89, 0x3c, 0x74, 0xc5, 0xf1, 0xa2, 0x05, 0xeb, 0x22, 0xcd, 0x5c,
+  0xbc, 0xdd, 0x94, 0x74, 0x60, 0x62, 0x8b, 0xca, 0xd7, 0x43, 0x06, 0xa0,
+  0xe4, 0x23, 0x8e, 0x44, 0x4c, 0x3b, 0x0b, 0x80, 0xe3, 0xd3, 0x69, 0xa8,
+  0x05, 0x18, 0x84, 0x41, 0x39, 0x8e, 0x42, 0x4e, 0xf8, 0xa1, 0x2f, 0xb5,
+  0xef, 0x73, 0x9b, 0x25, 0xe8, 0x3c, 0x67, 0xa7, 0x2f, 0x2c, 0xd2, 0xcc,
+  0x87, 0x29, 0xb0, 0xb7, 0x45, 0x73, 0x58, 0xe9, 0xdc, 0x52, 0x22, 0x19,
+  0x4f, 0x07, 0x35, 0x42, 0xb2, 0x8b, 0x4a, 0x75, 0x68, 0xe0, 0x73, 0x0a,
+  0x1e, 0x15, 0x9c, 0x6b, 0x37, 0xc3, 0x31, 0xcf, 0xd1, 0x41, 0xd0, 0xa3,
+  0x52, 0x7f, 0xdc, 0x77, 0x87, 0x6c, 0xa4, 0xb8, 0x81, 0xb4, 0x80, 0x0d,
+  0xb1, 0x12, 0x71, 0xde, 0xf8, 0x8c, 0x5a, 0xd0, 0xa5, 0xbc, 0xbf, 0xe8,
+  0x36, 0x53, 0x29, 0xdb, 0x26, 0x42, 0xae, 0xa3, 0x40, 0x6c, 0x68, 0xbd,
+  0xf9, 0x46, 0xb6, 0xca, 0xac, 0x43, 0xd5, 0xcb, 0x9f, 0x20, 0xd1, 0xe6,
+  0xad, 0xbe, 0x2a, 0x7c, 0x1b, 0x08, 0x3d, 0x77, 0x22, 0xf8, 0x7b, 0x83,
+  0xe5, 0xea, 0x3e, 0xab, 0xdb, 0x96, 0x10, 0x6b, 0x52, 0xf8, 0x91, 0x9d,
+  0x79, 0xc3, 0xb7, 0x0f, 0xf4, 0xa0, 0xd4, 0xd4, 0x71, 0x1b, 0x8f, 0x58,
+  0xa0, 0xc1, 0x6a, 0x0d, 0xcd, 0xea, 0x3e, 0x2c, 0x7d, 0xaa, 0x08, 0x79,
+  0x56, 0xd3, 0x74, 0xeb, 0x2a, 0x75, 0x09, 0x90, 0xa3, 0x21, 0x1b, 0x97,
+  0xe8, 0x42, 0xab, 0xce, 0x9a, 0x19, 0x8c, 0xf7, 0x4e, 0x0d, 0x9a, 0xc9,
+  0x8e, 0x4f, 0xd2, 0x4f, 0x6b, 0xd1, 0xfb, 0x81, 0x51, 0x19, 0xff, 0xcf,
+  0xe2, 0x59, 0x3d, 0x17, 0x34, 0x30, 0x0e, 0xe5, 0x4b, 0x81, 0x49, 0x7a,
+  0xca, 0xa5, 0x7c, 0xbe, 0x75, 0x4f, 0xf6, 0xa5, 0x3e, 0x6c, 0xd1, 0x32,
+  0x51, 0x71, 0xec, 0x24, 0x2a, 0x42, 0xa4, 0x01, 0xa7, 0x7c, 0x0c, 0x05,
+  0x4d, 0xfc, 0x11, 0x4c, 0x1b, 0xe9, 0x8c, 0xcc, 0x08, 0x68, 0x87, 0xad,
+  0x7f, 0xd8, 0xd6, 0xdd, 0x21, 0x78, 0xe1, 0x18, 0x96, 0x7f, 0x64, 0x68,
+  0xf0, 0x13, 0xc6, 0x74, 0xc1, 0x61, 0x82, 0xc2, 0x80, 0x51, 0xb5, 0x73,
+  0x05, 0xad, 0xd8, 0x34, 0x46, 0xa3, 0x27, 0xf0, 0x5b, 0x08, 0xcb, 0x5e,
+  0x3a, 0x3e, 0xf5, 0x64, 0x05, 0x28, 0x6d, 0x71, 0x68, 0xfa, 0xb1, 0x3c,
+  0x8b, 0x11, 0xd4, 0x96, 0x52, 0x03, 0x30, 0xbb, 0x59, 0x97, 0xd3, 0x01,
+  0xca, 0x91, 0x33, 0xab, 0x8a, 0xe8, 0xda, 0xbb, 0xd9, 0x96, 0x87, 0xc6,
+  0xe9, 0x85, 0x8d, 0x4d, 0x76, 0x0e, 0x10, 0x56, 0xce, 0x01, 0x94, 0x87,
+  0xb9, 0x27, 0xf7, 0xa7, 0x7d, 0xbf, 0xec, 0x75, 0x18, 0xd9, 0x60, 0xc1,
+  0xe6, 0x17, 0x8d, 0xc1, 0x58, 0x23, 0xfc, 0xab, 0x04, 0x35, 0x77, 0x0d,
+  0x04, 0x00, 0x7c, 0xee, 0x2c, 0x36, 0xa8, 0xf1, 0x38, 0x8b, 0xf6, 0xd4,
+  0x15, 0xaf, 0xae, 0x0b, 0x23, 0x81, 0xa0, 0x45, 0xf6, 0x93, 0x68, 0xcd,
+  0xd3, 0xcb, 0x62, 0xd2, 0x61, 0xb1, 0x31, 0xee, 0x82, 0xeb, 0x21, 0x7e,
+  0x4e, 0xc6, 0x04, 0x88, 0x27, 0x9b, 0x46, 0x73, 0xc8, 0x6a, 0xb9, 0x5f,
+  0xf1, 0xeb, 0x55, 0x0c, 0x05, 0xd1, 0xdd, 0x7f, 0x2e, 0xb5, 0x82, 0xba,
+  0x8f, 0xc7, 0x0b, 0xee, 0x7d, 0xc4, 0xa0, 0x51, 0x1f, 0xfa, 0xf2, 0x81,
+  0x88, 0xfb, 0xca, 0xd3, 0xbb, 0xf5, 0xad, 0x7b, 0x69, 0x91, 0x16, 0x73,
+  0xd0, 0x97, 0x61, 0x2a, 0xf7, 0xc5, 0x89, 0xb3, 0xb4, 0x3a, 0x1a, 0xbc,
+  0xd0, 0x7e, 0xfd, 0x43, 0xd7, 0x5e, 0x9a, 0x5b, 0xde, 0x2b, 0x46, 0x14,
+  0x7b, 0xd4, 0xcc, 0x25, 0x25, 0x23, 0x45, 0x93, 0x7f, 0xef, 0x60, 0x7a,
+  0x2a, 0x22, 0xd9, 0x5f, 0x50, 0x5e, 0x39, 0xfb, 0xa0, 0x54, 0xab, 0xb5,
+  0x63, 0x39, 0x51, 0x3b, 0x56, 0x7a, 0xd4, 0x91, 0x0b, 0x95, 0xce, 0xf4,
+  0x53, 0x4b, 0x1e, 0x8b, 0xa2, 0x6a, 0x9e, 0xa1, 0x0d, 0xbc, 0x06, 0xb7,
+  0x2e, 0x43, 0x4e, 0x81, 0xe4, 0x16, 0x42, 0xcf, 0xa7, 0x9f, 0x14, 0x08,
+  0xa9, 0x42, 0x73, 0x67, 0x09, 0x09, 0x68, 0x3a, 0xea, 0xd6, 0xa6, 0x6d,
+  0x01, 0xf0, 0xa5, 0x0e, 0x13, 0xc5, 0xc5, 0x08, 0x3f, 0xc7, 0xb4, 0xc5,
+  0xb4, 0x29, 0x1e, 0x43, 0xd9, 0x1e, 0x8f, 0x78, 0xb1, 0x62, 0x8d, 0x0d,
+  0xda, 0xfe, 0xfc, 0x07, 0x3b, 0x8d, 0x0e, 0x61, 0x29, 0x46, 0x82, 0xfd,
+  0xd6, 0xe7, 0xd3, 0x34, 0x31, 0xf8, 0x3b, 0x5c, 0xcf, 0xcc, 0xc9, 0x57,
+  0x38, 0x2d, 0x6e, 0x07, 0x3b, 0x58, 0xdd, 0xfc, 0xfd, 0xd3, 0x80, 0xaa,
+  0x99, 0x1d, 0x78, 0x84, 0x5c, 0x31, 0xff, 0xd5, 0x86, 0x1c, 0xe5, 0x2e,
+  0xd0, 0xeb, 0xc3, 0xea, 0x6f, 0x04, 0x1b, 0x27, 0x64, 0x50, 0xd7, 0x8b,
+  0xb1, 0xd7, 0x9e, 0x3e, 0x4a, 0xde, 0xca, 0xba, 0xe0, 0xa2, 0x0c, 0x5e,
+  0x53, 0x8c, 0x23, 0x65, 0x00, 0xcd, 0x74, 0xa0, 0xd2, 0x3b, 0xfc, 0x54,
+  0x21, 0xbd, 0x16, 0x2b, 0xc9, 0x38, 0xf1, 0x9a, 0xca, 0xa8, 0x3a, 0x6f,
+  0x18, 0xe8, 0x1c, 0x59, 0x3f, 0x2f, 0xf6, 0x53, 0xf0, 0xcc, 0xf9, 0xf3,
+  0x30, 0x49, 0x02, 0x49, 0xa9, 0x74, 0x2f, 0x8d, 0xb3, 0x3a, 0xd0, 0x6d,
+  0xb5, 0xb4, 0x02, 0xe6, 0x88, 0x4b, 0xd8, 0x66, 0x74, 0xa5, 0x3e, 0xd3,
+  0xd5, 0xb8, 0x86, 0xb8, 0x8f, 0xdb, 0xf7, 0xe2, 0xa3, 0x58, 0xd9, 0xa6,
+  0x35, 0xd5, 0x7d, 0x4f, 0x72, 0xb4, 0x3b, 0x6a, 0xe7, 0x31, 0x03, 0x19,
+  0x06, 0xec, 0xde, 0xe3, 0xd2, 0x64, 0xc6, 0xba, 0xd4, 0xc4, 0x4e, 0xab,
+  0xfd, 0x82, 0x9f, 0x57, 0x6d, 0xbe, 0x15, 0xca, 0x56, 0x75, 0x00, 0x8d,
+  0xf7, 0xd3, 0xdb, 0xef, 0x89, 0x21, 0x45, 0x31, 0x2a, 0x36, 0x1e, 0x61,
+  0x92, 0x90, 0xe8, 0xde, 0x7e, 0xdb, 0x5e, 0x63, 0x6e, 0xbe, 0x3c, 0x19,
+  0xce, 0x52, 0x11, 0x9b, 0x50, 0xdb, 0x90, 0x65, 0x61, 0x3e, 0xf7, 0x70,
+  0xff, 0xa2, 0x7a, 0x9a, 0x74, 0x32, 0x3e, 0x80, 0xdd, 0x5d, 0xa5, 0x3f,
+  0x60, 0xf0, 0xac, 0xb9, 0x14, 0x59, 0x33, 0xff, 0x5a, 0xfe, 0xd0, 0xf8,
+  0x82, 0xfd, 0xcb, 0x1c, 0x20, 0x23, 0xfa, 0x0c, 0xe3, 0x3a, 0x32, 0x85,
+  0x61, 0x17, 0x70, 0xe0, 0x75, 0x28, 0xb0, 0xb4, 0x2a, 0x59, 0x4d, 0x29,
+  0xdd, 0x58, 0x85, 0xa7, 0xfa, 0x0a, 0xcd, 0x40, 0x7c, 0xcd, 0xdc, 0xe6,
+  0xa7, 0x30, 0xb1, 0x13, 0xad, 0xcd, 0x0b, 0xaa, 0x0e, 0x06, 0x7e, 0x54,
+  0x6b, 0xd7, 0x29, 0xfb, 0x2d, 0xac, 0xbf, 0x08, 0x50, 0x88, 0x3e, 0x38,
+  0x92, 0xce, 0xe0, 0xad, 0x6a, 0xf2, 0xd3, 0xef, 0xe6, 0x41, 0x66, 0x0e,
+  0x3e, 0xd5, 0x7f, 0xd1, 0x94, 0x8c, 0xe4, 0x08, 0x1f, 0x81, 0x36, 0x27,
+  0xfe, 0x09, 0x1f, 0xa0, 0x00, 0x30, 0xad, 0x97, 0xd0, 0x34, 0xaa, 0x9b,
+  0xf6, 0x85, 0x8c, 0xb5, 0xd2, 0x6c, 0x40, 0x39, 0x6d, 0x73, 0xcb, 0xf1,
+  0x0e, 0xd6, 0x17, 0x10, 0xcb, 0xbf, 0xd4, 0xa1, 0x09, 0x9d, 0x94, 0xa1,
+  0x2a, 0x7a, 0xd8, 0x5a, 0x30, 0xeb, 0x92, 0x27, 0xe3, 0xc2, 0x45, 0x47,
+  0xb8, 0xbd, 0x28, 0xe5, 0xcd, 0xe8, 0x69, 0xb3, 0x83, 0x01, 0x5f, 0x22,
+  0xe6, 0xf1, 0x43, 0x57, 0xf1, 0xfd, 0x64, 0x74, 0x02, 0x89, 0xa5, 0x4e,
+  0x92, 0x73, 0xf1, 0xa1, 0x30, 0xdc, 0xa6, 0xba, 0x51, 0xc8, 0x99, 0x7a,
+  0xd7, 0x03, 0xf4, 0x52, 0x36, 0x8a, 0x1b, 0x58, 0x62, 0x86, 0x60, 0x07,
+  0x18, 0xfb, 0x8e, 0xbe, 0xca, 0x84, 0xd6, 0xe1, 0x66, 0x83, 0x3d, 0x20,
+  0x8b, 0x66, 0xdc, 0x31, 0xb4, 0xfb, 0xf1, 0x8c, 0xb8, 0x3e, 0xbb, 0xa9,
+  0x51, 0xaf, 0xe4, 0x49, 0xf0, 0x21, 0xc1, 0x6e, 0x60, 0x00, 0x1f, 0xd1,
+  0x0a, 0x25, 0x60, 0xe0, 0x02, 0x49, 0x98, 0xc2, 0xee, 0x5c, 0xb6, 0xad,
+  0xfb, 0xed, 0x91, 0x47, 0x58, 0xd4, 0xcf, 0x08, 0xb2, 0x1c, 0x4f, 0x8c,
+  0x35, 0x79, 0x52, 0x0b, 0x45, 0x2b, 0xb3, 0x01, 0xd1, 0x18, 0xc8, 0x8f,
+  0xb5, 0xfe, 0x7f, 0x0a, 0xc9, 0x1f, 0x48, 0xbe, 0x4e, 0x2b, 0x97, 0x58,
+  0x23, 0xea, 0xa3, 0xf3, 0x1c, 0x0f, 0x66, 0x07, 0x85, 0x1f, 0x20, 0x5f,
+  0xd7, 0x46, 0xc1, 0x02, 0x93, 0xbb, 0xa2, 0x03, 0xe2, 0xf6, 0xcd, 0xbb,
+  0x9e, 0xbe, 0x22, 0x17, 0xaa, 0x50, 0x0a, 0xb4, 0x3b, 0xd3, 0x49, 0x7c,
+  0xfc, 0xd9, 0x81, 0xec, 0xf8, 0x27, 0x07, 0x14, 0x53, 0x56, 0x00, 0xd9,
+  0xad, 0xe6, 0x7b, 0x43, 0x87, 0xc1, 0x31, 0x11, 0x2b, 0xb9, 0xcc, 0x64,
+  0xb6, 0x27, 0x48, 0x47, 0x80, 0xee, 0xee, 0x68, 0x13, 0xb4, 0x29, 0xcd,
+  0x85, 0xc2, 0x7d, 0xa1, 0x13, 0xd4, 0x03, 0x14, 0x62, 0x41, 0x0f, 0x92,
+  0x50, 0x18, 0x10, 0x6e, 0x6f, 0xae, 0xd6, 0x1f, 0x77, 0x32, 0xe9, 0x53,
+  0x05, 0xfe, 0xb3, 0x90, 0xe5, 0xf1, 0x99, 0x0a, 0x0a, 0x2c, 0xc7, 0x8a,
+  0xd1, 0xcf, 0x38, 0x0a, 0x05, 0xba, 0x53, 0xdc, 0xbf, 0x0a, 0x3a, 0xc8,
+  0x3c, 0xf2, 0x0f, 0xdc, 0xc8, 0x51, 0x88, 0x8d, 0x33, 0x5d, 0x2d, 0xa1,
+  0x5a, 0xae, 0x5f, 0x5c, 0x4d, 0x32, 0x41, 0x9f, 0x10, 0x3e, 0xc3, 0x0e,
+  0xc3, 0xae, 0xc4, 0xda, 0xab, 0x9f, 0x83, 0x44, 0x33, 0xaa, 0x6a, 0xbe,
+  0xff, 0x81, 0xf5, 0xf4, 0xe5, 0x53, 0x9f, 0xfd, 0x84, 0xe6, 0x65, 0x4b,
+  0x04, 0x10, 0x04, 0xea, 0x34, 0x07, 0x64, 0xd3, 0x9a, 0x10, 0x78, 0x29,
+  0xd1, 0x99, 0xa6, 0x44, 0x53, 0xbe, 0x50, 0x77, 0x20, 0x7a, 0x1a, 0x90,
+  0x20, 0x10, 0x47, 0xb4, 0x36, 0xcf, 0x85, 0x1e, 0xa4, 0xa2, 0xda, 0x59,
+  0x61, 0x56, 0x20, 0x5b, 0xd2, 0x7c, 0xd7, 0xf1, 0x74, 0x98, 0x45, 0xa0,
+  0x66, 0x39, 0x89, 0xf5, 0xfe, 0x6c, 0x8b, 0x72, 0x56, 0x68, 0xb5, 0x03,
+  0x73, 0x62, 0xe4, 0xde, 0xc3, 0xe1, 0xd8, 0x0d, 0x30, 0x67, 0x5c, 0xac,
+  0x2f, 0xbf, 0x6b, 0x34, 0x27, 0x47, 0xa1, 0xce, 0xc5, 0xad, 0x51, 0x6a,
+  0xd0, 0xc0, 0xbe, 0x91, 0xec, 0x3e, 0x41, 0x69, 0xe7, 0x7d, 0xd4, 0xe8,
+  0xf5, 0xfe, 0xcb, 0xbc, 0x49, 0x93, 0x0b, 0x58, 0x2f, 0x51, 0xf5, 0x5e,
+  0xaf, 0x27, 0x81, 0xbd, 0x5f, 0x69, 0x41, 0xb7, 0xcd, 0x9e, 0x5a, 0x97,
+  0xf4, 0x4f, 0x79, 0x2a, 0x99, 0x62, 0x8a, 0x79, 0x78, 0xff, 0x8f, 0x15,
+  0x30, 0x57, 0xba, 0xa1, 0x62, 0xdc, 0xa7, 0x7d, 0xcd, 0x62, 0x75, 0xa0,
+  0x02, 0x2f, 0x4f, 0x80, 0x9e, 0xd4, 0x7c, 0xd3, 0xe6, 0x82, 0xd4, 0xd9,
+  0xbb, 0x39, 0x6f, 0x11, 0xff, 0xab, 0x06, 0x47, 0xcc, 0x5a, 0x0a, 0xc0,
+  0x09, 0x1b, 0x8e, 0x72, 0xb7, 0x2a, 0xac, 0x9f, 0xb3, 0x5b, 0xe9, 0xe6,
+  0xb8, 0x1e, 0xe9, 0x20, 0xb8, 0x7e, 0xb5, 0x5d, 0x77, 0x0c, 0xde, 0x00,
+  0x86, 0x17, 0xea, 0x33, 0xc1, 0xfa, 0x55, 0xb5, 0x6a, 0x33, 0x46, 0xa7,
+  0x15, 0x9c, 0xc5, 0x3b, 0xc2, 0x3e, 0xbe, 0x8e, 0x59, 0xe8, 0x96, 0x0a,
+  0xb1, 0xa2, 0xf0, 0x00, 0x50, 0xf1, 0x15, 0x97, 0x98, 0x48, 0x80, 0x84,
+  0x6f, 0x5e, 0xa0, 0x6c, 0x8f, 0xf6, 0x22, 0x76, 0x30, 0xe1, 0xda, 0x48,
+  0xa9, 0xc7, 0x17, 0x41, 0xec, 0x31, 0x8a, 0x0a, 0x82, 0xf3, 0xd5, 0xb3,
+  0xff, 0x2e, 0xaf, 0x03, 0xc3, 0xe1, 0x45, 0x86, 0x8d, 0x5f, 0xc5, 0x69,
+  0x1a, 0x28, 0x77, 0x8d, 0x76, 0x18, 0xcc, 0x66, 0xd0, 0xf2, 0x98, 0xdb,
+  0xac, 0x0b, 0xf9, 0xf2, 0xd6, 0xb5, 0x6e, 0x13, 0xbd, 0x2c, 0x92, 0xc9,
+  0xb5, 0x6c, 0x65, 0x06, 0xc8, 0xc3, 0x50, 0x59, 0xb5, 0x52, 0x57, 0xa7,
+  0x1d, 0x2c, 0x7e, 0xe0, 0xc2, 0x8c, 0x55, 0xcc, 0xe2, 0xba, 0x78, 0x62,
+  0x61, 0xf3, 0xdc, 0x33, 0x1a, 0x14, 0x9b, 0x6e, 0x55, 0x13, 0x9d, 0x60,
+  0x06, 0x45, 0x97, 0x9b, 0x1d, 0xa2, 0x00, 0xa8, 0x69, 0xa0, 0x61, 0x76,
+  0x36, 0x79, 0x79, 0x99, 0x0b, 0x70, 0x0c, 0xba, 0x35, 0x81, 0xdd, 0x52,
+  0x13, 0xe2, 0xc2, 0xcf, 0xb9, 0x01, 0x50, 0xd0, 0xe3, 0x5f, 0x90, 0x5e,
+  0xd9, 0x33, 0xc7, 0x66, 0xf6, 0x10, 0x13, 0xa0, 0x58, 0x0c, 0xe6, 0xc9,
+  0x3e, 0x13, 0x47, 0x48, 0x4f, 0x5a, 0x5d, 0x8e, 0x42, 0xbb, 0x2d, 0x2e,
+  0x5d, 0x07, 0x57, 0x61, 0x0e, 0x7d, 0x57, 0xbb, 0xb2, 0xd7, 0x20, 0x88,
+  0xfd, 0xac, 0xe3, 0x17, 0xa1, 0x60, 0x6a, 0xd9, 0xf8, 0x07, 0x6a, 0xe0,
+  0xf6, 0xb0, 0xa4, 0x82, 0x3f, 0x48, 0x56, 0xf7, 0x38, 0xd7, 0x79, 0x2c,
+  0x57, 0xd6, 0xe3, 0x6c, 0x23, 0xcf, 0x6b, 0xd2, 0xe5, 0xb3, 0xca, 0x0b,
+  0x56, 0xf1, 0x14, 0x02, 0xb8, 0x41, 0x37, 0x9c, 0x71, 0x71, 0x6a, 0x03,
+  0x4f, 0x83, 0xde, 0xbb, 0xd9, 0x47, 0x5b, 0x26, 0xbd, 0x96, 0xd4, 0xcc,
+  0x37, 0x26, 0x87, 0xea, 0x4e, 0x2e, 0x09, 0x88, 0x43, 0x04, 0x26, 0x69,
+  0x1f, 0xeb, 0x65, 0xe2, 0xd9, 0x9c, 0x33, 0x69, 0x6f, 0x4d, 0xb5, 0xea,
+  0x4a, 0x80, 0xa4, 0x84, 0xfc, 0xcd, 0xab, 0xa7, 0x1a, 0x51, 0x79, 0x8b,
+  0x1e, 0x79, 0xdc, 0x65, 0xfa, 0x37, 0xe4, 0x47, 0x02, 0x08, 0x53, 0xfa,
+  0x9a, 0xf8, 0x32, 0xa3, 0xbc, 0x6c, 0x91, 0x2d, 0x5d, 0xe9, 0x92, 0x1d,
+  0xf0, 0x5b, 0x9f, 0x81, 0x42, 0x2e, 0x51, 0x81, 0x4a, 0xdf, 0xb3, 0x5a,
+  0x3a, 0x80, 0x8d, 0x2d, 0x2e, 0xac, 0xcf, 0x7e, 0xe9, 0xbb, 0x2f, 0x9a,
+  0x20, 0xdf, 0x9c, 0x3b, 0xa8, 0xbf, 0xaa, 0xdd, 0x17, 0x46, 0x3d, 0xb9,
+  0xcd, 0xbb, 0x7f, 0x36, 0xca, 0xbf, 0xe3, 0x65, 0xe9, 0xda, 0x6f, 0xc3,
+  0x59, 0xcb, 0x42, 0x0d, 0xad, 0xf8, 0x96, 0xb9, 0x9f, 0x80, 0x8d, 0x6f,
+  0xd4, 0x92, 0x3f, 0xad, 0xce, 0x50, 0x85, 0x4e, 0x51, 0x5c, 0x01, 0x1f,
+  0x01, 0x4c, 0xba, 0x47, 0xc7, 0x63, 0x05, 0xf3, 0xb2, 0xcc, 0xc4, 0x9a,
+  0x06, 0xc1, 0x37, 0x18, 0xc8, 0xb8, 0x57, 0xf1, 0x05, 0xd1, 0x7c, 0x5f,
+  0x62, 0x40, 0x34, 0xf6, 0xce, 0x2f, 0x94, 0x0a, 0x29, 0x35, 0x03, 0xfe,
+  0xee, 0x2e, 0x71, 0x9f, 0x59, 0xc3, 0x6c, 0xcc, 0xc1, 0xa0, 0x47, 0x50,
+  0xf6, 0x45, 0x28, 0x43, 0x5f, 0x61, 0xee, 0x30, 0x4d, 0x17, 0x92, 0x27,
+  0x3f, 0x2d, 0x3a, 0x24, 0x50, 0x62, 0x84, 0x76, 0x8f, 0xf4, 0xfb, 0x88,
+  0x1b, 0x6a, 0x37, 0x65, 0x75, 0xe6, 0xc0, 0x16, 0x6c, 0x8e, 0xeb, 0x88,
+  0xef, 0x20, 0x04, 0xe5, 0x24, 0x58, 0x28, 0xd4, 0x91, 0x63, 0x54, 0x01,
+  0x4d, 0x03, 0x0a, 0x70, 0x30, 0x7a, 0xd8, 0x1f, 0x65, 0x1e, 0x01, 0x49,
+  0x7e, 0xd3, 0x6f, 0x9b, 0xc1, 0x96, 0x69, 0xa3, 0xfa, 0x0d, 0xb5, 0x48,
+  0xcb, 0xb0, 0xf1, 0xde, 0x7d, 0x2d, 0x11, 0x46, 0xf1, 0x6b, 0x1c, 0x9c,
+  0xd5, 0x9a, 0x13, 0xeb, 0xa1, 0x23, 0xd9, 0xd3, 0x08, 0x29, 0x76, 0xbc,
+  0x42, 0xf1, 0x8b, 0x99, 0x23, 0x2d, 0xbd, 0x75, 0xa3, 0xc2, 0xde, 0x7b,
+  0x73, 0xb1, 0x36, 0x14, 0x8c, 0x2c, 0xd6, 0x37, 0x1d, 0xe1, 0x9e, 0x6c,
+  0x56, 0x37, 0x91, 0x0c, 0x3a, 0xc0, 0x2e, 0x08, 0xf8, 0xbe, 0x5d, 0xca,
+  0xb7, 0xb2, 0x74, 0x57, 0xd3, 0x70, 0xca, 0xa9, 0xae, 0xdb, 0x8b, 0x65,
+  0x98, 0xb7, 0x36, 0x12, 0xdd, 0x9d, 0x08, 0x7b, 0xb5, 0x1a, 0x3f, 0x13,
+  0x49, 0xe6, 0x69, 0xac, 0xdc, 0x3d, 0x44, 0x9f, 0xf5, 0xd5, 0x73, 0xfe,
+  0x89, 0x67, 0xf2, 0xa5, 0xaf, 0x35, 0x2b, 0xc6, 0x2c, 0xf2, 0x72, 0x67,
+  0x0c, 0x83, 0xae, 0x01, 0x2a, 0x1d, 0x7e, 0x55, 0xca, 0x68, 0xad, 0xc7,
+  0x7f, 0x8f, 0x3f, 0x7f, 0x03, 0x2c, 0x88, 0x6b, 0x52, 0xac, 0x9c, 0xb0,
+  0xc0, 0xe4, 0x9a, 0xfd, 0x3e, 0x93, 0xe3, 0x16, 0x12, 0xd2, 0x31, 0x57,
+  0xff, 0x37, 0x60, 0xe1, 0x5e, 0xc0, 0xb9, 0x49, 0x82, 0xd1, 0x5f, 0x2c,
+  0x34, 0xba, 0xaa, 0x0e, 0x7b, 0x24, 0x2b, 0x73, 0x60, 0xf0, 0xce, 0xfc,
+  0xf7, 0xf8, 0xd9, 0xc7, 0x18, 0x97, 0xa6, 0x5d, 0x90, 0xc0, 0xbc, 0x15,
+  0xcf, 0x68, 0x6a, 0x49, 0xf2, 0xec, 0x23, 0x75, 0x62, 0xb6, 0xf2, 0xbe,
+  0x52, 0xad, 0x75, 0xf0, 0x12, 0x27, 0x92, 0xf4, 0xd9, 0xaa, 0x96, 0x6a,
+  0xbd, 0x51, 0x2d, 0x63, 0x91, 0xaa, 0x7d, 0x2c, 0xd9, 0x22, 0x4f, 0x2f,
+  0x7b, 0xfd, 0x5f, 0x60, 0x59, 0xc0, 0x8f, 0xe7, 0xd1, 0x33, 0x6e, 0x42,
+  0xb4, 0x4f, 0xd7, 0x7c, 0x48, 0x99, 0x1e, 0x4c, 0xcd, 0x09, 0x15, 0x95,
+  0x33, 0xba, 0xfa, 0x0a, 0xbf, 0x61, 0x14, 0x84, 0xee, 0x9c, 0x4f, 0xd5,
+  0x2e, 0x38, 0xc3, 0xff, 0xd6, 0x8f, 0x92, 0x73, 0x8f, 0xd9, 0xc4, 0x24,
+  0xa3, 0x26, 0x07, 0x43, 0xc5, 0x06, 0x4d, 0xaa, 0x32, 0x29, 0xc4, 0x57,
+  0xd9, 0x83, 0x6a, 0x87, 0xdf, 0x6b, 0xf8, 0x69, 0x25, 0x03, 0xc5, 0xa3,
+  0xcf, 0xd6, 0x3b, 0x96, 0x0f, 0x87, 0xae, 0xea, 0xcf, 0x77, 0xc9, 0x52,
+  0xa8, 0xd8, 0x02, 0xfd, 0x02, 0x6e, 0x5a, 0x03, 0x31, 0x00, 0x40, 0xeb,
+  0x2a, 0x83, 0x84, 0xbe, 0x80, 0x9b, 0x07, 0x3b, 0x63, 0x00, 0xe6, 0x31,
+  0xb5, 0x34, 0x34, 0xdd, 0x1d, 0x82, 0x32, 0x8d, 0xcd, 0xa0, 0x8f, 0xbc,
+  0x6e, 0x02, 0x49, 0x55, 0x1e, 0xdc, 0x0f, 0x3f, 0x2c, 0x78, 0x1b, 0x04,
+  0x77, 0x44, 0x92, 0x8a, 0x0d, 0xa2, 0x01, 0x79, 0x2a, 0x81, 0x68, 0xa5,
+  0x75, 0x39, 0x1c, 0x3b, 0xa0, 0xa8, 0x12, 0xeb, 0xb9, 0x7c, 0x1a, 0xaa,
+  0xaa, 0x08, 0xec, 0x49, 0xa0, 0xdd, 0x47, 0x01, 0xc1, 0x0e, 0xad, 0x01,
+  0x9b, 0x22, 0xa6, 0x39, 0x05, 0xcb, 0xb7, 0xf3, 0x00, 0x5d, 0xf1, 0xc2,
+  0x19, 0x8e, 0xf1, 0x4d, 0x6c, 0x45, 0x6b, 0xc5, 0x76, 0x3f, 0xec, 0x66,
+  0x8a, 0x43, 0xf4, 0x68, 0x5e, 0x2e, 0x85, 0x5f, 0x7d, 0x91, 0xdb, 0xe8,
+  0x39, 0xac, 0x41, 0x33, 0x54, 0x19, 0xcf, 0x69, 0x9f, 0x3b, 0xbb, 0xb7,
+  0xb1, 0xdb, 0x06, 0xdc, 0x65, 0x4e, 0xac, 0xf1, 0x38, 0x59, 0x5b, 0x07,
+  0xe8, 0x9c, 0xd6, 0x22, 0x40, 0x84, 0x2c, 0xd4, 0x6d, 0xd0, 0x11, 0x32,
+  0xf0, 0xa3, 0x31, 0x6e, 0x4a, 0x62, 0x70, 0xaf, 0x8d, 0x17, 0x49, 0x22,
+  0x8e, 0xb8, 0x51, 0x2a, 0x73, 0x0f, 0x9f, 0x7f, 0x14, 0x55, 0x30, 0xb0,
+  0x93, 0xbb, 0x13, 0xea, 0x4f, 0xfb, 0x3b, 0xe4, 0xbb, 0x72, 0x2f, 0x5d,
+  0x56, 0x7a, 0xa1, 0x56, 0xd6, 0x98, 0xdb, 0x17, 0x81, 0x00, 0x79, 0x72,
+  0x98, 0x9d, 0x23, 0x99, 0xc1, 0xef, 0x16, 0xe0, 0xe5, 0x12, 0x3d, 0x70,
+  0xf5, 0x16, 0x4b, 0x47, 0xff, 0xae, 0x0b, 0x0c, 0x33, 0xbe, 0x6a, 0x72,
+  0xc4, 0x94, 0xae, 0xfd, 0x8a, 0x58, 0x9e, 0x40, 0xbd, 0x12, 0x1e, 0x8f,
+  0x45, 0x27, 0xc2, 0x8c, 0xe2, 0xef, 0xbc, 0x7a, 0xb6, 0x1f, 0x54, 0xd4,
+  0xa7, 0x29, 0x1c, 0xdc, 0x55, 0xff, 0x12, 0x39, 0xaf, 0x91, 0x41, 0xee,
+  0xb0, 0xc7, 0x8c, 0x1a, 0xa6, 0x3e, 0x44, 0xc0, 0x14, 0x4f, 0x1b, 0x63,
+  0xf1, 0x27, 0x4d, 0x2e, 0x9f, 0x4b, 0xfb, 0xba, 0x69, 0x2d, 0x06, 0xb0,
+  0x61, 0xf6, 0xdb, 0x2a, 0xc2, 0x5f, 0x64, 0x83, 0x4b, 0xb1, 0x55, 0x91,
+  0xfe, 0xc9, 0x03, 0x32, 0x2f, 0xbe, 0x4d, 0xec, 0x8a, 0x0f, 0xdf, 0x1f,
+  0x5e, 0x56, 0x95, 0xcd, 0xd5, 0x43, 0x37, 0xb9, 0xa3, 0x86, 0xe8, 0xd5,
+  0x4a, 0x7a, 0x03, 0x14, 0x9b, 0xd7, 0xb0, 0x12, 0x4b, 0x58, 0x06, 0x05,
+  0x6b, 0x7c, 0x8d, 0x57, 0x0c, 0x56, 0x9c, 0x5c, 0x64, 0x1b, 0x33, 0xfb,
+  0x3b, 0x6d, 0x6c, 0xc3, 0x82, 0x4c, 0x50, 0x20, 0x0f, 0xb1, 0x90, 0x86,
+  0x3a, 0x04, 0x00, 0x4b, 0x90, 0xe8, 0x99, 0xfe, 0x06, 0x79, 0x59, 0x2d,
+  0x4b, 0xb8, 0xed, 0x28, 0x6b, 0xff, 0x44, 0xa9, 0xf5, 0xe2, 0xcd, 0xbe,
+  0xb6, 0x87, 0x66, 0x41, 0xa3, 0xb7, 0xf1, 0xf7, 0x52, 0x4b, 0x8c, 0xbb,
+  0x3a, 0xe0, 0xb5, 0xac, 0x2b, 0xf5, 0x3c, 0xef, 0x56, 0xe3, 0x10, 0xc7,
+  0x0a, 0x18, 0xaf, 0xff, 0x56, 0xef, 0xc8, 0x0d, 0x2d, 0x83, 0x14, 0xd5,
+  0x5f, 0x4a, 0xb6, 0xb0, 0x1d, 0x37, 0x92, 0x6f, 0x94, 0x03, 0xd6, 0xcc,
+  0x6f, 0xdf, 0x84, 0x00, 0xb5, 0xa5, 0x7e, 0x24, 0x3c, 0xc1, 0x25, 0xae,
+  0x20, 0xa2, 0x28, 0xa4, 0xd7, 0x51, 0x56, 0x2b, 0x39, 0x7f, 0x9b, 0x38,
+  0x08, 0x9f, 0x7c, 0xd5, 0x24, 0xb7, 0x77, 0x4d, 0xc0, 0x81, 0xad, 0x51,
+  0xd3, 0xc4, 0x54, 0xf9, 0xc3, 0x11, 0xda, 0x21, 0xfd, 0x9b, 0x6b, 0x5b,
+  0xc3, 0xf7, 0x4a, 0x03, 0x40, 0x47, 0x56, 0x8d, 0xb2, 0x7d, 0x3b, 0x3e,
+  0x6b, 0x13, 0x9a, 0x5e, 0x0d, 0x62, 0xb8, 0xc0, 0x0d, 0x3f, 0xf2, 0xa1,
+  0xe8, 0x48, 0x3d, 0xbd, 0x2a, 0xcc, 0x03, 0x86, 0x94, 0x67, 0xe8, 0x4b,
+  0xed, 0x92, 0x58, 0xad, 0x8d, 0xf2, 0x34, 0x78, 0xe7, 0xa6, 0xe5, 0x5a,
+  0x61, 0x6b, 0x9d, 0x11, 0x9c, 0x05, 0x94, 0x12, 0x5c, 0x43, 0x8f, 0x74,
+  0x93, 0xa7, 0x53, 0xd1, 0xcd, 0x34, 0x88, 0xa1, 0x5f, 0xe4, 0x6a, 0xe2,
+  0x4a, 0x14, 0x00, 0x6e, 0x87, 0xb7, 0xb4, 0xd1, 0xc8, 0xf0, 0x0e, 0xd2,
+  0xa3, 0x3c, 0x3d, 0x89, 0xaf, 0x39, 0x83, 0x27, 0xda, 0x9a, 0x58, 0x43,
+  0xa3, 0xc0, 0xa3, 0x3b, 0x2e, 0x48, 0x79, 0x28, 0x99, 0x06, 0x52, 0x78,
+  0xbc, 0xee, 0x08, 0x18, 0xb4, 0x68, 0x04, 0xe7, 0x0a, 0x53, 0xf2, 0xbf,
+  0x32, 0x7a, 0x41, 0x51, 0x0b, 0xb1, 0x6d, 0x9a, 0xeb, 0x19, 0x1c, 0xa7,
+  0x4f, 0x93, 0xc0, 0xc6, 0xb2, 0x0a, 0xef, 0x1b, 0xb0, 0x59, 0xf2, 0x46,
+  0xec, 0x44, 0xa3, 0x20, 0x23, 0x9e, 0x2f, 0x44, 0x2c, 0xf4, 0xa9, 0x1c,
+  0x2a, 0xb2, 0x96, 0x06, 0xe5, 0x5a, 0x69, 0xef, 0x74, 0x69, 0x89, 0x72,
+  0xd9, 0x87, 0x93, 0x4d, 0xdf, 0xda, 0x39, 0x99, 0xf8, 0x09, 0x43, 0xf4,
+  0xd6, 0x9f, 0x7c, 0x97, 0x49, 0x74, 0x4a, 0x95, 0x5e, 0x87, 0xf8, 0x73,
+  0xf1, 0x1d, 0xe5, 0x19, 0x61, 0xc8, 0x43, 0x6e, 0xb9, 0x60, 0x3c, 0x9c,
+  0x56, 0xbc, 0xfe, 0xc6, 0xfb, 0xfb, 0x73, 0x0c, 0xa5, 0xad, 0x9e, 0x32,
+  0x71, 0xc3, 0x50, 0x0c, 0x20, 0xf7, 0x82, 0x1d, 0xcc, 0xc0, 0x42, 0x45,
+  0xa4, 0xb7, 0x18, 0xf5, 0xab, 0x4a, 0x89, 0xef, 0xdc, 0x93, 0x74, 0x60,
+  0x02, 0xd7, 0xd7, 0x84, 0xf5, 0x95, 0xe5, 0x34, 0x22, 0x63, 0x87, 0xa4,
+  0xb7, 0xd7, 0x31, 0x74, 0x60, 0xc3, 0x06, 0x2b, 0x98, 0x6f, 0x6b, 0x3b,
+  0x7b, 0xa4, 0x4f, 0x32, 0x99, 0x7d, 0xa0, 0x65, 0xc1, 0x26, 0xee, 0x62,
+  0xe2, 0x9c, 0x52, 0x98, 0x26, 0x4c, 0x97, 0xdb, 0xd3, 0x98, 0x35, 0x71,
+  0x7d, 0x09, 0xc3, 0x5d, 0xb8, 0x3e, 0x38, 0x18, 0x71, 0x7c, 0x4d, 0xf1,
+  0xc9, 0xbd, 0xf2, 0x4c, 0xae, 0x33, 0xe8, 0x92, 0xb5, 0x09, 0x79, 0x74,
+  0xaa, 0xff, 0x7b, 0x44, 0x7d, 0x97, 0xd0, 0x9a, 0xec, 0x97, 0xbe, 0xfb,
+  0xe5, 0x4f, 0xc4, 0x53, 0xf1, 0xd1, 0xe8, 0x8a, 0xf5, 0xa7, 0xb6, 0xad,
+  0x0a, 0xab, 0x24, 0xed, 0x91, 0xe0, 0x0b, 0xf0, 0x67, 0xdf, 0xfc, 0x54,
+  0xb4, 0x66, 0x10, 0x22, 0xef, 0x69, 0x42, 0xa6, 0xdd, 0x23, 0xe4, 0x9b,
+  0xde, 0xc8, 0x91, 0x37, 0x4b, 0xcd, 0x26, 0x8a, 0x91, 0x57, 0x2b, 0xb3,
+  0xda, 0xb6, 0x89, 0x03, 0xc5, 0xab, 0x3a, 0xcf, 0x3c, 0x7c, 0xb7, 0x45,
+  0x6a, 0xf1, 0x39, 0x72, 0x80, 0xa8, 0x80, 0x3a, 0x67, 0xd9, 0xb0, 0xbc,
+  0x38, 0x84, 0xf6, 0xc5, 0x11, 0x40, 0x2f, 0x3f, 0x85, 0xeb, 0xb5, 0xe0,
+  0x3a, 0x68, 0xad, 0x53, 0xe4, 0xb7, 0xf6, 0x6a, 0xd2, 0xda, 0xe0, 0x7d,
+  0xa5, 0xeb, 0x19, 0x5f, 0x23, 0xfa, 0x82, 0x1f, 0x94, 0xd3, 0x2a, 0x5d,
+  0x7d, 0x52, 0xd5, 0x1e, 0x52, 0xcb, 0xcb, 0xb4, 0xe1, 0x05, 0x8e, 0xd4,
+  0xdd, 0x51, 0x59, 0xa7, 0xd4, 0x5e, 0xce, 0xda, 0xd2, 0x43, 0xc1, 0x9f,
+  0x45, 0x47, 0xc6, 0xb2, 0xec, 0xcf, 0xab, 0x4a, 0x1c, 0x64, 0xdb, 0x29,
+  0xe4, 0x07, 0xe8, 0x32, 0xf4, 0xad, 0x05, 0x5c, 0x3e, 0x4c, 0x66, 0x19,
+  0xc3, 0x66, 0xf3, 0xb3, 0x02, 0xbb, 0x5a, 0x30, 0x3d, 0x2c, 0x86, 0x3d,
+  0x3f, 0x8a, 0xa4, 0xe1, 0x51, 0xf6, 0x0f, 0x6f, 0x5b, 0xc9, 0xcf, 0xf6,
+  0x17, 0x15, 0xae, 0x1f, 0x2a, 0xd5, 0xd4, 0x71, 0xfa, 0x90, 0x42, 0x02,
+  0x59, 0xda, 0xff, 0x64, 0x1c, 0xe0, 0x73, 0xed, 0xc5, 0xf4, 0xff, 0xd7,
+  0xcd, 0x8b, 0x9a, 0xdc, 0xc4, 0x0a, 0x5b, 0x4f, 0x40, 0xae, 0xe4, 0xda,
+  0x09, 0xbb, 0x73, 0x90, 0x87, 0xbf, 0x72, 0x81, 0x8f, 0xc8, 0x5f, 0x9c,
+  0x16, 0xce, 0x00, 0x6a, 0xf1, 0x42, 0xf1, 0xbb, 0x09, 0xd1, 0x20, 0x88,
+  0x71, 0x76, 0xc2, 0x6d, 0x07, 0xae, 0x20, 0x00, 0x27, 0x07, 0x87, 0x63,
+  0x38, 0x63, 0xbe, 0xf1, 0xbf, 0xca, 0xbb, 0xe7, 0x17, 0x71, 0x88, 0x9e,
+  0xee, 0x58, 0xed, 0x67, 0xfe, 0xa8, 0x80, 0x06, 0xb8, 0x6d, 0xe5, 0xc4,
+  0x50, 0x86, 0xf6, 0x8b, 0xee, 0x25, 0xf1, 0x07, 0xe8, 0x3c, 0x70, 0x2b,
+  0xf8, 0xe0, 0xc1, 0x1b, 0x23, 0xe6, 0x35, 0xde, 0xa0, 0x3b, 0x95, 0x27,
+  0x74, 0xb3, 0x8a, 0xb4, 0xbf, 0x00, 0x9b, 0xcb, 0x82, 0xcb, 0x97, 0x47,
+  0xf8, 0x90, 0xec, 0xf1, 0xc1, 0xac, 0xbc, 0xdd, 0x5d, 0x2f, 0x98, 0xda,
+  0x33, 0xcb, 0x5e, 0xba, 0xcf, 0xa1, 0x11, 0x48, 0x54, 0x52, 0xca, 0x23,
+  0x4a, 0x3a, 0x16, 0xb3, 0xfb, 0x59, 0xa8, 0x0e, 0xca, 0xa3, 0xcc, 0x9f,
+  0x96, 0x3b, 0xb2, 0xb3, 0x3a, 0xdd, 0xd6, 0xb3, 0x66, 0x3c, 0xda, 0xc2,
+  0xd7, 0x96, 0xe7, 0x96, 0x60, 0xb0, 0x7b, 0x17, 0x5b, 0x7b, 0xa2, 0xd8,
+  0xb9, 0xe6, 0x30, 0x02, 0x5c, 0x27, 0xb7, 0xfd, 0x5b, 0x1f, 0xa1, 0xe7,
+  0x40, 0x0a, 0x61, 0x7d, 0x85, 0x1e, 0x29, 0x8e, 0x00, 0xec, 0xbd, 0x1b,
+  0x78, 0xfa, 0xfb, 0x5e, 0x74, 0x43, 0x93, 0x82, 0x02, 0xb8, 0xe5, 0x47,
+  0x83, 0x87, 0x50, 0xea, 0x9d, 0x8d, 0xc8, 0x93, 0x07, 0x89, 0x72, 0xd8,
+  0xfb, 0x8f, 0x0a, 0x6c, 0x1d, 0x06, 0x47, 0xf8, 0xf1, 0x94, 0xa4, 0x21,
+  0xfb, 0x80, 0xd8, 0x68, 0x1d, 0xcd, 0x1d, 0xfa, 0x46, 0x12, 0x88, 0xee,
+  0xd7, 0x9d, 0xae, 0xe7, 0xc4, 0xf7, 0x3e, 0x19, 0xcf, 0x71, 0xfa, 0x92,
+  0xe6, 0x9b, 0x0c, 0x43, 0x49, 0xe2, 0xec, 0x64, 0x57, 0xba, 0xf3, 0x0b,
+  0xcd, 0xb0, 0x59, 0x1f, 0x32, 0xf2, 0x4f, 0x64, 0x0d, 0xe5, 0x2b, 0x7a,
+  0x8d, 0x1d, 0x63, 0x70, 0x21, 0x15, 0x27, 0x32, 0xc9, 0x2c, 0xc7, 0x34,
+  0xc2, 0xb3, 0xbc, 0xba, 0x85, 0xa5, 0x8f, 0xe4, 0x10, 0xa3, 0x38, 0x46,
+  0x64, 0x2b, 0x20, 0xa3, 0x5b, 0x42, 0x30, 0x1b, 0x7f, 0x57, 0x03, 0xee,
+  0x8d, 0xe6, 0x34, 0x33, 0x45, 0xbe, 0x67, 0x8c, 0x9e, 0x60, 0xb6, 0x13,
+  0x72, 0x35, 0x2f, 0x66, 0x4a, 0x8d, 0x8b, 0x3a, 0xf9, 0x2f, 0x59, 0xb4,
+  0xa5, 0xa7, 0x1f, 0xeb, 0xb9, 0x66, 0x9c, 0x6b, 0xca, 0x6e
+};
+unsigned int encrypted_aes256_10k_gpg_len = 8134;
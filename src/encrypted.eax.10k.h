@@ -0,0 +1,852 @@
+unsigned char encrypted_eax_10k_gpg[] = {
+  0xc3, 0x3e, 0x05, 0x07, 0x01, 0x03, 0x02, 0x67, 0xc6, 0x69, 0x73, 0x51,
+  0xff, 0x4a, 0xec, 0xff, 0xcd, 0xf2, 0x46, 0x54, 0xe8, 0x76, 0x63, 0xc9,
+  0x32, 0x31, 0x5a, 0x05, 0xe9, 0xab, 0xc6, 0x54, 0x4b, 0x3f, 0xbf, 0x67,
+  0x58, 0x01, 0xa4, 0x71, 0x4c, 0x3d, 0x5d, 0xa3, 0x77, 0xc1, 0x72, 0x38,
+  0x6c, 0xc3, 0x71, 0xa4, 0x48, 0xff, 0x46, 0x45, 0x43, 0x8d, 0x55, 0x0e,
+  0x71, 0xa7, 0xa3, 0xb3, 0xd4, 0xff, 0x00, 0x00, 0x27, 0x80, 0x01, 0x07,
+  0x01, 0x00, 0xba, 0xfb, 0x7c, 0xf8, 0xe7, 0x5a, 0x33, 0x9a, 0x0d, 0x58,
+  0x25, 0x17, 0x5e, 0xb2, 0x9b, 0x11, 0x55, 0x4b, 0xd5, 0xdf, 0x97, 0x5b,
+  0x28, 0x12, 0x88, 0xe4, 0xf3, 0x4d, 0x1a, 0x92, 0x90, 0x80, 0xd6, 0x51,
+  0xf1, 0x8e, 0xa1, 0x40, 0xa3, 0x14, 0x99, 0x52, 0xb4, 0x4c, 0xd8, 0x1f,
+  0x06, 0xc9, 0x4c, 0x82, 0x6c, 0xee, 0xf1, 0x34, 0x51, 0x1c, 0x84, 0x22,
+  0x49, 0x27, 0x79, 0xb3, 0xc0, 0x0a, 0x2c, 0x9f, 0xcf, 0xf9, 0x25, 0xc8,
+  0x74, 0xbe, 0x89, 0xe1, 0xf3, 0x40, 0xdf, 0xdd, 0x22, 0xe6, 0xac, 0xd5,
+  0x76, 0xbd, 0x1b, 0x37, 0xe9, 0xad, 0x06, 0xb4, 0x10, 0x36, 0xad, 0x8f,
+  0x38, 0x2c, 0x48, 0x29, 0xac, 0xe6, 0x05, 0x8c, 0x2a, 0xec, 0xfc, 0xcd,
+  0x68, 0x27, 0x34, 0x62, 0x92, 0x47, 0x5f, 0x5a, 0x08, 0xfc, 0xae, 0x74,
+  0x81, 0x3e, 0x18, 0xdb, 0x44, 0x26, 0x84, 0x41, 0xa1, 0x87, 0xcf, 0x01,
+  0xfd, 0x5b, 0x2e, 0xad, 0x25, 0xb1, 0x0b, 0x98, 0xa5, 0xa6, 0x65, 0x53,
+  0x70, 0xc8, 0xa8, 0xca, 0x75, 0x87, 0x0c, 0x05, 0x64, 0xb2, 0xb8, 0xf9,
+  0xaa, 0x22, 0xfd, 0xaf, 0xf4, 0x9f, 0xbd, 0x52, 0xe2, 0x44, 0x7d, 0xad,
+  0xfe, 0xc7, 0x12, 0xb0, 0x13, 0xc1, 0x69, 0x41, 0xe6, 0x1d, 0x58, 0x03,
+  0xa6, 0xe8, 0x41, 0x86, 0x8c, 0x46, 0x0c, 0x92, 0x0d, 0x4c, 0x47, 0x35,
+  0x24, 0x8b, 0xce, 0xcf, 0x63, 0xdf, 0x25, 0xf4, 0xc8, 0x87, 0x1d, 0xdb,
+  0xc3, 0x03, 0xe3, 0x72, 0x00, 0xe6, 0x36, 0xf0, 0x00, 0xbc, 0x0d, 0xdd,
+  0x50, 0x2c, 0xb4, 0xd0, 0x2b, 0xdb, 0x08, 0xf3, 0x4f, 0x80, 0x27, 0x00,
+  0x17, 0x20, 0x23, 0x73, 0x9f, 0x78, 0x3e, 0x90, 0x07, 0xbe, 0x9f, 0xac,
+  0x98, 0xa3, 0xdd, 0xfe, 0xfb, 0x8e, 0x98, 0xb8, 0xce, 0x53, 0xb5, 0x43,
+  0x9d, 0x12, 0x4d, 0x15, 0x95, 0xe0, 0xb1, 0x68, 0x4e, 0x61, 0x2e, 0x21,
+  0xf0, 0x1b, 0x82, 0x21, 0x1e, 0xe8, 0x75, 0xc8, 0xdd, 0x8f, 0x87, 0x6a,
+  0x00, 0x79, 0x20, 0xd3, 0x3a, 0xd7, 0xee, 0x66, 0x7b, 0x95, 0x15, 0xdf,
+  0xb5, 0x49, 0x97, 0x39, 0x88, 0x24, 0xbd, 0xfb, 0x58, 0x06, 0x1a, 0x98,
+  0x69, 0xaa, 0x5a, 0xac, 0xcf, 0x90, 0xdb, 0x32, 0xe7, 0x62, 0x73, 0x6d,
+  0xd4, 0x27, 0x8f, 0xaa, 0x89, 0xdc, 0x58, 0x8f, 0x6a, 0x7a, 0xb1, 0x44,
+  0xe7, 0xc0, 0xc7, 0x59, 0xc4, 0x5c, 0x0d, 0xcf, 0x59, 0x16, 0x53, 0xb9,
+  0xbd, 0xdf, 0x53, 0xf1, 0xbd, 0xf1, 0x42, 0xf6, 0x38, 0x0a, 0x87, 0x9a,
+  0xd2, 0xff, 0x8f, 0x62, 0xb9, 0xe3, 0xd2, 0x68, 0x79, 0xf3, 0x1c, 0x60,
+  0xfa, 0xb5, 0x84, 0x2c, 0x13, 0x68, 0x90, 0xba, 0xf3, 0xc6, 0xe4, 0xa9,
+  0x98, 0xd0, 0x2c, 0xeb, 0x38, 0x25, 0xdc, 0x6c, 0x37, 0x9f, 0x0f, 0x0f,
+  0xb0, 0x4c, 0xb2, 0x91, 0xb9, 0xca, 0x6d, 0xea, 0x8f, 0x86, 0xf1, 0x4f,
+  0x6d, 0x5a, 0xd0, 0x7d, 0xb0, 0xeb, 0xc6, 0xc4, 0x5c, 0x85, 0x00, 0xb8,
+  0x22, 0xf5, 0x3b, 0xc9, 0xa5, 0x30, 0xb6, 0x54, 0x4e, 0x34, 0x8c, 0x45,
+  0xee, 0xc8, 0x14, 0x56, 0x88, 0x76, 0x6e, 0x18, 0xe7, 0x65, 0x8f, 0x26,
+  0x69, 0x14, 0x4e, 0xfc, 0x67, 0x75, 0x41, 0x0f, 0x8b, 0x2f, 0x3c, 0xcd,
+  0x56, 0x5b, 0x40, 0x7d, 0x43, 0x25, 0x01, 0x8a, 0x64, 0x22, 0x86, 0xf0,
+  0xfd, 0x73, 0x51, 0x4f, 0xd8, 0xbd, 0x75, 0x82, 0x8a, 0x1b, 0x85, 0x38,
+  0xe7, 0x3d, 0x36, 0x10, 0xa5, 0xa0, 0x06, 0x6b, 0xdc, 0x9e, 0x86, 0x2d,
+  0xdd, 0x00, 0x5e, 0x03, 0xb0, 0x4a, 0x80, 0xac, 0x1d, 0xed, 0x7d, 0xcd,
+  0x3c, 0x21, 0x9f, 0xc4, 0xc2, 0x87, 0x28, 0xb7, 0xe1, 0xd7, 0x0e, 0xfe,
+  0x34, 0x9b, 0xbb, 0x2b, 0xdb, 0xd4, 0x11, 0x68, 0xd7, 0xa8, 0xd2, 0x07,
+  0x9f, 0x4f, 0x21, 0x50, 0x14, 0x89, 0x3c, 0xc8, 0xe8, 0xfd, 0xcb, 0x20,
+  0x4e, 0xc1, 0xb8, 0x27, 0x49, 0x5c, 0x75, 0x54, 0xbe, 0x28, 0x81, 0x9d,
+  0x06, 0x57, 0x4a, 0xc4, 0xd6, 0x76, 0xa2, 0xd5, 0xf6, 0x28, 0x2b, 0x19,
+  0x97, 0x0c, 0x92, 0xb5, 0x10, 0xfc, 0x8d, 0x13, 0x80, 0x07, 0xcf, 0xcc,
+  0xd8, 0xb3, 0xbc, 0x90, 0xbd, 0x1a, 0xda, 0xaf, 0x4a, 0x73, 0x26, 0x69,
+  0xc3, 0xcc, 0x6f, 0x90, 0x60, 0x24, 0x2e, 0x07, 0xb3, 0xa7, 0x9f, 0x2f,
+  0xe5, 0x55, 0x0a, 0x06, 0x16, 0xf2, 0x4c, 0xd4, 0x6a, 0x78, 0x66, 0x1d,
+  0xd9, 0x8d, 0xa0, 0x00, 0xbb, 0xe2, 0x1a, 0xad, 0x39, 0xae, 0x19, 0x6a,
+  0xbb, 0xef, 0x57, 0x3f, 0x2c, 0xb8, 0x85, 0xc4, 0xe8, 0x32, 0xf5, 0x4d,
+  0x7c, 0x71, 0x06, 0x59, 0xa0, 0x7d, 0x7a, 0x65, 0xe8, 0xf7, 0xf2, 0xa9,
+  0x8c, 0xa1, 0xc3, 0xa8, 0x29, 0x8a, 0x08, 0x59, 0xdf, 0x9f, 0xf4, 0x47,
+  0x50, 0x84, 0x89, 0xea, 0x98, 0xbb, 0x85, 0xa7, 0x1a, 0xd3, 0xfc, 0xbc,
+  0x33, 0x95, 0x55, 0x5a, 0x74, 0x59, 0x3a, 0x84, 0x71, 0x83, 0x7e, 0xb5,
+  0x16, 0xd0, 0x9d, 0x60, 0x28, 0xc8, 0x46, 0x1c, 0x24, 0xee, 0xd4, 0x20,
+  0xde, 0xd6, 0xff, 0x44, 0x85, 0xc4, 0x9e, 0xf8, 0xd8, 0xff, 0x98, 0x99,
+  0xdc, 0xf5, 0x61, 0xb3, 0x58, 0x35, 0x5c, 0xd3, 0x4c, 0x98, 0x96, 0xf2,
+  0x5a, 0xb0, 0xd5, 0xac, 0xaa, 0x34, 0xa8, 0x26, 0x8b, 0xc2, 0xb4, 0x0d,
+  0x5e, 0x2c, 0x39, 0x68, 0xfe, 0x74, 0xd1, 0xd1, 0xf2, 0x0d, 0x91, 0x01,
+  0xb9, 0x51, 0x7b, 0xe9, 0x84, 0x22, 0x59, 0x2e, 0xb6, 0x33, 0xd6, 0x0f,
+  0x37, 0x45, 0xbb, 0xcf, 0xe8, 0x2d, 0x48, 0x40, 0x07, 0x9c, 0x6c, 0x99,
+  0xdc, 0xa0, 0x80, 0xf0, 0x9f, 0x38, 0x20, 0xc4, 0xde, 0xc4, 0xbb, 0xfd,
+  0x07, 0xf9, 0x6b, 0xc9, 0x28, 0x8a, 0xfa, 0x39, 0x6a, 0x4a, 0xd1, 0x41,
+  0xdd, 0xcb, 0x11, 0x4f, 0x72, 0x97, 0xda, 0x86, 0x62, 0x66, 0x4e, 0x26,
+  0xe1, 0x4f, 0x91, 0x40, 0xc8, 0xf4, 0x7b, 0x00, 0x3f, 0xa1, 0xa6, 0xfe,
+  0x5c, 0x40, 0x87, 0x20, 0xc8, 0x20, 0x8e, 0x64, 0x5f, 0x97, 0x5c, 0xce,
+  0x00, 0x86, 0xd5, 0xc2, 0xd3, 0xda, 0x77, 0xc6, 0x7f, 0x61, 0x59, 0xe4,
+  0x8c, 0x6f, 0x7f, 0x4f, 0xb5, 0x3d, 0xd2, 0x1b, 0x1c, 0xbb, 0x27, 0xc7,
+  0x01, 0xd0, 0xb3, 0xa8, 0xb4, 0xef, 0x29, 0xb8, 0xa9, 0x86, 0x7d, 0x0e,
+  0x6c, 0x69, 0xda, 0x5d, 0xa5, 0xed, 0x60, 0x2d, 0xfe, 0x85, 0xd0, 0x02,
+  0x4e, 0x00, 0x54, 0xd6, 0x35, 0xbe, 0xf3, 0xa5, 0x7e, 0x87, 0x01, 0x74,
+  0x1c, 0x33, 0x66, 0x37, 0x44, 0x1d, 0xa9, 0x02, 0xab, 0x70, 0xbe, 0x10,
+  0x58, 0xe2, 0x7f, 0xb2, 0x45, 0xed, 0x29, 0xea, 0xa6, 0xd1, 0x13, 0x4e,
+  0xe1, 0x0a, 0x25, 0xa4, 0xe4, 0x22, 0xdf, 0x33, 0xb9, 0xdb, 0x79, 0xec,
+  0x40, 0xa7, 0xa9, 0xcc, 0x20, 0x5d, 0x64, 0x9a, 0x5d, 0x55, 0x7c, 0x7c,
+  0x33, 0xe1, 0xe6, 0x80, 0xcb, 0x33, 0xb5, 0xe7, 0xb6, 0xef, 0xcd, 0x78,
+  0xdd, 0x24, 0x2f, 0x68, 0xf2, 0x75, 0x9e, 0x09, 0xde, 0x4a, 0x43, 0x50,
+  0xc6, 0x49, 0xa0, 0x1a, 0x6f, 0x7e, 0x95, 0xf8, 0xd3, 0xd9, 0xfd, 0xda,
+  0x63, 0x63, 0xa0, 0x98, 0x09, 0x77, 0x23, 0xec, 0x1e, 0xb9, 0x64, 0xd5,
+  0x13, 0xda, 0xe2, 0xc8, 0x4b, 0xfd, 0x68, 0x26, 0xe3, 0xbe, 0xdf, 0x34,
+  0x3e, 0xa6, 0x6e, 0x27, 0xbc, 0x87, 0x8b, 0xad, 0xfe, 0x33, 0xd8, 0x7e,
+  0xc1, 0x1c, 0x25, 0x94, 0xbd, 0x6c, 0xe0, 0xaa, 0x5f, 0x50, 0x7d, 0xa9,
+  0x25, 0xe6, 0x9f, 0x65, 0xfa, 0xfa, 0xe6, 0x19, 0xa7, 0x79, 0x85, 0x2d,
+  0x4e, 0x4f, 0x8b, 0xdc, 0xed, 0x7c, 0x2e, 0xfe, 0x78, 0x29, 0xa3, 0x88,
+  0x0d, 0x09, 0x72, 0x07, 0xbf, 0x22, 0x2b, 0x00, 0x37, 0x2a, 0xbc, 0x2b,
+  0xfd, 0x78, 0x08, 0x0a, 0x3b, 0x1d, 0x6e, 0x1e, 0xc6, 0x9b, 0x6c, 0x19,
+  0x3d, 0x9e, 0x0b, 0x27, 0xc5, 0x12, 0xe3, 0xd4, 0x60, 0xd0, 0xf2, 0x00,
+  0x69, 0xe3, 0x55, 0x99, 0x30, 0xc8, 0x38, 0xc9, 0x36, 0xdd, 0x2f, 0xed,
+  0x01, 0x20, 0x03, 0xf1, 0x94, 0x0d, 0x2c, 0x21, 0xc6, 0x24, 0xab, 0x35,
+  0x85, 0xdd, 0x74, 0x09, 0x22, 0x2e, 0xd9, 0x11, 0x94, 0x5a, 0x33, 0x62,
+  0xbb, 0xc9, 0x56, 0xac, 0x5a, 0x35, 0xc3, 0x57, 0x30, 0x2e, 0x01, 0x9b,
+  0x7a, 0xad, 0xa1, 0x06, 0x78, 0xf7, 0x14, 0x53, 0x6e, 0xa1, 0x66, 0xcc,
+  0x35, 0x43, 0x90, 0xa9, 0xb2, 0x87, 0x18, 0x8a, 0x68, 0x68, 0xd4, 0x90,
+  0xdb, 0x99, 0xb0, 0x2a, 0x03, 0x70, 0x89, 0xf3, 0x7e, 0x09, 0x12, 0x8f,
+  0xb4, 0xa1, 0xb0, 0xa1, 0xcd, 0x4f, 0x7c, 0x3b, 0x70, 0x72, 0x42, 0x89,
+  0x30, 0x27, 0x8f, 0x7c, 0x85, 0xd8, 0xd9, 0xdc, 0x99, 0xd7, 0xce, 0x64,
+  0x4b, 0x9a, 0xd2, 0x45, 0x08, 0xcb, 0xf0, 0x39, 0x94, 0xab, 0x11, 0xe2,
+  0x09, 0x49, 0xec, 0xd9, 0x1c, 0x1f, 0xb7, 0xc5, 0xbf, 0xbe, 0x0a, 0x3d,
+  0xb4, 0xe7, 0x86, 0x3c, 0x93, 0x3d, 0x73, 0x47, 0x61, 0x03, 0xc5, 0x89,
+  0x76, 0xa8, 0xd9, 0xd8, 0xbd, 0x40, 0xce, 0x78, 0x5d, 0x45, 0x45, 0x64,
+  0xe3, 0x3b, 0xa6, 0xcc, 0x6f, 0x43, 0xf0, 0x86, 0xec, 0x90, 0x9a, 0x12,
+  0x60, 0xed, 0x70, 0xa7, 0xad, 0x07, 0x94, 0x5f, 0x11, 0xe8, 0xa4, 0x0c,
+  0xf6, 0xa3, 0x2a, 0x4f, 0x83, 0x81, 0xda, 0xef, 0x5a, 0xd6, 0x27, 0x09,
+  0x99, 0x19, 0x19, 0x76, 0x01, 0x06, 0xc9, 0x82, 0x8e, 0x5f, 0x5e, 0x26,
+  0x99, 0xac, 0x4b, 0x7e, 0x5c, 0xdf, 0x7c, 0x5b, 0xe3, 0x99, 0x3a, 0x49,
+  0xe4, 0xf3, 0xf2, 0xa9, 0x15, 0xec, 0x2f, 0x4b, 0xc5, 0xa4, 0x49, 0x65,
+  0x78, 0x5f, 0x90, 0x70, 0x54, 0x6b, 0xb6, 0xdb, 0x3b, 0x7c, 0xc2, 0xaa,
+  0x92, 0xaf, 0x4d, 0xa1, 0x02, 0x83, 0x55, 0x6f, 0x1f, 0x2a, 0x17, 0xb8,
+  0xf0, 0xc4, 0x2b, 0x32, 0xee, 0x6b, 0xcb, 0x7d, 0xfa, 0x44, 0x28, 0xd4,
+  0xc5, 0x99, 0xa8, 0x3d, 0x32, 0xc9, 0x53, 0x5f, 0x4a, 0x93, 0x60, 0xa7,
+  0xea, 0x45, 0x00, 0xc7, 0xf4, 0x54, 0x86, 0x2f, 0x2c, 0x67, 0x5f, 0x71,
+  0xf7, 0xc3, 0x40, 0x4a, 0x52, 0x83, 0x7f, 0x13, 0x4a, 0xf4, 0xe1, 0xff,
+  0xa7, 0xdd, 0x82, 0xf5, 0xba, 0x65, 0x5e, 0x8c, 0xfe, 0x95, 0xb2, 0x25,
+  0xd0, 0x79, 0xbe, 0x6e, 0xcf, 0xaf, 0x6d, 0x59, 0x6f, 0x98, 0x73, 0x5d,
+  0xfc, 0xfd, 0x89, 0xca, 0x6e, 0x70, 0xfd, 0x99, 0xc0, 0x4d, 0x0a, 0x38,
+  0xf7, 0x70, 0xad, 0x14, 0x71, 0xab, 0x86, 0xb9, 0x34, 0x6b, 0xe7, 0x9f,
+  0x49, 0x03, 0x29, 0xe0, 0x54, 0x76, 0xd1, 0x72, 0x90, 0x2d, 0x1c, 0x4b,
+  0xd2, 0x07, 0x1a, 0x09, 0xe0, 0xf2, 0x0e, 0xa6, 0x36, 0x90, 0xd9, 0x2b,
+  0x7e, 0x5f, 0xa3, 0xdb, 0x8c, 0xc0, 0xf0, 0xf5, 0xde, 0xd2, 0x98, 0xcc,
+  0x49, 0x19, 0x76, 0x0c, 0x3e, 0x53, 0x92, 0x05, 0x58, 0x87, 0xc5, 0x9d,
+  0xc9, 0x93, 0x93, 0xb1, 0x99, 0x2d, 0x50, 0x32, 0xae, 0xe7, 0x27, 0x1c,
+  0xba, 0x66, 0x5e, 0x0e, 0x01, 0x55, 0x3e, 0xf5, 0x73, 0x0a, 0x51, 0x89,
+  0x31, 0xfc, 0x8d, 0xea, 0x0d, 0x78, 0x26, 0xd2, 0xb3, 0xf4, 0xad, 0xc3,
+  0x96, 0x70, 0x3c, 0xb2, 0x14, 0x5b, 0x6e, 0x58, 0x0f, 0xfe, 0xa6, 0x00,
+  0xdc, 0xed, 0xc1, 0x5f, 0x1b, 0x16, 0xc7, 0xc0, 0x60, 0x10, 0x9d, 0x7c,
+  0x40, 0xed, 0x95, 0x50, 0x2d, 0x99, 0xa4, 0x07, 0xaa, 0x0f, 0x7b, 0x99,
+  0xab, 0xe2, 0x12, 0xf3, 0xd0, 0xf2, 0x4c, 0x24, 0xb5, 0x1c, 0x5c, 0x11,
+  0xf9, 0x7c, 0x94, 0x3b, 0x91, 0xec, 0x10, 0x05, 0xd4, 0x9d, 0xe8, 0x20,
+  0x0d, 0x39, 0x9f, 0x47, 0xb5, 0x10, 0x6d, 0x3b, 0xc6, 0xe7, 0x66, 0xaf,
+  0xc5, 0x76, 0xfe, 0x9d, 0x62, 0xf1, 0xf7, 0x9c, 0x0b, 0x1e, 0xa4, 0xbd,
+  0x50, 0xad, 0xf9, 0xb8, 0xb4, 0x67, 0x05, 0xa6, 0x29, 0x90, 0xbf, 0xfd,
+  0xfe, 0xe7, 0xaf, 0xf6, 0x59, 0x31, 0x91, 0x61, 0xb0, 0x09, 0x23, 0xd8,
+  0x34, 0x5b, 0x3d, 0x13, 0xe9, 0xdb, 0x04, 0x31, 0x69, 0x0d, 0x23, 0x65,
+  0xd0, 0x96, 0x9a, 0x38, 0x8d, 0xef, 0x3c, 0x65, 0x8b, 0x6b, 0x9d, 0xe8,
+  0xd5, 0x15, 0x51, 0x9f, 0x19, 0xb6, 0x2e, 0xd5, 0x61, 0xb1, 0x54, 0x35,
+  0xf8, 0x5c, 0xb0, 0xc3, 0x81, 0x16, 0x00, 0x15, 0xd7, 0xae, 0x23, 0x03,
+  0x7e, 0xdc, 0x04, 0x7b, 0x1e, 0xca, 0x71, 0x4d, 0x93, 0x74, 0xcd, 0x12,
+  0x86, 0x4e, 0x4d, 0x1b, 0x78, 0x81, 0xa6, 0x70, 0xec, 0x1d, 0xb8, 0x82,
+  0xb7, 0xe1, 0x6c, 0x44, 0xbc, 0xdc, 0x43, 0xba, 0x2d, 0xaa, 0x01, 0xef,
+  0x59, 0xb9, 0x18, 0xd6, 0x94, 0xd3, 0x11, 0x8f, 0x6f, 0x9d, 0xb2, 0x51,
+  0x45, 0xd2, 0x05, 0xdf, 0x1c, 0xe8, 0x58, 0x2f, 0x77, 0x80, 0x5f, 0xd0,
+  0x47, 0x56, 0x8c, 0xbc, 0xd0, 0xbf, 0x43, 0x89, 0x60, 0xae, 0xe0, 0xc2,
+  0x40, 0xcb, 0x4a, 0x53, 0xfd, 0x6c, 0xd4, 0xc6, 0xd6, 0xec, 0x50, 0x3e,
+  0xf2, 0x76, 0x81, 0x71, 0x41, 0x0a, 0x3b, 0x7a, 0x3d, 0x7d, 0xa0, 0x41,
+  0x70, 0xcb, 0x8e, 0x5d, 0x17, 0x15, 0x9c, 0x21, 0xfa, 0x01, 0xc8, 0xd4,
+  0x56, 0x34, 0x1c, 0x7f, 0x1c, 0xb1, 0xe4, 0xc7, 0x6b, 0xf2, 0xe5, 0x98,
+  0xa5, 0x69, 0x04, 0xc5, 0xe7, 0x8d, 0x2b, 0xdc, 0xe3, 0xd1, 0x1c, 0xb5,
+  0x2c, 0x37, 0x1c, 0xa6, 0xbf, 0x4c, 0xd9, 0xdb, 0xe4, 0x13, 0x18, 0x5a,
+  0x6a, 0xad, 0x34, 0x9c, 0xba, 0x7b, 0xf8, 0x33, 0x7f, 0xea, 0x2b, 0xac,
+  0x09, 0x43, 0x1d, 0x7f, 0x33, 0x4e, 0x73, 0xd2, 0xe5, 0x6e, 0xff, 0x2f,
+  0xab, 0x63, 0x46, 0x7c, 0x69, 0x6b, 0x28, 0x61, 0xd5, 0xd8, 0xa6, 0x0e,
+  0xb3, 0x23, 0xb5, 0x5b, 0x3d, 0x38, 0x71, 0xcd, 0xa9, 0x95, 0x86, 0xfd,
+  0x15, 0x17, 0xb2, 0xb4, 0xfe, 0x0d, 0xfb, 0xbd, 0xe8, 0x70, 0xb8, 0x57,
+  0x15, 0x29, 0xd3, 0x70, 0xa0, 0x71, 0x32, 0xd6, 0xf2, 0xd7, 0x05, 0x0e,
+  0xcc, 0x39, 0x1d, 0xe7, 0xa7, 0x68, 0x0d, 0x8e, 0xb3, 0xec, 0x4a, 0xd3,
+  0x4d, 0x4b, 0xed, 0x26, 0x4e, 0x68, 0xf2, 0x96, 0x86, 0x9a, 0x63, 0xc1,
+  0x70, 0xbc, 0x01, 0xc5, 0x63, 0xdb, 0x46, 0x41, 0x1a, 0x41, 0x71, 0x97,
+  0xa5, 0xbc, 0x46, 0x4f, 0x71, 0x6d, 0xfe, 0xd9, 0x83, 0x10, 0x4e, 0x5c,
+  0x58, 0xa0, 0x79, 0x35, 0xcc, 0xe2, 0x6a, 0x28, 0xf2, 0x78, 0xb2, 0x76,
+  0x8d, 0x18, 0x1f, 0xa2, 0xe2, 0xdb, 0xbb, 0xdc, 0x1f, 0x05, 0x86, 0x03,
+  0x18, 0x7a, 0xbd, 0x5c, 0x81, 0xb6, 0x04, 0x3c, 0x2f, 0x79, 0xc5, 0x2e,
+  0xab, 0xf1, 0xfa, 0xb8, 0xca, 0x52, 0x63, 0x74, 0x24, 0xde, 0x05, 0x75,
+  0x11, 0x34, 0xe6, 0x5f, 0xc7, 0x9e, 0xaa, 0x91, 0x3c, 0x82, 0x43, 0x71,
+  0xf2, 0x44, 0x3d, 0x77, 0xcc, 0xa1, 0x51, 0xe5, 0xfd, 0x22, 0xd0, 0x1a,
+  0x67, 0xb8, 0xca, 0xb0, 0x0a, 0xb4, 0xef, 0xfb, 0x9a, 0xed, 0x63, 0xa4,
+  0x82, 0x55, 0xd2, 0x4a, 0x54, 0x24, 0x8d, 0x7a, 0xb3, 0x3f, 0xff, 0xf7,
+  0x2d, 0x9d, 0x51, 0x0e, 0xc3, 0x05, 0x36, 0xf5, 0x80, 0x41, 0x38, 0xe7,
+  0x7b, 0x81, 0xbf, 0x76, 0x68, 0x50, 0x2d, 0xba, 0x05, 0x7e, 0xca, 0xbf,
+  0x1e, 0x25, 0x97, 0x47, 0x5b, 0x66, 0x01, 0x09, 0x36, 0x64, 0x5d, 0x35,
+  0x99, 0xeb, 0x1b, 0x70, 0x6e, 0xfb, 0x4a, 0xae, 0x11, 0xe1, 0x47, 0x73,
+  0xbf, 0x77, 0xd7, 0x6c, 0xf9, 0x4c, 0x77, 0xc5, 0x6c, 0xf5, 0xb0, 0x25,
+  0xe2, 0xda, 0xb4, 0xcb, 0xe0, 0x90, 0x55, 0x85, 0xb4, 0x5e, 0x5e, 0xa4,
+  0xd9, 0xb3, 0x2c, 0x51, 0xf9, 0xad, 0xed, 0xc8, 0x3c, 0x50, 0x7d, 0x45,
+  0x19, 0xe1, 0x20, 0x91, 0x04, 0x87, 0xd3, 0x76, 0xb1, 0x6c, 0x88, 0x0c,
+  0x36, 0xb3, 0x2d, 0xba, 0x85, 0x64, 0xf4, 0x80, 0x8c, 0x06, 0xfa, 0x6d,
+  0xdd, 0x1e, 0x80, 0xfe, 0x02, 0x68, 0x8b, 0x11, 0xb8, 0x57, 0xb7, 0xc7,
+  0x9e, 0xc0, 0x7e, 0x78, 0xb3, 0x21, 0x04, 0xd0, 0x75, 0x6b, 0xac, 0xd0,
+  0xfa, 0x44, 0xeb, 0xba, 0x08, 0x54, 0xf3, 0x25, 0xf0, 0x9e, 0xec, 0x45,
+  0x13, 0x19, 0x7c, 0x16, 0x81, 0x5f, 0xc6, 0x5d, 0xd8, 0x2c, 0xc5, 0x6e,
+  0xde, 0x1c, 0x0b, 0x5d, 0x9d, 0xe1, 0x53, 0xfb, 0x58, 0xc9, 0x77, 0xe9,
+  0xcb, 0x83, 0xa3, 0x32, 0xa6, 0xda, 0xdb, 0xca, 0x24, 0xea, 0x7b, 0xa6,
+  0x36, 0x21, 0x59, 0xce, 0x00, 0xf2, 0xcb, 0xcc, 0x26, 0x10, 0xc4, 0x7b,
+  0x68, 0x24, 0xda, 0xa0, 0x19, 0x86, 0x3b, 0xe9, 0x07, 0x1f, 0xf9, 0x25,
+  0x8c, 0xca, 0x58, 0x9e, 0x5a, 0xa7, 0xb7, 0xf7, 0xe9, 0x3c, 0x50, 0x1c,
+  0xec, 0x6d, 0x6e, 0xb7, 0xec, 0x50, 0x3b, 0x14, 0xa4, 0xa8, 0x14, 0x1a,
+  0x9b, 0x88, 0xe2, 0x3c, 0x2d, 0x46, 0x10, 0x2d, 0x23, 0x76, 0xa5, 0x88,
+  0xba, 0x12, 0x03, 0x7e, 0xca, 0xbc, 0x52, 0x55, 0xac, 0x5e, 0xd0, 0x71,
+  0x96, 0x6a, 0x11, 0x29, 0x3c, 0x8a, 0xe1, 0x90, 0x1d, 0xa7, 0x39, 0x5b,
+  0x42, 0x28, 0x34, 0x31, 0xb5, 0x3a, 0xaa, 0x00, 0xfd, 0x8a, 0xda, 0x8e,
+  0x2b, 0x75, 0x1d, 0x7e, 0x92, 0xf4, 0x6e, 0x8c, 0x2b, 0x3f, 0x74, 0x2e,
+  0x4b, 0x4f, 0x40, 0xd9, 0xbf, 0x8a, 0x46, 0x53, 0x5a, 0xc0, 0x4b, 0x7c,
+  0x31, 0x02, 0x40, 0x9e, 0x2d, 0xcf, 0x54, 0x64, 0x28, 0x4d, 0xbb, 0xe5,
+  0x9d, 0x57, 0xeb, 0x6c, 0x7a, 0xed, 0x22, 0xbf, 0x1e, 0x62, 0xdc, 0xf8,
+  0x85, 0xa3, 0x85, 0xd4, 0x39, 0xe1, 0x61, 0x0f, 0x07, 0x41, 0x73, 0xdc,
+  0x0f, 0x13, 0xe9, 0x6e, 0x37, 0x8d, 0xb0, 0x74, 0x54, 0xe8, 0xc3, 0xe5,
+  0x8c, 0xef, 0x93, 0xe1, 0xdf, 0xb0, 0xdb, 0xdd, 0xbf, 0xc5, 0x86, 0xd2,
+  0x8a, 0xf2, 0xb9, 0xf9, 0xa0, 0x06, 0x29, 0x5a, 0xad, 0xab, 0x5c, 0xf2,
+  0x3d, 0xb5, 0x9d, 0x45, 0x5a, 0x5f, 0x4c, 0x2a, 0xff, 0xcc, 0x79, 0xde,
+  0x9d, 0x68, 0x86, 0xe2, 0x05, 0x59, 0x7c, 0xce, 0xd6, 0xef, 0x7e, 0xc2,
+  0xf3, 0xa1, 0x55, 0xe9, 0x0b, 0x25, 0xbc, 0x81, 0x14, 0x18, 0xf9, 0xee,
+  0xed, 0xc8, 0xeb, 0xce, 0x25, 0x08, 0xad, 0x3c, 0x9b, 0xbe, 0x50, 0xa8,
+  0x38, 0x48, 0x91, 0x77, 0x70, 0x95, 0xf1, 0x0d, 0xbb, 0x4a, 0x46, 0x62,
+  0x54, 0xc3, 0x42, 0x1c, 0xda, 0x48, 0x9b, 0x53, 0x09, 0xb9, 0xb8, 0x7f,
+  0xa8, 0x4a, 0x33, 0xb6, 0xbc, 0x3f, 0x3a, 0x68, 0x4a, 0xec, 0xaf, 0x3f,
+  0xa0, 0x79, 0x6c, 0x89, 0x76, 0xb2, 0xd4, 0xc4, 0x86, 0xb3, 0xd1, 0x0c,
+  0x28, 0xe2, 0xe8, 0xe4, 0x15, 0x9a, 0x6e, 0x98, 0xa3, 0x3d, 0x4b, 0x39,
+  0xa3, 0x9a, 0x4c, 0x1b, 0x92, 0xc1, 0x0a, 0x2c, 0x35, 0x25, 0x06, 0x45,
+  0x79, 0x56, 0xe2, 0x4f, 0x21, 0x7c, 0xd5, 0xb6, 0xdf, 0x05, 0x5c, 0xf2,
+  0xfa, 0x81, 0xfe, 0x01, 0x8f, 0xbe, 0xeb, 0xec, 0x89, 0x0c, 0x78, 0xce,
+  0x34, 0xce, 0xfb, 0x64, 0x5a, 0x54, 0x06, 0x2d, 0x1f, 0xab, 0x0e, 0xcc,
+  0xf7, 0x6f, 0x15, 0x07, 0x47, 0x56, 0x2d, 0x9d, 0x6e, 0x2c, 0x67, 0x2d,
+  0x7f, 0xd1, 0x54, 0x03, 0x1b, 0xd6, 0x62, 0x71, 0x4b, 0x7b, 0xd2, 0x30,
+  0x28, 0x0a, 0xbf, 0x1f, 0x10, 0xe4, 0xa5, 0x0d, 0x6e, 0x9b, 0x95, 0x08,
+  0xcd, 0xe4, 0x3e, 0xbb, 0x74, 0x08, 0x17, 0xa9, 0x86, 0x5c, 0x2f, 0x3e,
+  0x20, 0x69, 0xa6, 0x52, 0xb3, 0x59, 0xfe, 0x54, 0xdf, 0xf0, 0xd6, 0x74,
+  0xf5, 0xc3, 0x74, 0x3b, 0x9e, 0xd9, 0xa7, 0x97, 0xcf, 0x01, 0x5e, 0xea,
+  0xa3, 0x1e, 0x38, 0x18, 0xdc, 0x18, 0x47, 0xe8, 0xc2, 0xa5, 0xb6, 0x71,
+  0x65, 0x99, 0x83, 0x9e, 0x8e, 0x3a, 0x87, 0xda, 0x45, 0x2b, 0x80, 0xbf,
+  0x3b, 0x38, 0xd3, 0xe6, 0x0f, 0x0b, 0x4a, 0x20, 0xab, 0x83, 0x50, 0x5b,
+  0x3f, 0xab, 0xd3, 0x5c, 0x4b, 0x3d, 0x9b, 0xa9, 0xce, 0x46, 0xe1, 0x47,
+  0x41, 0x7c, 0xa3, 0x97, 0xaf, 0x8d, 0x8c, 0xb5, 0x92, 0xc9, 0xf2, 0x89,
+  0xc4, 0x3d, 0x1d, 0xfa, 0xb5, 0x5e, 0xe6, 0x99, 0x42, 0x5b, 0xb1, 0xcc,
+  0xe6, 0x1f, 0x2f, 0x83, 0xf8, 0xf1, 0x64, 0x5d, 0xd8, 0x35, 0x0d, 0x78,
+  0xc5, 0x8b, 0x84, 0xf4, 0x4f, 0x73, 0x52, 0xd2, 0xf9, 0xc3, 0xe6, 0xad,
+  0xf2, 0x10, 0xb2, 0x4e, 0x40, 0x53, 0xd2, 0x58, 0x52, 0xf0, 0x7e, 0x5e,
+  0x18, 0x02, 0x28, 0x2c, 0x1d, 0x4e, 0x52, 0xd4, 0x1f, 0x87, 0xde, 0x3a,
+  0xb2, 0x8d, 0x88, 0x91, 0xa7, 0xff, 0xc9, 0xda, 0x76, 0x40, 0xc8, 0xff,
+  0x33, 0x38, 0x00, 0x23, 0x82, 0x5c, 0xe8, 0x21, 0x31, 0xee, 0xfc, 0x32,
+  0x1c, 0xf4, 0xa3, 0x47, 0xa2, 0xed, 0x22, 0x88, 0x6c, 0xb2, 0xc9, 0x97,
+  0xd3, 0x4c, 0x71, 0x03, 0x5c, 0x6b, 0xe8, 0x8d, 0x33, 0x85, 0x5c, 0x85,
+  0xca, 0x08, 0xea, 0x51, 0x9a, 0xef, 0x1f, 0x28, 0x3c, 0xac, 0xac, 0x89,
+  0x65, 0x26, 0x09, 0x26, 0x4c, 0x8e, 0x2d, 0xa6, 0x99, 0xe7, 0xcc, 0xde,
+  0x12, 0x0a, 0x02, 0x53, 0x53, 0xdc, 0x16, 0x12, 0x5a, 0x9d, 0x5b, 0x2e,
+  0xab, 0xed, 0xf2, 0xde, 0x82, 0x66, 0x73, 0x3f, 0x25, 0xb9, 0x4d, 0x81,
+  0xba, 0xdc, 0x0e, 0x19, 0xd2, 0x66, 0x1d, 0x21, 0x36, 0xbe, 0x61, 0xd4,
+  0xbd, 0xa2, 0xcb, 0xfe, 0x0f, 0x04, 0x63, 0x2c, 0x52, 0x4a, 0xd2, 0x0a,
+  0x7b, 0xe0, 0x23, 0xe5, 0xdc, 0x66, 0x62, 0x90, 0x4b, 0x04, 0x6e, 0xd8,
+  0x84, 0xcd, 0xef, 0x49, 0x4f, 0xce, 0xe6, 0x6b, 0x7c, 0x34, 0xc5, 0x42,
+  0x1c, 0x4e, 0xc7, 0xe6, 0xc7, 0x2e, 0x64, 0xc8, 0x21, 0xcc, 0x27, 0xc9,
+  0xcd, 0x47, 0x4a, 0x93, 0x6b, 0x8e, 0xe2, 0xc1, 0xd6, 0x9e, 0x28, 0x4e,
+  0x8c, 0xca, 0xe3, 0xe7, 0x85, 0x5b, 0x02, 0xa8, 0xa2, 0xe7, 0x59, 0x04,
+  0x52, 0xef, 0xd4, 0x6a, 0x0a, 0x78, 0x64, 0xbc, 0x48, 0x07, 0x1b, 0xb3,
+  0x80, 0x24, 0xbb, 0xd1, 0xc7, 0x01, 0xe6, 0x07, 0x96, 0xab, 0x76, 0xeb,
+  0x91, 0xfd, 0xea, 0xb1, 0x5a, 0x31, 0x8a, 0x50, 0xa6, 0xc5, 0xc6, 0xb9,
+  0x1b, 0x9a, 0xf9, 0xac, 0xf3, 0xe3, 0x11, 0xc8, 0xc4, 0x9f, 0x98, 0x9a,
+  0xf2, 0x78, 0x8b, 0xd7, 0xd8, 0x5d, 0x27, 0xa4, 0x70, 0xe2, 0x52, 0x06,
+  0x54, 0x8e, 0x64, 0x29, 0x7b, 0xdd, 0x4e, 0x58, 0xdd, 0xc6, 0xb6, 0xb9,
+  0x78, 0xa4, 0x8a, 0xa5, 0x24, 0x8d, 0xcb, 0x5e, 0x1f, 0x79, 0xed, 0x47,
+  0x4a, 0xa7, 0xa5, 0x95, 0xd1, 0x2f, 0x87, 0xd8, 0xaa, 0xc3, 0x0c, 0x8f,
+  0x48, 0x3a, 0x17, 0x90, 0xfb, 0xeb, 0x33, 0xf6, 0x2f, 0x4e, 0xcf, 0xcb,
+  0xec, 0xec, 0x56, 0xed, 0x1d, 0x64, 0x87, 0xf5, 0x4e, 0xaf, 0x62, 0xda,
+  0xcb, 0x2b, 0xc1, 0xd0, 0x88, 0x9a, 0x86, 0x73, 0xe8, 0x61, 0x16, 0x03,
+  0xb4, 0x07, 0xbb, 0x49, 0x32, 0xdb, 0xfe, 0x9c, 0x5b, 0xab, 0x8a, 0xdc,
+  0x9a, 0xa5, 0x8f, 0x88, 0xc5, 0xe6, 0xa8, 0xac, 0x00, 0xaa, 0x26, 0x63,
+  0xd5, 0x4f, 0x15, 0x23, 0x55, 0xab, 0xf2, 0x4d, 0x9c, 0x90, 0x18, 0x73,
+  0x71, 0xf7, 0xa9, 0x79, 0x25, 0x73, 0xfb, 0xf7, 0xa8, 0xbb, 0x28, 0xa9,
+  0xc6, 0x96, 0x26, 0x18, 0x04, 0x6b, 0xe1, 0x5c, 0x78, 0x4f, 0x50, 0x9a,
+  0x4f, 0xa0, 0xf2, 0x7c, 0xf4, 0x65, 0x5d, 0x11, 0x33, 0x55, 0x5b, 0xef,
+  0x37, 0x27, 0xb7, 0xcf, 0xf1, 0xbd, 0xf1, 0xa9, 0x4c, 0xb5, 0xf4, 0x39,
+  0x7d, 0xbb, 0x95, 0xfb, 0xb0, 0x45, 0xb0, 0x94, 0xbf, 0x9f, 0x06, 0xea,
+  0xab, 0xb9, 0x42, 0x2f, 0x24, 0x52, 0x4f, 0x2f, 0x99, 0x8f, 0xcb, 0x9c,
+  0xd2, 0xe0, 0x8e, 0xa2, 0x9d, 0x6f, 0x14, 0xec, 0xf1, 0xbf, 0x0a, 0x16,
+  0x98, 0x2a, 0xdb, 0xad, 0xd8, 0x83, 0x61, 0x4f, 0x95, 0x52, 0xa9, 0xbc,
+  0x65, 0xa7, 0x36, 0xcd, 0x51, 0x9d, 0xce, 0x4c, 0x97, 0x5a, 0x5f, 0xd7,
+  0x89, 0x17, 0x7f, 0x32, 0x32, 0xb3, 0x72, 0xe2, 0x13, 0x2d, 0x30, 0x9d,
+  0x97, 0x5a, 0x80, 0xda, 0xe6, 0xc7, 0x0d, 0xa8, 0x21, 0xa0, 0x3a, 0x3a,
+  0xdb, 0xec, 0x27, 0xd0, 0xa1, 0xde, 0x52, 0x6a, 0x84, 0xfb, 0x32, 0x52,
+  0x7a, 0x06, 0x1c, 0x51, 0x8c, 0x14, 0x08, 0x50, 0x08, 0x85, 0x4a, 0x9e,
+  0xab, 0xe4, 0x6b, 0x05, 0xcc, 0x78, 0x4e, 0xfd, 0x67, 0xb0, 0x2d, 0x67,
+  0x64, 0x8d, 0x29, 0x1a, 0xcf, 0xd6, 0xad, 0x53, 0xf8, 0xe2, 0x8c, 0x24,
+  0x45, 0x1d, 0xae, 0x6a, 0xa7, 0xc5, 0x41, 0x78, 0xd8, 0xe5, 0xbd, 0x96,
+  0x05, 0x6d, 0x24, 0x01, 0xb9, 0x24, 0xf4, 0x33, 0x8b, 0x23, 0x14, 0xbf,
+  0x5f, 0x4c, 0x56, 0x34, 0x37, 0x0a, 0xf5, 0x68, 0xbe, 0xe6, 0x74, 0x9f,
+  0xc6, 0xe7, 0x34, 0xe4, 0x0b, 0xd2, 0x54, 0x8b, 0x7b, 0x41, 0xff, 0x16,
+  0xf9, 0xbb, 0x41, 0x88, 0xf2, 0xea, 0x1a, 0x04, 0x65, 0xc1, 0xb1, 0xd1,
+  0xef, 0x08, 0x6c, 0x49, 0x10, 0x75, 0x65, 0x66, 0x37, 0x24, 0x5b, 0xf2,
+  0xfb, 0xd3, 0x67, 0x4d, 0xcd, 0xa4, 0xd2, 0xb2, 0x13, 0x65, 0xb0, 0xdd,
+  0x42, 0xd5, 0x0c, 0xc3, 0xa0, 0x38, 0xd4, 0xfc, 0x79, 0xae, 0xc1, 0x38,
+  0x5b, 0x23, 0x53, 0x8b, 0xac, 0x4d, 0xce, 0xff, 0x61, 0xd1, 0xd3, 0xa2,
+  0xd9, 0xb5, 0xc6, 0xf7, 0x1c, 0x50, 0x18, 0x10, 0x2d, 0x51, 0x17, 0xfc,
+  0x17, 0x9c, 0xbb, 0x0f, 0x75, 0xa5, 0x7f, 0x67, 0x3d, 0x10, 0x51, 0x47,
+  0xe3, 0xd2, 0x8a, 0xc4, 0x9d, 0x41, 0x22, 0x1d, 0xab, 0xdd, 0xb7, 0x1c,
+  0xfd, 0x4d, 0xdb, 0xc3, 0xf4, 0xd0, 0x99, 0xf0, 0x15, 0xd2, 0x8a, 0x19,
+  0x55, 0x30, 0x8f, 0x74, 0x56, 0xc0, 0x98, 0x2a, 0xde, 0x24, 0x98, 0xff,
+  0x43, 0x82, 0xda, 0x33, 0xb4, 0xc5, 0x3d, 0xd8, 0x6c, 0xb5, 0x7b, 0xbd,
+  0xc8, 0xcd, 0x56, 0x68, 0xb7, 0xc7, 0xee, 0x18, 0x86, 0x37, 0xa1, 0x6f,
+  0x0d, 0x96, 0xfa, 0xbd, 0xb6, 0xf4, 0x42, 0xc6, 0x30, 0xcf, 0x6f, 0x03,
+  0xad, 0xb2, 0x02, 0xbb, 0x87, 0x69, 0x97, 0x93, 0x27, 0x3c, 0x48, 0xcd,
+  0x75, 0xf3, 0x27, 0x9f, 0x0f, 0x02, 0xf0, 0x76, 0xf3, 0x14, 0x74, 0x92,
+  0xd7, 0xd0, 0x3f, 0x23, 0x79, 0x0a, 0xb1, 0x62, 0x38, 0x18, 0x99, 0xe5,
+  0xfc, 0x8b, 0xc6, 0x62, 0x33, 0x39, 0x23, 0xe1, 0xc3, 0x45, 0x47, 0x2b,
+  0x9b, 0xa4, 0xcc, 0x91, 0xce, 0x50, 0xb3, 0x10, 0xed, 0x38, 0xcb, 0xb6,
+  0x26, 0xc2, 0xf4, 0xdc, 0xa4, 0x29, 0x85, 0x8b, 0x85, 0x71, 0xc9, 0x7a,
+  0xf1, 0x26, 0xf1, 0xaf, 0xca, 0xed, 0xd2, 0x8d, 0xb5, 0x2c, 0x1d, 0xf2,
+  0x08, 0x68, 0xc2, 0xf5, 0x0b, 0xbd, 0x76, 0x38, 0x94, 0x82, 0x83, 0xbb,
+  0x82, 0x44, 0x23, 0x8e, 0x9b, 0x55, 0x57, 0x1f, 0x02, 0xe3, 0xbe, 0x3d,
+  0x83, 0xd9, 0x2b, 0xf4, 0x14, 0x8b, 0x6b, 0xe2, 0x00, 0x47, 0xe4, 0x1f,
+  0xbd, 0x8b, 0x75, 0x8b, 0x74, 0x03, 0x7b, 0xb7, 0x61, 0xe5, 0xdd, 0x46,
+  0x98, 0xbe, 0x44, 0x2c, 0x5f, 0x03, 0x77, 0x31, 0x09, 0x2c, 0xa1, 0xb0,
+  0xb7, 0xeb, 0x84, 0x57, 0x99, 0x61, 0xa2, 0x51, 0xc6, 0x80, 0xfe, 0x88,
+  0x52, 0x0c, 0xb7, 0xf2, 0x54, 0x7b, 0x03, 0xdc, 0x3e, 0xb8, 0xfa, 0x93,
+  0x8b, 0xdd, 0x1c, 0x8a, 0x60, 0x32, 0x53, 0x0b, 0x88, 0xf9, 0x65, 0x5c,
+  0x0d, 0xce, 0x7e, 0xc7, 0x8b, 0xbb, 0x74, 0x89, 0x23, 0xd7, 0xbe, 0x20,
+  0x72, 0xb1, 0xce, 0x29, 0x16, 0xe9, 0xf9, 0xd6, 0x78, 0xb4, 0xae, 0xdb,
+  0x62, 0xd7, 0x17, 0xfe, 0xcf, 0x09, 0x40, 0x89, 0x42, 0x1b, 0xfe, 0x28,
+  0xc8, 0x04, 0x65, 0x27, 0x9e, 0x9f, 0x4d, 0xc6, 0xaa, 0x33, 0x6f, 0x9a,
+  0x69, 0x82, 0x0e, 0xa7, 0xd5, 0x04, 0x9f, 0xde, 0xd2, 0x58, 0x90, 0xd6,
+  0x1e, 0xb6, 0xb2, 0x0e, 0xc0, 0x56, 0x81, 0x6b, 0x10, 0xb8, 0x6b, 0x49,
+  0x1d, 0x1c, 0x3b, 0x25, 0x10, 0x74, 0x72, 0x7b, 0x1d, 0x24, 0x31, 0xbb,
+  0xba, 0xd4, 0xfa, 0x47, 0x58, 0x30, 0xfc, 0xca, 0x98, 0xc0, 0x06, 0xe6,
+  0x5f, 0x9c, 0x17, 0xe2, 0x6e, 0x7d, 0xcb, 0xff, 0x5d, 0x80, 0x84, 0x47,
+  0x60, 0xe9, 0x10, 0x16, 0xb2, 0xa1, 0xeb, 0xcf, 0x91, 0x14, 0xaf, 0x77,
+  0x6b, 0xb4, 0x53, 0x5f, 0xc5, 0x8a, 0xae, 0x62, 0x42, 0xe0, 0x39, 0xec,
+  0xa5, 0xd0, 0x7b, 0xe9, 0x65, 0x4d, 0x87, 0xcc, 0xe3, 0x82, 0x4b, 0x2e,
+  0x90, 0xec, 0x24, 0xd5, 0x28, 0xfc, 0x48, 0x2c, 0x1b, 0xd5, 0x87, 0x1a,
+  0x09, 0x0b, 0xbe, 0xf9, 0x7f, 0x66, 0xab, 0xb4, 0x3d, 0x05, 0x8e, 0x16,
+  0x3b, 0xe0, 0xe2, 0x6b, 0x78, 0xd4, 0x4f, 0x25, 0x5a, 0xec, 0xa7, 0xc7,
+  0x06, 0xd0, 0xb8, 0x3a, 0xa0, 0xa4, 0x51, 0x72, 0xf0, 0x3b, 0x4c, 0x1b,
+  0xd1, 0x53, 0x5b, 0xc2, 0xea, 0x63, 0x1d, 0xca, 0x53, 0xa8, 0x74, 0x8a,
+  0x7e, 0x7e, 0x70, 0xcf, 0xc8, 0xeb, 0xde, 0xb7, 0x5f, 0x52, 0x85, 0xa6,
+  0x93, 0x58, 0xa4, 0xd8, 0x69, 0x55, 0x94, 0xdb, 0xc1, 0x21, 0x5b, 0x69,
+  0x29, 0x3e, 0xf1, 0x97, 0x3c, 0x0b, 0x85, 0x6f, 0x9d, 0x88, 0xfc, 0x76,
+  0x25, 0x58, 0x24, 0x78, 0x79, 0xc9, 0x98, 0xe0, 0x57, 0x91, 0xce, 0x7e,
+  0x4d, 0x5b, 0x0b, 0x77, 0x22, 0xee, 0xfc, 0x51, 0x3b, 0x13, 0x3c, 0xa9,
+  0xd9, 0x38, 0x76, 0x4d, 0x93, 0xc4, 0x43, 0x99, 0x08, 0x5e, 0x4f, 0xcb,
+  0x02, 0xa7, 0x68, 0xa8, 0xab, 0xde, 0x29, 0x5d, 0xe9, 0x5f, 0xac, 0x30,
+  0x7e, 0x61, 0x6d, 0x4d, 0x0d, 0x84, 0x0d, 0x39, 0xef, 0xe3, 0x4a, 0x62,
+  0xa8, 0x34, 0x61, 0xc0, 0x88, 0xc1, 0xb7, 0x20, 0xff, 0xc4, 0xa8, 0x2e,
+  0xec, 0x69, 0xac, 0x05, 0x3c, 0xf0, 0x03, 0xc3, 0x12, 0x0f, 0xb3, 0x33,
+  0xd2, 0x01, 0x2d, 0x74, 0x29, 0xc8, 0x53, 0x1c, 0x80, 0x3b, 0xad, 0xa0,
+  0x52, 0x36, 0xc4, 0xd9, 0xc2, 0xc3, 0x32, 0x7e, 0xae, 0x1a, 0x37, 0xbf,
+  0xa0, 0x8b, 0x68, 0x21, 0xf3, 0x24, 0xb7, 0xec, 0x59, 0x76, 0xf0, 0xbf,
+  0xd7, 0xb8, 0x07, 0xa9, 0xb6, 0x0a, 0x37, 0x11, 0x65, 0xd3, 0xdd, 0xd8,
+  0x20, 0xa1, 0x36, 0x27, 0x99, 0x8d, 0xe0, 0xff, 0xa1, 0x1c, 0xb9, 0xdf,
+  0xfb, 0x87, 0xfe, 0xc7, 0x88, 0x35, 0x6f, 0xae, 0x29, 0x94, 0xf7, 0x57,
+  0x33, 0xb4, 0xfc, 0x1c, 0x2e, 0x7c, 0x13, 0xb1, 0x39, 0x6d, 0xd0, 0xc2,
+  0xf2, 0x9a, 0x48, 0x22, 0xb2, 0x81, 0x98, 0x18, 0xcc, 0x1d, 0xdd, 0x6c,
+  0xcc, 0x29, 0x24, 0xdb, 0x7a, 0xb6, 0x72, 0xed, 0x3d, 0x9f, 0x88, 0x4c,
+  0xb8, 0x3d, 0xc9, 0xe6, 0xb1, 0x1f, 0x4c, 0x0d, 0xa4, 0x10, 0x78, 0xa6,
+  0x70, 0x98, 0xce, 0xbc, 0xa0, 0x2c, 0x6d, 0x9b, 0x50, 0x54, 0x0f, 0x1b,
+  0xf4, 0x80, 0x5d, 0x52, 0x54, 0x06, 0x4c, 0xa6, 0x64, 0x4a, 0x40, 0x6d,
+  0x5e, 0x24, 0x25, 0x9a, 0x41, 0x4f, 0x86, 0x72, 0xc3, 0xc5, 0x04, 0x5d,
+  0x9e, 0x85, 0x1b, 0x86, 0xe0, 0x37, 0xd9, 0x03, 0x50, 0x4d, 0x97, 0xbf,
+  0xa8, 0x53, 0x9a, 0xb3, 0x02, 0x76, 0x32, 0xa5, 0x2e, 0x0c, 0xf8, 0x07,
+  0x0d, 0x10, 0x50, 0xe4, 0x4b, 0xaa, 0xa7, 0xf4, 0x67, 0x4c, 0x1c, 0x97,
+  0x28, 0xef, 0xe9, 0x91, 0x73, 0x0d, 0x97, 0xa8, 0xc0, 0xbe, 0x11, 0xf1,
+  0x9b, 0x3a, 0x4a, 0x38, 0xf4, 0xa3, 0x26, 0xd1, 0x05, 0x6b, 0x4f, 0xed,
+  0xe6, 0x2c, 0x6f, 0x84, 0x0d, 0x48, 0x18, 0x2e, 0x4a, 0x92, 0x59, 0xfe,
+  0xdb, 0x7d, 0x22, 0x11, 0xb1, 0x33, 0xd4, 0x80, 0x98, 0xe7, 0x61, 0x73,
+  0x39, 0xec, 0x4e, 0x03, 0x36, 0x2d, 0xde, 0xdd, 0xfc, 0xa5, 0x04, 0xb1,
+  0xdd, 0xf4, 0x70, 0x17, 0x8d, 0x9a, 0xf8, 0x35, 0xd2, 0x56, 0x61, 0xb5,
+  0xda, 0xc6, 0xb4, 0x52, 0x51, 0xcd, 0x45, 0x0d, 0x3d, 0x8e, 0x94, 0x72,
+  0xb2, 0x26, 0xfb, 0xd0, 0x9b, 0x50, 0x07, 0x3d, 0xea, 0x23, 0x08, 0x21,
+  0x3e, 0x64, 0xac, 0x88, 0x26, 0xf8, 0x68, 0x98, 0x40, 0xdd, 0xe7, 0x37,
+  0xc5, 0xeb, 0x49, 0x1f, 0x38, 0x10, 0xaf, 0xa6, 0xdd, 0x9d, 0x3e, 0xa0,
+  0x9d, 0xb7, 0xf0, 0xba, 0x2a, 0x76, 0xcb, 0xcf, 0x13, 0x9b, 0x7e, 0xcf,
+  0xf6, 0xca, 0xf6, 0xed, 0x5a, 0x36, 0xec, 0xfe, 0x82, 0xee, 0x1b, 0xc5,
+  0x98, 0x91, 0x4c, 0x20, 0xeb, 0x12, 0x9c, 0xec, 0x50, 0x5f, 0x8c, 0x9a,
+  0x6b, 0xd1, 0x9a, 0xd9, 0xa8, 0x23, 0xf0, 0x91, 0x06, 0xdb, 0x32, 0xd1,
+  0x97, 0x25, 0xc8, 0xb1, 0x99, 0x8f, 0xbf, 0x17, 0xce, 0x83, 0x48, 0x62,
+  0xdc, 0x35, 0xf5, 0xbb, 0xef, 0x33, 0xce, 0xb2, 0x3b, 0x95, 0x04, 0x09,
+  0xf6, 0xc8, 0x92, 0x74, 0x4c, 0xb1, 0x64, 0x98, 0xe6, 0xe5, 0x61, 0xa8,
+  0x5f, 0xb9, 0xcd, 0xa7, 0xc3, 0x13, 0x9e, 0x3b, 0xa3, 0x0b, 0x65, 0xfc,
+  0x25, 0xe0, 0x18, 0xe7, 0xce, 0x49, 0xbc, 0x60, 0xb1, 0xb9, 0xbf, 0xae,
+  0x38, 0xd2, 0xc1, 0xc3, 0x34, 0x87, 0xd1, 0x32, 0xdb, 0x45, 0x94, 0xcc,
+  0xeb, 0xa3, 0x9a, 0x48, 0x8f, 0x80, 0xcf, 0x75, 0x36, 0x1a, 0xd4, 0xcf,
+  0x70, 0x15, 0x53, 0x92, 0x16, 0x04, 0xa1, 0x03, 0xe1, 0xd2, 0xbd, 0x5f,
+  0x42, 0x33, 0x45, 0x3d, 0x67, 0x66, 0xc3, 0xfc, 0x5c, 0xca, 0x69, 0xa6,
+  0x32, 0xeb, 0xb9, 0xbc, 0x58, 0xb8, 0x83, 0x99, 0xda, 0x3c, 0x39, 0x40,
+  0x68, 0x2f, 0xa3, 0xab, 0x9f, 0x2c, 0xc6, 0xaa, 0x5b, 0xf7, 0xaa, 0xbb,
+  0x2d, 0xf4, 0x04, 0x4f, 0x6a, 0xb2, 0x1e, 0xf7, 0xcf, 0x46, 0xc0, 0x03,
+  0x34, 0xc4, 0xb4, 0x23, 0x85, 0x73, 0x4a, 0xfc, 0xc3, 0xde, 0x9d, 0xd7,
+  0x2d, 0x9f, 0x1f, 0xf8, 0x21, 0x2f, 0x81, 0xf7, 0xed, 0x16, 0xc6, 0xe0,
+  0xdb, 0xff, 0x5b, 0x4b, 0x9b, 0x3e, 0x24, 0xca, 0xae, 0x4f, 0xe7, 0x58,
+  0x09, 0xbb, 0x12, 0x43, 0x0b, 0xe4, 0x7f, 0xfc, 0x58, 0x55, 0xd1, 0x07,
+  0x8e, 0xf5, 0xa0, 0x73, 0xd9, 0xbf, 0x5d, 0x87, 0xae, 0xa8, 0xa9, 0xab,
+  0x0c, 0x3e, 0xca, 0xd2, 0x8f, 0x7f, 0x90, 0xbf, 0xe4, 0xed, 0x99, 0x23,
+  0xbc, 0xe6, 0xd9, 0xf8, 0x70, 0x8b, 0x3c, 0x8c, 0x9c, 0x67, 0xba, 0x1f,
+  0xc8, 0x4e, 0xec, 0x7c, 0x33, 0xb3, 0x99, 0xc7, 0x13, 0x94, 0xaf, 0x28,
+  0xdf, 0x6f, 0x5c, 0xf8, 0x15, 0x2a, 0x58, 0xd2, 0x33, 0x2d, 0x93, 0x14,
+  0x8a, 0x99, 0x0c, 0x87, 0x95, 0xd4, 0x20, 0x7b, 0x00, 0xff, 0x0f, 0xd9,
+  0x6e, 0x23, 0xb4, 0x7d, 0x5e, 0xf5, 0x26, 0xe9, 0xbc, 0xa0, 0xb8, 0xd7,
+  0xf7, 0x1a, 0x51, 0x1c, 0x0e, 0x76, 0x17, 0xe6, 0x0b, 0x1b, 0xf0, 0x45,
+  0x08, 0x47, 0x81, 0xa7, 0x8e, 0xf4, 0x53, 0xfc, 0x7d, 0x44, 0x65, 0xb0,
+  0xb5, 0xf3, 0x6b, 0x1f, 0xbe, 0xb0, 0xa9, 0xd6, 0x4c, 0x3b, 0x1b, 0x4a,
+  0x69, 0xdc, 0x97, 0x16, 0x8e, 0x17, 0x67, 0x74, 0x93, 0x4a, 0xfb, 0x03,
+  0xec, 0xb2, 0x8c, 0x20, 0x89, 0x66, 0x8d, 0x85, 0xdc, 0xa3, 0x8f, 0x2a,
+  0xe6, 0xde, 0xec, 0xd1, 0xbf, 0xf0, 0x69, 0xdf, 0xc9, 0xf5, 0xe2, 0xee,
+  0x98, 0xd9, 0xd2, 0xbb, 0x8a, 0xee, 0x76, 0xb1, 0x34, 0xbd, 0xcf, 0x0a,
+  0x77, 0x43, 0x58, 0x25, 0xca, 0xc6, 0xdd, 0x34, 0x7a, 0xeb, 0xe5, 0x3f,
+  0x34, 0x0e, 0xb7, 0x4b, 0x68, 0x8a, 0xa3, 0x6b, 0xdc, 0x05, 0xcf, 0xf8,
+  0xe1, 0xfa, 0xbf, 0x1a, 0xb8, 0xee, 0xcf, 0x93, 0xbc, 0x93, 0x94, 0xe4,
+  0xa2, 0x76, 0xc4, 0x8d, 0xf9, 0x65, 0x24, 0xca, 0x2a, 0xb2, 0xff, 0x1a,
+  0xab, 0xfd, 0x8d, 0xb4, 0x94, 0x4a, 0x20, 0x9b, 0x2a, 0xdd, 0x1b, 0xeb,
+  0x57, 0x27, 0x56, 0xa4, 0x4b, 0xf4, 0x18, 0x3e, 0xcf, 0x96, 0x7a, 0xf1,
+  0x60, 0xc1, 0xaf, 0xf7, 0xb4, 0xab, 0x1b, 0xb8, 0xe0, 0x42, 0xc3, 0xa0,
+  0x04, 0x48, 0xf6, 0x43, 0x0b, 0xa8, 0xf3, 0x87, 0xdf, 0x3f, 0x77, 0xd8,
+  0x01, 0x0f, 0xc2, 0xce, 0x6a, 0x04, 0xfd, 0x4e, 0x51, 0xf9, 0x45, 0x52,
+  0x75, 0x7e, 0x45, 0x13, 0x7b, 0x72, 0xe0, 0x2d, 0x79, 0xd9, 0x45, 0x78,
+  0xfd, 0x4c, 0x99, 0xd6, 0x3f, 0xce, 0x1f, 0xb6, 0xdc, 0xec, 0xd4, 0x72,
+  0x1f, 0xee, 0x05, 0xde, 0x6f, 0x1b, 0xb0, 0xc3, 0x5a, 0x88, 0x48, 0xdb,
+  0xcc, 0x87, 0xdf, 0x91, 0xe3, 0x2a, 0x96, 0xe0, 0x3b, 0x64, 0x7c, 0xa1,
+  0xf1, 0x75, 0xb9, 0xa3, 0x73, 0xfb, 0x56, 0x28, 0x73, 0x59, 0x97, 0xd7,
+  0xb6, 0x9c, 0xb5, 0x21, 0x56, 0xd3, 0x72, 0x76, 0xff, 0x14, 0xe5, 0x40,
+  0xcb, 0x40, 0x64, 0x16, 0x78, 0x77, 0x85, 0x47, 0x14, 0xdd, 0x81, 0xbd,
+  0x34, 0x67, 0x5c, 0xf4, 0x80, 0xbe, 0x27, 0xe1, 0x74, 0x8c, 0x2f, 0x26,
+  0x5c, 0x8e, 0xe8, 0x31, 0xee, 0x5f, 0xe1, 0xbb, 0xdf, 0xf9, 0x3a, 0xce,
+  0xf5, 0x96, 0x5c, 0xe8, 0x30, 0xf1, 0xd7, 0x82, 0xff, 0x99, 0x24, 0xc4,
+  0xfa, 0x7c, 0x18, 0x95, 0xe0, 0x1e, 0xb4, 0x09, 0x31, 0xe0, 0xe5, 0x65,
+  0xe2, 0x49, 0x6b, 0x76, 0x2b, 0x8c, 0x1f, 0x61, 0x92, 0x18, 0xe0, 0xc2,
+  0x90, 0xf7, 0xe4, 0x2f, 0x01, 0xff, 0x48, 0xc9, 0xf6, 0xbd, 0xda, 0xdc,
+  0x88, 0xf7, 0x83, 0x7a, 0x54, 0x75, 0x28, 0xb4, 0x85, 0x98, 0x8b, 0x94,
+  0xee, 0x9d, 0x91, 0x6e, 0x78, 0xec, 0xe5, 0x25, 0x22, 0x10, 0xf6, 0x7e,
+  0x24, 0x5b, 0x29, 0x18, 0x75, 0xce, 0x73, 0x35, 0x98, 0x17, 0x77, 0x5c,
+  0x9b, 0x94, 0xec, 0x6d, 0xfd, 0x2c, 0xec, 0xfc, 0x75, 0xff, 0x17, 0xc4,
+  0xd7, 0xdd, 0x5d, 0xeb, 0x5b, 0x71, 0x42, 0x39, 0x44, 0xa3, 0xaa, 0xc2,
+  0x81, 0x22, 0x3d, 0xed, 0x94, 0x6a, 0x15, 0x14, 0x9e, 0xec, 0x3c, 0x3e,
+  0x3b, 0x3d, 0x7d, 0x76, 0x23, 0x02, 0x06, 0x1a, 0x00, 0x3a, 0xf2, 0x30,
+  0xe1, 0x2d, 0x4a, 0xd4, 0x65, 0x52, 0xfa, 0x2b, 0x3f, 0xd0, 0x3b, 0x17,
+  0x1b, 0xd9, 0x54, 0xac, 0x34, 0x23, 0xf5, 0x09, 0x34, 0x00, 0x90, 0x03,
+  0xee, 0x3f, 0x82, 0x01, 0xf1, 0xca, 0x18, 0x09, 0xe6, 0x9e, 0x78, 0xbd,
+  0x67, 0xf9, 0x56, 0xbc, 0x70, 0xbd, 0xa8, 0xec, 0x24, 0xff, 0x17, 0x67,
+  0xa9, 0xb6, 0x9b, 0xed, 0x0b, 0x5b, 0x80, 0x6d, 0x30, 0x68, 0x3c, 0xef,
+  0xae, 0xbf, 0x93, 0x18, 0xee, 0x60, 0xfc, 0xea, 0xe7, 0xd2, 0x84, 0x44,
+  0x5d, 0xc7, 0x32, 0x87, 0x81, 0xd0, 0x12, 0x57, 0x5a, 0xe4, 0x3b, 0xa2,
+  0xec, 0x12, 0x82, 0x80, 0x6b, 0x55, 0xde, 0xb9, 0x6f, 0x71, 0x65, 0x38,
+  0xc0, 0xeb, 0x1b, 0x3d, 0xd9, 0x14, 0xbc, 0x25, 0x7b, 0x54, 0x31, 0x9a,
+  0xbe, 0xcd, 0xa4, 0x53, 0xcf, 0xf7, 0xd1, 0x83, 0xee, 0x11, 0xfb, 0xa0,
+  0x89, 0x21, 0x5d, 0x06, 0x32, 0x84, 0x0a, 0xc8, 0x9c, 0x80, 0xc5, 0x0b,
+  0x78, 0xa2, 0x74, 0x03, 0xcc, 0x87, 0x47, 0xaf, 0x8e, 0x44, 0x74, 0xf0,
+  0x55, 0xe8, 0x88, 0x01, 0x3b, 0xa7, 0x5f, 0x69, 0x1a, 0x3c, 0xa7, 0x93,
+  0x43, 0xf1, 0xee, 0x0b, 0x3c, 0xe6, 0xf2, 0xb0, 0x95, 0xf9, 0xfe, 0x30,
+  0x4e, 0xc0, 0x9d, 0x14, 0x24, 0xff, 0xf6, 0xb3, 0xfa, 0xc0, 0xbc, 0xd7,
+  0x0d, 0x97, 0xcf, 0xa2, 0x90, 0x39, 0xa5, 0x80, 0x8d, 0x54, 0xc4, 0x82,
+  0x8b, 0x1b, 0x4e, 0xfc, 0x63, 0x1c, 0xac, 0x7e, 0x88, 0xf0, 0xde, 0x85,
+  0xd8, 0x4b, 0x80, 0x7e, 0x31, 0xee, 0x0c, 0xf3, 0x07, 0x98, 0xbb, 0x44,
+  0x3d, 0xd3, 0x41, 0xb3, 0xee, 0x0f, 0x1d, 0x74, 0xa6, 0x84, 0x32, 0xc1,
+  0x21, 0x9e, 0xf5, 0xea, 0x91, 0x6f, 0xa5, 0x85, 0x87, 0x45, 0xdf, 0x0f,
+  0x41, 0x0b, 0x9a, 0xcc, 0xc7, 0x71, 0x6d, 0xab, 0x48, 0x97, 0x81, 0xad,
+  0x8a, 0x15, 0xd5, 0x55, 0xac, 0x94, 0x99, 0x5e, 0x10, 0x34, 0x94, 0xdd,
+  0xb6, 0xec, 0x14, 0x00, 0xf9, 0x59, 0xe5, 0x2f, 0x9d, 0xdf, 0xa1, 0xd2,
+  0xa6, 0xd0, 0x6d, 0x6b, 0x3f, 0x56, 0x95, 0xa0, 0x63, 0x18, 0x97, 0xd9,
+  0xcf, 0x48, 0x62, 0x40, 0xb6, 0x85, 0xfa, 0xfa, 0xd4, 0x6c, 0x42, 0xd8,
+  0x03, 0x0d, 0x5e, 0x4b, 0x89, 0xca, 0x8d, 0xcc, 0xa5, 0xe6, 0x3e, 0xb1,
+  0x96, 0xab, 0xaa, 0x4e, 0x68, 0x3e, 0x06, 0x62, 0x4f, 0xe4, 0xfc, 0x0b,
+  0xce, 0x1b, 0x1c, 0x06, 0x53, 0x2c, 0x0b, 0xa8, 0x8b, 0x95, 0x09, 0x40,
+  0x59, 0x3e, 0x2e, 0x09, 0xf6, 0x24, 0x8e, 0xf4, 0x04, 0x45, 0x3f, 0x9a,
+  0xa5, 0x12, 0x62, 0xc8, 0x9a, 0x1d, 0x67, 0xa5, 0xd7, 0xb0, 0xbc, 0x75,
+  0x2d, 0x83, 0x84, 0x9d, 0x7a, 0x2f, 0x40, 0x9c, 0xe2, 0xa9, 0x1d, 0x5f,
+  0x99, 0x49, 0x8a, 0x71, 0xc4, 0x7f, 0x39, 0xbf, 0x02, 0x96, 0x9a, 0x71,
+  0x0c, 0x3c, 0x7a, 0x2c, 0xa2, 0x26, 0xd7, 0x80, 0xb3, 0x07, 0xf1, 0xec,
+  0x70, 0xe4, 0xec, 0x36, 0x22, 0xe1, 0x13, 0x1e, 0x03, 0x63, 0xfb, 0xd0,
+  0x4a, 0x4e, 0xab, 0xe4, 0x44, 0xeb, 0xc4, 0x24, 0x67, 0x3f, 0xe1, 0x9d,
+  0x8a, 0x20, 0xbd, 0xb3, 0x9a, 0x53, 0x25, 0x8c, 0xb2, 0x85, 0x9b, 0xf7,
+  0x55, 0x2a, 0xab, 0xb4, 0xfe, 0x27, 0x34, 0x89, 0x71, 0xa4, 0x3b, 0xb4,
+  0xc1, 0x60, 0xbd, 0x76, 0xb7, 0x2d, 0xff, 0x4d, 0x51, 0x48, 0x08, 0x12,
+  0xaf, 0xa6, 0x34, 0x45, 0x60, 0x23, 0x41, 0x11, 0x12, 0xb9, 0x91, 0x48,
+  0x17, 0xc4, 0x6b, 0xa9, 0x8c, 0x90, 0x64, 0xb7, 0x71, 0x95, 0xff, 0x49,
+  0x23, 0x1f, 0x96, 0x8f, 0x07, 0xc3, 0xe9, 0x3a, 0xaf, 0xf6, 0x3e, 0xa7,
+  0xbd, 0x62, 0x39, 0x34, 0xe1, 0xf5, 0x47, 0x37, 0xfd, 0xef, 0x4a, 0xc3,
+  0xd4, 0x09, 0xeb, 0xb9, 0x5d, 0xdd, 0xa2, 0x23, 0xa4, 0x52, 0x1c, 0xdc,
+  0xed, 0x4f, 0x8a, 0x1f, 0xb8, 0x41, 0xc4, 0x4f, 0x20, 0xe7, 0x67, 0x17,
+  0xb7, 0xe9, 0x74, 0xe8, 0x4f, 0x5f, 0xd7, 0xa2, 0x70, 0x5e, 0xc6, 0x86,
+  0x5b, 0xb2, 0x21, 0x3a, 0x9d, 0x41, 0x06, 0x0d, 0xc8, 0x97, 0x3a, 0x69,
+  0xb8, 0x2d, 0xab, 0x7c, 0x3a, 0x92, 0x0f, 0x04, 0xc4, 0xd8, 0xb8, 0x01,
+  0x72, 0x3c, 0x58, 0x6a, 0x34, 0x15, 0x3e, 0xc5, 0x12, 0xbf, 0x56, 0x72,
+  0x08, 0x1f, 0xee, 0x2d, 0xae, 0x15, 0x4b, 0x1f, 0x37, 0xee, 0xf9, 0x9a,
+  0xad, 0x70, 0x10, 0xb7, 0xe7, 0x15, 0x4c, 0x4e, 0xb7, 0x57, 0xec, 0xb5,
+  0xfc, 0x8a, 0x35, 0xde, 0xb9, 0xff, 0xd5, 0x16, 0x50, 0xc5, 0x45, 0x4b,
+  0xce, 0xe3, 0x87, 0x20, 0x17, 0xbd, 0x02, 0x27, 0x64, 0x5d, 0x05, 0xda,
+  0x52, 0xfa, 0xf6, 0x68, 0xbf, 0xe3, 0xd8, 0x38, 0x9e, 0x97, 0x6b, 0xb4,
+  0x54, 0x25, 0x25, 0x69, 0xd9, 0xa9, 0xfb, 0xe2, 0x3c, 0x16, 0xf5, 0x95,
+  0xad, 0x5d, 0xbb, 0x75, 0x5a, 0x6f, 0xc1, 0xc8, 0xa5, 0xbf, 0x8a, 0xda,
+  0x17, 0x03, 0x79, 0x95, 0x0c, 0x51, 0x60, 0xce, 0x5b, 0xd6, 0x6f, 0x02,
+  0x16, 0x97, 0x2a, 0x6b, 0xc3, 0x69, 0xd2, 0xb0, 0x0c, 0xa5, 0xec, 0xaa,
+  0xe3, 0xd9, 0x0c, 0x53, 0xe2, 0xc7, 0x88, 0x91, 0x15, 0x1b, 0x3d, 0xea,
+  0x36, 0xe1, 0xba, 0xd2, 0xe3, 0xc9, 0x13, 0x74, 0xca, 0x10, 0x8b, 0xb1,
+  0xcf, 0x97, 0xd2, 0xb7, 0xcd, 0x68, 0x92, 0x64, 0x5b, 0x2e, 0xfa, 0x6e,
+  0x88, 0xd5, 0x59, 0x2e, 0xd2, 0x43, 0x69, 0xce, 0xc7, 0x2b, 0xe9, 0x86,
+  0x4d, 0x35, 0xa5, 0x44, 0xe6, 0xc4, 0x25, 0xa3, 0xf0, 0xa8, 0x19, 0xf0,
+  0xb7, 0x6b, 0xd0, 0x0f, 0x46, 0x46, 0xb2, 0x03, 0xf5, 0xbc, 0xc5, 0xc6,
+  0xd3, 0x9a, 0x03, 0x08, 0xf6, 0xd6, 0x18, 0x7f, 0x00, 0xb5, 0x34, 0xaf,
+  0x9c, 0x26, 0x13, 0xa7, 0xf4, 0x53, 0xb0, 0x45, 0x29, 0x5d, 0x40, 0x32,
+  0x28, 0x4b, 0x68, 0x5b, 0x0e, 0x92, 0x5b, 0xb0, 0xa0, 0x50, 0x3f, 0xef,
+  0x78, 0x38, 0xaf, 0x48, 0xef, 0x3b, 0x3c, 0x99, 0x82, 0x62, 0x81, 0x86,
+  0xe3, 0xd6, 0xd3, 0xc2, 0xe7, 0x14, 0xd6, 0xd5, 0x70, 0x9e, 0xc3, 0x61,
+  0xac, 0xda, 0x6a, 0x6e, 0x8a, 0x2a, 0xf1, 0xd5, 0x32, 0x8a, 0xda, 0xaf,
+  0xcb, 0x6b, 0x42, 0x9b, 0xea, 0xeb, 0x31, 0xc0, 0xb7, 0x26, 0xa5, 0xd2,
+  0x10, 0x19, 0xb9, 0x0e, 0x06, 0x5c, 0xdc, 0x14, 0xd6, 0xac, 0xc9, 0x08,
+  0x65, 0x45, 0xc8, 0xa0, 0x36, 0x70, 0xb4, 0x86, 0xe0, 0x8f, 0x23, 0xf7,
+  0x4d, 0x60, 0xed, 0x30, 0xa2, 0x7e, 0xec, 0xd2, 0x13, 0x0d, 0xb4, 0x30,
+  0xbf, 0x32, 0xd2, 0xb5, 0x3d, 0x79, 0x3b, 0xd1, 0xf7, 0xc8, 0xc6, 0x9b,
+  0x01, 0xe3, 0xff, 0x18, 0xc7, 0x13, 0x64, 0xfe, 0x9a, 0x93, 0x22, 0x8c,
+  0x32, 0xdc, 0xc6, 0xd1, 0xe0, 0x1f, 0x4c, 0xb5, 0x6b, 0xec, 0x88, 0x5c,
+  0x12, 0xaa, 0xba, 0x34, 0xab, 0xfb, 0x54, 0x28, 0x87, 0x5d, 0x3a, 0x14,
+  0x49, 0x4f, 0xe3, 0x3c, 0xab, 0x17, 0xca, 0x1a, 0x80, 0x30, 0x37, 0x74,
+  0x56, 0x73, 0xd1, 0x86, 0xae, 0x20, 0x4b, 0x30, 0x9d, 0x0b, 0xdc, 0x4a,
+  0xb2, 0x6b, 0xd6, 0x1e, 0xae, 0x65, 0x1c, 0xac, 0xeb, 0xc7, 0xd5, 0xd6,
+  0x36, 0x9f, 0xce, 0x99, 0xdc, 0x08, 0x51, 0x5a, 0x73, 0x0d, 0x53, 0xc1,
+  0x34, 0x2d, 0xc7, 0x5d, 0x2a, 0xdb, 0xd0, 0x81, 0x78, 0x21, 0x25, 0x7d,
+  0x9f, 0xe8, 0xcd, 0xb4, 0x7b, 0x08, 0xaa, 0x40, 0xdc, 0xcb, 0x9a, 0x9c,
+  0x39, 0x2d, 0xc6, 0x37, 0xee, 0xad, 0x63, 0x39, 0xfc, 0xf0, 0x31, 0x5b,
+  0x46, 0xcb, 0xdd, 0x20, 0x53, 0x10, 0x84, 0xb2, 0xbf, 0x21, 0x84, 0x1b,
+  0xe3, 0x29, 0x5b, 0x13, 0x05, 0xf5, 0x28, 0x4d, 0x20, 0xa4, 0x72, 0x06,
+  0x9a, 0x4d, 0x0f, 0x8d, 0xfb, 0xcb, 0x4c, 0x1a, 0x25, 0x35, 0x7d, 0xba,
+  0xa6, 0xb1, 0x5f, 0x12, 0x92, 0x59, 0x96, 0x6d, 0x76, 0x39, 0xed, 0xab,
+  0x11, 0x49, 0x78, 0x9b, 0x52, 0x21, 0x17, 0x2d, 0x6d, 0xd2, 0x9f, 0x1e,
+  0x91, 0xa4, 0x22, 0x48, 0x34, 0x96, 0x8f, 0xa7, 0xee, 0x28, 0xce, 0x5d,
+  0x49, 0x08, 0x66, 0x77, 0x7c, 0xdc, 0xa9, 0x67, 0x38, 0xd7, 0xfb, 0xa0,
+  0xd8, 0x3e, 0x60, 0xe6, 0x47, 0x77, 0x31, 0x25, 0xdf, 0x3f, 0x81, 0xed,
+  0xac, 0x6b, 0xa6, 0x24, 0x7d, 0xc7, 0x98, 0x6d, 0xc3, 0x41, 0x83, 0x35,
+  0xdd, 0x5d, 0xb0, 0x0e, 0x6e, 0x07, 0x3d, 0x8c, 0xeb, 0xfb, 0xed, 0x8f,
+  0x42, 0x22, 0x6f, 0xbf, 0x65, 0xed, 0x93, 0x79, 0xe5, 0x66, 0xe7, 0xfa,
+  0x07, 0xbb, 0x63, 0x61, 0x0c, 0x70, 0x33, 0x87, 0xb1, 0x38, 0x4e, 0x4b,
+  0x1c, 0x87, 0xfe, 0x6c, 0x26, 0x4c, 0x40, 0xec, 0x12, 0x2f, 0xd4, 0x63,
+  0xea, 0xfb, 0xad, 0x67, 0x3a, 0x8e, 0xad, 0x87, 0x75, 0x97, 0x2d, 0x66,
+  0x44, 0xca, 0x8b, 0xce, 0x03, 0x99, 0xb3, 0x09, 0x73, 0x99, 0xa5, 0xfe,
+  0x43, 0xf8, 0x40, 0xb9, 0xda, 0x87, 0x28, 0x26, 0x00, 0xf7, 0xd0, 0x9a,
+  0xcc, 0xbc, 0xcc, 0xa1, 0xb3, 0xcd, 0x07, 0x1b, 0x77, 0x33, 0x61, 0x99,
+  0x36, 0x10, 0x49, 0xe4, 0xba, 0x7c, 0x5f, 0x93, 0x02, 0xbf, 0x07, 0x00,
+  0xd2, 0x8d, 0x45, 0x0a, 0xae, 0x95, 0x8a, 0xc2, 0xee, 0x7f, 0x3f, 0x6b,
+  0xbe, 0x55, 0x44, 0x66, 0xa8, 0x56, 0x6d, 0x43, 0x8b, 0x5d, 0x92, 0x00,
+  0x7d, 0x3b, 0x87, 0x8e, 0xaa, 0x68, 0xcd, 0x1a, 0x87, 0xa3, 0x85, 0x91,
+  0xed, 0x20, 0xc1, 0xd0, 0x3b, 0x9f, 0xa7, 0x25, 0xab, 0xd9, 0x79, 0x6d,
+  0x18, 0xf2, 0xbe, 0x52, 0x8c, 0xc3, 0x17, 0x72, 0x7a, 0xd3, 0x30, 0x71,
+  0x1c, 0xe8, 0xe1, 0xba, 0xe1, 0xa0, 0x26, 0x03, 0xc3, 0x63, 0xb0, 0xca,
+  0x27, 0x8c, 0x87, 0x05, 0xf8, 0xe1, 0xae, 0x2f, 0xff, 0x32, 0x37, 0xc6,
+  0xa5, 0x83, 0xda, 0x81, 0x4f, 0xa8, 0x1f, 0x1f, 0x71, 0x95, 0xe6, 0xaf,
+  0xd9, 0xcd, 0x3a, 0x7e, 0xe7, 0x5e, 0x38, 0xb9, 0x0b, 0x73, 0xe8, 0x4a,
+  0x2a, 0x98, 0x03, 0x95, 0x48, 0x95, 0xc6, 0xf4, 0xa8, 0x22, 0xe1, 0xf7,
+  0x02, 0x81, 0x01, 0xf4, 0x22, 0x7f, 0x44, 0x5b, 0xee, 0xc0, 0x6c, 0xba,
+  0x6e, 0x75, 0x24, 0xbd, 0x7a, 0x6a, 0x73, 0xb1, 0x56, 0x03, 0x32, 0x95,
+  0x66, 0x9c, 0x9d, 0xba, 0xea, 0x5a, 0xd6, 0xa1, 0x12, 0xaf, 0x79, 0x2c,
+  0xb8, 0x78, 0x41, 0xcf, 0xb2, 0x1b, 0xd7, 0xf6, 0x7c, 0x0b, 0x6f, 0xdf,
+  0xdc, 0x89, 0x3f, 0xdd, 0xfc, 0xce, 0xc6, 0xdd, 0x76, 0x8a, 0x7f, 0x6a,
+  0xae, 0x2b, 0x16, 0x78, 0xc9, 0x8b, 0xe3, 0x02, 0x95, 0x36, 0x16, 0x31,
+  0x2f, 0x44, 0x54, 0x7a, 0x7b, 0x10, 0xde, 0xe7, 0xee, 0x0c, 0x23, 0x44,
+  0x6e, 0xf7, 0x5d, 0x0b, 0x4b, 0xef, 0xcd, 0x48, 0xf0, 0x30, 0x74, 0xfd,
+  0xed, 0x37, 0xc9, 0x6f, 0x98, 0xf0, 0xde, 0x81, 0xb1, 0x5a, 0x67, 0xdb,
+  0x6a, 0xac, 0xad, 0xe6, 0xa3, 0x49, 0xb9, 0x0b, 0xed, 0xdf, 0x53, 0x22,
+  0x42, 0xb3, 0x72, 0x05, 0x06, 0x94, 0x74, 0xa0, 0x9f, 0x58, 0x07, 0x1b,
+  0x29, 0x97, 0x6c, 0x3e, 0x19, 0x7f, 0x94, 0x3a, 0xe8, 0xd7, 0x21, 0x66,
+  0x65, 0xe8, 0x72, 0xc2, 0xa4, 0x6f, 0x3c, 0xea, 0xe5, 0x60, 0xf6, 0xdd,
+  0x25, 0xfe, 0x7d, 0x71, 0x64, 0x26, 0x3c, 0xb3, 0xfd, 0xb6, 0xbb, 0x8f,
+  0x85, 0xd1, 0xb0, 0x81, 0x8a, 0x9d, 0x92, 0xe2, 0x13, 0xbe, 0xfb, 0xaa,
+  0xad, 0x14, 0xfb, 0x6a, 0xd5, 0xd5, 0x55, 0x2d, 0xa8, 0x72, 0x77, 0xbf,
+  0xb7, 0x06, 0x95, 0x8b, 0xcb, 0xce, 0xdf, 0x77, 0xd3, 0xa7, 0x38, 0xf2,
+  0xb4, 0xc4, 0xad, 0xd7, 0x41, 0x18, 0x13, 0xd6, 0x3d, 0xa7, 0xd0, 0xc6,
+  0x86, 0x3b, 0xd3, 0x2a, 0x65, 0xce, 0x13, 0x79, 0xeb, 0xa8, 0x3b, 0xdb,
+  0xda, 0x77, 0x8f, 0x8d, 0xc8, 0xa5, 0xa8, 0xd1, 0x11, 0x24, 0xd7, 0xe2,
+  0x02, 0x6f, 0x42, 0xe7, 0x00, 0x92, 0xbe, 0x32, 0x7c, 0x4c, 0x4a, 0x44,
+  0xe2, 0x3a, 0x94, 0x11, 0x51, 0x7d, 0x64, 0xa9, 0xa6, 0xc9, 0xdc, 0x00,
+  0xa9, 0x3b, 0xcb, 0x4d, 0x17, 0x50, 0xdc, 0xfb, 0x7e, 0xda, 0xce, 0xdf,
+  0xf3, 0x13, 0x35, 0xe0, 0x1c, 0xf8, 0xdf, 0x1e, 0x0b, 0xa8, 0x6a, 0x7a,
+  0x2a, 0xea, 0xc3, 0xbd, 0x54, 0x63, 0x3c, 0x5f, 0x60, 0xaf, 0x1d, 0x42,
+  0x8f, 0x8b, 0xb7, 0xf6, 0xa3, 0xb1, 0x63, 0xcb, 0x72, 0x1c, 0x87, 0xa5,
+  0xae, 0x30, 0x23, 0x8f, 0x1f, 0x97, 0x0c, 0x24, 0xe3, 0xc2, 0x50, 0x76,
+  0x07, 0xff, 0xe5, 0xba, 0x11, 0x93, 0x81, 0xa6, 0x87, 0x13, 0x7b, 0xd8,
+  0xec, 0xc4, 0xb9, 0x50, 0xf5, 0x33, 0x9d, 0x28, 0x3e, 0x90, 0x67, 0xf1,
+  0xbe, 0xa8, 0x92, 0xf4, 0x15, 0xd7, 0x59, 0x40, 0xc1, 0xe1, 0x25, 0x2b,
+  0x4d, 0x67, 0x54, 0x5f, 0x85, 0xbe, 0xdd, 0x30, 0xb0, 0x5d, 0xbe, 0x99,
+  0x62, 0x7f, 0xf6, 0x7a, 0xde, 0x52, 0x65, 0x02, 0x7e, 0x34, 0xe8, 0xf5,
+  0x32, 0x23, 0xdd, 0xfa, 0x4b, 0x5c, 0xe0, 0x77, 0x89, 0x72, 0x49, 0xed,
+  0x1c, 0x02, 0x05, 0x36, 0x9d, 0xa2, 0x9c, 0x86, 0xe1, 0xd2, 0x4c, 0x66,
+  0x7e, 0xab, 0x64, 0x56, 0x4c, 0xb9, 0x88, 0xd1, 0x3d, 0x06, 0xd1, 0x9c,
+  0xdc, 0x92, 0xe2, 0x28, 0x44, 0xf5, 0xdf, 0x20, 0xc9, 0xa4, 0x9d, 0x40,
+  0x37, 0xef, 0xa4, 0xc1, 0xd2, 0x01, 0x63, 0x43, 0xda, 0xcb, 0x56, 0x5c,
+  0x2f, 0x9f, 0xe2, 0x21, 0xe1, 0x5d, 0x5f, 0x48, 0xae, 0x21, 0xdb, 0x40,
+  0x4a, 0x51, 0x18, 0x46, 0x28, 0x04, 0xce, 0x96, 0x98, 0x7a, 0x0f, 0x5a,
+  0x8d, 0xcf, 0xd8, 0xa0, 0xc6, 0xcf, 0x88, 0x97, 0x5a, 0xac, 0x25, 0x7f,
+  0xfa, 0xe1, 0x49, 0xcc, 0x92, 0x70, 0x17, 0x6d, 0x48, 0x2d, 0x8d, 0x89,
+  0x19, 0x75, 0x43, 0x05, 0x85, 0x3a, 0x9c, 0xd7, 0x11, 0xfe, 0x9c, 0xac,
+  0x5a, 0x97, 0x9d, 0x95, 0xd5, 0x18, 0x0c, 0x09, 0x5d, 0xbd, 0x75, 0x42,
+  0x32, 0x8f, 0x07, 0xc9, 0x2f, 0x25, 0xeb, 0xc7, 0x5f, 0x66, 0xdc, 0x8e,
+  0xaa, 0xa6, 0x6a, 0x00, 0xa0, 0x0d, 0xa5, 0xe6, 0x19, 0x71, 0xbb, 0xf7,
+  0x26, 0x5c, 0xe1, 0x33, 0xa6, 0xd1, 0xcc, 0xbf, 0x2c, 0xbb, 0xc2, 0x7d,
+  0x7f, 0x2d, 0x02, 0xa9, 0x16, 0xfc, 0xeb, 0x4a, 0x08, 0xd7, 0x38, 0xda,
+  0xee, 0xc0, 0x04, 0x86, 0x4b, 0x1f, 0xb5, 0x61, 0x6f, 0x89, 0xde, 0x93,
+  0xcb, 0x93, 0x89, 0x94, 0x47, 0x25, 0x5a, 0x19, 0x27, 0x67, 0xd4, 0xe3,
+  0x26, 0x64, 0xcf, 0x5b, 0xa3, 0x8b, 0x3c, 0x59, 0x7d, 0x17, 0x3a, 0xe8,
+  0x4b, 0xf6, 0xef, 0xe1, 0xb3, 0x0f, 0x3e, 0xc6, 0x40, 0x58, 0xcb, 0x33,
+  0x1c, 0xc3, 0xca, 0x94, 0x35, 0x68, 0xd8, 0x26, 0xcc, 0x1e, 0x59, 0xfa,
+  0x5a, 0x9c, 0x4e, 0x78, 0x9d, 0x5e, 0xa5, 0x02, 0x62, 0x60, 0xd3, 0x75,
+  0x7a, 0xf5, 0x29, 0xc5, 0x21, 0x0c, 0x71, 0x4e, 0x1f, 0x38, 0x81, 0xdb,
+  0x2f, 0x25, 0x1f, 0xd7, 0x8b, 0xa4, 0x40, 0xad, 0x7d, 0xe9, 0xfd, 0xa7,
+  0x3a, 0x2c, 0xd2, 0x03, 0x68, 0x23, 0x38, 0x8f, 0x5b, 0x7b, 0xb3, 0x0d,
+  0x91, 0xdc, 0xa4, 0x91, 0xf5, 0x99, 0xb9, 0x27, 0xa7, 0x21, 0x2b, 0x1d,
+  0x2c, 0x68, 0xfa, 0xc5, 0xba, 0xda, 0x34, 0xb7, 0xbb, 0xb5, 0x47, 0x4e,
+  0x17, 0xd9, 0x44, 0xdc, 0x90, 0x6b, 0x31, 0x07, 0xca, 0x78, 0xa0, 0xa0,
+  0xa4, 0xbe, 0xac, 0x22, 0x77, 0x22, 0xed, 0x58, 0xf4, 0x2a, 0x7d, 0x7d,
+  0x02, 0x2a, 0x81, 0xa5, 0x77, 0xb6, 0x9b, 0x57, 0x65, 0x78, 0x68, 0xdf,
+  0x08, 0x18, 0x0e, 0x92, 0x3a, 0x76, 0x5f, 0x11, 0xb3, 0x7f, 0xda, 0x4e,
+  0x35, 0x36, 0x07, 0x70, 0x0f, 0x9f, 0x83, 0x50, 0x0d, 0xcc, 0x76, 0xc7,
+  0xe4, 0x6e, 0xd3, 0x10, 0x8e, 0xe9, 0xfc, 0x7f, 0x86, 0x12, 0xd9, 0x0f,
+  0x17, 0x77, 0x7e, 0x03, 0xb7, 0x4f, 0xdc, 0xc1, 0xf8, 0x6c, 0xc4, 0x05,
+  0xf9, 0x8b, 0x11, 0x9f, 0x8f, 0xd6, 0x09, 0x3d, 0xb4, 0xb6, 0xa6, 0xe3,
+  0xba, 0xd4, 0x08, 0x3f, 0x27, 0xc3, 0x3e, 0x5e, 0x7d, 0x2d, 0xd8, 0xbc,
+  0x65, 0xb1, 0x5e, 0x05, 0x10, 0xa7, 0x30, 0x19, 0x56, 0x39, 0x6a, 0xee,
+  0x92, 0x79, 0xf9, 0x66, 0x10, 0x44, 0xf9, 0xc9, 0x0b, 0x57, 0xa6, 0x91,
+  0x8e, 0xe9, 0x0e, 0x53, 0xc1, 0x16, 0x8d, 0x9b, 0xa4, 0x6f, 0x08, 0xc8,
+  0xe4, 0x2e, 0xc2, 0xd9, 0xe4, 0x08, 0xcf, 0x0b, 0xac, 0xd1, 0xe2, 0xcc,
+  0x9e, 0x4c, 0x24, 0xa4, 0x01, 0x0a, 0x46, 0xec, 0x0f, 0xfd, 0xb2, 0x59,
+  0x9c, 0xe1, 0x55, 0xeb, 0x30, 0x72, 0xbc, 0xdb, 0xce, 0x7f, 0x40, 0x44,
+  0xd7, 0x0d, 0x30, 0xb7, 0x74, 0xe4, 0xca, 0xf8, 0x42, 0xec, 0x24, 0xc3,
+  0x9c, 0xa5, 0x6d, 0x25, 0xa0, 0xbf, 0xc6, 0x29, 0x70, 0xf6, 0x8f, 0xad,
+  0xe7, 0x3b, 0x60, 0x9e, 0x21, 0xe6, 0x65, 0xd3, 0x98, 0xd4, 0x9c, 0xa4,
+  0x20, 0xe3, 0xa3, 0x32, 0x19, 0x86, 0x46, 0x2e, 0xe9, 0x60, 0x45, 0x50,
+  0x07, 0xc9, 0x1e, 0x33, 0x07, 0xd0, 0xab, 0x74, 0x4c, 0xf0, 0xee, 0xa9,
+  0xc2, 0x58, 0x0d, 0xdd, 0x7b, 0x9a, 0xa5, 0x91, 0x8e, 0x1f, 0x71, 0xe9,
+  0x46, 0x8a, 0xed, 0x11, 0xb2, 0xeb, 0x17, 0x17, 0xb7, 0x32, 0x2b, 0x14,
+  0xda, 0x12, 0x52, 0xd8, 0x1f, 0xc9, 0x53, 0x53, 0x0b, 0x0d, 0xe7, 0xd4,
+  0x49, 0x17, 0x32, 0x24, 0x0b, 0xad, 0xd6, 0x54, 0x0b, 0xc7, 0xd0, 0x4e,
+  0x58, 0xa1, 0x36, 0xde, 0xbc, 0x7a, 0x8a, 0xc6, 0xf9, 0x09, 0xe5, 0x3c,
+  0x11, 0x3c, 0x7e, 0x21, 0xb7, 0xa0, 0x7f, 0xad, 0x19, 0x72, 0xba, 0xa7,
+  0xa3, 0xbd, 0x58, 0x45, 0x55, 0xbf, 0x76, 0xb1, 0x0a, 0x0a, 0x8f, 0x00,
+  0xba, 0x46, 0xf1, 0x68, 0x48, 0xff, 0xf6, 0x9a, 0x7c, 0x53, 0x4e, 0xd8,
+  0x53, 0xdc, 0x35, 0x12, 0x92, 0xed, 0xc9, 0xe5, 0x83, 0x14, 0x1a, 0xaf,
+  0x3d, 0x1a, 0x3f, 0xd1, 0xdd, 0x73, 0xf9, 0x09, 0xf8, 0x1c, 0xf9, 0xc9,
+  0x60, 0xab, 0xa3, 0x9c, 0x48, 0xd9, 0x2c, 0x57, 0xba, 0xdd, 0x34, 0xaa,
+  0x10, 0x12, 0xbd, 0xcf, 0x30, 0x9d, 0xb0, 0x9b, 0x5a, 0x4d, 0x7d, 0x7e,
+  0x31, 0x3b, 0x72, 0x4a, 0x08, 0xa0, 0x7b, 0x58, 0xfa, 0x9d, 0xb6, 0x77,
+  0x28, 0x5f, 0xd1, 0x10, 0x98, 0xba, 0xf2, 0x67, 0xc0, 0x8b, 0x00, 0x79,
+  0xa6, 0x66, 0x03, 0x8e, 0x86, 0xae, 0xc0, 0x90, 0x1f, 0xde, 0xd7, 0x89,
+  0x05, 0x00, 0xe8, 0x12, 0xeb, 0x86, 0x27, 0x5a, 0xc8, 0xf7, 0x7b, 0xa8,
+  0xa2, 0xc2, 0xda, 0x92, 0x38, 0xac, 0x0a, 0x1c, 0x8f, 0x8d, 0x53, 0x7c,
+  0xa8, 0xbf, 0x66, 0xde, 0xd0, 0x85, 0x04, 0xd7, 0x65, 0x06, 0xd2, 0x3a,
+  0xbf, 0xb7, 0xd4, 0x9a, 0xc6, 0x82, 0xf3, 0x0c, 0x18, 0xe5, 0x17, 0x30,
+  0xc1, 0x02, 0xfb, 0xae, 0x05, 0x97, 0xad, 0x64, 0xec, 0x2b, 0x45, 0x1a,
+  0xad, 0xa3, 0x7c, 0x45, 0x5f, 0xa5, 0xc9, 0x38, 0xcd, 0x06, 0xa0, 0x74,
+  0x81, 0x65, 0x4e, 0xd3, 0x89, 0x65, 0x93, 0xba, 0x97, 0x86, 0x4c, 0x04,
+  0x8c, 0x12, 0xab, 0x67, 0x26, 0x6f, 0x20, 0x87, 0x7b, 0x19, 0x04, 0xa5,
+  0x01, 0x65, 0x6c, 0x6e, 0x72, 0x9b, 0x7d, 0x74, 0xd0, 0x8d, 0xcd, 0x7c,
+  0x7d, 0x32, 0x43, 0x5e, 0xb5, 0x38, 0xf7, 0xb8, 0x74, 0xbb, 0xe9, 0x78,
+  0x6d, 0xe5, 0xb5, 0xcd, 0x63, 0x2d, 0xb8, 0x52, 0xdb, 0x86, 0x1d, 0x15,
+  0x6d, 0xb4, 0xeb, 0x0a, 0xed, 0xd2, 0x07, 0x3e, 0x43, 0xea, 0x64, 0x12,
+  0x03, 0x36, 0x71, 0xcc, 0x54, 0x18, 0x8b, 0xb1, 0x5f, 0x72, 0xfc, 0x8c,
+  0x9d, 0x7a, 0xe8, 0x27, 0x5c, 0x7c, 0x26, 0x23, 0xe1, 0xf5, 0x63, 0x9f,
+  0xe9, 0x79, 0x95, 0xc4, 0xb2, 0x27, 0x04, 0x90, 0xa4, 0x53, 0x84, 0x21,
+  0x52, 0xc2, 0xbc, 0xb6, 0xf5, 0xaa, 0xe9, 0x0d, 0xf1, 0x9b, 0x3c, 0x97,
+  0x09, 0x5f, 0xc6, 0x5e, 0xda, 0xd1, 0x7e, 0x8d, 0x03, 0x0a, 0xae, 0x48,
+  0x10, 0xb5, 0x22, 0x97, 0x0d, 0xab, 0xbe, 0x42, 0x1d, 0x55, 0xc7, 0xd5,
+  0x0e, 0x55, 0xd1, 0x31, 0xee, 0x68, 0x12, 0xf5, 0x4e, 0x99, 0x6f, 0x32,
+  0x24, 0x87, 0x10, 0xbb, 0xa5, 0x99, 0x7f, 0x11, 0x39, 0xd8, 0x22, 0x1f,
+  0x8f, 0xbd, 0x1c, 0x78, 0xd2, 0xd2, 0x15, 0x02, 0x1d, 0xde, 0x30, 0xeb,
+  0x70, 0xe1, 0x4b, 0x76, 0x8a, 0xd3, 0xb5, 0x0a, 0x5e, 0x85, 0xb7, 0xd6,
+  0x71, 0x4f, 0xe8, 0x9a, 0x30, 0x1c, 0xc2, 0xda, 0x1b, 0x02, 0xf8, 0xd0,
+  0x79, 0xc5, 0xd8, 0xd8, 0x08, 0xfb, 0x30, 0x3c, 0x2b, 0x52, 0x64, 0x2b,
+  0xd0, 0xa8, 0xf1, 0x6e, 0xc2, 0x7b, 0x97, 0xf7, 0xb9, 0x15, 0xd0, 0xae,
+  0x79, 0x7f, 0xc4, 0x34, 0xfb, 0x58, 0x76, 0x76, 0x01, 0x9a, 0x62, 0x17,
+  0x81, 0x35, 0x50, 0x79, 0x43, 0xb1, 0x53, 0x04, 0x1a, 0xf0, 0x73, 0x69,
+  0x5f, 0x33, 0x5b, 0x39, 0xfa, 0x40, 0x2a, 0x6f, 0x4f, 0x83, 0x3e, 0x34,
+  0x8e, 0xc2, 0x11, 0x4b, 0x93, 0x96, 0xca, 0x26, 0x54, 0xb4, 0xa5, 0xd8,
+  0x58, 0xa6, 0x0a, 0x9d, 0xcb, 0xfe, 0x87, 0x11, 0x9b, 0x71, 0xb8, 0x1e,
+  0xd3, 0x53, 0x34, 0xf9, 0xc9, 0x27, 0xcd, 0x80, 0x9f, 0x5c, 0xf4, 0xa2,
+  0xbf, 0xdb, 0x62, 0x53, 0x5d, 0xe0, 0x04, 0xd9, 0x45, 0x63, 0xe6, 0xca,
+  0x87, 0xd0, 0x11, 0x28, 0xd5, 0xbc, 0x74, 0x6a, 0xe9, 0xb8, 0xe8, 0xcb,
+  0xda, 0x41, 0xf0, 0x93, 0x53, 0x16, 0x6e, 0xcd, 0xce, 0xe1, 0x20, 0xc9,
+  0x66, 0xd9, 0xdb, 0x4a, 0xb3, 0x8b, 0xf5, 0xb1, 0xd4, 0x19, 0xe5, 0x9c,
+  0x61, 0xf7, 0x3d, 0xad, 0xf5, 0x28, 0x97, 0x33, 0xed, 0xcc, 0xb6, 0xad,
+  0x4f, 0xf5, 0xa3, 0x2e, 0xc5, 0x97, 0xf5, 0xeb, 0x77, 0xa0, 0x57, 0xb2,
+  0x1c, 0x25, 0x8f, 0x67, 0x97, 0x40, 0xe4, 0x7a, 0xbe, 0x5e, 0xf4, 0x43,
+  0xd7, 0xe8, 0x22, 0x36, 0x8b, 0xd9, 0xb4, 0xfa, 0xfa, 0xa7, 0x8c, 0xba,
+  0x3c, 0xc6, 0xf0, 0xb5, 0xdd, 0x24, 0x9a, 0x02, 0xc0, 0x0d, 0x63, 0x79,
+  0x25, 0x56, 0xa3, 0xe4, 0xa6, 0x42, 0x36, 0x50, 0x8a, 0xaa, 0xcc, 0xa3,
+  0x2e, 0xa6, 0x74, 0x4d, 0x77, 0x6a, 0x26, 0x65, 0x39, 0x4a, 0xd6, 0xdb,
+  0x06, 0xd6, 0xd8, 0x2f, 0x92, 0xee, 0x15, 0xd1, 0x24, 0xe9, 0xa9, 0xd2,
+  0x1e, 0x28, 0xd3, 0xef, 0x99, 0x60, 0x9b, 0x33, 0xaf, 0x85, 0x91, 0x3a,
+  0xee, 0x48, 0x09, 0x12, 0x4a, 0xa3, 0x77, 0xc2, 0xb2, 0xbb, 0xe2, 0xe2,
+  0xac, 0x83, 0x45, 0x3d, 0xc9, 0xff, 0xed, 0x2b, 0x8d, 0xe1, 0x8d, 0xe7,
+  0xd6, 0xab, 0x32, 0xc2, 0x74, 0x8d, 0xb3, 0x95, 0x87, 0x58, 0xab, 0x36,
+  0x96, 0x8b, 0x95, 0xb0, 0xd8, 0xf1, 0x26, 0x40, 0x65, 0x4e, 0x5a, 0x4b,
+  0x18, 0x61, 0x1b, 0x12, 0xfc, 0x5e, 0x2b, 0x81, 0x8c, 0x12, 0x07, 0x29,
+  0x16, 0xda, 0x99, 0x57, 0x89, 0x19, 0xdd, 0x7f, 0xf0, 0xd6, 0x8a, 0x88,
+  0xa0, 0xa2, 0x92, 0x35, 0x66, 0xb4, 0x45, 0x36, 0x2a, 0x4e, 0xd3, 0xfc,
+  0x9a, 0xbc, 0xeb, 0x08, 0xb2, 0xf9, 0xe6, 0x54, 0x39, 0x28, 0xa9, 0x17,
+  0x72, 0x76, 0x71, 0xe1, 0xce, 0xf0, 0x70, 0xa9, 0x67, 0x1f, 0x19, 0xa0,
+  0xc6, 0x36, 0x93, 0xa8, 0x6f, 0x74, 0xa5, 0xd5, 0xa5, 0x17, 0xec, 0xf0,
+  0x98, 0xb4, 0xbd, 0x14, 0x77, 0x37, 0xc1, 0x25, 0xf8, 0x3b, 0x51, 0x38,
+  0xa4, 0x90, 0xc4, 0x53, 0x8c, 0x07, 0xec, 0xf1, 0x2d, 0xdf, 0x80, 0x97,
+  0x51, 0xb7, 0x43, 0x79, 0xa3, 0xf0, 0x19, 0x71, 0xa4, 0x7a, 0x11, 0x85,
+  0xf1, 0xd8, 0x6a, 0x67, 0x41, 0x8b, 0x95, 0x37, 0xb6, 0xb8, 0x66, 0x6b,
+  0x62, 0xd3, 0x81, 0x6b, 0x1e, 0x85, 0xef, 0xfb, 0x9d, 0x63, 0xcc, 0x36,
+  0xb0, 0x50, 0xff, 0x27, 0x5a, 0x74, 0xe9, 0x7f, 0xfe, 0x3b, 0x85, 0x7b,
+  0x19, 0x19, 0x6f, 0xca, 0xe8, 0x76, 0xed, 0xec, 0xe9, 0x3e, 0xf3, 0x2e,
+  0xdb, 0xba, 0x3c, 0x97, 0x94, 0x09, 0x20, 0x04, 0x1d, 0x60, 0xee, 0x57,
+  0x84, 0x11, 0x9f, 0x2f, 0x9b, 0x3f, 0x1d, 0x2e, 0x8c, 0x28, 0xe7, 0x8b,
+  0x77, 0xa4, 0xb6, 0xa4, 0xbb, 0x16, 0xe6, 0x44, 0xd7, 0x0d, 0x69, 0xb3,
+  0xaf, 0xcd, 0xb6, 0x11, 0xdf, 0x2d, 0x0a, 0xc9, 0xc8, 0x72, 0x25, 0xb7,
+  0xb0, 0x54, 0x58, 0x8c, 0x6a, 0x21, 0xd5, 0x05, 0x36, 0xe4, 0x69, 0x3c,
+  0x4d, 0x6c, 0x88, 0x97, 0x8f, 0x45, 0xce, 0x12, 0xec, 0x62, 0xd6, 0x5d,
+  0x59, 0x15, 0x7c, 0x01, 0xe9, 0x3f, 0x99, 0x26, 0xa7, 0x1b, 0xfe, 0x84,
+  0x39, 0xbc, 0x51, 0x68, 0xf2, 0xdc, 0x13, 0x7d, 0x4b, 0xc5, 0x83, 0x83,
+  0xff, 0x59, 0x7f, 0x8c, 0x1d, 0xa8, 0x66, 0x1f, 0xb0, 0x06, 0x9d, 0x75,
+  0xc7, 0xb2, 0x97, 0x5c, 0x1d, 0x6b, 0x0b, 0x39, 0xd6, 0x18, 0xf9, 0x51,
+  0xf0, 0xdd, 0x7b, 0x02, 0x00, 0xb8, 0xc6, 0x47, 0x8e, 0x57, 0x1a, 0xa3,
+  0xdc, 0x5d, 0x9e, 0x8f, 0x4d, 0x7b, 0x78, 0x6e, 0xfb, 0x42, 0x70, 0x64,
+  0xa1, 0xcc, 0x9b, 0xc0, 0x7d, 0x1c, 0x05, 0x8d, 0xcf, 0x9f, 0x3e, 0xec,
+  0x11, 0x11, 0x2b, 0xc2, 0x10, 0xa1, 0xf3, 0x9b, 0xe8, 0x91, 0x71, 0xaf,
+  0x2c, 0xd3, 0x36, 0x0d, 0xe7, 0xe8, 0xf0, 0x21, 0xaf, 0x0f, 0xbc, 0xfd,
+  0xfa, 0x2f, 0x13, 0xa5, 0x48, 0xf5, 0x18, 0x8e, 0xf6, 0xa9, 0x62, 0xd8,
+  0x47, 0x74, 0x51, 0x36, 0x86, 0xe8, 0xe5, 0xe7, 0x0b, 0xc6, 0xf5, 0x69,
+  0xff, 0xbd, 0xd1, 0x48, 0xa7, 0x9f, 0x0c, 0xf1, 0xa7, 0xd1, 0xef, 0xab,
+  0xe3, 0x95, 0x25, 0x95, 0x40, 0x47, 0xd1, 0x10, 0x4d, 0x42, 0xf8, 0x9e,
+  0xf9, 0x7b, 0xc4, 0x04, 0x08, 0x8b, 0x12, 0xf8, 0xed, 0xd7, 0x75, 0xa8,
+  0x5f, 0x54, 0x54, 0x2f, 0x01, 0x68, 0x07, 0x04, 0x34, 0xaf, 0x80, 0x45,
+  0x3a, 0x14, 0xb5, 0x89, 0x84, 0xbb, 0xca, 0x66, 0x61, 0x87, 0x08, 0x22,
+  0x52, 0xbe, 0xed, 0xfa, 0x38, 0x02, 0xb7, 0x6f, 0x2c, 0xef, 0xa0, 0xa9,
+  0xe7, 0x75, 0x2f, 0x50, 0xd1, 0xaf, 0xa2, 0xf2, 0xa8, 0xd3, 0x73, 0xfb,
+  0xee, 0xbf, 0x1d, 0x4f, 0x3a, 0x56, 0x0f, 0xa6, 0x91, 0x52, 0xc1, 0x94,
+  0x0a, 0xaf, 0xb4, 0x38, 0x15, 0x57, 0xcb, 0x0d, 0xaa, 0x51, 0x6b, 0xbb,
+  0x18, 0x3c, 0x8d, 0x73, 0x25, 0xeb, 0xfb, 0x0a, 0xb6, 0x97, 0xef, 0x94,
+  0x57, 0xda, 0x89, 0xca, 0x68, 0x1f, 0xd8, 0x86, 0x17, 0xdb, 0x52, 0x78,
+  0x58, 0x6d, 0x6f, 0x05, 0x43, 0x82, 0xa5, 0x10, 0x34, 0x85, 0x42, 0xca,
+  0x2b, 0xdc, 0xd7, 0xcd, 0xa0, 0x67, 0xe3, 0xde, 0xa3, 0x68, 0x04, 0xdc,
+  0x3e, 0xca, 0x1c, 0x7f, 0xce, 0x9e, 0x02, 0x69, 0xd7, 0xb3, 0x88, 0xc1,
+  0x82, 0x3e, 0x00, 0x2d, 0x93, 0x87, 0x8c, 0x79, 0x94, 0xc6, 0xfa, 0xd3,
+  0x68, 0xff, 0x50, 0xbb, 0x56, 0xfb, 0xac, 0xcf, 0x52, 0x27, 0xf7, 0xb7,
+  0xf8, 0xad, 0x75, 0x14, 0x79, 0x00, 0xbd, 0xd8, 0x19, 0x35, 0x4f, 0x16,
+  0xf4, 0xf9, 0xa2, 0x14, 0xf3, 0x86, 0x3f, 0x43, 0x3f, 0xfb, 0x68, 0xc3,
+  0xed, 0x30, 0x0a, 0x1d, 0x53, 0x2d, 0x1e, 0x7f, 0x82, 0xa2, 0xc6, 0x43,
+  0x0d, 0xf5, 0xeb, 0xb0, 0x9b, 0xc3, 0x21, 0x91, 0xf9, 0xdc, 0xd7, 0x6a,
+  0x83, 0xfe, 0x51, 0x43, 0x22, 0x27, 0x8b, 0xfe, 0xfa, 0x15, 0x54, 0xd1,
+  0x1d, 0xa3, 0x21, 0x27, 0x1f, 0xf6, 0x59, 0xea, 0x45, 0x00, 0x9d, 0xe8,
+  0x71, 0x85, 0xa0, 0x21, 0x21, 0x87, 0xd1, 0x8f, 0x2c, 0x74, 0x38, 0x35,
+  0x7a, 0xc3, 0x8c, 0x40, 0xdd, 0xaa, 0x15, 0x22, 0x58, 0xef, 0x06, 0xc7,
+  0xd5, 0x76, 0xc2, 0x7c, 0xdc, 0x03, 0xf0, 0xc0, 0xde, 0xb0, 0x0f, 0xb3,
+  0xe7, 0x40, 0xf6, 0x9f, 0x1b, 0x13, 0xc3, 0x28, 0xa5, 0x18, 0x6f, 0x39,
+  0x29, 0x29, 0xf9, 0xfa, 0xa2, 0x2f, 0xd0, 0x2e, 0x88, 0x34, 0x65, 0x48,
+  0x5f, 0x54, 0xc0, 0x28, 0xe9, 0xe8, 0xf6, 0x07, 0x70, 0xf0, 0x5d, 0x3c,
+  0x4d, 0x30, 0x06, 0x72, 0x67, 0x83, 0x5c, 0x68, 0x63, 0x82, 0x0f, 0x2b,
+  0xa4, 0x81, 0xfe, 0x9c, 0x91, 0xc4, 0x9a, 0x6a, 0xe8, 0x7b, 0x4d, 0x4b,
+  0xbe, 0x23, 0x0b, 0xee, 0xa7, 0x00, 0x68, 0xe5, 0xba, 0x24, 0x17, 0xe9,
+  0x29, 0xdf, 0x12, 0xff, 0x78, 0x65, 0x82, 0x0b, 0x8f, 0xb8, 0xe3, 0x47,
+  0x0b, 0x97, 0xd3, 0x1c, 0x67, 0x1d, 0x75, 0x6f, 0xcf, 0xe8, 0x15, 0xca,
+  0x22, 0xa1, 0x6d, 0x4e, 0xd0, 0xa6, 0xc5, 0x58, 0x7b, 0x4b, 0x7c, 0xba,
+  0x09, 0x71, 0x48, 0x56, 0xbd, 0xbe, 0x10, 0x37, 0xa7, 0x3a, 0x6d, 0x67,
+  0x4e, 0x61, 0x34, 0x53, 0xf0, 0x11, 0x3c, 0x31, 0x91, 0x5e, 0xa5, 0x62,
+  0x14, 0x53, 0x25, 0x0a, 0xc5, 0x93, 0x9c, 0x8e, 0x29, 0x15, 0x23, 0x1a,
+  0x35, 0x14, 0x8c, 0x4a, 0x5b, 0xcf, 0x77, 0x37, 0x4c, 0xb7, 0xb8, 0xab,
+  0x18, 0x91, 0x34, 0xdb, 0x4f, 0xc3, 0x23, 0x09, 0x0f, 0xdd, 0x76, 0x77,
+  0x46, 0xae, 0xd7, 0x93, 0xd8, 0x4a, 0x64, 0x1e, 0xe8, 0x20, 0xcb, 0xd4,
+  0x81, 0xe5, 0xc5, 0x15, 0xac, 0xd9, 0x6d, 0x71, 0x45, 0x3f, 0x70, 0x91,
+  0x13, 0x94, 0x5e, 0xa0, 0x51, 0x49, 0x98, 0x9d, 0xc3, 0x6f, 0xd8, 0xe7,
+  0x62, 0x94, 0x45, 0x1b, 0xee, 0x5e, 0x64, 0x22, 0x06, 0xf9, 0xaf, 0x90,
+  0xe6, 0xef, 0x0d, 0xa8, 0xe2, 0xb8, 0x3d, 0x16, 0x04, 0x3a, 0xb5, 0xc1,
+  0xb4, 0xcd, 0xbe, 0x1f, 0x55, 0x17, 0x53, 0x61, 0xce, 0x42, 0xd4, 0xe2,
+  0xf3, 0xb3, 0x77, 0xe6, 0xee, 0x68, 0xb6, 0x91, 0x60, 0x59, 0xe6, 0x8b,
+  0x21, 0x02, 0x22, 0xa6, 0xd7, 0xc7, 0xc9, 0x9f, 0xaf, 0x4e, 0x5d, 0xfc,
+  0x12, 0xcc, 0x25, 0x19, 0x00, 0x0b, 0xfd, 0xad, 0xa8, 0xa7, 0xd7, 0xa9,
+  0xa2, 0x81, 0x0d, 0x8a, 0xbf, 0x5a, 0x42, 0x14, 0x6c, 0xc8, 0x5d, 0xca,
+  0x20, 0x54, 0xb5, 0x30, 0xcf, 0x11, 0x96, 0x1a, 0x70, 0x64, 0x65, 0x78,
+  0x07, 0x63, 0x23, 0xda, 0x91, 0xe2, 0x01, 0x5e, 0xb5, 0x99, 0x59, 0x87,
+  0x0c, 0x6f, 0x91, 0xa6, 0x27, 0x35, 0x67, 0x00, 0x00, 0x1c, 0xa7, 0xdd,
+  0xb5, 0xe9, 0xec, 0x9d, 0xd1, 0xa8, 0xfc, 0x77, 0xa9, 0x28, 0x0a, 0xc9,
+  0x14, 0x2f, 0xa1, 0x27, 0x66, 0x61, 0x67, 0x3d, 0x7e, 0xac, 0x0e, 0x3a,
+  0x3e, 0x98, 0xee, 0xa6, 0xb2, 0x3f, 0x5f, 0x7e, 0x01, 0x31, 0x37, 0x5a,
+  0xbc, 0x39, 0x09, 0x16, 0x38, 0x01, 0x7e, 0x44, 0x5b, 0x12, 0xe5, 0xdc,
+  0x57, 0x98, 0xfe, 0x89, 0x6e, 0x4a, 0xfc, 0x6e, 0x1c, 0xe9, 0xdb, 0x67,
+  0xe8, 0x35, 0x09, 0x55, 0xad, 0x83, 0x05, 0xe2, 0x51, 0x27, 0x43, 0xc0,
+  0x55, 0x1a, 0x61, 0x27, 0x78, 0x3c, 0x2e, 0xc8, 0x2e, 0x68, 0x3d, 0xfb,
+  0x39, 0x8b, 0x41, 0x1f, 0x1b, 0x39, 0x99, 0x1a, 0xb4, 0x76, 0xbf, 0xbd,
+  0x4b, 0x28, 0x9c, 0x80, 0x5e, 0x8e, 0xfc, 0x65, 0x51, 0x36, 0x7f, 0x73,
+  0x4b, 0x75, 0x6c, 0xd2, 0xe9, 0x23, 0x11, 0x17, 0xba, 0xa3, 0x0e, 0x59,
+  0x75, 0x3d, 0xd2, 0xb3, 0xd1, 0xd8, 0x76, 0x03, 0xf6, 0x13, 0x1d, 0x0a,
+  0x5b, 0x00, 0xa3, 0x8b, 0x65, 0x0c, 0xdf, 0x26, 0x19, 0xa7, 0xeb, 0xb5,
+  0xe8, 0x9c, 0xa5, 0x75, 0xd8, 0x92, 0xbd, 0x13, 0x2c, 0x00, 0x52, 0x35,
+  0xbc, 0x50, 0xa9, 0x21, 0x03, 0xef, 0xd2, 0x0d, 0x81, 0x3c, 0x50, 0xca,
+  0x82, 0x40, 0xff, 0x3c, 0xb6, 0x7b, 0x6b, 0x31, 0x69, 0x04, 0x5c, 0x02,
+  0xa5, 0x03, 0x18, 0x81, 0xba, 0xf2, 0x64, 0x98, 0x24, 0x87, 0xfc, 0x2b,
+  0xdd, 0xa2, 0xd5, 0xb2, 0x30, 0xba, 0xc4, 0x88, 0x86, 0x27, 0x0f, 0xc2,
+  0x90, 0xd7, 0xa1, 0xe1, 0x1f, 0xd8, 0xde, 0xa3, 0xd1, 0xac, 0xaf, 0x00,
+  0x84, 0x81, 0x38, 0x95, 0x46, 0x42, 0x84, 0x55, 0x67, 0xb9, 0x58, 0x80,
+  0x36, 0x9f, 0x4e, 0xdc, 0x0e, 0xcb, 0x71, 0x6c, 0x9a, 0x3b, 0x92, 0x55,
+  0xef, 0x4b, 0x66, 0xd3, 0x92, 0x61, 0xc0, 0x26, 0x5b, 0xfc, 0x1b, 0xb2,
+  0x12, 0xf7, 0xf2, 0xfd, 0x99, 0x13, 0x4a, 0xbb, 0x8b, 0x06, 0x0d, 0xff,
+  0x75, 0x90, 0x7c, 0x4d, 0x70, 0x85, 0xab, 0x44, 0x73, 0x12, 0x0d, 0x66,
+  0xfb, 0xca, 0x49, 0xf0, 0x0e, 0x98, 0xe0, 0x4d, 0x0f, 0x9c, 0x1b, 0x02,
+  0xc1, 0x59, 0x81, 0x8d, 0xd4, 0xb4, 0xe0, 0x05, 0x9a, 0x34, 0x6e, 0x3c,
+  0x0a, 0x91, 0x06, 0x64, 0xbc, 0x02, 0x9d, 0x30, 0xe5, 0xe0, 0xec, 0x7c,
+  0x77, 0x1c, 0x01, 0x34, 0x72, 0x01, 0x72, 0xc4, 0x95, 0xdc, 0x56, 0x00,
+  0x56, 0x33, 0x89, 0x15, 0xc9, 0x59, 0xc5, 0xde, 0xbe, 0xaa, 0xf7, 0x97,
+  0x68, 0x14, 0xeb, 0x8a, 0x4d, 0x4c, 0x0e, 0xcc, 0xc4, 0xc5, 0x32, 0x0b,
+  0x98, 0x50, 0x5d, 0x09, 0x30, 0x24, 0x5c, 0x13, 0x5e, 0x73, 0x1c, 0x0d,
+  0x8e, 0xeb, 0x82, 0x81, 0xf6, 0xda, 0x54, 0xc6, 0x46, 0x5e, 0xd5, 0x37,
+  0xe5, 0xc0, 0xd7, 0x04, 0xe4, 0xe6, 0x07, 0x05, 0x94, 0xcb, 0x78, 0xa3,
+  0xa3, 0xc9, 0x08, 0xb9, 0x24, 0x12, 0x64, 0xf8, 0xf1, 0xaf, 0xa5, 0x11,
+  0xa0, 0xaa, 0xb4, 0x54, 0xf7, 0xee, 0xa2, 0xab, 0x32, 0xae, 0x3e, 0xb9,
+  0x0a, 0x57, 0xad, 0x3d, 0xee, 0x10, 0x7a, 0x31, 0xfa, 0xa1, 0x93, 0xc3,
+  0x56, 0x1c, 0x86, 0x17, 0x97, 0x41, 0xb9, 0x64, 0x61, 0x4b, 0xbc, 0xc8,
+  0xa2, 0x57, 0xd2, 0x15, 0xa3, 0x6d, 0xf3, 0x2f, 0x5b, 0x2c, 0x64, 0x6b,
+  0x1d, 0xc4, 0x95, 0x6b, 0x1e, 0x8b, 0xec, 0x15, 0x8e, 0x90, 0xb3, 0xb5,
+  0x3d, 0x3c, 0x07, 0x79, 0x03, 0x69, 0xc5, 0x5c, 0x02, 0x91, 0xb2, 0x51,
+  0xf1, 0x7e, 0x99, 0x74, 0x96, 0x00, 0x43, 0x6d, 0x6e, 0xb1, 0x0a, 0x7e,
+  0x13, 0x76, 0x40, 0xe3, 0x1e, 0xdd, 0xaa, 0x4d, 0xf8, 0x7e, 0x5d, 0x91,
+  0x59, 0x20, 0x89, 0xbf, 0x02, 0x91, 0xc1, 0xed, 0xe9, 0x32, 0xef, 0xf2,
+  0xf5, 0xd6, 0x87, 0x95, 0x11, 0x17, 0xf3, 0xd3, 0x03, 0xb0, 0x86, 0xe0,
+  0x70, 0xd8, 0x5c, 0xbd, 0xf8, 0x20, 0xde, 0xf9, 0x94, 0x19, 0x4b, 0x9f,
+  0x1b, 0x0a, 0x63, 0x39, 0xee, 0xff, 0x26, 0x0f, 0xe9, 0xf3, 0xb5, 0x8b,
+  0x55, 0x69, 0x23, 0x5a, 0x33, 0x85, 0x37, 0x69, 0x0a, 0x9b, 0xd5, 0x7b,
+  0x79, 0xfe, 0xf2, 0x6a, 0x21, 0x70, 0x7b, 0xb4, 0xe6, 0xb9, 0xb6, 0x8f,
+  0x28, 0xc8, 0x2b, 0x45, 0xa1, 0xd3, 0x86, 0xe5, 0x74, 0x26, 0xc7, 0x53,
+  0x5b, 0xf3, 0xdb, 0xda, 0xe6, 0x52, 0x03, 0x5e, 0xe6, 0x06, 0x5b, 0xc6,
+  0xf0, 0xca, 0x3e, 0x47, 0x23, 0x2c, 0x79, 0x0f, 0x56, 0x4a, 0xf1, 0x29,
+  0x90, 0x21, 0xab, 0x76, 0xea, 0x2e, 0xb0, 0x59, 0xe9, 0x03, 0xb2, 0xb4,
+  0x28, 0x91, 0x1d, 0xf1, 0x1d, 0xb2, 0x43, 0x12, 0x29, 0xc7, 0x9e, 0x2d,
+  0xb2, 0xbd, 0xa5, 0xfc, 0x67, 0x57, 0xda, 0xab, 0x22, 0x80, 0x36, 0x6a,
+  0xf7, 0xef, 0x81, 0xa9, 0xdf, 0x3d, 0x17, 0x60, 0x86, 0xf2, 0xe1, 0x8e,
+  0x5d, 0xe4, 0xf9, 0x01, 0x68, 0xe2, 0x49, 0xf4, 0xfd, 0xc5, 0x69, 0x2c,
+  0x5d, 0x12, 0x86, 0x5d, 0xa1, 0xc5, 0xbd, 0xf2, 0x5c, 0xea, 0xa6, 0x5f,
+  0x6e, 0xc0, 0xaf, 0xc8, 0xc4, 0xa0, 0xa4, 0x8a, 0xad, 0xf5, 0x1c, 0xe5,
+  0x57, 0xe8, 0x1a, 0x03, 0xc5, 0x11, 0x47, 0xc2, 0xa5, 0xe7, 0xbe, 0x95,
+  0xcd, 0x8c, 0xf0, 0x85, 0xb5, 0xcf, 0x49, 0x40, 0x14, 0x0a, 0xb9, 0x45,
+  0x8c, 0xbd, 0xe3, 0xb4, 0x1a, 0xf7, 0xcf, 0x77, 0x68, 0x11, 0x60, 0x06,
+  0xcc, 0x4b, 0x4a, 0x48, 0x58, 0x0f, 0x37, 0x52, 0xb8, 0x9c, 0xdd, 0x8a,
+  0x44, 0xc1, 0xc3, 0xaf, 0x61, 0x56, 0x73, 0x64, 0x92, 0x3c, 0xda, 0xa6,
+  0x2a, 0x51, 0x8e, 0x1a, 0x90, 0x65, 0x45, 0x48, 0xf0, 0xeb, 0xb5, 0x4f,
+  0xd2, 0xb0, 0x16, 0xc5, 0x0f, 0xb3, 0x5b, 0x4d, 0x1d, 0x4e, 0x99, 0xb0,
+  0xd9, 0x66, 0x8a, 0xe9, 0x21, 0xad, 0x5d, 0x05, 0xa2, 0x34, 0x5c, 0xde,
+  0xe6, 0xd2, 0x8e, 0x20, 0xbd, 0x3a, 0x2b, 0x27, 0xcd, 0xaa, 0x79, 0x50,
+  0x78, 0x77, 0x0a, 0x62, 0xab, 0xe3, 0xe9, 0xb0, 0x32, 0x79, 0xa5, 0x06,
+  0xb8, 0x1a, 0x32, 0x3d, 0xfc, 0xa5, 0x5d, 0x02, 0x04, 0xa0, 0x46, 0xef,
+  0xb1, 0x92, 0xfc, 0x64, 0x67, 0x06, 0x2c, 0x22, 0xbc, 0x42, 0x28, 0xfc,
+  0x41, 0xce, 0x1a, 0xfc, 0xf1, 0xcf, 0xbd, 0xce, 0x5a, 0xc3, 0x3d, 0xf1,
+  0xaf, 0x9f, 0x36, 0xac, 0xcc, 0xa7, 0x1e, 0x30, 0x7d, 0x30, 0x1e, 0xd2,
+  0x13, 0x97, 0x38, 0x9d, 0x75, 0x3f, 0x0f, 0x9d, 0xa0, 0x07, 0x47, 0xb7,
+  0xa3, 0x33, 0xbc, 0xb2, 0x2a, 0x23, 0x24, 0x73, 0x01, 0x51, 0xb1, 0xf0,
+  0xf2, 0x80, 0xef, 0x0f, 0x22, 0xf8, 0xab, 0x3a, 0x98, 0xe8, 0x97, 0xfa,
+  0x5d, 0xdb, 0x86, 0x85, 0x25, 0x0e, 0xe8, 0x89, 0xb0, 0xba, 0x0b, 0x8c,
+  0x83, 0x95, 0x6f, 0x4d, 0x4a, 0x6d, 0xe7, 0x3f, 0x8e, 0x6e, 0xa5, 0xc6,
+  0xb0, 0x25, 0x40, 0x67, 0x70, 0xd0, 0xb8, 0x16, 0x1b, 0xb9, 0x6c, 0x57,
+  0x9c, 0x15, 0x82, 0x4c, 0xe4, 0xda, 0x09, 0x22, 0x90, 0x83, 0x8f, 0xd8,
+  0x19, 0x65, 0x55, 0x18, 0x34, 0x66, 0x09, 0x50, 0xbd, 0xc4, 0x9a, 0xe9,
+  0x7a, 0x26, 0xd7, 0x38, 0x0f, 0x30, 0x27, 0xc3, 0xf6, 0x01, 0x50, 0xd3,
+  0x58, 0xe2, 0x59, 0xf4, 0x44, 0xe6, 0x02, 0x24, 0xe8, 0x70, 0x1d, 0xc8,
+  0xb4, 0x4a, 0x6a, 0x10, 0xe7, 0x8f, 0x07, 0x21, 0x23, 0xaf, 0x9d, 0xf8,
+  0x6f, 0xfb, 0x65, 0x84, 0x9a, 0xc4, 0x7b, 0xe7, 0x32, 0xde, 0x7c, 0xbc,
+  0xe8, 0xb9, 0x6c, 0xd1, 0x3c, 0xb8, 0x51, 0xaa, 0x61, 0x83, 0xc4, 0x25,
+  0x96, 0x52, 0xd6, 0x8c, 0x63, 0x40, 0x13, 0xbb, 0x92, 0x56, 0x1a, 0x12,
+  0xde, 0x3f, 0x19, 0xcc, 0x60, 0x0b, 0xfe, 0xca, 0xfe, 0x32, 0x85, 0xf0,
+  0xa5, 0x47, 0x16, 0xa8, 0x64, 0x33, 0x6e, 0x1a, 0xdd, 0x17, 0xd4, 0xac,
+  0xfa, 0xbc, 0x2b, 0x24, 0x4a, 0x21
+};
+unsigned int encrypted_eax_10k_gpg_len = 10182;
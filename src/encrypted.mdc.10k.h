@@ -0,0 +1,681 @@
+unsigned char encrypted_mdc_10k_gpg[] = {
+  0x8c, 0x0d, 0x04, 0x03, 0x03, 0x02, 0x94, 0xdf, 0x23, 0x79, 0xdc, 0xbb,
+  0xa1, 0x31, 0xff, 0xd2, 0xde, 0xec, 0x01, 0xf8, 0xce, 0xbe, 0xd9, 0xcf,
+  0x6f, 0x37, 0xd5, 0xeb, 0x5d, 0x92, 0xe7, 0x45, 0x54, 0xb6, 0xfc, 0xa2,
+  0x2e, 0x31, 0x0f, 0x1b, 0xc5, 0x61, 0x24, 0x0e, 0xff, 0xb7, 0xce, 0x47,
+  0x9e, 0xeb, 0x01, 0x33, 0x4f, 0xcf, 0x61, 0xff, 0xac, 0x58, 0x9e, 0xc7,
+  0xb9, 0xd7, 0xd3, 0xb5, 0x09, 0x68, 0xaa, 0x31, 0x21, 0x93, 0x12, 0x4a,
+  0xe8, 0x80, 0xb5, 0x71, 0xd7, 0x80, 0x68, 0xc2, 0x05, 0x68, 0x44, 0x27,
+  0xf1, 0xba, 0xa3, 0x4b, 0x89, 0x9e, 0x35, 0x2b, 0xf2, 0xf9, 0x17, 0xba,
+  0xf9, 0x7b, 0x83, 0xd6, 0x5f, 0x5a, 0xee, 0x45, 0xd5, 0x04, 0x40, 0x31,
+  0xef, 0x78, 0x40, 0x54, 0x99, 0xd9, 0xb9, 0x49, 0x64, 0xd5, 0x61, 0xc9,
+  0x9f, 0x1e, 0x74, 0x9a, 0xa9, 0xb6, 0xd9, 0x21, 0x46, 0xde, 0xb0, 0x30,
+  0xe7, 0x48, 0x75, 0x42, 0x40, 0x7c, 0x4f, 0xe8, 0x08, 0x66, 0x3a, 0xee,
+  0x39, 0x40, 0x3e, 0x4c, 0xcf, 0x09, 0x6d, 0x31, 0x10, 0xd5, 0x10, 0x75,
+  0x03, 0xbe, 0x42, 0x28, 0x27, 0x08, 0xe9, 0xad, 0x98, 0x42, 0x1f, 0x56,
+  0x22, 0xdd, 0xb6, 0x37, 0xb7, 0xac, 0x65, 0x22, 0x2d, 0xc9, 0xea, 0xd7,
+  0x77, 0xf7, 0x93, 0x49, 0x74, 0x94, 0x41, 0x83, 0x6f, 0x99, 0xfa, 0x43,
+  0x3f, 0x69, 0x69, 0x96, 0x70, 0xf8, 0xfa, 0xe5, 0x82, 0xae, 0x7b, 0xb1,
+  0x3d, 0xce, 0x5f, 0x12, 0x3e, 0x57, 0x1e, 0xf6, 0x46, 0x91, 0xb7, 0x82,
+  0x49, 0xe3, 0xec, 0xd8, 0x4c, 0xe8, 0x86, 0xd1, 0xe9, 0x05, 0xc1, 0x3f,
+  0x69, 0x96, 0x24, 0x69, 0x21, 0x21, 0x44, 0xcb, 0x19, 0x50, 0x3b, 0xc7,
+  0x16, 0x68, 0xde, 0xcc, 0x51, 0x8c, 0xb7, 0x76, 0xf8, 0x47, 0xe8, 0xea,
+  0x7b, 0x96, 0xd6, 0x99, 0x5b, 0xce, 0xcc, 0x60, 0xdc, 0x72, 0xd4, 0x55,
+  0x14, 0x9e, 0xa8, 0x16, 0x90, 0xbe, 0x83, 0x03, 0xdb, 0xf5, 0x31, 0x13,
+  0x4c, 0x5b, 0xe1, 0xfb, 0x12, 0x03, 0x27, 0xb1, 0x14, 0x80, 0x3d, 0x70,
+  0x3a, 0x6a, 0xa4, 0xff, 0x9b, 0x59, 0xba, 0xad, 0xca, 0xd6, 0x0e, 0x0e,
+  0x90, 0xd0, 0xc3, 0xa7, 0x65, 0x43, 0x6e, 0xc9, 0x66, 0xe6, 0xa7, 0x54,
+  0x5c, 0x07, 0x69, 0x5e, 0xe5, 0xc4, 0x55, 0xf9, 0x5f, 0xaf, 0x19, 0x01,
+  0x9b, 0x59, 0xc8, 0x38, 0x13, 0x77, 0xd5, 0x94, 0x96, 0x4c, 0xfc, 0xfc,
+  0xc7, 0x3e, 0x01, 0x14, 0x8f, 0x81, 0xe4, 0x37, 0x8c, 0x9c, 0x0b, 0x22,
+  0x63, 0x2e, 0x9b, 0x8f, 0x25, 0x80, 0x08, 0xf4, 0x0c, 0x91, 0xb4, 0xd3,
+  0xf5, 0xb7, 0xcd, 0xf7, 0x4d, 0x61, 0x9f, 0x64, 0x1e, 0x20, 0x7c, 0x95,
+  0x4c, 0xb5, 0x3d, 0x20, 0xed, 0xd4, 0x94, 0x34, 0x0b, 0x88, 0x33, 0x52,
+  0x1a, 0x41, 0x21, 0x28, 0x5d, 0x64, 0x06, 0xf5, 0x4f, 0x5f, 0xea, 0xbe,
+  0xed, 0xe2, 0x74, 0x23, 0x8f, 0x25, 0x4d, 0xa7, 0x22, 0x61, 0xfc, 0xe9,
+  0x9a, 0x04, 0x5d, 0x71, 0xca, 0xd8, 0xea, 0x0c, 0xc7, 0x12, 0x0d, 0x88,
+  0xdb, 0x02, 0xc7, 0x86, 0x34, 0x1e, 0xcf, 0xd2, 0xb9, 0x0c, 0x8a, 0xc3,
+  0xbd, 0x5b, 0x5b, 0xd5, 0x82, 0x2d, 0x3c, 0x54, 0xba, 0x37, 0xbc, 0xef,
+  0xcc, 0x7e, 0xdd, 0xad, 0xdd, 0x8d, 0x17, 0x61, 0x1f, 0x67, 0x1b, 0x7a,
+  0xf8, 0x66, 0xb7, 0x45, 0xe9, 0x74, 0xd4, 0xa8, 0x27, 0xac, 0x71, 0xec,
+  0x5a, 0x2a, 0x69, 0x64, 0xf1, 0x38, 0xd0, 0xd3, 0x7c, 0xfa, 0x6f, 0x61,
+  0x54, 0x70, 0x9c, 0x4a, 0x73, 0xb0, 0x4f, 0x0e, 0x9e, 0xff, 0x14, 0xe3,
+  0xe8, 0x8a, 0x34, 0x5c, 0x1c, 0x64, 0x19, 0xa2, 0x4d, 0xe1, 0x4e, 0x3f,
+  0xa7, 0xf5, 0x27, 0x20, 0x77, 0xfa, 0x1d, 0xc5, 0x02, 0x78, 0x01, 0xa6,
+  0xbd, 0x86, 0x61, 0x68, 0x9d, 0xab, 0x6d, 0x23, 0xdb, 0xa8, 0xee, 0x8a,
+  0x9d, 0x92, 0x64, 0x5a, 0x63, 0x1f, 0xa6, 0xe3, 0x5c, 0x94, 0x69, 0xce,
+  0x91, 0xa7, 0x03, 0x1e, 0xc8, 0xea, 0xaa, 0x3e, 0xaf, 0xe9, 0xdc, 0xb7,
+  0x8a, 0xb8, 0x7e, 0xeb, 0x08, 0xff, 0xf7, 0x6b, 0x2c, 0x6b, 0x63, 0x2f,
+  0x58, 0x94, 0x78, 0xcd, 0x66, 0x52, 0x37, 0xc8, 0x98, 0x23, 0x91, 0x08,
+  0x8f, 0x8a, 0x8a, 0xf0, 0xee, 0x3a, 0x74, 0xca, 0x89, 0x9c, 0xa2, 0xf0,
+  0x1c, 0x6a, 0xff, 0x37, 0x11, 0xeb, 0xf9, 0x43, 0xf9, 0x0b, 0xaf, 0xd6,
+  0xcb, 0x54, 0x2c, 0x24, 0x38, 0xc5, 0x24, 0xd0, 0x9c, 0x0d, 0x74, 0xc0,
+  0xc2, 0xf6, 0xea, 0x6a, 0x36, 0xae, 0xfc, 0x29, 0x70, 0xb2, 0x99, 0x23,
+  0x06, 0x21, 0x66, 0xd2, 0x26, 0xe9, 0x63, 0x1c, 0xc0, 0x7e, 0x8c, 0xb6,
+  0x2b, 0xf1, 0xef, 0xb2, 0xac, 0x23, 0x33, 0x87, 0xed, 0x83, 0xbb, 0xdf,
+  0xc2, 0xe9, 0xa4, 0x7b, 0x28, 0xbf, 0xef, 0xbd, 0x95, 0x0c, 0x8b, 0x86,
+  0x3e, 0x1d, 0xf9, 0x89, 0x03, 0x82, 0x9f, 0x0b, 0x43, 0x4a, 0x8f, 0xa0,
+  0x25, 0x34, 0xca, 0x55, 0x79, 0x3a, 0x89, 0x62, 0xdb, 0xe1, 0x25, 0x4a,
+  0xe0, 0x16, 0xd3, 0x73, 0x76, 0x71, 0x0f, 0x54, 0x76, 0xc9, 0xbf, 0x54,
+  0x60, 0xe7, 0x6e, 0x5b, 0x8e, 0x8b, 0x95, 0x37, 0x49, 0xbb, 0xa7, 0x84,
+  0x97, 0x44, 0x3d, 0xe8, 0xa1, 0x60, 0xe8, 0x26, 0x3e, 0x7f, 0x25, 0x04,
+  0xa1, 0x70, 0x98, 0xe2, 0x4d, 0x08, 0xc8, 0xfd, 0x18, 0x0a, 0x9e, 0x8a,
+  0x56, 0x1a, 0x58, 0x54, 0x29, 0x97, 0xef, 0xdc, 0xf0, 0xe2, 0xb6, 0x91,
+  0x1d, 0x40, 0xf9, 0x85, 0x12, 0xd6, 0x02, 0x4b, 0x5c, 0x69, 0x4b, 0x34,
+  0xd2, 0x08, 0xc0, 0x33, 0x21, 0x9d, 0xd1, 0xc4, 0xdb, 0x9e, 0xe5, 0x00,
+  0x65, 0xf5, 0xf2, 0x05, 0x53, 0xf0, 0xe7, 0xd0, 0xfb, 0x4d, 0x06, 0x0d,
+  0xd9, 0x3f, 0x96, 0xd5, 0xba, 0x0e, 0x21, 0x8d, 0x4c, 0x43, 0xbc, 0x0d,
+  0x36, 0xad, 0xda, 0xa5, 0x65, 0xb0, 0x91, 0x37, 0x6f, 0x5a, 0xe9, 0xdb,
+  0x15, 0x90, 0x5f, 0x0d, 0x4f, 0x6b, 0xea, 0x8e, 0xfd, 0xf8, 0x85, 0x64,
+  0xae, 0x98, 0xc0, 0x13, 0x15, 0x1d, 0xf7, 0x51, 0x6e, 0x68, 0x99, 0x91,
+  0x7e, 0x61, 0xef, 0xb9, 0x02, 0xa3, 0x54, 0x9e, 0x1b, 0x09, 0xe8, 0xc0,
+  0x32, 0x75, 0x41, 0x98, 0x15, 0x71, 0x1c, 0x8a, 0xd9, 0x04, 0x80, 0x2c,
+  0xe2, 0xee, 0x2e, 0x06, 0x75, 0xb6, 0x69, 0x23, 0x86, 0xd4, 0x99, 0x4a,
+  0x6b, 0xc5, 0x9b, 0x4a, 0x4d, 0x00, 0xef, 0x05, 0x17, 0xf3, 0x4f, 0xcb,
+  0xaa, 0x3d, 0x05, 0x2a, 0xfb, 0xb3, 0x05, 0x59, 0x15, 0xd7, 0x3e, 0x6c,
+  0x83, 0x05, 0x48, 0x11, 0x31, 0x9d, 0x1d, 0x49, 0x09, 0x13, 0x05, 0x0c,
+  0x8a, 0xd1, 0xbd, 0xb7, 0x4d, 0xfa, 0xc2, 0x84, 0x64, 0xb1, 0x72, 0xd3,
+  0xc9, 0xad, 0xf6, 0xad, 0x11, 0x60, 0x53, 0x23, 0xfe, 0xe0, 0xc4, 0x61,
+  0x59, 0xcb, 0x89, 0x5e, 0xec, 0x20, 0x58, 0xef, 0xe3, 0x8a, 0x83, 0x21,
+  0xb7, 0x6c, 0x0d, 0x71, 0x85, 0x97, 0x10, 0x23, 0x7d, 0x14, 0x5d, 0xc0,
+  0x27, 0x6c, 0x9d, 0x44, 0x3c, 0xa8, 0x58, 0x17, 0x76, 0xe2, 0x49, 0x4f,
+  0xa6, 0x20, 0x2c, 0xdd, 0xae, 0x33, 0x0c, 0xa7, 0x1b, 0x0f, 0x98, 0x42,
+  0xab, 0xc2, 0xe0, 0xd3, 0xa2, 0x58, 0x2e, 0xaa, 0x34, 0x8a, 0x23, 0xec,
+  0x83, 0x5e, 0x4b, 0xc6, 0x7c, 0x25, 0xb8, 0x7b, 0x9c, 0x5a, 0xb1, 0xa0,
+  0xf4, 0xdf, 0x67, 0x44, 0xb5, 0x38, 0xb4, 0x9b, 0x42, 0xc6, 0x4d, 0xbe,
+  0x98, 0x0c, 0x84, 0x06, 0xc6, 0xf8, 0xbf, 0x75, 0x4e, 0xfe, 0xa9, 0x37,
+  0x12, 0xf8, 0x38, 0x69, 0xdc, 0xd8, 0x1d, 0x04, 0x22, 0x28, 0xfa, 0x35,
+  0xbf, 0x14, 0xec, 0x76, 0xda, 0x80, 0xda, 0xc7, 0x20, 0x66, 0x68, 0x88,
+  0xf6, 0x68, 0x12, 0x8f, 0xed, 0xf1, 0x7f, 0xe0, 0x6f, 0x82, 0xa6, 0xe4,
+  0xa7, 0x45, 0xe7, 0x3e, 0xb8, 0x2c, 0x95, 0xee, 0xe0, 0xf8, 0x03, 0xdb,
+  0x47, 0xda, 0xc8, 0x84, 0x58, 0x00, 0xff, 0x4a, 0xb2, 0xfc, 0x4e, 0x94,
+  0x0a, 0x05, 0x32, 0x73, 0x30, 0xb6, 0x91, 0xac, 0xe0, 0xa8, 0xca, 0x64,
+  0x53, 0xdd, 0x82, 0x9e, 0xda, 0x0c, 0xa3, 0xcf, 0xde, 0x87, 0x0c, 0xf9,
+  0xb9, 0x9c, 0xeb, 0xa3, 0x22, 0xa1, 0x69, 0x4b, 0x37, 0x11, 0xe4, 0x38,
+  0x01, 0xb5, 0xc7, 0x8f, 0x54, 0x81, 0x64, 0x47, 0xd1, 0x9e, 0xf4, 0x64,
+  0x54, 0xf3, 0x56, 0x84, 0x76, 0x18, 0x61, 0xd9, 0xb4, 0x19, 0x4a, 0x12,
+  0xae, 0x22, 0x19, 0xa0, 0x34, 0xf2, 0xda, 0x4a, 0xb3, 0xd4, 0xce, 0xf8,
+  0x56, 0x07, 0xb9, 0xf9, 0x06, 0xa9, 0xd0, 0x67, 0x46, 0xcf, 0xa3, 0x40,
+  0x20, 0x57, 0xd8, 0x18, 0xea, 0x18, 0xf4, 0x36, 0x57, 0x5f, 0x51, 0x7e,
+  0x36, 0xe0, 0x41, 0xc6, 0x44, 0xd7, 0x3f, 0x8b, 0x57, 0x90, 0xec, 0x0c,
+  0xb1, 0xc0, 0x5a, 0xbf, 0xc8, 0x8e, 0x6d, 0x2f, 0x52, 0x8c, 0xfa, 0x73,
+  0x37, 0x78, 0x16, 0xce, 0x88, 0xce, 0x47, 0x31, 0x47, 0x5b, 0x55, 0x47,
+  0xe0, 0x94, 0xec, 0xf4, 0x50, 0xd8, 0xc4, 0x10, 0xaf, 0x66, 0xc7, 0x6b,
+  0x0b, 0x35, 0xef, 0x24, 0x0b, 0x51, 0xff, 0x22, 0x46, 0xbf, 0x31, 0xbb,
+  0x68, 0x59, 0xf3, 0xbf, 0x93, 0xa9, 0x97, 0xf4, 0xf2, 0x64, 0x8d, 0xad,
+  0xa1, 0xa2, 0x1e, 0xed, 0xd3, 0x9d, 0x8e, 0x57, 0x4f, 0xef, 0x40, 0x19,
+  0xb7, 0xb4, 0x2b, 0x6d, 0xc1, 0xd9, 0x10, 0xb2, 0x5a, 0x1b, 0x1f, 0x55,
+  0xaa, 0x6c, 0x13, 0xa2, 0x25, 0xd2, 0x91, 0x8b, 0xf0, 0xe8, 0x92, 0x32,
+  0xa6, 0x5b, 0xb5, 0x64, 0xa3, 0x37, 0x44, 0x6b, 0x41, 0xf9, 0x35, 0xf4,
+  0x8f, 0xe3, 0x28, 0xc9, 0xf2, 0xee, 0xe3, 0x59, 0x77, 0x69, 0x95, 0x14,
+  0xbc, 0x26, 0x49, 0xe7, 0x85, 0x17, 0x80, 0x09, 0x2a, 0x19, 0x1f, 0x75,
+  0x94, 0xae, 0x2e, 0x71, 0xff, 0x78, 0x84, 0xe9, 0x17, 0xcd, 0x2c, 0x5e,
+  0xb4, 0x17, 0xab, 0x92, 0x81, 0xbe, 0xdc, 0xcb, 0xd5, 0x58, 0x5b, 0xb6,
+  0x3e, 0xe6, 0xc5, 0x06, 0x31, 0xa4, 0x80, 0x79, 0xb4, 0x87, 0xcf, 0xc7,
+  0x43, 0xf5, 0xd4, 0x9c, 0xac, 0x1b, 0x80, 0xfd, 0x9a, 0x31, 0x6b, 0x24,
+  0x66, 0x13, 0xfc, 0x90, 0x5b, 0x5a, 0x36, 0xfb, 0xf2, 0x77, 0x4f, 0x77,
+  0xb3, 0x53, 0x85, 0xf2, 0x1e, 0xf2, 0x8f, 0x49, 0xd0, 0x60, 0xde, 0xf9,
+  0x67, 0x30, 0xba, 0x8c, 0x76, 0xc1, 0x76, 0x3e, 0x88, 0xe9, 0xa2, 0x94,
+  0x5f, 0xc5, 0x24, 0xe4, 0xfd, 0xcc, 0x29, 0x51, 0xec, 0xf6, 0xd5, 0x3e,
+  0x59, 0x4a, 0xb5, 0x16, 0xe5, 0x90, 0x61, 0x0b, 0x53, 0x85, 0x9e, 0x7a,
+  0xb8, 0x0c, 0xd6, 0x80, 0xbf, 0x70, 0xe9, 0x08, 0xe3, 0xa3, 0x59, 0xe3,
+  0x73, 0x30, 0x71, 0x50, 0xe2, 0xd5, 0xc0, 0x3f, 0x78, 0x57, 0xf2, 0xaf,
+  0x6c, 0xe5, 0xbb, 0x46, 0xe7, 0x9c, 0xc2, 0x54, 0x5d, 0x6c, 0x41, 0x7d,
+  0xba, 0x56, 0x2a, 0xcb, 0x32, 0x7a, 0x4c, 0xd5, 0xbd, 0x78, 0xf2, 0xf0,
+  0xff, 0xa7, 0xad, 0xe8, 0xb7, 0xf5, 0xf8, 0xec, 0xc2, 0x8c, 0xac, 0xad,
+  0x2a, 0x5f, 0xf5, 0x3c, 0x08, 0xa5, 0x7d, 0xeb, 0xc2, 0xa6, 0x64, 0x50,
+  0x0b, 0xc2, 0xec, 0x53, 0xf5, 0xbd, 0x96, 0x26, 0x41, 0x59, 0x06, 0xe6,
+  0xc2, 0x27, 0x79, 0x64, 0x84, 0x66, 0x5f, 0x0f, 0xd2, 0xd3, 0x7d, 0x88,
+  0x83, 0x2b, 0x16, 0x23, 0x92, 0xc9, 0xe5, 0x64, 0xdf, 0x29, 0x65, 0xde,
+  0xba, 0xfd, 0xaa, 0x39, 0xe7, 0xb7, 0xd7, 0x49, 0x7f, 0xfa, 0xc1, 0xf3,
+  0xa2, 0x4a, 0x95, 0xb9, 0x4f, 0xf2, 0x0f, 0x9c, 0x86, 0x61, 0xc5, 0xb2,
+  0x27, 0x9e, 0x5e, 0x9d, 0xf9, 0x3f, 0xee, 0x70, 0xa1, 0x34, 0x20, 0x35,
+  0xec, 0xb3, 0xb6, 0x36, 0x16, 0x49, 0x8e, 0xeb, 0x5d, 0xef, 0x02, 0xc3,
+  0x8c, 0x73, 0xf8, 0xbe, 0x2f, 0x7d, 0xa8, 0xab, 0xcd, 0x68, 0xe0, 0x99,
+  0xd6, 0x4f, 0xa3, 0xe6, 0x06, 0x3f, 0x09, 0x5a, 0xc2, 0xb6, 0x56, 0xbb,
+  0x3e, 0x8f, 0xda, 0xaf, 0x3a, 0x3f, 0x75, 0xb9, 0x4e, 0xdf, 0x37, 0xfb,
+  0xdc, 0x60, 0xe4, 0x6f, 0xbd, 0xe5, 0xeb, 0x3f, 0x45, 0x62, 0x64, 0x15,
+  0xe7, 0x4a, 0x66, 0xc6, 0xfc, 0x35, 0x34, 0x18, 0x39, 0x56, 0xa8, 0xf7,
+  0xb5, 0x02, 0x69, 0x5c, 0x4d, 0xd6, 0xa8, 0x01, 0xfd, 0x0c, 0x83, 0x47,
+  0xc5, 0x7a, 0xad, 0x80, 0xdb, 0xbe, 0x83, 0x58, 0xc2, 0xfc, 0x4b, 0x36,
+  0xc9, 0x0e, 0x3d, 0x29, 0xf2, 0x3f, 0xf0, 0x52, 0x9b, 0xde, 0x14, 0xb3,
+  0xf9, 0xa8, 0x39, 0x73, 0x5a, 0xd3, 0xc9, 0x8c, 0x32, 0x9f, 0x69, 0xe1,
+  0x86, 0x4d, 0x4f, 0x28, 0x7b, 0xe2, 0xca, 0xcb, 0xce, 0xfe, 0xd9, 0xe5,
+  0xd7, 0xb0, 0x52, 0xdb, 0x50, 0x77, 0xe9, 0x23, 0x93, 0xf9, 0xe2, 0x64,
+  0x7d, 0xb5, 0xf5, 0xac, 0x95, 0x12, 0x1a, 0x46, 0x34, 0xe0, 0x32, 0xd8,
+  0xad, 0x6a, 0xe9, 0xf7, 0x29, 0x3a, 0x9f, 0xe3, 0x2d, 0x30, 0x07, 0xf0,
+  0x68, 0x41, 0x86, 0xe8, 0x64, 0x15, 0x95, 0xdb, 0xb6, 0x29, 0x6d, 0x8f,
+  0xb7, 0x20, 0xe6, 0x09, 0x38, 0x33, 0x24, 0x49, 0xfb, 0x42, 0x46, 0xa6,
+  0x9d, 0x83, 0x7f, 0xd2, 0xd7, 0xab, 0x03, 0x3d, 0x0a, 0x10, 0xce, 0x1d,
+  0xfc, 0xe0, 0x97, 0x93, 0x47, 0x2b, 0xd1, 0x68, 0x27, 0x13, 0xd3, 0xc2,
+  0x09, 0xd3, 0x20, 0xc6, 0x4c, 0xbd, 0xe2, 0xf0, 0xa4, 0x1e, 0x0d, 0xca,
+  0x2b, 0x30, 0x68, 0x27, 0x6a, 0x1f, 0x15, 0xd1, 0x9a, 0x70, 0x26, 0xfa,
+  0x21, 0xef, 0x02, 0x3e, 0xbe, 0x28, 0x1f, 0x9f, 0x1c, 0x43, 0x6b, 0x35,
+  0xff, 0x6a, 0x7e, 0xa1, 0xb1, 0xc8, 0xb3, 0xb8, 0x8a, 0xd4, 0x69, 0x95,
+  0xb4, 0x6e, 0x1c, 0xe7, 0x81, 0xb3, 0x45, 0xfa, 0x46, 0x8e, 0xb0, 0x73,
+  0xd2, 0x58, 0x23, 0x25, 0xbe, 0xd4, 0x4c, 0x21, 0x86, 0xef, 0x14, 0x6d,
+  0x21, 0x40, 0xff, 0x49, 0x8d, 0x35, 0x74, 0x3f, 0xe8, 0xf2, 0xd2, 0x0f,
+  0x47, 0x0b, 0xc6, 0x73, 0x7d, 0x32, 0x6b, 0x33, 0x97, 0x66, 0xde, 0x56,
+  0xb5, 0xbf, 0x7f, 0x6d, 0x27, 0x77, 0x71, 0x1d, 0xfb, 0x55, 0xba, 0x77,
+  0xb2, 0xa7, 0x35, 0x95, 0x56, 0x57, 0xd5, 0x3a, 0x8f, 0xfd, 0x6d, 0x35,
+  0xac, 0xd8, 0x86, 0xde, 0x69, 0x0f, 0x47, 0xb0, 0xa4, 0xb2, 0x44, 0x39,
+  0x37, 0x91, 0x33, 0x42, 0x4c, 0xf6, 0xf7, 0x85, 0xdb, 0x1f, 0x21, 0x70,
+  0x7b, 0x63, 0x57, 0xf2, 0x20, 0xe5, 0x60, 0x4d, 0x5e, 0xc2, 0xde, 0xb3,
+  0x7d, 0xc8, 0x21, 0x47, 0xf9, 0x3b, 0xf0, 0x89, 0xaf, 0x72, 0x65, 0x04,
+  0xcb, 0xd0, 0x69, 0x19, 0x03, 0x93, 0x17, 0xf2, 0xc6, 0x92, 0xd9, 0xcc,
+  0x4a, 0x96, 0xef, 0x1e, 0x9d, 0xb5, 0x64, 0x54, 0xfc, 0xbb, 0x87, 0x05,
+  0x00, 0xc4, 0xfd, 0x45, 0x18, 0x70, 0x11, 0x90, 0x4e, 0x7c, 0x8c, 0x9c,
+  0xe6, 0xcf, 0x45, 0x21, 0xc3, 0x91, 0xce, 0xf4, 0xf1, 0xc0, 0x3c, 0xa3,
+  0x66, 0x10, 0xc8, 0x57, 0x2b, 0x47, 0x13, 0xe6, 0xc9, 0xc8, 0x59, 0xe6,
+  0x19, 0xfc, 0xa5, 0x0a, 0x5f, 0x11, 0xe4, 0x08, 0x98, 0xdb, 0x86, 0x97,
+  0x9e, 0x12, 0x12, 0x3d, 0x2a, 0x36, 0x40, 0x9f, 0x50, 0x47, 0x54, 0xb1,
+  0x90, 0x25, 0x51, 0x6b, 0xe0, 0x57, 0x8b, 0x8a, 0xac, 0x4e, 0xaa, 0x6b,
+  0xcb, 0x22, 0x94, 0x58, 0xe7, 0xf9, 0x2f, 0xa1, 0x4b, 0x6b, 0x29, 0xf3,
+  0xf2, 0xef, 0xfd, 0xb7, 0xba, 0xa4, 0x71, 0xa3, 0xae, 0x42, 0x74, 0xf6,
+  0x6c, 0x55, 0x92, 0x5b, 0x70, 0xac, 0xe8, 0x54, 0xf3, 0xad, 0xf7, 0xc2,
+  0x2a, 0x85, 0x69, 0xec, 0x55, 0x7c, 0xda, 0xcf, 0xa5, 0x70, 0x5b, 0xab,
+  0x90, 0x31, 0x1b, 0x89, 0x03, 0x9a, 0xb3, 0x23, 0x01, 0xd5, 0x14, 0x91,
+  0x7e, 0x70, 0x47, 0x6a, 0xb7, 0x29, 0x11, 0xec, 0xa4, 0xf9, 0x37, 0xa1,
+  0x11, 0x56, 0xc3, 0xa2, 0xbd, 0xcf, 0x75, 0xc3, 0x17, 0x26, 0xa4, 0x63,
+  0xbc, 0x10, 0xcd, 0xc6, 0x50, 0x51, 0xa7, 0xd1, 0xa3, 0x78, 0xba, 0x59,
+  0x2e, 0x16, 0x0b, 0x29, 0x27, 0x17, 0x33, 0x43, 0x4a, 0x39, 0x14, 0x6c,
+  0xc8, 0xf1, 0x62, 0xcf, 0x61, 0x20, 0xf1, 0x9c, 0xf3, 0x35, 0xf7, 0x8a,
+  0xbb, 0xb0, 0xbf, 0x15, 0x39, 0x70, 0xf8, 0xdd, 0xcb, 0xba, 0x2c, 0x7a,
+  0xed, 0x8a, 0xd5, 0xe7, 0xe4, 0xc6, 0xc5, 0x5b, 0x26, 0xb7, 0x4e, 0x63,
+  0xc2, 0xb1, 0xbb, 0x29, 0x12, 0x23, 0x0e, 0x64, 0x4f, 0x2c, 0x75, 0x36,
+  0x13, 0x85, 0xec, 0x8d, 0xa1, 0xec, 0x80, 0x35, 0x1b, 0x42, 0x5f, 0x6f,
+  0x18, 0x79, 0x6f, 0x0f, 0x52, 0xfc, 0x75, 0x1b, 0xea, 0xf2, 0xf3, 0x06,
+  0x14, 0x42, 0x63, 0x7b, 0x1d, 0x56, 0xa1, 0xe5, 0x3a, 0x43, 0x6b, 0xb0,
+  0x1a, 0x06, 0x68, 0xd9, 0x07, 0x65, 0xea, 0x00, 0xb1, 0x20, 0xb2, 0xe6,
+  0x55, 0x62, 0xaf, 0xc1, 0x79, 0x9b, 0x34, 0x02, 0x95, 0x0c, 0x59, 0x28,
+  0x48, 0x17, 0x4c, 0xf4, 0xb9, 0x10, 0xb2, 0xe3, 0xff, 0x7a, 0x34, 0x93,
+  0xa5, 0x17, 0x8e, 0xe1, 0x6b, 0xf2, 0x56, 0x0f, 0xfe, 0x92, 0xd5, 0x38,
+  0x8c, 0xd2, 0x9a, 0x91, 0xbc, 0xa6, 0x39, 0x36, 0x72, 0x63, 0x10, 0xc5,
+  0x2e, 0x13, 0x47, 0x72, 0xf8, 0xfe, 0x9d, 0x7f, 0x42, 0x74, 0xb8, 0xfd,
+  0x13, 0x93, 0x85, 0x9b, 0x74, 0x06, 0xd1, 0x16, 0x01, 0xdc, 0x7f, 0xe2,
+  0x12, 0x33, 0x9d, 0x82, 0x2e, 0xa8, 0xfd, 0xc0, 0x14, 0x11, 0xca, 0xd7,
+  0x24, 0xf5, 0x57, 0xce, 0xda, 0x76, 0xf9, 0xbf, 0x1f, 0x5e, 0x3e, 0xcb,
+  0x65, 0xf4, 0xb2, 0x56, 0x22, 0x05, 0xd6, 0x7e, 0x5a, 0x8b, 0xa0, 0x92,
+  0xb3, 0x49, 0xef, 0xea, 0xf3, 0x47, 0xe5, 0x5f, 0xfb, 0x1f, 0x19, 0x3a,
+  0xd6, 0x5e, 0xe4, 0xc7, 0x13, 0x14, 0x8f, 0x26, 0x52, 0x28, 0x14, 0x79,
+  0x05, 0xc0, 0xb7, 0x48, 0x9f, 0xd5, 0x9d, 0xde, 0xd5, 0x22, 0x34, 0x71,
+  0x23, 0xd7, 0x21, 0xeb, 0xe1, 0x0e, 0xb3, 0x28, 0xbd, 0xb7, 0xfa, 0xa0,
+  0x2a, 0x6a, 0xb0, 0x96, 0xb2, 0x9f, 0x1c, 0x0b, 0x06, 0x53, 0xd1, 0xe7,
+  0x68, 0x77, 0xfe, 0x19, 0xc5, 0xc9, 0x80, 0xf0, 0xff, 0x07, 0xd8, 0x88,
+  0x72, 0x69, 0xf3, 0x29, 0xb1, 0xb6, 0xca, 0xb7, 0xbf, 0x99, 0x39, 0xe2,
+  0xf0, 0xbf, 0xf5, 0x26, 0xdf, 0xdf, 0xb2, 0xf5, 0xea, 0x33, 0xd7, 0x0b,
+  0x0f, 0xd9, 0x8b, 0xcc, 0xa7, 0x29, 0xb0, 0x7e, 0x0d, 0xc6, 0x14, 0x8b,
+  0x67, 0x6c, 0xdd, 0xa0, 0xea, 0x7b, 0xa5, 0xdb, 0x9c, 0xf4, 0x3c, 0xe4,
+  0xfc, 0xa4, 0x70, 0x5c, 0x64, 0xe1, 0x80, 0x52, 0x31, 0x57, 0x21, 0x56,
+  0x61, 0xc8, 0x6b, 0x06, 0xac, 0x60, 0x36, 0x9a, 0x61, 0x26, 0xb1, 0x42,
+  0x66, 0x27, 0x0b, 0x90, 0x5e, 0xe6, 0xd2, 0x3c, 0x5e, 0x27, 0x0d, 0x6c,
+  0xb7, 0x42, 0x68, 0x1f, 0x08, 0xcc, 0xd6, 0xbf, 0x8d, 0x77, 0x15, 0x09,
+  0xb1, 0xda, 0x52, 0x47, 0x4e, 0x15, 0x25, 0x70, 0xbc, 0x8b, 0x33, 0x9a,
+  0xa7, 0x08, 0xf2, 0xeb, 0xf6, 0x38, 0x82, 0xa9, 0x18, 0x1a, 0xdd, 0x1d,
+  0x91, 0x54, 0x51, 0x30, 0x0b, 0x5f, 0xc7, 0x7c, 0x6e, 0x6d, 0x2d, 0x36,
+  0x08, 0xc7, 0xf7, 0x2e, 0x01, 0xba, 0x05, 0x08, 0x1e, 0xc8, 0xd3, 0x77,
+  0x87, 0x6c, 0x25, 0x53, 0xa4, 0xbe, 0xff, 0x06, 0x9e, 0x90, 0xa6, 0x4c,
+  0x18, 0x2d, 0x12, 0x27, 0x46, 0x25, 0x03, 0x64, 0x13, 0x60, 0xbf, 0x04,
+  0x21, 0x1c, 0x8a, 0x75, 0xfb, 0x2b, 0x15, 0x13, 0x8b, 0xa8, 0xe6, 0xcf,
+  0xd4, 0xe9, 0x24, 0xd0, 0xde, 0x81, 0x18, 0xf0, 0x00, 0xec, 0xce, 0xf6,
+  0xc2, 0x0b, 0xea, 0x13, 0xdd, 0xa3, 0xea, 0x37, 0x62, 0x47, 0x44, 0x6d,
+  0x61, 0xdb, 0x77, 0xff, 0x11, 0x4a, 0x17, 0xc2, 0xa3, 0x8e, 0xc8, 0xe6,
+  0xba, 0x25, 0xc8, 0x40, 0x3f, 0x78, 0x10, 0xb4, 0xd8, 0xe8, 0x88, 0x74,
+  0xc9, 0xf6, 0x24, 0x03, 0x63, 0xaa, 0x63, 0x5e, 0x1e, 0xb2, 0x57, 0x48,
+  0x87, 0x2f, 0xe5, 0xd2, 0x6e, 0x93, 0x69, 0x6e, 0xfc, 0x4e, 0x1d, 0x4c,
+  0xa8, 0xe9, 0xdc, 0x7d, 0x05, 0x36, 0xbc, 0x3e, 0xa3, 0xd7, 0x4b, 0x95,
+  0x75, 0xf5, 0x0c, 0x32, 0x1e, 0x39, 0xc6, 0xd1, 0xc3, 0x77, 0xb9, 0xc6,
+  0xc0, 0xd9, 0x26, 0x53, 0xd0, 0x6d, 0x25, 0x33, 0x91, 0xf4, 0x46, 0x19,
+  0x96, 0x5d, 0x14, 0xdd, 0xa9, 0x61, 0xc1, 0xbf, 0xc7, 0x1b, 0x53, 0xa9,
+  0x74, 0x6f, 0x8d, 0x38, 0x8a, 0xde, 0x9e, 0x30, 0x2d, 0x11, 0xc3, 0xc9,
+  0xc8, 0xa8, 0x18, 0x73, 0xb2, 0x24, 0xf1, 0x80, 0x44, 0x6d, 0xeb, 0x34,
+  0x71, 0x62, 0xc9, 0xb9, 0x52, 0xf0, 0xbc, 0xf9, 0x51, 0xf8, 0x5d, 0x94,
+  0xbb, 0x1e, 0x9c, 0xd3, 0x88, 0xc5, 0x3b, 0x1f, 0x7d, 0x5c, 0xd4, 0xf2,
+  0xe7, 0x71, 0xa9, 0x3d, 0x49, 0x2b, 0xb4, 0x98, 0x1a, 0x8e, 0x59, 0x05,
+  0xe6, 0xc9, 0x63, 0xac, 0x47, 0x31, 0x35, 0xc7, 0xfa, 0xa6, 0xfb, 0xc1,
+  0x31, 0x8a, 0xb5, 0x98, 0x9b, 0x80, 0xee, 0xa2, 0xbd, 0x66, 0x59, 0xf7,
+  0x3c, 0xa7, 0x5f, 0xfc, 0xb0, 0x42, 0x71, 0x1e, 0xad, 0x1d, 0xa9, 0x8a,
+  0x78, 0x57, 0xf9, 0xed, 0xe0, 0xf4, 0x4b, 0x4d, 0x7c, 0xb2, 0xf7, 0x38,
+  0x78, 0x2f, 0xd5, 0x73, 0xb4, 0xb2, 0x5d, 0xa9, 0xa6, 0x43, 0xa6, 0x83,
+  0x5e, 0x40, 0x44, 0xff, 0x53, 0x38, 0x6d, 0x29, 0x04, 0xa3, 0xdc, 0x9b,
+  0xae, 0x4c, 0x88, 0x7b, 0xd8, 0x0d, 0xcc, 0x15, 0x0a, 0xf6, 0x93, 0xcd,
+  0xcd, 0xe7, 0xf8, 0x0a, 0xe0, 0xb0, 0xdf, 0xe7, 0x22, 0x0f, 0xdd, 0x02,
+  0x98, 0x31, 0x4f, 0xce, 0x8c, 0x4b, 0xd3, 0x53, 0xc8, 0x59, 0x0b, 0xd2,
+  0x53, 0x1a, 0x11, 0x63, 0xf3, 0x07, 0x8d, 0xbb, 0x55, 0x3d, 0x75, 0x69,
+  0x26, 0x24, 0x76, 0x39, 0x50, 0x4d, 0xcf, 0xc6, 0x41, 0x8c, 0xd1, 0x5c,
+  0xb3, 0xe4, 0xcd, 0x80, 0x96, 0x64, 0xa7, 0x35, 0xff, 0x2e, 0x16, 0xf3,
+  0xc2, 0xe4, 0xdf, 0xbb, 0xf8, 0x83, 0x81, 0x99, 0x2c, 0xf0, 0x06, 0xcd,
+  0xbc, 0x45, 0x0a, 0x04, 0x67, 0x90, 0xbd, 0x83, 0xff, 0x02, 0xac, 0x9d,
+  0x48, 0xd4, 0xd6, 0x19, 0x4c, 0x48, 0x6d, 0xad, 0xf7, 0x0e, 0xc1, 0x64,
+  0xc2, 0xad, 0x72, 0xdf, 0x65, 0xc9, 0xa2, 0x4f, 0x0b, 0x4d, 0x5e, 0x90,
+  0xc3, 0x2e, 0x60, 0x59, 0x78, 0x24, 0x07, 0x54, 0x69, 0x71, 0xd1, 0xe2,
+  0xdb, 0x2f, 0x22, 0x59, 0xfc, 0x0a, 0xbf, 0xe8, 0x49, 0xe7, 0x6d, 0x5b,
+  0x53, 0xf8, 0xa8, 0x72, 0x56, 0xe7, 0xce, 0xfa, 0xa4, 0xe0, 0x11, 0x10,
+  0x24, 0x70, 0xe3, 0x06, 0xcb, 0xb6, 0x77, 0xfe, 0x3c, 0x91, 0x95, 0x8c,
+  0x6a, 0x1f, 0x7f, 0xaf, 0x9e, 0xdf, 0x8c, 0x0d, 0x82, 0xfa, 0x09, 0x69,
+  0x6d, 0xe6, 0x23, 0xc7, 0xbf, 0x2e, 0xaa, 0xc0, 0x88, 0x03, 0x25, 0xda,
+  0x2b, 0x50, 0xc6, 0xd1, 0x38, 0x33, 0x58, 0x97, 0xd0, 0x35, 0x6a, 0x08,
+  0x17, 0x40, 0x6f, 0x4f, 0xb0, 0x52, 0xe4, 0xa8, 0xb9, 0x3b, 0xa2, 0xc4,
+  0x27, 0x17, 0x87, 0x1b, 0x00, 0x70, 0xb5, 0x91, 0xad, 0x84, 0x9b, 0x44,
+  0x51, 0x17, 0xe7, 0x3a, 0xec, 0xf2, 0x8f, 0x91, 0x8a, 0x7d, 0xa8, 0x1b,
+  0x2c, 0xbc, 0x45, 0x1a, 0xb0, 0x26, 0x95, 0xc0, 0xcd, 0xe6, 0x7a, 0x5f,
+  0xc2, 0x43, 0xd8, 0x93, 0xbb, 0xf3, 0xc2, 0x41, 0x88, 0xe1, 0x2b, 0xc9,
+  0x31, 0x35, 0xa2, 0xa0, 0x2d, 0x75, 0x51, 0x6f, 0x99, 0x06, 0xa9, 0x3a,
+  0xfe, 0xc9, 0x11, 0x71, 0x13, 0xec, 0x70, 0xbf, 0x8f, 0xc4, 0x6d, 0x92,
+  0x1a, 0x0c, 0xd3, 0x2f, 0x4f, 0x4c, 0x7a, 0x32, 0x9c, 0xe5, 0xb7, 0x9f,
+  0x5a, 0xe9, 0xe2, 0xae, 0x4e, 0xf1, 0x5e, 0x63, 0xb2, 0xe8, 0x56, 0xd3,
+  0xe0, 0x81, 0xa2, 0x01, 0xd0, 0x64, 0xdc, 0xbe, 0x35, 0x7b, 0xf9, 0x32,
+  0xa2, 0x95, 0x15, 0x14, 0xc6, 0x22, 0xc8, 0xf1, 0x75, 0xe9, 0xd7, 0x8b,
+  0xce, 0x09, 0xb0, 0x4c, 0x8d, 0x0e, 0xf2, 0x4e, 0x25, 0x9c, 0xac, 0x40,
+  0x3c, 0x44, 0xea, 0x9d, 0xbc, 0x43, 0x05, 0xbc, 0x58, 0x60, 0x57, 0xe3,
+  0xe0, 0x8a, 0xd5, 0x61, 0xbe, 0xc5, 0x18, 0x01, 0x47, 0x49, 0x0b, 0x58,
+  0xe0, 0xd5, 0xae, 0xd0, 0x27, 0x34, 0x32, 0xb1, 0xb3, 0xd5, 0xb0, 0x06,
+  0xcc, 0x9a, 0x9b, 0xd7, 0x22, 0xa2, 0xa3, 0x43, 0x98, 0xdc, 0x8b, 0xb1,
+  0xd4, 0xd9, 0x96, 0xdf, 0x15, 0xa4, 0xb5, 0x34, 0x83, 0xd0, 0x6f, 0x61,
+  0xa5, 0x1f, 0x54, 0x5b, 0xaf, 0x4e, 0xb1, 0xc1, 0x05, 0x3d, 0x5e, 0x70,
+  0x8b, 0x6d, 0x58, 0x09, 0xba, 0x5d, 0xc9, 0x5d, 0x9c, 0xc7, 0x78, 0xa2,
+  0x55, 0x7d, 0xa2, 0x54, 0x81, 0xf7, 0xe0, 0x3b, 0xc1, 0x9f, 0xe1, 0x88,
+  0xd4, 0x6a, 0xba, 0xbd, 0x11, 0xf9, 0xd3, 0xfb, 0xc2, 0x85, 0xac, 0x77,
+  0xda, 0x25, 0x98, 0x47, 0xea, 0x4a, 0xb2, 0x3d, 0x47, 0x61, 0x4d, 0x25,
+  0x80, 0xf6, 0xfc, 0xe9, 0xba, 0x71, 0xa6, 0x91, 0x81, 0x7f, 0x72, 0x95,
+  0x68, 0xed, 0x3d, 0x3e, 0xb2, 0x59, 0xb1, 0x1c, 0x0f, 0xe0, 0x07, 0x3b,
+  0x55, 0x79, 0xea, 0xe0, 0xfb, 0x4d, 0x3b, 0x98, 0xb0, 0xfc, 0x81, 0xd7,
+  0xfa, 0x5e, 0xb6, 0xf3, 0x95, 0x16, 0x7a, 0x63, 0x00, 0x57, 0x27, 0xd7,
+  0x41, 0xe6, 0x23, 0xec, 0x5a, 0x20, 0x69, 0x64, 0x00, 0x9e, 0xb2, 0xad,
+  0x2e, 0x71, 0x1d, 0xde, 0x44, 0xb1, 0x42, 0xde, 0x2d, 0x40, 0x94, 0x73,
+  0x89, 0xa5, 0x8c, 0xe1, 0x45, 0xed, 0x97, 0x73, 0xfd, 0x39, 0xec, 0xd2,
+  0x40, 0x44, 0x8d, 0x82, 0x47, 0x15, 0x5a, 0x0f, 0xca, 0x41, 0x5d, 0xf6,
+  0x84, 0xa8, 0x25, 0xed, 0xb6, 0x41, 0x27, 0xc8, 0x3d, 0x9a, 0x80, 0x69,
+  0x51, 0xc0, 0xaf, 0x6c, 0x50, 0xd0, 0xb1, 0x85, 0x3e, 0x94, 0x19, 0x52,
+  0xa4, 0x0e, 0x9f, 0x84, 0x45, 0x56, 0xa5, 0x72, 0x04, 0x50, 0x07, 0x93,
+  0x2e, 0x86, 0xc9, 0xcd, 0xf5, 0x3f, 0xcc, 0x06, 0xcf, 0x31, 0x87, 0x9e,
+  0x89, 0x71, 0xfb, 0xe9, 0x1a, 0x83, 0x04, 0x6c, 0x4c, 0x54, 0x49, 0x14,
+  0xc0, 0x77, 0x2d, 0xfd, 0x69, 0x01, 0xc1, 0x68, 0x11, 0x80, 0x13, 0xac,
+  0xbb, 0xf8, 0x4a, 0xee, 0x67, 0xcd, 0x45, 0xbc, 0x29, 0xf1, 0x61, 0x8c,
+  0xeb, 0x8e, 0xcc, 0x2b, 0x0c, 0xcd, 0xed, 0xea, 0x5a, 0x07, 0x66, 0xe4,
+  0x17, 0xd0, 0x62, 0x7a, 0x78, 0x6f, 0xc6, 0x68, 0xf7, 0x2b, 0xdd, 0x36,
+  0xf9, 0x8f, 0x03, 0x88, 0x7c, 0xb3, 0x5b, 0xa3, 0x41, 0x7e, 0xf0, 0xea,
+  0x9a, 0x61, 0xf3, 0x3c, 0x2a, 0x15, 0x1d, 0xf7, 0xb4, 0xf3, 0x23, 0x9b,
+  0x69, 0x7a, 0xf2, 0x3f, 0x1c, 0xf8, 0xb4, 0xae, 0x2f, 0x83, 0x4c, 0x91,
+  0xed, 0x6b, 0xca, 0x97, 0x68, 0x0a, 0x25, 0x39, 0xd9, 0x14, 0x1c, 0x89,
+  0x5f, 0x62, 0xa3, 0x1d, 0x0c, 0x90, 0x25, 0x2a, 0xd3, 0x81, 0xfa, 0x6e,
+  0x63, 0x1b, 0xd8, 0x5a, 0x49, 0x53, 0xca, 0x45, 0xe9, 0x49, 0xe8, 0xbb,
+  0x37, 0x9c, 0x53, 0x6a, 0xb9, 0x72, 0x15, 0x6c, 0xe4, 0x70, 0xf3, 0x38,
+  0xc1, 0xe9, 0x94, 0xb4, 0x3c, 0x12, 0x51, 0x87, 0x3b, 0xbe, 0x76, 0x03,
+  0x27, 0x4b, 0x25, 0x26, 0xde, 0x49, 0x69, 0x41, 0xbe, 0x4c, 0xc1, 0xca,
+  0x99, 0x28, 0x95, 0x5b, 0x6d, 0x41, 0x3b, 0xdf, 0xae, 0x01, 0x0f, 0x67,
+  0x6e, 0xc6, 0x9b, 0x31, 0x1e, 0xd7, 0xc6, 0x12, 0x33, 0xc5, 0xee, 0x5c,
+  0x01, 0xf8, 0x35, 0x47, 0x5f, 0x35, 0x0d, 0x9e, 0x26, 0xf4, 0xb8, 0x1c,
+  0x94, 0xb7, 0x85, 0xca, 0xbb, 0x9a, 0xf1, 0x3a, 0x63, 0xfe, 0xce, 0x9b,
+  0x20, 0xcf, 0x63, 0x09, 0x11, 0xa2, 0x82, 0xe7, 0xe0, 0x11, 0x22, 0x74,
+  0x56, 0xec, 0x29, 0x60, 0xdb, 0xf2, 0x70, 0x3e, 0xbc, 0x0f, 0x2b, 0xab,
+  0x93, 0x72, 0xb3, 0xb5, 0x16, 0x00, 0xa6, 0xe5, 0x3b, 0x3c, 0x58, 0x1c,
+  0x96, 0xfe, 0xa1, 0x1f, 0x88, 0x2f, 0x0e, 0x97, 0x37, 0x44, 0xc5, 0x74,
+  0x29, 0x68, 0xa5, 0x22, 0x86, 0x8e, 0xd0, 0x69, 0x80, 0x5b, 0x23, 0xc3,
+  0x77, 0x64, 0x7e, 0x75, 0xe0, 0x3a, 0x38, 0x12, 0xde, 0xda, 0x75, 0xa7,
+  0x07, 0x78, 0x11, 0x64, 0x14, 0xd1, 0x0e, 0x52, 0xbb, 0x2f, 0xf8, 0xc9,
+  0x4e, 0x53, 0xd4, 0x81, 0x21, 0xf1, 0x0d, 0x6b, 0x92, 0xc8, 0xf2, 0x87,
+  0x72, 0x9a, 0xa1, 0x7c, 0x7c, 0x68, 0x49, 0x75, 0x08, 0xa1, 0xf7, 0x0a,
+  0xf4, 0xa1, 0x31, 0x4c, 0x73, 0x14, 0xc1, 0x31, 0x90, 0x95, 0xee, 0x79,
+  0x5d, 0x08, 0x9c, 0xe6, 0x73, 0x48, 0x71, 0x35, 0xbf, 0x06, 0x99, 0xdb,
+  0x14, 0xc3, 0x98, 0xab, 0x0b, 0x46, 0x01, 0xe6, 0xa7, 0x9b, 0x84, 0x6d,
+  0x8b, 0x35, 0xb3, 0x5f, 0xaa, 0x99, 0x86, 0xb9, 0x52, 0x88, 0xd9, 0xb0,
+  0xb5, 0x33, 0xbc, 0xde, 0x1d, 0xd6, 0x3d, 0xc3, 0x5b, 0x5c, 0x84, 0x92,
+  0x09, 0xa6, 0x6d, 0x5b, 0x07, 0x18, 0x98, 0x90, 0x7a, 0x50, 0x58, 0xaa,
+  0x26, 0xe9, 0xce, 0x08, 0x9e, 0xd0, 0xcc, 0xa2, 0x8f, 0x68, 0x7e, 0x9a,
+  0xeb, 0x9e, 0xd9, 0x4e, 0xf9, 0x49, 0xb3, 0x8f, 0x5f, 0x7e, 0x9a, 0x95,
+  0xfb, 0xe4, 0xb6, 0x22, 0x9d, 0x92, 0x6a, 0x37, 0x4c, 0x38, 0x46, 0x56,
+  0x8a, 0xf0, 0xe1, 0x13, 0x03, 0xab, 0xb5, 0xf4, 0x6b, 0x42, 0xc6, 0x4a,
+  0x79, 0xb7, 0x04, 0x68, 0x86, 0x8f, 0xcb, 0x7e, 0x87, 0x0d, 0x37, 0xa7,
+  0xf6, 0xd6, 0xed, 0xb2, 0x69, 0x60, 0xde, 0x82, 0xe2, 0xb0, 0xc9, 0x0c,
+  0x24, 0x14, 0x95, 0x19, 0xa0, 0x85, 0x8c, 0xfd, 0xe1, 0xcc, 0x38, 0xa5,
+  0xe0, 0x5f, 0x74, 0xf7, 0x9a, 0x39, 0x62, 0x54, 0x04, 0x07, 0xef, 0x03,
+  0x90, 0xa4, 0xdf, 0xbb, 0xdd, 0x63, 0xe8, 0xce, 0x88, 0xd8, 0xfb, 0xa6,
+  0xb4, 0xdb, 0x82, 0xd8, 0x0e, 0x2f, 0x3d, 0xec, 0x16, 0x0f, 0x69, 0x65,
+  0x3e, 0xf8, 0xed, 0xeb, 0xce, 0xe3, 0xff, 0x33, 0x65, 0xb9, 0x2c, 0xc6,
+  0x0a, 0x8f, 0x24, 0xaa, 0xb9, 0x9b, 0xa3, 0x59, 0x7b, 0x9d, 0xe0, 0xee,
+  0xa8, 0xe6, 0xe7, 0x1d, 0xaf, 0x56, 0xfa, 0xef, 0x8d, 0x0b, 0xea, 0xd9,
+  0x60, 0xc5, 0xd9, 0xfe, 0x59, 0x25, 0xc8, 0x87, 0x71, 0xcc, 0x15, 0x12,
+  0xe0, 0xb7, 0xe2, 0x42, 0xb5, 0x91, 0xdb, 0x91, 0x9b, 0x30, 0x0a, 0xd7,
+  0x0f, 0x68, 0x05, 0x47, 0xf3, 0x4d, 0x33, 0x38, 0xd8, 0xf1, 0xbe, 0x57,
+  0xac, 0x6a, 0x28, 0x47, 0x9b, 0x69, 0x94, 0x39, 0xe8, 0xe0, 0x74, 0x94,
+  0x75, 0x98, 0xf5, 0xaa, 0x66, 0x83, 0x3b, 0x95, 0xb9, 0x7d, 0x4f, 0xc2,
+  0x5c, 0x2b, 0x38, 0xed, 0xda, 0x80, 0xe4, 0x9d, 0xa4, 0xc8, 0xdd, 0x96,
+  0xc3, 0x11, 0x2a, 0x24, 0x4e, 0x25, 0x34, 0x08, 0x0d, 0x87, 0x62, 0x33,
+  0xbb, 0x51, 0x31, 0x64, 0x1e, 0x56, 0xd1, 0x90, 0xdb, 0x60, 0xbf, 0xfb,
+  0x2e, 0x3f, 0x1d, 0xd6, 0xa1, 0x91, 0x1e, 0x1f, 0x66, 0x05, 0xf6, 0xed,
+  0x0d, 0xe8, 0xd3, 0xdf, 0xff, 0xf0, 0xbb, 0xe8, 0xa5, 0x8e, 0x7e, 0x80,
+  0x38, 0x93, 0xa6, 0x23, 0x7d, 0xd1, 0x86, 0x4c, 0xfe, 0xa0, 0x70, 0x4e,
+  0x83, 0xc2, 0xf8, 0xf4, 0x87, 0xd9, 0xc2, 0x0c, 0x21, 0xb1, 0x14, 0x02,
+  0x2e, 0x4c, 0xc7, 0x49, 0x48, 0x98, 0xbd, 0xff, 0xca, 0x2e, 0x8e, 0xcc,
+  0x6e, 0x44, 0x5f, 0xc5, 0xaa, 0x3b, 0x99, 0xf9, 0xa2, 0x84, 0x8c, 0xfd,
+  0x46, 0x29, 0x5f, 0x64, 0x74, 0x59, 0x0d, 0x32, 0x0c, 0x35, 0x72, 0x18,
+  0x90, 0xe9, 0x09, 0x0b, 0x71, 0x76, 0x39, 0x60, 0xd0, 0x97, 0xc9, 0x67,
+  0xcc, 0x92, 0x64, 0xc5, 0x3d, 0x66, 0xd2, 0xca, 0x2c, 0x82, 0x09, 0x6c,
+  0x4d, 0x17, 0x8b, 0x5e, 0xfe, 0x02, 0xbd, 0xd8, 0x8e, 0xd0, 0x1e, 0x66,
+  0xc5, 0x73, 0xdb, 0x1c, 0x67, 0xfb, 0xa5, 0xd5, 0x25, 0xb0, 0x8b, 0x82,
+  0x54, 0x05, 0xe9, 0xf4, 0xbf, 0x9e, 0x39, 0x7c, 0xc1, 0xda, 0xc1, 0x96,
+  0xcf, 0xd0, 0x07, 0x85, 0x0e, 0xb1, 0xc1, 0x14, 0xf2, 0x57, 0x8d, 0x3d,
+  0x21, 0xc3, 0xa8, 0x22, 0x70, 0x2f, 0x0d, 0x55, 0x56, 0x07, 0x93, 0x21,
+  0x01, 0x96, 0x21, 0xb3, 0x84, 0xb6, 0xc2, 0x98, 0xfa, 0x4d, 0x59, 0xcd,
+  0xfd, 0x06, 0xb1, 0x38, 0x9f, 0x64, 0x85, 0x5b, 0xb9, 0xa8, 0x29, 0x77,
+  0x22, 0x65, 0x79, 0x56, 0x2c, 0x62, 0x14, 0x7f, 0x30, 0xd5, 0x88, 0x38,
+  0x9d, 0xee, 0xc9, 0x76, 0xf1, 0x1c, 0xe9, 0x7e, 0x6d, 0xfb, 0x8c, 0x75,
+  0xe3, 0xd2, 0x1b, 0xa4, 0x0a, 0x05, 0x07, 0x9d, 0x22, 0x44, 0xcb, 0x52,
+  0xe6, 0xbe, 0x93, 0x7b, 0x7e, 0x2c, 0x3a, 0xb4, 0xb5, 0x6c, 0xe7, 0x9d,
+  0xa1, 0xd2, 0xeb, 0x7e, 0x6c, 0x4e, 0x33, 0x26, 0xc3, 0x61, 0x67, 0x56,
+  0x08, 0x0c, 0x64, 0x28, 0xfc, 0x64, 0xac, 0x9c, 0x86, 0x24, 0x35, 0x84,
+  0x06, 0x7f, 0x85, 0xab, 0x3a, 0x9a, 0xac, 0xef, 0xd7, 0x5c, 0x42, 0x4c,
+  0x3d, 0x3c, 0xdc, 0xaa, 0xb7, 0x29, 0x5e, 0xbe, 0x9e, 0x13, 0x83, 0xd3,
+  0xa5, 0x39, 0x3b, 0x19, 0x47, 0x3f, 0xd7, 0x4c, 0x76, 0x25, 0xe7, 0x79,
+  0x27, 0x45, 0x18, 0xda, 0x69, 0x0f, 0xad, 0xd5, 0x41, 0xf3, 0x40, 0xa7,
+  0x9f, 0x22, 0xe1, 0xb8, 0x92, 0xdd, 0x68, 0x63, 0x1b, 0x11, 0xcc, 0xf0,
+  0xe5, 0x60, 0x63, 0x3a, 0xa8, 0x56, 0x07, 0xa8, 0x1d, 0x13, 0xa7, 0xda,
+  0xcb, 0x84, 0x65, 0xd2, 0xbd, 0xd3, 0x64, 0x58, 0xed, 0x3a, 0x4a, 0x2f,
+  0xa3, 0x6e, 0xe3, 0x12, 0xd4, 0x10, 0x1a, 0xc1, 0xaf, 0x7a, 0x6f, 0x61,
+  0x7a, 0x2b, 0x4b, 0xc0, 0xdd, 0x54, 0x18, 0x34, 0xed, 0x86, 0x29, 0x28,
+  0x57, 0xd8, 0xd5, 0x4c, 0x2f, 0xb8, 0xcc, 0xb5, 0x0b, 0x31, 0xb9, 0x5b,
+  0xed, 0x25, 0x3e, 0x4b, 0x3a, 0x67, 0xeb, 0xf3, 0x47, 0x95, 0xb9, 0x56,
+  0xec, 0x0e, 0x96, 0x28, 0x7b, 0xab, 0x27, 0x0e, 0x1a, 0xa4, 0x60, 0xc3,
+  0xf2, 0x3a, 0xa9, 0x0d, 0x50, 0x75, 0x5f, 0xad, 0x5f, 0xaa, 0x8a, 0x05,
+  0xd0, 0x1d, 0xd6, 0xfe, 0x8c, 0xc6, 0xaa, 0x45, 0x42, 0x47, 0x9e, 0x28,
+  0x79, 0xea, 0x0c, 0x9c, 0x31, 0x45, 0x6b, 0x9e, 0x4f, 0xad, 0xb1, 0xfc,
+  0x6e, 0x3d, 0xac, 0xaf, 0x74, 0x4e, 0xba, 0x1b, 0x5a, 0x9b, 0xcb, 0x28,
+  0x61, 0xb4, 0xfc, 0x63, 0x75, 0xa7, 0x3d, 0x61, 0xd6, 0x11, 0x74, 0xe1,
+  0xff, 0x06, 0xa2, 0x87, 0x77, 0x15, 0xfa, 0x19, 0x50, 0x15, 0x95, 0xec,
+  0xa3, 0x9f, 0x34, 0x64, 0xda, 0xb1, 0xff, 0x4d, 0x12, 0xe6, 0xde, 0x4a,
+  0xd6, 0x9e, 0xb7, 0x42, 0x63, 0x11, 0x63, 0x7a, 0x25, 0xe4, 0xec, 0xbf,
+  0x2f, 0x73, 0x0c, 0xea, 0x9d, 0xe9, 0x77, 0x67, 0xb5, 0xff, 0x7d, 0x8c,
+  0x2d, 0x8d, 0x27, 0x80, 0xf6, 0x02, 0x59, 0x22, 0xc2, 0x2f, 0xea, 0x42,
+  0x7b, 0x7a, 0x1c, 0xac, 0xd4, 0x9b, 0xfb, 0xfe, 0x8a, 0xca, 0x0d, 0x0e,
+  0xbd, 0x03, 0xcd, 0xef, 0x56, 0x39, 0xa2, 0x5b, 0xf8, 0x26, 0xa9, 0x9a,
+  0xd0, 0x2e, 0x96, 0xf6, 0x2b, 0x63, 0x2f, 0x53, 0xf3, 0xa8, 0x2e, 0x6c,
+  0xe4, 0x9b, 0x38, 0xbc, 0xd0, 0xe7, 0x8b, 0x68, 0x2d, 0x33, 0x1a, 0xef,
+  0xb9, 0xa6, 0x48, 0x96, 0x42, 0xc3, 0xba, 0x99, 0xa5, 0x4b, 0x66, 0xbd,
+  0xc6, 0x57, 0x3d, 0x52, 0x07, 0xe2, 0x00, 0xb0, 0xa7, 0x45, 0x71, 0xf2,
+  0x6f, 0x39, 0x65, 0x77, 0x84, 0x29, 0xdc, 0x6a, 0x05, 0xa0, 0xb6, 0x52,
+  0x75, 0x3c, 0x8b, 0x15, 0xfe, 0xe2, 0x3d, 0xce, 0x22, 0x1c, 0x06, 0x29,
+  0xf4, 0xf6, 0x64, 0xc5, 0xab, 0x2f, 0xb7, 0x1c, 0x5f, 0x48, 0x5c, 0x63,
+  0x05, 0x78, 0x18, 0x35, 0x4e, 0x8c, 0xd2, 0xc8, 0x60, 0x58, 0xbb, 0x9e,
+  0x7f, 0xc7, 0xe8, 0x21, 0x4f, 0x51, 0xb0, 0x33, 0xf3, 0x2e, 0x46, 0x47,
+  0x30, 0x79, 0x7c, 0x8b, 0x18, 0x7b, 0xd0, 0x15, 0x18, 0x94, 0xc8, 0x8b,
+  0x0b, 0xd9, 0xcb, 0x4d, 0x69, 0x4e, 0x7d, 0x8e, 0x7f, 0xb7, 0xd4, 0xf4,
+  0x28, 0xbb, 0x1e, 0x2b, 0x1d, 0x1f, 0x74, 0xbc, 0xe7, 0xc1, 0x5d, 0xd0,
+  0x3e, 0x1b, 0xe1, 0x42, 0x63, 0xbb, 0xff, 0x91, 0xa0, 0x21, 0x1d, 0xa8,
+  0x7b, 0xa5, 0xde, 0x71, 0x3c, 0x96, 0xa4, 0x7e, 0x4e, 0xc9, 0x28, 0x3d,
+  0x87, 0x7d, 0xb4, 0x79, 0x9a, 0xa9, 0x91, 0x03, 0xc7, 0x94, 0x15, 0x43,
+  0xb9, 0x5c, 0x75, 0x24, 0x24, 0x0a, 0x80, 0x85, 0x71, 0x23, 0xe6, 0x9f,
+  0x89, 0x8d, 0x63, 0xe7, 0xdf, 0x6c, 0x4b, 0x1c, 0x53, 0xdb, 0x71, 0xc0,
+  0x44, 0x17, 0xfb, 0xc3, 0x48, 0xbe, 0x43, 0x75, 0xc0, 0x75, 0xf0, 0x93,
+  0x73, 0xb0, 0xcf, 0xd2, 0x96, 0xb5, 0xce, 0x8c, 0x4d, 0x71, 0xaf, 0x5e,
+  0xf5, 0xa4, 0x73, 0x1e, 0xa8, 0x6b, 0xe6, 0xf0, 0xdc, 0x77, 0xfd, 0xbb,
+  0x18, 0x2e, 0xcf, 0x8e, 0x5e, 0x9c, 0x6d, 0x87, 0x4d, 0x08, 0x7c, 0xe5,
+  0xc5, 0x5e, 0xf3, 0x2f, 0xa9, 0x82, 0xad, 0xc5, 0x97, 0xe2, 0xd1, 0x0d,
+  0xa9, 0x1c, 0xa8, 0x6f, 0xf4, 0x16, 0x73, 0x48, 0xce, 0x74, 0x83, 0xe0,
+  0x5c, 0x12, 0x59, 0xf2, 0x73, 0x37, 0xe8, 0xa2, 0x9a, 0xbf, 0x90, 0x90,
+  0xa9, 0x34, 0xf7, 0x8a, 0x0e, 0x94, 0x9c, 0x22, 0x16, 0x89, 0x7a, 0xf3,
+  0x44, 0x7d, 0xdd, 0x0d, 0x23, 0x51, 0x59, 0xd0, 0xd7, 0x15, 0xc6, 0xfb,
+  0x1e, 0x89, 0xfd, 0xde, 0xe2, 0x7a, 0xf5, 0x24, 0xb7, 0x45, 0xde, 0xd1,
+  0xb3, 0x7a, 0x63, 0xed, 0x63, 0x59, 0xac, 0x59, 0x63, 0x22, 0x94, 0x39,
+  0x58, 0xdb, 0x19, 0x06, 0x55, 0x83, 0x11, 0x95, 0x63, 0x33, 0x77, 0xae,
+  0xb5, 0x11, 0xfa, 0xa5, 0x90, 0x78, 0xad, 0x93, 0xa3, 0x66, 0x27, 0xb3,
+  0x66, 0xd6, 0x2b, 0x05, 0x23, 0xe0, 0xfa, 0xdf, 0xb5, 0x10, 0x63, 0xb7,
+  0x5e, 0x10, 0x21, 0xf0, 0x78, 0x6f, 0x94, 0x91, 0xca, 0xa3, 0x2b, 0xe3,
+  0xbf, 0x76, 0x13, 0xc1, 0xa5, 0xfd, 0x69, 0xcc, 0x2e, 0xeb, 0x70, 0x36,
+  0x62, 0xdc, 0xfe, 0x5c, 0xca, 0x2c, 0xe9, 0x5f, 0x97, 0x86, 0xb5, 0xb4,
+  0x42, 0xe4, 0xa3, 0xf5, 0x49, 0xc3, 0x68, 0x19, 0x82, 0x6f, 0x39, 0xc7,
+  0x7c, 0x1b, 0xe6, 0xc1, 0x47, 0x85, 0x99, 0xfc, 0x55, 0xf0, 0x44, 0x8c,
+  0xc5, 0xbb, 0xb3, 0x81, 0xd2, 0xa1, 0x85, 0xd8, 0x2d, 0x73, 0xe7, 0x60,
+  0x24, 0xe6, 0xbc, 0x13, 0x63, 0xaa, 0xce, 0x2d, 0x79, 0xb0, 0x44, 0x21,
+  0x21, 0x22, 0xa9, 0x0b, 0x14, 0x71, 0xd9, 0x72, 0xeb, 0x49, 0xb7, 0x3b,
+  0xac, 0x01, 0x09, 0x79, 0xef, 0xeb, 0xc4, 0xb0, 0xd0, 0x19, 0xd2, 0xf3,
+  0xea, 0x6c, 0x20, 0x0a, 0xd8, 0x69, 0x5b, 0xa3, 0xd7, 0x73, 0x08, 0x1b,
+  0x75, 0xd8, 0x8b, 0xd8, 0x49, 0xec, 0xde, 0x79, 0xad, 0x69, 0x84, 0xb4,
+  0xc4, 0x68, 0x7c, 0x11, 0x90, 0xa3, 0xaf, 0xb9, 0xa1, 0x1c, 0x7f, 0x92,
+  0xcb, 0x2e, 0xec, 0x91, 0x09, 0x38, 0x53, 0x94, 0x7b, 0xec, 0xd3, 0x01,
+  0x74, 0xf9, 0xa6, 0xd2, 0xae, 0x06, 0xf3, 0xe5, 0xac, 0xbf, 0x57, 0x58,
+  0x6b, 0xb4, 0x0c, 0x47, 0x90, 0x74, 0xb0, 0xe2, 0x31, 0x7c, 0x10, 0xe7,
+  0x33, 0xcc, 0x2b, 0xdb, 0x0e, 0xb2, 0x06, 0x82, 0x57, 0x61, 0x5c, 0xe1,
+  0x91, 0xdf, 0xf4, 0xbf, 0x06, 0xdd, 0x86, 0x3d, 0xaf, 0x44, 0x1c, 0xca,
+  0xe4, 0x11, 0x3b, 0x57, 0x77, 0x95, 0x07, 0xd0, 0x43, 0xd5, 0x6d, 0xe0,
+  0xe2, 0x3d, 0xc1, 0x87, 0x44, 0x27, 0x70, 0xd6, 0xfd, 0x8e, 0x4e, 0x1b,
+  0xf9, 0x59, 0x98, 0x52, 0x51, 0x0a, 0x43, 0xe9, 0x73, 0xab, 0x20, 0x9f,
+  0x93, 0xd3, 0xe5, 0xd7, 0x57, 0xf3, 0x16, 0x5e, 0xbb, 0x36, 0x50, 0x5e,
+  0x70, 0xda, 0x03, 0x45, 0x94, 0x2b, 0x6a, 0x6f, 0xd7, 0x5b, 0x68, 0x23,
+  0xa7, 0x18, 0x9f, 0x18, 0xcc, 0xe7, 0x67, 0x27, 0x91, 0xcc, 0x88, 0xee,
+  0xdc, 0x5f, 0x66, 0x41, 0x65, 0xf8, 0xb1, 0xe5, 0x56, 0x85, 0xfe, 0x1a,
+  0x67, 0x67, 0x08, 0x2d, 0x0f, 0x55, 0xb7, 0x26, 0xb1, 0xa2, 0x4f, 0x9f,
+  0x78, 0x29, 0x8b, 0xc2, 0x81, 0x9e, 0x0c, 0xad, 0x5c, 0x02, 0xc9, 0xe6,
+  0x89, 0x09, 0xc5, 0x73, 0xaf, 0x19, 0xcc, 0x76, 0x3e, 0xc0, 0x39, 0x5c,
+  0x89, 0x23, 0xb2, 0xf6, 0xc8, 0x73, 0xf6, 0x58, 0x1f, 0x2e, 0x44, 0x2e,
+  0xc0, 0xb8, 0x20, 0xcc, 0x00, 0x17, 0xe8, 0xa0, 0x5c, 0xb1, 0x62, 0x83,
+  0xad, 0x0b, 0xe1, 0x68, 0x1c, 0x42, 0x98, 0xb7, 0x02, 0xd3, 0x4e, 0x74,
+  0x97, 0x12, 0xb0, 0xee, 0x14, 0x8b, 0x8b, 0x73, 0x20, 0x0e, 0xc3, 0xac,
+  0x54, 0x5c, 0xb5, 0x68, 0xa3, 0x9c, 0xdb, 0x85, 0x3a, 0xea, 0x23, 0x72,
+  0xd5, 0xd0, 0x45, 0x61, 0xf4, 0x89, 0xe4, 0x0e, 0x63, 0x6a, 0xc4, 0xd0,
+  0x48, 0x13, 0x5a, 0xd1, 0x6a, 0x12, 0x82, 0x06, 0xae, 0xeb, 0x6b, 0xf2,
+  0x0e, 0x04, 0xa1, 0x60, 0x60, 0x12, 0xb3, 0x5d, 0xc5, 0x6f, 0x98, 0x2a,
+  0xba, 0xcb, 0xd6, 0xaf, 0x8a, 0xa8, 0x5b, 0x66, 0x38, 0x53, 0xe6, 0x7e,
+  0x94, 0x3e, 0xf9, 0x86, 0x36, 0xf6, 0x02, 0xe2, 0xef, 0xbb, 0x4c, 0x83,
+  0x8e, 0x0f, 0x63, 0xab, 0x66, 0x24, 0x65, 0x0e, 0x40, 0x06, 0xea, 0xfd,
+  0xbc, 0xa8, 0xcd, 0x61, 0x4a, 0xd2, 0xe8, 0x42, 0xd9, 0x5d, 0xc3, 0x83,
+  0xfa, 0x70, 0x66, 0xe9, 0x0d, 0xbf, 0x77, 0x01, 0x39, 0x0d, 0xf5, 0xb6,
+  0x9f, 0xda, 0xd2, 0x53, 0x83, 0x51, 0xc3, 0x8d, 0xb6, 0x23, 0x0c, 0x01,
+  0x44, 0x8b, 0xd4, 0xd1, 0x8d, 0xb0, 0x60, 0x5b, 0xe0, 0xca, 0xb4, 0x86,
+  0x82, 0x3c, 0x68, 0xc3, 0xdf, 0xbf, 0x29, 0x1b, 0x05, 0xf5, 0x08, 0x9b,
+  0x77, 0x95, 0xcd, 0xa7, 0x96, 0xe2, 0x1a, 0xff, 0x26, 0x62, 0x75, 0xa9,
+  0xed, 0x02, 0x23, 0xa4, 0x37, 0xce, 0x25, 0x63, 0x48, 0xb1, 0xcf, 0x2f,
+  0x0d, 0x94, 0xe1, 0xd9, 0x7e, 0x88, 0x5f, 0xb7, 0xba, 0xb0, 0xcb, 0x20,
+  0x36, 0x95, 0x73, 0x84, 0xb6, 0xdc, 0xe6, 0x2a, 0x2a, 0x4c, 0x4c, 0x08,
+  0xac, 0x8c, 0x32, 0xa1, 0xe3, 0xd1, 0x26, 0x26, 0xf5, 0xe3, 0x36, 0x2b,
+  0xbe, 0x5c, 0xb5, 0xc0, 0x16, 0x0f, 0x7b, 0x01, 0x43, 0x5a, 0x4e, 0x7e,
+  0x2b, 0x76, 0xf3, 0x00, 0x0f, 0xdf, 0x65, 0x7c, 0xfb, 0xa3, 0x92, 0x4a,
+  0xed, 0xad, 0x39, 0x35, 0x98, 0x5a, 0x96, 0xe4, 0x90, 0x69, 0x88, 0x71,
+  0x2c, 0x07, 0xdf, 0xd7, 0x8a, 0x16, 0x8c, 0x73, 0x35, 0xd2, 0x85, 0xd7,
+  0x58, 0x70, 0x9d, 0xb2, 0x6d, 0x39, 0x47, 0x4f, 0xb8, 0x53, 0x15, 0xab,
+  0xe0, 0xc8, 0x00, 0x90, 0xe7, 0x6d, 0x20, 0x33, 0xa8, 0x86, 0x32, 0x34,
+  0x23, 0x99, 0x6a, 0xba, 0x8b, 0x19, 0x1f, 0x1d, 0xfc, 0x22, 0x89, 0xa8,
+  0x1b, 0xc6, 0xe6, 0x59, 0xfe, 0x9a, 0xac, 0x11, 0x8a, 0xde, 0x10, 0xc4,
+  0x2a, 0x36, 0x14, 0xb5, 0xc0, 0x03, 0x29, 0xdd, 0x9b, 0x86, 0xbe, 0x70,
+  0x12, 0x34, 0xfa, 0x66, 0x34, 0x46, 0x34, 0x1f, 0x23, 0xc4, 0xf0, 0x48,
+  0x21, 0x46, 0x66, 0xfd, 0xf8, 0x6c, 0x82, 0x60, 0x1e, 0x5e, 0x88, 0x61,
+  0x8a, 0x67, 0xc9, 0x20, 0x7b, 0xc3, 0xb0, 0x7a, 0x92, 0xa9, 0x63, 0xde,
+  0x6d, 0x98, 0x84, 0x18, 0x87, 0x26, 0xd9, 0x59, 0xbf, 0x27, 0x25, 0x73,
+  0x0b, 0xc6, 0xaa, 0x64, 0xdf, 0xfb, 0xb0, 0xf8, 0xe1, 0x5d, 0xbf, 0xf2,
+  0x9f, 0x73, 0x71, 0xc8, 0x24, 0x26, 0x63, 0x99, 0x96, 0x0f, 0x39, 0xdd,
+  0xb1, 0x4d, 0xcc, 0xb2, 0x32, 0x8a, 0xb8, 0xf2, 0x1a, 0xf6, 0x38, 0x82,
+  0x2f, 0x4f, 0x7c, 0xa4, 0xc8, 0x98, 0x7c, 0x4f, 0xc0, 0x8f, 0x27, 0xad,
+  0x83, 0x98, 0xfc, 0xf0, 0x7f, 0x20, 0x8d, 0x62, 0xce, 0x0f, 0x9c, 0xcc,
+  0xf7, 0xa3, 0x43, 0xaf, 0x23, 0x96, 0xe6, 0x3f, 0xe6, 0xc2, 0xfb, 0x44,
+  0x28, 0xa0, 0x20, 0x30, 0x7f, 0x9c, 0x47, 0x1e, 0x0c, 0xc8, 0x16, 0xc3,
+  0x9b, 0xf3, 0xcf, 0x21, 0x33, 0xde, 0x06, 0xcd, 0xd0, 0x61, 0x99, 0xcf,
+  0x66, 0x27, 0x90, 0x78, 0x4e, 0xe2, 0x8e, 0x7b, 0x79, 0x91, 0x6e, 0xf7,
+  0xb8, 0x90, 0xc8, 0xb8, 0x2e, 0x14, 0x52, 0xac, 0x7a, 0x54, 0x03, 0x5d,
+  0x31, 0xde, 0x7c, 0x6b, 0xb3, 0x3d, 0x54, 0xe1, 0x99, 0x35, 0x8e, 0x81,
+  0x91, 0x4e, 0x06, 0x32, 0xe4, 0x55, 0xb4, 0x9e, 0x21, 0xfa, 0x88, 0xa2,
+  0xb9, 0xae, 0x01, 0x77, 0x00, 0xdc, 0xc8, 0x2a, 0x49, 0x84, 0x4f, 0x3f,
+  0x55, 0xff, 0x2a, 0x26, 0x19, 0x9c, 0x32, 0x59, 0xe4, 0x8f, 0xd3, 0x97,
+  0x5a, 0x2e, 0x8c, 0xe4, 0xda, 0x19, 0xcd, 0x42, 0x31, 0x0e, 0x5a, 0x18,
+  0x25, 0xbd, 0x5f, 0x8f, 0x51, 0x77, 0x0c, 0x4e, 0x3a, 0xdc, 0xc3, 0xfc,
+  0x77, 0x13, 0x6b, 0x8c, 0xfa, 0x09, 0xc8, 0xb8, 0xfe, 0x3e, 0x5f, 0xb8,
+  0xfa, 0xc1, 0x7c, 0x91, 0x4b, 0xe7, 0x30, 0x31, 0xab, 0x86, 0x53, 0x39,
+  0x59, 0xe3, 0x02, 0xfc, 0xfc, 0xe8, 0x42, 0x7e, 0x63, 0xf0, 0x2c, 0xd5,
+  0x68, 0x7d, 0x45, 0xa5, 0xef, 0x4f, 0xee, 0x0c, 0x10, 0x99, 0x2a, 0xa5,
+  0x42, 0x58, 0x62, 0x2f, 0x89, 0xaf, 0xea, 0x5b, 0x3a, 0x60, 0x8a, 0x09,
+  0xcc, 0xbc, 0x5f, 0x93, 0x85, 0x8a, 0x54, 0x43, 0x78, 0x99, 0xc7, 0x07,
+  0x27, 0xfe, 0x0f, 0xa4, 0x3f, 0xc4, 0x5c, 0xdd, 0x44, 0x01, 0x88, 0x80,
+  0x83, 0x5e, 0x84, 0xb1, 0x31, 0x3d, 0x6a, 0x95, 0xd6, 0x03, 0x00, 0x38,
+  0x3b, 0x1d, 0x88, 0x30, 0x2d, 0xd0, 0x6b, 0xe1, 0x75, 0x2e, 0xe9, 0x62,
+  0x66, 0x1e, 0x63, 0xbe, 0xb1, 0xef, 0x6c, 0xd9, 0x73, 0x23, 0x3f, 0x9e,
+  0xc7, 0x37, 0x5b, 0x6e, 0x5f, 0xdf, 0x6e, 0x0e, 0xd9, 0x2f, 0x75, 0xff,
+  0xda, 0x07, 0xfb, 0xef, 0x30, 0xe2, 0x95, 0x0d, 0xee, 0xb2, 0x01, 0xa0,
+  0x06, 0xce, 0xab, 0xd7, 0xa3, 0xb0, 0x8a, 0x17, 0xbf, 0xa5, 0xb8, 0xe6,
+  0x25, 0xe6, 0x40, 0x75, 0xe3, 0x02, 0xba, 0xc6, 0xc2, 0x39, 0x83, 0x2b,
+  0x24, 0x05, 0x2a, 0x26, 0xb7, 0xb2, 0x63, 0x86, 0xe3, 0x34, 0x17, 0x24,
+  0x94, 0x01, 0xbd, 0xfd, 0xe7, 0xaa, 0xb2, 0xe1, 0x89, 0x5d, 0x43, 0xbc,
+  0x8a, 0x84, 0xf2, 0xca, 0xa6, 0x7d, 0x7a, 0x09, 0x14, 0x42, 0x3e, 0x34,
+  0xeb, 0xbc, 0x1c, 0x3b, 0x33, 0x9a, 0x8c, 0x5c, 0x78, 0xd1, 0x03, 0x6b,
+  0xf5, 0x5b, 0x39, 0xe6, 0x60, 0x31, 0x7f, 0x18, 0x8f, 0xfa, 0xd9, 0x1a,
+  0x42, 0xd3, 0x7e, 0x59, 0x9f, 0x1f, 0x45, 0x9f, 0x1e, 0x57, 0x9c, 0x68,
+  0x12, 0x85, 0x7d, 0xb9, 0xd1, 0xc6, 0x29, 0xb3, 0xce, 0x81, 0x6d, 0x7e,
+  0x32, 0x6f, 0x99, 0x94, 0x91, 0x37, 0x15, 0xdd, 0xff, 0x65, 0x17, 0x07,
+  0xfb, 0x4b, 0x2f, 0x97, 0x36, 0x87, 0xa6, 0x85, 0x05, 0x14, 0x9b, 0xf2,
+  0x99, 0x2b, 0xbb, 0xb1, 0xa8, 0xc2, 0xe9, 0xad, 0x4a, 0x4e, 0x15, 0x78,
+  0xad, 0x0b, 0xc1, 0x80, 0x72, 0xb3, 0x8d, 0x62, 0x77, 0x48, 0x06, 0xe1,
+  0x7a, 0x03, 0x57, 0xe3, 0xfe, 0x93, 0x1e, 0xd9, 0x91, 0xcd, 0xa8, 0x7b,
+  0x86, 0xde, 0xc7, 0x7f, 0x3d, 0xda, 0xfa, 0x00, 0x2a, 0x25, 0xc8, 0x03,
+  0x85, 0x31, 0x14, 0x69, 0xce, 0x71, 0xd5, 0x6c, 0x48, 0x90, 0x10, 0x71,
+  0x66, 0x32, 0xc2, 0xf7, 0x9f, 0xb6, 0x2f, 0xf1, 0xf1, 0x4c, 0xb0, 0xf5,
+  0xe6, 0xe0, 0xcf, 0x6f, 0x46, 0x60, 0x6d, 0xcd, 0x14, 0xdb, 0xa4, 0x51,
+  0x61, 0x75, 0xdf, 0xf2, 0x0c, 0x64, 0x79, 0xd7, 0x38, 0x25, 0xf3, 0xfe,
+  0x14, 0x5c, 0x8d, 0x11, 0x32, 0x2d, 0xeb, 0x23, 0xef, 0xc2, 0x18, 0xac,
+  0xa3, 0x72, 0x52, 0xa9, 0xd9, 0xe6, 0x2f, 0xd3, 0xc8, 0xd0, 0x17, 0xea,
+  0x24, 0x8d, 0x24, 0x23, 0xf6, 0xc6, 0x27, 0xef, 0x6f, 0xdb, 0xba, 0x1b,
+  0x2a, 0xd5, 0x9e, 0xb8, 0x91, 0x91, 0xc0, 0x6d, 0x90, 0x27, 0x55, 0x8f,
+  0x76, 0xaf, 0x8b, 0xf9, 0x77, 0x37, 0xb7, 0x55, 0x3d, 0xdc, 0x2a, 0xd1,
+  0x98, 0xf6, 0x5f, 0xae, 0x16, 0xc0, 0xb4, 0xcf, 0x8b, 0x9d, 0x8d, 0xf4,
+  0x1f, 0x72, 0x64, 0x71, 0xe3, 0x42, 0x7a, 0x5e, 0x3c, 0x6e, 0x60, 0x84,
+  0x8c, 0x7f, 0xc9, 0xe1, 0x6d, 0x42, 0x7d, 0x65, 0xd4, 0x29, 0xbe, 0x01,
+  0x85, 0x55, 0xc3, 0xc0, 0xb7, 0x91, 0x2c, 0x1f, 0xdb, 0x6d, 0x55, 0xc5,
+  0xab, 0xf4, 0x03, 0x3b, 0x76, 0x90, 0x4c, 0x08, 0x2e, 0x34, 0x76, 0x0d,
+  0x73, 0x8c, 0xe8, 0x75, 0x29, 0x0e, 0x44, 0xd7, 0x37, 0x01, 0xbe, 0x92,
+  0x13, 0x01, 0xd4, 0x78, 0x3e, 0x57, 0x56, 0xa2, 0x54, 0xc0, 0xf7, 0xdd,
+  0xcf, 0x12, 0xc4, 0x70, 0xad, 0x6e, 0xfa, 0x94, 0x90, 0x81, 0xdf, 0xdc,
+  0xf7, 0x3e, 0x78, 0x06, 0xd1, 0xf0, 0xd2, 0xb3, 0x4c, 0x93, 0x79, 0x00,
+  0xd6, 0xfe, 0x2a, 0x20, 0x13, 0xbb, 0x51, 0x78, 0xe6, 0xbf, 0x95, 0x99,
+  0xbc, 0x5d, 0xe6, 0x19, 0x00, 0x4c, 0xaa, 0xc4, 0x2a, 0x39, 0xa3, 0x57,
+  0xd0, 0x33, 0x0e, 0x57, 0x81, 0x62, 0x98, 0x52, 0xaa, 0x40, 0x39, 0xce,
+  0x93, 0x58, 0xa1, 0xc3, 0xf8, 0x53, 0x7c, 0xce, 0x36, 0x7f, 0x1a, 0x90,
+  0xef, 0xe5, 0x81, 0xa0, 0xe4, 0x70, 0x09, 0x5c, 0x88, 0x7a, 0xb2, 0xe6,
+  0x26, 0x07, 0xd7, 0x64, 0xaa, 0x7e, 0xac, 0xb8, 0xa0, 0xb2, 0x2e, 0xeb,
+  0xe5, 0x70, 0x0a, 0xaf, 0x18, 0xa5, 0xd4, 0x2b, 0x38, 0xee, 0x3e, 0xa7,
+  0xe7, 0xf2, 0xdf, 0x91, 0x3c, 0xcb, 0x0e, 0x9c, 0x51, 0x18, 0xae, 0x5b,
+  0x6f, 0x30, 0x51, 0x6f, 0x19, 0xcc, 0x34, 0x32, 0xab, 0xe4, 0xae, 0x2a,
+  0xa5, 0x8b, 0x39, 0x1a, 0xdf, 0x20, 0xd4, 0xd3, 0xda, 0x63, 0x9b, 0xcc,
+  0xdf, 0x32, 0x65, 0xae, 0x2b, 0x26, 0x36, 0x59, 0x66, 0xa8, 0xac, 0x9a,
+  0x65, 0x1c, 0x01, 0xb9, 0x52, 0x51, 0x08, 0xa1, 0xe5, 0xfd, 0xc5, 0xbd,
+  0x07, 0xde, 0x3d, 0x5d, 0xb7, 0xdd, 0x98, 0x22, 0xf8, 0x70, 0x12, 0xdf,
+  0x32, 0x9d, 0x22, 0x4a, 0x8e, 0x7d, 0xab, 0xc5, 0x2b, 0x73, 0xbc, 0xf3,
+  0xdd, 0xb4, 0xef, 0x4a, 0xf6, 0x97, 0x25, 0x5c, 0xb9, 0x88, 0x17, 0x84,
+  0xe5, 0xc5, 0x83, 0xb1, 0x1a, 0xf3, 0x5d, 0x16, 0x09, 0x2c, 0xd2, 0xde,
+  0x93, 0x89, 0x4f, 0x42, 0xaf, 0x94, 0x68, 0x23, 0x42, 0x93, 0xe4, 0xc4,
+  0xe9, 0x8b, 0xe1, 0xfd, 0xd6, 0x64, 0xe8, 0x70, 0x34, 0x4e, 0x93, 0x92,
+  0x6d, 0x58, 0xb7, 0x20, 0xa2, 0x97, 0x66, 0x0f, 0xd5, 0x71, 0x00, 0xe1,
+  0x98, 0x04, 0x17, 0xc9, 0x58, 0xbb, 0xb8, 0xe4, 0x42, 0xd2, 0x4e, 0x07,
+  0x01, 0x06, 0x67, 0xbf, 0xa1, 0x4e, 0x4f, 0x9c, 0xb9, 0x3d, 0xca, 0x95,
+  0xd5, 0x53, 0x45, 0xee, 0xeb, 0x03, 0xee, 0x59, 0xe9, 0xf7, 0x86, 0x68,
+  0xa5, 0xb2, 0xb6, 0xa7, 0x72, 0x4a, 0xeb, 0x02, 0x39, 0xe6, 0x5a, 0xfa,
+  0xa3, 0x94, 0x82, 0x7f, 0x9b, 0x41, 0xb8, 0x0c, 0xa2, 0xf1, 0x7a, 0x83,
+  0x85, 0xfd, 0x18, 0xee, 0xe2, 0xe7, 0xb4, 0x3f, 0xe4, 0xf9, 0x7a, 0x0c,
+  0xd5, 0x9a, 0x5a, 0x35, 0x01, 0x69, 0xe5, 0xc6, 0x36, 0x58, 0x8b, 0x6b,
+  0x8d, 0x4f, 0xb3, 0xe3, 0x5c, 0x0e, 0x42, 0xe9, 0x48, 0x8e, 0x25, 0x6d,
+  0x42, 0x8d, 0xbe, 0xaf, 0x19, 0xfc, 0xc9, 0xa1, 0xfe, 0x9d, 0x7e, 0xef,
+  0x28, 0xfc, 0xcb, 0x8c, 0x1c, 0x8d, 0xcf, 0x5a, 0x5d, 0x3f, 0x74, 0x97,
+  0x56, 0x9d, 0xa0, 0x4b, 0x62, 0x75, 0x6b, 0x4b, 0xc2, 0x39, 0x8c, 0xb2,
+  0x20, 0x4b, 0x2a, 0xed, 0x6b, 0x7a, 0xeb, 0x42, 0xdf, 0xc8, 0x8f, 0x85,
+  0x22, 0x80, 0xab, 0xb5, 0x7f, 0x70, 0xe3, 0xbb, 0xdb, 0xb2, 0xeb, 0xef,
+  0x19, 0xf3, 0x76, 0x9f, 0x69, 0x6d, 0x53, 0xe6, 0xb4, 0x44, 0x3c, 0xfa,
+  0x8c, 0x9c, 0x3e, 0xc2, 0x02, 0x2a, 0xd7, 0x43, 0x2c, 0xd6, 0x38, 0x61,
+  0xaa, 0xaf, 0xc5, 0x36, 0xc1, 0x86, 0x4c, 0x9f, 0x55, 0x42, 0x5d, 0xb3,
+  0x40, 0xdc, 0xd9, 0x18, 0x0e, 0x48, 0xbd, 0x93, 0x19, 0xc1, 0x0b, 0xf7,
+  0x8b, 0xa7, 0x0b, 0xf5, 0xfc, 0x17, 0xca, 0x81, 0x03, 0xe9, 0xc8, 0xda,
+  0xc0, 0x4e, 0x40, 0x60, 0xd0, 0x8c, 0x68, 0x0a, 0x01, 0x9d, 0x22, 0x7d,
+  0x08, 0xf1, 0xe6, 0x1e, 0xa3, 0xf4, 0x27, 0xcb, 0xf3, 0x8f, 0x81, 0x0a,
+  0x0a, 0x74, 0x4c, 0xff, 0x36, 0x23, 0x90, 0xa8, 0x39, 0x4c, 0x3e, 0x62,
+  0x04, 0xa8, 0x67, 0x47, 0xb6, 0x29, 0xbe, 0xeb, 0x45, 0x2c, 0xb4, 0x92,
+  0xc9, 0x5d, 0x8b, 0xf7, 0x06, 0xbd, 0xa5, 0xe7, 0x4f, 0x99, 0xb2, 0xcd,
+  0x73, 0xfd, 0x93, 0x25, 0x3f, 0x95, 0x16, 0x5d, 0x37, 0x45, 0x05, 0x83,
+  0xc8, 0xe5, 0xf9, 0xae, 0x73, 0xe0, 0xf7, 0xad, 0x82, 0x1d, 0x81, 0x37,
+  0xf0, 0x65, 0xc6, 0x30, 0xc8, 0x82, 0x46, 0x65, 0xd6, 0xb0, 0x80, 0xad,
+  0x33, 0xf2, 0x6a, 0xf7, 0x63, 0x58, 0x10, 0x5e, 0xcf, 0x3b, 0x70, 0xd2,
+  0x49, 0xcb, 0x19, 0x36, 0x2b, 0x16, 0x12, 0x36, 0xf0, 0x2d, 0x7c, 0x8b,
+  0xce, 0xee, 0x13, 0x2b, 0x36, 0x25, 0x6c, 0x5c, 0x0d, 0xa7, 0x2b, 0x9e,
+  0x50, 0x49, 0x7a, 0x27, 0x67, 0x68, 0x84, 0x64, 0x42, 0x83, 0x6c, 0xf7,
+  0x2c, 0x91, 0x93, 0xe7, 0x73, 0xe7, 0xac, 0x43, 0x34, 0x0b, 0x44, 0x2d,
+  0x0b, 0x67, 0xd9, 0x36, 0xe8, 0x51, 0xfd, 0xf6, 0x7f, 0xd5, 0xa3, 0x5d,
+  0x4f, 0x7d, 0xd9, 0x3d, 0x3d, 0xe4, 0xfd, 0xc8, 0x0c, 0xc2, 0x27, 0x3a,
+  0x14, 0x0b, 0xd9, 0xc9, 0x72, 0x21, 0x2b, 0xa1, 0x41, 0xcc, 0x12, 0x99,
+  0xbf, 0xd4, 0x60, 0x4a, 0x2e, 0xe1, 0x3d, 0xa4, 0x85, 0x13, 0xbb, 0xa5,
+  0x32, 0x21, 0xf2, 0x35, 0xa9, 0x43, 0x8f, 0x78, 0xef, 0x14, 0x57, 0x50,
+  0x5e, 0x6c, 0x40, 0x5e, 0xe3, 0x3b, 0x19, 0xe4, 0x31, 0x9c, 0xd3, 0x37,
+  0xb7, 0x60, 0x2c, 0x42, 0xf2, 0xea, 0x73, 0x9d, 0x56, 0x7c, 0x55, 0xcb,
+  0xae, 0x1b, 0xa3, 0x4a, 0x1b, 0x30, 0x0b, 0x88, 0x71, 0x52, 0x1a, 0x55,
+  0x2c, 0x3a, 0xe3, 0x76, 0xab, 0x03, 0xa9, 0xb5, 0x1c, 0x6e, 0x78, 0x72,
+  0x01, 0x24, 0x9a, 0x20, 0x4c, 0x6b, 0x28, 0x76, 0x4a, 0x54, 0x7f, 0xb0,
+  0x95, 0x55, 0x12, 0xa5, 0xdb, 0xbe, 0x6a, 0xcc, 0x6f, 0x77, 0x2d, 0x62,
+  0xe5, 0x56, 0x22, 0xfd, 0x58, 0xd2, 0x3b, 0xcd, 0xc5, 0xba, 0xe6, 0x09,
+  0x17, 0xf2, 0x71, 0x3d, 0xc5, 0x6b, 0xb3, 0x83, 0x53, 0x2c, 0x30, 0x81,
+  0xf4, 0xdb, 0xcb, 0xe8, 0xa3, 0x79, 0xd1, 0xff, 0x70, 0xec, 0x52, 0xac,
+  0x94, 0x70, 0x54, 0x51, 0x91, 0x11, 0x72, 0x6c, 0x65, 0x3c, 0x8f, 0xc4,
+  0x09, 0x4d, 0xd2, 0x8c, 0x9c, 0xc0, 0x6f, 0x92, 0x44, 0x3c, 0x11, 0x8a,
+  0x26, 0x0f, 0xc0, 0xa4, 0x0a, 0xd5, 0x75, 0xb2, 0x70, 0xf8, 0x72, 0x2a,
+  0xc6, 0xfe, 0x17, 0x56, 0xdd, 0x5c, 0x44, 0x52, 0x28, 0xf4, 0xf3, 0x35,
+  0x57, 0x50, 0xbc, 0x6e, 0x88, 0x6c, 0x61, 0x8c, 0xa4, 0x9a, 0x12, 0xcb,
+  0x4e, 0x0f, 0x1e, 0x98, 0xc4, 0x70, 0xb4, 0xf4, 0xb9, 0x6c, 0xa6, 0x34,
+  0x7c, 0xfb, 0x2d, 0x25, 0xf5, 0xa9, 0xcd, 0x39, 0x67, 0x02, 0x6d, 0x5b,
+  0x0f, 0x97, 0x51, 0xa5, 0xc2, 0x70, 0x1a, 0xfa, 0xf0, 0x1d, 0x9a, 0xf0,
+  0x7a, 0x67, 0x6b, 0x26, 0x83, 0x2d, 0xa0, 0xbf, 0xb8, 0xdb, 0xd9, 0xce,
+  0x6e, 0x54, 0x43, 0x7c, 0x8a, 0x34, 0x11, 0x6e, 0x8b, 0x3f, 0x69, 0x56,
+  0x5c, 0x01, 0x38, 0x02, 0xd5, 0x70, 0x5e, 0x61, 0xb0, 0xd1, 0x29, 0xc2,
+  0x1c, 0x85, 0xc0, 0x88, 0xa1, 0xa7, 0x1d, 0xb9, 0x9b, 0x34, 0x0a, 0xd3,
+  0x40, 0xa8, 0x7f, 0xab, 0x7a, 0xbc, 0x91, 0x4f, 0xeb, 0x5a, 0x3c, 0x60,
+  0xb2, 0x56, 0x63, 0xe4, 0x0f, 0xa4, 0x17, 0x72, 0x58, 0x8c, 0xe5, 0xeb,
+  0x64, 0xa8, 0x0c, 0x92, 0xfa, 0x2f, 0x22, 0xc3, 0x5b, 0x20, 0x10, 0x80,
+  0xc1, 0xca, 0x44, 0xcb, 0xfb, 0x48, 0x7a, 0x7c, 0x8e, 0xcc, 0xe8, 0x19,
+  0x91, 0x85, 0x9c, 0xa5, 0x5c, 0x5f, 0x20, 0x0f, 0x48, 0x07, 0x5b, 0xbc,
+  0x21, 0xa1, 0x30, 0x06, 0x80, 0x28, 0x17, 0x30, 0x8d, 0xb3, 0xd6, 0xd2,
+  0x03, 0xa0, 0xa9, 0xf2, 0x7f, 0xb8, 0x50, 0xae, 0x73, 0xe2, 0x4c, 0x22,
+  0x9b, 0x4f, 0x69, 0x22, 0x9f, 0x9a, 0x80, 0xe2, 0x0a, 0xaa, 0xcb, 0x51,
+  0x93, 0x1f, 0xa2, 0xfa, 0xbd, 0xcd, 0xbc, 0x94, 0x50, 0x23, 0xd1, 0xf1,
+  0x23, 0x9c, 0xa9, 0xa0, 0x68, 0xa2, 0x8a, 0x67, 0xcd, 0x7e, 0x2d, 0x7f,
+  0xc0, 0x7d, 0x3f, 0x1a, 0x11, 0x72, 0x6e, 0xe6, 0xe4, 0x64, 0x24, 0xee,
+  0x3c, 0xa5, 0x1b, 0xf1, 0xb7, 0xd3, 0x76, 0x94, 0xda, 0x6a, 0x3d, 0xd6,
+  0x4a, 0xd0, 0x46, 0x77, 0x9c, 0xa1, 0x69, 0xee, 0x50, 0x5e, 0x41, 0xb6,
+  0x4d, 0xa0, 0x76, 0x0d, 0xa4, 0x42, 0x3d, 0xb6, 0x1b, 0x9a, 0xda, 0xa7,
+  0x34, 0x9c, 0xc5, 0xa6, 0xe3, 0x87, 0xd1, 0xc9, 0xeb, 0xd8, 0xdd, 0x79,
+  0x72, 0x70, 0x9f, 0xb4, 0x3e, 0xfa, 0x56, 0x34, 0x5e, 0xac, 0x11, 0xde,
+  0xbc, 0x1a, 0x5f, 0x07, 0xb4, 0xa0, 0x66, 0x4a, 0xe3, 0xa8, 0xe5, 0x46,
+  0x01, 0x38, 0xf1, 0x22, 0x74, 0x57, 0xb7, 0xc7, 0x46, 0x8a, 0x1b, 0x6e,
+  0x52, 0xe7, 0xfe, 0xf8, 0x67, 0xc3, 0x12, 0x04, 0x94, 0x55, 0xd2, 0xbc,
+  0xe7, 0x5b, 0xc5, 0x6c, 0xd1, 0x91, 0xa5, 0xdb, 0x0d, 0xdc, 0x29, 0x3e,
+  0x1b, 0x87, 0x32, 0x99, 0x8e, 0x9a, 0x51, 0x74, 0x21, 0x16, 0x4b, 0x80,
+  0x67, 0x8d, 0x73, 0xae, 0x97, 0xf1, 0xdc, 0x35, 0xc5, 0xf6, 0xe2, 0x9b,
+  0x67, 0xf7, 0x9b, 0x96, 0x62, 0x69, 0xf8, 0xae, 0xcd, 0x81, 0xe0, 0xdf,
+  0x16, 0xb1, 0xfc, 0x14, 0x67, 0x44, 0x22, 0xb8, 0x72, 0xf5, 0xbe, 0xd2,
+  0xcf, 0x23, 0x2d, 0xa0, 0x97, 0x52, 0x01, 0xa2, 0xbf, 0x86, 0x74, 0xe2,
+  0x76, 0x57, 0x44, 0x1f, 0x5d, 0x76, 0x94, 0x1d, 0x0a, 0xfc, 0x70, 0x87,
+  0x6b, 0x07, 0x21, 0xdb, 0x36, 0x5c, 0x48, 0x5d, 0xbb, 0xba, 0x85, 0x5d,
+  0x6d, 0x79, 0x3e, 0xe6, 0x7f, 0xd0, 0xd3, 0xd1, 0xf7, 0x33, 0x4e, 0xf6,
+  0x6e, 0x71, 0xc4, 0xa9, 0x85, 0xbd, 0xa5, 0x96, 0x90, 0xa1, 0xf2, 0x8e,
+  0x78, 0x97, 0x07, 0xb8, 0x3e, 0xc1, 0x21, 0xc2, 0x26, 0xb0, 0xab, 0x3d,
+  0xc3, 0xae, 0xaa, 0xd1, 0x7d, 0x51, 0x7a, 0xb7, 0xe4, 0x0a, 0x07, 0xc7,
+  0xf3, 0x58, 0x89, 0xfe, 0x0d, 0xe6, 0x97, 0xe6, 0x14, 0x77, 0x88, 0x21,
+  0xe9, 0x4e, 0x5d, 0x18, 0x6d, 0xa3, 0xdf, 0xf9, 0x7a, 0x90, 0x1f, 0x17,
+  0xae, 0x5c, 0x3c, 0x47, 0xae, 0xbe, 0xf8, 0xe1, 0x36, 0xf3, 0x8d, 0x39,
+  0xee, 0xc2, 0xb0, 0x6f, 0x9d, 0xdd, 0x9f, 0x38, 0x42, 0x44, 0xf5, 0x86,
+  0xcb, 0x3b, 0x70, 0x07, 0x45, 0x40, 0xe7, 0x2b, 0x18, 0x2e, 0xdf, 0x06,
+  0xd5, 0x44, 0xb1, 0xfc, 0x17, 0xe4, 0x41, 0xec, 0x23, 0x92, 0xdb, 0x2d,
+  0xb7, 0xa2, 0xdf, 0x25, 0x63, 0xff, 0xab, 0x1b, 0xe3, 0x72, 0x8e, 0x3b,
+  0xd8, 0x8c, 0xc9, 0xaa, 0xcd, 0xf2, 0xe8, 0xfd, 0x18, 0x5b, 0xa8, 0x9f,
+  0xdc, 0x08, 0x38, 0xaa, 0xf5, 0xc1, 0xd4, 0x42, 0x6a, 0xcf, 0x7f, 0xf7,
+  0x79, 0xd1, 0xb5, 0x97, 0xfb, 0x31, 0x0e, 0x9b, 0x48, 0xdc, 0x0b, 0x78,
+  0x2b, 0x98, 0x5c, 0x8e, 0x03, 0x0a, 0xf5, 0x36, 0x2c, 0xa0, 0xe8, 0x91,
+  0x57, 0xb6, 0xe3, 0x2f, 0xf3, 0x8d, 0xb0, 0x64, 0x81, 0xf3, 0x77, 0x4e,
+  0xf8, 0x5f, 0x75, 0xbf, 0x04, 0x64, 0x7f, 0x86, 0x42, 0x0e, 0xd7, 0xd4,
+  0x6b, 0x4e, 0x4a, 0x89, 0x65, 0xa0, 0x8f, 0x8c, 0xbe, 0x00, 0x91, 0x6a,
+  0x97, 0x3d, 0x73, 0xc9, 0x2d, 0x55, 0x81, 0xf4, 0x03, 0xca, 0x9f, 0x8b,
+  0x9e, 0x97, 0x54, 0x56, 0x09, 0x64, 0x82, 0xfb, 0xbf, 0x3a, 0x7a, 0xa3,
+  0xf3, 0xfe, 0x1b, 0x4b, 0x35, 0xfd, 0xaa, 0xfa, 0x2b, 0xd3, 0x32, 0xdf,
+  0x14, 0x19, 0x10, 0x52, 0xa0, 0xb8, 0x89, 0x34, 0x39, 0xa8, 0x2f, 0xe1,
+  0x62, 0x09, 0xbd, 0xdb, 0xac, 0xcf, 0x40, 0xf7, 0x54, 0x32, 0x76, 0x4a,
+  0x88, 0x03, 0x88, 0xea, 0x71, 0x5c, 0x7d, 0xa2, 0xc8, 0x2a, 0x85, 0x50,
+  0x7d, 0x73, 0xf2, 0xc4, 0x80, 0xf3, 0xd8, 0xc9, 0xe7, 0x18, 0x82, 0xf9,
+  0xde, 0xc3, 0x1c, 0x05, 0x5a, 0x9b, 0xfc, 0xfe, 0x34, 0x64, 0x22, 0xc7,
+  0xad, 0x27, 0x02, 0xfa, 0x83, 0xbe, 0x19, 0xee, 0x9e, 0x13, 0xf9, 0xc5,
+  0x4f, 0x36, 0xf3, 0xbc, 0x7c, 0x42, 0x5f, 0x33, 0xbb, 0xe7, 0x88, 0xc8,
+  0xb8, 0x81, 0x00, 0xb4, 0x0c, 0xf2, 0x8c, 0x97, 0xe9, 0x80, 0x07, 0xda,
+  0x90, 0xc0, 0x3e, 0x94, 0x15, 0x9e, 0xcc, 0x17, 0x42, 0x45, 0xa3, 0x9e,
+  0xf2, 0x0f, 0x79, 0x24, 0x1f, 0x3e, 0x07, 0xe1, 0x20, 0x79, 0x5d, 0x53,
+  0x8e, 0x8a
+};
+unsigned int encrypted_mdc_10k_gpg_len = 8126;
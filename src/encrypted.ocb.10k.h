@@ -0,0 +1,695 @@
+unsigned char encrypted_ocb_10k_gpg[] = {
+  0xc3, 0x3d, 0x05, 0x07, 0x02, 0x03, 0x02, 0x77, 0x4f, 0xa4, 0x55, 0x3f,
+  0x23, 0x97, 0x9c, 0xff, 0x15, 0x24, 0xc1, 0x77, 0xbd, 0xf3, 0x6f, 0x76,
+  0x1a, 0x3d, 0x68, 0xc7, 0x15, 0x50, 0x11, 0x71, 0x3e, 0xf2, 0xf8, 0xb2,
+  0x3e, 0x0c, 0xb1, 0x16, 0x60, 0x68, 0xb6, 0x23, 0x36, 0x87, 0x4a, 0x9d,
+  0x58, 0x95, 0xb8, 0x08, 0x02, 0x62, 0x43, 0x60, 0x2c, 0x70, 0x57, 0x95,
+  0x55, 0x11, 0xb0, 0xd4, 0xea, 0x01, 0x07, 0x02, 0x04, 0x90, 0xbc, 0x5d,
+  0xef, 0xe3, 0xba, 0x3c, 0xb3, 0x09, 0xa0, 0xb6, 0xda, 0x9c, 0x13, 0xd1,
+  0xf7, 0x92, 0xa1, 0x6a, 0x84, 0xe2, 0x52, 0x60, 0xf9, 0x24, 0xc4, 0xfb,
+  0x1f, 0xcf, 0x29, 0xf7, 0x62, 0xee, 0x8d, 0x08, 0x1c, 0x36, 0x78, 0x20,
+  0xc6, 0xcb, 0xb4, 0x55, 0x3b, 0x45, 0x71, 0x70, 0x2e, 0x32, 0xae, 0xe2,
+  0x9e, 0x63, 0x41, 0xda, 0x46, 0x32, 0x76, 0x02, 0x81, 0xde, 0xa6, 0x39,
+  0x2a, 0xa2, 0xc1, 0xd7, 0x0f, 0xb3, 0x6f, 0xc9, 0xd3, 0x96, 0xba, 0x78,
+  0x7f, 0xb5, 0x32, 0x71, 0x66, 0x4b, 0x4e, 0x2a, 0xf3, 0x1b, 0x83, 0xe0,
+  0x1a, 0x3a, 0xc5, 0x58, 0x26, 0x50, 0x73, 0xe7, 0x4b, 0xfc, 0x22, 0xc8,
+  0xc6, 0x4e, 0x45, 0x79, 0x0d, 0x3c, 0x5e, 0x6a, 0xa5, 0xf4, 0x09, 0x08,
+  0x44, 0xb7, 0x63, 0xdc, 0xea, 0x4c, 0x24, 0xc1, 0x9a, 0x8f, 0x62, 0x70,
+  0x39, 0xb7, 0x68, 0x9a, 0xf1, 0x85, 0x57, 0x7f, 0x32, 0x3e, 0x48, 0x6f,
+  0xc3, 0x5c, 0x96, 0x20, 0xc7, 0x64, 0x7f, 0xde, 0x4a, 0x94, 0x6d, 0x78,
+  0x1c, 0x5a, 0xcf, 0x18, 0x69, 0x18, 0x3a, 0x7e, 0x34, 0xfd, 0x93, 0x88,
+  0xa1, 0x47, 0x5b, 0x7b, 0x48, 0x79, 0x9c, 0x1e, 0xb5, 0x48, 0x1c, 0x92,
+  0xe7, 0x74, 0x1d, 0x08, 0x9e, 0x7d, 0x71, 0x61, 0x57, 0x42, 0x38, 0x1d,
+  0x3d, 0x2f, 0x99, 0x88, 0x21, 0x57, 0x0b, 0x02, 0xd6, 0xa5, 0xa3, 0x1e,
+  0x86, 0x43, 0xea, 0xb7, 0xe6, 0x76, 0x82, 0xe2, 0x1e, 0x82, 0x58, 0x09,
+  0xcd, 0x26, 0xa3, 0x63, 0x4d, 0xbf, 0x12, 0xe4, 0x25, 0xa7, 0x00, 0x68,
+  0x47, 0x63, 0xca, 0x9d, 0xb0, 0x22, 0xe3, 0x12, 0x4e, 0x1d, 0xde, 0x36,
+  0xbf, 0x81, 0x80, 0xc6, 0x07, 0x58, 0x5f, 0x4a, 0x16, 0xba, 0xcc, 0x95,
+  0xc5, 0x44, 0x18, 0xb8, 0x5a, 0x15, 0xe5, 0x2a, 0x96, 0xe0, 0x28, 0x25,
+  0x90, 0x8f, 0x99, 0x20, 0xa2, 0xfa, 0xbf, 0xd8, 0x89, 0x21, 0x48, 0xed,
+  0xc2, 0x2d, 0xd3, 0xc3, 0x2c, 0x64, 0x56, 0x1b, 0xb0, 0x40, 0xc1, 0xeb,
+  0x34, 0x58, 0x90, 0x8d, 0xb9, 0x80, 0xfb, 0xf0, 0x78, 0x43, 0x50, 0x1c,
+  0x34, 0x72, 0xd3, 0xf3, 0x4c, 0x76, 0x5f, 0xf5, 0xa9, 0x8e, 0x8b, 0x35,
+  0x26, 0xf1, 0x82, 0x4d, 0x6f, 0x5d, 0x47, 0x2e, 0xbe, 0xb5, 0x05, 0xcc,
+  0x8b, 0xda, 0x50, 0xae, 0x49, 0x79, 0x9b, 0x89, 0x55, 0x37, 0x8f, 0x38,
+  0x7b, 0x68, 0xf6, 0xb3, 0xc7, 0x49, 0xf7, 0xa2, 0xf8, 0xc4, 0x29, 0xa2,
+  0xac, 0x46, 0x38, 0x42, 0x74, 0x50, 0xcc, 0xe3, 0x79, 0x34, 0xb7, 0x2e,
+  0x6d, 0xb4, 0x48, 0x78, 0xc0, 0x69, 0x76, 0xaa, 0x9c, 0x27, 0x2f, 0x36,
+  0x65, 0x39, 0xc3, 0x0c, 0x41, 0x0e, 0x44, 0xd2, 0x11, 0x7a, 0xa5, 0xaf,
+  0xe5, 0x62, 0x00, 0x09, 0x7f, 0x91, 0x0c, 0xbc, 0xa1, 0x83, 0x07, 0xa7,
+  0x47, 0x1a, 0x78, 0xcd, 0xf7, 0xca, 0xd9, 0xe1, 0xc0, 0x18, 0x3c, 0x66,
+  0x9d, 0x0a, 0x12, 0xf6, 0x1a, 0xb1, 0xca, 0x08, 0x25, 0x3f, 0xb5, 0x16,
+  0x97, 0x88, 0x8a, 0x05, 0xaa, 0xab, 0xfb, 0xd1, 0x4c, 0x03, 0x1c, 0x6a,
+  0x05, 0x10, 0x7e, 0xb0, 0x26, 0xfe, 0xda, 0x2d, 0x06, 0xa4, 0x87, 0x9d,
+  0xe2, 0xc3, 0x05, 0x1b, 0x43, 0x28, 0xd7, 0x5e, 0xeb, 0x76, 0x45, 0xd9,
+  0xa3, 0xaf, 0x9e, 0xd4, 0x98, 0xcd, 0x9b, 0x52, 0x51, 0x97, 0x8a, 0x99,
+  0x80, 0xe9, 0x7f, 0x32, 0x2f, 0x91, 0x22, 0xba, 0x05, 0xf3, 0x4a, 0x39,
+  0xaf, 0x4e, 0xac, 0x16, 0xb6, 0x80, 0x08, 0x74, 0xfa, 0x74, 0xce, 0x7a,
+  0xc4, 0xb9, 0x31, 0xde, 0x63, 0xed, 0x8e, 0x2c, 0x4f, 0x74, 0x97, 0xc0,
+  0xa7, 0xac, 0xf3, 0xf0, 0x00, 0xb9, 0xcb, 0xdc, 0xc1, 0x25, 0xed, 0x39,
+  0xf7, 0xf0, 0x2c, 0x40, 0x86, 0xca, 0xc4, 0x68, 0xbb, 0x8c, 0x1c, 0x98,
+  0x37, 0xd1, 0x64, 0x59, 0x66, 0xb1, 0x4e, 0xe2, 0xed, 0x29, 0x4e, 0x3e,
+  0xd7, 0x06, 0x22, 0x3f, 0x7f, 0x81, 0x2b, 0xc5, 0x38, 0x93, 0xa0, 0x9d,
+  0x2d, 0x37, 0x04, 0xa9, 0xb3, 0xf9, 0x74, 0x46, 0xce, 0x6c, 0xb4, 0x4f,
+  0x6c, 0x76, 0x51, 0xb2, 0x27, 0x7b, 0xe5, 0x38, 0x7b, 0x41, 0xfd, 0x69,
+  0x3f, 0x22, 0x3b, 0x0a, 0x81, 0x25, 0x34, 0x6d, 0xab, 0xc8, 0x33, 0xf1,
+  0xfc, 0xf5, 0xc8, 0x28, 0x1f, 0x4d, 0x58, 0x61, 0xba, 0x17, 0x7d, 0xda,
+  0x22, 0x89, 0xe9, 0x13, 0xdb, 0xb6, 0x36, 0xc8, 0x7d, 0xaa, 0xee, 0x85,
+  0x45, 0xb7, 0x6b, 0xd6, 0x96, 0x58, 0x69, 0x77, 0x82, 0x39, 0x34, 0xa2,
+  0x97, 0xb8, 0x3d, 0x88, 0xd7, 0x40, 0xcf, 0xe1, 0x4f, 0xb3, 0x3e, 0x26,
+  0xae, 0x18, 0xeb, 0xd6, 0xa8, 0x66, 0x74, 0xce, 0xdd, 0x40, 0xa6, 0xba,
+  0xbf, 0xe2, 0x3b, 0x00, 0x71, 0x55, 0x95, 0x91, 0xb4, 0x2c, 0xbb, 0x61,
+  0x87, 0xb6, 0xba, 0x81, 0xe3, 0xd8, 0xe9, 0x38, 0x18, 0x60, 0x02, 0x48,
+  0x79, 0x92, 0xdc, 0xb5, 0x34, 0x36, 0xfa, 0x81, 0x3b, 0x31, 0x81, 0x4e,
+  0xff, 0x39, 0xdd, 0xb3, 0x9b, 0x18, 0xd3, 0xbc, 0x75, 0xa9, 0x03, 0xf9,
+  0x1e, 0x12, 0x5f, 0xbc, 0x92, 0x8b, 0x78, 0xd1, 0x7a, 0xf1, 0xd0, 0xf2,
+  0xfb, 0xfe, 0x97, 0x05, 0x73, 0x57, 0x20, 0x77, 0xd3, 0xdd, 0x0f, 0x45,
+  0x5a, 0xbe, 0x7d, 0x48, 0xc3, 0xca, 0x5d, 0xbf, 0x7f, 0x55, 0xda, 0xd3,
+  0x9f, 0x7f, 0xd1, 0x83, 0x23, 0x67, 0x81, 0x9a, 0x6e, 0xd4, 0x9c, 0x75,
+  0xa8, 0x9c, 0x54, 0x4b, 0x3c, 0xf3, 0xc8, 0x6f, 0xf1, 0x4a, 0x0e, 0x43,
+  0x3c, 0x9d, 0x9a, 0x89, 0xbc, 0x4b, 0x62, 0x8e, 0xd5, 0x5d, 0x28, 0x9b,
+  0xae, 0x46, 0xe3, 0xe8, 0xe6, 0x55, 0xd7, 0x71, 0xe9, 0x47, 0x51, 0x90,
+  0x8c, 0x5b, 0x5d, 0x99, 0x1a, 0xe8, 0x8f, 0x01, 0xfb, 0x60, 0x45, 0xd8,
+  0xb3, 0x83, 0xbb, 0x8a, 0x85, 0x39, 0x0c, 0xe6, 0x71, 0x6f, 0x85, 0x25,
+  0x60, 0x8f, 0xae, 0x25, 0x31, 0x65, 0xeb, 0x2b, 0xc3, 0x31, 0x75, 0x03,
+  0x42, 0x46, 0x1a, 0x8d, 0x9b, 0xf3, 0xb9, 0x25, 0x11, 0xe4, 0x4d, 0x41,
+  0xb5, 0xf2, 0x68, 0x7a, 0xce, 0xc4, 0xf3, 0x76, 0x5a, 0x8c, 0xac, 0x98,
+  0x27, 0x12, 0xe4, 0x7d, 0xc7, 0xd9, 0x25, 0x17, 0x5c, 0xd5, 0xec, 0xb6,
+  0xee, 0x89, 0xc9, 0xe6, 0x17, 0x74, 0x01, 0x4a, 0xa0, 0x20, 0x0a, 0xaa,
+  0x1f, 0xc4, 0xd9, 0x7a, 0x8a, 0x45, 0x72, 0x72, 0x98, 0xb8, 0x7a, 0x83,
+  0x77, 0xd5, 0xc6, 0x39, 0x3a, 0xcd, 0x2b, 0x32, 0x69, 0xfe, 0x33, 0x49,
+  0xa4, 0xb0, 0x7c, 0x0b, 0x6c, 0x8c, 0x25, 0x01, 0x9b, 0x73, 0xaf, 0x60,
+  0x6e, 0x50, 0x4a, 0xab, 0x6b, 0xad, 0x41, 0x6b, 0x33, 0xc9, 0x59, 0xb6,
+  0xb7, 0x50, 0xba, 0x52, 0x77, 0x21, 0xea, 0xc7, 0xd3, 0x34, 0x08, 0x60,
+  0xa3, 0x4b, 0x04, 0xcf, 0x89, 0x83, 0x4c, 0x22, 0xfe, 0xf7, 0x4f, 0x26,
+  0xea, 0xe1, 0xab, 0x9d, 0x0e, 0xc4, 0xcb, 0x11, 0xfe, 0xdd, 0x16, 0x09,
+  0x60, 0x89, 0x71, 0xbf, 0x49, 0xff, 0x1b, 0x6f, 0x91, 0x97, 0x84, 0x8c,
+  0xa1, 0x5f, 0x80, 0x3c, 0x1f, 0x29, 0xfc, 0x27, 0x3f, 0x02, 0x3b, 0x57,
+  0x8e, 0x90, 0x0a, 0x1f, 0xca, 0x9b, 0x39, 0x0e, 0x6d, 0xe0, 0x47, 0x6b,
+  0x7e, 0xf9, 0x62, 0xe6, 0x6d, 0xf2, 0xf4, 0x4e, 0x8b, 0x80, 0xcd, 0xe4,
+  0xfc, 0x97, 0x3e, 0x9a, 0xe0, 0x57, 0x95, 0x3a, 0x0a, 0xf2, 0x11, 0x7c,
+  0x7e, 0x0d, 0xd7, 0x79, 0x38, 0x4e, 0x48, 0x91, 0xca, 0x4a, 0xdf, 0x99,
+  0x0c, 0x57, 0xe7, 0x52, 0x4c, 0x36, 0x8f, 0xa1, 0x75, 0xea, 0x95, 0x2e,
+  0x44, 0x27, 0x41, 0xef, 0x7c, 0xc9, 0x35, 0x86, 0x91, 0x15, 0xc3, 0xa2,
+  0xb4, 0x10, 0x27, 0x9a, 0x21, 0xa3, 0x44, 0xdd, 0xc0, 0x31, 0x98, 0x03,
+  0xac, 0xf6, 0x0b, 0x92, 0xe9, 0x78, 0x82, 0x23, 0x5f, 0x80, 0x02, 0x04,
+  0x67, 0x48, 0xce, 0xbf, 0xb8, 0xf8, 0x20, 0xc7, 0xe5, 0x3e, 0x87, 0xa1,
+  0x0b, 0xf6, 0x00, 0x24, 0x57, 0xeb, 0xff, 0x0c, 0x25, 0x4c, 0xff, 0x11,
+  0xbf, 0xb5, 0xd2, 0x59, 0x13, 0xe3, 0x65, 0xe8, 0x41, 0xa9, 0x50, 0x1d,
+  0x0e, 0xeb, 0xf4, 0x79, 0x41, 0x3e, 0x3b, 0x7a, 0xec, 0x02, 0xe8, 0x32,
+  0xc9, 0x6a, 0xc7, 0x9d, 0xbd, 0xde, 0x33, 0xbb, 0xb5, 0xdb, 0x47, 0x29,
+  0xf3, 0xc7, 0x49, 0xd1, 0x7a, 0xa4, 0x31, 0x44, 0x1c, 0x9e, 0x97, 0xa7,
+  0x44, 0x35, 0x90, 0x5a, 0xd0, 0x4f, 0x41, 0x62, 0x48, 0x01, 0x10, 0x7d,
+  0xd0, 0xd0, 0x03, 0x9d, 0x6b, 0x7d, 0x56, 0xc2, 0xe0, 0x2d, 0x0c, 0x36,
+  0xa3, 0x96, 0xdb, 0x64, 0xbd, 0xf9, 0xa9, 0x9d, 0x86, 0x09, 0xfa, 0xd4,
+  0xcf, 0x4c, 0x67, 0x98, 0x0a, 0xf2, 0xf5, 0x9b, 0xdc, 0x8e, 0x54, 0x14,
+  0x19, 0xf7, 0x14, 0xcb, 0x7a, 0xd9, 0x3d, 0x68, 0x9b, 0x01, 0x80, 0x79,
+  0x62, 0xef, 0x55, 0x1a, 0x88, 0xaa, 0x94, 0xe7, 0x3e, 0xaf, 0xec, 0x07,
+  0xf2, 0xf8, 0xfc, 0x19, 0x3a, 0xd8, 0x15, 0xd0, 0xb0, 0x33, 0x5c, 0xe5,
+  0x23, 0x2a, 0x65, 0x4f, 0xb8, 0x89, 0xf6, 0x23, 0x95, 0x4e, 0x90, 0x21,
+  0x22, 0x65, 0xa7, 0x48, 0x80, 0x8e, 0x0b, 0xfb, 0xf3, 0x24, 0xe0, 0xab,
+  0x9e, 0xe6, 0x59, 0x37, 0x3a, 0x4f, 0xab, 0xb5, 0xa5, 0xc0, 0x39, 0xe1,
+  0x3a, 0x58, 0xd9, 0x2b, 0xb7, 0xd6, 0x4a, 0x68, 0x17, 0x6a, 0x00, 0x84,
+  0x3f, 0x72, 0x72, 0xd9, 0xb7, 0xf7, 0x93, 0xcc, 0x50, 0x60, 0xd9, 0x78,
+  0x11, 0x21, 0x68, 0xc4, 0x70, 0xc9, 0xf0, 0xfb, 0x09, 0x4e, 0xae, 0x5f,
+  0x0c, 0xad, 0xea, 0x57, 0xdb, 0x45, 0x9e, 0xf5, 0xec, 0x5f, 0x03, 0xcd,
+  0xfe, 0x2e, 0xbc, 0x43, 0x64, 0xc4, 0xf7, 0x9c, 0xd1, 0x8c, 0x38, 0xc4,
+  0xc6, 0x0f, 0x31, 0x12, 0xb4, 0x54, 0x99, 0x45, 0x9a, 0x81, 0xe2, 0x1e,
+  0x05, 0xec, 0x9f, 0x58, 0xf5, 0x5b, 0x25, 0x7e, 0xd6, 0x8d, 0xf4, 0xda,
+  0x29, 0x2d, 0x78, 0x0a, 0x73, 0x61, 0x05, 0x29, 0x55, 0xc9, 0xcd, 0xae,
+  0x56, 0x21, 0x6e, 0xd9, 0xa6, 0xb1, 0xca, 0x1c, 0x1f, 0xe4, 0x7b, 0x01,
+  0xef, 0x84, 0x50, 0xed, 0x48, 0xe4, 0x58, 0xa8, 0x50, 0x30, 0x54, 0x9c,
+  0xe4, 0xfb, 0x6e, 0xf3, 0x29, 0x48, 0x2d, 0x77, 0x09, 0x26, 0xe5, 0x63,
+  0xe9, 0x5a, 0xcd, 0xf4, 0x2e, 0x0b, 0x7a, 0x67, 0x23, 0xb4, 0x23, 0x41,
+  0x0e, 0x88, 0xd4, 0x3e, 0xc8, 0x0a, 0xc0, 0x25, 0xad, 0xf6, 0x55, 0x76,
+  0xb9, 0x55, 0x63, 0x05, 0x5e, 0xa5, 0x7d, 0x55, 0xc6, 0x0f, 0x5b, 0xd2,
+  0x7e, 0x23, 0x49, 0xb3, 0xe3, 0x55, 0x94, 0x35, 0xc1, 0x45, 0x84, 0x20,
+  0xe2, 0x50, 0x9a, 0xbd, 0xce, 0xfd, 0x28, 0x1a, 0xa9, 0x2a, 0x29, 0x01,
+  0x92, 0xf5, 0xd9, 0x89, 0x72, 0x40, 0x8d, 0x75, 0x47, 0xc6, 0x02, 0xf0,
+  0x43, 0xb7, 0x3a, 0x6a, 0xbe, 0xcd, 0xed, 0x65, 0x4d, 0xc3, 0x16, 0x55,
+  0xce, 0x5f, 0x3e, 0x13, 0xdc, 0x7b, 0x76, 0x50, 0x9a, 0x89, 0x47, 0x50,
+  0x7e, 0x5e, 0x44, 0x93, 0x65, 0xe9, 0x9a, 0xe1, 0x15, 0x23, 0x2a, 0x68,
+  0xa0, 0x69, 0x08, 0xe1, 0x95, 0xd3, 0x6c, 0x25, 0x38, 0x9e, 0xa4, 0xbc,
+  0x33, 0xfb, 0x46, 0xde, 0x00, 0x9b, 0xcf, 0xfe, 0x29, 0x1a, 0x28, 0x83,
+  0xd6, 0x2e, 0x66, 0x7c, 0x85, 0xc4, 0xa8, 0x48, 0x1a, 0x3b, 0x48, 0x32,
+  0x5a, 0x78, 0x86, 0x31, 0x8b, 0xf2, 0xe5, 0x74, 0xcf, 0x8d, 0xca, 0xe6,
+  0xbf, 0xc3, 0x7a, 0x79, 0x4a, 0x69, 0xf5, 0x70, 0x11, 0x26, 0xf7, 0x12,
+  0x71, 0x23, 0xd3, 0x69, 0x78, 0xb3, 0x52, 0x9a, 0xc7, 0x62, 0xc2, 0x90,
+  0xe0, 0x7b, 0x93, 0x84, 0xcf, 0x04, 0xf7, 0xd8, 0x0a, 0x7d, 0x9d, 0xdf,
+  0x13, 0x48, 0xda, 0x81, 0xad, 0xe6, 0x62, 0x35, 0xad, 0x33, 0xaa, 0xb5,
+  0x80, 0xa4, 0x47, 0xe0, 0x01, 0x77, 0x87, 0xa9, 0x82, 0x75, 0x5a, 0x2d,
+  0xf1, 0xb9, 0x00, 0xe4, 0xa6, 0x19, 0x04, 0x2a, 0xc3, 0x02, 0x59, 0xb7,
+  0x4d, 0x1b, 0xeb, 0x34, 0x3f, 0xe1, 0x18, 0x44, 0xc2, 0x8b, 0x95, 0xe6,
+  0xea, 0xe3, 0xac, 0xb0, 0x68, 0xcd, 0xb0, 0xa4, 0x03, 0xb2, 0x09, 0x05,
+  0x75, 0x8c, 0xbb, 0x8f, 0x68, 0x7a, 0x83, 0x81, 0x8a, 0x4b, 0xde, 0x2a,
+  0xf4, 0x5c, 0xf4, 0x06, 0x7c, 0x1a, 0x72, 0xda, 0x1b, 0x86, 0xff, 0x52,
+  0x3e, 0xa5, 0x7c, 0xe9, 0xf9, 0xd5, 0xd0, 0xd2, 0xc1, 0xb6, 0xa5, 0xc6,
+  0xc6, 0xca, 0xcc, 0xd2, 0x25, 0x85, 0x28, 0xb9, 0x62, 0x72, 0xb2, 0x01,
+  0x21, 0x7f, 0x09, 0x81, 0xb1, 0xb1, 0xb6, 0x2a, 0x22, 0x94, 0xfb, 0xb5,
+  0x7a, 0x0d, 0x11, 0x20, 0xc2, 0x57, 0x25, 0x24, 0x2b, 0x7c, 0x29, 0xbd,
+  0x1d, 0x45, 0xbe, 0xcb, 0xbc, 0xa3, 0x30, 0x63, 0x82, 0x75, 0x37, 0xda,
+  0xab, 0xe1, 0x21, 0xef, 0x02, 0x7a, 0x29, 0xf6, 0xc3, 0xbd, 0xb3, 0x02,
+  0xd5, 0x7e, 0x2c, 0x83, 0xdc, 0xa8, 0x1b, 0xec, 0x01, 0x9d, 0x72, 0x39,
+  0x05, 0x1a, 0x17, 0xa6, 0x59, 0x9b, 0x34, 0x31, 0x3a, 0xde, 0xd2, 0xdc,
+  0x86, 0xb3, 0x6c, 0x76, 0xb4, 0x49, 0x3f, 0x65, 0x99, 0x74, 0xc1, 0x15,
+  0x79, 0x72, 0xd3, 0xab, 0xa0, 0xf3, 0x83, 0x90, 0x90, 0xe8, 0x0b, 0xe6,
+  0xda, 0x02, 0x81, 0x99, 0x91, 0xe4, 0x0a, 0x60, 0x1b, 0x5d, 0x89, 0xf8,
+  0xc0, 0xa3, 0xae, 0x99, 0x95, 0x64, 0x9f, 0xa0, 0x5d, 0x4b, 0xb5, 0xbb,
+  0x8b, 0xa2, 0x37, 0x53, 0xfc, 0x70, 0xaa, 0x48, 0xb0, 0x1e, 0xbc, 0xe0,
+  0xed, 0xe1, 0x2f, 0xfe, 0xbb, 0xd7, 0xa1, 0x93, 0x41, 0xf3, 0x09, 0xf4,
+  0xac, 0xbf, 0xf1, 0x22, 0x4c, 0xab, 0xd3, 0x59, 0xe8, 0x50, 0x9a, 0xe8,
+  0xc4, 0xac, 0xce, 0x6a, 0x47, 0xc8, 0x25, 0xf5, 0x50, 0x16, 0xb9, 0x20,
+  0x51, 0x5e, 0x77, 0x97, 0xc6, 0xf2, 0x2e, 0x1a, 0x5f, 0x61, 0xc6, 0xea,
+  0x7e, 0x14, 0x9f, 0x9c, 0x4c, 0xea, 0xc2, 0x14, 0x57, 0x94, 0x7f, 0x62,
+  0xba, 0x61, 0x96, 0xf8, 0xe3, 0xfe, 0x9d, 0xb2, 0x54, 0xb3, 0xef, 0x88,
+  0xda, 0x75, 0x1c, 0xf5, 0xa2, 0x70, 0x7a, 0xa9, 0xc8, 0xc3, 0x8f, 0x49,
+  0xa1, 0x57, 0x03, 0xa4, 0xee, 0xd8, 0x8d, 0xce, 0x28, 0xfe, 0xbb, 0x7c,
+  0xf5, 0x40, 0x60, 0xd9, 0x6f, 0xff, 0xfc, 0xca, 0x89, 0x70, 0x13, 0x27,
+  0xe8, 0xf4, 0x26, 0x40, 0x76, 0xbc, 0x54, 0xc7, 0xb0, 0xdb, 0xcb, 0xa7,
+  0x9d, 0x81, 0x2d, 0xe3, 0x7a, 0x5a, 0x67, 0x41, 0x7b, 0xb3, 0x5c, 0x1c,
+  0xe1, 0xc1, 0x39, 0x79, 0xe0, 0x04, 0xae, 0x4b, 0xb6, 0x17, 0x56, 0xcd,
+  0x9f, 0xc7, 0xe5, 0x75, 0xd5, 0x48, 0xc3, 0x35, 0x18, 0x9b, 0x17, 0xfa,
+  0xfa, 0xed, 0x2e, 0xb2, 0xcb, 0x63, 0xd4, 0x9c, 0x52, 0xb7, 0xfd, 0x1e,
+  0x45, 0x59, 0x21, 0x1c, 0x25, 0x9b, 0x83, 0x1e, 0x6f, 0x29, 0x53, 0x5a,
+  0xa6, 0x4a, 0x79, 0x6d, 0xd4, 0xce, 0x85, 0x35, 0xd0, 0x97, 0x7f, 0xfe,
+  0x51, 0x0b, 0xc4, 0x69, 0x89, 0x2f, 0x4d, 0xec, 0x66, 0xfe, 0x0d, 0x9d,
+  0xec, 0xeb, 0xe4, 0xbf, 0x7d, 0xec, 0x82, 0x83, 0xa0, 0x93, 0x6a, 0xbb,
+  0x6d, 0x47, 0x4d, 0xb1, 0xd8, 0xff, 0xaa, 0x29, 0xad, 0x35, 0xf4, 0x00,
+  0xba, 0xb7, 0xea, 0xd1, 0xe4, 0xbe, 0xb9, 0xd1, 0xd0, 0x1e, 0x23, 0x09,
+  0x02, 0xa2, 0xf9, 0x6d, 0x4b, 0xc0, 0x7b, 0xf8, 0xed, 0x27, 0x09, 0x5a,
+  0x77, 0xf2, 0xa0, 0xcb, 0x95, 0x03, 0x49, 0x55, 0x06, 0x68, 0x27, 0xc9,
+  0x29, 0x8d, 0x54, 0x4d, 0x80, 0x2b, 0x2a, 0xc4, 0x07, 0xc6, 0x4a, 0x30,
+  0x81, 0xff, 0xea, 0xb4, 0xdb, 0x82, 0x2a, 0x39, 0xd5, 0x45, 0xa3, 0x86,
+  0xd6, 0x7c, 0x93, 0x29, 0xa0, 0xda, 0x19, 0x7e, 0x6a, 0xf4, 0x5a, 0x67,
+  0x19, 0xa1, 0x6c, 0x3c, 0x21, 0x78, 0x9a, 0x25, 0x57, 0x9a, 0x99, 0x18,
+  0x93, 0x9a, 0xbc, 0x3b, 0x5c, 0xf0, 0xe0, 0x72, 0x41, 0x47, 0xa4, 0x51,
+  0x86, 0x58, 0x86, 0xe9, 0xdf, 0x24, 0xb6, 0x1d, 0x59, 0x22, 0xa1, 0x10,
+  0x9f, 0x9e, 0x31, 0xd1, 0x5a, 0x02, 0xc7, 0x02, 0xf3, 0x19, 0x8d, 0x6a,
+  0xf7, 0x12, 0xb1, 0x60, 0x2a, 0xaa, 0x4c, 0x18, 0xc0, 0xa1, 0xa6, 0x9f,
+  0x32, 0xba, 0xd1, 0xf5, 0x00, 0x44, 0x17, 0x2d, 0x9d, 0x11, 0xbb, 0xcd,
+  0x1d, 0xb1, 0xd2, 0x17, 0x73, 0x93, 0x8f, 0x16, 0xf6, 0x26, 0x0f, 0xd3,
+  0xc7, 0x2d, 0xa4, 0x1c, 0x38, 0xf0, 0x0e, 0xfe, 0x92, 0x92, 0xd7, 0xc1,
+  0x55, 0xbb, 0xa3, 0x11, 0x2c, 0x3c, 0x62, 0x76, 0x72, 0x5e, 0xe4, 0x0b,
+  0xd8, 0x32, 0xe0, 0xff, 0x18, 0xba, 0x65, 0x1c, 0x91, 0x38, 0xfb, 0x21,
+  0xcc, 0x91, 0x15, 0xcf, 0x32, 0x71, 0x17, 0x1d, 0x99, 0x36, 0x85, 0x27,
+  0x86, 0xc4, 0x49, 0xf3, 0x4b, 0xff, 0x16, 0xbb, 0x82, 0x45, 0x71, 0x41,
+  0x89, 0x53, 0x14, 0x45, 0x40, 0x15, 0x50, 0xe6, 0xd2, 0x3f, 0x9e, 0xf0,
+  0xd6, 0xf0, 0xbf, 0x9f, 0x71, 0x84, 0xe5, 0x9f, 0x53, 0xbc, 0xd2, 0x20,
+  0xdd, 0xf5, 0x62, 0x92, 0xd3, 0x71, 0xf0, 0x64, 0x15, 0xb1, 0xac, 0xdd,
+  0x37, 0x73, 0xe6, 0xbb, 0x98, 0xae, 0x4a, 0xcd, 0xa6, 0xc7, 0xa9, 0x2e,
+  0x8b, 0x0e, 0x45, 0x56, 0x19, 0x5e, 0x8e, 0x23, 0xb9, 0xb4, 0xac, 0xe1,
+  0x75, 0x1d, 0xe2, 0x5e, 0xd7, 0x3f, 0x0c, 0x48, 0x64, 0x63, 0xf3, 0xa7,
+  0x8e, 0xf8, 0x2a, 0xee, 0x13, 0xe1, 0x16, 0xac, 0x8e, 0x4d, 0x39, 0x05,
+  0x64, 0x7c, 0xb2, 0x0a, 0x57, 0x47, 0x16, 0x99, 0x71, 0x72, 0xb9, 0xdf,
+  0x32, 0xf1, 0xb4, 0x3a, 0x9f, 0x2e, 0xaf, 0xe9, 0x3b, 0x89, 0xc2, 0x15,
+  0x2a, 0x4d, 0x0b, 0xca, 0x2d, 0x37, 0x50, 0xd9, 0xba, 0xa3, 0xb8, 0xd5,
+  0x70, 0x10, 0x5f, 0xd6, 0x22, 0x9d, 0x6e, 0x3e, 0x7a, 0xbe, 0xbc, 0x14,
+  0xcf, 0x74, 0xfc, 0x04, 0xa2, 0x17, 0x0e, 0x5c, 0x96, 0xfd, 0xce, 0x4a,
+  0x51, 0x0e, 0xc0, 0xff, 0x5c, 0x39, 0x3d, 0x8b, 0x0c, 0x81, 0x7b, 0xde,
+  0x70, 0xa0, 0xbf, 0x14, 0xc8, 0xda, 0xa7, 0x30, 0x0d, 0xb5, 0x53, 0x09,
+  0xaa, 0x28, 0xa2, 0x62, 0xb4, 0xc9, 0xf6, 0xd0, 0x29, 0x42, 0xb4, 0x79,
+  0x00, 0x27, 0x9b, 0x65, 0x91, 0xb2, 0x1b, 0xe2, 0xd3, 0x84, 0xde, 0xa1,
+  0xa7, 0x64, 0x0a, 0xb2, 0xe8, 0x1d, 0x5c, 0x9e, 0x34, 0x7f, 0xc7, 0xf5,
+  0x74, 0xb0, 0x91, 0x0c, 0x6a, 0x31, 0x35, 0xba, 0x8b, 0x70, 0x43, 0xb2,
+  0x41, 0x0c, 0x99, 0x80, 0x6f, 0xcd, 0x52, 0xf6, 0xb6, 0xef, 0xcb, 0x29,
+  0xa9, 0xf7, 0x7e, 0xbd, 0xad, 0xc4, 0x70, 0xe1, 0xa6, 0xcb, 0xc5, 0xd5,
+  0x67, 0x23, 0x09, 0x6d, 0xba, 0x3f, 0x63, 0x27, 0x8d, 0x8f, 0x3e, 0x98,
+  0x3c, 0x37, 0x49, 0xb5, 0x96, 0x50, 0x69, 0xb0, 0xd7, 0x69, 0x45, 0x1d,
+  0xa0, 0xc3, 0xb6, 0x3c, 0xaf, 0x42, 0x3b, 0x25, 0x36, 0x5a, 0x48, 0x08,
+  0xeb, 0xdc, 0x52, 0x11, 0x89, 0x15, 0x2b, 0xcc, 0x24, 0x6d, 0x80, 0xe3,
+  0x1c, 0x59, 0xf6, 0xc5, 0x06, 0x48, 0xee, 0xa6, 0xb7, 0xed, 0xa4, 0x57,
+  0x68, 0xa8, 0x54, 0xfb, 0x3f, 0x95, 0x68, 0x0d, 0x60, 0x55, 0x68, 0x4d,
+  0x48, 0x4a, 0x49, 0x0a, 0x60, 0x36, 0xf7, 0x77, 0x63, 0xa3, 0x6a, 0x0e,
+  0x7f, 0xe4, 0x2c, 0x79, 0x8f, 0x9a, 0x42, 0x07, 0x55, 0xb1, 0xd6, 0xa2,
+  0x82, 0x1b, 0x16, 0xe6, 0x64, 0x64, 0xfb, 0x4c, 0x91, 0x47, 0xd0, 0xe0,
+  0x51, 0x6f, 0x67, 0xe9, 0x74, 0xab, 0xc5, 0xa8, 0xbd, 0x7f, 0xa2, 0x3d,
+  0xeb, 0x5f, 0x84, 0x6a, 0xda, 0xfc, 0x6b, 0x29, 0x72, 0xdb, 0xeb, 0xd2,
+  0xd5, 0xb6, 0xd3, 0x0f, 0x12, 0xc6, 0xf7, 0x8c, 0x28, 0xf9, 0x2d, 0xa5,
+  0x56, 0x88, 0xec, 0x3f, 0x8e, 0x16, 0x51, 0x93, 0x86, 0x25, 0xa9, 0x1d,
+  0x8f, 0x6d, 0xb9, 0xc5, 0x61, 0x95, 0xde, 0xe0, 0x41, 0xe7, 0x89, 0x51,
+  0x62, 0xa2, 0x86, 0x84, 0x00, 0xa3, 0x6a, 0x47, 0xb1, 0x5c, 0xcc, 0x3a,
+  0xe0, 0xfd, 0xcf, 0xfe, 0xe0, 0xdb, 0x5a, 0x57, 0xd6, 0xad, 0x99, 0xa1,
+  0x47, 0x2f, 0xfc, 0x21, 0xb8, 0x08, 0xdd, 0x58, 0x1e, 0xb7, 0xe7, 0xd4,
+  0x44, 0x35, 0x75, 0xd8, 0xc2, 0xca, 0x33, 0xa4, 0x63, 0xa9, 0x9a, 0x6a,
+  0x76, 0xdf, 0xcb, 0x61, 0x89, 0x11, 0x93, 0x2a, 0xf9, 0x21, 0xc4, 0xa1,
+  0x00, 0x50, 0xf4, 0x83, 0xa6, 0x09, 0xef, 0xec, 0x3b, 0xf5, 0x5f, 0xe1,
+  0x00, 0xeb, 0xc0, 0x1f, 0x1c, 0xc3, 0x37, 0x9a, 0xfe, 0x28, 0xec, 0xe2,
+  0x5a, 0x7d, 0xfd, 0x85, 0x54, 0x0f, 0xd1, 0xbe, 0x37, 0xfd, 0xb8, 0x3b,
+  0x9f, 0xc9, 0xdf, 0xef, 0x42, 0x6d, 0x1a, 0x4c, 0x7d, 0x61, 0x9e, 0xba,
+  0x12, 0x04, 0x67, 0x72, 0x00, 0x2a, 0xc2, 0x0d, 0xd7, 0x1f, 0xca, 0xc8,
+  0x3f, 0xba, 0x0d, 0xdf, 0x33, 0x40, 0xf8, 0x0d, 0xf5, 0x2c, 0xec, 0x6b,
+  0x15, 0x2f, 0xee, 0x7a, 0x91, 0xb9, 0x44, 0x85, 0xcc, 0xfa, 0xb4, 0x30,
+  0xfe, 0xc4, 0xd2, 0x0f, 0x1b, 0x4a, 0x59, 0xca, 0xd7, 0x81, 0xe2, 0x83,
+  0x0a, 0x4b, 0x91, 0xfb, 0xa4, 0x46, 0xf9, 0x29, 0x7a, 0x3e, 0x9f, 0x6f,
+  0xf8, 0x36, 0xa1, 0xea, 0xc3, 0x88, 0x0c, 0xfb, 0xb6, 0x9d, 0x73, 0xda,
+  0xa0, 0x4f, 0x56, 0xb8, 0x6e, 0xa2, 0x53, 0x02, 0xe8, 0x5f, 0x70, 0x10,
+  0xc4, 0x38, 0xfe, 0x1d, 0xd2, 0xa8, 0xc5, 0xba, 0x61, 0xd1, 0xb7, 0xee,
+  0x2e, 0x82, 0x18, 0x85, 0x0c, 0xbc, 0x73, 0x0b, 0x3e, 0xb4, 0xee, 0xd4,
+  0xab, 0xe6, 0x63, 0xc4, 0x7b, 0x9e, 0x43, 0xaf, 0x01, 0x46, 0x1a, 0xc1,
+  0x56, 0x63, 0xbe, 0xc0, 0xf1, 0x63, 0xd4, 0x53, 0x64, 0x54, 0x37, 0x9d,
+  0xb1, 0xd2, 0x28, 0x16, 0xc2, 0x27, 0x8d, 0x3c, 0x33, 0xbb, 0x73, 0xc1,
+  0xa6, 0x80, 0x87, 0x0b, 0xeb, 0x92, 0xdc, 0x7c, 0x5e, 0xff, 0xb3, 0x16,
+  0x55, 0x66, 0x16, 0x69, 0x60, 0xe3, 0xbc, 0x90, 0x4b, 0x8f, 0x73, 0xdc,
+  0xe4, 0xea, 0x25, 0x2b, 0xf1, 0xe5, 0x59, 0x34, 0x2c, 0xd2, 0x6b, 0xfc,
+  0x82, 0x6d, 0xc2, 0xd2, 0x3c, 0xae, 0xc1, 0xf5, 0x77, 0xf3, 0xeb, 0x59,
+  0x24, 0xc5, 0x07, 0x2d, 0x00, 0x6f, 0x89, 0x04, 0xa3, 0x49, 0x76, 0x15,
+  0x3d, 0x1b, 0xa8, 0xf2, 0x39, 0xa6, 0x5b, 0x5f, 0xe5, 0x87, 0x84, 0xb9,
+  0x5d, 0xd5, 0x57, 0xe6, 0x95, 0xa2, 0x6d, 0x7f, 0xac, 0x55, 0x68, 0x47,
+  0x9c, 0x1e, 0xeb, 0x8c, 0x40, 0x0f, 0x59, 0x7a, 0xaa, 0x2d, 0xea, 0x75,
+  0x67, 0x57, 0xa9, 0x23, 0x48, 0xc1, 0x9a, 0xcf, 0x81, 0xfb, 0x2b, 0xc0,
+  0x78, 0xf1, 0xed, 0x7e, 0x34, 0xa0, 0x36, 0x99, 0xe1, 0xef, 0xe6, 0xe6,
+  0x7c, 0x76, 0x54, 0xfd, 0x44, 0x32, 0xed, 0x19, 0xdc, 0x3b, 0xaa, 0x9f,
+  0xa2, 0x08, 0xe6, 0x9a, 0x48, 0x5f, 0x08, 0x7f, 0xf4, 0x48, 0xd9, 0x66,
+  0x3e, 0x0d, 0x4d, 0xe5, 0x82, 0x31, 0xba, 0xea, 0xdf, 0xac, 0x67, 0x79,
+  0x3e, 0xcf, 0x69, 0xae, 0x37, 0x83, 0x29, 0xee, 0xb0, 0x0f, 0xa9, 0x0f,
+  0x71, 0xc2, 0xac, 0xa7, 0x3e, 0xdc, 0x18, 0xad, 0xd6, 0x61, 0x0a, 0x6e,
+  0xd0, 0x3e, 0x97, 0x3b, 0x24, 0xa9, 0x05, 0x75, 0x38, 0x85, 0xdf, 0xd3,
+  0xc5, 0xd2, 0x68, 0xa9, 0xf4, 0x90, 0x51, 0x37, 0xa4, 0x38, 0x63, 0xdf,
+  0xfd, 0xd3, 0x19, 0xd3, 0x2c, 0x04, 0x59, 0xc1, 0x07, 0x4a, 0x4a, 0x96,
+  0xc3, 0x9a, 0x9b, 0x84, 0x9f, 0x86, 0x9a, 0x69, 0x0a, 0x42, 0x5f, 0x81,
+  0x62, 0x30, 0xc3, 0x5c, 0x06, 0x1f, 0xbb, 0x63, 0xcc, 0x3c, 0x60, 0x45,
+  0xce, 0xc8, 0x5c, 0x39, 0x54, 0x47, 0x3b, 0x2b, 0xbc, 0x05, 0x95, 0x17,
+  0xf0, 0xb2, 0xc9, 0x8f, 0x84, 0xba, 0x30, 0x2b, 0x14, 0x9a, 0x14, 0x07,
+  0x1a, 0x4b, 0x5f, 0x08, 0x9f, 0x06, 0x9f, 0xcf, 0xec, 0x46, 0xbc, 0x7e,
+  0xc9, 0x62, 0x5b, 0x55, 0x96, 0xfb, 0xa7, 0x76, 0x5e, 0xbe, 0xf9, 0xe3,
+  0xb0, 0xfe, 0x5b, 0xd0, 0xdc, 0x2b, 0x33, 0xec, 0x76, 0xbf, 0x32, 0xac,
+  0x18, 0x76, 0xce, 0xb3, 0xef, 0x17, 0xf8, 0x67, 0x6d, 0x43, 0x5c, 0xd8,
+  0xb7, 0x20, 0x46, 0x75, 0xaa, 0x10, 0x1f, 0xd9, 0x13, 0xa0, 0xe8, 0x76,
+  0xa1, 0x33, 0x7e, 0xde, 0x20, 0x53, 0x19, 0x87, 0x4c, 0x8e, 0x34, 0x29,
+  0xf9, 0xab, 0x27, 0x8b, 0x3c, 0xcd, 0x58, 0x1d, 0xe6, 0x2d, 0x9a, 0x22,
+  0x8e, 0xd6, 0xfc, 0xcb, 0x25, 0xbc, 0xa9, 0x91, 0x8a, 0x71, 0x7c, 0x9a,
+  0x62, 0x18, 0x3b, 0x5e, 0x7b, 0x66, 0x14, 0x50, 0x0c, 0x18, 0x98, 0x5f,
+  0x36, 0x26, 0xca, 0xc6, 0x8c, 0x03, 0x17, 0x55, 0x8b, 0x49, 0xaa, 0x27,
+  0x4c, 0x22, 0xb9, 0x2b, 0xa1, 0x18, 0xb3, 0x14, 0xfe, 0x9a, 0xd1, 0x6b,
+  0x68, 0x47, 0xf2, 0x49, 0xf1, 0xb8, 0xe8, 0xf2, 0x8d, 0xec, 0x93, 0x00,
+  0x5c, 0x10, 0x39, 0x40, 0x6d, 0x81, 0xc8, 0x1e, 0x2b, 0x94, 0x7d, 0x86,
+  0xfa, 0xfb, 0x70, 0x1b, 0x02, 0x64, 0xdf, 0x3f, 0x50, 0x07, 0xac, 0x4c,
+  0xc7, 0x5f, 0x1c, 0xb1, 0x1d, 0x60, 0xaf, 0x24, 0x3b, 0x6c, 0xd0, 0xf2,
+  0xde, 0xb3, 0x72, 0xb5, 0x33, 0xb0, 0x53, 0xe1, 0x02, 0xbe, 0x68, 0x84,
+  0xbd, 0xbc, 0x92, 0xf9, 0x89, 0x87, 0xd2, 0xb0, 0x6d, 0xba, 0x4a, 0xf6,
+  0x3a, 0x16, 0xee, 0xb3, 0x64, 0xd1, 0xfa, 0x0a, 0x71, 0x9e, 0x19, 0x93,
+  0x8c, 0x32, 0x41, 0x86, 0xb1, 0x54, 0x90, 0x9a, 0x2c, 0x47, 0xb9, 0xa8,
+  0x14, 0x8d, 0x92, 0x5b, 0x61, 0x40, 0x1a, 0x50, 0x89, 0xfe, 0x54, 0x2b,
+  0x22, 0x9a, 0x2f, 0x2d, 0xc0, 0x72, 0xf0, 0x68, 0x99, 0x20, 0x62, 0x22,
+  0x24, 0xc5, 0x7f, 0x2b, 0x2b, 0xfe, 0x54, 0x2e, 0x37, 0xcf, 0x5b, 0x6c,
+  0x5f, 0x60, 0x53, 0xf9, 0x58, 0xb6, 0x45, 0xaf, 0x09, 0x1b, 0xdd, 0x02,
+  0xcd, 0x42, 0x76, 0x86, 0xe9, 0x44, 0x2f, 0xa5, 0x20, 0x40, 0xd8, 0xaa,
+  0xb2, 0x35, 0xee, 0x99, 0xe5, 0xb6, 0xc4, 0x06, 0x47, 0xc2, 0xec, 0x9a,
+  0xb7, 0x84, 0xfd, 0x25, 0xc5, 0x1d, 0x03, 0xbd, 0xdf, 0xc8, 0x09, 0x80,
+  0xf0, 0xe9, 0x8e, 0xe0, 0x69, 0x04, 0x3d, 0x5a, 0xed, 0x9e, 0x33, 0xc8,
+  0x49, 0xdd, 0xac, 0xa7, 0xf5, 0x7a, 0xe5, 0x2c, 0x75, 0xf8, 0xed, 0x72,
+  0x16, 0xe4, 0x1e, 0xaa, 0x21, 0x2e, 0xe5, 0x07, 0xb1, 0x65, 0x1f, 0x68,
+  0x91, 0x9e, 0x56, 0x58, 0x47, 0x6f, 0x75, 0xe1, 0xfb, 0x44, 0x46, 0x56,
+  0xc4, 0xa4, 0x8f, 0xa7, 0x36, 0xc3, 0x71, 0x5f, 0x0d, 0xc5, 0xd2, 0x4d,
+  0xee, 0x51, 0x66, 0xde, 0xfb, 0xeb, 0x75, 0x8f, 0xc1, 0x88, 0x30, 0x4f,
+  0x3a, 0x7d, 0xec, 0xb5, 0xd4, 0x6f, 0x0a, 0xe9, 0x0f, 0x74, 0xeb, 0xad,
+  0xb3, 0x15, 0x93, 0x70, 0x9c, 0x7e, 0xd6, 0xf2, 0x4e, 0xf5, 0x44, 0xb6,
+  0x02, 0x57, 0xe9, 0x4c, 0x11, 0xab, 0x51, 0xb9, 0xf9, 0x77, 0x28, 0x30,
+  0xc4, 0xad, 0x83, 0x9a, 0x7d, 0xf3, 0x95, 0x98, 0xc0, 0xdb, 0xea, 0x73,
+  0xa5, 0xa2, 0x36, 0x62, 0xb6, 0x95, 0x21, 0xa8, 0xf0, 0x4d, 0xfe, 0x94,
+  0x81, 0x5e, 0xd7, 0xfb, 0x55, 0x46, 0xe4, 0x2b, 0x29, 0x10, 0xd8, 0xef,
+  0x71, 0xc8, 0xd9, 0x38, 0xd2, 0xf9, 0xbc, 0x9b, 0x53, 0x33, 0x75, 0x0c,
+  0xfb, 0x14, 0xf1, 0x80, 0x26, 0xe0, 0x00, 0xbe, 0x92, 0x57, 0xc2, 0x80,
+  0x9e, 0x8c, 0xba, 0xa6, 0xea, 0x6b, 0x20, 0x1c, 0x2d, 0xb1, 0x0b, 0x0f,
+  0x70, 0xed, 0x91, 0xe6, 0xbb, 0x9b, 0x6a, 0x72, 0x7c, 0x27, 0xf5, 0xb9,
+  0x93, 0xdf, 0xa0, 0xb0, 0x37, 0xac, 0xaf, 0x74, 0x32, 0x4a, 0x8d, 0xed,
+  0x39, 0x95, 0x71, 0x96, 0x7d, 0xa7, 0xa0, 0x32, 0x02, 0x98, 0x3a, 0x58,
+  0x61, 0x00, 0x9c, 0xf9, 0x5c, 0x43, 0x89, 0x35, 0xdd, 0xe0, 0xb2, 0x36,
+  0x10, 0xd0, 0x57, 0xef, 0x04, 0x05, 0x5e, 0x38, 0x90, 0x3f, 0xd3, 0xcf,
+  0xa3, 0xd6, 0x07, 0xc3, 0xcb, 0xe1, 0x6a, 0x47, 0x50, 0x30, 0x36, 0x43,
+  0xc9, 0x34, 0xe4, 0xae, 0x62, 0xe2, 0x82, 0xa3, 0x12, 0xad, 0xe0, 0x8f,
+  0x27, 0x72, 0x7a, 0xa8, 0x5b, 0xb9, 0x90, 0x93, 0x34, 0x74, 0x37, 0xfd,
+  0x1d, 0x0e, 0xb6, 0x13, 0x73, 0xc5, 0xdc, 0xf1, 0xec, 0x70, 0xbd, 0x05,
+  0x7b, 0x65, 0xec, 0x4a, 0x96, 0xd6, 0xc1, 0x65, 0x67, 0x97, 0x3a, 0x1e,
+  0x9e, 0xb6, 0x89, 0x87, 0xac, 0xa5, 0xd1, 0xbf, 0x5a, 0xc5, 0xce, 0x10,
+  0xba, 0x70, 0x8a, 0xd8, 0x05, 0xa0, 0x8c, 0x25, 0x8f, 0x44, 0xd6, 0xd5,
+  0xa5, 0x22, 0x1f, 0x69, 0x1a, 0xbe, 0x79, 0x83, 0x87, 0x73, 0x77, 0x06,
+  0xb7, 0x8a, 0xc4, 0x30, 0x4d, 0xeb, 0xd6, 0x1d, 0xf6, 0x4d, 0x66, 0x2d,
+  0x85, 0x44, 0x2f, 0xa5, 0x73, 0x37, 0x40, 0x8e, 0xe1, 0x8c, 0x0c, 0x66,
+  0x8f, 0x32, 0xf9, 0xaf, 0xce, 0x82, 0x28, 0xf4, 0x8d, 0xe8, 0xd8, 0x28,
+  0xaf, 0xc0, 0x7e, 0xa1, 0xe6, 0x69, 0x50, 0xd5, 0xa0, 0x98, 0x44, 0x03,
+  0xda, 0xba, 0xa4, 0xa8, 0xd2, 0x4a, 0xf7, 0xdc, 0xf7, 0x2d, 0x6a, 0x47,
+  0x11, 0xb9, 0xfb, 0x7f, 0xf3, 0xe9, 0x28, 0x85, 0xc0, 0xfc, 0xaf, 0x12,
+  0x47, 0xe7, 0x3c, 0x11, 0x3a, 0xc7, 0x97, 0x47, 0xc9, 0xcd, 0x43, 0xf3,
+  0x38, 0x79, 0x24, 0xf0, 0xad, 0x06, 0x0a, 0x97, 0xdc, 0x50, 0x15, 0x3d,
+  0x5c, 0xe7, 0xbc, 0x28, 0x03, 0xac, 0x9e, 0xe0, 0xc7, 0x28, 0x2a, 0x95,
+  0x64, 0x17, 0x26, 0x85, 0x81, 0x2c, 0x5e, 0xb4, 0x27, 0xf9, 0xf5, 0x08,
+  0x7a, 0xe0, 0x9c, 0xc6, 0xc0, 0x24, 0xaa, 0x74, 0x34, 0xba, 0x03, 0x74,
+  0x8c, 0xc2, 0x4b, 0x98, 0x9a, 0x9a, 0xe0, 0xd7, 0x5c, 0xa3, 0x0e, 0x0a,
+  0x2b, 0xe5, 0xd8, 0x3b, 0x18, 0xb3, 0xf2, 0x48, 0xbc, 0xfe, 0xc5, 0xfa,
+  0x21, 0xea, 0x01, 0xb7, 0x5e, 0x1e, 0xa4, 0x00, 0x2c, 0xe0, 0xac, 0x5d,
+  0xdd, 0xa5, 0xcf, 0x0b, 0x37, 0xb6, 0x2e, 0x26, 0x97, 0x5e, 0xf2, 0xeb,
+  0x3f, 0x19, 0x75, 0x97, 0xf1, 0x0d, 0x49, 0x82, 0xed, 0xeb, 0xa9, 0xd2,
+  0x77, 0x35, 0x31, 0xe9, 0x42, 0xab, 0xbf, 0xeb, 0xfa, 0xb7, 0xae, 0xdd,
+  0x09, 0x70, 0x87, 0x20, 0x2f, 0x59, 0x24, 0xdd, 0x9d, 0x68, 0x37, 0xb9,
+  0x0e, 0x8e, 0x01, 0x7d, 0x36, 0xb6, 0xfa, 0x1b, 0xb5, 0x98, 0x3e, 0x3d,
+  0x7d, 0xc2, 0x2a, 0xe4, 0xc7, 0xa7, 0xa9, 0x5b, 0x45, 0xbf, 0x8d, 0xea,
+  0x6a, 0x7d, 0x7a, 0x46, 0x34, 0x3a, 0x1a, 0x3a, 0xdd, 0xc4, 0xa5, 0x23,
+  0x35, 0x00, 0x1d, 0xa3, 0xba, 0xab, 0x25, 0x36, 0xab, 0x3b, 0x09, 0xee,
+  0xea, 0xbe, 0x40, 0x24, 0xeb, 0x2c, 0x59, 0xc2, 0x33, 0x2a, 0x35, 0xd3,
+  0x2a, 0x16, 0x0f, 0x89, 0x2f, 0xd0, 0x27, 0x8f, 0x21, 0x61, 0xfc, 0xad,
+  0x47, 0x90, 0x65, 0x2e, 0xc9, 0x5e, 0x85, 0x4e, 0xfa, 0xe3, 0x4c, 0x56,
+  0x9a, 0xb1, 0xff, 0x22, 0x51, 0x81, 0xf1, 0x21, 0x64, 0x9e, 0x1f, 0x21,
+  0x84, 0x25, 0xaf, 0x85, 0xd3, 0xde, 0xbe, 0x73, 0xc2, 0x9b, 0xc4, 0x98,
+  0xda, 0xa9, 0x3b, 0x4f, 0x17, 0xd4, 0x85, 0x13, 0xb7, 0xb0, 0xba, 0x6c,
+  0x0b, 0x8c, 0xa6, 0x2b, 0x19, 0x3c, 0xc7, 0xad, 0x51, 0x05, 0x84, 0xd5,
+  0x57, 0x06, 0x4f, 0xad, 0x2c, 0xf1, 0xdf, 0x2c, 0x5b, 0x60, 0xd0, 0xa9,
+  0x37, 0xaa, 0x01, 0xbf, 0x2a, 0xb4, 0x51, 0x08, 0x7d, 0x34, 0xa1, 0x4a,
+  0x52, 0xc2, 0x10, 0x9c, 0x2c, 0x54, 0xc4, 0x75, 0x05, 0x35, 0x41, 0x34,
+  0xad, 0xc1, 0x7a, 0xe4, 0xd3, 0x3f, 0x50, 0xd4, 0xda, 0x81, 0x4d, 0xe5,
+  0x11, 0x4e, 0xe4, 0x91, 0xa7, 0x03, 0x02, 0xbc, 0xab, 0x60, 0x9b, 0x3f,
+  0x29, 0x3f, 0xaf, 0x6d, 0x5c, 0x18, 0x1d, 0xee, 0xb9, 0x74, 0xdd, 0x53,
+  0x97, 0x92, 0xae, 0xf5, 0xb6, 0xbb, 0xac, 0xa2, 0x4c, 0xea, 0xd7, 0x58,
+  0x2c, 0x2e, 0xdd, 0xf1, 0x3d, 0xbe, 0x2f, 0xd1, 0x89, 0x66, 0x9b, 0x0d,
+  0xff, 0x44, 0x42, 0x15, 0x5e, 0xac, 0xf5, 0x41, 0xcf, 0x87, 0xf0, 0x3f,
+  0xb6, 0xe9, 0xec, 0x88, 0x59, 0xa2, 0xcb, 0xcb, 0x06, 0x88, 0x73, 0xd1,
+  0x15, 0x2a, 0x70, 0xe3, 0xb2, 0xa5, 0x3b, 0x2e, 0x12, 0xf5, 0x7e, 0x38,
+  0x6e, 0x0a, 0x4e, 0x87, 0xa2, 0x08, 0xf6, 0x44, 0x90, 0x9a, 0xbf, 0xb8,
+  0xa1, 0x78, 0x5f, 0x51, 0x78, 0x5b, 0xef, 0xf1, 0xbc, 0xb1, 0x96, 0xf5,
+  0x06, 0x97, 0xdd, 0xb6, 0x56, 0x74, 0xca, 0xb9, 0x69, 0xc7, 0xbc, 0x22,
+  0xba, 0x2e, 0x5c, 0x1e, 0xe7, 0x3c, 0x1d, 0x07, 0xe0, 0x91, 0xf4, 0xe0,
+  0xc9, 0x99, 0xc2, 0x25, 0x85, 0xd6, 0x17, 0x1b, 0x0c, 0x32, 0xc1, 0x97,
+  0x7f, 0x86, 0xc1, 0x73, 0x70, 0xad, 0x36, 0xae, 0x16, 0xc1, 0xa4, 0x71,
+  0x2a, 0x21, 0x34, 0x6c, 0xe7, 0xa4, 0x82, 0xda, 0x4a, 0x0e, 0xb5, 0xc2,
+  0x20, 0x1a, 0x58, 0x9c, 0x35, 0x53, 0x62, 0xe6, 0x79, 0x10, 0x5f, 0x75,
+  0x5f, 0x67, 0xf3, 0x32, 0x81, 0xa3, 0x10, 0xc2, 0xa2, 0xb2, 0x70, 0xa6,
+  0xb4, 0xc4, 0x67, 0xbf, 0x00, 0x53, 0x40, 0x86, 0x30, 0x42, 0xac, 0xc9,
+  0xf7, 0x3b, 0x41, 0x54, 0x0b, 0xd5, 0x81, 0x0f, 0x8f, 0x03, 0xf1, 0xec,
+  0xf3, 0xc0, 0xf3, 0x55, 0x07, 0x14, 0xce, 0xb3, 0xc5, 0xc6, 0x3e, 0x48,
+  0x3c, 0x34, 0x89, 0x3c, 0xdc, 0xe0, 0x9e, 0xc4, 0x29, 0x17, 0x06, 0xcb,
+  0xac, 0xb9, 0x70, 0xaa, 0x64, 0xe6, 0xf4, 0xb0, 0xd9, 0x7c, 0x41, 0x19,
+  0x76, 0x04, 0x35, 0x16, 0xaf, 0xf1, 0xdc, 0xf3, 0x08, 0xc6, 0xa1, 0xb0,
+  0x14, 0x2b, 0xe9, 0xb2, 0x97, 0x1e, 0x29, 0x9a, 0x7e, 0x40, 0x2d, 0xdc,
+  0x89, 0xe7, 0x81, 0x89, 0x8c, 0x20, 0x3b, 0x7a, 0xd0, 0x91, 0x1d, 0x74,
+  0xb9, 0x20, 0x53, 0x6a, 0x9a, 0x4c, 0x8a, 0xe3, 0xee, 0x2c, 0xae, 0xc0,
+  0x16, 0xd8, 0xe7, 0x8f, 0xf0, 0x12, 0x57, 0xc0, 0x51, 0xd4, 0xa1, 0x6c,
+  0xb3, 0x30, 0xa9, 0xe7, 0x81, 0x28, 0x6e, 0xcb, 0x2b, 0x37, 0x5f, 0xe3,
+  0x4a, 0x6a, 0x7e, 0x5d, 0x1b, 0x32, 0x78, 0x59, 0x21, 0x8a, 0x30, 0x40,
+  0xb8, 0xdc, 0x88, 0xfb, 0xf7, 0x50, 0xea, 0x7c, 0x6e, 0xd1, 0x34, 0xfd,
+  0xc4, 0x20, 0x00, 0x62, 0x89, 0x1c, 0xe2, 0x57, 0x02, 0x10, 0x2e, 0x9e,
+  0x12, 0xa7, 0xf2, 0x44, 0xa1, 0xfb, 0x7d, 0xd6, 0xc5, 0x2a, 0x35, 0x03,
+  0x41, 0x31, 0xfc, 0x7c, 0xa0, 0x04, 0xc9, 0xe4, 0x29, 0xde, 0xd0, 0x23,
+  0x1e, 0xb1, 0x59, 0xb0, 0x30, 0x75, 0x82, 0xa0, 0xcb, 0x66, 0x82, 0x6b,
+  0x3b, 0x28, 0x14, 0x5d, 0x6e, 0x1d, 0xdf, 0x2d, 0xc5, 0x98, 0xf0, 0xf8,
+  0x2d, 0x99, 0xca, 0xae, 0x2a, 0xf7, 0x89, 0xe2, 0xf3, 0xa4, 0x23, 0xaa,
+  0x7a, 0xe6, 0xd3, 0xfc, 0x7c, 0x4e, 0xfb, 0xb1, 0xb1, 0xd2, 0xea, 0x3d,
+  0x13, 0xa6, 0x7f, 0x95, 0x05, 0xbf, 0xe8, 0xb0, 0x28, 0x33, 0xc5, 0x55,
+  0xd7, 0xa9, 0xde, 0x1d, 0x8d, 0x5a, 0x79, 0x36, 0x67, 0x43, 0x5f, 0x49,
+  0xcb, 0x3d, 0x98, 0xb3, 0xec, 0x48, 0x8e, 0xc4, 0x61, 0xa8, 0xb8, 0xeb,
+  0x27, 0x60, 0x82, 0x86, 0x7f, 0x0c, 0xd6, 0x4d, 0xe2, 0xa6, 0xb1, 0x64,
+  0x80, 0x67, 0x90, 0x50, 0xe1, 0x7a, 0x05, 0xbf, 0xce, 0xcf, 0x38, 0x60,
+  0xc7, 0x9f, 0xf2, 0xdf, 0x24, 0xa4, 0xae, 0x35, 0xf2, 0x18, 0x01, 0x14,
+  0x60, 0x0b, 0xa5, 0x96, 0xc7, 0xc6, 0xee, 0xda, 0x98, 0xa1, 0xba, 0x97,
+  0x19, 0x0e, 0xec, 0xc5, 0xcb, 0xf0, 0x72, 0x82, 0x80, 0x28, 0x91, 0xb8,
+  0x80, 0xe5, 0xef, 0x6f, 0x49, 0x1e, 0xc1, 0x86, 0x16, 0xfa, 0x02, 0xdc,
+  0xf7, 0x36, 0x0b, 0xee, 0x04, 0xf2, 0xa6, 0xe1, 0x88, 0xe4, 0x87, 0x3c,
+  0xf6, 0x6d, 0x4e, 0x12, 0x5d, 0x9c, 0xb2, 0xfc, 0x1f, 0xe9, 0xf0, 0x5c,
+  0x20, 0x77, 0x1e, 0x91, 0x97, 0x44, 0x3f, 0x54, 0xf0, 0x9f, 0x2c, 0x80,
+  0xd0, 0x58, 0x55, 0x46, 0x40, 0x3b, 0x3d, 0xfd, 0x81, 0x44, 0x4b, 0x20,
+  0x6a, 0x49, 0xb5, 0xb5, 0x18, 0x32, 0x1e, 0x1e, 0xfc, 0x66, 0xb9, 0x5e,
+  0x5a, 0x85, 0x14, 0x5b, 0xb0, 0x0e, 0x8f, 0x6e, 0xdb, 0x71, 0x03, 0x91,
+  0x47, 0x7e, 0x03, 0x6f, 0xb4, 0x37, 0xff, 0xe9, 0x90, 0xcf, 0x26, 0x11,
+  0x1d, 0x68, 0xf4, 0x87, 0x86, 0xbe, 0x53, 0x47, 0xe7, 0x6d, 0x8b, 0x5f,
+  0xc5, 0xf8, 0xf7, 0x4d, 0xe0, 0x8d, 0xcb, 0xfc, 0x8f, 0xdf, 0x48, 0x76,
+  0x75, 0x60, 0x85, 0x94, 0xc2, 0x6f, 0x18, 0xc2, 0x48, 0x77, 0x3d, 0x03,
+  0xd9, 0xcb, 0x9e, 0x8b, 0xf7, 0x96, 0x84, 0xe0, 0xfa, 0x8f, 0x08, 0xe7,
+  0xc0, 0x82, 0xa3, 0xdc, 0x1c, 0xea, 0x7f, 0xe9, 0x57, 0x9a, 0x69, 0x59,
+  0x05, 0x05, 0xec, 0xdc, 0x18, 0x86, 0x67, 0x5e, 0xc4, 0x40, 0x03, 0x0c,
+  0xdd, 0xad, 0xad, 0x35, 0xb5, 0xc1, 0x41, 0x36, 0x9b, 0xa8, 0xab, 0x2f,
+  0x37, 0xcd, 0x3a, 0xad, 0x4e, 0x66, 0xea, 0x1b, 0xe0, 0x82, 0xe8, 0x58,
+  0x95, 0xb0, 0xa3, 0x2b, 0x16, 0xf0, 0xb9, 0xb8, 0x3f, 0x8a, 0xcc, 0x1a,
+  0x68, 0x46, 0x01, 0xb4, 0x9f, 0xfa, 0xa2, 0x14, 0xfb, 0x1d, 0x7f, 0x2b,
+  0x0c, 0xdf, 0x74, 0xe0, 0x1b, 0x86, 0x60, 0xa1, 0x39, 0x0e, 0x07, 0x7a,
+  0x42, 0x81, 0xea, 0x2a, 0x3c, 0x63, 0x23, 0x3d, 0xb7, 0x89, 0x70, 0x76,
+  0xa2, 0x8b, 0x63, 0xa2, 0xc5, 0x0b, 0x5f, 0x17, 0x8a, 0x80, 0xa5, 0xb2,
+  0xf1, 0xd8, 0xee, 0x79, 0x7e, 0xa8, 0xb4, 0xb3, 0xd0, 0x28, 0x3e, 0x9d,
+  0x34, 0x7f, 0x1d, 0xdf, 0x5a, 0x43, 0x92, 0x79, 0x5e, 0xbe, 0x6b, 0xfa,
+  0x51, 0xbf, 0x5d, 0x5d, 0x83, 0xa2, 0x48, 0xdd, 0x06, 0x26, 0x85, 0xd5,
+  0xe1, 0xf9, 0xbc, 0xec, 0xaa, 0x38, 0x8c, 0x4f, 0x07, 0xc4, 0xb6, 0x6b,
+  0x52, 0x7f, 0xc5, 0x86, 0x21, 0x10, 0x61, 0x3f, 0x2e, 0xe4, 0xa9, 0xe9,
+  0x10, 0xd3, 0x74, 0x8b, 0xa2, 0xca, 0xac, 0xb0, 0x95, 0xe0, 0x9e, 0x0d,
+  0x4b, 0xcd, 0xa9, 0x61, 0x5d, 0xf9, 0xe4, 0x1b, 0x6e, 0x95, 0x22, 0x94,
+  0x76, 0xa8, 0x06, 0x2d, 0x49, 0x3e, 0x3e, 0x47, 0x97, 0x50, 0xab, 0x5b,
+  0x0f, 0xcb, 0x84, 0x66, 0x86, 0x96, 0x74, 0x90, 0xfb, 0xf6, 0x59, 0x45,
+  0x7c, 0x1d, 0x12, 0x36, 0x9f, 0xea, 0x9b, 0x5e, 0x96, 0xa7, 0x1f, 0x88,
+  0x3a, 0x80, 0xd6, 0xca, 0x06, 0x87, 0x4a, 0x13, 0xe2, 0xe0, 0xc8, 0xfb,
+  0x32, 0x4d, 0x25, 0x1e, 0x45, 0x60, 0x90, 0x32, 0x57, 0x87, 0xd3, 0x64,
+  0x36, 0x56, 0xf8, 0xfd, 0x1d, 0x6a, 0xa8, 0x7d, 0xbd, 0x7e, 0x30, 0xd8,
+  0x59, 0xf3, 0xba, 0x38, 0x28, 0xd8, 0xa6, 0x00, 0xd1, 0x3f, 0xb6, 0x6f,
+  0xd8, 0xb9, 0x4c, 0xe6, 0x54, 0x27, 0xf1, 0x12, 0x7f, 0x86, 0x55, 0x90,
+  0x30, 0x7a, 0x6a, 0x28, 0xcf, 0x05, 0x00, 0x4f, 0xf4, 0x16, 0xb2, 0x55,
+  0xf8, 0xa1, 0x92, 0x75, 0x59, 0x80, 0xd8, 0x5f, 0xbf, 0xcb, 0xc1, 0x48,
+  0xbd, 0x3e, 0xb2, 0x8b, 0xac, 0x96, 0x4d, 0xfd, 0x26, 0xc8, 0xca, 0x48,
+  0x96, 0x0d, 0xe8, 0x84, 0x54, 0xf6, 0x17, 0xc2, 0x99, 0x26, 0x64, 0x78,
+  0x68, 0x8a, 0xfb, 0x92, 0x04, 0xb9, 0xc6, 0xd9, 0xc1, 0xa5, 0x45, 0xc2,
+  0x5b, 0x4d, 0x74, 0x0c, 0x7e, 0x01, 0xa5, 0x88, 0xae, 0xb3, 0x36, 0xab,
+  0xcd, 0xc9, 0x08, 0x8c, 0x60, 0xcd, 0x6d, 0xbc, 0xdb, 0xe6, 0xb5, 0x38,
+  0x4c, 0x6b, 0x02, 0xfc, 0xec, 0xf5, 0x0e, 0x5a, 0xa2, 0x81, 0xc8, 0x22,
+  0x52, 0x4b, 0xc7, 0x10, 0x92, 0x49, 0xa7, 0xb8, 0x50, 0x7c, 0x2c, 0x7a,
+  0xc3, 0x77, 0xb9, 0x26, 0xdc, 0xcf, 0x82, 0x7c, 0x3a, 0x5f, 0xff, 0xe8,
+  0x93, 0x67, 0xe1, 0x1e, 0xd7, 0xea, 0x49, 0xaa, 0x9c, 0xff, 0x2b, 0xff,
+  0xb0, 0x62, 0xe3, 0xee, 0x5c, 0x54, 0x8a, 0x67, 0x6b, 0x40, 0xae, 0xe1,
+  0x28, 0x56, 0x7a, 0x5f, 0x7f, 0xfc, 0x5e, 0xb6, 0xa2, 0x7e, 0x44, 0x06,
+  0x6d, 0xb0, 0x78, 0x96, 0xb4, 0x11, 0xf9, 0xf8, 0xe8, 0x3b, 0x1a, 0xa2,
+  0x10, 0xd3, 0x40, 0x34, 0x77, 0xf8, 0x8e, 0xd5, 0x35, 0x7e, 0xa6, 0x71,
+  0x0f, 0xc4, 0x5c, 0xb9, 0x01, 0x1f, 0xa6, 0x9d, 0x14, 0xc9, 0x4f, 0x7e,
+  0xa3, 0xe5, 0x82, 0xde, 0xa8, 0x85, 0xd4, 0xdb, 0xff, 0x42, 0x79, 0x8c,
+  0x12, 0x1b, 0xad, 0x65, 0x90, 0xfd, 0x78, 0x59, 0xfa, 0x3c, 0x36, 0xad,
+  0x17, 0xc4, 0xbe, 0x51, 0xcb, 0x65, 0xf4, 0x31, 0x5c, 0xcc, 0x41, 0xb7,
+  0x33, 0x64, 0xe6, 0x09, 0x32, 0x09, 0x33, 0x71, 0xb0, 0x03, 0xb3, 0x1a,
+  0x19, 0x00, 0x54, 0xd5, 0xb4, 0xee, 0x0c, 0xf7, 0xe4, 0xa2, 0x70, 0xbf,
+  0x2e, 0xce, 0xee, 0x48, 0x4f, 0xe6, 0x3c, 0x21, 0xa6, 0x63, 0x70, 0x79,
+  0xe4, 0xa2, 0xa3, 0xc0, 0x07, 0x50, 0x12, 0xd1, 0x25, 0x4b, 0x21, 0x68,
+  0x9e, 0x7d, 0x65, 0x38, 0xd3, 0x70, 0xbe, 0xb0, 0x69, 0x97, 0x8b, 0x11,
+  0x71, 0x1f, 0x7b, 0x8f, 0x41, 0x09, 0x3b, 0x79, 0xa4, 0x05, 0x28, 0x12,
+  0xbb, 0x19, 0x6e, 0x0c, 0xdf, 0x55, 0x30, 0xa0, 0xcf, 0x1d, 0xaf, 0x26,
+  0x06, 0x07, 0x70, 0xd5, 0x16, 0xf8, 0x8a, 0xbd, 0x47, 0x10, 0xf7, 0x57,
+  0xdb, 0x74, 0x7b, 0xdb, 0x62, 0xe4, 0xfc, 0xc9, 0x18, 0x20, 0x29, 0x03,
+  0xbb, 0x26, 0x2e, 0x50, 0xcc, 0xa6, 0x01, 0xf9, 0xbf, 0x0d, 0x3c, 0x84,
+  0x78, 0x6c, 0x3a, 0x72, 0x60, 0x95, 0x4b, 0x84, 0xab, 0xd0, 0x29, 0x0b,
+  0x1e, 0x0f, 0x85, 0xaa, 0xf5, 0x92, 0x8b, 0x6e, 0xf1, 0x87, 0x93, 0xb8,
+  0x7a, 0x6e, 0xd7, 0x44, 0x5b, 0x6b, 0x64, 0x7a, 0xe1, 0x55, 0x84, 0x36,
+  0xd2, 0x90, 0x5e, 0xff, 0x69, 0x2a, 0xea, 0x32, 0x69, 0x48, 0x22, 0xf1,
+  0x84, 0x12, 0x3c, 0x72, 0xc7, 0x70, 0xf5, 0x03, 0x5f, 0xb9, 0x08, 0xb7,
+  0xf5, 0x2d, 0x26, 0x77, 0x47, 0x85, 0x2b, 0x5f, 0x8c, 0xca, 0xc1, 0xc4,
+  0x11, 0xa4, 0x0b, 0xc9, 0xd7, 0x0a, 0x51, 0xbe, 0xa2, 0xac, 0xd2, 0x38,
+  0x80, 0xa8, 0x22, 0x43, 0x30, 0x5d, 0xe6, 0x28, 0x39, 0x6c, 0xd7, 0x42,
+  0xb7, 0xcc, 0xc1, 0x25, 0x17, 0xd7, 0xee, 0x3c, 0x4e, 0xb5, 0x4c, 0x44,
+  0xc7, 0x6c, 0xd4, 0x87, 0x70, 0x19, 0x47, 0x62, 0xcf, 0x09, 0x90, 0x64,
+  0x54, 0xa4, 0xe0, 0x98, 0x05, 0x7b, 0x70, 0xa5, 0x52, 0x7e, 0x9c, 0xfe,
+  0x98, 0x72, 0xe5, 0x96, 0x0e, 0xce, 0x48, 0x12, 0xa0, 0x11, 0xd7, 0x76,
+  0xe9, 0xf6, 0xd2, 0x34, 0x51, 0xe2, 0x2e, 0x70, 0xd9, 0xc0, 0xf5, 0x99,
+  0x13, 0xd6, 0xa8, 0x8c, 0xe9, 0xcd, 0xe5, 0x92, 0xa6, 0x3d, 0xdc, 0x75,
+  0xff, 0x60, 0x9d, 0xbb, 0x98, 0xcc, 0x29, 0x85, 0x26, 0x6e, 0xca, 0x89,
+  0x32, 0x15, 0x03, 0xed, 0x68, 0xfb, 0xf2, 0x03, 0x31, 0x41, 0x2f, 0x86,
+  0x54, 0xb5, 0x96, 0x3a, 0xf7, 0x21, 0x13, 0x40, 0x8c, 0x3d, 0x5b, 0xc3,
+  0x89, 0xf5, 0x0a, 0x39, 0x9b, 0x39, 0x3d, 0x85, 0xd7, 0xd9, 0xe3, 0x7b,
+  0xa2, 0x24, 0x68, 0x4f, 0x28, 0x4d, 0x0a, 0x75, 0x50, 0xc4, 0xe7, 0x56,
+  0xe4, 0xb1, 0x86, 0x2b, 0x1b, 0xff, 0x25, 0x6d, 0x5b, 0xfc, 0x6a, 0x1c,
+  0xc8, 0x13, 0x02, 0xfe, 0x5e, 0x9d, 0xbc, 0x1a, 0xd1, 0xf8, 0xb5, 0xaa,
+  0x5f, 0x97, 0xe8, 0x01, 0x14, 0x8d, 0xa2, 0x6d, 0x81, 0x8c, 0xcf, 0x56,
+  0xb3, 0xb9, 0xc1, 0x82, 0x6a, 0x1e, 0xc6, 0xff, 0xff, 0x4a, 0x90, 0xdc,
+  0xa8, 0x8f, 0xc8, 0x85, 0x56, 0xda, 0xc2, 0xd1, 0xc2, 0x2b, 0x74, 0xea,
+  0xb3, 0xe9, 0x01, 0x76, 0x94, 0x43, 0xae, 0x79, 0xe9, 0x2f, 0x92, 0xc8,
+  0xf1, 0x1d, 0xbf, 0x0e, 0x62, 0xcb, 0x7a, 0x80, 0x59, 0x11, 0x6b, 0x8e,
+  0xbe, 0x18, 0x78, 0xa2, 0x3e, 0x97, 0xf8, 0x56, 0x7d, 0x3d, 0xfe, 0xaa,
+  0xf3, 0x5c, 0x8f, 0x16, 0xe5, 0xf4, 0xcd, 0xe9, 0x66, 0x69, 0x21, 0x4c,
+  0xce, 0x99, 0x97, 0xfe, 0xb4, 0xb8, 0x7b, 0x6e, 0xcc, 0x99, 0x57, 0x0f,
+  0x73, 0xe6, 0x7c, 0xac, 0x34, 0xb7, 0x03, 0x36, 0xb0, 0x86, 0xc9, 0x26,
+  0x91, 0x3f, 0x32, 0xbd, 0x5e, 0x15, 0xd7, 0xf0, 0x46, 0x8f, 0x8c, 0x09,
+  0x51, 0x1f, 0x2e, 0x42, 0x5a, 0xca, 0x2d, 0xd4, 0x81, 0x88, 0xc8, 0x96,
+  0x4d, 0x4e, 0xf8, 0x25, 0xb9, 0xd6, 0xf8, 0x36, 0x4d, 0x3b, 0xc8, 0x35,
+  0x70, 0x0a, 0xeb, 0x51, 0xf5, 0x36, 0x46, 0x09, 0xb5, 0xa5, 0xec, 0xc2,
+  0x4e, 0x30, 0x05, 0x1f, 0x76, 0x29, 0xd8, 0x15, 0xf7, 0x26, 0xc6, 0x29,
+  0x14, 0x7e, 0x00, 0xfd, 0x9d, 0x08, 0xbc, 0x7d, 0x3c, 0xb5, 0x36, 0x15,
+  0x21, 0x66, 0x94, 0x70, 0x98, 0xcb, 0x6b, 0xf7, 0x4b, 0x48, 0x57, 0xfa,
+  0xbd, 0xe9, 0x99, 0x04, 0xa4, 0x33, 0x75, 0x73, 0x63, 0xea, 0xe3, 0xf3,
+  0xcc, 0x38, 0x7f, 0xf4, 0x12, 0x53, 0x8e, 0x71, 0xdc, 0xd0, 0xee, 0x9d,
+  0xde, 0xe8, 0x7c, 0x3b, 0xd7, 0xe2, 0x8c, 0xba, 0x59, 0x1e, 0x77, 0xf3,
+  0x36, 0x4d, 0x47, 0x81, 0x21, 0xd4, 0x8a, 0x98, 0x4b, 0x2b, 0x3f, 0xa7,
+  0x84, 0xa8, 0x94, 0xb4, 0xaa, 0x22, 0x8a, 0x30, 0xd6, 0x5c, 0x5a, 0x5c,
+  0xf2, 0x29, 0xb6, 0x6f, 0x3c, 0x96, 0x64, 0x80, 0x6e, 0xe6, 0x5c, 0x09,
+  0xd1, 0x31, 0xf2, 0x5f, 0xc8, 0x27, 0xb2, 0x57, 0xf6, 0x9e, 0x68, 0x94,
+  0x18, 0x1c, 0x8f, 0xd0, 0x46, 0x1c, 0xa3, 0x52, 0x1d, 0x4b, 0xc9, 0x86,
+  0x9a, 0x90, 0xbf, 0x66, 0x62, 0x08, 0xd3, 0x4b, 0x39, 0x66, 0x09, 0x0a,
+  0xe0, 0x08, 0x63, 0x70, 0x7d, 0x82, 0x43, 0xc8, 0x8b, 0xd1, 0x7d, 0x95,
+  0x78, 0x87, 0xe9, 0xe3, 0x7f, 0x05, 0xb2, 0x67, 0xa0, 0xf7, 0x83, 0x89,
+  0x6e, 0x30, 0x8b, 0x71, 0xfb, 0x7e, 0x28, 0x9c, 0x7a, 0x4a, 0x3c, 0xe5,
+  0x97, 0x90, 0x1f, 0x27, 0x4c, 0xca, 0x07, 0x71, 0x5e, 0xfc, 0xc9, 0x4c,
+  0x85, 0x1c, 0xf7, 0x87, 0x07, 0x77, 0xc4, 0xba, 0xa6, 0xfa, 0xea, 0x57,
+  0xb3, 0x41, 0x1d, 0x88, 0xa4, 0xfa, 0xd0, 0x5f, 0x06, 0x86, 0xf1, 0x53,
+  0xc2, 0x45, 0xdf, 0x24, 0xf6, 0x89, 0x98, 0x91, 0x12, 0x84, 0xe6, 0xed,
+  0x61, 0xfb, 0xbc, 0xb2, 0x9c, 0x03, 0x4d, 0x28, 0x89, 0x0b, 0x25, 0xe9,
+  0x96, 0x90, 0x93, 0x31, 0x17, 0x66, 0x6d, 0xe0, 0x07, 0x68, 0xb3, 0xc8,
+  0x71, 0xac, 0xea, 0xce, 0xda, 0x08, 0x28, 0x31, 0x78, 0xf6, 0x3e, 0xbe,
+  0x6c, 0xe0, 0xc9, 0x1b, 0x55, 0xb2, 0x40, 0x1d, 0xee, 0x2f, 0x2a, 0x4e,
+  0xcd, 0x21, 0x92, 0x72, 0x60, 0xe8, 0xfd, 0xa1, 0x2e, 0xb0, 0xb0, 0xb2,
+  0xe9, 0x87, 0x91, 0x6a, 0x9a, 0x98, 0x4f, 0x9c, 0xd8, 0xe4, 0x36, 0x7e,
+  0xf5, 0x18, 0x78, 0xa9, 0xb2, 0x32, 0xec, 0xd4, 0x8a, 0x25, 0x4e, 0x72,
+  0xf8, 0xef, 0x28, 0xdd, 0x49, 0xa4, 0x26, 0x95, 0x7e, 0xc4, 0xa8, 0x0f,
+  0x45, 0xd2, 0x8f, 0x89, 0xde, 0xbe, 0x0f, 0x0b, 0x98, 0xc1, 0xe9, 0x22,
+  0xd9, 0xb2, 0xe1, 0x00, 0x58, 0xe7, 0xe7, 0x7f, 0xc5, 0x9d, 0xf3, 0x58,
+  0x4f, 0xcc, 0x9c, 0x49, 0x5b, 0x95, 0xb3, 0xff, 0x06, 0xe6, 0xde, 0xb7,
+  0x59, 0x1b, 0x4b, 0x83, 0x2b, 0xab, 0x17, 0xb1, 0x0d, 0xcb, 0xf8, 0x92,
+  0xe0, 0x21, 0x2f, 0x4b, 0x19, 0xc9, 0xa9, 0x79, 0xd2, 0xa8, 0xaa, 0xdd,
+  0x6b, 0x50, 0xfa, 0x7f, 0xd3, 0xd1, 0x07, 0xe9, 0xa3, 0xa0, 0x6e, 0x7a,
+  0x28, 0xf4, 0x41, 0x1f, 0xf7, 0x45, 0xb3, 0x09, 0x8f, 0xfb, 0x93, 0x8c,
+  0x8a, 0x27, 0x37, 0xc3, 0x2f, 0x26, 0x06, 0x29, 0x2a, 0x9f, 0x01, 0x74,
+  0x18, 0xf8, 0xb0, 0x15, 0xde, 0x17, 0x74, 0x79, 0x93, 0x4f, 0x2f, 0xb1,
+  0x27, 0x76, 0xf5, 0xf2, 0x21, 0x53, 0xf3, 0x60, 0x56, 0xa2, 0x23, 0x3c,
+  0x09, 0x19, 0x6c, 0x40, 0x29, 0xa7, 0xd2, 0x3f, 0x51, 0x37, 0x1c, 0x65,
+  0x13, 0xd4, 0xa6, 0x3b, 0x6c, 0xa3, 0xb8, 0xbc, 0x4f, 0x2f, 0x71, 0x5d,
+  0xa0, 0xd3, 0xa4, 0x9d, 0xfe, 0x78, 0x4f, 0x33, 0x58, 0x86, 0x5f, 0xbd,
+  0x30, 0x50, 0x52, 0xc2, 0x91, 0x0c, 0x73, 0x5b, 0x32, 0x70, 0x63, 0x3a,
+  0xf1, 0xfa, 0x56, 0xbd, 0x63, 0x42, 0x46, 0x35, 0x25, 0x0a, 0xe4, 0xfe,
+  0xf4, 0x34, 0xdd, 0xfa, 0xab, 0x12, 0x54, 0x4e, 0xf9, 0xbc, 0x03, 0x69,
+  0x04, 0x0b, 0xd2, 0xe3, 0x76, 0x48, 0x6a, 0xce, 0x66, 0xd5, 0x2a, 0x73,
+  0x3a, 0xb6, 0xb2, 0x98, 0xc7, 0xb6, 0xf4, 0xf3, 0x75, 0x03, 0x57, 0xb6,
+  0x3e, 0xfe, 0x65, 0x19, 0x79, 0x68, 0x79, 0xeb, 0x2f, 0x60, 0x0e, 0xe8,
+  0x9a, 0xec, 0x06, 0x27, 0xb8, 0x77, 0x21, 0xf6, 0xc3, 0x26, 0x1c, 0x5e,
+  0x15, 0x61, 0xe8, 0x74, 0x83, 0x12, 0x52, 0x99, 0xb3, 0x7d, 0x5a, 0x30,
+  0xaf, 0x31, 0xb8, 0x06, 0x20, 0x20, 0x39, 0x31, 0x8a, 0x92, 0xed, 0xa5,
+  0xab, 0x0a, 0x94, 0xb3, 0xa5, 0xda, 0xc2, 0x4c, 0xed, 0x76, 0x93, 0xc8,
+  0xad, 0x4a, 0xb4, 0x1a, 0xdb, 0x90, 0x1c, 0x81, 0xe8, 0x4f, 0xea, 0xba,
+  0xb2, 0x2a, 0x8a, 0x2c, 0x17, 0x51, 0x9b, 0x28, 0x07, 0x78, 0x25, 0xb0,
+  0xdc, 0xf6, 0x52, 0x85, 0x0d, 0xa7, 0xf1, 0x3f, 0x66, 0x10, 0x42, 0xa7,
+  0x52, 0x03, 0x98, 0x52, 0x1a, 0xbb, 0xff, 0x4e, 0x8b, 0xf1, 0x84, 0x92,
+  0x6a, 0xf6, 0x8b, 0x4d, 0x64, 0xd3, 0x23, 0xdc, 0xf0, 0x06, 0xed, 0x45,
+  0x66, 0x13, 0xcb, 0xa1, 0x18, 0x8f, 0x7b, 0x93, 0xd6, 0x1d, 0xa2, 0xf2,
+  0x1c, 0x3f, 0x3b, 0xb2, 0xef, 0x64, 0xec, 0xc6, 0x88, 0x57, 0xd9, 0xff,
+  0x9c, 0x80, 0x57, 0x1e, 0xf3, 0x9d, 0xb8, 0xd0, 0xf3, 0x14, 0x42, 0x9b,
+  0xbb, 0x93, 0x40, 0x1a, 0x34, 0xff, 0xfe, 0xc4, 0x4a, 0x18, 0x19, 0xa4,
+  0xfd, 0xf0, 0x52, 0xa5, 0xf3, 0x8a, 0xa6, 0xec, 0xfa, 0xd7, 0x19, 0xa4,
+  0xe3, 0x38, 0x85, 0xeb, 0x11, 0x77, 0x53, 0xc0, 0x8c, 0xcd, 0x57, 0x02,
+  0xb4, 0xee, 0xdb, 0x70, 0x72, 0x76, 0x86, 0x9e, 0xdf, 0x0d, 0xc7, 0xb2,
+  0x93, 0xf6, 0x37, 0x39, 0x8b, 0xf3, 0x51, 0x81, 0x9c, 0x10, 0x90, 0x8b,
+  0x06, 0xa3, 0xe0, 0xcc, 0xb5, 0x38, 0x6e, 0x46, 0x1f, 0xc8, 0x5e, 0x72,
+  0xb5, 0x10, 0x5b, 0x48, 0x38, 0x2d, 0x91, 0x85, 0x0d, 0x46, 0xf7, 0xad,
+  0x28, 0x02, 0x57, 0x4c, 0xa1, 0x87, 0x7a, 0x47, 0x62, 0xd0, 0x1b, 0x45,
+  0x23, 0xfd, 0x4c, 0xc9, 0xce, 0xec, 0xb3, 0x9f, 0xf9, 0xe5, 0x22, 0xe1,
+  0x2c, 0x19, 0x2a, 0x4c, 0x3d, 0x64, 0x45, 0xe8, 0x88, 0x24, 0x94, 0xab,
+  0x1a, 0x7e, 0xeb, 0x84, 0x7d, 0x19, 0x15, 0xe5, 0xd8, 0xb1, 0xa6, 0xf1,
+  0x8d, 0x37, 0x98, 0xe5, 0x95, 0xbb, 0x36, 0x10, 0x81, 0x30, 0x3d, 0xc2,
+  0x12, 0xe6, 0x71, 0x5c, 0xeb, 0x97, 0xa6, 0x3a, 0x63, 0x17, 0xc2, 0xc0,
+  0x36, 0x1f, 0xa0, 0xa6, 0x5e, 0x8d, 0x5d, 0x44, 0xb8, 0xa2, 0xf1, 0x7d,
+  0x7a, 0x89, 0x80, 0x44, 0x0a, 0x09, 0xf7, 0x4b, 0xfa, 0xf3, 0xf2, 0x95,
+  0x6a, 0xa2, 0xc2, 0x10, 0x87, 0x87, 0x5f, 0x3c, 0x9b, 0xe5, 0x40, 0xfd,
+  0x2b, 0x32, 0xa0, 0x85, 0x22, 0x5a, 0x1f, 0xfe, 0x96, 0x47, 0x80, 0x3a,
+  0x46, 0x47, 0xa9, 0x5e, 0x01, 0x46, 0x2f, 0x6b, 0xfa, 0xe8, 0xe1, 0xcb,
+  0xfb, 0xce, 0xa7, 0xc3, 0x5e, 0xa4, 0x89, 0x53, 0x12, 0x74, 0xcf, 0x56,
+  0x10, 0xbc, 0x1f, 0x48, 0x11, 0x9d, 0x9d, 0x1a, 0xed, 0xf1, 0x37, 0x7b,
+  0xda, 0x03, 0x7a, 0x75, 0x06, 0xfb, 0xdd, 0x4b, 0xdc, 0xc1, 0x2f, 0x14,
+  0x61, 0x38, 0x3c, 0x01, 0x6a, 0x24, 0x95, 0xd4, 0xc1, 0x0c, 0x5e, 0x7c,
+  0xdc, 0x84, 0xe8, 0xba, 0x24, 0xc4, 0xa4, 0xa8, 0x71, 0x67, 0xcd, 0x27,
+  0xcb, 0xb1, 0xa2, 0xa0, 0x2e, 0xa7, 0xa4, 0x23, 0x1d, 0x36, 0xb3, 0xb2,
+  0xdc, 0x6e, 0x68, 0x3a, 0x57, 0x05, 0xcc, 0xe6, 0x48, 0x3e, 0x65, 0x8d,
+  0x67, 0xe3, 0x1a, 0x56, 0x35, 0x6d, 0xb6, 0x7f, 0xff, 0x65, 0x40, 0x5c,
+  0x4e, 0xce, 0x84, 0xf7, 0xca, 0x65, 0x59, 0x11, 0x50, 0x01, 0x42, 0xbd,
+  0xdc, 0x4b, 0xb1, 0x9a, 0xad, 0x5a, 0x9f, 0x10, 0x0d, 0xa8, 0xea, 0x1d,
+  0x2e, 0xec, 0x83, 0xa2, 0xf6, 0xa9, 0xa2, 0x5f, 0xb4, 0xda, 0x3e, 0x69,
+  0x82, 0xca, 0xa0, 0xd4, 0xa3, 0x53, 0x0d, 0x85, 0xf9, 0xd2, 0xa0, 0x08,
+  0x94, 0xc5, 0x65, 0xd9, 0xdd, 0xfa, 0xce, 0xa9, 0xa2, 0x3d, 0x30, 0xe6,
+  0x62, 0xba, 0x48, 0x09, 0xe2, 0xa0, 0xcb, 0xf3, 0x9b, 0x2a, 0xf7, 0xbd,
+  0x13, 0xf9, 0x36, 0x7c, 0x02, 0x99, 0xc8, 0x6b, 0xb8, 0x71, 0x83, 0x57,
+  0xc1, 0x35, 0x6c, 0xfc, 0xb4, 0x70, 0x92, 0xbc, 0x0a, 0xea, 0x65, 0x80,
+  0x42, 0x37, 0xd2, 0x78, 0x47, 0x08, 0xc1, 0xc0, 0x10, 0x4a, 0x77, 0xe0,
+  0x1c, 0x69, 0x39, 0xb2, 0xc6, 0x50, 0x6e, 0x43, 0xe6, 0xed, 0x43, 0x4f,
+  0x22, 0x92, 0x57, 0x35, 0x1c, 0x67, 0x7f, 0x74, 0xdb, 0xf5, 0x18, 0x9a,
+  0xe5, 0xed, 0xf9, 0x18, 0x59, 0x6e, 0xb9, 0x2a, 0x99, 0x9b, 0xc1, 0x5a,
+  0xd6, 0xea, 0x4a, 0xf0, 0x36, 0xf5, 0xcf, 0xc1, 0x64, 0xbe, 0x25, 0xc2,
+  0xc0, 0xa0, 0x8a, 0x3d, 0x54, 0xcd, 0x9c, 0x70, 0xca, 0x78, 0x63, 0x9b,
+  0xfb, 0x0d, 0x6b, 0xb0, 0x2e, 0x78, 0x65, 0x04, 0x9e, 0x99, 0x02, 0xac,
+  0xc6, 0x9f, 0xdd, 0x4c, 0x29, 0xef, 0x5c, 0x66, 0x3b, 0x1e, 0x16, 0x29,
+  0xf5, 0x99, 0xc9, 0x57, 0xf9, 0x18, 0x97, 0x08, 0xe7, 0x8d, 0xdc, 0xb2,
+  0x9a, 0x48, 0x1d, 0x8d, 0x6f, 0xca, 0xea, 0x2f, 0x4d, 0x3e, 0xc4, 0xc4,
+  0xf5, 0x87, 0xc2, 0xea, 0x61, 0xe8, 0xeb, 0x80, 0x3e, 0xb2, 0xf7, 0x3f,
+  0xfa, 0x67, 0x35, 0xf7, 0x71, 0x87, 0x14, 0x95, 0x57, 0xd2, 0x18, 0x11,
+  0x71, 0x25, 0x94, 0x7a, 0xbe, 0x2a, 0x54, 0xef, 0xab, 0x61, 0x06, 0x96,
+  0x26, 0xb9, 0x18, 0xaf, 0xdd, 0x21, 0x02, 0xc7, 0x13, 0x57, 0x15, 0x74,
+  0xd2, 0xf1, 0x04, 0x4b, 0x6b, 0x4c, 0x63, 0x39, 0xe0, 0x92, 0xdf, 0x50,
+  0x1e, 0x77, 0x34, 0x4b, 0xb7, 0x13, 0x16, 0xbf, 0x53, 0x9f, 0xb0, 0x62,
+  0x53, 0x06, 0x86, 0x95, 0x1a, 0x46, 0x2d, 0x2e, 0xfb, 0xe1, 0x73, 0x7d,
+  0x64, 0x47, 0x5b, 0xbe, 0x69, 0x9d, 0xa0, 0x16, 0x45, 0xd4, 0x0e, 0x87,
+  0x18, 0x53, 0x39, 0x4b, 0xe5, 0xe4, 0x59, 0xdd, 0x46, 0xcd, 0xd5, 0x6a,
+  0xe0, 0xf4, 0x9b, 0xac, 0xee, 0x61, 0x80, 0x8a, 0xfe, 0x66, 0xde, 0x5b,
+  0x14, 0xcc, 0xf5, 0x53, 0x89, 0x58, 0x13, 0x37, 0xc3, 0x8f, 0x1a, 0x24,
+  0x9f, 0x27, 0xb8, 0x16, 0x8d, 0x77, 0xd0, 0x03, 0xca, 0x9b, 0x17, 0x68,
+  0x6b, 0xfc, 0x60, 0xcc, 0xdf, 0x30, 0xfd, 0xb6, 0xe8, 0xa6, 0xc0, 0x0d,
+  0xcb, 0x60, 0xce, 0x93, 0xc1, 0x82, 0xda, 0x62, 0xea, 0x2c, 0x7c, 0x91,
+  0x18, 0xd1, 0x58, 0xdc, 0x6b, 0xef, 0x2b, 0x7d, 0xb4, 0xd5, 0x97, 0x52,
+  0x23, 0x50, 0x7a, 0xb5, 0x31, 0x41, 0x0b, 0x34, 0x05, 0x8a, 0x1f, 0x3f,
+  0x5f, 0x78, 0x9b, 0xa3, 0xa0, 0x6d, 0x3d, 0xfc, 0xee, 0x48, 0xec, 0xc5,
+  0x23, 0xfb, 0x01, 0x5a, 0x2e, 0x79, 0x22, 0xd5, 0x7b, 0x5f, 0xa7, 0x24,
+  0x76, 0x00, 0x9e, 0x86, 0x75, 0x74, 0xd6, 0xa3, 0x19, 0xab, 0xbd, 0x05,
+  0x28, 0x45, 0xd1, 0xf4, 0xb4, 0x1d, 0x98, 0x09, 0xad, 0x19, 0x31, 0x1f,
+  0xfc, 0xe2, 0xe5, 0xef, 0xeb, 0x95, 0x93, 0x79, 0x26, 0xe6, 0xb7, 0x97,
+  0x55, 0x0f, 0xa3, 0x93, 0x05, 0xf4, 0x70, 0x87, 0xe1, 0x43, 0x49, 0x6c,
+  0x86, 0xe4, 0x43, 0xf3, 0x48, 0x95, 0x2f, 0xab, 0xdd, 0xd1, 0x48, 0xef,
+  0xfc, 0xa1, 0x19, 0x58, 0x73, 0x2c, 0xe5, 0xfb, 0xd4, 0x34, 0xc7, 0x55,
+  0x74, 0xf1, 0xa0, 0xef, 0x0b, 0xed, 0xc1, 0xae, 0x1f, 0xe6, 0xbd, 0xf6,
+  0xef, 0x93, 0x16, 0x88, 0x6d, 0x9d, 0x1c, 0x6a, 0x09, 0x84, 0xaf, 0xb7,
+  0x1d, 0xcc, 0xed, 0x56, 0x08, 0x1b, 0x8c, 0x78, 0xc5, 0xc4, 0xe0, 0x49,
+  0x04, 0x0d, 0x30, 0x96, 0x83, 0x9e, 0x73, 0x5a, 0xbc, 0x89, 0xc1, 0xf6,
+  0x79, 0x80, 0x02, 0xe7, 0x2b, 0xda, 0x86, 0xf4, 0x5e, 0x73, 0xbd, 0x1f,
+  0xf2, 0xb8, 0x8d, 0x99, 0x9c, 0x1c, 0x13, 0x4d, 0x4d, 0x63, 0x37, 0x3e,
+  0x60, 0xc5, 0x4f, 0xf8, 0x6b, 0xbb, 0x39, 0x37, 0x8a, 0x18, 0x8b, 0x73,
+  0xf5, 0x95, 0x6e, 0x7d, 0x11, 0xa4, 0xd2, 0x6a, 0x35, 0x84, 0x04, 0xf0,
+  0x59, 0x41, 0x74, 0x64, 0xf4, 0x44, 0x5f, 0x1f, 0x26, 0xf4, 0xc7, 0x07,
+  0x39, 0x81, 0x85, 0xd2, 0x6e, 0x60, 0xb3, 0xe4, 0x82, 0xda, 0x3f, 0x25,
+  0xf4, 0x42, 0x77, 0x41, 0xbf, 0x17, 0xf4, 0x64, 0x16, 0x39, 0x90, 0x0f,
+  0x9d, 0x4d, 0xbc, 0x99, 0xd8, 0xe8, 0xce, 0xd3, 0xf0, 0x3b, 0xca, 0x13,
+  0xb5, 0x06, 0x9d, 0xea, 0x71, 0x0d, 0x56, 0xcd, 0x63, 0x2f, 0xbf, 0x4a,
+  0x8b, 0x2a, 0xc1, 0x24, 0x28, 0x55, 0xd3, 0xd6, 0xd2, 0xa9, 0x6c, 0xf6,
+  0xe1, 0x61, 0xde, 0x3f, 0xba, 0x80, 0x44, 0x7b, 0xd5, 0x22, 0x73, 0x02,
+  0x17, 0x46, 0xfc, 0x53, 0xb9, 0xc4, 0x26, 0x6d, 0x65, 0xca, 0x1c, 0x65,
+  0x28, 0x64, 0xcb, 0xd7, 0x9c, 0xa6, 0x8d, 0xaa, 0xac, 0x9f, 0x9b, 0xff,
+  0x95, 0x68, 0x38, 0x53, 0x76, 0x5c, 0x17, 0xe0, 0x65, 0x6c, 0x61, 0x5b,
+  0x74, 0xbd, 0x28, 0x2b, 0x2f, 0x48, 0x77, 0x6f, 0x09, 0x93, 0x33, 0x7d,
+  0xcb, 0xf9, 0x1f, 0xa5, 0x81, 0xe0, 0x9b, 0x7e, 0xcd, 0x25, 0x1b, 0x6f,
+  0x12, 0x13, 0x2e, 0x95, 0x1e, 0x70, 0x8e, 0x6c, 0xa8, 0x4f, 0x5b, 0x45,
+  0xea, 0xad, 0x71, 0xe5, 0x05, 0x36, 0x65, 0x7b, 0x09, 0x14, 0x76, 0x34,
+  0xe7, 0x48, 0x88, 0xea, 0x94, 0xa8, 0x44, 0x9f, 0x8f, 0x33, 0xdc, 0xf7,
+  0xbd, 0xe9, 0xc3, 0x10, 0x58, 0x70, 0x3c, 0x5c, 0x2a, 0x1a, 0xe8, 0xaa,
+  0x52, 0xf0, 0x6a, 0xf7, 0xd7, 0xb7, 0x0a, 0x84, 0xea, 0xdf, 0xbb, 0x25,
+  0xea, 0x04, 0xc5, 0xc5, 0x53, 0x95, 0x66, 0x77, 0xd0, 0x1d, 0x89, 0xd6,
+  0x95, 0x86, 0x29, 0x4f, 0xf5, 0xc0, 0x90, 0x7e, 0xc3, 0x18, 0x18, 0x01,
+  0xfa, 0x32, 0x0e, 0x43, 0x1b, 0xf8, 0x65, 0x25, 0x13, 0x0e, 0xea, 0x7e,
+  0x2a, 0x4b, 0xd1, 0x88, 0x47, 0xb3, 0x6b, 0x7e, 0x6d, 0xb7, 0x31, 0xc2,
+  0xa8, 0x26, 0x50, 0x4a, 0xc7, 0xe4, 0x5c, 0xd5, 0xbf, 0x54, 0xf6, 0x17,
+  0x58, 0x00, 0xbd, 0x1b, 0x69, 0xe6, 0x36, 0xd0, 0xbf, 0x33, 0x30, 0xc5,
+  0x84, 0x43, 0x20, 0x21, 0x58, 0xbf, 0x2f, 0xa8, 0x43, 0xfc, 0x26, 0xde,
+  0x0e, 0xdb, 0x87, 0xe5, 0xa6, 0x24, 0x39, 0xe2, 0x73, 0x14, 0x93, 0xda,
+  0x22, 0x60, 0xc1, 0x5e, 0xf4, 0x74, 0x99, 0xf9, 0x94, 0x28, 0x85, 0x08,
+  0x13, 0x37, 0x86, 0x07, 0x3a, 0x1f, 0x01, 0x00, 0x67, 0xaf, 0x65, 0x43,
+  0x04, 0x50, 0x85, 0x10, 0x34, 0x38, 0x15, 0x95, 0xa9, 0xb5, 0x44, 0xc8,
+  0xce, 0xbe, 0xa2, 0xb1, 0xb1, 0x8d, 0x81, 0x70, 0x41, 0x41, 0xcf, 0x08,
+  0x4f, 0x00, 0x07, 0xb3, 0x6e, 0xb0, 0x9c, 0x5f, 0xf2, 0x92, 0x84, 0x19,
+  0x33, 0xdf, 0x01, 0x5c, 0x82, 0x24, 0x56, 0x7b, 0xb1, 0xae, 0xf0, 0x8e,
+  0xf2, 0x9a, 0xa0, 0xa7, 0x6f, 0x2e, 0xea, 0x5b, 0xca, 0x0a, 0x2d, 0x4c,
+  0x9f, 0xd4, 0x80, 0xed, 0xcb, 0xb4, 0x0b, 0x80, 0xe8, 0x78, 0x38, 0x51,
+  0x28, 0x35, 0x40, 0x94, 0x0c, 0xf7, 0xb9, 0x89, 0xea, 0x90, 0x59, 0x51,
+  0x0f, 0x65, 0x0c, 0xe8, 0xd9, 0x51, 0xc5, 0x9e, 0x13, 0x77, 0xae, 0x01,
+  0x16, 0x3a, 0x57, 0xe8, 0xaf, 0x69, 0x64, 0xcc, 0x59, 0x77, 0x00, 0x01,
+  0x46, 0x72, 0xd2, 0x64, 0xe8, 0xd9, 0x60, 0x00, 0xd1, 0x3f, 0x5a, 0x21,
+  0xd5, 0xdf, 0x20, 0xb5, 0x71, 0x47, 0x1b, 0xfa, 0xd8, 0xf6, 0x1f, 0x39,
+  0x4a, 0xbb, 0xcd, 0x1a, 0x0f, 0xda, 0x45, 0xe4, 0x3a, 0x1d, 0x76, 0x07,
+  0x2e, 0xe7, 0x65, 0xbb, 0x3b, 0x86, 0x3a, 0xd2, 0xa1, 0x7d, 0x03, 0xb6,
+  0x47, 0x9d, 0x30, 0x1c, 0x1d, 0xf1, 0x9f, 0xa0, 0xb3, 0x5d, 0x83, 0x8f,
+  0xd4, 0x65, 0x29, 0x39, 0x3f, 0x5f, 0xa9, 0x7f, 0xa8, 0xe2, 0x7c, 0xd5,
+  0x36, 0x81, 0xd1, 0x70, 0xb6, 0x1f, 0x27, 0x2e, 0x5b, 0xd8, 0xe7, 0x53,
+  0x7d, 0x3a, 0x5a, 0x90, 0x7f, 0x4d, 0x91, 0xf8, 0x55, 0x14, 0x14, 0x8f,
+  0xb6, 0x1b, 0xff, 0x9f, 0x0b, 0xc7, 0x70, 0x40, 0xd1, 0xe1, 0xc7, 0x98,
+  0x5b, 0xd8, 0x06, 0x8f, 0x03, 0x16, 0x4c, 0xf5, 0xff, 0x4e, 0x0e, 0xba,
+  0x6a, 0x18, 0x7e, 0x9d, 0x9b, 0x95, 0xf1, 0x9a, 0xa1, 0xc0, 0x17, 0xc6,
+  0xf6, 0x68, 0xb6, 0xd2, 0x17, 0x4e, 0xab, 0x3e, 0xc3, 0x32, 0x9f, 0xac,
+  0x56, 0x8f, 0xcd, 0xcf, 0x0b, 0x0f, 0xee, 0x88, 0x55, 0xc6, 0x82, 0xfe,
+  0x87, 0xe1, 0x12, 0x7c, 0x3b, 0xfc, 0xbb, 0x54, 0x61, 0x40, 0x51, 0x4d,
+  0x3d, 0x31, 0xaa, 0xea, 0xa9, 0xb9, 0xbd, 0x66, 0x55, 0xae, 0x7a, 0x20,
+  0xec, 0x89, 0xdd, 0x33, 0x38, 0xa8, 0x4a, 0xe4, 0x3e, 0x36, 0xe6, 0x1d,
+  0x5d, 0x5d, 0x0c, 0xbb, 0xcc, 0x7b, 0x50, 0x6d, 0xca, 0x1b, 0xc0, 0x41,
+  0x8f, 0x12, 0xd8, 0xb8, 0xec, 0xce, 0xbd, 0xe7, 0x1f, 0xcd, 0x5d, 0xf7,
+  0x1d, 0x1e, 0x59, 0xce, 0xf7, 0x25, 0x18, 0x74, 0x24, 0x96, 0xc8, 0x17,
+  0x68, 0x58, 0x94, 0x03, 0x20, 0xcb, 0xae, 0xa8, 0xd4, 0x92, 0x60, 0x38,
+  0x79, 0x2a, 0x96, 0x91
+};
+unsigned int encrypted_ocb_10k_gpg_len = 8296;
@@ -0,0 +1,58 @@
+unsigned char encrypted_zip_10k_gpg[] = {
+  0x8c, 0x0d, 0x04, 0x07, 0x03, 0x02, 0xbc, 0xf1, 0x81, 0xd9, 0x31, 0xca,
+  0x31, 0xae, 0xff, 0xd2, 0xe9, 0x01, 0x5f, 0xe3, 0x46, 0x87, 0xfb, 0x00,
+  0x71, 0xf3, 0x8e, 0x7a, 0x24, 0x67, 0x66, 0x8c, 0xec, 0x37, 0x47, 0x72,
+  0x3f, 0x76, 0x10, 0xc5, 0x31, 0xc1, 0x20, 0x1a, 0xfb, 0x2d, 0x95, 0xdc,
+  0x5a, 0xd3, 0x97, 0x21, 0xbb, 0xb7, 0xf5, 0xfa, 0x3f, 0xf3, 0x22, 0x9b,
+  0xb9, 0x76, 0x3b, 0xff, 0xaa, 0x9a, 0x99, 0xad, 0x5d, 0xd9, 0x97, 0x65,
+  0x41, 0x8d, 0xda, 0x70, 0xeb, 0x30, 0x71, 0x73, 0xee, 0x6a, 0x5a, 0xa9,
+  0x19, 0xc3, 0x2e, 0x56, 0xbd, 0x30, 0x78, 0x21, 0x10, 0x0c, 0x64, 0xc8,
+  0xaf, 0xc3, 0x61, 0x5d, 0x91, 0xd4, 0xf6, 0x34, 0x42, 0x1c, 0x93, 0x25,
+  0xf1, 0x33, 0x00, 0xd5, 0x48, 0x90, 0x71, 0x70, 0x4c, 0x6a, 0x96, 0x17,
+  0xf3, 0x5a, 0xd6, 0x48, 0xbb, 0xee, 0x4d, 0x40, 0x2d, 0x71, 0x73, 0xe6,
+  0x32, 0xf7, 0x50, 0x0a, 0x4c, 0x1b, 0x61, 0x9a, 0x00, 0xd1, 0xa4, 0x84,
+  0x63, 0x40, 0x10, 0x6c, 0xce, 0x0c, 0xe5, 0xff, 0x0e, 0x43, 0xc3, 0xe1,
+  0x95, 0xae, 0x5a, 0x4e, 0x8d, 0x2c, 0xcb, 0xb4, 0x20, 0xc8, 0x32, 0xb2,
+  0xb7, 0xc4, 0xfb, 0xf1, 0x41, 0x28, 0x94, 0x49, 0xe3, 0x10, 0x35, 0x5c,
+  0xbe, 0x19, 0xda, 0x46, 0xd3, 0x60, 0xf2, 0x12, 0xfe, 0xfe, 0x4f, 0xd5,
+  0x23, 0xe3, 0xb9, 0x5c, 0xd8, 0x97, 0xf7, 0x51, 0x45, 0x8e, 0x16, 0x98,
+  0x24, 0x18, 0xae, 0xee, 0x81, 0x7c, 0x7c, 0x11, 0xb8, 0x64, 0xae, 0x44,
+  0x71, 0x06, 0x19, 0x09, 0x33, 0x88, 0x52, 0x54, 0x24, 0xb6, 0x54, 0x88,
+  0x7d, 0x50, 0x27, 0xd1, 0x51, 0x12, 0xd6, 0x67, 0x18, 0x01, 0x59, 0x5a,
+  0xae, 0x67, 0x84, 0xf5, 0xc2, 0x7e, 0x4f, 0x0a, 0xd4, 0x71, 0x07, 0xd6,
+  0x0a, 0x0a, 0xd6, 0xb6, 0x3a, 0x41, 0xd4, 0xb7, 0x90, 0x07, 0xb7, 0x36,
+  0x3a, 0xdf, 0x88, 0x65, 0xb9, 0x41, 0xea, 0xdf, 0xdf, 0xd9, 0x8d, 0x8c,
+  0x0b, 0x5a, 0x38, 0x67, 0x15, 0xc3, 0x43, 0x9b, 0xd4, 0xc2, 0x7c, 0xdc,
+  0x46, 0x14, 0xd7, 0x02, 0xae, 0x08, 0xc9, 0xe4, 0xc5, 0xf5, 0x81, 0x84,
+  0x2f, 0x5d, 0xf3, 0xcc, 0x39, 0x04, 0x40, 0xf7, 0xd4, 0x26, 0x89, 0x62,
+  0x79, 0xa4, 0x6b, 0xea, 0xc0, 0xf5, 0x0d, 0x17, 0x09, 0xf6, 0x3d, 0x0d,
+  0x53, 0x6a, 0xcd, 0x7e, 0x55, 0x18, 0xd9, 0x16, 0x24, 0x17, 0x99, 0xa3,
+  0x04, 0xe0, 0xd9, 0xc4, 0x95, 0x73, 0x4d, 0xae, 0xda, 0x1a, 0x94, 0x2e,
+  0x31, 0x3f, 0x12, 0x27, 0x3a, 0xc2, 0x75, 0x40, 0x04, 0x1f, 0x73, 0xeb,
+  0x8f, 0x58, 0x45, 0x27, 0x55, 0x65, 0x62, 0xe6, 0x46, 0x7b, 0x47, 0xc5,
+  0x96, 0x8c, 0xcc, 0xf4, 0x24, 0x68, 0x9a, 0x9a, 0x51, 0x07, 0x00, 0x8e,
+  0x46, 0xb0, 0x21, 0xd4, 0x04, 0x72, 0x9d, 0x31, 0x00, 0x31, 0xb6, 0x68,
+  0x57, 0x48, 0xa6, 0xe5, 0xba, 0xf4, 0xca, 0x67, 0x4e, 0xb8, 0x78, 0xd6,
+  0x0c, 0xd1, 0x27, 0x5d, 0xea, 0x66, 0x41, 0x01, 0xc3, 0xac, 0x6f, 0xdc,
+  0x01, 0xb2, 0xd2, 0xc4, 0xfb, 0x76, 0x0b, 0xbf, 0xc5, 0xff, 0x0e, 0xe3,
+  0x7b, 0xa0, 0xda, 0xc5, 0x57, 0x0a, 0x2e, 0x5f, 0xe6, 0x55, 0x05, 0xc5,
+  0xb0, 0xfb, 0x43, 0x38, 0x6b, 0x57, 0x99, 0x72, 0x2c, 0xd4, 0x39, 0x84,
+  0x9c, 0x39, 0x56, 0xc3, 0xc1, 0xdf, 0x5d, 0x16, 0x82, 0xd2, 0x97, 0xf5,
+  0xa1, 0xcc, 0x0b, 0x6a, 0x12, 0x5b, 0xc0, 0xbf, 0x6d, 0xa6, 0x27, 0x99,
+  0x78, 0x12, 0x96, 0xc6, 0xf1, 0x50, 0x12, 0xa9, 0xa4, 0x6d, 0x0b, 0x20,
+  0x5c, 0xfd, 0x0b, 0xfa, 0xb5, 0xa5, 0x37, 0xc3, 0x59, 0x48, 0xb1, 0x0e,
+  0xc9, 0x11, 0xe4, 0xf6, 0xc5, 0x34, 0x85, 0xb7, 0xac, 0xc4, 0xc1, 0x6a,
+  0x69, 0xf6, 0x4d, 0xcc, 0xcc, 0x26, 0xc7, 0x84, 0x12, 0x10, 0x50, 0x04,
+  0xb6, 0x82, 0x0e, 0x21, 0x94, 0x97, 0xcc, 0x8e, 0xd5, 0x1e, 0x56, 0xf1,
+  0xa3, 0xa0, 0x43, 0x73, 0x6a, 0x66, 0xa0, 0x89, 0x00, 0x8c, 0x3b, 0xaa,
+  0xef, 0x3d, 0xba, 0xfc, 0x35, 0x23, 0x13, 0xc5, 0x5a, 0x30, 0x41, 0x44,
+  0xbd, 0xbe, 0x82, 0xba, 0x46, 0x00, 0xd3, 0x08, 0xa8, 0x69, 0x42, 0x51,
+  0xec, 0x9d, 0x36, 0x50, 0x16, 0x0c, 0x73, 0xde, 0x89, 0x43, 0xbd, 0xd5,
+  0xb6, 0xf2, 0x73, 0x72, 0x50, 0xe7, 0x99, 0x21, 0x77, 0x79, 0x68, 0x4c,
+  0x0a, 0xda, 0xa8, 0x58, 0xd3, 0xd4, 0xe2, 0xd6, 0x64, 0x58, 0x8e, 0xc7,
+  0x70, 0x3a, 0xbf, 0xaf, 0x1b, 0x59, 0x14, 0x87, 0xc1, 0xf2, 0xca, 0x61,
+  0x47, 0xfc, 0x08, 0xc1, 0x1e, 0x9e, 0xce, 0x5e, 0x76, 0xda, 0x76, 0xff,
+  0x00, 0x51, 0xb4, 0x1a, 0xb5, 0x1d, 0xfc, 0xcd, 0x26, 0x85, 0xec, 0xe1,
+  0xcb, 0xf9, 0xb9, 0x28, 0x42, 0x3c, 0x29, 0xb9, 0x84, 0x15, 0x79, 0x33
+};
+unsigned int encrypted_zip_10k_gpg_len = 660;
@@ -0,0 +1,59 @@
+unsigned char encrypted_zlib_10k_gpg[] = {
+  0x8c, 0x0d, 0x04, 0x07, 0x03, 0x02, 0xe4, 0xe9, 0xda, 0xa2, 0x71, 0xfa,
+  0x67, 0xc7, 0xff, 0xd2, 0xe9, 0x01, 0xe4, 0x28, 0x42, 0x49, 0xd5, 0x1d,
+  0x96, 0xe7, 0x74, 0xb6, 0xd7, 0x42, 0xf7, 0x2c, 0xe7, 0xd5, 0x0b, 0x5f,
+  0x6c, 0x04, 0xd2, 0x51, 0xd3, 0x5e, 0x17, 0x7b, 0xeb, 0xef, 0x66, 0xa5,
+  0xbe, 0x02, 0x51, 0x35, 0x02, 0xe4, 0x9b, 0x49, 0x9f, 0x1f, 0xb0, 0xcc,
+  0xb8, 0x33, 0xfe, 0xe1, 0x08, 0x46, 0x8e, 0xa0, 0xb8, 0x53, 0x02, 0x2b,
+  0x5b, 0xcb, 0x29, 0x4f, 0x5a, 0xc7, 0xe2, 0x61, 0xa2, 0xfa, 0x45, 0x58,
+  0xec, 0x70, 0xf7, 0xba, 0xb5, 0x14, 0x8d, 0x82, 0xd6, 0x53, 0xa6, 0x9e,
+  0x32, 0x44, 0x07, 0x56, 0x15, 0xdf, 0x72, 0x30, 0xdd, 0x20, 0x84, 0x19,
+  0x7c, 0xdc, 0xc7, 0x2e, 0x6e, 0x26, 0xb4, 0xbd, 0xf7, 0x5e, 0xeb, 0xe2,
+  0xd9, 0x9c, 0xa0, 0xbb, 0xbe, 0xeb, 0x90, 0xc9, 0xee, 0xda, 0x2c, 0x43,
+  0x75, 0x4a, 0xef, 0xfc, 0x6d, 0x1c, 0x86, 0x67, 0x77, 0x68, 0xc3, 0x43,
+  0x26, 0x0d, 0x46, 0x05, 0xe2, 0x2a, 0xe6, 0xff, 0xa6, 0x68, 0xa2, 0xc6,
+  0x5c, 0x1d, 0x45, 0xc7, 0xcf, 0x7f, 0x04, 0x59, 0xd2, 0xd8, 0x23, 0x04,
+  0x18, 0xeb, 0xce, 0x0e, 0x91, 0xad, 0x2f, 0xd1, 0x97, 0xe6, 0xab, 0x83,
+  0x24, 0xb8, 0x17, 0x96, 0xf3, 0x45, 0x94, 0x50, 0xb0, 0xf3, 0xda, 0x27,
+  0xa0, 0xd5, 0x5f, 0x20, 0xc2, 0xaa, 0x63, 0x20, 0xa5, 0x38, 0x2e, 0x1a,
+  0x38, 0x8e, 0x0c, 0x52, 0x4d, 0x0d, 0x7a, 0xd5, 0x85, 0x3e, 0xe2, 0x41,
+  0x21, 0x7b, 0x86, 0xdc, 0xea, 0xa6, 0x71, 0x9f, 0x2c, 0x9e, 0x42, 0xac,
+  0x63, 0x3b, 0x89, 0x15, 0xff, 0x49, 0x41, 0x93, 0x40, 0xaf, 0x1f, 0xc4,
+  0x30, 0xbb, 0xd1, 0x44, 0xdd, 0x8f, 0x07, 0x92, 0xe3, 0xfc, 0xcd, 0xb1,
+  0x73, 0x03, 0xe8, 0x8c, 0x9d, 0x54, 0x37, 0x36, 0x07, 0x66, 0xbe, 0x68,
+  0xbe, 0xb0, 0x31, 0x89, 0x07, 0xad, 0xe5, 0xb7, 0x33, 0x35, 0x2e, 0xc5,
+  0xe4, 0x4a, 0xf7, 0xd4, 0x2b, 0xf6, 0xac, 0xa6, 0x19, 0x9e, 0x68, 0xc1,
+  0xb2, 0xfc, 0x65, 0xc8, 0x4d, 0x00, 0x60, 0xb6, 0x8b, 0x0b, 0x5f, 0x50,
+  0x4a, 0x8f, 0xca, 0x27, 0x95, 0xd3, 0x40, 0xdb, 0x79, 0xfd, 0x9d, 0x80,
+  0x06, 0xd5, 0xcc, 0x6e, 0x27, 0x87, 0x86, 0xe0, 0x25, 0x89, 0x29, 0x51,
+  0xd5, 0x97, 0xf2, 0x03, 0x3a, 0x76, 0x1c, 0x67, 0xfa, 0x4d, 0x2b, 0xa7,
+  0x9e, 0x9a, 0x62, 0x43, 0x60, 0xa4, 0x43, 0xda, 0x15, 0xa1, 0xef, 0x93,
+  0x07, 0xde, 0x0d, 0xb0, 0x41, 0x9f, 0x1e, 0xda, 0xa9, 0x45, 0xcc, 0xb1,
+  0x3a, 0xca, 0xbc, 0x16, 0xb7, 0xf5, 0x88, 0x0a, 0x34, 0x90, 0xce, 0x32,
+  0x7a, 0x9a, 0xd8, 0xdd, 0x81, 0x9f, 0x69, 0x53, 0x43, 0xb2, 0x23, 0xac,
+  0x40, 0x02, 0xbc, 0x8b, 0x54, 0x23, 0xa2, 0x0f, 0x9c, 0xb3, 0x1a, 0x5c,
+  0xf2, 0x3f, 0xf8, 0xb2, 0x47, 0xaf, 0xbd, 0x3c, 0x9a, 0xb0, 0x53, 0xc9,
+  0xba, 0x73, 0x31, 0x34, 0xbc, 0xbb, 0xa3, 0x1e, 0x03, 0xd7, 0xc9, 0x5c,
+  0x62, 0x43, 0x16, 0x8f, 0xb2, 0xf5, 0x40, 0x48, 0x82, 0x64, 0xad, 0x1d,
+  0xb7, 0x17, 0x94, 0x27, 0x30, 0xf0, 0xec, 0xc2, 0x61, 0xc9, 0x68, 0xbe,
+  0x98, 0x5c, 0x7d, 0xf1, 0xea, 0x5d, 0x41, 0x75, 0x69, 0xf3, 0x17, 0x44,
+  0xad, 0x22, 0x9a, 0xc3, 0x8f, 0x1e, 0x1d, 0x66, 0xf6, 0x07, 0x90, 0x10,
+  0x64, 0xc1, 0xe6, 0x2c, 0xce, 0xee, 0xf6, 0xa3, 0x84, 0xcc, 0x31, 0x23,
+  0xec, 0xd2, 0xd6, 0x80, 0x31, 0x0b, 0x68, 0x73, 0xd8, 0x58, 0x94, 0x94,
+  0x15, 0xd3, 0x75, 0x98, 0xd4, 0x35, 0x6b, 0x1a, 0x0e, 0x19, 0x42, 0x36,
+  0xe3, 0x36, 0x78, 0x05, 0x2c, 0x63, 0xb1, 0x97, 0x56, 0x41, 0x7a, 0x5f,
+  0x65, 0xe3, 0x5b, 0xd6, 0x47, 0x1e, 0x95, 0xad, 0x28, 0xfb, 0xf1, 0x0a,
+  0x09, 0x88, 0xfc, 0xd6, 0x62, 0x47, 0x8d, 0x35, 0x4a, 0xf5, 0xbb, 0x1b,
+  0xad, 0xd6, 0x45, 0xe8, 0xc6, 0x86, 0x01, 0x66, 0x2c, 0xd1, 0x68, 0x8e,
+  0x21, 0x49, 0x3c, 0x0f, 0xdd, 0xb3, 0x24, 0xbc, 0x8b, 0x6b, 0x3c, 0xf4,
+  0x4e, 0xa4, 0x85, 0xfb, 0xe0, 0x66, 0xaf, 0xc9, 0x6f, 0x15, 0x0b, 0xb6,
+  0xaf, 0xa2, 0x62, 0x45, 0x13, 0x3d, 0x54, 0x8a, 0xd6, 0x59, 0x30, 0xf1,
+  0xc7, 0x5f, 0xab, 0xd0, 0x94, 0xdc, 0x8d, 0xff, 0xd5, 0x41, 0xc2, 0xe2,
+  0xf7, 0xc8, 0xa1, 0xd9, 0x71, 0x7d, 0x7b, 0x2a, 0xd8, 0x35, 0x6e, 0xa7,
+  0x80, 0xed, 0xd9, 0x94, 0xe8, 0x4f, 0x62, 0x0a, 0xd8, 0xd8, 0xba, 0x4b,
+  0x5d, 0xb7, 0xb3, 0x6c, 0xe9, 0xa2, 0xe1, 0xdc, 0x5f, 0xed, 0x23, 0xaa,
+  0x44, 0x6c, 0xea, 0x01, 0xab, 0xb5, 0x5e, 0xa1, 0xc0, 0x3a, 0x61, 0xca,
+  0x19, 0xd3, 0xc5, 0xf7, 0x7a, 0x8b, 0x82, 0x05, 0xbb, 0xf4, 0x7e, 0x43,
+  0x98, 0xcd, 0xec, 0x7f, 0x13, 0xf7
+};
+unsigned int encrypted_zlib_10k_gpg_len = 666;
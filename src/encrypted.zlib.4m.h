@@ -0,0 +1,1755 @@
+unsigned char encrypted_zlib_4m_gpg[] = {
+  0x8c, 0x0d, 0x04, 0x07, 0x03, 0x02, 0x94, 0x11, 0x50, 0x17, 0x77, 0xbb,
+  0x62, 0x79, 0xff, 0xd2, 0xed, 0x01, 0x2c, 0xaa, 0xa0, 0x3c, 0x73, 0x67,
+  0x07, 0x5e, 0x99, 0x8b, 0x1f, 0x3d, 0x46, 0x44, 0xdb, 0xa0, 0xd1, 0x98,
+  0x58, 0x48, 0xff, 0xd1, 0xa3, 0x6c, 0xfe, 0xd0, 0x4e, 0x99, 0x78, 0xa5,
+  0x1b, 0x1f, 0xf9, 0xe6, 0x12, 0x98, 0xdf, 0x41, 0x4f, 0xa6, 0xaa, 0xd9,
+  0xb3, 0xe1, 0x7b, 0xb1, 0x6a, 0xec, 0x83, 0x5d, 0xb4, 0x72, 0x96, 0x5a,
+  0xa2, 0x77, 0x05, 0x42, 0x0c, 0xd4, 0x87, 0x36, 0x44, 0x07, 0x38, 0x4c,
+  0x3d, 0x26, 0x5c, 0x9c, 0x6d, 0x28, 0xb1, 0xfe, 0xc9, 0x3a, 0x4d, 0x13,
+  0xfa, 0xa7, 0xbf, 0xd5, 0x0a, 0x1f, 0xf1, 0x0f, 0xb3, 0xef, 0xcd, 0x8b,
+  0x8b, 0x71, 0x24, 0xb5, 0x61, 0x4c, 0xe5, 0xc5, 0x42, 0xd4, 0xa6, 0xa3,
+  0x5c, 0x5f, 0xce, 0xf2, 0xd3, 0xe2, 0x0d, 0xbe, 0xab, 0xcd, 0x29, 0xed,
+  0xcc, 0x5b, 0x33, 0xed, 0x71, 0x2b, 0xc6, 0xe3, 0x68, 0xea, 0x78, 0xf1,
+  0xe9, 0xc0, 0xd7, 0xfa, 0x22, 0x68, 0xf5, 0xf4, 0x37, 0x26, 0x54, 0xbb,
+  0x6a, 0x7a, 0x6e, 0xf6, 0xda, 0x48, 0x39, 0xca, 0x36, 0x03, 0x45, 0x3c,
+  0x5e, 0xe0, 0x45, 0x2c, 0xc6, 0x28, 0x77, 0x07, 0x35, 0x11, 0x0a, 0x43,
+  0x17, 0xab, 0x57, 0x1b, 0x92, 0x5d, 0x41, 0x85, 0x7b, 0x8d, 0xd1, 0xa7,
+  0xb0, 0x7f, 0x8b, 0x24, 0xeb, 0xe4, 0xbf, 0x18, 0xcb, 0x5b, 0xf3, 0x11,
+  0xb2, 0xc5, 0xd7, 0xc8, 0x70, 0x38, 0xdd, 0x74, 0x0d, 0xf2, 0x48, 0xb6,
+  0x8f, 0x9c, 0xbc, 0x70, 0x38, 0x5d, 0x88, 0x26, 0x8d, 0xc3, 0xc1, 0xd7,
+  0xb3, 0xf3, 0x40, 0x3f, 0x19, 0x4d, 0xcc, 0x5c, 0x63, 0xa0, 0x79, 0xbc,
+  0xbb, 0xb3, 0xa2, 0xd4, 0x7b, 0xc6, 0x53, 0x72, 0x95, 0xb7, 0x8c, 0x60,
+  0x15, 0x20, 0x77, 0xf4, 0x1b, 0x3a, 0x69, 0x74, 0x66, 0xf3, 0x21, 0x77,
+  0xbc, 0x92, 0xcd, 0x2c, 0x39, 0x74, 0xf1, 0x9f, 0xbe, 0xe7, 0x80, 0x29,
+  0x5c, 0x3a, 0x60, 0x61, 0x5c, 0xd1, 0xc8, 0xb9, 0xbf, 0xd4, 0x4e, 0xce,
+  0xbd, 0x9b, 0x90, 0x15, 0x0d, 0x2f, 0x57, 0x99, 0xef, 0x22, 0x30, 0x5f,
+  0x48, 0x13, 0x89, 0xf5, 0x16, 0x09, 0x70, 0xb4, 0xbf, 0xf5, 0xb1, 0xb1,
+  0xbc, 0xa5, 0x7c, 0x0a, 0x69, 0xa3, 0xb4, 0x8f, 0xf8, 0xec, 0x06, 0x79,
+  0xb4, 0x10, 0x06, 0x7d, 0x97, 0xa5, 0xd9, 0xdf, 0x2a, 0x12, 0xc2, 0x14,
+  0xce, 0x9b, 0xcb, 0x07, 0xd7, 0x2d, 0x4b, 0x13, 0xa2, 0x44, 0xc1, 0x87,
+  0xa6, 0x8a, 0x59, 0x5d, 0x67, 0xe3, 0x57, 0x2b, 0x15, 0x5a, 0xcf, 0x02,
+  0x72, 0x5b, 0xc7, 0xde, 0xb1, 0x70, 0x49, 0x9a, 0xd6, 0x43, 0xf1, 0x45,
+  0x6b, 0xbd, 0xa1, 0x24, 0x56, 0xc3, 0x92, 0xed, 0xff, 0x49, 0x19, 0x51,
+  0xa0, 0x9c, 0x0d, 0xaa, 0xcc, 0x05, 0x29, 0x7c, 0x92, 0x01, 0x20, 0xa0,
+  0xf4, 0xa7, 0x04, 0xfc, 0xd2, 0xd8, 0x75, 0x49, 0x73, 0x9a, 0x12, 0x83,
+  0x3d, 0x2c, 0xf3, 0x75, 0x76, 0xff, 0x71, 0x00, 0x57, 0x43, 0xe7, 0xa1,
+  0x9e, 0xbd, 0x4a, 0xa2, 0x75, 0xa9, 0x92, 0x78, 0xac, 0x9a, 0x2a, 0xf4,
+  0x9d, 0x15, 0xa4, 0x69, 0x97, 0x90, 0xe6, 0xdb, 0x25, 0xc1, 0x21, 0xa4,
+  0xa9, 0x22, 0x77, 0x87, 0xb7, 0x9a, 0x38, 0xd9, 0xab, 0x7b, 0x2f, 0x4b,
+  0x60, 0xfa, 0x3f, 0x72, 0x42, 0xdb, 0x17, 0x9d, 0x07, 0xab, 0x39, 0x90,
+  0x42, 0x64, 0xa9, 0x8e, 0xc3, 0xaa, 0x95, 0x2f, 0xe1, 0xf1, 0xbc, 0xb3,
+  0x63, 0x39, 0x32, 0xa4, 0xf3, 0x13, 0x8b, 0x43, 0x03, 0x5f, 0x81, 0x67,
+  0x47, 0x2e, 0x2f, 0xfc, 0x32, 0xa0, 0x2a, 0x07, 0x2c, 0x62, 0x3b, 0xae,
+  0xdf, 0xea, 0xb2, 0x68, 0x8a, 0xdd, 0xeb, 0x04, 0xc8, 0x3b, 0x1e, 0x5c,
+  0x26, 0x0f, 0x84, 0x5f, 0x88, 0xea, 0x5f, 0xcf, 0x4a, 0xb1, 0x94, 0x22,
+  0x4d, 0xe3, 0x5a, 0xbb, 0xec, 0xc0, 0x82, 0x77, 0x14, 0x94, 0x08, 0xb0,
+  0x7e, 0x43, 0x6d, 0x5e, 0x26, 0x27, 0x17, 0xec, 0xa0, 0x9d, 0xc3, 0x54,
+  0x6f, 0x24, 0xd0, 0x7a, 0x73, 0x5c, 0xb0, 0xbb, 0x90, 0x05, 0xc1, 0x8e,
+  0x74, 0x6c, 0xc1, 0x4a, 0x00, 0x83, 0x0f, 0xf5, 0xc5, 0x53, 0x3f, 0x86,
+  0x47, 0xe4, 0x7c, 0x29, 0xa5, 0x98, 0xc1, 0x10, 0xa9, 0x7d, 0xf8, 0xb9,
+  0x24, 0x9d, 0x09, 0x7c, 0xfb, 0xe0, 0x4f, 0x30, 0x14, 0x9d, 0x1c, 0x60,
+  0xaf, 0x0e, 0x93, 0x68, 0xaf, 0x6e, 0x79, 0x3e, 0xb0, 0x2c, 0xaa, 0x35,
+  0xfc, 0xed, 0xec, 0xe2, 0xe1, 0x3c, 0x29, 0xb8, 0x3d, 0x5d, 0xc1, 0xe3,
+  0xf6, 0x73, 0x0a, 0x4f, 0x1c, 0x29, 0x23, 0xe8, 0x6b, 0xd4, 0x6f, 0xca,
+  0xe4, 0x05, 0x8c, 0x05, 0xb8, 0xdb, 0x3a, 0x02, 0x29, 0xa4, 0x4d, 0xf1,
+  0x96, 0xa4, 0x18, 0xbc, 0x99, 0xb9, 0xd6, 0x0d, 0xb0, 0xdb, 0xb2, 0xac,
+  0x97, 0xff, 0xf3, 0x97, 0x61, 0x1b, 0xd3, 0x44, 0x9f, 0x58, 0x65, 0xcc,
+  0xdb, 0xc8, 0x44, 0x00, 0xf9, 0xbd, 0x2f, 0xf0, 0x7e, 0x9a, 0x8e, 0x3f,
+  0x14, 0x9f, 0x95, 0x72, 0x0c, 0x15, 0xcd, 0x8c, 0x67, 0x4c, 0xe1, 0x64,
+  0x2c, 0x53, 0xcc, 0x5a, 0x32, 0xe1, 0x38, 0x07, 0x22, 0x66, 0xa8, 0x92,
+  0x00, 0x2f, 0x90, 0xb2, 0xde, 0x83, 0xe7, 0x85, 0xb5, 0xf5, 0xa9, 0xac,
+  0x90, 0x42, 0xd3, 0x60, 0xb1, 0xc2, 0x57, 0xc6, 0xad, 0xa2, 0x68, 0x8f,
+  0xa9, 0xc1, 0x83, 0x92, 0x64, 0x16, 0xd5, 0x75, 0x01, 0x5c, 0x26, 0x9f,
+  0x10, 0xaa, 0x38, 0xc3, 0x11, 0x3a, 0x91, 0xab, 0x2e, 0x7e, 0xca, 0xd0,
+  0xc6, 0xf6, 0x3f, 0xe1, 0x3b, 0x35, 0x06, 0x38, 0x12, 0x5f, 0x31, 0xda,
+  0x4f, 0xfe, 0x4f, 0x3e, 0xb4, 0x57, 0xfa, 0x7e, 0x75, 0x5e, 0xdb, 0xa9,
+  0xba, 0x4b, 0xdf, 0x57, 0x4c, 0xf6, 0x22, 0x87, 0x8f, 0xb1, 0x3f, 0xf6,
+  0xff, 0x15, 0xe5, 0x2b, 0x98, 0xa5, 0x9b, 0x60, 0x66, 0x29, 0xfb, 0xf4,
+  0x2e, 0x5a, 0x10, 0x52, 0x66, 0x19, 0xd0, 0x22, 0x89, 0x5b, 0x36, 0xde,
+  0xad, 0xd1, 0xad, 0x05, 0x02, 0x1b, 0x39, 0xd8, 0xd0, 0x13, 0xf4, 0x8f,
+  0x55, 0x44, 0x11, 0x5d, 0xc6, 0x06, 0x99, 0x35, 0xa7, 0x3e, 0x5f, 0xce,
+  0x4f, 0x7f, 0x9c, 0x44, 0xc0, 0x69, 0x41, 0xb0, 0xa0, 0xda, 0x2d, 0x20,
+  0xf5, 0xb5, 0x86, 0x74, 0xa1, 0x66, 0x1a, 0x9a, 0x00, 0x9a, 0xf6, 0x62,
+  0x28, 0x66, 0x1c, 0x18, 0xf1, 0xde, 0x19, 0x75, 0x4f, 0x40, 0xa2, 0xd3,
+  0xfd, 0xff, 0xa2, 0x64, 0x30, 0xc7, 0x96, 0xd7, 0x5a, 0xbe, 0xbc, 0x82,
+  0x6a, 0xf5, 0xa7, 0xbd, 0x8a, 0x14, 0xf6, 0xe7, 0x83, 0x76, 0xa9, 0x9c,
+  0xef, 0x77, 0x21, 0x79, 0xfd, 0xfa, 0xbe, 0x76, 0x25, 0xb2, 0xd7, 0x6a,
+  0x7e, 0xcf, 0x73, 0x05, 0x6a, 0xf9, 0xd0, 0x6a, 0xaa, 0x62, 0xe0, 0x07,
+  0xc3, 0x74, 0xa1, 0x74, 0x39, 0xe1, 0x61, 0x7c, 0x50, 0x5a, 0x6f, 0x45,
+  0x2a, 0x68, 0x83, 0x91, 0x3a, 0xb8, 0x70, 0x6b, 0x17, 0x97, 0x8c, 0x81,
+  0xc3, 0x1d, 0x17, 0x38, 0x31, 0xed, 0x43, 0xd6, 0xbc, 0xe3, 0xa4, 0xd9,
+  0xdd, 0x8a, 0x44, 0x07, 0x79, 0xa7, 0xc1, 0xd5, 0xf7, 0xcb, 0xb2, 0xf3,
+  0xf0, 0x66, 0xb4, 0x8d, 0xc4, 0x7d, 0xeb, 0x12, 0xc5, 0x0e, 0xb5, 0xf6,
+  0xff, 0x56, 0x28, 0xa4, 0xf8, 0x3e, 0x98, 0x11, 0x33, 0xb2, 0xdf, 0x12,
+  0x46, 0x98, 0x2c, 0xcb, 0xef, 0xc6, 0x87, 0x97, 0xcd, 0x4e, 0xc5, 0x8e,
+  0x0a, 0x7a, 0xb2, 0x21, 0x15, 0x4d, 0x36, 0x9a, 0x94, 0x25, 0xfc, 0x07,
+  0x80, 0xab, 0x49, 0xe1, 0xf5, 0x83, 0x24, 0xe3, 0xdb, 0xdf, 0x4c, 0x7a,
+  0x0d, 0x3c, 0x0c, 0x83, 0x1c, 0x48, 0x14, 0x67, 0x83, 0x01, 0xdb, 0x60,
+  0x28, 0xc6, 0x0a, 0xa9, 0xf9, 0xbf, 0x24, 0xa7, 0x37, 0x66, 0x38, 0xe5,
+  0x5f, 0xfc, 0xd0, 0x1d, 0xe6, 0x9f, 0x73, 0xeb, 0xa3, 0x55, 0xff, 0xc4,
+  0xa8, 0xf5, 0x4f, 0xe9, 0x35, 0x16, 0xbc, 0xab, 0x03, 0x92, 0xd4, 0xfd,
+  0x06, 0x6a, 0x2c, 0xaf, 0xdb, 0xb2, 0xa6, 0xe4, 0xc4, 0xd9, 0x7f, 0x29,
+  0x56, 0xf0, 0x26, 0x7b, 0x01, 0x23, 0xd8, 0xfe, 0xd7, 0xa8, 0x2c, 0x61,
+  0xa2, 0x79, 0x84, 0xa3, 0x46, 0x98, 0x27, 0xad, 0x49, 0x90, 0x75, 0xfc,
+  0xb4, 0xb9, 0x43, 0xc2, 0xa1, 0x4a, 0xe7, 0x26, 0xeb, 0x7a, 0xa7, 0xed,
+  0xa2, 0x77, 0x58, 0xf9, 0xc3, 0x5a, 0xb7, 0xfc, 0x04, 0x95, 0x97, 0x43,
+  0xde, 0x52, 0xb2, 0x3d, 0x57, 0xb5, 0x51, 0x7c, 0x9d, 0x3f, 0x5f, 0x9e,
+  0xcc, 0xb8, 0x83, 0xfc, 0x72, 0x28, 0xb5, 0x63, 0x06, 0x7f, 0x44, 0xc7,
+  0x90, 0x8f, 0x36, 0x71, 0x82, 0x3b, 0x97, 0x58, 0xc8, 0xaa, 0x26, 0x4b,
+  0xab, 0x4c, 0x0b, 0x3d, 0x49, 0xa5, 0x0f, 0x31, 0x14, 0xbe, 0xb6, 0x0b,
+  0xa9, 0x14, 0x69, 0x31, 0x1c, 0x4b, 0x8e, 0xc6, 0x31, 0x34, 0xad, 0x56,
+  0xd7, 0xa2, 0x13, 0x2e, 0xb5, 0xad, 0xd7, 0x23, 0xa5, 0x0a, 0x11, 0x0a,
+  0x0e, 0xba, 0x4f, 0xa7, 0xd8, 0x60, 0x38, 0x7e, 0xae, 0x67, 0x38, 0xf7,
+  0xba, 0x8d, 0x9b, 0x4e, 0xcd, 0x13, 0x96, 0xb2, 0x72, 0x6e, 0xb1, 0xe8,
+  0x75, 0x8c, 0xe1, 0x0d, 0x1c, 0x07, 0xba, 0x7e, 0x22, 0x83, 0x5a, 0x32,
+  0x6e, 0xe2, 0x00, 0xe8, 0xa2, 0x5a, 0xbe, 0x77, 0xf0, 0x6f, 0xd8, 0x16,
+  0x93, 0x92, 0xf9, 0x8e, 0x35, 0x4b, 0xb8, 0xa6, 0x96, 0x8f, 0xf7, 0xb6,
+  0x3f, 0x12, 0x78, 0x16, 0x4c, 0x79, 0x90, 0x3e, 0x7c, 0xfe, 0xd3, 0x41,
+  0xde, 0xf8, 0x0f, 0x50, 0xeb, 0xfd, 0xa9, 0x25, 0xfb, 0x57, 0x7d, 0xc0,
+  0x60, 0x67, 0x73, 0x5d, 0xac, 0xa1, 0xe6, 0x73, 0x43, 0x3d, 0x3e, 0xc4,
+  0xe5, 0xed, 0x62, 0x53, 0xa1, 0xe7, 0xf1, 0x7f, 0x1c, 0xba, 0x2f, 0x14,
+  0x7a, 0x8e, 0xf5, 0xc1, 0xc1, 0x24, 0xc2, 0xe4, 0xad, 0x13, 0x60, 0x8f,
+  0x80, 0x0e, 0x3a, 0xa9, 0xaa, 0x9e, 0x79, 0xbf, 0xcb, 0x03, 0x66, 0xda,
+  0x1f, 0xac, 0x0a, 0xfc, 0x27, 0xea, 0xf2, 0x50, 0x95, 0x5d, 0x8f, 0x77,
+  0xab, 0xef, 0x01, 0x06, 0x0e, 0x7b, 0x83, 0x02, 0x25, 0x4f, 0x30, 0x14,
+  0x05, 0xa8, 0x33, 0xf0, 0x61, 0x16, 0x6d, 0xbd, 0xd0, 0xf1, 0xf3, 0x30,
+  0x4c, 0xb1, 0x36, 0x08, 0x6c, 0x2a, 0x0e, 0xcf, 0xa2, 0x8f, 0xcd, 0x11,
+  0x19, 0x13, 0x91, 0xa3, 0xe3, 0x77, 0x5c, 0x4a, 0x03, 0xfe, 0x91, 0x53,
+  0x91, 0xe8, 0xaf, 0x09, 0x66, 0xcd, 0x6d, 0x9a, 0x1e, 0xf4, 0x84, 0xe8,
+  0xe6, 0xa9, 0x5f, 0xde, 0xc0, 0x2d, 0x5f, 0x9c, 0x98, 0xee, 0x2d, 0xe0,
+  0xca, 0x03, 0x39, 0x02, 0x88, 0x92, 0xa5, 0x9a, 0xa8, 0x74, 0xf2, 0x47,
+  0x33, 0x7f, 0x62, 0xe4, 0x4d, 0xa6, 0x72, 0x29, 0x4a, 0x17, 0xfb, 0x08,
+  0x00, 0xfa, 0x6b, 0x28, 0xef, 0xe1, 0x6d, 0xae, 0x64, 0xf6, 0xdc, 0xd0,
+  0x48, 0xb8, 0x98, 0x7b, 0x85, 0xe5, 0xa0, 0x7a, 0x24, 0x68, 0x55, 0x10,
+  0xb8, 0xd6, 0xea, 0xdd, 0xfe, 0x5e, 0xfd, 0xa4, 0xb0, 0xda, 0x27, 0x9a,
+  0xc6, 0x6c, 0x03, 0xb5, 0x5a, 0x7c, 0xe2, 0xe7, 0xcf, 0xa7, 0x0e, 0xf1,
+  0x27, 0x0d, 0x1b, 0xc3, 0xa6, 0xf9, 0x97, 0x6a, 0x1d, 0xfb, 0x1b, 0xcc,
+  0x75, 0x59, 0x2f, 0x84, 0xda, 0x4d, 0xd9, 0x8f, 0x62, 0x09, 0xa6, 0x81,
+  0x72, 0xe5, 0x47, 0xa5, 0x49, 0xb6, 0x5e, 0x19, 0x47, 0xee, 0x40, 0x81,
+  0x59, 0x57, 0xe7, 0x78, 0xd2, 0x01, 0xa5, 0x5b, 0xb0, 0xfb, 0x83, 0x6e,
+  0x60, 0xfe, 0x3c, 0x22, 0xfe, 0x10, 0xef, 0x19, 0xa1, 0x53, 0xf5, 0x3d,
+  0x79, 0x01, 0x1c, 0xfd, 0xa9, 0xee, 0x4b, 0x63, 0x1f, 0x7e, 0xfb, 0xe1,
+  0x06, 0xfc, 0xf9, 0x87, 0xa0, 0x8b, 0xa6, 0xfc, 0x69, 0x90, 0xc6, 0x93,
+  0x7d, 0x18, 0xbf, 0xb5, 0x0e, 0x4a, 0x93, 0xc3, 0x85, 0xc7, 0x59, 0x38,
+  0x6a, 0xc1, 0x68, 0x55, 0xce, 0xe4, 0x22, 0x3f, 0x3d, 0xee, 0x2f, 0x45,
+  0xc2, 0xcd, 0x65, 0x57, 0x3a, 0x8a, 0xd2, 0x10, 0xfc, 0x86, 0x95, 0x0c,
+  0xec, 0xba, 0xef, 0x8c, 0x74, 0x78, 0x75, 0xb0, 0x18, 0x89, 0x8b, 0xc2,
+  0x0f, 0xe9, 0x24, 0x5e, 0x09, 0x6b, 0x40, 0x1a, 0x09, 0x2b, 0x5b, 0x21,
+  0x5e, 0xf3, 0x97, 0x73, 0xf1, 0xe2, 0xac, 0xb0, 0xea, 0x05, 0x01, 0xec,
+  0x1f, 0x81, 0x51, 0xd5, 0x76, 0xdc, 0x66, 0xa9, 0x10, 0x27, 0xe8, 0xe8,
+  0x9e, 0xda, 0x13, 0xcd, 0x86, 0x98, 0x30, 0xb8, 0xf4, 0x8e, 0xfe, 0x2d,
+  0xe1, 0x4a, 0xf8, 0xc8, 0x95, 0x60, 0x6f, 0x8a, 0x9a, 0x00, 0x5c, 0xdb,
+  0x67, 0xa0, 0x95, 0x02, 0x09, 0xab, 0xbc, 0x2d, 0x63, 0xe0, 0x96, 0x2b,
+  0xf3, 0x9a, 0xf3, 0xf1, 0x1c, 0x2b, 0x22, 0x6c, 0x07, 0x9c, 0x2f, 0xd3,
+  0x55, 0x76, 0xe2, 0x91, 0x26, 0x96, 0xce, 0x9c, 0x2a, 0x5e, 0x9b, 0xfc,
+  0x97, 0x63, 0xd2, 0x96, 0x1c, 0xd0, 0xd1, 0x56, 0x24, 0xfd, 0x94, 0xe9,
+  0x03, 0x4b, 0xc9, 0xf4, 0x7c, 0xb4, 0xed, 0x46, 0x69, 0x6c, 0x7a, 0xbf,
+  0x2c, 0xc1, 0x0c, 0x9a, 0x24, 0xfd, 0x04, 0x49, 0xcf, 0x5e, 0x75, 0x56,
+  0x0e, 0x43, 0x24, 0x50, 0x40, 0x40, 0xd8, 0x2d, 0xba, 0x3f, 0xcc, 0x4a,
+  0xb4, 0xd5, 0xf3, 0xfe, 0x1d, 0x34, 0x15, 0xa1, 0x6a, 0xa6, 0x36, 0x94,
+  0x4c, 0x7f, 0x03, 0xa9, 0x95, 0xdf, 0xc4, 0x25, 0x64, 0x42, 0xa2, 0x4b,
+  0xa4, 0x4b, 0x6f, 0xe0, 0x07, 0x91, 0x82, 0xbd, 0x8d, 0xd3, 0xb7, 0x92,
+  0xb1, 0xb6, 0xda, 0x80, 0xa0, 0x8c, 0xc7, 0x20, 0x6c, 0x32, 0xfb, 0x43,
+  0x1f, 0xdf, 0xf4, 0x17, 0x12, 0xba, 0xaa, 0xf5, 0x94, 0xe5, 0x9a, 0xc6,
+  0x69, 0xd7, 0xbb, 0x78, 0xf0, 0x78, 0xe6, 0xf8, 0xfc, 0x9c, 0x43, 0x73,
+  0x87, 0x90, 0x92, 0x5f, 0x80, 0x74, 0xed, 0x94, 0x7d, 0xf7, 0x2f, 0xbd,
+  0x99, 0x9b, 0xc5, 0x90, 0xff, 0xf0, 0xab, 0x9d, 0x01, 0x54, 0xb6, 0xf4,
+  0xfa, 0xbd, 0xf8, 0x01, 0x7b, 0xbc, 0x4d, 0xc0, 0x16, 0x46, 0x65, 0x37,
+  0x54, 0x85, 0x72, 0x8b, 0x2b, 0x48, 0xe6, 0xa8, 0x05, 0x05, 0x80, 0x5c,
+  0x80, 0x97, 0x8a, 0x11, 0x15, 0xb5, 0xa9, 0x31, 0x20, 0x57, 0x57, 0x96,
+  0x33, 0x6a, 0x94, 0x56, 0x45, 0xd2, 0x34, 0x2c, 0x38, 0x3c, 0x65, 0x21,
+  0x7a, 0x29, 0x5a, 0xa4, 0xef, 0x79, 0x04, 0x4d, 0x77, 0x38, 0x2f, 0x50,
+  0xd3, 0x44, 0x38, 0xc1, 0xae, 0x2b, 0xc1, 0xbc, 0x6e, 0x31, 0x28, 0xc0,
+  0xed, 0x06, 0x3c, 0x10, 0x7b, 0x72, 0xd2, 0xb2, 0x1b, 0x88, 0xa2, 0xcf,
+  0x99, 0x49, 0x1c, 0x93, 0x54, 0xeb, 0xa2, 0x14, 0x8c, 0x7a, 0xe3, 0xa7,
+  0xfe, 0x47, 0x08, 0x04, 0x92, 0x25, 0xbf, 0x60, 0x72, 0x4c, 0xc2, 0xba,
+  0x08, 0x8b, 0xa9, 0xfa, 0x38, 0xd6, 0xaa, 0x63, 0x44, 0xc4, 0xb7, 0x84,
+  0x40, 0xc2, 0xb6, 0xae, 0x0e, 0x4f, 0x8c, 0xeb, 0xbf, 0x6a, 0x8a, 0xe3,
+  0xfd, 0xa4, 0x6a, 0x7c, 0x6b, 0x34, 0xd0, 0xa8, 0x78, 0xe6, 0x79, 0x0c,
+  0x0f, 0xd7, 0x23, 0xf7, 0x0d, 0x8a, 0x4d, 0xd6, 0xd5, 0xa5, 0x35, 0x9d,
+  0xa6, 0xdb, 0x4f, 0xb1, 0x2c, 0x87, 0xc9, 0x71, 0x3b, 0x57, 0xb8, 0x10,
+  0x41, 0x54, 0x77, 0xbf, 0x5f, 0xed, 0xa6, 0x5e, 0x61, 0x9e, 0xb8, 0x6e,
+  0xab, 0x2b, 0x21, 0x3a, 0xb2, 0x81, 0x7c, 0xe7, 0x9f, 0x9e, 0x81, 0x20,
+  0x27, 0xbb, 0x8f, 0x88, 0x30, 0xa0, 0x55, 0x6f, 0x85, 0xbf, 0xd6, 0xd8,
+  0x35, 0x8d, 0xab, 0x82, 0x48, 0x75, 0x0c, 0xdd, 0xe6, 0x20, 0x6a, 0xc5,
+  0x17, 0x42, 0xa4, 0x6b, 0x16, 0x57, 0x4d, 0x20, 0x15, 0xb9, 0xc3, 0x22,
+  0x79, 0xca, 0x20, 0xc6, 0xf7, 0xfb, 0x4f, 0x7d, 0x05, 0x0f, 0x7d, 0xe4,
+  0x90, 0x9e, 0x32, 0xfa, 0xf1, 0xa2, 0x2d, 0x3f, 0x7f, 0x99, 0x87, 0x4e,
+  0x52, 0x39, 0x1a, 0x74, 0x0d, 0x38, 0x32, 0x55, 0xfa, 0xf3, 0x67, 0x0c,
+  0x58, 0x4d, 0x51, 0x3b, 0x65, 0x14, 0x66, 0xd2, 0xda, 0x6a, 0x6c, 0x1e,
+  0x20, 0xde, 0x1d, 0xb0, 0xe8, 0x89, 0x36, 0xae, 0xda, 0xa7, 0x8d, 0x01,
+  0xac, 0xa9, 0xf9, 0x37, 0x9f, 0xa9, 0xba, 0x3f, 0xd7, 0x38, 0x62, 0x4b,
+  0x2a, 0xea, 0x80, 0x13, 0xef, 0xf7, 0x5a, 0x20, 0xa1, 0x75, 0xda, 0xc7,
+  0x25, 0x4e, 0xa7, 0xcd, 0x0d, 0xdb, 0x22, 0xa7, 0x44, 0xa6, 0x39, 0x1f,
+  0xa1, 0x66, 0xc7, 0x31, 0x35, 0xf3, 0x69, 0xca, 0x22, 0x34, 0x4e, 0x83,
+  0x3f, 0xb3, 0xda, 0x4a, 0xa9, 0x30, 0x02, 0x0d, 0x48, 0xaf, 0x10, 0x75,
+  0x8b, 0xb9, 0x88, 0x14, 0x19, 0x57, 0x70, 0x01, 0x50, 0xc2, 0x73, 0xd9,
+  0x08, 0x6d, 0xdd, 0x07, 0xb0, 0xb3, 0xc7, 0x4e, 0xa3, 0x39, 0x41, 0x93,
+  0xc0, 0x01, 0x5a, 0xe9, 0x33, 0x84, 0x2f, 0x8d, 0x6a, 0x5a, 0x27, 0xfd,
+  0xc3, 0x8c, 0x68, 0x42, 0x4e, 0x7f, 0x4a, 0x96, 0xd1, 0x37, 0x96, 0x2c,
+  0xda, 0xb0, 0xf2, 0x27, 0x24, 0x44, 0xa3, 0x01, 0xce, 0x30, 0xc6, 0x98,
+  0x1c, 0xb1, 0xa0, 0xf3, 0xbe, 0x8a, 0x93, 0xab, 0x71, 0xa0, 0x5b, 0x09,
+  0xc7, 0x7b, 0x6a, 0x97, 0x4d, 0x8f, 0xb9, 0xea, 0x76, 0x95, 0x10, 0x5b,
+  0xa7, 0xfb, 0x89, 0x01, 0x4e, 0x31, 0x7c, 0xd8, 0x09, 0x00, 0x21, 0x5c,
+  0xc3, 0xb5, 0xa2, 0xa2, 0x15, 0x53, 0x52, 0xa3, 0xfa, 0x9e, 0x54, 0xae,
+  0xb0, 0xf2, 0xc1, 0xfe, 0x7f, 0xd7, 0x5a, 0x9d, 0x10, 0x9c, 0x7f, 0x9d,
+  0x47, 0xef, 0xa2, 0x63, 0xf8, 0x1f, 0xde, 0xd8, 0x02, 0x98, 0xa2, 0x1d,
+  0x16, 0x70, 0x35, 0x56, 0xa2, 0xb6, 0x52, 0x60, 0xd8, 0xfb, 0x60, 0x63,
+  0x16, 0x11, 0xc0, 0xd4, 0x54, 0x38, 0x79, 0xc7, 0x9b, 0xa3, 0x98, 0x37,
+  0x62, 0x74, 0xeb, 0xb3, 0x39, 0x79, 0x69, 0x4f, 0x1a, 0x3f, 0x89, 0x0e,
+  0x1d, 0xa0, 0x6e, 0x31, 0xcc, 0xa1, 0x9d, 0xed, 0x51, 0x23, 0x56, 0xaf,
+  0xc7, 0xdb, 0x08, 0x8a, 0xdc, 0xfe, 0xbb, 0x5a, 0x22, 0xb6, 0x3f, 0xf6,
+  0x97, 0xab, 0xbd, 0xea, 0xd8, 0x1e, 0x36, 0xe6, 0x35, 0xea, 0x7a, 0xdb,
+  0x6b, 0xf9, 0xb9, 0xfc, 0xb3, 0xd1, 0xb1, 0x77, 0x49, 0x49, 0xbd, 0x96,
+  0x35, 0x4e, 0x4a, 0x85, 0xe0, 0x3c, 0x3b, 0xec, 0x99, 0xef, 0x89, 0xde,
+  0x87, 0x9c, 0xe9, 0xd2, 0x3a, 0x4a, 0xca, 0xb4, 0x0f, 0x4e, 0x2d, 0xbb,
+  0xd8, 0xd0, 0xee, 0x98, 0x06, 0xd7, 0x23, 0x27, 0x73, 0x03, 0x0b, 0x0b,
+  0x35, 0xcd, 0x9a, 0xd5, 0xc5, 0x9c, 0x0e, 0xc5, 0x1a, 0x44, 0x26, 0x2b,
+  0xbe, 0xe3, 0xb1, 0xa6, 0xc7, 0x86, 0xb8, 0xea, 0x2f, 0xd6, 0xd3, 0xb3,
+  0xb2, 0x72, 0xb3, 0x15, 0x99, 0x12, 0x49, 0x02, 0x38, 0xdc, 0x76, 0xbe,
+  0x98, 0x06, 0x22, 0x86, 0xb9, 0xfb, 0xf2, 0xa5, 0x8a, 0x8a, 0x11, 0xea,
+  0x90, 0xb8, 0x5e, 0x18, 0x28, 0x54, 0xf2, 0x59, 0xe2, 0xd1, 0xeb, 0x15,
+  0xcb, 0xdd, 0x6d, 0x6b, 0xad, 0x87, 0xfa, 0x06, 0xbe, 0x3a, 0xbd, 0x2d,
+  0xe1, 0xa2, 0x72, 0x39, 0x26, 0xd4, 0xd7, 0xe7, 0xef, 0x38, 0xea, 0x18,
+  0x1a, 0xde, 0xf8, 0xc4, 0x72, 0x95, 0xbd, 0xa3, 0x7a, 0xe8, 0x5a, 0x42,
+  0x6c, 0x0b, 0x42, 0xd9, 0x18, 0x12, 0x03, 0x41, 0xff, 0x8b, 0xe2, 0x15,
+  0x03, 0xe7, 0xac, 0x73, 0x98, 0x60, 0x67, 0xc2, 0x42, 0xf3, 0x65, 0xc0,
+  0x58, 0x77, 0xee, 0x73, 0xa5, 0x10, 0xf5, 0x2f, 0x90, 0xd8, 0xac, 0x30,
+  0xa7, 0x31, 0xfe, 0xc7, 0x93, 0x94, 0xb0, 0x40, 0x69, 0xa5, 0x57, 0x9c,
+  0x5e, 0x73, 0x07, 0xa6, 0x42, 0x96, 0xa5, 0x58, 0xa7, 0x67, 0x94, 0x0e,
+  0xa1, 0xd9, 0x7d, 0xcd, 0xb4, 0x1b, 0xb6, 0x70, 0x2b, 0x01, 0xfe, 0x49,
+  0x51, 0xba, 0xe0, 0x75, 0x19, 0xcf, 0x22, 0x8f, 0x16, 0x10, 0x6f, 0x76,
+  0xc9, 0x9d, 0x8d, 0x49, 0xaf, 0x13, 0x65, 0x11, 0xa9, 0xbb, 0xe0, 0x99,
+  0xbf, 0xd0, 0x34, 0x8c, 0x41, 0x4a, 0xd3, 0x5a, 0x91, 0x43, 0xbd, 0x7e,
+  0x93, 0x09, 0x3f, 0xd4, 0x1a, 0xdc, 0x47, 0xbb, 0x3a, 0xaa, 0x4a, 0x6e,
+  0x5c, 0x23, 0x6e, 0x9f, 0xa2, 0x39, 0x5e, 0x0b, 0xee, 0x9b, 0x3e, 0x2e,
+  0x60, 0xd8, 0x10, 0xaf, 0xde, 0x9b, 0x3f, 0x21, 0x88, 0x22, 0xb7, 0x33,
+  0x02, 0x77, 0x8e, 0x25, 0xb0, 0xbb, 0xcd, 0xf7, 0x3a, 0x95, 0xc3, 0xc9,
+  0xc3, 0x74, 0x9e, 0x2c, 0x6b, 0x79, 0x5f, 0x36, 0x88, 0xba, 0x20, 0x40,
+  0x28, 0x19, 0xd6, 0x6a, 0x59, 0x12, 0x49, 0x46, 0x5a, 0xbc, 0x1b, 0x2d,
+  0x06, 0x92, 0x7a, 0x93, 0x7c, 0xf9, 0x1a, 0xac, 0x56, 0x36, 0xe3, 0xc0,
+  0x75, 0xbc, 0x98, 0x14, 0x40, 0x78, 0x31, 0xdb, 0xdf, 0x75, 0x2e, 0x98,
+  0x8f, 0x80, 0x75, 0x8a, 0xef, 0xce, 0xcd, 0x91, 0x53, 0x5e, 0xe2, 0x89,
+  0xdf, 0x5d, 0x27, 0xdc, 0x07, 0xa1, 0xdd, 0x29, 0x9e, 0x03, 0x76, 0x33,
+  0xa2, 0xb9, 0xaf, 0xc0, 0x59, 0xbf, 0x27, 0x5c, 0x5a, 0x06, 0x79, 0xf2,
+  0x74, 0xce, 0x12, 0xc3, 0xcc, 0x1f, 0xa4, 0x69, 0x4b, 0x92, 0x8f, 0x2a,
+  0xf5, 0x87, 0x72, 0xb7, 0xe9, 0xff, 0x21, 0x9d, 0x8f, 0x13, 0x3a, 0xf5,
+  0xd0, 0xb7, 0x34, 0xe8, 0xfc, 0x18, 0x09, 0xb2, 0x76, 0xc2, 0x36, 0xe5,
+  0xba, 0xb4, 0x6f, 0xe3, 0xc5, 0xa4, 0x35, 0xf6, 0xfd, 0xc8, 0xea, 0x23,
+  0x95, 0xcc, 0x20, 0x0c, 0x6a, 0xe7, 0x49, 0x38, 0xf3, 0xcb, 0x15, 0xf7,
+  0x3b, 0x35, 0x77, 0x9b, 0xe2, 0x97, 0x2c, 0xea, 0x07, 0x1a, 0x61, 0xe9,
+  0x2c, 0x29, 0xa3, 0xa1, 0x48, 0xad, 0xfd, 0x0c, 0x2a, 0x5f, 0x66, 0xa6,
+  0x48, 0x50, 0x7d, 0x2f, 0x91, 0xec, 0x59, 0x64, 0x74, 0xb7, 0x1a, 0xbd,
+  0x25, 0xc7, 0xd3, 0x9c, 0x69, 0x34, 0x8d, 0x1b, 0xe7, 0x6c, 0xd4, 0x6f,
+  0x1c, 0x0b, 0xb5, 0xfd, 0x34, 0x3e, 0x50, 0xb9, 0x28, 0x6d, 0xca, 0xcc,
+  0xfa, 0xea, 0x6a, 0xd8, 0xaf, 0x9b, 0x93, 0xa2, 0xb0, 0x05, 0xc8, 0xe6,
+  0xe8, 0x46, 0x85, 0x01, 0x52, 0xbd, 0xcb, 0xd0, 0x99, 0xc4, 0x9a, 0x01,
+  0x27, 0x2c, 0xaa, 0xea, 0x06, 0xb5, 0x2c, 0x5a, 0x70, 0x61, 0xd3, 0x39,
+  0x53, 0x3c, 0x08, 0xf6, 0x23, 0xaa, 0x8a, 0xfc, 0x16, 0x2e, 0xd1, 0x8d,
+  0x03, 0x1a, 0x8f, 0xf4, 0x6c, 0xf1, 0x39, 0x1a, 0x30, 0x44, 0xb1, 0x2a,
+  0x76, 0x1f, 0x66, 0x13, 0x7f, 0x9d, 0xdc, 0x5d, 0x6d, 0x82, 0x63, 0x6c,
+  0x4a, 0x0b, 0x96, 0xce, 0x6d, 0x0c, 0x10, 0x12, 0x02, 0xf1, 0x79, 0x77,
+  0xa9, 0x64, 0x90, 0x4d, 0xce, 0x7f, 0xce, 0x11, 0x55, 0xec, 0xf8, 0xed,
+  0xd0, 0x74, 0x91, 0xf4, 0xf6, 0x6b, 0x9e, 0x5e, 0xf9, 0xee, 0x60, 0xa0,
+  0x20, 0x2c, 0xb5, 0xb7, 0x57, 0x75, 0x9b, 0x77, 0xe8, 0x2b, 0xe9, 0x09,
+  0xf5, 0xf2, 0x4b, 0x7f, 0x27, 0xa4, 0x4b, 0xc1, 0x1d, 0xa0, 0x7a, 0x39,
+  0x6d, 0xe8, 0xe6, 0x9a, 0x8a, 0x3c, 0xa2, 0x1c, 0x07, 0x23, 0x5d, 0x47,
+  0xb5, 0xc7, 0x24, 0x4b, 0x8e, 0xf1, 0xcb, 0x53, 0x21, 0x24, 0xc0, 0x1c,
+  0xc1, 0x29, 0xe6, 0xd5, 0x71, 0xbe, 0xe5, 0x3d, 0x19, 0xb2, 0x7f, 0x8d,
+  0xd7, 0x20, 0x48, 0x68, 0x3e, 0x2c, 0x9b, 0xcd, 0x44, 0x50, 0x39, 0xb3,
+  0x23, 0xf7, 0x2d, 0xce, 0x2e, 0x33, 0xe3, 0xf5, 0xb5, 0xe7, 0x16, 0x9d,
+  0xff, 0x53, 0x9c, 0x61, 0x3a, 0x55, 0xf5, 0xef, 0x1b, 0x0d, 0xcc, 0xfa,
+  0x43, 0xf1, 0xcb, 0x3e, 0xed, 0xa2, 0x34, 0xbc, 0xe8, 0xc4, 0x3f, 0x3e,
+  0xf1, 0x72, 0xcd, 0xb9, 0x34, 0xa5, 0x1b, 0x0e, 0x0b, 0xe4, 0xee, 0xa6,
+  0xd7, 0xc0, 0x51, 0x84, 0x23, 0xb4, 0x38, 0x4f, 0xea, 0xf6, 0x6a, 0xe6,
+  0x39, 0xfc, 0xbe, 0xc3, 0x47, 0x4f, 0xaf, 0x84, 0x89, 0x0a, 0x4a, 0x21,
+  0xeb, 0x6e, 0x96, 0x64, 0xb3, 0x29, 0x31, 0x53, 0x50, 0xa6, 0xe4, 0x62,
+  0x05, 0x1f, 0xe3, 0x28, 0x1e, 0x3f, 0x67, 0x8c, 0x83, 0xad, 0x91, 0x05,
+  0x30, 0x67, 0x34, 0x37, 0x29, 0x60, 0xdd, 0x53, 0x90, 0x4e, 0xf0, 0xf4,
+  0x48, 0x49, 0x6f, 0xc0, 0xd7, 0x38, 0x75, 0x7f, 0x76, 0x3e, 0x99, 0x43,
+  0x3f, 0x9a, 0x0a, 0xbb, 0x58, 0xfd, 0x27, 0xaf, 0x6c, 0x9b, 0xcc, 0xc2,
+  0x7b, 0x96, 0x63, 0xf5, 0x9a, 0x13, 0x93, 0xb8, 0x2b, 0xa5, 0x8f, 0xf1,
+  0x59, 0x7a, 0x06, 0xb2, 0x27, 0x37, 0x78, 0x33, 0x40, 0x29, 0x85, 0xb9,
+  0xda, 0x52, 0xc7, 0x93, 0x18, 0x80, 0x93, 0x35, 0xa1, 0x40, 0x12, 0x5a,
+  0x6f, 0x43, 0x65, 0x0b, 0xab, 0xc7, 0xee, 0xee, 0x6a, 0xb4, 0xd0, 0xcc,
+  0xe6, 0xbf, 0x64, 0xa5, 0x05, 0x95, 0xdb, 0x9d, 0xd1, 0x88, 0xc0, 0xb8,
+  0xdb, 0xc7, 0x0b, 0xc9, 0xb6, 0xe0, 0xc3, 0xf9, 0x2d, 0x0a, 0xe0, 0xbb,
+  0x56, 0xbe, 0x81, 0x5d, 0x26, 0x28, 0x04, 0xb0, 0x18, 0x2c, 0x96, 0x9f,
+  0xed, 0x8c, 0x33, 0x99, 0xec, 0x7d, 0x39, 0x03, 0x46, 0x61, 0x0d, 0x11,
+  0x13, 0x1a, 0xe9, 0xc1, 0x93, 0xb8, 0x87, 0x8a, 0xec, 0x7f, 0x10, 0xf6,
+  0x94, 0x22, 0xa6, 0xf2, 0xa9, 0xd1, 0xa1, 0x77, 0xe0, 0x8d, 0x62, 0xa3,
+  0xc7, 0x63, 0x36, 0xef, 0x8c, 0xc7, 0x36, 0x34, 0xbf, 0x4f, 0x4f, 0x2a,
+  0x8f, 0x43, 0xb4, 0x42, 0x63, 0x9e, 0x4f, 0x29, 0x28, 0xbe, 0x20, 0xee,
+  0x72, 0xb8, 0x19, 0x45, 0xf0, 0x78, 0x45, 0x99, 0x8b, 0xe4, 0x76, 0x1b,
+  0xb1, 0x49, 0x20, 0xa2, 0x60, 0x96, 0xdc, 0x03, 0x29, 0x03, 0xd0, 0x33,
+  0xbc, 0xb1, 0x12, 0x45, 0x4d, 0xba, 0xc9, 0xbf, 0x04, 0x01, 0x53, 0x8b,
+  0xc8, 0x90, 0x7b, 0x2d, 0x61, 0xc0, 0xb2, 0xb0, 0xd2, 0xe8, 0x09, 0xff,
+  0x74, 0xf2, 0x1f, 0x7a, 0xc4, 0x21, 0x80, 0x49, 0x0b, 0xee, 0x76, 0x5f,
+  0x28, 0xff, 0x62, 0x23, 0x5a, 0x5f, 0xd9, 0xa6, 0x63, 0xf5, 0x13, 0x17,
+  0x7a, 0xb9, 0x0b, 0x1d, 0xf7, 0x33, 0xc1, 0x02, 0xe2, 0x87, 0x09, 0xec,
+  0xe5, 0x2e, 0x3b, 0x95, 0x18, 0x40, 0xb6, 0x91, 0x03, 0xcd, 0xca, 0xb0,
+  0x9d, 0x43, 0x07, 0xc2, 0x72, 0xb9, 0x9b, 0x53, 0x9c, 0x87, 0x97, 0x5a,
+  0xea, 0x36, 0xf8, 0x62, 0xae, 0xf4, 0xb1, 0x9f, 0x24, 0x97, 0xe9, 0x1f,
+  0x6a, 0xac, 0xba, 0x28, 0x6f, 0xb1, 0x29, 0x3b, 0xf1, 0x2f, 0xb8, 0xc6,
+  0xcf, 0x0e, 0x5f, 0x45, 0xde, 0x23, 0xd3, 0x50, 0xc6, 0x36, 0xe5, 0xa6,
+  0x86, 0x7c, 0x94, 0xab, 0x2d, 0xc6, 0x35, 0x1a, 0x06, 0xdd, 0xc8, 0x02,
+  0x82, 0xae, 0x55, 0x78, 0x7a, 0xf6, 0xa7, 0xed, 0xfd, 0x51, 0xb8, 0x47,
+  0x8e, 0x8d, 0x98, 0xc0, 0x2c, 0xc6, 0x65, 0x00, 0x37, 0xbe, 0x8d, 0x6d,
+  0xaf, 0x21, 0x90, 0xc1, 0x64, 0x3f, 0x7d, 0x52, 0xd2, 0x22, 0xf3, 0x29,
+  0x7e, 0x71, 0x3e, 0xba, 0x29, 0x7e, 0xde, 0x7c, 0x58, 0x0c, 0xcc, 0xff,
+  0x4a, 0xec, 0x0c, 0x4c, 0xf6, 0x3e, 0xb4, 0x8d, 0xe4, 0xe3, 0xf0, 0x4b,
+  0x95, 0x2b, 0x63, 0x57, 0xdd, 0x9e, 0x9a, 0x41, 0xcc, 0x31, 0x50, 0xbe,
+  0x7c, 0xbf, 0x3b, 0xa7, 0xbf, 0x0e, 0x87, 0xd1, 0xc2, 0x72, 0x14, 0x37,
+  0xf5, 0x8b, 0x3d, 0xea, 0x7b, 0xb7, 0xd7, 0x66, 0x6f, 0xca, 0x67, 0xfd,
+  0x86, 0x13, 0xef, 0x5a, 0xd3, 0x4a, 0x17, 0x8d, 0x78, 0xa7, 0x4e, 0x78,
+  0x26, 0xc4, 0x11, 0xc3, 0x28, 0x36, 0x5f, 0xb9, 0x7d, 0xf4, 0x6a, 0x40,
+  0x8c, 0x68, 0xc0, 0x46, 0x3e, 0xca, 0xe9, 0xa9, 0xc0, 0xd4, 0xbf, 0x81,
+  0xdd, 0xe3, 0xf7, 0x50, 0x2d, 0x61, 0x02, 0x41, 0x59, 0xbe, 0xe3, 0xa7,
+  0xbe, 0xef, 0xdf, 0x5d, 0x38, 0x93, 0x0a, 0xf7, 0xae, 0x19, 0x0f, 0xf7,
+  0x12, 0x20, 0x51, 0x18, 0x49, 0x2e, 0xa2, 0xfb, 0x99, 0xcd, 0x6f, 0x56,
+  0x65, 0x62, 0xa0, 0x3f, 0x16, 0xa7, 0xab, 0x43, 0x2b, 0xbc, 0x6e, 0x51,
+  0x2c, 0x34, 0xcd, 0x38, 0xf8, 0x02, 0x60, 0x77, 0xd5, 0xe6, 0x27, 0x72,
+  0x0a, 0x87, 0xbf, 0xbd, 0xe7, 0xef, 0xa5, 0x40, 0xac, 0xa7, 0x46, 0x79,
+  0x5f, 0x1a, 0x34, 0x0c, 0x09, 0xe7, 0x57, 0x47, 0xc2, 0x63, 0xd4, 0xbe,
+  0x2c, 0x35, 0x62, 0x91, 0x81, 0x62, 0xac, 0x6b, 0xa2, 0x9e, 0x93, 0x92,
+  0xf1, 0x0f, 0x8d, 0x9e, 0x20, 0x10, 0x53, 0xaf, 0xac, 0x07, 0xd3, 0x83,
+  0x6c, 0xf0, 0x1f, 0x93, 0xdc, 0x11, 0xf1, 0x34, 0x1d, 0x73, 0x2a, 0xc7,
+  0x16, 0x71, 0x21, 0x2e, 0xb2, 0x80, 0xf1, 0x51, 0x55, 0xe1, 0xb7, 0xc2,
+  0xde, 0x20, 0xc2, 0x77, 0xbc, 0xdf, 0x19, 0x1f, 0x90, 0x95, 0x26, 0x48,
+  0x92, 0x1d, 0xbb, 0x85, 0x7f, 0x33, 0x24, 0xd7, 0xcd, 0x3a, 0xe0, 0x7e,
+  0x3d, 0x7e, 0x05, 0x37, 0x3d, 0x36, 0xde, 0x98, 0x46, 0x9e, 0x8c, 0x6b,
+  0x22, 0x70, 0xce, 0x82, 0xaf, 0x37, 0xd3, 0x9d, 0xd0, 0xf8, 0x70, 0x1c,
+  0xe8, 0x34, 0x36, 0x87, 0x5a, 0x41, 0xf9, 0x5f, 0xf6, 0x76, 0x3f, 0x59,
+  0x8a, 0xc7, 0xae, 0x4b, 0x93, 0x43, 0x5d, 0x16, 0x74, 0xed, 0x94, 0x14,
+  0x5d, 0xec, 0x90, 0xbb, 0x7c, 0x50, 0xc1, 0x12, 0x88, 0x0b, 0x6d, 0x93,
+  0x26, 0xb4, 0xe1, 0x6e, 0xe6, 0x43, 0x12, 0x92, 0xc5, 0x64, 0xa1, 0x9f,
+  0x4a, 0xdf, 0xa3, 0xd3, 0x2f, 0x7a, 0x66, 0x06, 0xf8, 0xc4, 0x4c, 0x3f,
+  0x08, 0xc8, 0x3a, 0x8d, 0xf8, 0x14, 0xcf, 0xa6, 0xf9, 0x26, 0x1f, 0x8b,
+  0x33, 0x9f, 0x0a, 0x0c, 0xf0, 0xaf, 0xf4, 0xe9, 0x7d, 0x6d, 0x94, 0xa9,
+  0x65, 0xbe, 0x35, 0xd0, 0x4d, 0x6b, 0xfc, 0xe0, 0x8f, 0xdf, 0x89, 0xaa,
+  0x37, 0xf9, 0x60, 0x93, 0x7a, 0x61, 0xfd, 0x87, 0x6d, 0x7c, 0x2e, 0x56,
+  0x68, 0xb7, 0x97, 0x64, 0x64, 0x7e, 0x82, 0x31, 0xeb, 0xf4, 0x31, 0x92,
+  0xa4, 0xb6, 0x2e, 0xd0, 0x08, 0xed, 0x3c, 0x1c, 0xee, 0x0f, 0x2d, 0xdc,
+  0x5e, 0xbc, 0xff, 0x22, 0x73, 0x12, 0x10, 0xad, 0x63, 0x86, 0x7f, 0x19,
+  0xab, 0x0c, 0x92, 0x28, 0x68, 0xdd, 0x56, 0x4a, 0xaa, 0xf6, 0x2e, 0x1e,
+  0x73, 0xcf, 0x9e, 0x9d, 0xda, 0xfe, 0x2f, 0xb6, 0x03, 0x94, 0x4f, 0xbe,
+  0xcd, 0x5b, 0xd6, 0xea, 0xfe, 0x6a, 0x7b, 0x3c, 0x4f, 0x5f, 0xde, 0xc4,
+  0x2a, 0x73, 0xb8, 0xb4, 0xba, 0x87, 0xaa, 0xa7, 0x7a, 0x27, 0x4e, 0x0e,
+  0x47, 0xca, 0xe2, 0x49, 0x88, 0x3b, 0x8d, 0x87, 0xb9, 0x24, 0x82, 0x64,
+  0x10, 0x1a, 0x7d, 0xdb, 0x8f, 0x14, 0x72, 0xac, 0x7f, 0xcf, 0x70, 0x68,
+  0x55, 0x1f, 0x7b, 0x74, 0xcc, 0x18, 0xd5, 0x13, 0x06, 0x67, 0xc3, 0x62,
+  0x39, 0xf4, 0x59, 0xb4, 0xa3, 0x4c, 0x97, 0xa6, 0x6e, 0x8e, 0x99, 0x74,
+  0x78, 0x80, 0x6a, 0x93, 0x9c, 0x8a, 0xce, 0x44, 0xba, 0x14, 0xfc, 0x8b,
+  0xf3, 0x13, 0x7b, 0xb1, 0xc8, 0x4d, 0x90, 0x28, 0x39, 0xb2, 0x33, 0x7c,
+  0xe8, 0x48, 0x6d, 0x92, 0xa8, 0xac, 0xd4, 0x41, 0xd2, 0x12, 0xeb, 0xb7,
+  0x87, 0x60, 0x43, 0x55, 0x29, 0xdc, 0xb0, 0x44, 0xa7, 0x96, 0xde, 0x26,
+  0xec, 0xed, 0xe0, 0xf2, 0x9e, 0xff, 0x5e, 0x24, 0x29, 0x4d, 0xbd, 0xed,
+  0xf7, 0xea, 0xd1, 0xe2, 0x96, 0x81, 0x27, 0x6e, 0x8f, 0x0c, 0xa1, 0x95,
+  0xa0, 0xe1, 0x93, 0xa6, 0x8a, 0x62, 0xa9, 0x7d, 0x3a, 0xd4, 0x4e, 0x24,
+  0xc2, 0x53, 0xc0, 0x88, 0x0a, 0xbf, 0xbd, 0x9a, 0x4b, 0xfb, 0xee, 0xe2,
+  0xde, 0x02, 0xbb, 0xa9, 0x24, 0x8b, 0x28, 0x72, 0xc9, 0xe9, 0x60, 0xd7,
+  0xa5, 0x23, 0x24, 0x4f, 0x08, 0xae, 0x80, 0x7a, 0x1a, 0x31, 0xc2, 0x7f,
+  0xb9, 0xa9, 0x01, 0x17, 0x81, 0x65, 0xd0, 0xd0, 0x83, 0xad, 0xc4, 0x2c,
+  0x11, 0x74, 0x6b, 0x62, 0x53, 0x63, 0x8b, 0x9a, 0x92, 0xe3, 0xe5, 0x95,
+  0xb9, 0x41, 0xda, 0xf9, 0xca, 0x83, 0x24, 0xea, 0x18, 0x91, 0xab, 0x0d,
+  0x92, 0xfc, 0xeb, 0x84, 0x4d, 0xbf, 0x82, 0x82, 0x8b, 0x68, 0xff, 0x0d,
+  0x6f, 0x3a, 0xd7, 0x4e, 0x81, 0x6b, 0x4d, 0x7b, 0xd7, 0xbb, 0x21, 0x53,
+  0x81, 0x34, 0xa8, 0xf6, 0x6e, 0x80, 0x31, 0x55, 0x79, 0xd8, 0x3c, 0xbe,
+  0x2c, 0xa8, 0x69, 0xc3, 0xa0, 0xdb, 0x39, 0x80, 0xc5, 0x68, 0xc9, 0x9b,
+  0x16, 0xd3, 0xcd, 0x8e, 0x21, 0x11, 0xf6, 0x5a, 0x03, 0x70, 0xaa, 0x18,
+  0xaf, 0xec, 0x33, 0x0c, 0xae, 0xb4, 0x03, 0x55, 0xca, 0x50, 0xbe, 0x18,
+  0xf6, 0xe9, 0xaa, 0xf5, 0x22, 0x4a, 0x87, 0x90, 0x23, 0x29, 0x8b, 0xff,
+  0xf7, 0x75, 0x3e, 0x4b, 0xe3, 0x92, 0x91, 0x95, 0x80, 0x70, 0x73, 0x02,
+  0xc1, 0x44, 0x78, 0x87, 0x73, 0x33, 0x42, 0x27, 0xa6, 0xce, 0xe9, 0x59,
+  0x9a, 0xb5, 0x4d, 0xc6, 0xa1, 0x5c, 0x7d, 0x6e, 0xea, 0x08, 0x6e, 0x74,
+  0x01, 0xe2, 0xf2, 0x95, 0x1c, 0x56, 0x6c, 0xd4, 0x5a, 0xee, 0x49, 0xbd,
+  0x07, 0x6b, 0x95, 0xca, 0x84, 0xda, 0x67, 0xe2, 0xf1, 0x88, 0xd0, 0x15,
+  0xe3, 0x02, 0xb2, 0x73, 0x48, 0x88, 0xa1, 0x1d, 0x11, 0xa7, 0x73, 0x38,
+  0xe2, 0x19, 0x48, 0x44, 0x66, 0x28, 0x9c, 0x6a, 0xd6, 0x7c, 0xc8, 0xf9,
+  0xc0, 0x02, 0x61, 0xae, 0xa3, 0x23, 0xc8, 0xc2, 0xf3, 0x78, 0x92, 0xfa,
+  0xf2, 0x72, 0x01, 0x7d, 0xd3, 0xc6, 0xd5, 0xa8, 0xfc, 0xc9, 0xbd, 0xf3,
+  0xf2, 0x84, 0xa9, 0xdf, 0x11, 0xe2, 0x14, 0x99, 0x8f, 0x6c, 0x3a, 0x5f,
+  0x72, 0x5d, 0x65, 0xee, 0xa3, 0x18, 0xd0, 0xa8, 0x3a, 0x95, 0xf0, 0x20,
+  0xa8, 0xd1, 0x18, 0xbb, 0x52, 0x76, 0x28, 0xba, 0x67, 0x0c, 0xc0, 0x56,
+  0x30, 0xd2, 0x8c, 0x3a, 0x45, 0xe5, 0x33, 0x06, 0x22, 0x98, 0x47, 0xd9,
+  0xdc, 0x1b, 0xb2, 0x26, 0xbd, 0xb6, 0x7a, 0x2f, 0x3c, 0xb3, 0xbe, 0x4e,
+  0xb8, 0x3b, 0xf7, 0x4b, 0xd7, 0xdd, 0x50, 0x21, 0x30, 0xea, 0xcd, 0x10,
+  0x4b, 0xc6, 0xb6, 0x7e, 0xd2, 0xad, 0x81, 0x6c, 0x21, 0x7f, 0x99, 0x30,
+  0x31, 0x0f, 0x97, 0xc3, 0x8f, 0x22, 0xc1, 0xf2, 0xdf, 0x12, 0xfa, 0x00,
+  0x09, 0x5a, 0x4e, 0x52, 0xe9, 0xca, 0xf1, 0x9c, 0x94, 0x3b, 0x52, 0xec,
+  0xcd, 0x68, 0xb2, 0xbc, 0x05, 0x6d, 0x97, 0x03, 0x25, 0x59, 0xdb, 0xe9,
+  0x1e, 0xbc, 0x16, 0x82, 0xbf, 0x38, 0xfc, 0xe7, 0xe7, 0x99, 0x06, 0xcc,
+  0x7d, 0x44, 0x06, 0x0b, 0xec, 0xc4, 0xc3, 0x28, 0x9f, 0xdb, 0x84, 0x41,
+  0x47, 0xb5, 0xec, 0xf9, 0x17, 0x4e, 0xee, 0xc4, 0x1c, 0x8d, 0x1a, 0x48,
+  0x94, 0x58, 0x88, 0x7d, 0x26, 0xaf, 0x4b, 0xb0, 0xf1, 0x08, 0xbf, 0xaa,
+  0x84, 0x8e, 0x2f, 0x8e, 0x4f, 0xc7, 0xe4, 0x64, 0x7c, 0x74, 0xed, 0x2b,
+  0x91, 0x16, 0xe2, 0x67, 0xa8, 0x7d, 0x78, 0x7f, 0xe5, 0x4d, 0xa3, 0xea,
+  0xe8, 0x47, 0x51, 0x9f, 0x19, 0xb4, 0xc6, 0xfc, 0x8c, 0xaa, 0x04, 0xe6,
+  0xc6, 0xf0, 0x5e, 0x7d, 0x1e, 0xff, 0x2a, 0xfa, 0x61, 0x04, 0x75, 0xf9,
+  0x6d, 0x18, 0x9f, 0x00, 0xc8, 0x95, 0xab, 0x76, 0x9d, 0xf3, 0x38, 0x3b,
+  0x82, 0xf8, 0x39, 0xed, 0x9d, 0x7a, 0xc7, 0x95, 0x48, 0xc2, 0xb1, 0xba,
+  0x19, 0x36, 0x04, 0x13, 0x6e, 0xd3, 0xa0, 0x9c, 0x0a, 0x28, 0xd0, 0x14,
+  0x70, 0xaa, 0x46, 0x68, 0xb8, 0xe7, 0xb1, 0x69, 0x45, 0xb2, 0xfd, 0x9c,
+  0xb5, 0x26, 0x8f, 0xeb, 0x04, 0x2a, 0x21, 0x9a, 0xd9, 0xf0, 0x2c, 0x9b,
+  0xcb, 0x4d, 0x8c, 0xad, 0x6f, 0xe6, 0xb3, 0xa1, 0x8a, 0x33, 0xcf, 0xff,
+  0xc5, 0xf7, 0x7f, 0xd3, 0x31, 0xcc, 0x24, 0xfb, 0x2d, 0x55, 0xee, 0x6b,
+  0xaa, 0x66, 0x24, 0xdb, 0xea, 0x82, 0x16, 0x76, 0x14, 0x9f, 0x0c, 0x3b,
+  0xf6, 0xd9, 0x25, 0x32, 0xee, 0x91, 0xfa, 0x07, 0xa8, 0xbe, 0x24, 0x6f,
+  0x7e, 0x93, 0xba, 0x5c, 0xa6, 0x26, 0x29, 0x51, 0x51, 0x1f, 0x16, 0x4c,
+  0x4b, 0xeb, 0xdb, 0x8e, 0x73, 0x71, 0xdd, 0x32, 0x95, 0x03, 0x00, 0x15,
+  0x73, 0x65, 0x6e, 0xfb, 0xf4, 0x22, 0x77, 0x3d, 0x41, 0x28, 0xf0, 0x72,
+  0xd2, 0x86, 0x20, 0xa9, 0x98, 0xbd, 0x68, 0xb4, 0x86, 0x61, 0xb9, 0x1a,
+  0xc6, 0x57, 0x81, 0xbc, 0x53, 0x5f, 0x30, 0xd8, 0x56, 0x32, 0xeb, 0xdd,
+  0x9e, 0x98, 0xfd, 0xe2, 0x1e, 0xb4, 0x45, 0x9a, 0x4f, 0x7a, 0x04, 0x4c,
+  0x80, 0x9a, 0x1f, 0xaf, 0xb6, 0x67, 0x54, 0x99, 0xda, 0xed, 0x7a, 0xa1,
+  0xe2, 0xbe, 0xea, 0x9b, 0x42, 0x98, 0xa5, 0xe4, 0xf3, 0x5c, 0x61, 0x12,
+  0xfa, 0x65, 0xa1, 0xfe, 0xd5, 0x3e, 0xd4, 0x2f, 0x27, 0xa7, 0x3a, 0xee,
+  0x0e, 0xe9, 0x6e, 0xec, 0x7d, 0x9d, 0xaa, 0x13, 0x87, 0x1e, 0xa4, 0x17,
+  0x3b, 0x06, 0x23, 0xf2, 0x4e, 0x2c, 0x73, 0x70, 0x1a, 0x4a, 0x43, 0x06,
+  0xf6, 0x3d, 0x43, 0xe2, 0x15, 0xf8, 0x3a, 0x59, 0x8b, 0xa9, 0xe0, 0x97,
+  0x89, 0x53, 0x6b, 0x9f, 0xd5, 0xb6, 0x07, 0x47, 0x2f, 0x9c, 0xa7, 0x0b,
+  0x00, 0x93, 0x6f, 0x88, 0x62, 0xaa, 0x3d, 0x3a, 0xc0, 0xe6, 0x59, 0xe8,
+  0x73, 0x1c, 0xa9, 0x5f, 0xac, 0x14, 0xaa, 0xe7, 0x5d, 0x99, 0x5d, 0x13,
+  0x0f, 0x0a, 0x50, 0x12, 0x6b, 0x19, 0xbe, 0x85, 0x0e, 0x17, 0x9b, 0xa1,
+  0x10, 0x61, 0x98, 0x66, 0x41, 0xea, 0xca, 0xed, 0x07, 0x23, 0x7a, 0x60,
+  0xb0, 0xc6, 0x55, 0x4f, 0x3a, 0x58, 0xa2, 0x3d, 0xb7, 0x04, 0x54, 0xb4,
+  0x56, 0x2a, 0x43, 0x25, 0xf6, 0x0b, 0x1b, 0xcb, 0x3c, 0xb4, 0xa3, 0xaa,
+  0x76, 0xa4, 0x9a, 0x89, 0x8c, 0x79, 0xf6, 0xb8, 0x9b, 0xf1, 0x2e, 0xfa,
+  0xf1, 0xb3, 0x87, 0x11, 0xba, 0xe9, 0xfb, 0x0a, 0x2f, 0x45, 0x37, 0x94,
+  0x36, 0x9f, 0x24, 0xd9, 0x14, 0x99, 0x26, 0x91, 0x8b, 0x76, 0x1b, 0x1d,
+  0x2a, 0xed, 0x7c, 0xa7, 0xe1, 0x8b, 0x68, 0x3f, 0x93, 0x17, 0xbf, 0xe2,
+  0x5a, 0x41, 0x73, 0x7e, 0xdf, 0x3c, 0xc1, 0x66, 0x56, 0x31, 0xa9, 0x6a,
+  0xca, 0xeb, 0x21, 0x82, 0xcc, 0x7a, 0xc1, 0xea, 0x2c, 0x6e, 0x9d, 0xee,
+  0x0c, 0xcd, 0xdb, 0x5b, 0x09, 0x54, 0xf9, 0x4d, 0x43, 0x19, 0xd1, 0xd6,
+  0x8e, 0x35, 0x06, 0x1c, 0x6a, 0xfe, 0x5c, 0x30, 0x46, 0xb7, 0xf0, 0xce,
+  0xa3, 0xd1, 0xb5, 0x4f, 0x84, 0x79, 0xea, 0x57, 0x6c, 0x60, 0x71, 0xbf,
+  0x77, 0xb8, 0xd5, 0xea, 0x19, 0x2a, 0xea, 0x8d, 0x15, 0x14, 0xd4, 0x54,
+  0x92, 0x5a, 0x57, 0x58, 0x3d, 0x84, 0xd1, 0x50, 0x56, 0xee, 0xdf, 0x8a,
+  0x80, 0x45, 0xb6, 0x7a, 0xbb, 0xb5, 0xcd, 0x4b, 0xac, 0xea, 0x13, 0x17,
+  0x6a, 0x1d, 0xb5, 0xac, 0x4c, 0xd8, 0x7c, 0xd8, 0xd6, 0x05, 0x35, 0x2f,
+  0x6a, 0x13, 0xc1, 0x68, 0x2a, 0x8f, 0x63, 0x03, 0x8b, 0x2f, 0x00, 0xda,
+  0xac, 0xe5, 0xc3, 0x3b, 0x15, 0x08, 0x90, 0xb4, 0x16, 0xe5, 0x26, 0x98,
+  0x8f, 0xc9, 0x9d, 0x58, 0xcf, 0x84, 0x7c, 0x69, 0x8f, 0xb8, 0xbe, 0x4c,
+  0xb9, 0xbd, 0x59, 0xf3, 0x4d, 0xc3, 0x64, 0x4d, 0x93, 0x9d, 0x5f, 0x97,
+  0xae, 0xe9, 0xf3, 0xe7, 0xdc, 0x6c, 0xd3, 0x33, 0x43, 0x28, 0x02, 0xa9,
+  0x1d, 0xae, 0xf3, 0xfe, 0x66, 0xef, 0x88, 0x41, 0x10, 0xb6, 0x19, 0x14,
+  0x9d, 0x26, 0x3c, 0x90, 0x2e, 0x07, 0xfa, 0x16, 0x9d, 0x1f, 0x01, 0x47,
+  0xd2, 0xa8, 0x77, 0x70, 0x2d, 0x64, 0x63, 0xdf, 0x05, 0x0e, 0x46, 0x0c,
+  0x2e, 0xe8, 0x99, 0xd0, 0x45, 0x66, 0x58, 0x6d, 0x72, 0x5c, 0xe3, 0xfd,
+  0x4a, 0x71, 0x1e, 0x9a, 0xdc, 0x0a, 0xcf, 0xea, 0x03, 0x53, 0xc1, 0x51,
+  0x67, 0x82, 0x20, 0x7f, 0x6d, 0xcd, 0xbb, 0x82, 0x65, 0xb4, 0x4f, 0xd3,
+  0x4a, 0x3c, 0x95, 0xa3, 0x08, 0x2d, 0x12, 0x65, 0x55, 0xf9, 0x0e, 0xcd,
+  0x47, 0xf9, 0x7f, 0x41, 0xcf, 0x1b, 0xd8, 0x6b, 0x90, 0x19, 0xff, 0xb7,
+  0x01, 0x80, 0xca, 0x64, 0x25, 0x5f, 0xad, 0x67, 0x4e, 0xf6, 0x87, 0xfa,
+  0x23, 0x0e, 0x20, 0x6e, 0x7c, 0x1b, 0x51, 0xee, 0x94, 0xcd, 0xda, 0x53,
+  0x4a, 0x58, 0x2d, 0xd0, 0x7a, 0x03, 0x00, 0x56, 0x98, 0xc5, 0x57, 0x04,
+  0x27, 0x49, 0x1c, 0x2c, 0x10, 0x19, 0xe0, 0x09, 0x0e, 0xc8, 0x08, 0xdb,
+  0x64, 0x62, 0xa8, 0xf6, 0xa1, 0x8b, 0x83, 0x5d, 0x58, 0x9d, 0x3c, 0x12,
+  0xb9, 0xd8, 0xbd, 0x61, 0xa6, 0xc1, 0x36, 0xd5, 0xc3, 0x7f, 0xd0, 0xc8,
+  0x03, 0xb9, 0x5e, 0xc2, 0x79, 0xd4, 0x2c, 0x20, 0xa0, 0xde, 0x8a, 0x18,
+  0x7d, 0x7e, 0xa5, 0x6d, 0xb9, 0x8b, 0xaa, 0x45, 0xff, 0x5a, 0x66, 0xe7,
+  0x1e, 0x12, 0xe5, 0x55, 0x96, 0x41, 0xfc, 0x5a, 0xa1, 0xe8, 0xb4, 0x83,
+  0x15, 0x00, 0xb2, 0xd7, 0xe7, 0x7d, 0xb4, 0x68, 0x90, 0xbd, 0x00, 0xa0,
+  0x2d, 0x2d, 0x74, 0x2a, 0xd5, 0x2f, 0xee, 0xa4, 0x09, 0xa6, 0xd2, 0x76,
+  0x42, 0x67, 0x7f, 0x14, 0x44, 0x41, 0x47, 0xc6, 0x0f, 0x44, 0x36, 0x6e,
+  0x6f, 0x6d, 0x8b, 0x13, 0xae, 0x3a, 0xfa, 0x91, 0xef, 0x7d, 0xd4, 0xde,
+  0x18, 0x3a, 0xbe, 0xc2, 0xa3, 0x8c, 0x43, 0xa8, 0xde, 0x60, 0xb6, 0x24,
+  0x1f, 0x57, 0x7c, 0x44, 0xc4, 0x83, 0xc7, 0x14, 0xeb, 0x79, 0xe5, 0x71,
+  0x21, 0xe8, 0x56, 0x62, 0x8f, 0xc5, 0x56, 0xe9, 0x5b, 0xe9, 0xb8, 0x32,
+  0x54, 0xa3, 0xac, 0x28, 0x53, 0x59, 0xb8, 0xfe, 0x17, 0xe9, 0x53, 0x0b,
+  0xa8, 0x4c, 0x29, 0xb8, 0x5e, 0x95, 0x14, 0xf3, 0xe7, 0x40, 0x74, 0x6c,
+  0xd3, 0xb5, 0xc0, 0xd6, 0x3a, 0x48, 0xd9, 0x3c, 0x54, 0x91, 0x52, 0xa1,
+  0x76, 0xdf, 0x9f, 0xee, 0x3b, 0x6d, 0xad, 0x89, 0x0e, 0x2d, 0x63, 0x3a,
+  0x39, 0x2d, 0x16, 0x84, 0x10, 0x3d, 0xbc, 0xe1, 0xbe, 0x9b, 0x41, 0x61,
+  0xe7, 0x7d, 0x72, 0xb3, 0x7c, 0x56, 0xe9, 0x65, 0xd5, 0xb2, 0xc3, 0x56,
+  0xa5, 0xcb, 0xf5, 0x94, 0x92, 0x2f, 0x19, 0x77, 0x48, 0x22, 0x43, 0x8b,
+  0x5d, 0x92, 0x91, 0x13, 0x42, 0xc5, 0x76, 0x8c, 0x6a, 0x94, 0x53, 0x91,
+  0x1d, 0xfb, 0xab, 0x39, 0x90, 0x91, 0x56, 0xea, 0xe0, 0x66, 0xcf, 0xfd,
+  0x32, 0x21, 0x2a, 0x02, 0x62, 0xe9, 0x6b, 0xde, 0x22, 0xf7, 0x01, 0x55,
+  0xef, 0x8b, 0x9f, 0x91, 0xc9, 0x6c, 0x21, 0xe8, 0x7f, 0x54, 0x13, 0x86,
+  0xf3, 0x31, 0x86, 0x5b, 0x31, 0x2d, 0x58, 0x0c, 0x6f, 0xd8, 0x5d, 0xca,
+  0x48, 0x5a, 0xa7, 0x1f, 0x2b, 0xaf, 0xec, 0x51, 0x86, 0x88, 0xb4, 0x99,
+  0xaf, 0x73, 0x0c, 0x5b, 0x2b, 0x11, 0x86, 0xb9, 0x8b, 0x4c, 0xe0, 0x94,
+  0x71, 0x18, 0xc2, 0xc0, 0x46, 0x8d, 0xe1, 0x72, 0xa9, 0x96, 0x8b, 0x6f,
+  0x2b, 0xf4, 0x58, 0x55, 0xca, 0xbe, 0xee, 0xc9, 0x97, 0x4b, 0x16, 0xc9,
+  0xa1, 0x12, 0xe6, 0xc5, 0xc8, 0x7e, 0x0f, 0xaf, 0xd9, 0xc2, 0x29, 0x3a,
+  0x45, 0xe5, 0x2d, 0x97, 0x7e, 0x87, 0xf6, 0xd2, 0xf5, 0xaa, 0xa8, 0x06,
+  0x4a, 0x2d, 0xe5, 0x95, 0xd8, 0x72, 0x78, 0xe4, 0x73, 0x91, 0xe2, 0x71,
+  0x37, 0xef, 0x37, 0x57, 0xd3, 0x70, 0x83, 0xc9, 0x12, 0x89, 0xbf, 0xcc,
+  0xbb, 0x28, 0x8d, 0xa7, 0xd2, 0x23, 0xa0, 0x56, 0xdb, 0x17, 0x3f, 0xce,
+  0xb5, 0x85, 0x6e, 0x30, 0x00, 0x58, 0xe3, 0xd1, 0x59, 0xee, 0x10, 0x5e,
+  0x01, 0x91, 0x60, 0x47, 0xcb, 0xeb, 0xdd, 0x88, 0x96, 0xbe, 0x65, 0x31,
+  0x14, 0x23, 0x89, 0xdf, 0x92, 0xea, 0x63, 0x4e, 0xce, 0xcd, 0x91, 0xdb,
+  0xab, 0xdf, 0x0f, 0xa0, 0xd2, 0xe8, 0xf4, 0x66, 0xb5, 0xd4, 0x01, 0xaf,
+  0xc4, 0x39, 0x7d, 0x54, 0x08, 0x5f, 0xf2, 0xe0, 0xd1, 0xfb, 0x4f, 0xb0,
+  0x9d, 0x91, 0xf9, 0x2f, 0x13, 0x65, 0x3e, 0xde, 0x4a, 0x07, 0xfa, 0xee,
+  0x27, 0xe0, 0x5a, 0xfa, 0x1c, 0x54, 0x40, 0xde, 0x1e, 0xc1, 0xb4, 0x35,
+  0x74, 0xe4, 0x63, 0xd1, 0x96, 0x5a, 0x52, 0x74, 0xd3, 0x60, 0x48, 0x74,
+  0x43, 0xc6, 0xe2, 0xda, 0xbe, 0x6f, 0xc7, 0xfe, 0xf8, 0xde, 0x71, 0x9c,
+  0x7c, 0x3f, 0xb3, 0x05, 0xe3, 0x8f, 0x85, 0xa4, 0xa6, 0xa0, 0xda, 0x0b,
+  0x75, 0xca, 0xb4, 0x97, 0x7d, 0x18, 0x1b, 0x11, 0x16, 0x00, 0xe6, 0x51,
+  0x4d, 0xb2, 0x24, 0xd2, 0xea, 0xc0, 0x06, 0x97, 0x69, 0x85, 0x17, 0x80,
+  0x85, 0xab, 0xcf, 0x94, 0x87, 0xe0, 0x5e, 0xd2, 0x03, 0x85, 0x21, 0x41,
+  0xc3, 0x99, 0xee, 0x35, 0x8c, 0xcf, 0x69, 0xcc, 0xeb, 0xaa, 0x10, 0x39,
+  0x4e, 0x48, 0xcc, 0xcd, 0x54, 0xd8, 0x96, 0x20, 0x94, 0x9b, 0x90, 0xde,
+  0xdf, 0xc2, 0xc8, 0x2e, 0x87, 0x3a, 0xf4, 0x97, 0xa8, 0x9c, 0x2d, 0x51,
+  0x4b, 0xd7, 0x9f, 0x8c, 0x11, 0x55, 0x5f, 0xdf, 0xd7, 0xfa, 0xfa, 0xbf,
+  0xda, 0x94, 0x58, 0xa8, 0xe6, 0xcb, 0x9b, 0x6d, 0x46, 0xf0, 0x15, 0xe9,
+  0xfa, 0xb0, 0x82, 0xf6, 0x8f, 0x3f, 0xe0, 0xab, 0xa4, 0xc4, 0x45, 0x01,
+  0x5b, 0x7e, 0x38, 0xf5, 0xba, 0x40, 0xdd, 0x85, 0x0f, 0xbf, 0xf3, 0xd0,
+  0x49, 0x7a, 0xa2, 0x15, 0xff, 0x5e, 0x8e, 0x60, 0x6c, 0xfb, 0xe1, 0x6c,
+  0x4f, 0xd2, 0xf5, 0xab, 0xce, 0xf9, 0x4d, 0xc4, 0x21, 0x8d, 0x52, 0xc5,
+  0xbb, 0xc3, 0xea, 0x58, 0xa4, 0x46, 0x5c, 0xf8, 0xe4, 0x4f, 0x56, 0x8b,
+  0xdb, 0x22, 0x20, 0xfe, 0x29, 0xac, 0x58, 0xf0, 0xde, 0xb7, 0x03, 0x83,
+  0xbe, 0xbe, 0x17, 0x8b, 0xeb, 0xd4, 0xc8, 0x5b, 0x1d, 0x77, 0x1d, 0xc2,
+  0x5c, 0xb5, 0x09, 0x70, 0x1c, 0x60, 0x6c, 0x65, 0x38, 0xe9, 0xbe, 0xa8,
+  0x9a, 0x7d, 0x62, 0x4a, 0x4b, 0x58, 0x73, 0x81, 0x37, 0x90, 0xfe, 0xf8,
+  0xf4, 0x78, 0xc9, 0xad, 0xe9, 0x66, 0xb6, 0x18, 0x49, 0xca, 0x43, 0x85,
+  0x26, 0x04, 0x2e, 0x1c, 0x55, 0xba, 0xb9, 0x2d, 0xe2, 0x66, 0x5b, 0x50,
+  0xaf, 0x8f, 0xa3, 0xb7, 0x07, 0xa2, 0xea, 0xf3, 0xbc, 0xc8, 0xb5, 0xdc,
+  0xbf, 0x1f, 0x2b, 0x57, 0xe8, 0xe0, 0x33, 0x9f, 0x53, 0x06, 0x55, 0xc9,
+  0xca, 0xb5, 0x66, 0xa2, 0x3b, 0x83, 0xf2, 0xa4, 0xb1, 0x39, 0xc4, 0x5a,
+  0xf7, 0xe2, 0x13, 0x74, 0x3a, 0xb3, 0xad, 0xb9, 0x12, 0xab, 0xbd, 0x03,
+  0xca, 0x1e, 0x1b, 0x24, 0x80, 0x51, 0x13, 0xff, 0x68, 0xb2, 0x21, 0xa5,
+  0x55, 0x03, 0x13, 0x3f, 0xcd, 0x65, 0x4d, 0x95, 0xa1, 0x17, 0x3f, 0x29,
+  0x0c, 0xc8, 0x30, 0x71, 0x9d, 0xdb, 0x87, 0xc1, 0x60, 0x8b, 0x47, 0x11,
+  0xf0, 0x67, 0x39, 0x23, 0xe3, 0x0e, 0x3b, 0xea, 0xfb, 0x33, 0xe8, 0x99,
+  0x36, 0x72, 0x32, 0xf5, 0xf4, 0xf6, 0x67, 0xb5, 0x4a, 0x00, 0x4f, 0x60,
+  0x2b, 0x80, 0xc4, 0x7f, 0x44, 0xd7, 0x42, 0x2b, 0x16, 0x20, 0x2c, 0x91,
+  0x8a, 0x5d, 0x9e, 0xd2, 0xdb, 0x20, 0x70, 0xd4, 0x4b, 0x8a, 0x0e, 0xa0,
+  0xb3, 0x13, 0x4b, 0x3d, 0x4f, 0x67, 0xf5, 0x3a, 0x7e, 0xb0, 0x06, 0x79,
+  0x26, 0x0a, 0xf5, 0xc2, 0xa6, 0xaf, 0x00, 0x4c, 0x0d, 0x87, 0xb9, 0x2e,
+  0xe2, 0xa5, 0xc7, 0x63, 0xbc, 0xf3, 0x16, 0x9f, 0x07, 0x78, 0x0b, 0xa2,
+  0x1c, 0x79, 0xca, 0x8a, 0xaf, 0xe2, 0x4d, 0x5a, 0x91, 0x67, 0xfe, 0x6b,
+  0x9f, 0xe5, 0x3a, 0xbb, 0x73, 0x18, 0xe0, 0x5a, 0xf7, 0x9b, 0xf7, 0xb9,
+  0xf9, 0x63, 0xa5, 0x10, 0x6f, 0x77, 0x6f, 0x6b, 0x90, 0xc0, 0xc2, 0x16,
+  0xf5, 0x3e, 0x77, 0xce, 0x10, 0x3c, 0xf2, 0x49, 0x18, 0x65, 0x0f, 0xb6,
+  0x82, 0x35, 0x65, 0xbd, 0xc5, 0xa9, 0xa6, 0x0c, 0xf9, 0x69, 0xd4, 0x76,
+  0xb5, 0x78, 0x50, 0xf1, 0xf7, 0x38, 0x9b, 0x45, 0x3e, 0x5d, 0x32, 0xd3,
+  0x70, 0x6a, 0x43, 0x0c, 0x80, 0xe4, 0x15, 0xf3, 0xa8, 0x40, 0x1b, 0x5d,
+  0x9d, 0xe0, 0x18, 0xe4, 0xb8, 0xbc, 0x13, 0x08, 0xe6, 0x66, 0x5c, 0xaa,
+  0x21, 0xd0, 0x29, 0xe5, 0x25, 0x8e, 0x05, 0x87, 0xd4, 0xb8, 0x3e, 0x28,
+  0x64, 0xff, 0x15, 0x19, 0xd9, 0xb3, 0x0a, 0x32, 0xac, 0xec, 0x1a, 0x98,
+  0x8a, 0xcf, 0xc2, 0x30, 0xdf, 0x15, 0x0f, 0x42, 0xd1, 0xd5, 0x42, 0xd6,
+  0x60, 0xd9, 0x9c, 0x0e, 0x0f, 0xb3, 0x58, 0xe4, 0x4d, 0x7b, 0x01, 0x28,
+  0xbc, 0x27, 0xcd, 0xb1, 0xd8, 0x1b, 0xa9, 0xb1, 0xa0, 0xf7, 0xdc, 0x90,
+  0x6a, 0xce, 0x5e, 0x02, 0xf4, 0x54, 0x6a, 0xb4, 0x7e, 0xb2, 0x6a, 0xd8,
+  0x98, 0x94, 0xd9, 0x2a, 0x36, 0x6f, 0x90, 0x47, 0xd6, 0xdd, 0xbb, 0xd3,
+  0xb2, 0xd0, 0xe6, 0x83, 0xa8, 0xab, 0x51, 0xcf, 0x66, 0x70, 0xad, 0xe3,
+  0xbe, 0x42, 0xa3, 0x69, 0x51, 0xef, 0x48, 0xc1, 0x99, 0xb2, 0x56, 0xd8,
+  0x0a, 0x2a, 0xd5, 0x7a, 0x4f, 0x6e, 0xf1, 0xdc, 0x58, 0x25, 0x31, 0xfe,
+  0xfd, 0xba, 0x9f, 0xd4, 0x4c, 0x9c, 0xb7, 0x84, 0xaf, 0xf0, 0x66, 0xb4,
+  0x30, 0x16, 0x4c, 0xdb, 0x46, 0x5f, 0xc5, 0xc4, 0x0f, 0xb6, 0xe1, 0x10,
+  0xfb, 0xc6, 0xe5, 0x4b, 0x2d, 0xae, 0x86, 0xa3, 0xb2, 0x1c, 0xf2, 0x32,
+  0x12, 0xd7, 0x96, 0x8a, 0xef, 0xd7, 0x5e, 0x18, 0xf9, 0x5f, 0xa0, 0xb9,
+  0x96, 0xb0, 0xc7, 0x14, 0x56, 0x07, 0xdb, 0x30, 0x63, 0xe0, 0xb0, 0x99,
+  0xc1, 0x07, 0xaa, 0xfb, 0x35, 0xb4, 0x16, 0x53, 0x9d, 0xf7, 0x5e, 0x9f,
+  0x4a, 0x62, 0x67, 0x3b, 0x52, 0x00, 0xce, 0xf3, 0xd9, 0x91, 0xf6, 0x11,
+  0x9e, 0x78, 0x7a, 0xf7, 0x99, 0x2a, 0x08, 0xb6, 0x9f, 0x87, 0x95, 0xdc,
+  0xc8, 0xe5, 0x25, 0x03, 0x11, 0xdd, 0x0c, 0xdc, 0xc4, 0xca, 0x9d, 0x88,
+  0x38, 0xf1, 0x89, 0x22, 0xfc, 0x25, 0x66, 0x96, 0xbe, 0x3e, 0x8d, 0x7b,
+  0x97, 0x0f, 0x97, 0x73, 0x16, 0x49, 0xf2, 0x6c, 0x51, 0xde, 0x3f, 0x69,
+  0x29, 0x05, 0x1a, 0xd7, 0xba, 0xce, 0x58, 0x39, 0x63, 0xa5, 0x7d, 0xac,
+  0x5c, 0x6d, 0x58, 0x23, 0xc6, 0x84, 0xc7, 0x4c, 0x8b, 0x58, 0xf5, 0x32,
+  0xc0, 0xdf, 0xa6, 0x11, 0xb2, 0x21, 0x20, 0xb3, 0xec, 0x38, 0x81, 0x12,
+  0x88, 0xcd, 0x87, 0x2e, 0x3d, 0x76, 0xeb, 0x2e, 0x59, 0xf7, 0xe9, 0x04,
+  0xf0, 0x52, 0xa5, 0xf2, 0x74, 0xb6, 0x67, 0xea, 0x3e, 0x34, 0x53, 0xe4,
+  0xce, 0x16, 0xc2, 0x4f, 0x14, 0x25, 0x86, 0x5b, 0x5b, 0xe8, 0xcc, 0x3c,
+  0x4f, 0x36, 0x5a, 0x2f, 0xb0, 0xc5, 0xfb, 0xac, 0x3e, 0xfa, 0x17, 0xb1,
+  0xe3, 0x58, 0x50, 0xe1, 0xa2, 0xf9, 0x3d, 0x79, 0x1a, 0xd3, 0x65, 0x07,
+  0xa2, 0x3d, 0x8b, 0x8c, 0xa1, 0x8e, 0x14, 0x41, 0x63, 0xc3, 0xa5, 0xd7,
+  0x3b, 0x79, 0x57, 0x41, 0x32, 0x68, 0xc9, 0x44, 0x34, 0x7f, 0x0a, 0x2a,
+  0x43, 0x29, 0x83, 0xd3, 0xee, 0x56, 0xee, 0xce, 0x48, 0x55, 0x38, 0x2c,
+  0xf8, 0x55, 0x86, 0x14, 0x26, 0xdf, 0xe6, 0xe9, 0x8b, 0x92, 0xf0, 0x02,
+  0x56, 0x25, 0x5c, 0x3d, 0x0c, 0xd6, 0x69, 0x2c, 0x33, 0x25, 0x8c, 0x4c,
+  0x63, 0x46, 0xa3, 0x7a, 0x1a, 0xec, 0x11, 0x44, 0x0e, 0x14, 0x88, 0xb9,
+  0x4c, 0x84, 0x10, 0xc6, 0xe4, 0x7f, 0xab, 0x42, 0xbb, 0xe4, 0x65, 0xd3,
+  0xe0, 0xba, 0x5b, 0x65, 0x95, 0xbb, 0x35, 0xd8, 0x7a, 0x5b, 0x13, 0x10,
+  0x6f, 0x73, 0xbc, 0x12, 0xce, 0x40, 0xb0, 0xb9, 0x66, 0xc4, 0xaa, 0x4e,
+  0x26, 0x04, 0xcf, 0x83, 0x0a, 0xe3, 0xad, 0xe2, 0x38, 0x1c, 0x02, 0xfd,
+  0x5e, 0x5e, 0x6d, 0x63, 0xba, 0x85, 0x4d, 0x48, 0x17, 0x1c, 0xdd, 0x79,
+  0x74, 0x82, 0x25, 0x2a, 0x64, 0xd3, 0x36, 0x31, 0x9f, 0xa9, 0x12, 0x4c,
+  0x74, 0x7c, 0x44, 0x64, 0x6e, 0x7d, 0x89, 0xfd, 0xcc, 0x55, 0x56, 0xd2,
+  0x98, 0xdd, 0x41, 0x59, 0xc2, 0xb5, 0x01, 0x8c, 0x4c, 0xb2, 0x42, 0x9f,
+  0x53, 0xc4, 0xc1, 0xeb, 0x03, 0xfa, 0xa8, 0x93, 0x58, 0x69, 0xfe, 0xfd,
+  0xa5, 0xf5, 0x30, 0x59, 0xae, 0x4d, 0x53, 0xae, 0x58, 0x6f, 0xa4, 0x46,
+  0xba, 0x8e, 0xb7, 0xef, 0x57, 0x78, 0x1f, 0xe8, 0x55, 0x17, 0x50, 0xea,
+  0x09, 0xae, 0xba, 0x72, 0x02, 0x7e, 0x9f, 0x0c, 0x30, 0x50, 0x0b, 0x1f,
+  0x6c, 0x20, 0x4e, 0x03, 0xd4, 0x59, 0x0c, 0x13, 0xf6, 0x90, 0x85, 0xd8,
+  0x89, 0xe8, 0x43, 0xfa, 0xce, 0xc3, 0xc6, 0x5b, 0xfc, 0x66, 0xe1, 0xef,
+  0x0b, 0x02, 0xa0, 0x65, 0x0e, 0xaa, 0x73, 0xa8, 0xaa, 0x3b, 0xf2, 0x1e,
+  0x59, 0x38, 0xc7, 0x5e, 0x71, 0x7e, 0xf4, 0xb4, 0x18, 0xbb, 0x8e, 0x6d,
+  0x2b, 0x89, 0xed, 0x90, 0x4a, 0x11, 0xff, 0x09, 0x02, 0xd6, 0x37, 0x25,
+  0x2d, 0x39, 0xd3, 0xc1, 0x40, 0x11, 0xd2, 0x0d, 0x8d, 0xfe, 0x5f, 0xf8,
+  0x4b, 0x85, 0xfc, 0xc0, 0x7c, 0xea, 0x9e, 0x38, 0xd9, 0x56, 0xdd, 0x4e,
+  0xef, 0x26, 0x68, 0xb6, 0x1c, 0xdc, 0x9e, 0x88, 0xf2, 0x29, 0x37, 0xab,
+  0xb4, 0xe9, 0x8b, 0x18, 0x7d, 0x33, 0x6d, 0x68, 0x95, 0xd3, 0x59, 0x25,
+  0xfb, 0xed, 0x63, 0x8e, 0x85, 0x04, 0x8b, 0xfa, 0x19, 0x2d, 0xfd, 0x8a,
+  0xc3, 0x53, 0x98, 0xa1, 0x16, 0xe1, 0xb5, 0x7b, 0xe2, 0xa3, 0x5d, 0x10,
+  0xf4, 0x0f, 0x8a, 0xca, 0x6d, 0x7c, 0x9e, 0xae, 0xd0, 0xdc, 0x53, 0xf3,
+  0x18, 0x8c, 0xb6, 0x66, 0xf4, 0x85, 0x53, 0xba, 0xdb, 0x11, 0xe3, 0xa9,
+  0x95, 0xf9, 0x36, 0xc0, 0xec, 0x79, 0x12, 0x41, 0x2f, 0x0f, 0xb8, 0xd1,
+  0x2a, 0x7e, 0xca, 0x5e, 0x6c, 0x72, 0x6d, 0xf8, 0x2d, 0xa9, 0x80, 0x63,
+  0xc9, 0x81, 0x14, 0xe9, 0x71, 0x0e, 0x15, 0xfa, 0x28, 0x21, 0x61, 0xd7,
+  0x23, 0xb8, 0x41, 0x8a, 0x34, 0x7a, 0xfb, 0xef, 0x1a, 0xaa, 0x9f, 0x40,
+  0x5b, 0x53, 0x44, 0x8a, 0x68, 0xfd, 0x0f, 0x95, 0x32, 0x64, 0xfd, 0xce,
+  0x5f, 0x41, 0xb1, 0x82, 0xe6, 0x71, 0x47, 0x7e, 0xc5, 0x48, 0x06, 0xae,
+  0x51, 0x43, 0x44, 0x38, 0x6f, 0x66, 0x28, 0xd9, 0xf8, 0xb9, 0x89, 0x6c,
+  0x97, 0xbb, 0xb1, 0xd3, 0x27, 0x63, 0x20, 0xed, 0x1e, 0x99, 0x3f, 0x6b,
+  0x9c, 0x54, 0xe1, 0xf5, 0x8c, 0xdb, 0xe7, 0x51, 0x4e, 0xb8, 0x76, 0x64,
+  0xe1, 0x46, 0x9f, 0x98, 0x03, 0x5d, 0xeb, 0x6c, 0xe8, 0x0e, 0x0c, 0x8f,
+  0xa8, 0xe7, 0xbe, 0x78, 0x8b, 0xa2, 0x72, 0xb7, 0x7b, 0xce, 0x0c, 0xdd,
+  0x96, 0xe8, 0x93, 0x69, 0x38, 0x25, 0x8b, 0x08, 0xf0, 0x4d, 0x07, 0xc0,
+  0xc5, 0x44, 0xf3, 0x8d, 0x7c, 0xc1, 0xc2, 0xeb, 0xcf, 0x36, 0x8d, 0xeb,
+  0x20, 0x9d, 0x61, 0x42, 0xb1, 0x68, 0xbe, 0x76, 0x85, 0x98, 0xa2, 0xf4,
+  0x79, 0x92, 0xae, 0x7e, 0xd0, 0xf6, 0x84, 0xc6, 0xdf, 0xdd, 0x35, 0x59,
+  0xa3, 0x24, 0xce, 0xa4, 0xb3, 0x98, 0x1a, 0xeb, 0x60, 0xbb, 0xdc, 0xb1,
+  0x22, 0xd3, 0xa4, 0x13, 0x53, 0x71, 0xa4, 0x24, 0xc0, 0xb7, 0x86, 0x8a,
+  0x72, 0xcb, 0x15, 0xbb, 0x84, 0xf4, 0x63, 0xeb, 0x77, 0x10, 0x5c, 0x1f,
+  0x87, 0xe3, 0x45, 0xc0, 0x49, 0xbd, 0x3f, 0xb5, 0xa0, 0x8d, 0x23, 0x05,
+  0x82, 0x33, 0x43, 0xa9, 0x50, 0x4c, 0xb1, 0x6e, 0xdc, 0xba, 0x5d, 0xbb,
+  0xba, 0x2a, 0x23, 0xfe, 0x87, 0x8b, 0xdc, 0x90, 0x25, 0x64, 0x31, 0xd8,
+  0x02, 0xc6, 0x96, 0x16, 0xa9, 0x42, 0x9f, 0x22, 0x21, 0x6f, 0xb5, 0x29,
+  0x09, 0xdf, 0x71, 0x40, 0x8c, 0x09, 0x0c, 0xa7, 0x15, 0x3d, 0x90, 0x23,
+  0xfc, 0x99, 0x5b, 0x89, 0x24, 0xc4, 0x4d, 0x41, 0x93, 0x7e, 0xd3, 0x39,
+  0xd7, 0xaf, 0x92, 0x9a, 0x6b, 0x23, 0x16, 0x12, 0xea, 0xa7, 0xe6, 0xbf,
+  0x9b, 0x6e, 0x46, 0x6f, 0x2c, 0x6a, 0x7e, 0x7d, 0x56, 0x08, 0xed, 0xf9,
+  0x0c, 0x29, 0xf8, 0x7d, 0x86, 0xfa, 0xa9, 0xa7, 0x84, 0xb7, 0xc6, 0x62,
+  0x6e, 0xf7, 0x59, 0x4a, 0x77, 0x21, 0xa1, 0x87, 0x3f, 0xa1, 0x5f, 0x52,
+  0x51, 0xc4, 0x9a, 0x0e, 0x9d, 0x13, 0xe4, 0x97, 0x24, 0xb6, 0xbb, 0x06,
+  0x99, 0x24, 0x20, 0xc8, 0xbb, 0x2d, 0xcb, 0xed, 0x82, 0x3a, 0x64, 0x86,
+  0x11, 0xd4, 0x7c, 0x4b, 0x54, 0x9f, 0xff, 0xd9, 0xbf, 0x96, 0xa8, 0xae,
+  0x2a, 0x1b, 0x01, 0xeb, 0x75, 0xde, 0x4b, 0x39, 0x1d, 0xb2, 0xec, 0x03,
+  0xb9, 0xea, 0x8c, 0xe8, 0xfc, 0x86, 0x01, 0xe9, 0xfa, 0x7b, 0x71, 0x13,
+  0x2a, 0xf6, 0x8b, 0x59, 0xce, 0x3d, 0xa6, 0x0f, 0xc7, 0xd7, 0xc3, 0xe8,
+  0x3b, 0x05, 0x22, 0xec, 0x8c, 0xa4, 0x23, 0x34, 0xc5, 0x01, 0x37, 0xe1,
+  0x39, 0xf2, 0x72, 0xde, 0xb0, 0xb9, 0x5f, 0xd6, 0xe2, 0x6d, 0x00, 0x51,
+  0xdc, 0xe1, 0xd9, 0x40, 0x1c, 0xd5, 0x32, 0x2e, 0xf1, 0x28, 0xb4, 0x14,
+  0x46, 0x10, 0x90, 0x1c, 0xae, 0x83, 0x06, 0xfe, 0x91, 0x78, 0x78, 0x3c,
+  0x50, 0x0b, 0xf4, 0x60, 0xb3, 0x34, 0xfa, 0x7c, 0x4d, 0x55, 0x20, 0x0c,
+  0xc0, 0x98, 0x2b, 0x2b, 0x25, 0x58, 0xe2, 0xb7, 0xf2, 0xbb, 0x80, 0x4a,
+  0x74, 0x62, 0xff, 0x0a, 0xe3, 0x62, 0x3d, 0xe3, 0x50, 0xc1, 0xdd, 0x58,
+  0x6a, 0x31, 0x81, 0x76, 0xc4, 0xa2, 0xf3, 0xd9, 0x1a, 0xea, 0xc4, 0x43,
+  0x1a, 0x98, 0x5b, 0x26, 0xb3, 0xbe, 0x06, 0xdb, 0xf5, 0x5b, 0x2f, 0x64,
+  0x4f, 0xc4, 0x6b, 0x49, 0x6e, 0x6b, 0x0e, 0x91, 0x79, 0xad, 0x82, 0xad,
+  0x43, 0x93, 0xf8, 0x90, 0x8e, 0x8e, 0x48, 0x30, 0x78, 0x23, 0x1b, 0x55,
+  0x28, 0x4d, 0x3d, 0x0f, 0x87, 0x8a, 0x7c, 0x30, 0x89, 0x40, 0xd4, 0x33,
+  0xcc, 0x11, 0xfa, 0xb0, 0xb1, 0xf3, 0x5f, 0xc5, 0xae, 0xae, 0x6e, 0x44,
+  0xbc, 0xd0, 0x3b, 0x3d, 0x16, 0xf1, 0x17, 0xc1, 0xbc, 0x88, 0xf0, 0x8d,
+  0x1b, 0xdb, 0x38, 0xa8, 0x11, 0xe3, 0xb5, 0xa0, 0x0d, 0x31, 0xab, 0x47,
+  0x86, 0x7b, 0x80, 0xef, 0x47, 0x4f, 0xc0, 0x01, 0x60, 0x34, 0x97, 0x23,
+  0xc2, 0x99, 0x99, 0x13, 0x48, 0xd6, 0xf3, 0x1b, 0x52, 0x62, 0x3d, 0x01,
+  0xed, 0xb0, 0xe2, 0x1a, 0x9d, 0x30, 0xf9, 0x8e, 0x9e, 0xf5, 0xb6, 0x8c,
+  0xa2, 0x1c, 0x4f, 0xec, 0x02, 0xd2, 0x49, 0x2e, 0xc1, 0x84, 0x06, 0xc5,
+  0x7e, 0xf8, 0xdb, 0x08, 0xed, 0xb0, 0x3a, 0x3d, 0x41, 0x97, 0xb9, 0xf8,
+  0xb4, 0x73, 0x5c, 0x7b, 0xba, 0xcb, 0xa8, 0xd2, 0xe8, 0xcc, 0x1f, 0xb4,
+  0x60, 0x54, 0x3a, 0xe5, 0xa3, 0xe8, 0xd4, 0x14, 0x0e, 0x90, 0xe4, 0xa8,
+  0xa2, 0xd1, 0x72, 0xaf, 0xea, 0x70, 0x0e, 0x69, 0xd8, 0xfe, 0x96, 0xd1,
+  0x17, 0x99, 0x86, 0xc9, 0x3a, 0xa1, 0xe5, 0x99, 0xec, 0xc2, 0x7c, 0x74,
+  0x91, 0x53, 0x94, 0x6b, 0x8a, 0x66, 0x50, 0xba, 0x24, 0x79, 0xf8, 0x4f,
+  0x83, 0xe1, 0x33, 0x8e, 0x1d, 0x21, 0x3c, 0x0b, 0xf9, 0x07, 0x7c, 0xd9,
+  0x4e, 0x60, 0x95, 0x6a, 0xb3, 0x54, 0xd3, 0x85, 0xa9, 0xa0, 0xdc, 0xa7,
+  0xb0, 0x87, 0x2e, 0x29, 0x2c, 0x90, 0x14, 0x4c, 0x21, 0xa6, 0x96, 0x86,
+  0xce, 0x8f, 0x2c, 0x34, 0x6f, 0x8c, 0xe8, 0xac, 0xcf, 0x62, 0x20, 0x57,
+  0x66, 0xfc, 0xc7, 0xb3, 0x56, 0xd2, 0x1d, 0x76, 0x4a, 0x85, 0x6d, 0x2b,
+  0xdb, 0x81, 0xfe, 0x9b, 0x8e, 0x73, 0x25, 0x51, 0x2b, 0xd0, 0x16, 0x3f,
+  0x4c, 0xfe, 0xde, 0xa3, 0x9d, 0x90, 0x71, 0xe1, 0x11, 0x8d, 0xcb, 0x9e,
+  0x2c, 0x0c, 0xdf, 0x23, 0x19, 0xed, 0x6e, 0x88, 0x08, 0x5e, 0x15, 0xc3,
+  0xa1, 0x3a, 0x0b, 0x46, 0xec, 0x8b, 0x14, 0x43, 0xff, 0x09, 0x27, 0xf0,
+  0xd2, 0x0b, 0x27, 0x0f, 0x55, 0x72, 0x04, 0xcd, 0x52, 0xef, 0x5e, 0x57,
+  0x21, 0xc2, 0x12, 0x1d, 0x4c, 0xb6, 0x83, 0xa2, 0x0d, 0x2f, 0x70, 0x48,
+  0x7e, 0x18, 0xaf, 0xb8, 0x9c, 0x32, 0xd1, 0xde, 0x96, 0xd5, 0xbc, 0x6e,
+  0xfa, 0x16, 0x26, 0xef, 0x47, 0x2b, 0xcd, 0xd4, 0x39, 0x98, 0xdb, 0xe5,
+  0xf1, 0x43, 0xfb, 0xe3, 0xaf, 0x81, 0xf2, 0xdc, 0x91, 0x87, 0xc5, 0x49,
+  0x19, 0x3a, 0x79, 0x56, 0x46, 0x18, 0xea, 0x87, 0x2f, 0xba, 0x6c, 0xcd,
+  0x2c, 0x10, 0x85, 0x6e, 0xba, 0xa5, 0x62, 0x4b, 0xb6, 0x62, 0x66, 0x1d,
+  0x07, 0xcd, 0x51, 0x93, 0x73, 0x29, 0xf3, 0x12, 0x27, 0x3f, 0xf3, 0xdc,
+  0x74, 0xae, 0xf2, 0x69, 0x3e, 0x80, 0x7b, 0x71, 0x59, 0x12, 0x45, 0xd5,
+  0x4e, 0x22, 0xdd, 0xd9, 0xcc, 0x95, 0x27, 0x18, 0x39, 0x8a, 0x9b, 0xda,
+  0x11, 0x96, 0xef, 0x09, 0x6b, 0x46, 0xb6, 0x99, 0x2a, 0xd2, 0x86, 0x32,
+  0x43, 0x3c, 0x5e, 0x34, 0x0e, 0x83, 0x62, 0x29, 0x57, 0x58, 0x22, 0x58,
+  0xc2, 0xef, 0xf2, 0x61, 0x9b, 0x9b, 0x89, 0xae, 0xe4, 0x35, 0x9e, 0x4a,
+  0x33, 0x15, 0x6c, 0x94, 0xe1, 0xc4, 0xb1, 0x49, 0x87, 0x41, 0x4f, 0xd1,
+  0xe7, 0x5d, 0xf8, 0x5f, 0xa2, 0x9c, 0x0e, 0x1d, 0x64, 0x45, 0xea, 0xca,
+  0x11, 0x55, 0x8f, 0x2c, 0xbe, 0xb4, 0x58, 0x0c, 0x2a, 0xc9, 0x57, 0xb2,
+  0x7f, 0xd4, 0xfd, 0xc7, 0xe2, 0xd2, 0x53, 0xe9, 0x22, 0x9d, 0xf9, 0xef,
+  0x8e, 0x77, 0xdc, 0xcb, 0x86, 0x35, 0xac, 0xac, 0x51, 0x01, 0x55, 0xf4,
+  0xd3, 0xe4, 0xe5, 0xaa, 0x76, 0xb7, 0xd1, 0x3d, 0xfe, 0xa7, 0x73, 0x0d,
+  0x91, 0xa5, 0xcf, 0x90, 0x94, 0x59, 0xe5, 0x67, 0xac, 0x66, 0x9a, 0x56,
+  0x53, 0xe8, 0xf7, 0x78, 0xb9, 0x11, 0x1f, 0x14, 0x7d, 0x59, 0x9d, 0x2f,
+  0x85, 0xbe, 0x73, 0x67, 0xe0, 0x33, 0x0d, 0x1f, 0x4f, 0x32, 0x8a, 0x9d,
+  0xaf, 0xab, 0xd3, 0xd0, 0x9a, 0x11, 0x91, 0x79, 0x60, 0xf2, 0xff, 0x81,
+  0xca, 0x09, 0xe6, 0xbe, 0x2d, 0xd1, 0x33, 0x2d, 0x89, 0xcb, 0x4f, 0x68,
+  0x01, 0xe2, 0x6a, 0xcc, 0x4d, 0xaf, 0x34, 0xe9, 0x0b, 0x59, 0xc5, 0x27,
+  0x70, 0x27, 0x8b, 0xc4, 0x8a, 0x59, 0x42, 0x0c, 0x48, 0x09, 0xb5, 0x32,
+  0xc4, 0xed, 0xd2, 0x3c, 0x42, 0xbf, 0x27, 0xea, 0x80, 0x72, 0xa3, 0xb6,
+  0x0b, 0x2a, 0xcb, 0xc7, 0xbf, 0x36, 0xe9, 0x43, 0x5c, 0xb7, 0xd4, 0xd4,
+  0xf9, 0xc7, 0x20, 0x50, 0xda, 0x7c, 0xab, 0xa5, 0x93, 0x9f, 0x0f, 0x90,
+  0xcd, 0xf2, 0x44, 0xc9, 0x5c, 0x11, 0x6a, 0x56, 0xe4, 0x89, 0xee, 0xc4,
+  0x37, 0xf9, 0x3b, 0x29, 0x46, 0xc7, 0xdb, 0x1e, 0x98, 0xaf, 0xfa, 0x17,
+  0xcd, 0xe5, 0x9b, 0xa9, 0x26, 0x46, 0x52, 0xf0, 0x04, 0xca, 0x63, 0xcb,
+  0xfb, 0x45, 0x53, 0xd7, 0x65, 0x4d, 0xff, 0x18, 0x40, 0xae, 0x5e, 0x27,
+  0x27, 0x2b, 0x0c, 0xc6, 0xe1, 0x9d, 0x94, 0xd4, 0x87, 0x71, 0xec, 0xe0,
+  0xb2, 0xfe, 0xb4, 0x9f, 0xe8, 0x08, 0x7a, 0xe3, 0xb1, 0x64, 0xc9, 0x41,
+  0xc3, 0xf9, 0xe4, 0xf3, 0x89, 0x6b, 0x36, 0x99, 0xd6, 0xd5, 0xb5, 0x9a,
+  0x48, 0xbc, 0x73, 0xcb, 0x7f, 0x21, 0x17, 0x2a, 0xba, 0x6c, 0x6f, 0x17,
+  0x00, 0x3d, 0x2e, 0x29, 0xd1, 0xf2, 0x02, 0xf8, 0xe2, 0x9e, 0x57, 0xc6,
+  0xae, 0xdf, 0x81, 0xe1, 0xbf, 0xe6, 0xd2, 0xeb, 0x55, 0x05, 0x43, 0x9b,
+  0xa5, 0x50, 0xcf, 0x65, 0x3e, 0xb4, 0xaf, 0x3e, 0x71, 0x51, 0x9d, 0xf0,
+  0x6d, 0x7a, 0xe9, 0xb1, 0xed, 0xe9, 0x96, 0x38, 0x69, 0xb7, 0x1a, 0xbd,
+  0xc7, 0xd0, 0x32, 0xb9, 0x1a, 0xdc, 0x24, 0xd4, 0x68, 0xb2, 0xe5, 0x24,
+  0x6c, 0x88, 0x9c, 0xff, 0xc1, 0xd8, 0x0d, 0x99, 0x9c, 0x78, 0x67, 0xf4,
+  0x73, 0xe0, 0xa2, 0x5a, 0xd4, 0xe8, 0x21, 0x40, 0x2e, 0xf7, 0x47, 0x60,
+  0xbf, 0x49, 0xdb, 0x09, 0x65, 0xa2, 0xdc, 0x1b, 0x77, 0xae, 0x13, 0xc5,
+  0x87, 0x02, 0xd8, 0x13, 0x7f, 0x4c, 0xf0, 0x74, 0x6b, 0x1d, 0xca, 0xbd,
+  0x8e, 0x04, 0x3e, 0xda, 0x6e, 0x82, 0xc0, 0xc2, 0xf4, 0xe5, 0xa4, 0x0f,
+  0x31, 0xc1, 0x8a, 0x06, 0x22, 0x26, 0x8a, 0xa8, 0x39, 0x9a, 0x8f, 0xb1,
+  0xc0, 0x1e, 0xbe, 0x4e, 0xc8, 0x53, 0x6d, 0x91, 0x93, 0x30, 0x56, 0x74,
+  0xdd, 0x5e, 0x02, 0x14, 0x4f, 0xb2, 0x6c, 0x29, 0xe7, 0x23, 0xca, 0x82,
+  0x9e, 0x9d, 0x87, 0xff, 0x05, 0x78, 0xf6, 0x8c, 0xb4, 0x72, 0x17, 0x37,
+  0x78, 0x1c, 0x05, 0x96, 0xcb, 0xf9, 0xfa, 0x75, 0xbb, 0xf7, 0xb8, 0x50,
+  0xf3, 0xc8, 0xff, 0xae, 0x1b, 0x3e, 0xbd, 0x66, 0x79, 0xa3, 0xb6, 0xc1,
+  0x48, 0x93, 0xde, 0x95, 0x26, 0xaf, 0x0a, 0xd2, 0xc8, 0x35, 0xdc, 0xfe,
+  0xb2, 0x78, 0x8d, 0xc7, 0x32, 0x79, 0xa6, 0x17, 0xf7, 0x00, 0x66, 0xcc,
+  0xb6, 0x13, 0x62, 0x7a, 0xbc, 0x3f, 0xa6, 0x53, 0xb4, 0xda, 0xd3, 0x1d,
+  0x6d, 0x6d, 0x5f, 0x19, 0x71, 0xe6, 0x2b, 0xa1, 0xe0, 0x27, 0x24, 0xd7,
+  0xa6, 0xda, 0x0c, 0x7f, 0x64, 0xf8, 0x9b, 0xa4, 0x81, 0xbf, 0xe9, 0xd9,
+  0xb8, 0xa8, 0xe6, 0x79, 0xe5, 0x70, 0xb4, 0x1e, 0xfb, 0xa5, 0xa4, 0xc2,
+  0x92, 0xdb, 0xa8, 0xb7, 0x53, 0xc8, 0x8d, 0x39, 0xdb, 0x8a, 0xdf, 0xef,
+  0xfa, 0x71, 0x22, 0x15, 0xcd, 0x8b, 0x9a, 0x86, 0xde, 0x8a, 0x9d, 0xe1,
+  0x7a, 0xed, 0xed, 0xb5, 0x5a, 0x24, 0xf5, 0xed, 0x6f, 0x1c, 0xb7, 0xe1,
+  0xea, 0x82, 0x6f, 0xa4, 0xa3, 0x76, 0x0c, 0x1b, 0x75, 0x94, 0x63, 0x99,
+  0x97, 0x69, 0xdd, 0x32, 0x2d, 0xe3, 0x64, 0xd4, 0xbf, 0x89, 0x6c, 0x2b,
+  0xf3, 0xff, 0x26, 0xcf, 0xd6, 0x7f, 0x30, 0x6a, 0x6a, 0x97, 0xea, 0x08,
+  0xd3, 0x20, 0xc8, 0x2d, 0xdd, 0x29, 0x44, 0x94, 0x95, 0xce, 0x99, 0x1c,
+  0x31, 0xee, 0x94, 0xf3, 0xb5, 0xd1, 0xdf, 0xa5, 0xa8, 0x90, 0x6e, 0x77,
+  0xab, 0xa4, 0xa6, 0x56, 0xd5, 0x46, 0xa6, 0x7c, 0xf6, 0xf6, 0x52, 0x74,
+  0xb9, 0xf2, 0x57, 0x64, 0xc5, 0xf7, 0xa7, 0x63, 0xf7, 0x76, 0xdc, 0xbb,
+  0x41, 0xd9, 0x75, 0x03, 0x8e, 0xc8, 0xfd, 0x34, 0x59, 0x70, 0xb1, 0x82,
+  0xcb, 0x7c, 0x00, 0x52, 0xda, 0x2f, 0x91, 0xeb, 0x30, 0xab, 0x2d, 0xa4,
+  0xa1, 0x74, 0xf6, 0x76, 0x30, 0xe0, 0xcb, 0xff, 0x46, 0x40, 0x8c, 0x39,
+  0x16, 0x7b, 0x93, 0x85, 0x23, 0x1a, 0x08, 0x85, 0x94, 0xd1, 0x45, 0x04,
+  0x5b, 0x32, 0x9c, 0xe4, 0x52, 0x22, 0xa6, 0x69, 0xcf, 0x47, 0x9d, 0xba,
+  0xea, 0x99, 0xf9, 0xa7, 0x8f, 0x76, 0x60, 0xe8, 0xfa, 0xd4, 0xbe, 0x1f,
+  0xe5, 0xf0, 0x5c, 0xeb, 0x65, 0x76, 0x88, 0x1b, 0xdb, 0x9b, 0x8c, 0x19,
+  0x8f, 0xb6, 0x4f, 0xd4, 0x3c, 0xe6, 0x06, 0xb7, 0x18, 0x30, 0xd7, 0xd5,
+  0x0c, 0xc1, 0x08, 0x54, 0x88, 0xe6, 0xc1, 0x7c, 0xab, 0x05, 0x77, 0xcd,
+  0x1a, 0x2f, 0x89, 0xc3, 0x90, 0x43, 0x19, 0x2e, 0xe3, 0xf4, 0x79, 0x90,
+  0xb0, 0x32, 0xff, 0x92, 0x8f, 0x29, 0x57, 0xc8, 0x44, 0x38, 0xd7, 0xbe,
+  0x2d, 0x10, 0xb2, 0x3f, 0x4c, 0x00, 0x35, 0x17, 0xb1, 0xd3, 0x0b, 0x43,
+  0x1e, 0x0e, 0xae, 0xaf, 0x56, 0xb3, 0x7b, 0x14, 0xc5, 0x1a, 0x7c, 0x6e,
+  0x88, 0x1d, 0x73, 0xb0, 0x40, 0xcb, 0x24, 0xea, 0x34, 0x87, 0x76, 0xc7,
+  0x76, 0x20, 0xe1, 0xa0, 0x68, 0xdd, 0xb0, 0x0e, 0xb6, 0x30, 0x1f, 0x7c,
+  0x1a, 0xb2, 0xb1, 0xb6, 0x03, 0x6a, 0xc7, 0x7e, 0x37, 0xff, 0xc3, 0x14,
+  0xc4, 0xc4, 0x1d, 0x40, 0x24, 0x7f, 0x96, 0xd2, 0xa5, 0x93, 0x40, 0x80,
+  0x7a, 0xbc, 0x6f, 0xc2, 0x0c, 0xbc, 0x32, 0x5c, 0xdf, 0xdb, 0x94, 0x29,
+  0xee, 0xf3, 0xad, 0x77, 0xb6, 0xf5, 0xc4, 0x31, 0xb7, 0xa0, 0x0c, 0x5c,
+  0xa9, 0xab, 0xd0, 0xe7, 0x82, 0x94, 0xf2, 0xd3, 0x8a, 0x26, 0xa8, 0xcf,
+  0xb7, 0x39, 0x38, 0xcd, 0xfa, 0xf2, 0xbd, 0x04, 0x22, 0xad, 0x56, 0xc6,
+  0x72, 0xcc, 0xe2, 0xe8, 0xbd, 0xf0, 0xdb, 0xa7, 0x8c, 0x22, 0xbf, 0x25,
+  0x49, 0xff, 0x21, 0x4e, 0x60, 0xfd, 0x89, 0xe8, 0x8e, 0xa7, 0x32, 0xd6,
+  0xf4, 0x71, 0x96, 0x96, 0x01, 0xf9, 0x4f, 0xf2, 0x41, 0x84, 0x9a, 0x6b,
+  0xea, 0xb0, 0x6f, 0x4b, 0xbf, 0x71, 0x3f, 0x73, 0x0f, 0x7e, 0xc8, 0xf6,
+  0x82, 0x45, 0x0b, 0xed, 0x9b, 0xf3, 0x1b, 0xf3, 0x05, 0x47, 0x44, 0x66,
+  0x06, 0x36, 0x34, 0x33, 0x4c, 0xf8, 0xc5, 0x3f, 0x0c, 0x9e, 0x17, 0x90,
+  0xad, 0xcd, 0xc9, 0x92, 0xe8, 0xaf, 0x00, 0xde, 0x5f, 0x74, 0xd5, 0xad,
+  0x90, 0xca, 0x69, 0xb3, 0x1a, 0x19, 0x72, 0x8f, 0x8c, 0xaf, 0xcc, 0xef,
+  0x99, 0x01, 0xa5, 0xea, 0xac, 0x8b, 0xdb, 0xdb, 0xcb, 0x20, 0x1f, 0x52,
+  0x8d, 0xcd, 0xc1, 0x3b, 0x46, 0x2c, 0xc4, 0x17, 0x65, 0x8b, 0x36, 0xbc,
+  0xe9, 0x55, 0x57, 0x53, 0x20, 0xbc, 0xd9, 0xb9, 0x57, 0xac, 0x76, 0x50,
+  0x19, 0xdf, 0x0d, 0xba, 0x68, 0x3e, 0xc8, 0x82, 0x96, 0x07, 0x90, 0xcc,
+  0x05, 0x18, 0x71, 0xe3, 0x8e, 0xdb, 0xe8, 0x16, 0x7b, 0x0f, 0x34, 0xb2,
+  0x26, 0x09, 0x86, 0x41, 0xcb, 0x6b, 0x92, 0xe9, 0xe0, 0x11, 0xb2, 0x0c,
+  0x16, 0xa9, 0x56, 0x70, 0xb3, 0xbf, 0x97, 0x2e, 0xd6, 0x5c, 0xe9, 0x5b,
+  0x13, 0x87, 0x86, 0x8a, 0xd8, 0x24, 0xd4, 0xda, 0xde, 0xf0, 0x8f, 0xbe,
+  0x06, 0x37, 0xe9, 0x65, 0x05, 0xa9, 0xcd, 0x53, 0x95, 0xa6, 0xba, 0x07,
+  0x1e, 0x86, 0x0a, 0xe3, 0x18, 0x92, 0x70, 0xa4, 0xeb, 0xc7, 0xa1, 0x54,
+  0x0b, 0xb9, 0x03, 0x7c, 0xa4, 0x62, 0x13, 0x57, 0x72, 0x0f, 0x69, 0x59,
+  0xda, 0x11, 0x31, 0x68, 0xfa, 0xbd, 0x1e, 0xde, 0x38, 0xd6, 0x5f, 0x7a,
+  0x56, 0xf1, 0x2f, 0x9c, 0xc9, 0x74, 0xe3, 0x10, 0x27, 0xe9, 0x19, 0x5d,
+  0xab, 0xc5, 0x23, 0x29, 0xab, 0x44, 0x39, 0x9e, 0xc6, 0xf2, 0x45, 0xe5,
+  0x91, 0xa3, 0x41, 0xb3, 0x81, 0x46, 0x5b, 0xb4, 0xf4, 0x0f, 0x36, 0x4b,
+  0x75, 0xc9, 0x19, 0x08, 0xd2, 0x4d, 0x32, 0xf5, 0x5e, 0xe4, 0x7f, 0x22,
+  0xde, 0x0b, 0xe4, 0x91, 0xc0, 0x03, 0xcc, 0x96, 0xf7, 0x9a, 0xf9, 0x6b,
+  0x7b, 0xba, 0xb5, 0x0e, 0x0b, 0x92, 0xed, 0x59, 0x79, 0x06, 0xe8, 0xf0,
+  0x4c, 0x15, 0x40, 0x5c, 0xf5, 0xc8, 0x38, 0x2e, 0x42, 0xbb, 0x89, 0x16,
+  0xce, 0x03, 0xff, 0x12, 0xf9, 0xf8, 0xe5, 0xa7, 0xba, 0xbf, 0x88, 0xaa,
+  0x6c, 0xeb, 0x7d, 0xda, 0xd5, 0x51, 0xf3, 0x60, 0x1c, 0x30, 0x7f, 0x57,
+  0x83, 0xb0, 0x7c, 0x11, 0x5d, 0xe5, 0xde, 0x03, 0x4c, 0x92, 0x2c, 0xef,
+  0x93, 0xd8, 0xfa, 0xe7, 0x3e, 0xea, 0xee, 0x7e, 0x32, 0xcc, 0xd2, 0xeb,
+  0x05, 0x0d, 0xe0, 0xa3, 0x42, 0x25, 0x70, 0xbd, 0xc2, 0x27, 0xce, 0x8a,
+  0x60, 0x2c, 0x43, 0x92, 0x70, 0xc9, 0xa0, 0x7b, 0x73, 0x64, 0x09, 0x84,
+  0x2a, 0xaf, 0xf2, 0x76, 0x89, 0xc4, 0x02, 0x21, 0x32, 0x01, 0xf4, 0xb2,
+  0x51, 0xaa, 0x75, 0xec, 0xcb, 0x44, 0x3a, 0x8d, 0xb3, 0x83, 0xe9, 0xe1,
+  0x0f, 0xfd, 0xf7, 0xca, 0xb2, 0xed, 0x61, 0x65, 0x16, 0x1b, 0xa4, 0x32,
+  0xf4, 0x11, 0xf1, 0x56, 0x67, 0x1c, 0x8c, 0x3a, 0xdc, 0xe0, 0xc5, 0xa8,
+  0x7b, 0xbd, 0xc3, 0x1a, 0xe8, 0x57, 0x9f, 0xaa, 0x67, 0x97, 0xf5, 0x3a,
+  0x22, 0x10, 0x32, 0x7b, 0xf9, 0x81, 0xc9, 0xe4, 0xc6, 0x05, 0x60, 0x0b,
+  0xd5, 0xec, 0xd3, 0x6b, 0x2e, 0x9a, 0x47, 0x38, 0xc7, 0x6c, 0x9b, 0xee,
+  0xc9, 0x18, 0xb2, 0xf7, 0x86, 0xc9, 0xc1, 0xb7, 0x42, 0xbd, 0x2c, 0xcb,
+  0xaf, 0x21, 0xeb, 0x14, 0xdf, 0x9c, 0x4b, 0x0c, 0x8a, 0x59, 0x8a, 0x40,
+  0x18, 0x66, 0xb8, 0x33, 0xb1, 0x51, 0xf1, 0xa3, 0x63, 0x31, 0x9d, 0x66,
+  0xaa, 0x2a, 0xdd, 0xdd, 0x61, 0x45, 0xb3, 0x63, 0xfa, 0x42, 0xea, 0x68,
+  0xff, 0x40, 0x5b, 0x4d, 0x78, 0x3c, 0x8a, 0x58, 0x83, 0x0b, 0x56, 0xe5,
+  0xfd, 0x8b, 0xf0, 0x26, 0x29, 0x2c, 0xbe, 0x1b, 0x44, 0x82, 0xcf, 0xc9,
+  0x2d, 0x60, 0x5b, 0x68, 0x31, 0xf0, 0x8e, 0x89, 0x6a, 0x32, 0x03, 0x14,
+  0x81, 0xb9, 0x23, 0xd4, 0xb0, 0x49, 0x8b, 0x2a, 0x9e, 0xdb, 0x17, 0xf8,
+  0xfd, 0x86, 0x8a, 0xfb, 0x7d, 0xdd, 0x2a, 0x89, 0x83, 0xad, 0x5b, 0x63,
+  0x06, 0x90, 0x04, 0xb4, 0x32, 0x08, 0x30, 0xd6, 0x27, 0x25, 0x51, 0x04,
+  0xcb, 0xbd, 0x56, 0x03, 0xcc, 0xd9, 0x02, 0x27, 0x21, 0xa4, 0xe4, 0x12,
+  0xab, 0xbd, 0x2f, 0xb2, 0xbb, 0x29, 0xad, 0x74, 0xd5, 0x16, 0x70, 0xeb,
+  0x2a, 0x67, 0xe5, 0x6c, 0x9e, 0x29, 0x83, 0x4b, 0xec, 0xa8, 0x26, 0x40,
+  0xe6, 0x94, 0xd8, 0x43, 0x44, 0xff, 0x3e, 0x2d, 0x8c, 0xbc, 0xcf, 0x2f,
+  0x1c, 0xa4, 0xd9, 0x6e, 0xd8, 0xb0, 0xe8, 0x7a, 0x86, 0x46, 0x1d, 0x80,
+  0x9d, 0xe7, 0xd5, 0x61, 0xac, 0x32, 0x2f, 0xea, 0xa7, 0xbb, 0xe4, 0xee,
+  0x76, 0x2d, 0xc0, 0x48, 0xe6, 0xc6, 0x88, 0xfa, 0x7b, 0xcb, 0x31, 0xf7,
+  0x5a, 0x3a, 0x36, 0x01, 0x9a, 0x77, 0xd5, 0x31, 0x15, 0xa8, 0x21, 0xd0,
+  0xf2, 0x5d, 0x93, 0xfe, 0x76, 0x30, 0x8b, 0x3f, 0x8e, 0xb3, 0x66, 0x67,
+  0x11, 0x7f, 0x55, 0x53, 0x16, 0xfb, 0x4f, 0x34, 0xcb, 0xfd, 0xe7, 0xb0,
+  0x04, 0x35, 0x21, 0x37, 0x7e, 0x92, 0x1a, 0xbe, 0xd0, 0x4e, 0x8c, 0x0d,
+  0x96, 0x53, 0x3f, 0x04, 0x2b, 0x4a, 0x8e, 0x23, 0x75, 0xa0, 0x50, 0xa6,
+  0xb6, 0x5b, 0xef, 0x46, 0xb9, 0x26, 0xa0, 0x6e, 0x11, 0xf9, 0xa5, 0x80,
+  0xe6, 0x1c, 0xf3, 0x99, 0x38, 0x11, 0xee, 0x4b, 0x08, 0xfb, 0x5e, 0x2f,
+  0x5c, 0xfe, 0x74, 0x0f, 0x66, 0x16, 0x02, 0x9f, 0xbf, 0x8d, 0x0b, 0x4e,
+  0x88, 0x95, 0x1a, 0x36, 0x8c, 0xd7, 0x33, 0x37, 0x13, 0x22, 0x91, 0x69,
+  0x85, 0x0c, 0x80, 0xe0, 0x96, 0x8c, 0x4f, 0x30, 0xa9, 0x02, 0x13, 0x56,
+  0x73, 0x0a, 0x77, 0x91, 0x16, 0xec, 0xdd, 0x6e, 0x82, 0xc2, 0x8b, 0xbf,
+  0x53, 0xb1, 0xb5, 0x4f, 0x56, 0xe2, 0xf8, 0xbd, 0xb9, 0xd2, 0x02, 0x4f,
+  0x9d, 0xc1, 0xf4, 0x17, 0x44, 0xd4, 0x29, 0x95, 0xdf, 0x10, 0x1f, 0x37,
+  0x50, 0x4e, 0x9b, 0xf7, 0x73, 0x23, 0x0b, 0x08, 0xf6, 0x27, 0x21, 0x7e,
+  0x4e, 0xab, 0x57, 0x49, 0x3e, 0xe9, 0xf4, 0x3a, 0x9e, 0xfa, 0x34, 0x6d,
+  0xa2, 0xcc, 0xeb, 0x0f, 0x90, 0x4b, 0xb6, 0x68, 0x28, 0x00, 0xe8, 0x69,
+  0x19, 0x37, 0x86, 0xab, 0xbd, 0xe7, 0xc9, 0x27, 0xe5, 0x12, 0xb2, 0xbf,
+  0x29, 0x6f, 0x91, 0x04, 0x24, 0xca, 0xb8, 0x10, 0x82, 0x53, 0x92, 0x8c,
+  0xe4, 0x42, 0x7c, 0xf1, 0x7d, 0x02, 0x31, 0x95, 0x09, 0xae, 0x1f, 0x52,
+  0x23, 0xa7, 0x49, 0xe3, 0xb3, 0xd1, 0x7c, 0x7f, 0xd4, 0xd2, 0xa4, 0x66,
+  0xbd, 0x83, 0x27, 0x56, 0x4c, 0xa9, 0xe5, 0x6f, 0xf6, 0xe6, 0x1b, 0xac,
+  0xc3, 0x3c, 0xa7, 0x55, 0x93, 0x9b, 0x6a, 0x7f, 0xcf, 0x7b, 0xe5, 0x4c,
+  0x65, 0x5a, 0x59, 0xb7, 0x1a, 0xb9, 0x8c, 0x39, 0x66, 0x2d, 0x96, 0x1e,
+  0xd7, 0xae, 0x79, 0xdc, 0x49, 0xa6, 0x6d, 0xf5, 0x1b, 0x05, 0xd7, 0xe5,
+  0x90, 0xd6, 0x75, 0x12, 0xd5, 0x6a, 0x4f, 0xd3, 0xe0, 0xb3, 0xf6, 0xb7,
+  0x9c, 0x1a, 0xe3, 0xd2, 0x5c, 0x3f, 0x2b, 0xfd, 0xcd, 0x28, 0x3b, 0xc3,
+  0x5e, 0x59, 0x79, 0xdb, 0x5b, 0xb2, 0x03, 0x8f, 0x51, 0xa5, 0x30, 0x9e,
+  0xb6, 0x6a, 0xee, 0x40, 0x0c, 0xd9, 0x6d, 0x85, 0x29, 0xa7, 0xe5, 0xdb,
+  0x09, 0xe0, 0x8b, 0x11, 0x2a, 0xfa, 0xaa, 0x79, 0xbb, 0x31, 0x5b, 0x9d,
+  0x89, 0xd2, 0x06, 0xd4, 0xc3, 0xbb, 0x82, 0x86, 0x68, 0x7f, 0x9a, 0x55,
+  0x8e, 0x16, 0xf6, 0x73, 0xa5, 0xf1, 0xa6, 0x7a, 0xb5, 0xff, 0x46, 0xf3,
+  0x08, 0x0f, 0xf1, 0x25, 0x09, 0xc0, 0x2b, 0x06, 0x0e, 0xc5, 0xb5, 0xc9,
+  0x3f, 0x1c, 0x29, 0xf0, 0xac, 0xe5, 0xd5, 0xc4, 0x12, 0x91, 0x10, 0x31,
+  0xa5, 0x03, 0x4f, 0xe8, 0x5c, 0x12, 0xc8, 0xf3, 0x96, 0x02, 0x63, 0x6d,
+  0x5b, 0x24, 0x53, 0x29, 0x93, 0x71, 0x1b, 0x68, 0x09, 0xb7, 0x37, 0xcb,
+  0xf1, 0xb0, 0x30, 0xa0, 0xc0, 0x16, 0x49, 0xf5, 0x4d, 0xfd, 0xa1, 0xd7,
+  0xe6, 0x51, 0xc7, 0x51, 0xbc, 0xb2, 0xcc, 0x9f, 0xad, 0x3c, 0x7a, 0x61,
+  0x2f, 0x52, 0xd7, 0x02, 0x1e, 0xcf, 0xc8, 0x61, 0x9a, 0xf8, 0xef, 0x0f,
+  0xae, 0xd6, 0xef, 0xed, 0xa0, 0x7a, 0x17, 0x46, 0x30, 0x5f, 0x32, 0x82,
+  0x64, 0xae, 0x61, 0x92, 0x8c, 0x82, 0xa2, 0xfe, 0x1c, 0x7e, 0xf6, 0xe1,
+  0xb3, 0x12, 0xdd, 0x6a, 0xd8, 0x74, 0x74, 0x4a, 0xf5, 0x41, 0x13, 0xe8,
+  0x5d, 0x1f, 0x71, 0x9d, 0x29, 0xb2, 0x4c, 0x39, 0x28, 0xc7, 0xec, 0x2f,
+  0xd3, 0xab, 0x1f, 0x93, 0x44, 0xda, 0xc1, 0xf0, 0x16, 0xcb, 0x83, 0x66,
+  0x60, 0xed, 0x69, 0x3b, 0x06, 0x63, 0xde, 0x87, 0xd2, 0x12, 0xfa, 0x6a,
+  0xe9, 0xcd, 0x3a, 0x80, 0x36, 0x6b, 0x19, 0x4b, 0x4f, 0x3b, 0xfe, 0xb0,
+  0xe4, 0x0d, 0x4e, 0x10, 0x38, 0xa1, 0x16, 0xe1, 0xb8, 0xb5, 0xab, 0x0c,
+  0xeb, 0xe7, 0x9a, 0xb5, 0x4d, 0x22, 0xef, 0x4d, 0xc5, 0x07, 0xbf, 0x71,
+  0x88, 0xe7, 0x91, 0xb0, 0xf2, 0xca, 0xf3, 0x97, 0xdf, 0x4a, 0x2a, 0x11,
+  0xae, 0x82, 0x3d, 0x84, 0x5c, 0x34, 0x5c, 0x83, 0xad, 0xc6, 0x83, 0xea,
+  0xbd, 0xb4, 0x15, 0x02, 0x42, 0xc7, 0xae, 0x48, 0x84, 0xe1, 0xfc, 0x80,
+  0x02, 0x54, 0x30, 0xee, 0xf1, 0xaf, 0x6d, 0x44, 0xac, 0x29, 0x56, 0xa5,
+  0x89, 0x6b, 0x04, 0x2a, 0xdc, 0xa2, 0xdd, 0x53, 0x2c, 0x6e, 0x11, 0x4b,
+  0x59, 0xf7, 0xea, 0x92, 0x1d, 0x47, 0x22, 0x0a, 0x49, 0x99, 0x6e, 0xe3,
+  0x97, 0xfe, 0xd1, 0x3d, 0x86, 0x40, 0xcb, 0xb6, 0xee, 0x93, 0x0f, 0xfc,
+  0xf3, 0x91, 0xc1, 0x6c, 0xd8, 0xd2, 0x68, 0x7d, 0x87, 0x3d, 0x2f, 0xee,
+  0xe8, 0x7b, 0xbc, 0xe0, 0x96, 0x04, 0x5a, 0xc6, 0xa5, 0x52, 0x9c, 0x13,
+  0x03, 0x23, 0xee, 0x29, 0x92, 0x8d, 0x32, 0x03, 0x34, 0xec, 0xec, 0xaa,
+  0xb8, 0xbd, 0xaf, 0x54, 0x31, 0x7f, 0x24, 0x01, 0xda, 0x98, 0xd0, 0xef,
+  0xa4, 0x1c, 0xaf, 0x60, 0xc8, 0x00, 0x11, 0xa8, 0x97, 0xf8, 0xad, 0x5c,
+  0xe2, 0xd6, 0x98, 0x89, 0xb3, 0x5d, 0x01, 0xcd, 0xad, 0xa6, 0xaa, 0xfd,
+  0xfc, 0x80, 0x7e, 0x80, 0xf7, 0x3e, 0x2f, 0x6d, 0xe5, 0x4b, 0x1a, 0xbf,
+  0x57, 0x6b, 0x6f, 0x06, 0xe0, 0xcc, 0x75, 0x36, 0xbc, 0xae, 0x62, 0x5b,
+  0x8d, 0xbb, 0x8d, 0xf3, 0x17, 0x63, 0xe5, 0xd1, 0x6e, 0x7f, 0x73, 0x29,
+  0x74, 0x7b, 0xa5, 0xf1, 0xef, 0x8a, 0xea, 0xf9, 0x85, 0x03, 0x79, 0xbe,
+  0x25, 0x17, 0xa1, 0xb1, 0x5b, 0x92, 0x91, 0xe6, 0xf3, 0xdc, 0x55, 0x2b,
+  0x81, 0x66, 0x21, 0x13, 0x6a, 0x4e, 0xbd, 0xa0, 0x6e, 0x6f, 0xb3, 0xa4,
+  0xc0, 0x42, 0x5a, 0xdc, 0x93, 0xbb, 0xdb, 0x8f, 0x45, 0x48, 0xea, 0x7a,
+  0x30, 0x1b, 0xdb, 0x96, 0xfa, 0x82, 0xea, 0xa1, 0x3a, 0x1d, 0xd8, 0x17,
+  0xd8, 0x25, 0x7e, 0xb5, 0xb7, 0xb3, 0xd9, 0x7e, 0x25, 0xed, 0x4e, 0x65,
+  0x24, 0xd7, 0x3c, 0x1b, 0x95, 0x20, 0xed, 0x7a, 0x28, 0x42, 0xdf, 0x4e,
+  0x0b, 0x9e, 0x31, 0xbc, 0xa0, 0x02, 0xc8, 0xdf, 0xac, 0x3b, 0xdf, 0xa1,
+  0xdd, 0xa0, 0xf5, 0xbd, 0xfe, 0x46, 0x0a, 0xbb, 0x03, 0x8f, 0xf1, 0xe7,
+  0x46, 0x67, 0x57, 0x6e, 0xca, 0x07, 0x29, 0x9c, 0x75, 0xe0, 0x04, 0x6d,
+  0x4f, 0x13, 0x95, 0xd9, 0x99, 0xb9, 0xb0, 0x1d, 0xb5, 0xc5, 0x36, 0x0c,
+  0x71, 0xad, 0x98, 0xc3, 0x13, 0xdf, 0x0e, 0xcf, 0xa9, 0x70, 0xef, 0x6a,
+  0x0a, 0x71, 0x9b, 0x9b, 0xcb, 0x41, 0x08, 0x51, 0x07, 0x5b, 0x5f, 0x7d,
+  0xe1, 0x8b, 0x9d, 0x90, 0x5d, 0x90, 0x2e, 0x8d, 0x68, 0xeb, 0x4d, 0xa5,
+  0x3b, 0xf5, 0xb0, 0xbd, 0x38, 0xe3, 0x63, 0x8b, 0x95, 0x0c, 0x48, 0x3d,
+  0x44, 0xd4, 0xb4, 0xbc, 0x03, 0x50, 0xbf, 0x9e, 0x0d, 0x2c, 0x92, 0xf9,
+  0x60, 0xfe, 0xd4, 0x5f, 0xc0, 0x80, 0xc6, 0x7f, 0xb6, 0x51, 0x71, 0x25,
+  0x53, 0xd2, 0x0e, 0xe6, 0xfd, 0xce, 0x54, 0x5b, 0xfb, 0x1f, 0x82, 0xc2,
+  0x22, 0xce, 0x6f, 0x35, 0x52, 0x9d, 0x0b, 0x9b, 0x89, 0x75, 0x2f, 0x78,
+  0x86, 0x64, 0xfb, 0xa3, 0x09, 0x51, 0x77, 0x81, 0x57, 0x54, 0x9b, 0xb8,
+  0x94, 0x52, 0xff, 0xbe, 0xad, 0xb7, 0x7e, 0x2b, 0xd3, 0xa0, 0xff, 0x3c,
+  0x02, 0x4f, 0x58, 0xf1, 0xab, 0x96, 0x1a, 0x56, 0xbd, 0x81, 0xa1, 0xdb,
+  0x25, 0xee, 0x7c, 0x35, 0xe4, 0xb8, 0x34, 0xaf, 0xe1, 0x80, 0x76, 0xfd,
+  0x35, 0x3c, 0x1e, 0x16, 0xd7, 0x40, 0xcf, 0x4b, 0x2c, 0x4a, 0xd2, 0x18,
+  0x74, 0x79, 0x03, 0x31, 0x67, 0xd6, 0xd2, 0xfa, 0x50, 0x6b, 0x87, 0xfd,
+  0x38, 0x90, 0x20, 0xba, 0x86, 0x49, 0x82, 0x84, 0x87, 0x3b, 0x8f, 0x8c,
+  0x9e, 0x84, 0x51, 0x87, 0x14, 0xa2, 0xb0, 0x66, 0xcc, 0x35, 0xf0, 0xa5,
+  0x76, 0xb4, 0x6f, 0xa6, 0xd7, 0xe1, 0x9f, 0x4b, 0x8d, 0xd2, 0x85, 0x11,
+  0x8d, 0x2e, 0x40, 0x0d, 0x4a, 0x64, 0xdf, 0x92, 0x03, 0xd5, 0xf2, 0x55,
+  0x84, 0x16, 0x4b, 0xee, 0xea, 0x3b, 0x08, 0xf6, 0x56, 0x2e, 0xec, 0x2c,
+  0xd7, 0x92, 0xaa, 0x25, 0x15, 0xb2, 0x80, 0x2c, 0x4b, 0xf4, 0x44, 0x69,
+  0x90, 0x8c, 0x8e, 0xf0, 0x6f, 0xe8, 0x2d, 0x19, 0x4a, 0x71, 0x97, 0x6c,
+  0x7a, 0x85, 0x8b, 0xe0, 0x1e, 0x41, 0xbb, 0x88, 0x89, 0xd2, 0xc6, 0xf0,
+  0x76, 0x0e, 0xc1, 0x1e, 0x0a, 0x71, 0xe4, 0x2e, 0x68, 0x29, 0x06, 0xfc,
+  0x5e, 0xd0, 0xfa, 0xf3, 0xe0, 0xa0, 0x71, 0x97, 0x02, 0xed, 0x4c, 0x43,
+  0x4f, 0x43, 0x38, 0xfb, 0x13, 0x88, 0xbe, 0xa4, 0x8a, 0x23, 0x4d, 0xeb,
+  0x96, 0xff, 0x88, 0x72, 0x9f, 0xcd, 0x7a, 0xcf, 0x37, 0x8e, 0xa1, 0x81,
+  0x85, 0x79, 0x80, 0xa7, 0x8c, 0xeb, 0x89, 0xee, 0xe1, 0x2d, 0xee, 0x86,
+  0x6c, 0x61, 0x15, 0xb0, 0x12, 0x39, 0x92, 0x88, 0x51, 0xc9, 0x01, 0x35,
+  0x4e, 0x87, 0x1a, 0x9a, 0xae, 0xc8, 0x34, 0x06, 0xa9, 0x38, 0x58, 0x0a,
+  0x67, 0x2f, 0x24, 0x5a, 0xcb, 0xb3, 0x02, 0x4b, 0x97, 0x58, 0xce, 0xd0,
+  0xd1, 0xf4, 0xb2, 0x9b, 0x72, 0x63, 0x9c, 0xb7, 0xdc, 0xac, 0x36, 0xd7,
+  0xaa, 0xc7, 0x6a, 0x5e, 0xa2, 0xd2, 0xa0, 0xea, 0x1d, 0x1c, 0x3c, 0x35,
+  0x37, 0xd1, 0xf9, 0xa5, 0x69, 0x6a, 0xce, 0x8b, 0x58, 0x2b, 0x7f, 0x08,
+  0xc9, 0xa1, 0x9b, 0xad, 0xd4, 0xa4, 0x17, 0x3e, 0x13, 0xbf, 0x24, 0x16,
+  0x71, 0x30, 0x95, 0x11, 0xbc, 0x11, 0x98, 0x80, 0xed, 0x6d, 0x9c, 0x72,
+  0x56, 0x7f, 0xf9, 0x65, 0xb5, 0xb1, 0x24, 0x51, 0x99, 0x8d, 0xb7, 0x16,
+  0x4c, 0x34, 0x6f, 0x67, 0x33, 0x69, 0x82, 0x0d, 0x75, 0xb8, 0x01, 0xb8,
+  0x68, 0x00, 0x16, 0x50, 0x55, 0x2a, 0xf2, 0x79, 0xed, 0x30, 0x74, 0x3a,
+  0x89, 0x94, 0xba, 0xc0, 0xab, 0x7d, 0x95, 0x6f, 0x25, 0xc2, 0x0f, 0x6a,
+  0x1a, 0x15, 0xee, 0xa6, 0x47, 0x01, 0xbb, 0x83, 0x83, 0xe8, 0x9c, 0x4a,
+  0x9f, 0xa0, 0x06, 0xbd, 0xff, 0xd9, 0x41, 0xd8, 0x53, 0x3d, 0xd5, 0x19,
+  0x62, 0x70, 0x47, 0x0c, 0x35, 0xde, 0x2b, 0xfd, 0xb2, 0x9a, 0xdd, 0x8d,
+  0x6e, 0x56, 0x9e, 0x8a, 0xbb, 0x52, 0xed, 0xf9, 0xd4, 0xc7, 0x34, 0x34,
+  0x53, 0xe9, 0xee, 0x65, 0x0c, 0x11, 0xcc, 0x35, 0xa2, 0xd8, 0x93, 0x56,
+  0x10, 0x66, 0x9e, 0xc5, 0x99, 0xe1, 0xdf, 0x2d, 0x9a, 0x67, 0xaf, 0x41,
+  0x4d, 0x9e, 0x8f, 0xed, 0x53, 0x97, 0x0b, 0x60, 0xf1, 0x67, 0x07, 0xee,
+  0xf9, 0xaf, 0x10, 0xb9, 0xfe, 0x15, 0xe7, 0x2e, 0x00, 0xeb, 0x0c, 0x06,
+  0x1b, 0x65, 0x27, 0x7a, 0xc2, 0x3c, 0x1f, 0xea, 0x32, 0xc4, 0xaf, 0x7b,
+  0xbe, 0x6e, 0x9c, 0xdc, 0xe4, 0xf2, 0x74, 0x8d, 0xcb, 0xae, 0x8f, 0x62,
+  0x5e, 0x67, 0x02, 0x36, 0x7a, 0xa5, 0xd0, 0xc6, 0xbb, 0x11, 0x77, 0x42,
+  0xe4, 0x20, 0xf3, 0xdb, 0x53, 0x85, 0x56, 0xa2, 0x71, 0xac, 0x5f, 0x1b,
+  0xa7, 0x0a, 0xe7, 0x01, 0x51, 0xb5, 0x66, 0xa2, 0x6e, 0x7b, 0x8c, 0x1a,
+  0x76, 0xb2, 0x0e, 0x91, 0x81, 0x8f, 0x5a, 0xaa, 0x9a, 0xdc, 0xc3, 0xfc,
+  0x0e, 0xa3, 0x2b, 0x77, 0x33, 0x12, 0x7f, 0x81, 0x87, 0x79, 0xef, 0x7d,
+  0x15, 0xc2, 0xc0, 0xa2, 0xb0, 0xf2, 0x97, 0xe5, 0x1e, 0xfc, 0xd9, 0x42,
+  0x40, 0xa7, 0x36, 0xad, 0x0a, 0x4c, 0xf3, 0xfe, 0x8f, 0xff, 0x89, 0x86,
+  0x18, 0x2d, 0x1a, 0x22, 0xf5, 0xe0, 0xed, 0x25, 0x92, 0xdf, 0x69, 0x7e,
+  0x6b, 0x08, 0x0e, 0x4f, 0x6e, 0xd4, 0xce, 0x7a, 0x69, 0x7e, 0xca, 0x49,
+  0x84, 0x99, 0xb1, 0x4f, 0x58, 0x87, 0x89, 0x27, 0xa9, 0xe9, 0x5c, 0x7c,
+  0xf6, 0x56, 0x16, 0xf4, 0x0b, 0xd2, 0x35, 0x13, 0x46, 0x78, 0x33, 0x80,
+  0xaa, 0x3c, 0xde, 0xd0, 0x41, 0x95, 0xe6, 0x67, 0xc2, 0x91, 0x99, 0xbe,
+  0xa8, 0x38, 0xbd, 0x75, 0x12, 0x9c, 0xea, 0x06, 0xdb, 0x81, 0xe8, 0xcb,
+  0x84, 0x9f, 0xea, 0x12, 0xd1, 0x08, 0xcb, 0x3a, 0x92, 0x4e, 0x86, 0x8b,
+  0x7f, 0x52, 0xed, 0xc2, 0x55, 0x23, 0xcc, 0x8f, 0x78, 0x1b, 0x01, 0xac,
+  0xea, 0xcb, 0x3a, 0x4d, 0xf0, 0x51, 0x22, 0x96, 0x07, 0x91, 0x26, 0x32,
+  0xc8, 0x51, 0x3b, 0x91, 0x27, 0x92, 0x87, 0xef, 0xe0, 0x96, 0x8a, 0x60,
+  0x6c, 0xc7, 0x97, 0x34, 0x56, 0xdf, 0x84, 0x3f, 0xcf, 0xce, 0xad, 0xea,
+  0xdd, 0x49, 0x5e, 0x72, 0xf9, 0xfb, 0xc3, 0x24, 0x09, 0x31, 0x3b, 0xd2,
+  0xfc, 0x5f, 0xfb, 0x18, 0x1d, 0xbb, 0xfe, 0x22, 0x97, 0x4e, 0xd1, 0x0c,
+  0x59, 0x80, 0x43, 0x5c, 0x4f, 0xce, 0x48, 0x87, 0xc0, 0xb0, 0x77, 0x91,
+  0xf7, 0x57, 0xaa, 0x8a, 0x1d, 0x17, 0x02, 0xa6, 0xa0, 0xb4, 0x57, 0x22,
+  0x21, 0x98, 0x0d, 0xc0, 0x1e, 0xe6, 0x39, 0x08, 0xc0, 0xf8, 0x4f, 0x50,
+  0x54, 0xee, 0xce, 0xe2, 0x07, 0x32, 0x8b, 0x81, 0x88, 0xaa, 0x79, 0x8d,
+  0xeb, 0xf7, 0xb8, 0x63, 0x9c, 0x6e, 0xb7, 0x87, 0xaa, 0xda, 0x20, 0x61,
+  0x8f, 0x8c, 0x1f, 0x72, 0x9b, 0xa3, 0x92, 0x7f, 0x9f, 0x76, 0xad, 0x61,
+  0x5b, 0x3a, 0x15, 0x29, 0x51, 0xcc, 0x8b, 0xf0, 0xee, 0x4d, 0xce, 0xe9,
+  0xb3, 0x5c, 0xa6, 0x25, 0x96, 0xed, 0xc1, 0x6b, 0x3e, 0x65, 0x7d, 0x89,
+  0xb2, 0xc4, 0x1c, 0xa8, 0x5f, 0x40, 0x1e, 0x44, 0x7f, 0x36, 0x37, 0xf9,
+  0xfb, 0xed, 0x7b, 0xd5, 0x1f, 0xdb, 0xe0, 0x01, 0x1e, 0x2d, 0x3f, 0x1e,
+  0x05, 0x67, 0xc7, 0xc6, 0x8f, 0x37, 0xed, 0x7b, 0xe8, 0x53, 0x68, 0x17,
+  0x63, 0x1a, 0xb0, 0xa0, 0xbd, 0x6d, 0xaa, 0xb1, 0x75, 0x19, 0x85, 0x3f,
+  0xae, 0xec, 0x51, 0x0b, 0x51, 0x7b, 0x86, 0x56, 0xcb, 0x8b, 0x63, 0xa1,
+  0x5a, 0xda, 0x5f, 0x69, 0x29, 0x7e, 0xa8, 0x44, 0xb3, 0x5f, 0x4b, 0x2e,
+  0x1b, 0xa2, 0xda, 0xd5, 0xed, 0x9c, 0x04, 0x32, 0x30, 0xa5, 0x9b, 0xdc,
+  0xd2, 0x8e, 0x78, 0x6f, 0x0a, 0x3a, 0xd4, 0xe6, 0x34, 0x6f, 0x27, 0x21,
+  0xb9, 0x31, 0x9e, 0xa5, 0xe8, 0xd6, 0x72, 0x1b, 0x2a, 0x7c, 0x8d, 0x9d,
+  0xfc, 0xf4, 0xf0, 0x57, 0x33, 0xa0, 0x5b, 0x22, 0xc1, 0x47, 0xa1, 0xd8,
+  0x45, 0x94, 0x03, 0x34, 0x12, 0x93, 0x4a, 0xb3, 0x19, 0x8b, 0xf3, 0x08,
+  0xc1, 0x13, 0xd7, 0xaa, 0xf0, 0x02, 0xe6, 0x8f, 0x8d, 0xa9, 0xc6, 0x8e,
+  0x4c, 0xae, 0x57, 0xd9, 0x69, 0xf2, 0xc1, 0xe8, 0x8e, 0x22, 0x77, 0x3a,
+  0xb9, 0x56, 0x1e, 0xfa, 0xdc, 0x4b, 0xd4, 0xbb, 0x1e, 0x98, 0xab, 0x3d,
+  0x30, 0x63, 0x95, 0xde, 0x43, 0x2c, 0x77, 0x9b, 0x6e, 0xf6, 0x8d, 0xdc,
+  0xe0, 0x03, 0xbb, 0x2a, 0x1f, 0xd9, 0x81, 0x24, 0xe9, 0xb6, 0xaa, 0xeb,
+  0x13, 0xe2, 0xce, 0x5e, 0xe9, 0x60, 0xde, 0xfe, 0x60, 0xb3, 0xdb, 0xc0,
+  0xac, 0xcd, 0xbd, 0x62, 0x78, 0x83, 0x8a, 0xf4, 0x42, 0x59, 0x57, 0xd6,
+  0xd1, 0xd4, 0x20, 0x6c, 0xc6, 0x84, 0xee, 0xf5, 0x9d, 0x87, 0xb8, 0x17,
+  0x67, 0xb9, 0x62, 0x31, 0xcc, 0xe4, 0xfd, 0x24, 0xe4, 0xb2, 0xfa, 0x02,
+  0x28, 0xe3, 0x86, 0xa2, 0x0f, 0x0f, 0x0a, 0xe6, 0x56, 0x8f, 0x4f, 0xf2,
+  0xae, 0xad, 0x00, 0x9e, 0xe1, 0x21, 0x07, 0x09, 0x4f, 0x5f, 0xd8, 0xa5,
+  0xd2, 0x10, 0x22, 0x00, 0x00, 0x1c, 0x57, 0xc6, 0xd9, 0x22, 0x79, 0xe2,
+  0x01, 0x3f, 0x30, 0xee, 0x7f, 0x6f, 0x82, 0x2d, 0xa5, 0xd4, 0x09, 0xc3,
+  0x42, 0xfd, 0xca, 0xcf, 0x06, 0x37, 0xc5, 0x4a, 0x7a, 0x3f, 0x52, 0x52,
+  0x48, 0xd2, 0x4b, 0xaa, 0x5d, 0xe2, 0x99, 0x1d, 0x52, 0x4b, 0x00, 0x3f,
+  0x43, 0x31, 0x30, 0x81, 0x70, 0xa7, 0xce, 0x87, 0x50, 0x6a, 0x92, 0x07,
+  0x20, 0xd0, 0x42, 0xc3, 0x65, 0x86, 0x31, 0x82, 0xe6, 0xc7, 0xc6, 0x07,
+  0xa7, 0xe9, 0x7f, 0xd6, 0xe0, 0x22, 0xc4, 0xca, 0x52, 0x79, 0xbc, 0x89,
+  0xfa, 0x5a, 0xf3, 0x42, 0xcc, 0x7e, 0x85, 0x26, 0x41, 0xee, 0x1b, 0x65,
+  0x78, 0xb2, 0x6f, 0xde, 0x5a, 0x25, 0x47, 0x45, 0x4f, 0x3e, 0x13, 0x04,
+  0xd5, 0x90, 0xa7, 0x91, 0x1f, 0xd1, 0x7d, 0x67, 0x44, 0xf9, 0x84, 0x32,
+  0x47, 0x70, 0xfb, 0x67, 0x78, 0xcd, 0x1c, 0x9c, 0x81, 0x52, 0xe3, 0xa3,
+  0x9a, 0x47, 0x07, 0xe6, 0x64, 0x25, 0x67, 0xd9, 0x0a, 0x2a, 0x2e, 0x4c,
+  0xb4, 0x13, 0xdd, 0xca, 0x8a, 0xa4, 0xd8, 0x98, 0x9a, 0x3a, 0xda, 0x24,
+  0x2f, 0xa6, 0x5d, 0xa5, 0xa9, 0x0a, 0x6d, 0xde, 0x34, 0xb3, 0x8d, 0x3b,
+  0xab, 0x56, 0x17, 0xfe, 0x86, 0x5d, 0x7b, 0x2b, 0xf2, 0x41, 0xdb, 0x80,
+  0x3d, 0xaa, 0x5e, 0xdb, 0x64, 0x6d, 0x9e, 0x0d, 0xeb, 0x53, 0x17, 0xbc,
+  0x63, 0xf1, 0x6c, 0xf4, 0x11, 0xda, 0x8c, 0x45, 0xea, 0x3c, 0x88, 0x33,
+  0x17, 0x58, 0x31, 0x3c, 0xa1, 0xc0, 0x29, 0x51, 0xb3, 0x98, 0x8e, 0x00,
+  0x3f, 0x87, 0x75, 0x01, 0x30, 0x7e, 0x97, 0x0e, 0x53, 0x7a, 0x04, 0x2c,
+  0x4a, 0x77, 0x92, 0x6c, 0x82, 0x2d, 0x7c, 0x66, 0xca, 0x31, 0x96, 0xb1,
+  0xc3, 0x57, 0x17, 0xd6, 0xd6, 0x3e, 0xc2, 0x4b, 0xc7, 0xbd, 0x06, 0xc2,
+  0x3e, 0x0d, 0x23, 0xde, 0xfa, 0xd9, 0xa5, 0xbd, 0xcc, 0x4c, 0xdc, 0x72,
+  0x89, 0xbd, 0x37, 0x24, 0xa7, 0xdd, 0xbd, 0x34, 0xd8, 0x51, 0x5d, 0x74,
+  0x09, 0x84, 0x1e, 0x1b, 0x3f, 0xb6, 0x53, 0x0d, 0xaa, 0x5f, 0xda, 0xa5,
+  0x04, 0xfc, 0x4e, 0x8a, 0x7e, 0x0b, 0x9c, 0x43, 0x19, 0xee, 0xca, 0xff,
+  0x7a, 0xbd, 0x1f, 0x1a, 0x42, 0xc5, 0xae, 0xf8, 0x71, 0xd9, 0x95, 0x82,
+  0x0a, 0x62, 0xdd, 0x8d, 0x1f, 0xee, 0x36, 0xfa, 0x9b, 0x4a, 0xda, 0xc6,
+  0x71, 0x75, 0x3c, 0xf1, 0x26, 0xfb, 0xb0, 0x2d, 0xe8, 0x2b, 0x25, 0x1d,
+  0xc7, 0xbf, 0xe2, 0x3a, 0xa5, 0x4b, 0x7c, 0xb5, 0x90, 0x4b, 0x3b, 0xc5,
+  0xbe, 0x0c, 0x55, 0x0c, 0xb2, 0xca, 0x00, 0x62, 0x7c, 0x6c, 0xff, 0x17,
+  0x6f, 0x3e, 0x26, 0xf6, 0x15, 0x27, 0x61, 0xf0, 0x01, 0x42, 0xb9, 0x57,
+  0x5b, 0xe1, 0x48, 0x80, 0xc2, 0xbb, 0x00, 0x98, 0xd7, 0x40, 0xf9, 0x09,
+  0x6d, 0x34, 0x15, 0xbb, 0x30, 0xde, 0x64, 0x1d, 0x43, 0x99, 0x4d, 0xd7,
+  0x8c, 0xb5, 0xb3, 0x62, 0x80, 0xfc, 0xd5, 0xbb, 0x3a, 0x51, 0x33, 0x97,
+  0x94, 0x17, 0x47, 0x62, 0x88, 0x91, 0x4e, 0xf7, 0x0a, 0xba, 0xe4, 0x63,
+  0x8c, 0x65, 0x38, 0x62, 0x9a, 0x78, 0x2b, 0xf3, 0x08, 0xef, 0xb2, 0x93,
+  0x26, 0x26, 0x8b, 0x6a, 0x4d, 0xd0, 0xff, 0x57, 0xc2, 0x38, 0x4b, 0x38,
+  0x36, 0x54, 0xd8, 0xfd, 0xac, 0xc8, 0xff, 0x85, 0xc7, 0x3e, 0xcc, 0xe8,
+  0x22, 0x57, 0xa2, 0x4e, 0x94, 0x18, 0x02, 0x3f, 0x09, 0x13, 0x19, 0xd5,
+  0xe7, 0x2a, 0x5c, 0x5e, 0x04, 0xdf, 0x6f, 0x11, 0x65, 0xd0, 0xb0, 0x8c,
+  0xf5, 0xe4, 0x71, 0x69, 0xb0, 0x63, 0x98, 0x86, 0x1f, 0x06, 0x14, 0x22,
+  0xa2, 0xd3, 0x1b, 0xeb, 0x0c, 0x9e, 0xf2, 0x88, 0x7a, 0xf2, 0xf7, 0x50,
+  0x65, 0x2b, 0x31, 0xa9, 0xec, 0x63, 0x01, 0xc5, 0x2b, 0x73, 0xe9, 0xd9,
+  0xad, 0x6d, 0x50, 0xf2, 0x8c, 0x47, 0x7b, 0xbf, 0x24, 0x83, 0x74, 0x1e,
+  0xde, 0x24, 0x53, 0x3b, 0x23, 0x44, 0x23, 0xbc, 0x9a, 0x92, 0xb0, 0xf9,
+  0xe1, 0xdd, 0xbd, 0xdb, 0xa3, 0x8d, 0xb9, 0x48, 0xcc, 0xcd, 0xc3, 0x56,
+  0x89, 0xda, 0xe3, 0xd4, 0xa1, 0x70, 0x5b, 0xef, 0xf7, 0x3a, 0x24, 0x86,
+  0xa1, 0xd9, 0xf1, 0xec, 0x50, 0x8d, 0x32, 0x33, 0xe6, 0x65, 0x06, 0xc8,
+  0xb2, 0x4f, 0x85, 0xbe, 0x60, 0xe4, 0x26, 0xfc, 0xff, 0x39, 0x14, 0x05,
+  0x32, 0x73, 0x43, 0x43, 0x4b, 0xa6, 0xf4, 0xc0, 0xab, 0x89, 0x93, 0xd5,
+  0x6f, 0xf2, 0x47, 0x0f, 0x6b, 0x03, 0xf2, 0x77, 0xd9, 0xf9, 0x57, 0x8f,
+  0x2e, 0x69, 0xd6, 0xc7, 0x6a, 0x8e, 0xa1, 0x37, 0xa3, 0x0c, 0x10, 0x07,
+  0x28, 0x0e, 0xd8, 0xab, 0x8e, 0xfe, 0x64, 0xc2, 0x4e, 0xde, 0x55, 0x1c,
+  0x09, 0xfa, 0x2c, 0xd9, 0x30, 0x68, 0x2c, 0x82, 0xb4, 0x0d, 0xad, 0x30,
+  0x2a, 0x1f, 0x5c, 0x2d, 0x75, 0x69, 0x6f, 0x38, 0x1a, 0xc5, 0xd3, 0xca,
+  0xcd, 0x13, 0xfe, 0x38, 0xf4, 0x9d, 0xc2, 0xda, 0xdd, 0x89, 0x8b, 0xd0,
+  0x72, 0xe1, 0x5b, 0xce, 0xbd, 0x20, 0x37, 0xf3, 0x76, 0x27, 0x96, 0xec,
+  0x71, 0x50, 0x16, 0x26, 0x16, 0xb8, 0xee, 0xa5, 0x79, 0x96, 0x47, 0xfe,
+  0x9f, 0x96, 0xbc, 0x17, 0x1f, 0x55, 0x5b, 0xab, 0xde, 0x95, 0x89, 0xa2,
+  0x64, 0x34, 0xe5, 0x1a, 0x79, 0x67, 0xd6, 0x07, 0x2b, 0xd8, 0xca, 0x70,
+  0x65, 0x1a, 0xb1, 0x63, 0x57, 0x4c, 0x9f, 0x67, 0xf2, 0x9c, 0x41, 0x62,
+  0x7a, 0xec, 0x34, 0x84, 0x7f, 0x01, 0xa0, 0xf1, 0x54, 0x53, 0xcb, 0xfb,
+  0xd8, 0x9e, 0xe2, 0x13, 0x7e, 0xb0, 0xfb, 0x30, 0x07, 0xb6, 0x3f, 0x77,
+  0xff, 0x98, 0x96, 0x9e, 0xe2, 0xd9, 0xa3, 0x17, 0xaa, 0xa0, 0x71, 0xf4,
+  0xed, 0x9d, 0x67, 0x2c, 0x68, 0x16, 0x82, 0xd5, 0x1a, 0x85, 0x49, 0x46,
+  0x94, 0xac, 0x2b, 0xd2, 0xe3, 0xb7, 0xe9, 0xfe, 0xb2, 0xee, 0xba, 0xe3,
+  0xe9, 0x75, 0xdc, 0xf5, 0xe6, 0xf0, 0xc5, 0xa2, 0x4c, 0xcd, 0x87, 0x55,
+  0xde, 0x2d, 0x7f, 0x21, 0x62, 0xdb, 0x11, 0x6a, 0x09, 0x8d, 0xb8, 0x35,
+  0xdc, 0x4a, 0x13, 0x5c, 0xa0, 0x04, 0x51, 0xf4, 0x59, 0x11, 0x83, 0x4d,
+  0xb9, 0xa0, 0xcc, 0x3a, 0x72, 0xac, 0x18, 0xaf, 0x50, 0x9f, 0x6d, 0xee,
+  0x41, 0xf5, 0x9f, 0x7f, 0x36, 0x70, 0x3c, 0xe6, 0x45, 0x04, 0xb4, 0xa8,
+  0xc5, 0x36, 0xc2, 0x56, 0x68, 0x05, 0xdc, 0xd8, 0x6a, 0x16, 0xc4, 0xcc,
+  0xca, 0x4d, 0xcf, 0x7f, 0x7a, 0xf9, 0xee, 0x58, 0xdf, 0x3c, 0xd5, 0xbd,
+  0xe7, 0x50, 0x91, 0x61, 0x42, 0x16, 0x3c, 0xb0, 0x41, 0xf5, 0x7f, 0x5c,
+  0xed, 0xdb, 0xc7, 0xbd, 0xc8, 0x27, 0xce, 0x8c, 0x00, 0x01, 0x73, 0x4c,
+  0x2c, 0x77, 0x7f, 0x61, 0xc8, 0x46, 0xed, 0xa1, 0xd4, 0x1b, 0x49, 0xfb,
+  0xa4, 0x6c, 0x5e, 0x09, 0xd8, 0x06, 0x87, 0x27, 0x85, 0x53, 0x49, 0x50,
+  0x92, 0x05, 0x17, 0xf0, 0x60, 0x3b, 0x9d, 0x5f, 0x87, 0x27, 0x6c, 0xf7,
+  0x95, 0xdd, 0x5a, 0x3b, 0x5d, 0x53, 0xa6, 0xb5, 0x08, 0x6f, 0xfa, 0x14,
+  0x6d, 0x2b, 0x6b, 0x23, 0x01, 0x03, 0x43, 0xde, 0xd1, 0xc6, 0x43, 0x55,
+  0xbd, 0x7f, 0xfa, 0xb7, 0x60, 0xa6, 0x4e, 0x43, 0x50, 0x36, 0xc2, 0xac,
+  0x3e, 0xbf, 0xc3, 0x21, 0x03, 0x23, 0xc0, 0xea, 0xd8, 0x81, 0x38, 0x6e,
+  0xd2, 0xfb, 0xc9, 0x8b, 0x5d, 0x9b, 0xf3, 0x9c, 0x08, 0x1f, 0x84, 0x0b,
+  0x49, 0x58, 0x11, 0xfe, 0x7f, 0x00, 0x9e, 0x63, 0x42, 0x9e, 0x3d, 0x6b,
+  0xed, 0x1d, 0x44, 0xe2, 0x7f, 0x54, 0x5d, 0xd6, 0x7c, 0x12, 0x39, 0xa7,
+  0x82, 0xb1, 0x60, 0xc3, 0x19, 0xea, 0xfb, 0xa4, 0xfb, 0xf5, 0xa0, 0xe2,
+  0xe1, 0x6a, 0xb5, 0x4c, 0x4a, 0x3f, 0xff, 0xaf, 0x6f, 0x5f, 0x27, 0x9e,
+  0x58, 0xec, 0x1e, 0xdf, 0x1d, 0xc8, 0xdd, 0xaf, 0x82, 0x8e, 0x14, 0x3c,
+  0xc5, 0xf0, 0xe3, 0xb9, 0xdb, 0x14, 0x3c, 0xe2, 0x29, 0x5c, 0x76, 0x8c,
+  0xed, 0x94, 0x14, 0x7f, 0x71, 0x2b, 0x01, 0x07, 0x24, 0xa4, 0x1b, 0xb5,
+  0xc6, 0xce, 0x8c, 0xa7, 0x74, 0x53, 0xa4, 0xad, 0x53, 0x2e, 0x3c, 0x47,
+  0xca, 0x46, 0x74, 0xa3, 0x12, 0xc2, 0x54, 0x84, 0xf9, 0x00, 0x5d, 0xf8,
+  0x97, 0xac, 0x90, 0xa8, 0xcf, 0x16, 0x56, 0x2f, 0xe8, 0xf9, 0xd0, 0x9c,
+  0x8b, 0x65, 0xc3, 0x69, 0x9f, 0xb0, 0xe7, 0xf6, 0xbd, 0xd1, 0xcc, 0x10,
+  0x80, 0x6d, 0x56, 0x15, 0x97, 0x82, 0x5e, 0xcb, 0x1f, 0xfc, 0x66, 0x37,
+  0x8f, 0x28, 0xbd, 0xff, 0x6b, 0x21, 0x12, 0x32, 0xf6, 0x78, 0xca, 0xf0,
+  0x47, 0x80, 0xe2, 0x02, 0x6e, 0xe7, 0x6f, 0xc9, 0x51, 0x16, 0x65, 0x4c,
+  0xbc, 0x10, 0x3b, 0x59, 0x3b, 0xb9, 0xf7, 0xe1, 0x45, 0x59, 0x44, 0xe0,
+  0x78, 0x1c, 0x37, 0xe5, 0x1e, 0xc2, 0x5b, 0x6f, 0xf1, 0x84, 0x7b, 0x43,
+  0x32, 0xcc, 0xc6, 0x4a, 0x62, 0xd8, 0x86, 0xd1, 0x3d, 0x39, 0xad, 0xd3,
+  0x52, 0x5b, 0x26, 0xf2, 0xfb, 0x9d, 0x6d, 0x13, 0x5a, 0xee, 0x42, 0x95,
+  0x50, 0xfe, 0x48, 0x88, 0x9e, 0x09, 0x1e, 0xf4, 0x53, 0xf1, 0x2e, 0x9a,
+  0xc4, 0x6c, 0x01, 0x07, 0x76, 0xcc, 0xfc, 0x9b, 0x42, 0x83, 0xc9, 0x04,
+  0x70, 0x2a, 0xf5, 0xc9, 0xa8, 0x00, 0x2d, 0xf9, 0x53, 0xf6, 0x65, 0x3b,
+  0x07, 0x50, 0xff, 0x49, 0xb5, 0x47, 0xff, 0xa2, 0x8d, 0xa1, 0xb3, 0x3b,
+  0x47, 0x7d, 0x9c, 0x34, 0x53, 0x29, 0x39, 0x30, 0xbb, 0x14, 0x13, 0x8b,
+  0xe1, 0x4b, 0x2c, 0x63, 0x26, 0x1f, 0x6e, 0x93, 0xc6, 0x3d, 0xf3, 0x60,
+  0xe7, 0x8f, 0x2c, 0x98, 0xc4, 0xb3, 0x03, 0x4d, 0x43, 0x97, 0x6e, 0x19,
+  0x2d, 0x20, 0x8e, 0x54, 0x41, 0xf2, 0x37, 0xd7, 0x76, 0xa9, 0x4e, 0x54,
+  0xda, 0xba, 0x71, 0xa3, 0xb5, 0xca, 0x2e, 0x4e, 0xa0, 0x41, 0xf0, 0x21,
+  0x59, 0xe0, 0x64, 0x41, 0x84, 0x0b, 0x23, 0xa2, 0x77, 0x40, 0x57, 0xf5,
+  0xe2, 0xa9, 0xcd, 0x82, 0xc9, 0xd5, 0xc2, 0xba, 0x09, 0x75, 0x78, 0xd5,
+  0x85, 0x28, 0xd8, 0x52, 0x99, 0x5c, 0xd4, 0x7d, 0x86, 0x1e, 0xef, 0x41,
+  0x4b, 0x89, 0x64, 0x32, 0x98, 0x20, 0x7e, 0x6e, 0xfc, 0xce, 0x85, 0x56,
+  0x57, 0x8e, 0x94, 0x17, 0x33, 0x0f, 0x43, 0x3e, 0x69, 0x52, 0xbf, 0x97,
+  0x5e, 0xa5, 0x37, 0xf6, 0xc7, 0xa8, 0xc7, 0xf2, 0xea, 0xbf, 0xf8, 0xb2,
+  0xae, 0x71, 0x37, 0x2b, 0x60, 0x60, 0xde, 0xa2, 0xf5, 0x61, 0xa4, 0xaa,
+  0xef, 0x12, 0xf2, 0x64, 0xfe, 0x82, 0x42, 0xb2, 0x8d, 0x4d, 0x03, 0xc5,
+  0xc4, 0x87, 0x3e, 0x60, 0xff, 0x85, 0xe9, 0x7a, 0x24, 0x42, 0x0c, 0xe1,
+  0x72, 0xf0, 0xb4, 0xcb, 0x7f, 0xab, 0x19, 0xab, 0x94, 0xdc, 0x12, 0x1c,
+  0xda, 0x72, 0xb6, 0xae, 0xaf, 0x7b, 0xd3, 0x26, 0xa8, 0x9f, 0x4d, 0x2b,
+  0x55, 0xbc, 0x73, 0x2b, 0x88, 0x8b, 0x08, 0xcf, 0x36, 0xc0, 0x5e, 0xb1,
+  0xad, 0x2a, 0x69, 0xdc, 0xad, 0xa3, 0xed, 0xb4, 0x8e, 0xf0, 0xaf, 0xb2,
+  0xbe, 0xed, 0x92, 0xef, 0x03, 0xd0, 0x21, 0xfc, 0xf6, 0xc9, 0x9e, 0x0c,
+  0x32, 0x06, 0xf5, 0x74, 0x67, 0x3e, 0x02, 0x9f, 0xfb, 0x95, 0xa6, 0xf5,
+  0xaf, 0x21, 0xe2, 0xb0, 0xed, 0xe9, 0xe9, 0xbf, 0x8c, 0xd9, 0xac, 0x88,
+  0x9c, 0x98, 0x76, 0x32, 0x7a, 0x17, 0x28, 0xef, 0xec, 0xff, 0x95, 0xef,
+  0xf3, 0x91, 0x1c, 0xc7, 0x45, 0x98, 0xab, 0x8b, 0xd2, 0x9c, 0xce, 0x87,
+  0x00, 0x20, 0xf0, 0xd5, 0xb9, 0x1b, 0x64, 0x4c, 0xa2, 0x16, 0xbe, 0xfd,
+  0x77, 0x0e, 0xeb, 0xb6, 0x43, 0x4b, 0x20, 0x4e, 0xc3, 0x8c, 0x1d, 0xfb,
+  0x8a, 0xfc, 0xce, 0x17, 0x56, 0xe6, 0xb8, 0xc5, 0x63, 0x7c, 0x1e, 0xd2,
+  0x7b, 0x30, 0x64, 0x26, 0xf0, 0xe9, 0xd2, 0x34, 0x5e, 0xbc, 0x01, 0x6d,
+  0x10, 0x65, 0x8a, 0x06, 0x49, 0x1f, 0x13, 0xf2, 0x08, 0x24, 0xd0, 0xe9,
+  0xa4, 0xe3, 0x15, 0x1f, 0xe5, 0xc9, 0x69, 0xd4, 0x60, 0x73, 0xd9, 0x2b,
+  0x58, 0x0c, 0x0e, 0x18, 0x55, 0x78, 0xdf, 0x87, 0xaa, 0xdf, 0x44, 0x2b,
+  0x9f, 0x50, 0x6e, 0xec, 0x51, 0xc6, 0x13, 0xca, 0x2b, 0xf6, 0x3b, 0x83,
+  0xda, 0x71, 0xe0, 0xcd, 0xba, 0x11, 0x8a, 0x74, 0x4f, 0xa5, 0x63, 0xa9,
+  0xe5, 0x75, 0x5b, 0x8e, 0x60, 0x20, 0x21, 0x7d, 0xf4, 0x2a, 0xe3, 0x1d,
+  0xfa, 0xd3, 0x69, 0x74, 0x30, 0x91, 0x04, 0xcf, 0x03, 0x5c, 0x8d, 0xaf,
+  0x07, 0x7b, 0xc0, 0xef, 0x75, 0x2e, 0x4a, 0x54, 0xd2, 0x4f, 0x75, 0x5e,
+  0xb5, 0x84, 0x07, 0xaa, 0x84, 0x60, 0xd0, 0xc0, 0x9f, 0x4e, 0xa0, 0x9b,
+  0x2a, 0x54, 0xed, 0x8e, 0x2c, 0x57, 0xb0, 0xf1, 0x0c, 0x02, 0x88, 0x9d,
+  0xfa, 0xbc, 0x0d, 0x3a, 0x77, 0x49, 0xa2, 0xb6, 0x6a, 0x10, 0x77, 0x8a,
+  0xc9, 0xae, 0xf7, 0x11, 0x73, 0x40, 0xb6, 0xb0, 0xc1, 0x1d, 0xa8, 0xc8,
+  0xbc, 0xdf, 0xb3, 0x93, 0xa7, 0x3c, 0xbc, 0xdd, 0xf7, 0x07, 0x21, 0xc1,
+  0x54, 0x56, 0xf2, 0xa4, 0xea, 0x28, 0xce, 0x22, 0x76, 0x6f, 0xae, 0x99,
+  0x37, 0xbd, 0xb5, 0x8f, 0xf0, 0x8a, 0x61, 0x51, 0x92, 0xc0, 0x5a, 0x47,
+  0xec, 0xaa, 0x87, 0x81, 0x9c, 0x44, 0x74, 0x59, 0xf5, 0x8a, 0x74, 0x22,
+  0xd8, 0xfb, 0x4e, 0x5f, 0xd5, 0x71, 0xc6, 0x2e, 0xb9, 0x06, 0xfe, 0x17,
+  0x57, 0x9e, 0x07, 0x3d, 0x7b, 0xdb, 0x30, 0xf5, 0x06, 0x5e, 0xea, 0xc0,
+  0x25, 0xca, 0x1a, 0xad, 0x19, 0x7b, 0xc2, 0x7a, 0x49, 0x8e, 0xf9, 0x5c,
+  0xf0, 0xd5, 0xc4, 0xb9, 0xb9, 0x53, 0x70, 0x6e, 0xc9, 0x51, 0x33, 0xe2,
+  0xb8, 0x8f, 0x26, 0xdb, 0xed, 0x33, 0xe5, 0x72, 0x17, 0x7e, 0xf8, 0xf7,
+  0x6c, 0x2c, 0x51, 0x8d, 0x13, 0xe3, 0x0d, 0x21, 0x05, 0xca, 0x8a, 0x12,
+  0x4f, 0x7c, 0x3c, 0xa5, 0x5e, 0x0a, 0x28, 0x2f, 0x70, 0x61, 0x1e, 0x0e,
+  0xe4, 0xb1, 0x86, 0x29, 0x0e, 0x23, 0x99, 0xe2, 0xbc, 0x7d, 0x0a, 0xfd,
+  0x23, 0xa7, 0x64, 0xaa, 0xcf, 0x9a, 0xb7, 0x19, 0x77, 0x6f, 0x60, 0xa0,
+  0xf0, 0xba, 0xe7, 0x4e, 0xa7, 0xfa, 0xfa, 0xb0, 0xfa, 0x97, 0x67, 0x5b,
+  0x91, 0x08, 0x4a, 0x6a, 0xe7, 0x23, 0xc1, 0xa8, 0x88, 0x95, 0x4a, 0x07,
+  0x30, 0x62, 0x44, 0xfb, 0x5f, 0x14, 0x57, 0x26, 0xfa, 0xaa, 0x6e, 0xc7,
+  0x5c, 0x30, 0x1e, 0xca, 0x74, 0xb4, 0xb7, 0x35, 0x02, 0x1c, 0x84, 0x56,
+  0xd2, 0x2b, 0x84, 0x99, 0xb7, 0xcb, 0xcb, 0xaa, 0x65, 0xe5, 0x4c, 0x40,
+  0x1e, 0x3e, 0x3b, 0x7b, 0x26, 0x12, 0x34, 0xcc, 0xb1, 0xe4, 0x09, 0x0d,
+  0xe4, 0x47, 0x42, 0xa6, 0xbf, 0x8d, 0x2b, 0xc5, 0xe5, 0xb2, 0x7f, 0xe0,
+  0xeb, 0xae, 0xd5, 0xf1, 0x2c, 0x0a, 0xe8, 0x17, 0x2c, 0x3b, 0xc4, 0x94,
+  0x8f, 0xbe, 0x64, 0x80, 0x42, 0x4e, 0xd9, 0x9a, 0x30, 0x0e, 0xd5, 0x2b,
+  0xb1, 0x15, 0x9b, 0x3c, 0x64, 0x3e, 0x99, 0x06, 0x27, 0x38, 0x79, 0xd8,
+  0x52, 0x41, 0xf7, 0x96, 0x8c, 0x47, 0xbc, 0xe6, 0x5e, 0x0c, 0xb2, 0x9c,
+  0xbe, 0xd0, 0x35, 0x29, 0x33, 0x44, 0x53, 0x8c, 0xee, 0x01, 0xfd, 0x78,
+  0x36, 0x6d, 0xca, 0x81, 0x5a, 0x4c, 0x9a, 0x5e, 0x69, 0x94, 0x0b, 0x1c,
+  0xb3, 0x13, 0x6b, 0x1d, 0x26, 0xfb, 0xdd, 0xb2, 0xb0, 0x18, 0xea, 0xa4,
+  0xdf, 0xeb, 0xb2, 0x4f, 0x86, 0x9c, 0x73, 0x2b, 0x6e, 0x2b, 0x71, 0x32,
+  0xa2, 0x37, 0x93, 0x97, 0x08, 0x66, 0x7d, 0x40, 0xfa, 0xde, 0x32, 0xe3,
+  0x0f, 0xa8, 0xb6, 0x38, 0x5c, 0x37, 0x4a, 0xca, 0xb9, 0x17, 0x8c, 0x5b,
+  0x4c, 0x12, 0x43, 0xe4, 0x4d, 0xae, 0xb9, 0x8e, 0x52, 0x59, 0x66, 0x13,
+  0x0e, 0xcd, 0x6c, 0x21, 0xd7, 0x2a, 0xa3, 0x12, 0xb4, 0xfe, 0xd6, 0x8d,
+  0xc7, 0xf3, 0x84, 0xdb, 0x09, 0x6e, 0x2a, 0x85, 0xf3, 0x4e, 0xff, 0x08,
+  0x99, 0x7d, 0x79, 0x6b, 0x06, 0xc4, 0x75, 0xd8, 0x53, 0x2c, 0x31, 0x61,
+  0xe2, 0x76, 0x20, 0x05, 0x9a, 0xce, 0x98, 0x1a, 0x85, 0xc6, 0xae, 0xdf,
+  0xfd, 0xac, 0xb9, 0x6a, 0x60, 0x5d, 0xe6, 0x6f, 0xfc, 0x0d, 0x6f, 0x11,
+  0xfa, 0x16, 0xfe, 0x92, 0xeb, 0x7b, 0x2f, 0xd2, 0xf6, 0xe0, 0x2c, 0xec,
+  0xd9, 0xd1, 0xa8, 0xd6, 0x05, 0x0a, 0x49, 0x01, 0xe6, 0x79, 0xbf, 0x34,
+  0x1b, 0xa9, 0x8b, 0x8c, 0xb7, 0x6e, 0x59, 0x17, 0x7d, 0xb0, 0x95, 0xba,
+  0x81, 0x9d, 0x88, 0x65, 0x77, 0x8f, 0xc6, 0x7c, 0x6e, 0x73, 0x10, 0x27,
+  0xad, 0x81, 0x65, 0xf7, 0xaf, 0xa6, 0x87, 0x90, 0xd7, 0x20, 0x95, 0xac,
+  0x78, 0x86, 0xfb, 0x6a, 0xc0, 0x77, 0x8f, 0x74, 0x2d, 0x13, 0x87, 0x84,
+  0x65, 0x87, 0xe8, 0xfb, 0x47, 0xf9, 0xb5, 0x8e, 0x73, 0xa5, 0xd2, 0x34,
+  0x2b, 0x2a, 0xd4, 0x9a, 0x44, 0x2b, 0x9b, 0xd3, 0x7c, 0xc9, 0x9e, 0xd6,
+  0xa7, 0x58, 0xa5, 0x55, 0x75, 0xba, 0x52, 0xde, 0x47, 0xd2, 0xb6, 0x12,
+  0x15, 0xcd, 0x36, 0x74, 0xac, 0x7d, 0x7b, 0xc7, 0x72, 0xc0, 0x7f, 0x6d,
+  0x58, 0xc6, 0x14, 0xe0, 0x44, 0x31, 0x8b, 0xa0, 0xa6, 0xa5, 0x8d, 0x52,
+  0xc2, 0xa7, 0x6d, 0x2a, 0x81, 0xf2, 0xe4, 0xae, 0xc2, 0xa6, 0xa6, 0x22,
+  0xca, 0x59, 0x98, 0xef, 0xdd, 0xc7, 0x47, 0x73, 0x8c, 0x54, 0x2e, 0xf9,
+  0x83, 0x11, 0x08, 0xca, 0x07, 0x47, 0x46, 0x23, 0x71, 0x16, 0x4e, 0x49,
+  0x78, 0x8a, 0x17, 0x06, 0x58, 0xd3, 0x4f, 0x91, 0x60, 0x72, 0x96, 0x02,
+  0xaf, 0xfe, 0xf6, 0xed, 0x9e, 0x57, 0x54, 0x69, 0x08, 0xb5, 0xdf, 0x47,
+  0x4e, 0xc0, 0xbb, 0x01, 0x6a, 0x56, 0x97, 0xa7, 0x1b, 0xa4, 0x87, 0x78,
+  0xb3, 0xd4, 0x2f, 0xd6, 0xef, 0x45, 0xa9, 0x20, 0xba, 0x11, 0xe3, 0x1f,
+  0xa2, 0x61, 0x8c, 0x97, 0xfc, 0x86, 0xeb, 0x00, 0x6f, 0x28, 0xcd, 0x37,
+  0x48, 0xc6, 0xe3, 0x78, 0x34, 0x68, 0xcd, 0xd8, 0xeb, 0xfe, 0x73, 0x22,
+  0xfa, 0x04, 0xfc, 0xe8, 0xb3, 0x4b, 0xae, 0x00, 0x8b, 0x42, 0xda, 0xe0,
+  0x5f, 0xf3, 0xf4, 0x68, 0x82, 0xa5, 0xcb, 0x92, 0x04, 0x3d, 0x9d, 0x75,
+  0x67, 0x9a, 0x64, 0xe9, 0x09, 0x49, 0xd4, 0x92, 0x31, 0x1c, 0xf7, 0x0e,
+  0xce, 0x14, 0x1c, 0x88, 0x77, 0x15, 0x12, 0x37, 0x50, 0x6c, 0x89, 0x23,
+  0x0b, 0xd2, 0xbb, 0x4d, 0xe7, 0x00, 0x88, 0x30, 0xef, 0x86, 0x74, 0xb2,
+  0x5d, 0xff, 0x32, 0xb8, 0x59, 0x06, 0xbe, 0xca, 0x2d, 0x64, 0xc1, 0x98,
+  0xe4, 0x87, 0x25, 0xbc, 0x1c, 0xe5, 0xf5, 0x13, 0x9c, 0x73, 0x7c, 0x3a,
+  0x5e, 0xb8, 0xe9, 0xf0, 0xac, 0x9a, 0xc8, 0x2d, 0x28, 0xcd, 0x46, 0x1d,
+  0xb5, 0x01, 0x6b, 0x97, 0xa0, 0x20, 0xa9, 0x99, 0x78, 0xc5, 0xf3, 0xea,
+  0xa7, 0xd9, 0xdf, 0x73, 0xa2, 0x4f, 0xf5, 0xf5, 0x5e, 0xe7, 0x9f, 0x6f,
+  0xf4, 0xd1, 0xea, 0x9b, 0x0b, 0x71, 0x86, 0x91, 0x93, 0x03, 0xfe, 0x6c,
+  0x70, 0x62, 0xd0, 0xb5, 0x0b, 0x5e, 0xaa, 0x0c, 0xd0, 0x1c, 0x7f, 0x56,
+  0x56, 0x28, 0xe8, 0x2b, 0x5c, 0x2c, 0xd3, 0x24, 0x17, 0x13, 0x72, 0xb7,
+  0xc7, 0x37, 0xa8, 0x05, 0x8f, 0x43, 0xba, 0x06, 0x3d, 0x51, 0x3d, 0x75,
+  0xc0, 0xf0, 0xc9, 0x1e, 0xe3, 0xa0, 0xb6, 0x95, 0x07, 0x87, 0xc0, 0x42,
+  0xa8, 0x1d, 0xa9, 0x2b, 0x87, 0x1f, 0x07, 0x1b, 0x52, 0x51, 0xe9, 0xdc,
+  0xad, 0x33, 0x98, 0x68, 0xcf, 0x33, 0x1b, 0x8f, 0x19, 0x6a, 0xcc, 0x14,
+  0x6c, 0x03, 0xd7, 0x80, 0xc3, 0xf1, 0xd3, 0xe9, 0x8a, 0x8e, 0x96, 0x0a,
+  0x70, 0x25, 0xc5, 0x53, 0x50, 0x02, 0xde, 0xca, 0x83, 0xed, 0x82, 0x69,
+  0x94, 0xd5, 0x36, 0xe8, 0x5d, 0xbc, 0x13, 0x57, 0xf9, 0x9b, 0xe4, 0x93,
+  0x47, 0x9b, 0x32, 0x48, 0x4d, 0xa4, 0xba, 0xec, 0x5a, 0x46, 0xbb, 0x8d,
+  0x7b, 0xcd, 0xd5, 0x96, 0x12, 0x66, 0x9a, 0x37, 0x71, 0xe0, 0x7b, 0x2e,
+  0xfb, 0x15, 0xe5, 0x37, 0x52, 0x54, 0xb6, 0x4b, 0xf3, 0xe0, 0x54, 0xf9,
+  0x30, 0xca, 0x50, 0xc5, 0x32, 0x69, 0x3c, 0xef, 0x95, 0x1d, 0xcd, 0xf0,
+  0x42, 0xda, 0xb7, 0xbe, 0x31, 0x98, 0x42, 0xe7, 0xc0, 0x0b, 0x35, 0x6d,
+  0x1d, 0x8f, 0x60, 0x95, 0x8a, 0xb3, 0xba, 0xf6, 0x28, 0x70, 0x0a, 0x02,
+  0x47, 0x8a, 0x42, 0x13, 0x06, 0xe2, 0x60, 0x56, 0x81, 0x3d, 0x1e, 0x39,
+  0x14, 0x02, 0x1e, 0xed, 0xc8, 0xf3, 0xc8, 0x68, 0x5d, 0x0b, 0x60, 0x57,
+  0xa2, 0xa3, 0x8d, 0xcc, 0x41, 0x53, 0xf8, 0x75, 0x58, 0xc8, 0xac, 0x29,
+  0x91, 0x87, 0x8c, 0x16, 0x78, 0x13, 0xf8, 0xeb, 0x66, 0x0d, 0xb4, 0xd2,
+  0x54, 0x31, 0xc3, 0x09, 0xb5, 0x33, 0xd7, 0x9a, 0xe4, 0x75, 0x6a, 0x47,
+  0xb8, 0x3a, 0x71, 0x4f, 0x66, 0x31, 0x7c, 0x01, 0xc9, 0xa0, 0x35, 0xce,
+  0x18, 0x9f, 0x64, 0xb3, 0x44, 0xd6, 0xb9, 0x4e, 0x3b, 0x91, 0x54, 0x92,
+  0x04, 0x5f, 0x25, 0x98, 0xa2, 0xf8, 0x36, 0xc5, 0x10, 0xce, 0x92, 0x4d,
+  0xbd, 0x53, 0x20, 0x2b, 0xf9, 0xa6, 0x02, 0x9b, 0x6c, 0x9b, 0x33, 0x8c,
+  0x18, 0x31, 0xf5, 0x71, 0x5d, 0x02, 0x5e, 0x4f, 0x0f, 0x0a, 0x21, 0x0f,
+  0xab, 0x63, 0x4f, 0x6a, 0xd7, 0x04, 0x52, 0x20, 0x34, 0xef, 0x8f, 0x08,
+  0x6a, 0x77, 0x42, 0x4e, 0x84, 0x33, 0x3e, 0xfb, 0xe6, 0xc0, 0xff, 0xac,
+  0xaf, 0xb1, 0xc3, 0x9d, 0xa8, 0x88, 0x06, 0x3a, 0xba, 0x69, 0x1c, 0x30,
+  0x04, 0x51, 0x4b, 0x7d, 0xa3, 0xea, 0x8c, 0x7a, 0xfa, 0x5b, 0x0e, 0x5a,
+  0x32, 0x34, 0xad, 0x3a, 0xc4, 0x9b, 0xc4, 0x77, 0x78, 0xaa, 0x44, 0x3a,
+  0x3a, 0xc8, 0x05, 0x68, 0xac, 0xa3, 0xdc, 0xe6, 0xc2, 0xf6, 0x41, 0x4c,
+  0x4b, 0xdd, 0x31, 0xd3, 0x0d, 0x58, 0x22, 0xb4, 0x54, 0xba, 0x35, 0xb1,
+  0xd7, 0xca, 0x45, 0xf7, 0x50, 0x81, 0x7c, 0x64, 0x24, 0x69, 0x01, 0xa7,
+  0x35, 0x0d, 0x50, 0x02, 0x32, 0x8b, 0x7d, 0x81, 0xad, 0x78, 0x00, 0xd0,
+  0x29, 0x12, 0x3c, 0x24, 0xfd, 0x50, 0x29, 0x1e, 0x06, 0x6f, 0x07, 0xe9,
+  0xda, 0x05, 0x67, 0x49, 0xd5, 0xa3, 0x18, 0x10, 0x81, 0xbb, 0xba, 0x53,
+  0x90, 0x1b, 0x7c, 0x66, 0xd9, 0x58, 0x9d, 0x66, 0xae, 0x7e, 0x9d, 0x38,
+  0x21, 0xbc, 0xa9, 0xa1, 0x68, 0x9b, 0xbb, 0x28, 0xbf, 0x93, 0x95, 0xc9,
+  0xfa, 0x6a, 0xff, 0xf5, 0xe5, 0x21, 0xd6, 0x4c, 0xbe, 0x8b, 0xc3, 0xea,
+  0x81, 0x6c, 0x27, 0xfa, 0xce, 0x6a, 0x00, 0xe9, 0xdf, 0xb9, 0xba, 0xdb,
+  0x67, 0xb0, 0x34, 0xfa, 0x6c, 0x6b, 0x9e, 0x44, 0x07, 0x9d, 0xcb, 0x78,
+  0xd2, 0x27, 0x18, 0x4f, 0x7e, 0x5b, 0xcc, 0xc8, 0xe2, 0x97, 0xd9, 0xc1,
+  0x2a, 0xeb, 0x53, 0xb2, 0x3d, 0x9e, 0xa4, 0x9a, 0xec, 0x6e, 0xcf, 0x44,
+  0x21, 0x0a, 0xd6, 0x8e, 0x75, 0x69, 0xf4, 0x9d, 0x93, 0x1f, 0x3c, 0x08,
+  0x95, 0xa5, 0x44, 0x07, 0xa6, 0x1b, 0xa8, 0xfa, 0x3a, 0x2a, 0x9d, 0x9b,
+  0xdf, 0x4a, 0xf8, 0xac, 0x83, 0xbf, 0x82, 0x54, 0x39, 0x73, 0x96, 0x8a,
+  0x90, 0x1b, 0x0d, 0x56, 0x2b, 0x94, 0xc9, 0x89, 0xa5, 0x30, 0xa2, 0xfb,
+  0x62, 0x4a, 0xe6, 0x50, 0x9c, 0x52, 0x85, 0x69, 0xdd, 0x31, 0x64, 0x16,
+  0xd2, 0x93, 0x60, 0x4d, 0x11, 0x58, 0x64, 0x5a, 0x8c, 0xbd, 0xfa, 0xff,
+  0xe2, 0xdd, 0xa2, 0xab, 0xa4, 0xa3, 0x2e, 0x1c, 0xc3, 0x8c, 0x89, 0xd4,
+  0x31, 0x5d, 0xca, 0x8b, 0x61, 0xc9, 0xea, 0x42, 0x3e, 0xc6, 0x36, 0x72,
+  0x35, 0x69, 0xd0, 0x6a, 0x41, 0xa7, 0x63, 0xc0, 0x90, 0x0b, 0xd9, 0x7f,
+  0x7e, 0x53, 0x8f, 0x98, 0xb7, 0x37, 0xe9, 0x54, 0x0f, 0x8d, 0xa5, 0x36,
+  0x3b, 0x4d, 0x17, 0xb3, 0x75, 0x03, 0x6f, 0xe0, 0xba, 0xaf, 0x94, 0x8d,
+  0xdc, 0x7d, 0xba, 0x11, 0x96, 0x55, 0x60, 0xcc, 0x53, 0x8a, 0x31, 0x6b,
+  0x11, 0xcb, 0xb4, 0x2c, 0xc5, 0xfd, 0x30, 0xcf, 0x13, 0xd9, 0xe0, 0x4d,
+  0x13, 0x48, 0xaf, 0xef, 0xcc, 0xec, 0x57, 0x72, 0xa6, 0xc6, 0xaf, 0x26,
+  0xc6, 0x8a, 0x97, 0xe8, 0xe9, 0x8c, 0xb1, 0x39, 0x2d, 0x16, 0xab, 0x5a,
+  0x0d, 0x4e, 0x8e, 0xca, 0x12, 0xc6, 0x60, 0xe6, 0xf9, 0x0f, 0x60, 0x98,
+  0xbf, 0x5f, 0x45, 0x9b, 0x83, 0x91, 0x01, 0xae, 0xbe, 0xb6, 0x61, 0x47,
+  0x2e, 0xd6, 0x5b, 0x35, 0xb1, 0x94, 0xa8, 0xe4, 0x6b, 0x42, 0x5a, 0x6c,
+  0xc0, 0xb7, 0xe7, 0xd8, 0x4f, 0x1e, 0x58, 0xc6, 0x6a, 0xab, 0x58, 0x0e,
+  0x78, 0x1b, 0x22, 0x2f, 0xcc, 0x7b, 0x3b, 0x72, 0x1b, 0xad, 0xbe, 0x49,
+  0xd2, 0xaa, 0xd9, 0x2a, 0xdb, 0x32, 0x6d, 0x97, 0xbb, 0x61, 0x36, 0x4e,
+  0x08, 0xd8, 0x90, 0x46, 0xcc, 0x6c, 0x3f, 0xa1, 0x9e, 0xd2, 0xc3, 0x3f,
+  0x7c, 0x99, 0x75, 0xc4, 0x68, 0xff, 0xe0, 0x21, 0xa5, 0xb6, 0xb1, 0x3c,
+  0x1a, 0x8d, 0xb1, 0x26, 0x5b, 0x6b, 0xd7, 0x67, 0x0b, 0x68, 0xa1, 0x4a,
+  0x6e, 0x24, 0xa3, 0xb3, 0xc6, 0x24, 0xe6, 0xb0, 0x51, 0xd5, 0x74, 0x5c,
+  0xe1, 0x4b, 0xb7, 0x7f, 0xfd, 0xf7, 0xe6, 0x31, 0x71, 0xd9, 0xdc, 0x66,
+  0xb6, 0x56, 0xc7, 0x97, 0x01, 0x01, 0xb4, 0x13, 0x09, 0xac, 0xb5, 0x44,
+  0x06, 0xfb, 0x05, 0x43, 0x18, 0xad, 0x66, 0x56, 0x23, 0x08, 0x9c, 0x98,
+  0x26, 0x70, 0x34, 0x85, 0xfa, 0x6d, 0x10, 0xb3, 0x2c, 0xb6, 0x9f, 0x8b,
+  0xeb, 0x06, 0x1b, 0x19, 0x2c, 0xb6, 0x8a, 0xb7, 0xe0, 0x99, 0x73, 0x08,
+  0xea, 0x36, 0x0f, 0x1a, 0x0b, 0xd8, 0xf6, 0xc3, 0x71, 0xb6, 0x72, 0x90,
+  0x46, 0xc1, 0x68, 0xd2, 0xcb, 0xb1, 0xa5, 0x48, 0x4b, 0x35, 0xd3, 0x36,
+  0xaa, 0x67, 0x0d, 0x48, 0xb2, 0xc1, 0xa0, 0xa3, 0xf4, 0x0f, 0x77, 0x4e,
+  0x77, 0x26, 0xb0, 0xe7, 0xf3, 0xe1, 0x9b, 0xbc, 0x5d, 0xe8, 0x19, 0x96,
+  0x4d, 0x55, 0x2a, 0x3c, 0x6f, 0xb7, 0xfd, 0xe3, 0x0a, 0xc6, 0x3c, 0x1a,
+  0x4f, 0xd0, 0xbe, 0x5d, 0x16, 0x5c, 0xca, 0xaf, 0xdd, 0x78, 0x2f, 0x23,
+  0x3a, 0xaa, 0xf2, 0xf0, 0x8d, 0x41, 0x31, 0x4d, 0x10, 0xdc, 0x0c, 0x37,
+  0xc7, 0x29, 0x52, 0x0b, 0x30, 0x47, 0xce, 0xdb, 0x6b, 0xbe, 0xfb, 0xde,
+  0x42, 0x00, 0x70, 0x5b, 0xbf, 0x3f, 0xa5, 0xdb, 0x66, 0x22, 0xb8, 0x81,
+  0xc7, 0x62, 0x7a, 0xe1, 0x0a, 0x8c, 0x95, 0xe5, 0x5d, 0x70, 0xa1, 0xa8,
+  0x4b, 0xf7, 0xa2, 0x74, 0x51, 0x75, 0x29, 0x4d, 0xd4, 0x91, 0xaa, 0x53,
+  0x64, 0xcc, 0x97, 0xf7, 0xfe, 0x9d, 0x9e, 0x09, 0x68, 0x98, 0x2d, 0xb3,
+  0x18, 0x4b, 0x0f, 0xe8, 0xd5, 0x21, 0x41, 0xc5, 0xec, 0x25, 0xc4, 0xf3,
+  0xa9, 0xe4, 0xce, 0xff, 0xc6, 0x47, 0xdb, 0xd4, 0x90, 0xcd, 0x1c, 0xe5,
+  0x83, 0xb5, 0xd3, 0x59, 0x68, 0x02, 0xc9, 0x3d, 0xd5, 0xa2, 0x34, 0xf0,
+  0xc1, 0x13, 0x52, 0xb2, 0xbb, 0xdb, 0xa1, 0xa6, 0x37, 0x81, 0xe3, 0x77,
+  0xd0, 0xa3, 0x56, 0x1e, 0xe1, 0x7e, 0xff, 0x61, 0x23, 0xe1, 0xd9, 0xfd,
+  0xbe, 0x8b, 0xc8, 0x7e, 0x11, 0x5e, 0x84, 0x4c, 0xa0, 0x2c, 0x65, 0xd4,
+  0x6e, 0x0f, 0xc4, 0x9b, 0x4e, 0xbe, 0xae, 0x2f, 0x65, 0x81, 0xe9, 0x60,
+  0x5e, 0x1a, 0x71, 0x12, 0x65, 0x81, 0xde, 0xbc, 0xeb, 0xdf, 0xe9, 0xd3,
+  0xaa, 0x5f, 0x91, 0x3c, 0x49, 0x90, 0xd2, 0xf9, 0xeb, 0xdc, 0xa0, 0x7c,
+  0xe0, 0x7b, 0x5f, 0x1a, 0xaa, 0x83, 0xca, 0x32, 0x59, 0xb1, 0x0f, 0xa5,
+  0xf1, 0xc6, 0xe8, 0x9a, 0x48, 0x55, 0xff, 0x2b, 0x50, 0x61, 0x5b, 0x40,
+  0x85, 0x95, 0x38, 0xce, 0x3e, 0x54, 0xbe, 0x32, 0x55, 0xcb, 0xec, 0xb1,
+  0x82, 0x7b, 0xf9, 0x9c, 0x47, 0x30, 0x75, 0xa1, 0x5b, 0xe3, 0x90, 0x07,
+  0x42, 0x5e, 0x2a, 0x42, 0x81, 0x2f, 0xa5, 0x2a, 0x81, 0x30, 0x0c, 0xa4,
+  0x3a, 0x89, 0x38, 0xda, 0x59, 0x9f, 0x19, 0xc0, 0x40, 0xb6, 0x10, 0x5b,
+  0x7b, 0x81, 0x33, 0x4c, 0x00, 0x26, 0xc2, 0xb7, 0x8b, 0x51, 0xd4, 0x48,
+  0xa9, 0x94, 0xe3, 0xa9, 0xb3, 0x02, 0x35, 0xc5, 0x9e, 0x87, 0x84, 0xba,
+  0x05, 0x8d, 0xd5, 0xbd, 0x3b, 0xfd, 0x6f, 0xcb, 0x61, 0xcf, 0x85, 0xd2,
+  0xd2, 0xab, 0x91, 0x4d, 0x6c, 0x1d, 0x39, 0x93, 0x83, 0xae, 0xbd, 0xdd,
+  0x88, 0x87, 0x9a, 0xc2, 0x3a, 0xb0, 0xdb, 0xb5, 0xb9, 0x85, 0xb1, 0x79,
+  0xf7, 0xd7, 0x4d, 0x90, 0x68, 0x47, 0x94, 0xbb, 0x81, 0xf6, 0xd7, 0xb3,
+  0xb2, 0x63, 0x20, 0x4e, 0xc5, 0xcb, 0xdc, 0x30, 0xaa, 0x48, 0xd4, 0x34,
+  0x47, 0xbc, 0x29, 0xc5, 0x2e, 0x0c, 0x62, 0x72, 0xe3, 0xb1, 0xd3, 0x28,
+  0x2f, 0x8e, 0x0f, 0x89, 0xaf, 0xaf, 0xa2, 0x48, 0x43, 0x03, 0xa2, 0xb2,
+  0x2c, 0xe3, 0x5b, 0xa3, 0x01, 0x12, 0xe6, 0xda, 0x53, 0xf7, 0x3e, 0x8d,
+  0xcf, 0x23, 0xe6, 0x4f, 0xa9, 0xa2, 0x9f, 0x0a, 0x64, 0x7b, 0xe6, 0xfe,
+  0x9c, 0xe6, 0x6b, 0x52, 0xf1, 0x3a, 0xc5, 0xbf, 0xcd, 0xfc, 0xd1, 0xef,
+  0x13, 0xcd, 0x13, 0x96, 0x06, 0xbd, 0x17, 0x97, 0x22, 0xd3, 0x42, 0xad,
+  0xf2, 0xb9, 0xaf, 0xdd, 0xa0, 0xdc, 0x46, 0xec, 0x44, 0x43, 0x37, 0x55,
+  0xcd, 0xe0, 0x56, 0xea, 0xe8, 0x06, 0x0c, 0x8b, 0xba, 0x70, 0x33, 0x81,
+  0x24, 0x51, 0x47, 0xda, 0x4f, 0xa6, 0xea, 0x5d, 0x79, 0x70, 0x01, 0x22,
+  0xad, 0xc2, 0x7e, 0xf8, 0x61, 0x71, 0xe8, 0x90, 0xbf, 0xa2, 0xa1, 0x67,
+  0xdc, 0xf3, 0xf6, 0x2c, 0x56, 0x91, 0x09, 0x78, 0x6b, 0xe7, 0x86, 0xcb,
+  0x77, 0x5b, 0x23, 0x12, 0xf6, 0xc9, 0xd7, 0x7a, 0x0b, 0x9d, 0x24, 0x4d,
+  0xbd, 0xf5, 0xb4, 0xe2, 0x9e, 0x5d, 0xe2, 0xd2, 0x7e, 0xd1, 0xf1, 0x1f,
+  0xae, 0xf9, 0x2a, 0x58, 0x4d, 0x91, 0xb2, 0x38, 0xa2, 0x9e, 0x04, 0x4d,
+  0xc8, 0xd5, 0xea, 0x3e, 0xee, 0x84, 0x24, 0xf7, 0x3a, 0x11, 0x64, 0xf6,
+  0x34, 0x68, 0x73, 0x1f, 0xb7, 0x89, 0xc6, 0xab, 0x9d, 0x24, 0x43, 0x80,
+  0x49, 0x16, 0x4f, 0xa7, 0x7b, 0xea, 0x29, 0xf8, 0x1b, 0x79, 0x0c, 0x53,
+  0xed, 0xd2, 0x2e, 0x9c, 0x12, 0x8a, 0x90, 0x3b, 0x0e, 0xfc, 0x42, 0x1b,
+  0xca, 0x7d, 0x82, 0x8c, 0x9b, 0x04, 0x02, 0xf3, 0x74, 0x3c, 0x2b, 0x84,
+  0x4f, 0x4e, 0x1c, 0xf0, 0xb6, 0xea, 0x3a, 0xab, 0x2f, 0xba, 0xd9, 0x7e,
+  0xcd, 0x95, 0x97, 0x82, 0x5c, 0x54, 0xa9, 0x85, 0x08, 0xdd, 0xec, 0x1d,
+  0x3e, 0x2f, 0x51, 0xb4, 0x32, 0xd7, 0x54, 0x01, 0xdc, 0x32, 0xf8, 0xd8,
+  0x1a, 0x10, 0x45, 0x5f, 0x33, 0x4f, 0x73, 0x8f, 0xf5, 0x20, 0x84, 0xe3,
+  0x67, 0x79, 0xb3, 0x33, 0x0b, 0x2b, 0x83, 0xc2, 0x3c, 0x47, 0x46, 0x81,
+  0x45, 0x6e, 0xc0, 0x11, 0xec, 0x4c, 0x8d, 0xf3, 0xb5, 0xa2, 0x95, 0x73,
+  0xbf, 0xfa, 0xb8, 0x1a, 0x6c, 0x8f, 0x78, 0x35, 0x48, 0xd4, 0xfb, 0x58,
+  0x58, 0xd1, 0x89, 0xfd, 0xe3, 0xc1, 0xb4, 0xed, 0x87, 0xa4, 0x74, 0xe7,
+  0x2b, 0x85, 0x3a, 0xef, 0x08, 0xf5, 0xe7, 0xb7, 0xcb, 0xb2, 0x0f, 0xb4,
+  0xe5, 0x9b, 0x09, 0xcd, 0x7e, 0x26, 0x10, 0xaf, 0x1b, 0xb3, 0xf7, 0xc1,
+  0x10, 0xfe, 0xcb, 0x53, 0x51, 0xb0, 0xd6, 0xab, 0xe7, 0x93, 0x6e, 0x0b,
+  0x90, 0xd2, 0xf6, 0x71, 0x4c, 0x4a, 0xca, 0x66, 0xc6, 0x72, 0x2d, 0xa4,
+  0x4c, 0x93, 0xa1, 0xff, 0xec, 0x32, 0x14, 0xdc, 0x88, 0xe5, 0x0d, 0xf2,
+  0x57, 0x54, 0x43, 0x9b, 0x1e, 0xc8, 0xe5, 0x00, 0x43, 0x75, 0x0e, 0xfb,
+  0x34, 0xb8, 0x1c, 0x73, 0xf8, 0xdf, 0x64, 0x9e, 0x3d, 0x69, 0x2f, 0x8a,
+  0xb7, 0xf4, 0xf2, 0x5a, 0xd8, 0x7f, 0xbf, 0x84, 0x6c, 0xb9, 0x42, 0xe4,
+  0x17, 0x0a, 0x42, 0x27, 0x3a, 0xb0, 0x92, 0x91, 0xaf, 0xb1, 0x3a, 0x13,
+  0x4f, 0x71, 0xfe, 0x7e, 0x22, 0xcc, 0x56, 0x09, 0x86, 0xb8, 0x95, 0x96,
+  0x1e, 0x4e, 0x7c, 0x1b, 0xe6, 0x6f, 0x65, 0x8f, 0x35, 0x54, 0xbf, 0x90,
+  0xf2, 0x5a, 0xbf, 0xba, 0xc5, 0x8c, 0x77, 0x4b, 0xab, 0xa3, 0xf4, 0x97,
+  0x95, 0x5b, 0x4b, 0x32, 0x67, 0x5f, 0x40, 0xef, 0x4d, 0xf2, 0xb6, 0x63,
+  0xdf, 0x24, 0xfb, 0x24, 0x5a, 0xb5, 0xc7, 0x95, 0xe2, 0x61, 0x55, 0xe1,
+  0x5f, 0xbc, 0xa5, 0xd5, 0x41, 0x12, 0x3f, 0x6f, 0x77, 0x4c, 0xf0, 0x3b,
+  0x35, 0x02, 0xd3, 0x64, 0x93, 0x02, 0x02, 0xbd, 0x2e, 0x90, 0x39, 0x42,
+  0x3a, 0xca, 0x08, 0xd8, 0x2a, 0x1b, 0x3c, 0x93, 0xa0, 0x39, 0x44, 0x7e,
+  0xce, 0xbe, 0x03, 0xc7, 0xe0, 0xbe, 0x7a, 0xa9, 0x40, 0x20, 0xd5, 0x44,
+  0x07, 0xdf, 0x8a, 0x32, 0xd5, 0xdc, 0xd6, 0x62, 0xa0, 0x1a, 0x78, 0x80,
+  0x87, 0x42, 0xaf, 0xfd, 0x34, 0x7c, 0x10, 0x5d, 0xae, 0x57, 0x3a, 0xa6,
+  0xa1, 0x8f, 0xfb, 0x90, 0x69, 0x86, 0x0a, 0x46, 0x30, 0xa7, 0x31, 0x29,
+  0xa6, 0x97, 0xe3, 0xb1, 0xc8, 0x40, 0x03, 0x1e, 0xd1, 0x98, 0xef, 0x17,
+  0x64, 0x92, 0x56, 0x3b, 0x89, 0xfe, 0x31, 0x9e, 0xd6, 0xec, 0x34, 0x8a,
+  0x5a, 0x31, 0x65, 0x87, 0xc7, 0xc6, 0x92, 0x22, 0xfa, 0x31, 0xe2, 0x4b,
+  0xb0, 0x3c, 0xaf, 0x9c, 0x6a, 0x05, 0xfd, 0xe2, 0xa3, 0x19, 0xa6, 0x1c,
+  0x1c, 0xa1, 0xd6, 0x73, 0xc9, 0x0d, 0xe4, 0x41, 0x3d, 0x61, 0x8a, 0xff,
+  0x69, 0x00, 0xbf, 0x43, 0xa1, 0xf4, 0x6f, 0xe6, 0x4f, 0x49, 0x99, 0x4b,
+  0x35, 0x73, 0xef, 0x3a, 0x25, 0x68, 0x78, 0x1e, 0xcc, 0xee, 0x92, 0xad,
+  0x63, 0x0d, 0x7e, 0x24, 0x9a, 0x7d, 0xb0, 0x52, 0x3b, 0xbf, 0x93, 0x0c,
+  0x5d, 0xc9, 0xb5, 0xef, 0x83, 0x91, 0x4d, 0x52, 0x51, 0x95, 0x6b, 0x49,
+  0x8c, 0xde, 0x02, 0xf3, 0x62, 0x72, 0xe6, 0xb5, 0x5e, 0xe0, 0x56, 0xec,
+  0x28, 0x30, 0x7f, 0x58, 0x67, 0x06, 0x93, 0x44, 0x90, 0x67, 0x35, 0xad,
+  0xbf, 0xfe, 0x21, 0xb0, 0x9c, 0xdf, 0x5d, 0x8c, 0xb6, 0x22, 0x66, 0x3c,
+  0x4d, 0x68, 0x4b, 0x26, 0x65, 0x9f, 0x72, 0x2b, 0x23, 0x3a, 0x93, 0xc4,
+  0x3f, 0xe6, 0x55, 0xb7, 0x74, 0x93, 0x55, 0x36, 0x34, 0xbe, 0x1e, 0xdd,
+  0xdd, 0xb5, 0xc5, 0xc6, 0x92, 0x45, 0xe8, 0x2e, 0x83, 0x44, 0x55, 0x4d,
+  0x3c, 0xdc, 0xd6, 0x25, 0x51, 0xda, 0x3b, 0xbf, 0x2a, 0x8b, 0x1d, 0x35,
+  0x44, 0x7c, 0xe8, 0xa0, 0xb8, 0x2d, 0x1c, 0xf1, 0x26, 0x96, 0x6e, 0x28,
+  0x30, 0xcd, 0xc7, 0xda, 0x4d, 0x36, 0x86, 0x5e, 0x77, 0xe6, 0xa5, 0x81,
+  0x0c, 0x20, 0x10, 0x63, 0xcd, 0x52, 0xd4, 0x42, 0x31, 0x72, 0x3c, 0x63,
+  0x57, 0xf6, 0xf7, 0x82, 0x2b, 0x3b, 0xce, 0xf4, 0x15, 0x93, 0xfd, 0x94,
+  0x45, 0xe9, 0xa1, 0x70, 0x84, 0x9a, 0x39, 0x0d, 0xd4, 0xb3, 0x3d, 0x2d,
+  0x8d, 0xc2, 0x75, 0xdb, 0xc1, 0x36, 0xde, 0x89, 0x17, 0xc0, 0xf6, 0x11,
+  0xe8, 0xb3, 0x05, 0xbf, 0xed, 0xef, 0xe2, 0xa8, 0x60, 0xb8, 0xec, 0x1c,
+  0xb8, 0x63, 0x63, 0x58, 0x27, 0x0c, 0x59, 0x3c, 0xec, 0x2d, 0x89, 0x0f,
+  0x7e, 0xea, 0x2c, 0xb9, 0x46, 0xe2, 0x29, 0xac, 0x47, 0x90, 0xb0, 0x5c,
+  0xac, 0xbe, 0x99, 0x36, 0x8a, 0xf1, 0xa7, 0xcf, 0xbc, 0x50, 0xbc, 0xd1,
+  0xaf, 0xcf, 0x55, 0x24, 0xc8, 0x0c, 0x4c, 0x24, 0x1d, 0x8b, 0x44, 0xdf,
+  0x22, 0xaf, 0x2a, 0xb9, 0x4a, 0xf4, 0x2a, 0xab, 0x7c, 0x20, 0x18, 0xcf,
+  0x04, 0x87, 0x74, 0x00, 0x2d, 0x2b, 0x1c, 0x09, 0xa5, 0x57, 0x22, 0xde,
+  0x17, 0xe8, 0xab, 0x0e, 0x62, 0xd4, 0xe6, 0x21, 0x6f, 0x0d, 0x05, 0x8f,
+  0x3e, 0x68, 0xe6, 0xe6, 0xfa, 0xde, 0x16, 0x54, 0xfd, 0x61, 0xdc, 0x6a,
+  0x6d, 0xfc, 0xd1, 0x8a, 0x1d, 0x58, 0x6f, 0x17, 0xb2, 0x2b, 0xf6, 0x18,
+  0x8d, 0x7c, 0x41, 0x07, 0x9a, 0x35, 0xef, 0xd7, 0xb5, 0x11, 0x5a, 0x87,
+  0x1b, 0x26, 0x33, 0x36, 0x26, 0xc5, 0x1a, 0xda, 0xd7, 0x94, 0xe4, 0xbb,
+  0x70, 0x8d, 0x50, 0xeb, 0xda, 0x1b, 0x2d, 0x83, 0x8d, 0xdc, 0x5f, 0xf5,
+  0xe0, 0x63, 0xf0, 0x09, 0xc6, 0x06, 0x40, 0xf5, 0xb9, 0xc9, 0x38, 0xc9,
+  0x1e, 0x46, 0x3a, 0xcb, 0xfa, 0x41, 0x24, 0x56, 0x3d, 0xa9, 0x1c, 0xee,
+  0xf8, 0xf4, 0xb5, 0x81, 0xfd, 0x3f, 0x56, 0xee, 0x1f, 0xab, 0x1c, 0x9a,
+  0xd3, 0xbb, 0x61, 0x9c, 0xb8, 0xec, 0x3d, 0x11, 0x6b, 0x34, 0xf1, 0xfa,
+  0xf4, 0x8f, 0x68, 0xe4, 0xbd, 0xc6, 0x45, 0x77, 0x4d, 0x03, 0xa7, 0x6e,
+  0x09, 0x6e, 0x09, 0x95, 0xa6, 0x99, 0xc0, 0x6f, 0xa9, 0xa7, 0x92, 0x59,
+  0xba, 0x15, 0x9d, 0xe3, 0xdf, 0x88, 0x54, 0x80, 0xcc, 0x00, 0x47, 0x34,
+  0x03, 0xce, 0xe3, 0xe0, 0xf1, 0xa2, 0xee, 0x6f, 0x03, 0x9d, 0x5c, 0x55,
+  0xae, 0xe3, 0x55, 0xff, 0x0b, 0xb8, 0xe2, 0x79, 0x53, 0x80, 0xa9, 0xb1,
+  0xa8, 0xbf, 0xed, 0xb6, 0x63, 0x4a, 0x86, 0xd5, 0x49, 0x7f, 0x72, 0x59,
+  0xd0, 0x01, 0x3d, 0x96, 0x59, 0x59, 0x54, 0xc7, 0x2f, 0x80, 0x5a, 0x3c,
+  0xe8, 0x3a, 0xa7, 0xb9, 0xb8, 0xe3, 0xdc, 0x11, 0xd6, 0x31, 0xf8, 0x06,
+  0xae, 0xa6, 0x96, 0x7d, 0xce, 0x4b, 0x05, 0x16, 0xbb, 0x81, 0xae, 0x96,
+  0x03, 0x77, 0x94, 0xcd, 0xcd, 0x4b, 0xf5, 0x09, 0xf9, 0x07, 0x23, 0x9b,
+  0x95, 0x46, 0x0e, 0x20, 0xd1, 0x2c, 0x9a, 0xa5, 0xa1, 0x25, 0x61, 0xe2,
+  0x06, 0x48, 0x9b, 0x00, 0x21, 0x91, 0x0d, 0x91, 0xfe, 0xf5, 0x25, 0xe9,
+  0x55, 0x75, 0x1f, 0x3e, 0x06, 0x78, 0x2a, 0xe5, 0x69, 0xf3, 0xb6, 0x73,
+  0xb8, 0xc5, 0x54, 0x59, 0x28, 0x83, 0xe6, 0xe9, 0xef, 0x45, 0x95, 0xae,
+  0xca, 0x30, 0x8b, 0x81, 0xbd, 0xc6, 0x54, 0xa7, 0xaf, 0xc6, 0x0f, 0xa7,
+  0x23, 0x75, 0x22, 0xbd, 0xeb, 0xf2, 0x43, 0x0c, 0xa7, 0x80, 0xbc, 0xbf,
+  0x71, 0xfc, 0x3a, 0xfc, 0xa7, 0xad, 0x6e, 0x35, 0xd7, 0x9f, 0x42, 0x9b,
+  0x0a, 0x27, 0x88, 0x41, 0x2f, 0x02, 0xb1, 0x99, 0x6f, 0x90, 0xea, 0xff,
+  0x62, 0x8c, 0x54, 0xf9, 0x09, 0xc3, 0xdf, 0x4f, 0x1f, 0xd3, 0xec, 0x86,
+  0xf5, 0x59, 0xdf, 0x5d, 0x71, 0xcc, 0xe0, 0xdb, 0x55, 0x5a, 0x74, 0x73,
+  0x20, 0x57, 0x59, 0xe7, 0x8f, 0x99, 0x17, 0x22, 0xc9, 0x4d, 0x00, 0x02,
+  0x50, 0x73, 0x35, 0x57, 0x97, 0xc6, 0x67, 0x79, 0xf9, 0xa6, 0x14, 0xec,
+  0x77, 0x84, 0x70, 0xc1, 0xc3, 0xc0, 0x4e, 0xf4, 0x34, 0x12, 0xb1, 0x1b,
+  0x88, 0xc5, 0x1b, 0xb3, 0x98, 0x5e, 0xfe, 0xce, 0xdf, 0x67, 0x4e, 0x8a,
+  0x5f, 0x30, 0x85, 0xbc, 0x23, 0x88, 0x36, 0xa9, 0xaf, 0x7b, 0x2f, 0x59,
+  0x5b, 0x28, 0x0f, 0xc9, 0xd5, 0x08, 0xa3, 0x7f, 0x15, 0xb6, 0xb6, 0xc3,
+  0x83, 0x05, 0xa1, 0x9b, 0x78, 0xb3, 0xce, 0xae, 0x11, 0xdc, 0x1c, 0xfa,
+  0xc8, 0x1f, 0xc2, 0xf2, 0x6b, 0xfb, 0xe4, 0xfa, 0x9f, 0x1b, 0x57, 0x85,
+  0x3f, 0x4e, 0x36, 0xf5, 0xd7, 0xa1, 0xfa, 0xe2, 0x39, 0xf5, 0xce, 0xd1,
+  0x6e, 0x8d, 0xec, 0x67, 0xb4, 0x2a, 0x55, 0x5b, 0x84, 0x94, 0x00, 0xa9,
+  0x3f, 0xbe, 0x65, 0x1f, 0x2d, 0x8b, 0x91, 0x32, 0x90, 0x8e, 0x9b, 0x2c,
+  0x4c, 0x71, 0xe8, 0x27, 0x15, 0xe5, 0xdc, 0x58, 0xf0, 0x38, 0x82, 0x67,
+  0x39, 0x49, 0xe5, 0x8c, 0x9c, 0x8c, 0x36, 0x32, 0x8f, 0x9a, 0x1a, 0xb2,
+  0x29, 0xaf, 0xee, 0x91, 0xf1, 0x4d, 0x49, 0x75, 0x66, 0x3c, 0xeb, 0x4b,
+  0x77, 0xf0, 0x2c, 0xcb, 0x96, 0x8b, 0xa8, 0x07, 0xa6, 0x21, 0xda, 0x51,
+  0xe8, 0x5e, 0x98, 0x03, 0x8c, 0x39, 0x72, 0xfb, 0xe0, 0xea, 0x8c, 0xc2,
+  0x8e, 0x2d, 0x1b, 0x6f, 0x14, 0x4f, 0xb9, 0x00, 0x94, 0x1d, 0x1e, 0xe3,
+  0x66, 0x20, 0xa0, 0xda, 0x0d, 0x2e, 0x48, 0xa6, 0x6a, 0xcb, 0xa9, 0xc7,
+  0xe4, 0xd2, 0x8e, 0x99, 0xc0, 0xc3, 0xd9, 0x1f, 0x7d, 0xa4, 0xe0, 0x39,
+  0xec, 0x1f, 0xa9, 0xd6, 0xeb, 0x8c, 0x4b, 0xa1, 0xf8, 0x9c, 0xd7, 0x59,
+  0x5c, 0xaa, 0x68, 0x40, 0x18, 0x22, 0x84, 0xfa, 0x57, 0xd5, 0xf1, 0x36,
+  0x8c, 0x5a, 0xde, 0x9d, 0x5d, 0xb1, 0x39, 0xf7, 0x08, 0x69, 0x88, 0x3b,
+  0x27, 0xe9, 0x4b, 0x44, 0x07, 0x7b, 0x2d, 0x17, 0x70, 0x2f, 0xe0, 0x9e,
+  0x2f, 0x90, 0x93, 0x55, 0xf9, 0x21, 0x2c, 0xc8, 0xcf, 0xce, 0x7b, 0x37,
+  0xf8, 0x79, 0x25, 0x5f, 0xef, 0xf1, 0x63, 0x7d, 0x2d, 0xaa, 0xf2, 0x93,
+  0xe1, 0x1b, 0x87, 0xcc, 0xb3, 0xec, 0xc9, 0x73, 0x17, 0x94, 0xc6, 0x19,
+  0x56, 0xd9, 0x7e, 0xaf, 0xc5, 0x6f, 0x22, 0xce, 0x61, 0x6b, 0x78, 0xe0,
+  0xf1, 0x0e, 0x79, 0x42, 0x41, 0x62, 0xe9, 0x83, 0xf9, 0xeb, 0xa9, 0xb9,
+  0x0b, 0xa7, 0xe5, 0x59, 0xe8, 0xd0, 0x51, 0xac, 0xf7, 0x37, 0x88, 0x69,
+  0x06, 0x58, 0x01, 0x77, 0xa1, 0xc9, 0x0d, 0x7d, 0xa2, 0x84, 0x88, 0xe7,
+  0xa8, 0x37, 0x2b, 0xe8, 0x1b, 0x0a, 0xd4, 0x8f, 0x0d, 0xd9, 0xa4, 0xec,
+  0xf5, 0xbf, 0x6d, 0x68, 0x3c, 0x4c, 0x36, 0x5f, 0x0c, 0xc2, 0x52, 0x6f,
+  0x1a, 0x27, 0xb8, 0x59, 0x80, 0xc0, 0xec, 0xd1, 0x1d, 0x6e, 0x39, 0x98,
+  0x35, 0x71, 0x1e, 0xbc, 0x86, 0x3b, 0xf7, 0xaf, 0x9c, 0xa2, 0x65, 0x50,
+  0x88, 0x8c, 0xae, 0xde, 0x56, 0xf7, 0x68, 0x66, 0x8d, 0x9e, 0x28, 0x1e,
+  0x5c, 0x79, 0xfa, 0x05, 0x8a, 0x75, 0x05, 0xcd, 0x3e, 0x3c, 0xd1, 0xa9,
+  0xe9, 0xbe, 0xc2, 0x11, 0xea, 0x6c, 0xb1, 0xc8, 0x75, 0x1c, 0x9e, 0xde,
+  0xaa, 0xda, 0x5a, 0x5b, 0x19, 0xc6, 0x96, 0x0f, 0x75, 0xa6, 0xa6, 0x59,
+  0x73, 0xb1, 0x62, 0x65, 0x43, 0xe1, 0x7e, 0xfc, 0x78, 0x58, 0x1c, 0xe3,
+  0x96, 0x0f, 0x68, 0x91, 0x14, 0x28, 0x02, 0xae, 0x81, 0xc1, 0x03, 0x21,
+  0x95, 0x3b, 0x16, 0xa1, 0x14, 0x25, 0x57, 0x5d, 0x83, 0xba, 0x9d, 0xd1,
+  0xca, 0x61, 0x6f, 0x5a, 0xf9, 0x2e, 0x5f, 0x28, 0x95, 0x0b, 0x53, 0xf4,
+  0xaa, 0x5c, 0xfd, 0xac, 0x2e, 0xba, 0x99, 0x42, 0xa3, 0xf3, 0x66, 0xff,
+  0x01, 0x1c, 0xde, 0xaf, 0xd4, 0xdd, 0xab, 0x6a, 0x93, 0x3f, 0x48, 0x67,
+  0x18, 0x64, 0x07, 0xfa, 0x54, 0x3f, 0x40, 0x57, 0x27, 0x10, 0xbd, 0xcb,
+  0xda, 0x1f, 0x23, 0x84, 0x6e, 0xca, 0xbc, 0x0e, 0x3b, 0xd1, 0x2d, 0xbf,
+  0x48, 0xb1, 0x8c, 0x70, 0x5e, 0xb1, 0xab, 0x5f, 0x73, 0xd8, 0xbc, 0xeb,
+  0xdc, 0xb7, 0x15, 0x52, 0x03, 0xe6, 0x25, 0xba, 0x49, 0x84, 0xf0, 0xe0,
+  0xca, 0xbc, 0x28, 0x8c, 0x57, 0x5a, 0x5c, 0x6d, 0x7c, 0x2c, 0x0b, 0xcc,
+  0x65, 0xbe, 0xa8, 0xe3, 0x6f, 0x88, 0xa1, 0x96, 0x2b, 0x18, 0x95, 0x72,
+  0x51, 0xc0, 0x5e, 0xa1, 0x34, 0xdf, 0xca, 0x59, 0xb8, 0x36, 0x8e, 0x3b,
+  0x1d, 0xe4, 0x8b, 0x88, 0xff, 0x5f, 0x08, 0x3e, 0xd5, 0x7d, 0x8d, 0xbd,
+  0xf9, 0x7f, 0xfa, 0xbe, 0x2c, 0xe7, 0x15, 0xda, 0xdc, 0x6e, 0xf8, 0xce,
+  0xfd, 0x2f, 0x75, 0x13, 0x72, 0xdc, 0x92, 0xb1, 0xb7, 0xe8, 0xa3, 0x57,
+  0xe4, 0xae, 0x66, 0x30, 0xd4, 0x2d, 0x5a, 0xaa, 0x20, 0x70, 0x99, 0xdf,
+  0xb3, 0x19, 0xb7, 0x42, 0x99, 0xd7, 0xf2, 0x84, 0x5a, 0x3e, 0xc1, 0x97,
+  0xc6, 0x13, 0xe5, 0xd6, 0x34, 0x85, 0x47, 0x28, 0xd5, 0x3d, 0x5f, 0x4e,
+  0xf7, 0xc6, 0xc1, 0x1a, 0xf1, 0x38, 0xbc, 0xbe, 0xdb, 0xe8, 0xc9, 0x26,
+  0xeb, 0xbc, 0x9a, 0x6e, 0xd7, 0xfa, 0xbb, 0xb5, 0x90, 0x0a, 0xc6, 0x8e,
+  0x22, 0xf6, 0xa6, 0x27, 0x40, 0xd8, 0xa6, 0x6b, 0x01, 0x83, 0xca, 0xee,
+  0x29, 0x4d, 0xbc, 0xc3, 0xdf, 0x81, 0x63, 0x65, 0x93, 0x81, 0xb3, 0x31,
+  0xde, 0x7c, 0x8c, 0xa3, 0xe5, 0x15, 0x77, 0xb8, 0x67, 0x87, 0xb8, 0xdb,
+  0x5f, 0x15, 0x8d, 0xe1, 0x40, 0x44, 0xb1, 0x5f, 0x5b, 0xac, 0xfe, 0x00,
+  0x60, 0x6f, 0x4e, 0x99, 0x23, 0x03, 0x63, 0x45, 0x49, 0xdb, 0xb2, 0x08,
+  0xa1, 0x43, 0x5e, 0xc5, 0x46, 0x43, 0x83, 0xd8, 0xfd, 0x75, 0x84, 0x21,
+  0x84, 0xf5, 0xaa, 0x43, 0xd0, 0x0e, 0x2f, 0x27, 0x6a, 0xa4, 0xff, 0x2b,
+  0x36, 0xb5, 0xd2, 0x45, 0x11, 0x8f, 0x7b, 0x78, 0x82, 0x08, 0x0f, 0xf7,
+  0xd1, 0xf0, 0x5d, 0x37, 0xf2, 0x8f, 0x7e, 0x92, 0x46, 0xf5, 0x39, 0xa5,
+  0x46, 0x8d, 0xe0, 0xd7, 0x47, 0xb5, 0xef, 0x35, 0x02, 0x22, 0x94, 0x67,
+  0x37, 0x74, 0x59, 0xe7, 0xe5, 0xf8, 0x83, 0x9b, 0x98, 0x5f, 0xbd, 0x59,
+  0x10, 0x5c, 0x43, 0x07, 0x64, 0xe6, 0x7d, 0x2a, 0x53, 0x2c, 0x30, 0x4f,
+  0x28, 0x29, 0x37, 0x41, 0x9b, 0xc3, 0xf0, 0x2f, 0x2b, 0xf3, 0x65, 0x6d,
+  0xf5, 0x46, 0x7c, 0x4c, 0xaf, 0x88, 0x63, 0xbd, 0x3a, 0x60, 0xae, 0x5c,
+  0x6b, 0xd5, 0x5b, 0x87, 0xa7, 0xe2, 0xe8, 0x49, 0x2c, 0x17, 0xfd, 0xae,
+  0x49, 0xd8, 0x43, 0xf1, 0xae, 0xb9, 0xa4, 0xa6, 0xb9, 0x5d, 0x2f, 0x54,
+  0x69, 0x64, 0x4e, 0x86, 0x3e, 0xfc, 0xc0, 0x80, 0x37, 0xf8, 0xca, 0x6a,
+  0x1f, 0x1b, 0x4a, 0x52, 0x70, 0xda, 0x4d, 0xea, 0xde, 0x00, 0xa8, 0xb4,
+  0x2e, 0x54, 0x92, 0x26, 0x53, 0x80, 0x71, 0xa3, 0xee, 0xd1, 0xea, 0x91,
+  0x82, 0xf5, 0x92, 0xba, 0x6b, 0x45, 0x9c, 0x7c, 0x0c, 0x58, 0x9d, 0xd5,
+  0xb5, 0x13, 0xf1, 0x19, 0xd4, 0x80, 0xd1, 0x4f, 0x8d, 0x73, 0xda, 0xeb,
+  0x4f, 0x0b, 0x6f, 0x01, 0x5c, 0x09, 0x32, 0x8e, 0xee, 0x57, 0xd3, 0x87,
+  0x1d, 0x8f, 0x2b, 0x2e, 0xee, 0x22, 0x55, 0x2a, 0xda, 0x68, 0x2c, 0x54,
+  0x2b, 0x49, 0xcd, 0x1f, 0xb2, 0x2a, 0x0d, 0x1f, 0x74, 0xf1, 0x43, 0x00,
+  0x30, 0x97, 0x38, 0x06, 0x1d, 0x90, 0xc3, 0x59, 0x53, 0x99, 0x87, 0x64,
+  0x58, 0x4c, 0x22, 0x2d, 0xe5, 0xa8, 0x7f, 0xb4, 0x06, 0xd4, 0x59, 0x09,
+  0xb4, 0x8b, 0xa2, 0x15, 0x35, 0xa2, 0xeb, 0x25, 0x13, 0xac, 0x9f, 0xfb,
+  0x4a, 0x4b, 0xa8, 0x0e, 0xa8, 0x6d, 0x20, 0xd2, 0xf7, 0xc2, 0x69, 0x6b,
+  0x1b, 0xad, 0x4d, 0xb1, 0x37, 0xb9, 0x02, 0xd9, 0x2a, 0x18, 0x36, 0x19,
+  0xab, 0xb9, 0xa4, 0x71, 0x1e, 0x1e, 0xb5, 0x34, 0xcc, 0x42, 0xd1, 0xff,
+  0xb2, 0x10, 0xe1, 0x2e, 0x36, 0xaf, 0x91, 0x98, 0xdb, 0x39, 0x49, 0x74,
+  0xd1, 0xc5, 0x7a, 0x35, 0x5d, 0x3c, 0xfa, 0x81, 0xc6, 0x5a, 0x83, 0x54,
+  0x6e, 0x24, 0x50, 0x78, 0xc4, 0x29, 0x45, 0x0c, 0xf2, 0xbf, 0xbc, 0xc4,
+  0xd7, 0x95, 0x4a, 0x68, 0xa2, 0xc6, 0x03, 0x30, 0x9e, 0x14, 0xf6, 0xa3,
+  0xac, 0x35, 0x72, 0xb9, 0xf8, 0x9b, 0x27, 0x52, 0xce, 0xb7, 0xed, 0x56,
+  0xee, 0x0e, 0x5d, 0x2f, 0x96, 0x7d, 0x26, 0x66, 0x7b, 0x30, 0x22, 0xc6,
+  0xea, 0x01, 0xd1, 0xe8, 0xc5, 0xb8, 0xb1, 0x12, 0xa0, 0x04, 0xd6, 0x6c,
+  0x65, 0x3d, 0x6c, 0x4a, 0xa2, 0x2d, 0xd8, 0xa5, 0xef, 0x72, 0xdf, 0x5b,
+  0xf6, 0x35, 0x1f, 0xd6, 0x01, 0x39, 0x2e, 0x49, 0x1c, 0xeb, 0xdb, 0xb6,
+  0x16, 0xb9, 0xad, 0x3e, 0xa6, 0x9a, 0x1d, 0xc2, 0x47, 0x26, 0xc4, 0xdb,
+  0xe5, 0x6d, 0xfd, 0x25, 0x48, 0x8a, 0x0c, 0x2a, 0xf6, 0x81, 0x78, 0x0f,
+  0x07, 0x88, 0xb5, 0xbe, 0x08, 0x01, 0x6e, 0xd8, 0x29, 0x3c, 0xb8, 0xc0,
+  0xc6, 0xf0, 0xda, 0x78, 0x47, 0x6c, 0x9f, 0x98, 0xe6, 0x1e, 0xb7, 0xde,
+  0xd2, 0x5f, 0xcf, 0x3f, 0x90, 0xe0, 0x89, 0x1d, 0x02, 0xc8, 0xe2, 0x0a,
+  0x7f, 0xd1, 0x13, 0x83, 0xc0, 0x57, 0xcc, 0xa8, 0xaa, 0x28, 0x8a, 0x55,
+  0x54, 0x39, 0xea, 0xb2, 0x05, 0x6c, 0x9d, 0x93, 0xac, 0x55, 0x67, 0x7a,
+  0x4c, 0x44, 0xfb, 0x8d, 0xcb, 0x38, 0x2b, 0x23, 0x75, 0x86, 0x26, 0x3d,
+  0xc3, 0x0e, 0xde, 0x77, 0x6f, 0x4a, 0xe9, 0x76, 0x8c, 0x89, 0x03, 0x40,
+  0xeb, 0xef, 0xd5, 0x85, 0x50, 0x3d, 0xda, 0x96, 0xcc, 0x92, 0x25, 0x31,
+  0x67, 0xbb, 0x8b, 0x85, 0xe8, 0x2f, 0xed, 0x33, 0xa1, 0xa7, 0x4c, 0x44,
+  0x09, 0x5d, 0x02, 0x30, 0xd8, 0x5c, 0x63, 0x28, 0x01, 0xe1, 0x4d, 0xc2,
+  0xe6, 0x95, 0xc7, 0xd9, 0x1c, 0x1e, 0xde, 0x7e, 0xdc, 0xbc, 0x11, 0x06,
+  0x4f, 0x73, 0xc9, 0xbb, 0x64, 0x92, 0x8a, 0x39, 0x1f, 0x59, 0x81, 0x7e,
+  0x98, 0xcf, 0xad, 0xe0, 0xea, 0x1f, 0xc4, 0x33, 0x1c, 0x66, 0xfc, 0x31,
+  0x7e, 0x3e, 0xb4, 0x28, 0x6b, 0x7c, 0x52, 0x5d, 0x8c, 0x52, 0xb2, 0xe0,
+  0x3e, 0x8b, 0xe3, 0x9a, 0x60, 0x34, 0xa3, 0x50, 0x39, 0x89, 0x01, 0x97,
+  0x09, 0xa5, 0x4f, 0x74, 0x0c, 0xac, 0xc5, 0xdf, 0x9a, 0x47, 0xe7, 0x56,
+  0x0b, 0x11, 0x1d, 0x72, 0xff, 0x91, 0x16, 0xf7, 0xe0, 0x34, 0x98, 0xb4,
+  0xf5, 0xe5, 0xe5, 0xea, 0x6f, 0x22, 0x6e, 0x42, 0x69, 0xc1, 0x0a, 0x2b,
+  0x8f, 0x78, 0x21, 0xa8, 0x70, 0x2b, 0x72, 0xc3, 0x1f, 0x9f, 0x86, 0xaa,
+  0xf2, 0x75, 0xaf, 0x82, 0xd2, 0xd7, 0xa0, 0xf7, 0x3b, 0xfe, 0x55, 0x24,
+  0xe9, 0xb7, 0xe7, 0xb4, 0xe5, 0x2d, 0x76, 0xb8, 0x6a, 0x26, 0xd7, 0x8d,
+  0x39, 0xc9, 0xb7, 0x96, 0x4e, 0x1c, 0x60, 0x02, 0xb1, 0xe4, 0xc7, 0x51,
+  0x7a, 0x27, 0xa3, 0x4f, 0x34, 0x6d, 0x68, 0x8e, 0x7d, 0x42, 0x94, 0x36,
+  0x79, 0x11, 0xce, 0xb8, 0xfe, 0x89, 0xc5, 0x3f, 0x09, 0x35, 0x16, 0x32,
+  0x83, 0x9b, 0x79, 0xcc, 0x7a, 0x3d, 0x26, 0x81, 0xba, 0x83, 0x78, 0x18,
+  0x45, 0xfb, 0xda, 0xf8, 0xa4, 0x76, 0x7f, 0xaa, 0x98, 0x0f, 0x7a, 0xee,
+  0x53, 0xb5, 0x68, 0xdb, 0x05, 0x60, 0x30, 0x74, 0xf9, 0xc8, 0xe1, 0xae,
+  0x28, 0x6f, 0xc1, 0x4c, 0x55, 0x12, 0x4a, 0x97, 0x72, 0x41, 0x53, 0xf1,
+  0x0a, 0x1f, 0x9b, 0x97, 0x5f, 0x99, 0xd7, 0x27, 0x9d, 0x3a, 0xef, 0xf1,
+  0x5c, 0x51, 0xf3, 0x20, 0xc6, 0x76, 0x7a, 0xb3, 0x75, 0x87, 0x40, 0x91,
+  0x8b, 0x72, 0x2b, 0x27, 0x7b, 0xc7, 0xd3, 0x61, 0x19, 0xbc, 0x0f, 0xbc,
+  0xc8, 0x55, 0x42, 0x03, 0xe5, 0xa6, 0xb5, 0x43, 0x79, 0x5c, 0xc2, 0xc8,
+  0x4d, 0x36, 0x91, 0xaa, 0xf7, 0xbe, 0x0f, 0xcd, 0x3d, 0xef, 0x25, 0x44,
+  0x39, 0xe8, 0x27, 0xe5, 0xc4, 0x8d, 0x64, 0xee, 0x79, 0x19, 0xe6, 0x8b,
+  0x65, 0xfe, 0x9b, 0x24, 0xfd, 0x5b, 0xdc, 0x85, 0x51, 0x1a, 0xcd, 0x79,
+  0x36, 0x44, 0x0a, 0x7c, 0x4a, 0xdc, 0x6f, 0x94, 0xcb, 0xea, 0x5a, 0xdd,
+  0x26, 0x4b, 0x0e, 0xb8, 0x6e, 0x14, 0xda, 0x16, 0x9b, 0x1a, 0x84, 0x33,
+  0x2a, 0xd6, 0x02, 0xe5, 0xdd, 0x88, 0xc9, 0x4c, 0x00, 0x48, 0x5d, 0x2b,
+  0xb3, 0x76, 0xea, 0x17, 0x79, 0x72, 0xe3, 0x59, 0x16, 0x9a, 0xde, 0xdd,
+  0x37, 0x67, 0x6f, 0x28, 0xf1, 0x78, 0xa2, 0xdd, 0xd5, 0xd8, 0x86, 0x26,
+  0x68, 0xef, 0x4b, 0xd5, 0x57, 0xdc, 0x32, 0x20, 0x79, 0x8b, 0x67, 0x82,
+  0x0a, 0x98, 0x1d, 0x0f, 0x86, 0x22, 0x85, 0xc0, 0xd8, 0xc6, 0xa4, 0x3a,
+  0x51, 0xb4, 0xa3, 0x5d, 0xf6, 0xf5, 0xcc, 0x1a, 0x86, 0x68, 0x95, 0xb4,
+  0x8e, 0xa3, 0x9e, 0xa7, 0x4a, 0xe7, 0xd8, 0x6a, 0x94, 0x8a, 0x12, 0xe5,
+  0xe8, 0x4e, 0x32, 0xd5, 0xef, 0x49, 0x51, 0xc0, 0x27, 0x2a, 0x88, 0x98,
+  0xc0, 0x69, 0x21, 0x4d, 0x71, 0x98, 0xfb, 0xc3, 0xfd, 0x56, 0x93, 0x98,
+  0xbb, 0xf0, 0xa1, 0x70, 0x0e, 0x64, 0x51, 0x1f, 0xd8, 0xf8, 0x5c, 0x90,
+  0xc5, 0x91, 0x51, 0x63, 0xd3, 0x76, 0xe3, 0x4f, 0x49, 0x9d, 0x72, 0x88,
+  0x42, 0x02, 0x58, 0x8a, 0xab, 0xef, 0xe9, 0x96, 0x21, 0x2b, 0x4e, 0x6a,
+  0x13, 0xc5, 0xb0, 0xae, 0x54, 0x72, 0xd3, 0xb7, 0x65, 0xdc, 0xc7, 0xa2,
+  0x48, 0xf0, 0x0f, 0x23, 0xc7, 0xe7, 0x4c, 0x12, 0x3d, 0xb3, 0x05, 0x09,
+  0xe3, 0xda, 0xdb, 0xe8, 0x07, 0xec, 0x77, 0xda, 0x6e, 0x96, 0x3d, 0xe4,
+  0x34, 0xf2, 0x5e, 0x11, 0x32, 0x79, 0x54, 0xd8, 0x93, 0x52, 0x97, 0x03,
+  0x70, 0x6e, 0xac, 0x90, 0xf3, 0x53, 0xf8, 0xc4, 0x6e, 0x70, 0xad, 0x84,
+  0xaa, 0x13, 0x16, 0x40, 0xe9, 0xf2, 0x34, 0x26, 0x3c, 0xb5, 0x95, 0x4f,
+  0xc5, 0xa1, 0xce, 0xea, 0xa4, 0x6b, 0x53, 0xab, 0x2b, 0x85, 0x08, 0x5d,
+  0x9e, 0x33, 0xfb, 0xea, 0x50, 0xa0, 0x46, 0x8b, 0x57, 0x3d, 0x87, 0x94,
+  0xcc, 0x71, 0xae, 0x8b, 0x23, 0xac, 0x0a, 0xe4, 0x94, 0x22, 0x66, 0x43,
+  0xd9, 0x74, 0x9a, 0x69, 0x3c, 0x58, 0x10, 0xe7, 0xad, 0xa5, 0xf3, 0xe7,
+  0x1d, 0x9f, 0xfe, 0xf6, 0x9e, 0x2d, 0xf2, 0x69, 0xea, 0x21, 0x0e, 0x08,
+  0xf4, 0xc7, 0x4b, 0x28, 0x06, 0xcd, 0xde, 0x8e, 0xe9, 0xa1, 0x00, 0xdc,
+  0xd5, 0xfe, 0x92, 0xaa, 0xd8, 0x8d, 0xd1, 0x64, 0xca, 0x13, 0xbf, 0xd4,
+  0xce, 0x18, 0x0c, 0x33, 0x45, 0x29, 0x70, 0x43, 0x27, 0x86, 0x93, 0x87,
+  0xab, 0xd5, 0xcd, 0x8f, 0x40, 0x9a, 0xd6, 0x56, 0x4b, 0xae, 0x7c, 0xbd,
+  0x00, 0x15, 0x82, 0xdb, 0xf4, 0x20, 0x8c, 0xd1, 0xdc, 0xed, 0x9d, 0x8d,
+  0x28, 0xba, 0x11, 0xdd, 0x9b, 0xeb, 0x2e, 0xfa, 0x44, 0xd9, 0x70, 0x03,
+  0x17, 0x8e, 0x07, 0x6d, 0x2c, 0xea, 0x5d, 0xc4, 0x30, 0x02, 0xd8, 0x87,
+  0x17, 0x58, 0x46, 0x24, 0x8b, 0x41, 0x3b, 0xba, 0xac, 0x38, 0xc6, 0x93,
+  0x48, 0x4e, 0x00, 0x40, 0x23, 0xc6, 0x5a, 0xad, 0x80, 0xef, 0xd4, 0x04,
+  0x50, 0xa1, 0xff, 0xac, 0x58, 0x2f, 0x78, 0xd8, 0x68, 0x5b, 0x16, 0xb4,
+  0x19, 0x84, 0xdd, 0x76, 0x58, 0x13, 0x79, 0x22, 0xc8, 0xf1, 0xf2, 0x4b,
+  0xba, 0x08, 0x22, 0xc4, 0x5e, 0x4c, 0xc0, 0xeb, 0x67, 0x31, 0x4b, 0x55,
+  0xae, 0xb0, 0x84, 0x51, 0x27, 0x8e, 0xf2, 0x81, 0x2f, 0x1f, 0xb4, 0x47,
+  0x9e, 0xa6, 0x2c, 0x0d, 0x1b, 0x61, 0x3f, 0x2c, 0xb7, 0x7a, 0x52, 0x83,
+  0x80, 0xdd, 0x27, 0x19, 0x2b, 0xe8, 0x7b, 0x55, 0x7f, 0x01, 0x54, 0x02,
+  0x68, 0x58, 0x1f, 0x3d, 0x7d, 0xd1, 0x38, 0x5b, 0x9d, 0xf6, 0xdd, 0x3b,
+  0x14, 0xd0, 0x7f, 0x21, 0x1f, 0xd7, 0xef, 0x4f, 0xaa, 0x5c, 0xb4, 0x23,
+  0xcf, 0xec, 0x16, 0x1f, 0x6c, 0x91, 0x4b, 0x25, 0xeb, 0xaf, 0x46, 0xe6,
+  0xbf, 0x18, 0x77, 0xd8, 0xdb, 0x59, 0x33, 0x94, 0x7e, 0x07, 0xc1, 0x25,
+  0x06, 0xb0, 0x9a, 0x73, 0xd9, 0x0a, 0x56, 0x56, 0x2a, 0xa8, 0x5a, 0x82,
+  0xe2, 0xfc, 0xdc, 0x2d, 0x29, 0x36, 0xe8, 0x3a, 0xda, 0xc0, 0x4c, 0x0b,
+  0x17, 0xb3, 0xdb, 0x77, 0xad, 0x2e, 0x4b, 0xe8, 0x14, 0x56, 0x32, 0xf1,
+  0x43, 0x57, 0x33, 0x55, 0x10, 0x1e, 0xa8, 0x45, 0xb6, 0x7c, 0x6d, 0x58,
+  0x5d, 0xec, 0x3d, 0x47, 0xa5, 0x82, 0x89, 0x6d, 0x06, 0xc3, 0x8d, 0x1b,
+  0x17, 0x30, 0x8c, 0x3c, 0x6f, 0x12, 0x05, 0x9c, 0x6f, 0x2c, 0xa4, 0x57,
+  0xb0, 0xeb, 0xc6, 0xd3, 0x97, 0xc1, 0x56, 0x08, 0x8f, 0x39, 0x3c, 0xc6,
+  0x2d, 0xa2, 0x00, 0xcf, 0x01, 0xd8, 0x39, 0xb4, 0x29, 0x5c, 0xdf, 0x5e,
+  0x9e, 0x24, 0xd4, 0xdf, 0x50, 0x31, 0x13, 0x6a, 0x01, 0x4d, 0xef, 0xf5,
+  0x5d, 0xd8, 0x72, 0xd9, 0x0d, 0x70, 0x11, 0xfb, 0x3c, 0x66, 0xea, 0x5a,
+  0xfa, 0x8e, 0x76, 0x79, 0x4c, 0x1b, 0xb6, 0x13, 0xf4, 0x3b, 0x0e, 0xa6,
+  0xca, 0xf4, 0x1f, 0x58, 0xf9, 0xf5, 0xed, 0x00, 0x7b, 0xd3, 0xa5, 0xc2,
+  0xb8, 0x35, 0x40, 0x3b, 0x7a, 0x9a, 0x3f, 0x52, 0xc2, 0x84, 0x59, 0x8a,
+  0xbe, 0xa9, 0x4b, 0xe2, 0x79, 0x17, 0xaa, 0xc6, 0x12, 0xce, 0x93, 0x68,
+  0x3e, 0xd8, 0x80, 0x36, 0xd3, 0xaf, 0x40, 0xd0, 0xf9, 0x67, 0x5f, 0xa7,
+  0x81, 0xef, 0x70, 0x4b, 0xd6, 0x55, 0x0d, 0xe1, 0x4b, 0xfc, 0xad, 0xf8,
+  0x4d, 0x4d, 0xab, 0x71, 0x38, 0x05, 0xf4, 0xb5, 0xbf, 0x4e, 0xe2, 0x89,
+  0x50, 0xfe, 0x06, 0xf9, 0xf0, 0x13, 0x28, 0x14, 0xed, 0x83, 0x2a, 0x6a,
+  0xe9, 0x95, 0x35, 0x85, 0xfe, 0x61, 0x3e, 0x09, 0xe9, 0x58, 0xc4, 0xb5,
+  0xca, 0x94, 0xbc, 0xa4, 0x67, 0x08, 0x87, 0x2d, 0x5e, 0xdc, 0x5b, 0xde,
+  0xff, 0xe3, 0x0f, 0xe8, 0x37, 0x42, 0xc1, 0x4e, 0xca, 0x67, 0x5a, 0xa5,
+  0x60, 0x57, 0xba, 0xd1, 0x0b, 0x04, 0xa0, 0x18, 0xac, 0x3b, 0x12, 0x27,
+  0x5b, 0xee, 0x82, 0x43, 0x73, 0xf9, 0x53, 0x6a, 0xb5, 0xd1, 0x47, 0x80,
+  0x5e, 0x3e, 0x14, 0x01, 0x7c, 0x92, 0x64, 0x6a, 0x8d, 0xc6, 0xfa, 0xa8,
+  0xef, 0x8c, 0xc7, 0xb3, 0xe2, 0x4e, 0xe7, 0xe4, 0x6c, 0x3f, 0xca, 0x2d,
+  0x04, 0x02, 0x5a, 0x18, 0x7b, 0x6b, 0x65, 0x57, 0x1b, 0xe2, 0x68, 0xbb,
+  0xb7, 0xf4, 0xd1, 0x83, 0x9e, 0x42, 0x8c, 0x8f, 0xd5, 0x92, 0x43, 0xc1,
+  0xe4, 0x85, 0xc6, 0x91, 0xec, 0xf4, 0x7c, 0x4d, 0x13, 0xb9, 0x6d, 0x2d,
+  0xa1, 0x5d, 0xb0, 0x93, 0x92, 0x0b, 0xfb, 0xb9, 0x75, 0xa9, 0x4c, 0xcf,
+  0x58, 0x96, 0x90, 0xd1, 0xef, 0x25, 0x36, 0x26, 0x92, 0x46, 0x60, 0x0e,
+  0x9f, 0xf1, 0x5d, 0x2a, 0x4c, 0xea, 0xba, 0x56, 0x50, 0x30, 0x42, 0xca,
+  0x92, 0x43, 0xed, 0xdf, 0x46, 0xbb, 0x98, 0x98, 0x50, 0xc4, 0x58, 0x1c,
+  0xec, 0xa0, 0x12, 0x54, 0x75, 0xcc, 0x27, 0xed, 0xa5, 0x1e, 0xc0, 0x6b,
+  0x98, 0xc3, 0xce, 0xd1, 0x14, 0x02, 0x25, 0x92, 0x9b, 0x1a, 0x59, 0xc4,
+  0x21, 0x17, 0x8a, 0x02, 0xf2, 0x18, 0xc3, 0x34, 0x3f, 0xff, 0xf6, 0xfa,
+  0x55, 0x61, 0x1c, 0xbe, 0x65, 0x7c, 0x9d, 0x65, 0x51, 0x73, 0x67, 0x3b,
+  0x11, 0x01, 0xba, 0x0b, 0xaf, 0x32, 0x38, 0xf4, 0xcd, 0x7f, 0x8c, 0xe4,
+  0xdf, 0xde, 0xed, 0x30, 0xf0, 0xc9, 0x52, 0xfb, 0xc6, 0x63, 0xa0, 0x7c,
+  0x43, 0xe0, 0xe3, 0x1c, 0xca, 0x2e, 0x28, 0x81, 0x7d, 0x3e, 0x6e, 0xc1,
+  0x3d, 0x24, 0x8b, 0x73, 0x2b, 0x7e, 0x55, 0x00, 0x03, 0xe3, 0x8f, 0x40,
+  0xf5, 0x08, 0x5f, 0xfe, 0x14, 0x05, 0xdf, 0xd4, 0xac, 0x27, 0x72, 0x2f,
+  0x5c, 0x56, 0x16, 0x88, 0x83, 0x76, 0x53, 0x27, 0x4f, 0xc9, 0xc2, 0x84,
+  0xde, 0x06, 0x65, 0x9f, 0x9b, 0x42, 0xa8, 0x36, 0x46, 0x9c, 0x16, 0x89,
+  0xed, 0xc4, 0x64, 0x17, 0xaf, 0x86, 0x36, 0xbd, 0x61, 0x13, 0x89, 0xbb,
+  0x64, 0xab, 0xcf, 0xe8, 0x24, 0x4f, 0x84, 0x1d, 0x45, 0xc5, 0xf3, 0x4a,
+  0xfb, 0xfd, 0x43, 0xfb, 0xf6, 0xe4, 0x0e, 0xa2, 0xee, 0x9b, 0x72, 0x2b,
+  0x88, 0x09, 0x5d, 0x04, 0x4b, 0x04, 0xcd, 0x65, 0xba, 0x5d, 0x57, 0x4d,
+  0xf6, 0x9c, 0x93, 0x8c, 0xa3, 0x41, 0x42, 0xb0, 0xb7, 0x37, 0x75, 0xa3,
+  0xd4, 0x78, 0x29, 0x61, 0xb7, 0x4a, 0xd4, 0xc2, 0x1f, 0x76, 0x9b, 0xea,
+  0xa4, 0xa4, 0xcf, 0xc6, 0xa2, 0x8b, 0xb7, 0xba, 0xca, 0xd3, 0x18, 0x12,
+  0x84, 0xf0, 0xe3, 0x42, 0xbf, 0x74, 0x69, 0x16, 0xb0, 0x74, 0x7d, 0x8a,
+  0xa8, 0x32, 0x34, 0x5d, 0x39, 0x5a, 0x34, 0x7b, 0x32, 0x1f, 0x02, 0xc3,
+  0x9c, 0x47, 0x05, 0xda, 0x05, 0x2e, 0xe3, 0x4f, 0x47, 0x59, 0x42, 0x3b,
+  0xbf, 0xf6, 0xef, 0x92, 0x02, 0x6f, 0xec, 0x75, 0x73, 0xa1, 0x21, 0xb8,
+  0xfb, 0x4a, 0x4d, 0x94, 0x79, 0x17, 0xfd, 0x03, 0x56, 0x29, 0x24, 0x42,
+  0x8e, 0x8a, 0xd5, 0xe8, 0xe4, 0x9f, 0x66, 0xf2, 0xa0, 0xaa, 0x9a, 0x94,
+  0xa1, 0x8b, 0xe7, 0xa8, 0x8b, 0xf4, 0x89, 0x16, 0xc2, 0x37, 0xb7, 0x4d,
+  0x6a, 0x1b, 0xfd, 0x1e, 0xa8, 0x1e, 0xa2, 0xdd, 0xa1, 0x6e, 0x70, 0xca,
+  0x11, 0x7c, 0x3b, 0x75, 0xb3, 0x8c, 0x10, 0xe6, 0xfa, 0x87, 0x6d, 0xf9,
+  0xdb, 0x36, 0x16, 0xee, 0x72, 0x55, 0x18, 0xc9, 0x20, 0x35, 0xfb, 0x0a,
+  0x08, 0xa1, 0x85, 0x95, 0xc0, 0x9a, 0x0f, 0x7a, 0xee, 0x2f, 0x32, 0x2c,
+  0x01, 0x44, 0x47, 0xf2, 0x23, 0x4a, 0x1f, 0x7e, 0x9e, 0x05, 0x35, 0xec,
+  0x6b, 0x99, 0xaa, 0xf3, 0xbf, 0x5d, 0x42, 0xd5, 0xa1, 0xd3, 0x83, 0x5b,
+  0xf8, 0xb9, 0x82, 0x56, 0x88, 0x65, 0x0f, 0x30, 0x04, 0xa2, 0x6f, 0x7f,
+  0x0f, 0x1c, 0x75, 0xd4, 0xb8, 0x5e, 0xbf, 0x86, 0x78, 0x8a, 0xfc, 0xe8,
+  0x1e, 0x2d, 0x73, 0x15, 0x31, 0x00, 0x18, 0xaa, 0xba, 0x44, 0x76, 0x2b,
+  0x82, 0xf1, 0xa8, 0x4c, 0x49, 0x79, 0x77, 0xa1, 0xe4, 0x92, 0xa4, 0x4b,
+  0xe6, 0x83, 0x8c, 0x51, 0xe5, 0x37, 0xdd, 0xed, 0x27, 0xea, 0x66, 0xb0,
+  0xf1, 0xe9, 0x27, 0x51, 0xf9, 0x1a, 0xf3, 0x13, 0xa5, 0xf6, 0x59, 0xd1,
+  0xf5, 0xc8, 0xbe, 0xd4, 0xb2, 0x28, 0x8f, 0xd7, 0xae, 0x1b, 0x53, 0x38,
+  0x7f, 0xe9, 0xdb, 0xe6, 0xc0, 0xdc, 0xad, 0x6f, 0x95, 0xb5, 0xc8, 0x7a,
+  0x0f, 0x11, 0x81, 0x6b, 0xe0, 0x5a, 0xe7, 0x22, 0x44, 0x1b, 0xd0, 0xf1,
+  0xb0, 0x97, 0xf2, 0xcc, 0xc6, 0x04, 0x27, 0xd4, 0x45, 0xb3, 0xf5, 0x87,
+  0x88, 0x64, 0xbe, 0xb3, 0xeb, 0x4b, 0x48, 0xf3, 0x64, 0x42, 0x37, 0x97,
+  0xa2, 0x47, 0x6f, 0x62, 0xcc, 0x3c, 0x20, 0xee, 0x20, 0x68, 0x28, 0x4d,
+  0xd4, 0xde, 0xe3, 0x12, 0x0a, 0x03, 0x37, 0x8a, 0x23, 0x60, 0x41, 0xe2,
+  0xd6, 0xf4, 0x26, 0x64, 0xf8, 0xc0, 0x74, 0x24, 0x6c, 0x5e, 0xf9, 0xb4,
+  0x6c, 0x5b, 0x77, 0x5d, 0xc2, 0x23, 0x88, 0x67, 0xcb, 0x63, 0x71, 0xf8,
+  0x78, 0xaa, 0x45, 0xa9, 0xab, 0xe4, 0xdf, 0x68, 0x68, 0x31, 0x7b, 0x2b,
+  0x5c, 0x67, 0xa1, 0x52, 0xb1, 0x22, 0x2c, 0x74, 0x11, 0xde, 0x67, 0x49,
+  0x63, 0xc6, 0x95, 0x88, 0xbf, 0x19, 0xf4, 0x7f, 0x38, 0xc6, 0x3f, 0x86,
+  0x8e, 0xc1, 0x50, 0x5a, 0x85, 0x92, 0x8f, 0xa8, 0x35, 0x8f, 0x98, 0x9d,
+  0x04, 0x98, 0x12, 0x6c, 0xfb, 0x84, 0x08, 0xbd, 0x9e, 0x15, 0x2f, 0xa9,
+  0xe3, 0xb9, 0xd1, 0xdb, 0xc7, 0x59, 0xca, 0x68, 0x29, 0xea, 0x3d, 0xaa,
+  0xfa, 0x0f, 0x78, 0xb0, 0x9b, 0xa4, 0xc7, 0x3e, 0xa2, 0x0c, 0xda, 0xea,
+  0x8f, 0x63, 0x1f, 0x84, 0x11, 0x12, 0xc3, 0xec, 0x93, 0x15, 0x59, 0x51,
+  0x0a, 0xcc, 0x74, 0x08, 0xe7, 0x50, 0x4e, 0x34, 0x6e, 0x75, 0x0b, 0x0f,
+  0x7b, 0x37, 0x02, 0xf9, 0x6d, 0x3e, 0xee, 0xe6, 0x2f, 0x1c, 0x1a, 0x1d,
+  0xbd, 0xbf, 0x0d, 0x81, 0x3f, 0xdf, 0x44, 0x89, 0x32, 0xc3, 0xe8, 0x05,
+  0xed, 0xd7, 0xe0, 0xbf, 0xca, 0x6d, 0xf9, 0x1e, 0x82, 0xd7, 0x31, 0xfa,
+  0xa4, 0x66, 0xfa, 0xa8, 0xaa, 0xb3, 0x9b, 0xc5, 0x2f, 0x97, 0x29, 0xa5,
+  0x40, 0x0a, 0x58, 0xc2, 0xde, 0xc5, 0xc3, 0xda, 0x9b, 0x88, 0xed, 0x86,
+  0x79, 0x39, 0xf0, 0x82, 0xda, 0xbb, 0x73, 0x1d, 0xec, 0x38, 0x91, 0x86,
+  0x38, 0x4a, 0xc4, 0xd1, 0x65, 0x51, 0x7f, 0x50, 0x42, 0xda, 0x3f, 0x9f,
+  0x27, 0x50, 0x7b, 0x22, 0xab, 0x1d, 0x21, 0x8c, 0x0f, 0x1f, 0x9e, 0x3b,
+  0x45, 0xcf, 0x54, 0xba, 0x9a, 0x43, 0x18, 0x36, 0x59, 0x01, 0x80, 0x29,
+  0x69, 0x75, 0xc7, 0x28, 0x77, 0xee, 0xde, 0xc2, 0xf5, 0xfb, 0xf3, 0x57,
+  0x95, 0x7c, 0x75, 0x84, 0xd2, 0xa5, 0x7f, 0x8d, 0x6c, 0x79, 0xc3, 0xec,
+  0xa7, 0x64, 0x8b, 0x63, 0x5b, 0x56, 0x8a, 0x0d, 0x2b, 0xf8, 0x89, 0x09,
+  0x1c, 0xf1, 0xf8, 0x48, 0xae, 0x14, 0x69, 0xf8, 0xbb, 0x8c, 0x2a, 0x76,
+  0x43, 0xa4, 0x7e, 0x32, 0x29, 0x43, 0x62, 0x94, 0xe7, 0xb8, 0xd4, 0x81,
+  0xbf, 0xd4, 0xdf, 0x8b, 0x9e, 0xd0, 0xac, 0x04, 0xd9, 0x47, 0xe3, 0xed,
+  0x0c, 0xa4, 0xf9, 0x98, 0x4d, 0x55, 0x18, 0x31, 0x6b, 0xe6, 0x2d, 0x28,
+  0xba, 0x7f, 0x0e, 0x44, 0x57, 0x3f, 0x78, 0xb2, 0xad, 0x4a, 0xe6, 0x4b,
+  0x24, 0x4b, 0xb2, 0xe6, 0x45, 0xa8, 0x56, 0xde, 0x16, 0xf9, 0x6d, 0xda,
+  0xb4, 0x52, 0x33, 0xc5, 0x1c, 0xce, 0x78, 0xdc, 0x4c, 0x4e, 0x20, 0xda,
+  0x9f, 0x7e, 0x11, 0x14, 0xe7, 0x1b, 0xfb, 0xcf, 0x9a, 0xa8, 0xb5, 0x96,
+  0xfe, 0xe0, 0xb2, 0x35, 0x90, 0xec, 0x19, 0xff, 0xa3, 0xa6, 0x89, 0xa5,
+  0x3a, 0x8c, 0xb4, 0x8c, 0x54, 0x27, 0x60, 0xf7, 0x96, 0xc4, 0x58, 0xc2,
+  0x54, 0xf4, 0x9f, 0xe8, 0xa7, 0xc9, 0x24, 0xc2, 0x39, 0xaf, 0xad, 0x52,
+  0x15, 0x7c, 0xc3, 0xf0, 0xfc, 0x4d, 0x95, 0xc5, 0x46, 0xba, 0x4f, 0x09,
+  0x1e, 0x6c, 0x71, 0x8d, 0x49, 0xc8, 0x93, 0xe0, 0x2f, 0xf1, 0x9f, 0x9d,
+  0x3c, 0xed, 0x02, 0xdc, 0xcc, 0xc7, 0xf6, 0x2f, 0x84, 0x7d, 0xd7, 0xeb,
+  0x0f, 0xfd, 0xa7, 0xef, 0xdf, 0x69, 0x09, 0x72, 0x18, 0xde, 0xa5, 0x3a,
+  0x76, 0x57, 0x7a, 0xec, 0x26, 0x7d, 0xdd, 0x80, 0x1c, 0xde, 0x8d, 0xe3,
+  0x5a, 0x9b, 0x22, 0xd3, 0xce, 0x43, 0x07, 0x2d, 0x74, 0x27, 0x18, 0x87,
+  0x1b, 0xe7, 0x84, 0x58, 0xab, 0xbc, 0x74, 0x0c, 0x84, 0x51, 0xd9, 0xb1,
+  0x6e, 0x19, 0x08, 0x31, 0xc2, 0x3e, 0xac, 0x99, 0xd9, 0x13, 0x14, 0x9b,
+  0x38, 0x4b, 0x8b, 0xf7, 0xde, 0x4a, 0xad, 0x09, 0xb2, 0x7b, 0xb4, 0x20,
+  0x7d, 0x6c, 0x73, 0x2e, 0xa8, 0xd3, 0x3d, 0x2f, 0x6b, 0x54, 0xba, 0xbb,
+  0x77, 0x48, 0xef, 0x6b, 0x8e, 0x83, 0x7d, 0x23, 0x1d, 0xbb, 0x01, 0x45,
+  0x34, 0x54, 0x5a, 0xe6, 0x50, 0x6a, 0xed, 0xbc, 0xcf, 0x72, 0xe6, 0x70,
+  0x6b, 0x90, 0x47, 0x27, 0x53, 0x88, 0x7e, 0xa7, 0x6f, 0xd2, 0x3b, 0x11,
+  0xb4, 0x86, 0x04, 0x15, 0x7f, 0xc5, 0x36, 0x66, 0xf7, 0xfb, 0x93, 0x49,
+  0x1d, 0x95, 0xec, 0x0b, 0xb7, 0x3c, 0xa4, 0xf7, 0xda, 0x9e, 0xfe, 0x49,
+  0x81, 0xec, 0x91, 0x66, 0xf7, 0x31, 0x64, 0x4a, 0x1b, 0xc9, 0x1a, 0x0d,
+  0x71, 0x9f, 0xa9, 0xe9, 0x6e, 0xdf, 0x92, 0xde, 0x89, 0xef, 0xf7, 0x21,
+  0xb2, 0xa2, 0x2e, 0x0f, 0x7d, 0x45, 0x85, 0x42, 0xe4, 0x53, 0x15, 0xcb,
+  0x32, 0xa3, 0xd5, 0x35, 0x6a, 0x6c, 0xc3, 0xaf, 0x86, 0x45, 0x4a, 0xa7,
+  0x66, 0xc6, 0x89, 0x33, 0x0b, 0x43, 0xe2, 0x32, 0xd9, 0x26, 0x6f, 0xba,
+  0x7d, 0xa7, 0xe4, 0x8d, 0xa2, 0x87, 0x33, 0x59, 0x94, 0x3d, 0x61, 0xd1,
+  0x58, 0x6d, 0xfc, 0xe1, 0xb4, 0xc8, 0x7f, 0x5c, 0xd4, 0xe4, 0x48, 0x2f,
+  0x4c, 0x3e, 0x55, 0xbf, 0xc5, 0xb6, 0xbb, 0x7d, 0x07, 0xb4, 0x19, 0x41,
+  0xca, 0x2d, 0x10, 0xf6, 0xb0, 0x1c, 0x02, 0x89, 0x3a, 0xf8, 0x51, 0x46,
+  0x54, 0xbc, 0x9e, 0x11, 0x85, 0x18, 0x6d, 0x92, 0x5f, 0x4b, 0xb4, 0xf8,
+  0x45, 0xc8, 0x57, 0xa7, 0x9d, 0xdf, 0x3d, 0x5c, 0x4e, 0x66, 0x5b, 0x23,
+  0x84, 0xc4, 0x5a, 0x58, 0xe8, 0x51, 0x55, 0xca, 0x84, 0x1c, 0x47, 0x62,
+  0x1e, 0xb8, 0xeb, 0xc1, 0x28, 0xc7, 0x9d, 0xd1, 0x72, 0x36, 0x46, 0xfa,
+  0xf0, 0x5b, 0xb2, 0xc5, 0xf7, 0x47, 0xe1, 0xbf, 0x64, 0x17, 0xea, 0xda,
+  0x13, 0x78, 0x8f, 0x8b, 0x7a, 0x60, 0x3a, 0xdf, 0x4c, 0x33, 0xc9, 0xe2,
+  0xd0, 0x73, 0x43, 0xf1, 0x81, 0x35, 0x2a, 0x42, 0x0f, 0x12, 0x5e, 0xaf,
+  0x05, 0xe9, 0xe8, 0x3a, 0x47, 0x12, 0x7d, 0x28, 0x17, 0xb6, 0xa1, 0xff,
+  0xe8, 0x5e, 0x20, 0x71, 0x45, 0x32, 0x78, 0xfb, 0x45, 0x7c, 0xb8, 0xfb,
+  0xcb, 0x82, 0xa2, 0xd6, 0x63, 0x72, 0xbb, 0xc1, 0x23, 0xde, 0x3d, 0x55,
+  0x6f, 0x99, 0x5d, 0x6d, 0xe7, 0x7b, 0x06, 0x2b, 0xe5, 0x4a, 0x7e, 0x19,
+  0xde, 0xba, 0x4e, 0x03, 0x60, 0x64, 0x04, 0x13, 0x0f, 0xf6, 0xed, 0x99,
+  0xd0, 0x54, 0x7c, 0x2b, 0x7f, 0x73, 0x30, 0x2a, 0xa1, 0x63, 0xf9, 0xeb,
+  0xc8, 0xa3, 0x48, 0x54, 0xa0, 0xe1, 0xff, 0xa1, 0x4c, 0x97, 0x6e, 0x79,
+  0x07, 0x7c, 0xee, 0x6e, 0xa6, 0x9c, 0x4d, 0x5a, 0x69, 0xa2, 0x3e, 0xc3,
+  0xf0, 0x42, 0x00, 0xf8, 0x0b, 0xcb, 0x5f, 0x24, 0x58, 0xce, 0x54, 0x77,
+  0x97, 0xd9, 0x31, 0x85, 0xd5, 0xf5, 0x6a, 0x82, 0xbc, 0x21, 0x17, 0xbb,
+  0xa0, 0x0a, 0xbd, 0x92, 0x71, 0xd8, 0x56, 0x5a, 0x4a, 0x5a, 0x8a, 0x73,
+  0xf6, 0xd4, 0x5f, 0x87, 0x22, 0x4f, 0xe1, 0x6c, 0xbb, 0x03, 0x98, 0x8f,
+  0x2e, 0x3e, 0x31, 0x4c, 0x36, 0xd9, 0x00, 0x5f, 0xee, 0x85, 0xe4, 0x98,
+  0xde, 0x77, 0x13, 0xa9, 0x3e, 0xf0, 0xae, 0x25, 0x8c, 0xc0, 0x71, 0xb2,
+  0x20, 0x62, 0x8e, 0x96, 0xc1, 0x0e, 0x86, 0x05, 0x7e, 0x57, 0xbf, 0xb7,
+  0x41, 0xeb, 0x0c, 0x97, 0xd8, 0x9e, 0xb1, 0xd4, 0x1b, 0xfb, 0x34, 0xcb,
+  0xf2, 0xc6, 0x42, 0x27, 0xc3, 0x88, 0x42, 0x12, 0xef, 0xae, 0x0e, 0xf9,
+  0xef, 0x38, 0x49, 0xd9, 0x41, 0xdd, 0x54, 0x35, 0xf4, 0xda, 0x13, 0x13,
+  0x5c, 0xc2, 0xb6, 0x73, 0x31, 0x71, 0xe4, 0xe4, 0xde, 0x8d, 0x65, 0x96,
+  0x8a, 0x32, 0x56, 0x61, 0x5d, 0x82, 0x67, 0x7c, 0xb8, 0xaa, 0x53, 0xfe,
+  0x4e, 0xa0, 0x14, 0x0a, 0xe5, 0x51, 0xb0, 0x5e, 0xd8, 0x89, 0xf5, 0xe3,
+  0x6d, 0x04, 0x75, 0x8e, 0x8f, 0x25, 0x12, 0xc8, 0x33, 0xbc, 0xa3, 0xb3,
+  0xee, 0x30, 0xe1, 0x53, 0xe2, 0x1f, 0xdb, 0xa0, 0xc9, 0xb4, 0x99, 0xc9,
+  0x25, 0x30, 0x53, 0x16, 0x0c, 0xe4, 0xef, 0x7a, 0xac, 0xde, 0xfd, 0xe7,
+  0x42, 0xbb, 0x41, 0x72, 0xf9, 0xaf, 0xd0, 0xb0, 0xe3, 0xad, 0x29, 0xb6,
+  0xe9, 0x52, 0xd2, 0x37, 0x16, 0x11, 0xc8, 0x4a, 0x6f, 0x87, 0x6c, 0x27,
+  0x7c, 0x33, 0x97, 0x25, 0xb6, 0x24, 0xb5, 0xd7, 0x44, 0x28, 0x31, 0xa7,
+  0x90, 0xe5, 0xbb, 0x96, 0xaf, 0x40, 0xfa, 0x5e, 0xf7, 0xa7, 0x2f, 0xcb,
+  0x02, 0xea, 0xae
+};
+unsigned int encrypted_zlib_4m_gpg_len = 21015;
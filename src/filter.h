@@ -57,15 +57,55 @@ typedef struct {
 } text_filter_context_t;
 
 
+/* Armor filter context, see armor.c.  Only decoding is supported.  */
+#define ARMOR_INBUF 4096
+
+typedef struct {
+    int refcount;           /* Reference counter.  */
+    int state;              /* Where armor_filter resumes */
+    int at_bol;             /* At the start of a body line */
+    unsigned int quad;      /* Sextets of an incomplete group ... */
+    unsigned int nquad;     /* ... and their number */
+    byte pend[2];           /* Decoded bytes that did not fit */
+    unsigned int npend;
+    u32 crc;                /* CRC-24 of the decoded data so far */
+    gpg_error_t err;        /* First armor error */
+    unsigned int linelen;   /* Header line collected so far */
+    char line[80];
+    size_t inpos, inlen;
+    byte inbuf[ARMOR_INBUF];
+} armor_filter_context_t;
+
+/* Compress filter context, see compress.c */
+typedef struct {
+    int refcount;           /* The filter and handle_compressed */
+    int eof_seen;
+    gpg_error_t err;        /* First decompression error */
+    iobuf_t chain;          /* Input, during an underflow */
+    struct inflate_s *z;    /* Decoder state */
+} compress_filter_context_t;
+
 /* Function declarations */
 int cipher_filter_cfb(void *opaque, int control, 
                      iobuf_t chain, byte *buf, size_t *len);
 
+/*-- armor.c --*/
+armor_filter_context_t *new_armor_context (void);
+void release_armor_context (armor_filter_context_t *afx);
+int push_armor_filter (armor_filter_context_t *afx, iobuf_t iobuf);
+int use_armor_filter( iobuf_t a );
+int armor_filter( void *opaque, int control,
+		  iobuf_t chain, byte *buf, size_t *ret_len);
+
+/*-- compress.c --*/
+int compress_filter (void *opaque, int control,
+		     iobuf_t chain, byte *buf, size_t *ret_len);
+
 /*-- textfilter.c --*/
 int text_filter( void *opaque, int control,
 		 iobuf_t chain, byte *buf, size_t *ret_len);
 /* Basic iobuf operations needed */
-int iobuf_write(iobuf_t a, const void *buffer, size_t length);
-int iobuf_read(iobuf_t a, void *buffer, size_t length);
+int iobuf_write(iobuf_t a, const void *buffer, unsigned length);
+int iobuf_read(iobuf_t a, void *buffer, unsigned length);
 
 #endif /* FILTER_H */
\ No newline at end of file
@@ -30,6 +30,7 @@
 // #include "options.h"
 #include "printf.h"
 #include "gcrypt.h"
+#include "memory.h"
 
 // /* This is mpi_copy with a fix for opaque MPIs which store a NULL
 //    pointer.  This will also be fixed in Libggcrypt 1.7.0.  */
@@ -331,22 +332,22 @@ free_symkey_enc( PKT_symkey_enc *enc )
 //   xfree (uid);
 // }
 
-// void
-// free_compressed( PKT_compressed *zd )
-// {
-//   if (!zd)
-//     return;
+void
+free_compressed( PKT_compressed *zd )
+{
+  if (!zd)
+    return;
 
-//   if (zd->buf)
-//     {
-//       /* We need to skip some bytes.  Because don't have any
-//        * information about the length, so we assume this is the last
-//        * packet */
-//       while (iobuf_read( zd->buf, NULL, 1<<30 ) != -1)
-//         ;
-//     }
-//   xfree(zd);
-// }
+  if (zd->buf)
+    {
+      /* We need to skip some bytes.  Because don't have any
+       * information about the length, so we assume this is the last
+       * packet */
+      while (iobuf_read( zd->buf, NULL, 1<<30 ) != -1)
+        ;
+    }
+  xfree(zd);
+}
 
 void
 free_encrypted( PKT_encrypted *ed )
@@ -431,7 +432,6 @@ free_packet (PACKET *pkt, parse_packet_ctx_t parsectx)
 
   //if (DBG_MEMORY)
     // printf ("free_packet() type=%d\n", pkt->pkttype);
-  return;
   /* If we have a parser context holding PKT then do not free the
    * packet but set a flag that the packet in the parser context is
    * now a deep copy.  */
@@ -469,7 +469,7 @@ free_packet (PACKET *pkt, parse_packet_ctx_t parsectx)
   //    free_user_id (pkt->pkt.user_id);
       break;
     case PKT_COMPRESSED:
-//      free_compressed (pkt->pkt.compressed);
+      free_compressed (pkt->pkt.compressed);
       break;
     case PKT_ENCRYPTED:
     case PKT_ENCRYPTED_MDC:
@@ -109,6 +109,14 @@ struct server_control_s
   char *passphrase;
   unsigned char *session_key;
   size_t enc_length;
+
+  /* Where the decrypted literal data goes (see sink.h); NULL for the
+     UART.  */
+  struct plaintext_sink_s *sink;
+
+  /* The decrypt session the message is part of (see session.h), whose
+     cipher handle decrypt_data borrows; NULL to open one.  */
+  struct decrypt_session_s *session;
 };
 
 
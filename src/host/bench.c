@@ -0,0 +1,581 @@
+/* bench.c - host microbenchmarks for the decrypt core
+ *
+ * Built by `make host`; run build/host/bench [-n iterations] [-v].
+ * Every figure comes from the same sources that go into kernel1.img, so
+ * perf/valgrind/gprof can be pointed at the binary directly.
+ *
+ * Reported per vector:
+ *   cfb-dec  _gcry_cipher_decrypt over the SED body (setkey+setiv included)
+ *   cfb-enc  _gcry_cipher_encrypt over a buffer of the same size
+ *   parse    parse_packet over the SKESK and SED headers, the body left
+ *            unread: packets per second and ns per packet instead
+ *   e2e      decrypt_memory on the whole message, into a digest sink
+ *   e2e-s2k  the same from the passphrase, starting with an empty S2K
+ *            cache: one key derivation, then cache hits
+ *   session  e2e as a queue through one decrypt session (session.h),
+ *            with the buffers and keyed cipher handle carried over; the
+ *            text line adds the failures, how often the handle was
+ *            keyed and the heap the session keeps.  Also for the AES
+ *            MDC and OCB messages below, from the passphrase
+ * for the 10k text as gpg 2.2 encrypts it with MDC, in CAST5, AES and
+ * AES256 (encrypted.{mdc,aes128,aes256}.10k.h):
+ *   e2e-mdc  as e2e-s2k, with the SHA-1 MDC checked as it decrypts;
+ *            then once more with a byte of the body flipped, which must
+ *            fail with GPG_ERR_BAD_SIGNATURE
+ * for the same text in AES-128 OCB and EAX packets behind a v5 SKESK
+ * (encrypted.{ocb,eax}.10k.h; no gpg 2.2 writes these, they were made
+ * with the system libgcrypt):
+ *   e2e-aead as e2e-mdc, with the chunk tags checked as it decrypts
+ * for the same text compressed by gpg 2.2 with ZIP and ZLIB, and for
+ * 4 MiB of it repeated with ZLIB (encrypted.{zip,zlib}.10k.h,
+ * encrypted.zlib.4m.h):
+ *   e2e-zip  as e2e-mdc, inflating behind the MDC check; the heap peak
+ *            at the end must not grow with the 4 MiB
+ * for the AES message ASCII armored (encrypted.aes128.10k.asc.h):
+ *   e2e-asc  as e2e-mdc, through the armor filter; compare with e2e-mdc
+ *            aes for its cost.  The flipped byte is in the radix-64
+ *            text, so the CRC-24 check may fail first (GPG_ERR_INV_ARMOR)
+ * for the 1k message, the AES MDC message and the ZIP one, into a memory
+ * sink too small for the text:
+ *   sink     decrypt_memory must fail with the sink's error,
+ *            GPG_ERR_BUFFER_TOO_SHORT, and the total must count only
+ *            the bytes the sink stored
+ * for AES and AES256:
+ *   cfb-dec  _gcry_cipher_decrypt over 100 KiB
+ *   ocb-dec  the same in OCB mode, one 100 KiB chunk
+ *   eax-dec  the same in EAX mode
+ * and once, for the key the first three share:
+ *   s2k      gcry_kdf_derive, iterated+salted SHA-1 at count 0xFF (the
+ *            65011712 bytes hashed are the payload); checked against
+ *            vector_key
+ * MB/s is payload bytes per second, ns/block is per 8-byte cipher block.
+ * The e2e line is followed by the literal data's length and CRC-32
+ * (zlib.crc32 of the original file); -v sends the text to the console
+ * instead.
+ * The kernel heap statistics are printed at the end, and with make
+ * PROFILE=1 the per-stage table of src/prof.h over the whole run (TSC
+ * ticks, no events).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gpg.h"
+#include "gcrypt.h"
+#include "packet.h"
+#include "memory.h"
+#include "sink.h"
+#include "s2k-cache.h"
+#include "trace.h"
+#include "prof.h"
+#include "session.h"
+#include "encrypted.1k.h"
+#include "encrypted.10k.h"
+#include "encrypted.100k.h"
+#include "encrypted.mdc.10k.h"
+#include "encrypted.aes128.10k.h"
+#include "encrypted.aes256.10k.h"
+#include "encrypted.ocb.10k.h"
+#include "encrypted.eax.10k.h"
+#include "encrypted.zip.10k.h"
+#include "encrypted.zlib.10k.h"
+#include "encrypted.zlib.4m.h"
+#include "encrypted.aes128.10k.asc.h"
+
+/* printf.h maps printf to the (muted) UART; the report goes to stdout. */
+#undef printf
+
+/* Core entry points without a public header (see main.1.c). */
+int decrypt_memory (ctrl_t ctrl, const unsigned char *data, size_t length);
+void host_uart_enable (int on);
+
+#define BLOCKSIZE 8
+
+/* All three vectors were made with passphrase "password" and salt
+   0a0b0c0d0e0f1011; this is the resulting S2K SHA-1 CAST5 key.  */
+static const unsigned char vector_key[16] = {
+  0x69, 0x3b, 0x78, 0x47, 0xfa, 0x44, 0xcd, 0xc6,
+  0xe1, 0xc4, 0x03, 0xf5, 0xe4, 0x4e, 0x95, 0xc1
+};
+
+struct vector
+{
+  const char *name;
+  const unsigned char *data;
+  size_t len;
+};
+
+/* encrypted_100k_gpg_len in the header is stale, use the array size. */
+static const struct vector vectors[] = {
+  { "1k",   encrypted_1k_gpg,   sizeof encrypted_1k_gpg },
+  { "10k",  encrypted_10k_gpg,  sizeof encrypted_10k_gpg },
+  { "100k", encrypted_100k_gpg, sizeof encrypted_100k_gpg },
+};
+
+/* Passphrase "password", SHA-1 S2K at count 0xFF, MDC, no compression. */
+static const struct vector mdc_vectors[] = {
+  { "cast5",  encrypted_mdc_10k_gpg,    sizeof encrypted_mdc_10k_gpg },
+  { "aes",    encrypted_aes128_10k_gpg, sizeof encrypted_aes128_10k_gpg },
+  { "aes256", encrypted_aes256_10k_gpg, sizeof encrypted_aes256_10k_gpg },
+};
+
+/* The same with AEAD: OCB in 1 KiB chunks with partial body lengths,
+   EAX in 64 byte chunks with a fixed length.  */
+static const struct vector aead_vectors[] = {
+  { "ocb",    encrypted_ocb_10k_gpg,    sizeof encrypted_ocb_10k_gpg },
+  { "eax",    encrypted_eax_10k_gpg,    sizeof encrypted_eax_10k_gpg },
+};
+
+/* MDC vectors in AES with a compressed data packet around the literal
+   data: ZIP is raw deflate, ZLIB adds its header and Adler-32.  */
+static const struct vector zip_vectors[] = {
+  { "zip",    encrypted_zip_10k_gpg,    sizeof encrypted_zip_10k_gpg },
+  { "zlib",   encrypted_zlib_10k_gpg,   sizeof encrypted_zlib_10k_gpg },
+  { "zlib4m", encrypted_zlib_4m_gpg,    sizeof encrypted_zlib_4m_gpg },
+};
+
+/* mdc_vectors' "aes" in 64 column radix-64 with a CRC line.  */
+static const struct vector asc_vectors[] = {
+  { "aes",    encrypted_aes128_10k_asc, sizeof encrypted_aes128_10k_asc },
+};
+
+static double
+now (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+report (const char *what, const char *vec, size_t bytes, int iters,
+        double secs)
+{
+  double total = (double)bytes * iters;
+
+  /* Keep -v output in order; the report bypasses the UART.  */
+  trace_drain ();
+  fprintf (stdout, "%-8s %-6s %8zu bytes x %-5d %9.2f MB/s %9.1f ns/block\n",
+           what, vec, bytes, iters, total / secs / 1e6,
+           secs * 1e9 / (total / BLOCKSIZE));
+}
+
+/* Copy the body of the first SED packet (after the 15 byte SKESK) into
+   OUT, undoing partial body lengths.  Returns the body length.  */
+static size_t
+sed_body (const unsigned char *p, size_t n, unsigned char *out)
+{
+  size_t i = 16, o = 0, l;
+  unsigned c;
+
+  while (i < n)
+    {
+      c = p[i++];
+      if (c < 192)
+        l = c;
+      else if (c < 224)
+        l = ((c - 192) << 8) + p[i++] + 192;
+      else if (c == 255)
+        {
+          l = ((size_t)p[i] << 24) | (p[i+1] << 16) | (p[i+2] << 8) | p[i+3];
+          i += 4;
+        }
+      else
+        {
+          l = (size_t)1 << (c & 0x1f);
+          memcpy (out + o, p + i, l);
+          o += l;
+          i += l;
+          continue;
+        }
+      memcpy (out + o, p + i, l);
+      return o + l;
+    }
+  return o;
+}
+
+static void
+bench_cfb (const struct vector *v, int iters)
+{
+  unsigned char *body = malloc (v->len);
+  unsigned char *work = malloc (v->len);
+  gcry_cipher_hd_t hd;
+  size_t len = sed_body (v->data, v->len, body);
+  double t0, t1;
+  int i;
+
+  _gcry_cipher_open (&hd, GCRY_CIPHER_CAST5, GCRY_CIPHER_MODE_CFB);
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    {
+      memcpy (work, body, len);
+      _gcry_cipher_setkey (hd, vector_key, sizeof vector_key);
+      _gcry_cipher_setiv (hd, NULL, BLOCKSIZE);
+      _gcry_cipher_decrypt (hd, work, BLOCKSIZE + 2, NULL, 0);
+      cipher_sync (hd);
+      _gcry_cipher_decrypt (hd, work + BLOCKSIZE + 2, len - BLOCKSIZE - 2,
+                            NULL, 0);
+    }
+  t1 = now ();
+  if (work[BLOCKSIZE - 2] != work[BLOCKSIZE]
+      || work[BLOCKSIZE - 1] != work[BLOCKSIZE + 1])
+    fprintf (stdout, "cfb-dec  %-5s BAD KEY\n", v->name);
+  report ("cfb-dec", v->name, len, iters, t1 - t0);
+
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    {
+      _gcry_cipher_setkey (hd, vector_key, sizeof vector_key);
+      _gcry_cipher_setiv (hd, NULL, BLOCKSIZE);
+      _gcry_cipher_encrypt (hd, work, len, body, len);
+    }
+  t1 = now ();
+  report ("cfb-enc", v->name, len, iters, t1 - t0);
+
+  _gcry_cipher_close (hd);
+  free (work);
+  free (body);
+}
+
+static void
+bench_parse (const struct vector *v, int iters)
+{
+  struct parse_packet_ctx_s parsectx;
+  PACKET pkt;
+  iobuf_t a;
+  double t0, t1;
+  int i;
+
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    {
+      a = iobuf_temp_with_buffer (v->data, v->len);
+      init_parse_packet (&parsectx, a);
+      memset (&pkt, 0, sizeof pkt);
+      parse_packet (&parsectx, &pkt);   /* SKESK */
+      free_packet (&pkt, NULL);
+      memset (&pkt, 0, sizeof pkt);
+      parse_packet (&parsectx, &pkt);   /* SED header */
+      if (pkt.pkttype == PKT_ENCRYPTED || pkt.pkttype == PKT_ENCRYPTED_MDC)
+        pkt.pkt.encrypted->buf = NULL;  /* Leave the body unread.  */
+      free_packet (&pkt, NULL);
+      iobuf_close (a);
+    }
+  t1 = now ();
+
+  /* Two packet headers are not payload, so no MB/s here.  */
+  trace_drain ();
+  fprintf (stdout, "%-8s %-6s %8d pkts  x %-5d %9.2f Mpkt/s %8.1f ns/pkt\n",
+           "parse", v->name, 2, iters, 2.0 * iters / (t1 - t0) / 1e6,
+           (t1 - t0) * 1e9 / (2.0 * iters));
+}
+
+static void
+bench_e2e (const struct vector *v, int iters, int verbose)
+{
+  struct server_control_s ctrl;
+  struct sink_digest_s digest;
+  /* do_proc_packets copies the session key with strlen(); keep it
+     NUL-terminated the way main.1.c's 32 byte key buffers are.  */
+  unsigned char key[32] = { 0 };
+  double t0, t1;
+  int i;
+
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    {
+      memset (&ctrl, 0, sizeof ctrl);
+      memcpy (key, vector_key, sizeof vector_key);
+      ctrl.session_key = key;
+      sink_digest_init (&digest);
+      if (!verbose)
+        ctrl.sink = &digest.sink;
+      decrypt_memory (&ctrl, v->data, v->len);
+    }
+  t1 = now ();
+  report ("e2e", v->name, v->len, iters, t1 - t0);
+  if (!verbose)
+    fprintf (stdout, "text     %-6s %8zu bytes crc32 %08x\n", v->name,
+             digest.sink.total, (unsigned)digest.crc);
+}
+
+/* As e2e, but the ITERS decryptions are a queue of one decrypt
+   session (session.h), which keeps the buffers and the keyed cipher
+   handle from one message to the next.  PASSPHRASE NULL is for
+   vector_key.  */
+static void
+bench_session (const struct vector *v, const char *passphrase, int iters)
+{
+  struct decrypt_session_s s;
+  struct session_msg_s *queue = calloc (iters, sizeof *queue);
+  heap_stats_t st0, st1;
+  double t0, t1;
+  unsigned failed;
+  int i;
+
+  for (i = 0; i < iters; i++)
+    {
+      queue[i].data = v->data;
+      queue[i].len = v->len;
+      if (passphrase)
+        queue[i].passphrase = passphrase;
+      else
+        {
+          queue[i].session_key = vector_key;
+          queue[i].key_len = sizeof vector_key;
+        }
+    }
+  heap_get_stats (&st0);
+  session_open (&s);
+  t0 = now ();
+  failed = session_run (&s, queue, iters);
+  t1 = now ();
+  heap_get_stats (&st1);
+  report ("session", v->name, v->len, iters, t1 - t0);
+  fprintf (stdout, "text     %-6s %8zu bytes crc32 %08x, %u failed, "
+           "%u rekeys, %zu bytes kept\n", v->name,
+           queue[iters - 1].text_len, (unsigned)queue[iters - 1].text_crc,
+           failed, s.stats.rekeys, st1.in_use - st0.in_use);
+  session_close (&s);
+  free (queue);
+}
+
+static void
+bench_e2e_s2k (const struct vector *v, int iters)
+{
+  struct server_control_s ctrl;
+  struct sink_digest_s digest;
+  char passphrase[] = "password";
+  double t0, t1;
+  int i;
+
+  s2k_cache_clear ();
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    {
+      memset (&ctrl, 0, sizeof ctrl);
+      ctrl.passphrase = passphrase;
+      sink_digest_init (&digest);
+      ctrl.sink = &digest.sink;
+      decrypt_memory (&ctrl, v->data, v->len);
+    }
+  t1 = now ();
+  report ("e2e-s2k", v->name, v->len, iters, t1 - t0);
+}
+
+/* KIND is "mdc", "aead", "zip" or "asc", for the report.  */
+static void
+bench_mdc (const struct vector *v, const char *kind, int iters)
+{
+  char what[16];
+  struct server_control_s ctrl;
+  struct sink_digest_s digest;
+  char passphrase[] = "password";
+  unsigned char *tampered;
+  double t0, t1;
+  int i, rc = 0, detected;
+
+  s2k_cache_clear ();
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    {
+      memset (&ctrl, 0, sizeof ctrl);
+      ctrl.passphrase = passphrase;
+      sink_digest_init (&digest);
+      ctrl.sink = &digest.sink;
+      rc = decrypt_memory (&ctrl, v->data, v->len);
+    }
+  t1 = now ();
+  strcpy (what, "e2e-");
+  strcat (what, kind);
+  report (what, v->name, v->len, iters, t1 - t0);
+  fprintf (stdout, "text     %-6s %8zu bytes crc32 %08x rc %d\n", v->name,
+           digest.sink.total, (unsigned)digest.crc, rc);
+
+  /* Flip a bit in the middle of the encrypted literal data.  */
+  tampered = malloc (v->len);
+  memcpy (tampered, v->data, v->len);
+  tampered[v->len / 2] ^= 0x01;
+  memset (&ctrl, 0, sizeof ctrl);
+  ctrl.passphrase = passphrase;
+  sink_digest_init (&digest);
+  ctrl.sink = &digest.sink;
+  rc = decrypt_memory (&ctrl, tampered, v->len);
+  free (tampered);
+  /* Only armor may catch the flipped byte before the MDC does.  */
+  detected = (gpg_err_code (rc) == GPG_ERR_BAD_SIGNATURE
+              || (!strcmp (kind, "asc")
+                  && gpg_err_code (rc) == GPG_ERR_INV_ARMOR));
+  fprintf (stdout, "%-8s %-6s tampered rc %d (%s)\n", kind, v->name, rc,
+           detected ? "ok" : "NOT DETECTED");
+}
+
+/* A sink whose write fails must fail the message with its error, also
+   from inside an MDC or compressed packet.  PASSPHRASE NULL means the
+   session key.  */
+static void
+check_sink_error (const struct vector *v, const char *passphrase)
+{
+  struct server_control_s ctrl;
+  struct sink_memory_s mem;
+  unsigned char key[32] = { 0 };
+  char pass[16];
+  byte buf[100];
+  int rc;
+
+  memset (&ctrl, 0, sizeof ctrl);
+  if (passphrase)
+    {
+      strcpy (pass, passphrase);
+      ctrl.passphrase = pass;
+    }
+  else
+    {
+      memcpy (key, vector_key, sizeof vector_key);
+      ctrl.session_key = key;
+    }
+  sink_memory_init (&mem, buf, sizeof buf);
+  ctrl.sink = &mem.sink;
+  rc = decrypt_memory (&ctrl, v->data, v->len);
+  fprintf (stdout, "sink     %-6s full rc %d total %zu stored %zu (%s)\n",
+           v->name, rc, mem.sink.total, mem.len,
+           gpg_err_code (rc) == GPG_ERR_BUFFER_TOO_SHORT
+           && mem.sink.total == mem.len ? "ok" : "NOT PROPAGATED");
+}
+
+/* MODE is GCRY_CIPHER_MODE_CFB, _OCB or _EAX; the AEAD modes take a
+   nonce of OpenPGP's length and decrypt the buffer as one final chunk,
+   without a tag check.  */
+static void
+bench_cipher (int algo, int mode, const char *name, int iters)
+{
+  size_t len = 100 * 1024;
+  unsigned char key[32], iv[16] = { 0 };
+  const char *what = (mode == GCRY_CIPHER_MODE_OCB ? "ocb-dec"
+                      : mode == GCRY_CIPHER_MODE_EAX ? "eax-dec" : "cfb-dec");
+  unsigned char *work = calloc (1, len);
+  gcry_cipher_hd_t hd;
+  double t0, t1;
+  int i;
+
+  for (i = 0; i < (int)sizeof key; i++)
+    key[i] = i;
+  if (_gcry_cipher_open (&hd, algo, mode)
+      || _gcry_cipher_setkey (hd, key, gcry_cipher_get_algo_keylen (algo)))
+    {
+      fprintf (stdout, "%-8s %-6s setup failed\n", what, name);
+      free (work);
+      return;
+    }
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    {
+      _gcry_cipher_setiv (hd, iv,
+                          mode == GCRY_CIPHER_MODE_OCB ? 15 : sizeof iv);
+      _gcry_cipher_final (hd);
+      _gcry_cipher_decrypt (hd, work, len, NULL, 0);
+    }
+  t1 = now ();
+  report (what, name, len, iters, t1 - t0);
+  _gcry_cipher_close (hd);
+  free (work);
+}
+
+static void
+bench_s2k (int iters)
+{
+  static const unsigned char salt[8] = {
+    0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11
+  };
+  const unsigned long count = (16UL + (0xff & 15)) << ((0xff >> 4) + 6);
+  unsigned char key[16];
+  double t0, t1;
+  int i;
+
+  t0 = now ();
+  for (i = 0; i < iters; i++)
+    if (gcry_kdf_derive ("password", 8, GCRY_KDF_ITERSALTED_S2K, GCRY_MD_SHA1,
+                         salt, sizeof salt, count, sizeof key, key))
+      break;
+  t1 = now ();
+  report ("s2k", "0xff", count, iters, t1 - t0);
+  if (memcmp (key, vector_key, sizeof key))
+    fprintf (stdout, "s2k      key mismatch\n");
+}
+
+int
+main (int argc, char **argv)
+{
+  int iters = 100, verbose = 0;
+  heap_stats_t st;
+  size_t i;
+  int j;
+
+  for (j = 1; j < argc; j++)
+    {
+      if (!strcmp (argv[j], "-n") && j + 1 < argc)
+        iters = atoi (argv[++j]);
+      else if (!strcmp (argv[j], "-v"))
+        {
+          host_uart_enable (1);
+          verbose = 1;
+        }
+      else
+        {
+          fprintf (stderr, "usage: %s [-n iterations] [-v]\n", argv[0]);
+          return 2;
+        }
+    }
+  if (iters < 1)
+    iters = 1;
+
+  for (i = 0; i < sizeof vectors / sizeof *vectors; i++)
+    {
+      bench_cfb (&vectors[i], iters);
+      bench_parse (&vectors[i], iters);
+      bench_e2e (&vectors[i], iters, verbose);
+      bench_e2e_s2k (&vectors[i], iters);
+    }
+
+  for (i = 0; i < sizeof vectors / sizeof *vectors; i++)
+    bench_session (&vectors[i], NULL, iters);
+  bench_session (&mdc_vectors[1], "password", iters);
+  bench_session (&aead_vectors[0], "password", iters);
+
+  for (i = 0; i < sizeof mdc_vectors / sizeof *mdc_vectors; i++)
+    bench_mdc (&mdc_vectors[i], "mdc", iters);
+  for (i = 0; i < sizeof aead_vectors / sizeof *aead_vectors; i++)
+    bench_mdc (&aead_vectors[i], "aead", iters);
+  for (i = 0; i < sizeof zip_vectors / sizeof *zip_vectors; i++)
+    bench_mdc (&zip_vectors[i], "zip", iters);
+  for (i = 0; i < sizeof asc_vectors / sizeof *asc_vectors; i++)
+    bench_mdc (&asc_vectors[i], "asc", iters);
+  check_sink_error (&vectors[0], NULL);
+  check_sink_error (&mdc_vectors[1], "password");
+  check_sink_error (&zip_vectors[0], "password");
+  for (j = 0; j < 3; j++)
+    {
+      static const int modes[3] = {
+        GCRY_CIPHER_MODE_CFB, GCRY_CIPHER_MODE_OCB, GCRY_CIPHER_MODE_EAX
+      };
+
+      bench_cipher (GCRY_CIPHER_AES, modes[j], "aes", iters);
+      bench_cipher (GCRY_CIPHER_AES256, modes[j], "aes256", iters);
+    }
+  bench_s2k (iters < 3 ? iters : 3);
+
+  heap_get_stats (&st);
+  fprintf (stdout, "heap     %zu bytes in use (peak %zu) in %zu blocks, "
+           "%zu free, largest %zu, fragmentation %u%%\n",
+           st.in_use, st.peak_in_use, st.allocations, st.free_bytes,
+           st.largest_free, st.fragmentation);
+  if (PROF_ON)
+    {
+      host_uart_enable (1);
+      prof_dump ();
+    }
+  return 0;
+}
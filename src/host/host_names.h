@@ -0,0 +1,23 @@
+/* host_names.h - rename the kernel's libc replacements for host builds
+ *
+ * memory.c supplies malloc/free and the string routines the bare-metal
+ * kernel needs.  On the host they would interpose on the C library
+ * (whose stdio expects its own allocator and alignment), so every core
+ * object is compiled with this header forced in (-include) and links
+ * against the kernel versions under a kernel_ prefix instead.
+ */
+#ifndef HOST_NAMES_H
+#define HOST_NAMES_H
+
+#define malloc  kernel_malloc
+#define free    kernel_free
+#define memset  kernel_memset
+#define memcpy  kernel_memcpy
+#define memmove kernel_memmove
+#define strcpy  kernel_strcpy
+#define strchr  kernel_strchr
+#define memcmp  kernel_memcmp
+#define strcmp  kernel_strcmp
+#define strdup  kernel_strdup
+
+#endif /* HOST_NAMES_H */
@@ -0,0 +1,94 @@
+/* host_shim.c - stand-ins for the bare-metal environment on a Linux host
+ *
+ * The decrypt core is built unchanged for the host (make host).  The
+ * only things it needs from the kernel are the printf/UART pair from
+ * printf.c/main.1.c and the heap arena that linker.ld reserves for
+ * memory.c.  Both are provided here.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "trace.h"
+
+/* memory.c allocates from [__heap_start, __heap_end).  The kernel gets
+   2MB from linker.ld; the host can afford more so that long benchmark
+   runs are not limited by the allocator's fragmentation.  */
+#define HOST_HEAP_SIZE 0x4000000
+#define HOST_STR_(x) #x
+#define HOST_STR(x) HOST_STR_(x)
+
+__asm__ (".section .bss\n"
+         ".balign 16\n"
+         ".globl __heap_start\n"
+         "__heap_start:\n"
+         ".skip " HOST_STR (HOST_HEAP_SIZE) "\n"
+         ".globl __heap_end\n"
+         "__heap_end:\n"
+         ".previous\n");
+
+/* UART0.  Output is dropped unless host_uart_enable() is called, so
+   that benchmarks measure the decrypt path rather than the console.  */
+static int uart_enabled;
+static void (*uart_putf) (void *, char);
+static void *uart_putp;
+
+void
+host_uart_enable (int on)
+{
+  uart_enabled = on;
+}
+
+void
+init_printf (void *putp, void (*putf) (void *, char))
+{
+  uart_putp = putp;
+  uart_putf = putf;
+}
+
+void
+tfp_printf (char *fmt, ...)
+{
+  char line[1024];
+  va_list va;
+  int n, i;
+
+  if (!uart_enabled)
+    return;
+  trace_drain ();
+
+  va_start (va, fmt);
+  n = vsnprintf (line, sizeof line, fmt, va);
+  va_end (va);
+  if (n > (int)sizeof line - 1)
+    n = sizeof line - 1;
+
+  if (uart_putf)
+    for (i = 0; i < n; i++)
+      uart_putf (uart_putp, line[i]);
+  else
+    fwrite (line, 1, n, stdout);
+}
+
+void
+tfp_write (const char *buf, size_t len)
+{
+  if (!uart_enabled)
+    return;
+  trace_drain ();
+  if (uart_putf)
+    while (len--)
+      uart_putf (uart_putp, *buf++);
+  else
+    fwrite (buf, 1, len, stdout);
+}
+
+void
+tfp_sprintf (char *s, char *fmt, ...)
+{
+  va_list va;
+
+  va_start (va, fmt);
+  vsprintf (s, fmt, va);
+  va_end (va);
+}
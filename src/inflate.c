@@ -0,0 +1,609 @@
+#include "inflate.h"
+#include "gpg-error.h"
+#include "memory.h"
+#include "trace.h"
+
+enum {
+    MODE_HEADER,    // zlib CMF/FLG
+    MODE_BLOCK,     // Next block header
+    MODE_STORED,    // COPY bytes of a stored block left
+    MODE_CODES,     // Inside a Huffman block
+    MODE_MATCH,     // COPY bytes of a match at DIST left
+    MODE_TRAILER,   // zlib Adler-32
+    MODE_DONE
+};
+
+#define WMASK (INFLATE_WINDOW - 1)
+#define LEN_SIZE (1u << INFLATE_LEN_BITS)
+#define DIST_SIZE (1u << INFLATE_DIST_BITS)
+
+// Literal/length table entry: bits 0-3 are the length of the first
+// code, 4-7 that of both codes, 8-9 the number of symbols (0 when the
+// code is longer than the table), 10-18 the first symbol and 19-26 the
+// second, which is always a literal.
+#define ENT1(len, sym) ((len) | (len) << 4 | 1u << 8 | (uint32_t)(sym) << 10)
+#define ENT2(len1, len, sym1, sym2) \
+    ((len1) | (len) << 4 | 2u << 8 | (uint32_t)(sym1) << 10 | (uint32_t)(sym2) << 19)
+#define ENT_LEN1(e) ((e) & 15)
+#define ENT_LEN(e) (((e) >> 4) & 15)
+#define ENT_N(e) (((e) >> 8) & 3)
+#define ENT_SYM1(e) (((e) >> 10) & 0x1ff)
+#define ENT_SYM2(e) ((e) >> 19)
+
+// Distance table entry: code length in bits 0-3 (0 for a long code),
+// symbol above.
+#define DENT(len, sym) ((len) | (sym) << 4)
+
+static const uint16_t len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+// Order of the code length code lengths in a dynamic block header.
+static const uint8_t clen_order[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+// The next input byte.  Past the end of the input zero bytes are
+// returned and counted in OVERRUN, so that the bit buffer can always be
+// topped up; consuming any of them is a truncated stream.
+static unsigned next_byte(inflate_t* z) {
+    if (z->inpos == z->inlen) {
+        z->inpos = 0;
+        z->inlen = z->overrun ? 0 : z->read(z->opaque, z->in, sizeof z->in);
+        if (!z->inlen) {
+            z->overrun += 8;
+            return 0;
+        }
+    }
+    return z->in[z->inpos++];
+}
+
+// Make sure at least N (at most 25) bits are buffered.
+static void need(inflate_t* z, unsigned n) {
+    while (z->bitcnt < n) {
+        z->bitbuf |= (uint32_t)next_byte(z) << z->bitcnt;
+        z->bitcnt += 8;
+    }
+}
+
+static void drop(inflate_t* z, unsigned n) {
+    z->bitbuf >>= n;
+    z->bitcnt -= n;
+}
+
+// The next N (at most 16) bits.
+static unsigned bits(inflate_t* z, unsigned n) {
+    unsigned v;
+
+    need(z, n);
+    v = z->bitbuf & ((1u << n) - 1);
+    drop(z, n);
+    return v;
+}
+
+static unsigned reverse(unsigned code, unsigned len) {
+    unsigned r = 0;
+
+    while (len--) {
+        r = (r << 1) | (code & 1);
+        code >>= 1;
+    }
+    return r;
+}
+
+// Build the canonical code for LENS[0..N-1].  Returns the number of
+// unused codes (0 for a complete code) or -1 if it is over-subscribed.
+static int build(inflate_huff_t* h, const uint8_t* lens, unsigned n) {
+    uint16_t offs[16];
+    unsigned len, sym;
+    int left;
+
+    memset(h->count, 0, sizeof h->count);
+    for (sym = 0; sym < n; sym++)
+        h->count[lens[sym]]++;
+    left = 1;
+    for (len = 1; len < 16; len++) {
+        left = (left << 1) - h->count[len];
+        if (left < 0)
+            return -1;
+    }
+    offs[1] = 0;
+    for (len = 1; len < 15; len++)
+        offs[len + 1] = offs[len] + h->count[len];
+    for (sym = 0; sym < n; sym++)
+        if (lens[sym])
+            h->symbol[offs[lens[sym]]++] = sym;
+    return left;
+}
+
+// A code may only be incomplete if it has a single symbol (RFC 1951
+// allows one distance code; zlib also accepts this for literals).
+static int bad_code(const inflate_huff_t* h, int left, unsigned n) {
+    return left < 0 || (left > 0 && n - h->count[0] != 1);
+}
+
+// Decode one symbol bit by bit, for codes longer than the tables.
+static int slow_decode(inflate_t* z, const inflate_huff_t* h) {
+    int code = 0, first = 0, index = 0, count;
+    unsigned len;
+    uint32_t b;
+
+    need(z, 15);
+    b = z->bitbuf;
+    for (len = 1; len < 16; len++) {
+        code |= b & 1;
+        b >>= 1;
+        count = h->count[len];
+        if (code - count < first) {
+            drop(z, len);
+            return h->symbol[index + (code - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+// Fill the literal/length table from z->lenhuff: first every code up to
+// INFLATE_LEN_BITS long, then pair each literal with a following one
+// where both fit.  The entry for the bits after the first code is at a
+// lower index, so walking down reads it before it is paired itself.
+static void fill_lentab(inflate_t* z) {
+    const inflate_huff_t* h = &z->lenhuff;
+    uint32_t* t = z->lentab;
+    unsigned len, i, idx = 0, code = 0, r, len1;
+    uint32_t e, e2;
+
+    memset(t, 0, sizeof z->lentab);
+    for (len = 1; len <= INFLATE_LEN_BITS; len++) {
+        for (i = 0; i < h->count[len]; i++, idx++, code++)
+            for (r = reverse(code, len); r < LEN_SIZE; r += 1u << len)
+                t[r] = ENT1(len, h->symbol[idx]);
+        code <<= 1;
+    }
+    for (i = LEN_SIZE; i-- > 0;) {
+        e = t[i];
+        len1 = ENT_LEN1(e);
+        if (!ENT_N(e) || ENT_SYM1(e) > 255 || len1 == INFLATE_LEN_BITS)
+            continue;
+        e2 = t[i >> len1];
+        if (ENT_N(e2) && ENT_SYM1(e2) < 256 && ENT_LEN1(e2) <= INFLATE_LEN_BITS - len1)
+            t[i] = ENT2(len1, len1 + ENT_LEN1(e2), ENT_SYM1(e), ENT_SYM1(e2));
+    }
+}
+
+static void fill_disttab(inflate_t* z) {
+    const inflate_huff_t* h = &z->disthuff;
+    unsigned len, i, idx = 0, code = 0, r;
+
+    memset(z->disttab, 0, sizeof z->disttab);
+    for (len = 1; len <= INFLATE_DIST_BITS; len++) {
+        for (i = 0; i < h->count[len]; i++, idx++, code++)
+            for (r = reverse(code, len); r < DIST_SIZE; r += 1u << len)
+                z->disttab[r] = DENT(len, h->symbol[idx]);
+        code <<= 1;
+    }
+}
+
+static int fixed_tables(inflate_t* z) {
+    uint8_t lens[288];
+    unsigned i;
+
+    if (z->fixed)
+        return 0;
+    for (i = 0; i < 144; i++)
+        lens[i] = 8;
+    for (; i < 256; i++)
+        lens[i] = 9;
+    for (; i < 280; i++)
+        lens[i] = 7;
+    for (; i < 288; i++)
+        lens[i] = 8;
+    build(&z->lenhuff, lens, 288);
+    for (i = 0; i < 30; i++)
+        lens[i] = 5;
+    build(&z->disthuff, lens, 30);
+    fill_lentab(z);
+    fill_disttab(z);
+    z->fixed = 1;
+    return 0;
+}
+
+static int dynamic_tables(inflate_t* z) {
+    uint8_t lens[286 + 30];
+    inflate_huff_t clen;
+    unsigned nlen, ndist, ncode, i, rep;
+    int sym, left;
+    uint8_t len;
+
+    z->fixed = 0;
+    nlen = bits(z, 5) + 257;
+    ndist = bits(z, 5) + 1;
+    ncode = bits(z, 4) + 4;
+    if (nlen > 286 || ndist > 30)
+        return GPG_ERR_BAD_DATA;
+    memset(lens, 0, sizeof lens);
+    for (i = 0; i < ncode; i++)
+        lens[clen_order[i]] = bits(z, 3);
+    if (build(&clen, lens, 19))
+        return GPG_ERR_BAD_DATA;
+
+    for (i = 0; i < nlen + ndist;) {
+        sym = slow_decode(z, &clen);
+        if (sym < 0)
+            return GPG_ERR_BAD_DATA;
+        if (sym < 16) {
+            lens[i++] = sym;
+            continue;
+        }
+        if (sym == 16) {
+            if (!i)
+                return GPG_ERR_BAD_DATA;
+            len = lens[i - 1];
+            rep = 3 + bits(z, 2);
+        } else if (sym == 17) {
+            len = 0;
+            rep = 3 + bits(z, 3);
+        } else {
+            len = 0;
+            rep = 11 + bits(z, 7);
+        }
+        if (i + rep > nlen + ndist)
+            return GPG_ERR_BAD_DATA;
+        while (rep--)
+            lens[i++] = len;
+    }
+    if (z->overrun > z->bitcnt)
+        return GPG_ERR_TRUNCATED;
+    if (!lens[256])
+        return GPG_ERR_BAD_DATA;   // No end-of-block code
+
+    left = build(&z->lenhuff, lens, nlen);
+    if (bad_code(&z->lenhuff, left, nlen))
+        return GPG_ERR_BAD_DATA;
+    left = build(&z->disthuff, lens + nlen, ndist);
+    if (bad_code(&z->disthuff, left, ndist))
+        return GPG_ERR_BAD_DATA;
+    fill_lentab(z);
+    fill_disttab(z);
+    return 0;
+}
+
+static int read_header(inflate_t* z) {
+    unsigned cmf = bits(z, 8), flg = bits(z, 8);
+
+    if (z->overrun > z->bitcnt)
+        return GPG_ERR_TRUNCATED;
+    // Deflate with at most a 32 KiB window, no preset dictionary.
+    if ((cmf & 15) != 8 || (cmf >> 4) > 7 || (cmf << 8 | flg) % 31 || (flg & 0x20))
+        return GPG_ERR_BAD_DATA;
+    z->mode = MODE_BLOCK;
+    return 0;
+}
+
+static int read_block(inflate_t* z) {
+    unsigned type, len, nlen;
+    int err = 0;
+
+    z->last = bits(z, 1);
+    type = bits(z, 2);
+    switch (type) {
+    case 0:
+        drop(z, z->bitcnt & 7);
+        len = bits(z, 16);
+        nlen = bits(z, 16);
+        if (len != (~nlen & 0xffff))
+            return GPG_ERR_BAD_DATA;
+        z->copy = len;
+        z->mode = MODE_STORED;
+        break;
+    case 1:
+        err = fixed_tables(z);
+        z->mode = MODE_CODES;
+        break;
+    case 2:
+        err = dynamic_tables(z);
+        z->mode = MODE_CODES;
+        break;
+    default:
+        return GPG_ERR_BAD_DATA;
+    }
+    if (!err && z->overrun > z->bitcnt)
+        err = GPG_ERR_TRUNCATED;
+    return err;
+}
+
+// Append N bytes at P to the window.
+static void window_put(inflate_t* z, const unsigned char* p, size_t n) {
+    size_t k;
+
+    if (n >= INFLATE_WINDOW) {
+        p += n - INFLATE_WINDOW;
+        n = INFLATE_WINDOW;
+    }
+    k = INFLATE_WINDOW - z->wpos;
+    if (k > n)
+        k = n;
+    memcpy(z->window + z->wpos, p, k);
+    memcpy(z->window, p + k, n - k);
+    z->wpos = (z->wpos + n) & WMASK;
+}
+
+static int copy_stored(inflate_t* z, unsigned char* out, size_t* pos, size_t size) {
+    size_t o = *pos, n;
+
+    // Whole bytes still in the bit buffer come first.
+    while (z->copy && o < size && z->bitcnt >= 8) {
+        if (z->overrun >= z->bitcnt)
+            return GPG_ERR_TRUNCATED;
+        out[o] = z->bitbuf & 0xff;
+        window_put(z, out + o++, 1);
+        drop(z, 8);
+        z->copy--;
+    }
+    while (z->copy && o < size) {
+        if (z->inpos == z->inlen) {
+            z->inpos = 0;
+            z->inlen = z->overrun ? 0 : z->read(z->opaque, z->in, sizeof z->in);
+            if (!z->inlen)
+                return GPG_ERR_TRUNCATED;
+        }
+        n = z->inlen - z->inpos;
+        if (n > z->copy)
+            n = z->copy;
+        if (n > size - o)
+            n = size - o;
+        memcpy(out + o, z->in + z->inpos, n);
+        window_put(z, out + o, n);
+        z->inpos += n;
+        z->copy -= n;
+        o += n;
+    }
+    if (!z->copy)
+        z->mode = z->last ? MODE_TRAILER : MODE_BLOCK;
+    *pos = o;
+    return 0;
+}
+
+// Copy what fits of the pending match.
+static void copy_match(inflate_t* z, unsigned char* out, size_t* pos, size_t size) {
+    unsigned char* win = z->window;
+    unsigned wp = z->wpos, from = (z->wpos - z->dist) & WMASK;
+    unsigned copy = z->copy;
+    size_t o = *pos;
+    unsigned char c;
+
+    while (copy && o < size) {
+        c = win[from];
+        from = (from + 1) & WMASK;
+        win[wp] = c;
+        wp = (wp + 1) & WMASK;
+        out[o++] = c;
+        copy--;
+    }
+    z->wpos = wp;
+    z->copy = copy;
+    if (!copy)
+        z->mode = MODE_CODES;
+    *pos = o;
+}
+
+// Decode literals and matches until the block ends, OUT is full or a
+// match does not fit.  BASE is the number of window bytes that were
+// valid when the call started.  The bit buffer and the window position
+// live in locals: stores through OUT could alias them otherwise.
+static int decode_codes(inflate_t* z, unsigned char* out, size_t* pos, size_t size,
+                        unsigned base) {
+    const uint32_t* lentab = z->lentab;
+    const uint16_t* disttab = z->disttab;
+    unsigned char* win = z->window;
+    uint32_t bb = z->bitbuf, e;
+    unsigned bc = z->bitcnt, wp = z->wpos;
+    unsigned len, dist, n, from;
+    size_t o = *pos;
+    int sym, err = 0;
+    unsigned char c;
+
+#define NEED(k) while (bc < (k)) { bb |= (uint32_t)next_byte(z) << bc; bc += 8; }
+#define DROP(k) (bb >>= (k), bc -= (k))
+#define EMIT(ch) (c = (ch), out[o++] = c, win[wp] = c, wp = (wp + 1) & WMASK)
+#define SLOW(h) (z->bitbuf = bb, z->bitcnt = bc, sym = slow_decode(z, h), \
+                 bb = z->bitbuf, bc = z->bitcnt)
+
+    while (o < size) {
+        NEED(25);
+        e = lentab[bb & (LEN_SIZE - 1)];
+        if (ENT_N(e) == 2 && size - o >= 2) {
+            DROP(ENT_LEN(e));
+            EMIT(ENT_SYM1(e));
+            EMIT(ENT_SYM2(e));
+            continue;
+        }
+        if (ENT_N(e)) {
+            sym = ENT_SYM1(e);
+            DROP(ENT_LEN1(e));
+        } else {
+            SLOW(&z->lenhuff);
+            if (sym < 0) {
+                err = GPG_ERR_BAD_DATA;
+                break;
+            }
+        }
+        if (sym < 256) {
+            EMIT(sym);
+            continue;
+        }
+        if (sym == 256) {
+            z->mode = z->last ? MODE_TRAILER : MODE_BLOCK;
+            break;
+        }
+
+        sym -= 257;
+        if (sym >= 29) {
+            err = GPG_ERR_BAD_DATA;
+            break;
+        }
+        n = len_extra[sym];
+        len = len_base[sym] + (bb & ((1u << n) - 1));
+        DROP(n);
+
+        NEED(25);
+        e = disttab[bb & (DIST_SIZE - 1)];
+        if (e & 15) {
+            sym = e >> 4;
+            DROP(e & 15);
+        } else
+            SLOW(&z->disthuff);
+        if (sym < 0 || sym >= 30) {
+            err = GPG_ERR_BAD_DATA;
+            break;
+        }
+        NEED(13);
+        n = dist_extra[sym];
+        dist = dist_base[sym] + (bb & ((1u << n) - 1));
+        DROP(n);
+        if (z->overrun > bc) {
+            err = GPG_ERR_TRUNCATED;
+            break;
+        }
+        if (dist > base + o) {
+            err = GPG_ERR_BAD_DATA;    // Distance too far back
+            break;
+        }
+
+        from = (wp - dist) & WMASK;
+        while (len && o < size) {
+            EMIT(win[from]);
+            from = (from + 1) & WMASK;
+            len--;
+        }
+        if (len) {
+            z->copy = len;
+            z->dist = dist;
+            z->mode = MODE_MATCH;
+            break;
+        }
+    }
+    if (!err && z->overrun > bc)
+        err = GPG_ERR_TRUNCATED;
+
+#undef NEED
+#undef DROP
+#undef EMIT
+#undef SLOW
+
+    z->bitbuf = bb;
+    z->bitcnt = bc;
+    z->wpos = wp;
+    *pos = o;
+    return err;
+}
+
+static uint32_t adler32(uint32_t adler, const unsigned char* p, size_t n) {
+    uint32_t a = adler & 0xffff, b = adler >> 16;
+    size_t k;
+
+    while (n) {
+        // 5552 is the most bytes before B can overflow 32 bits.
+        k = n < 5552 ? n : 5552;
+        n -= k;
+        while (k--) {
+            a += *p++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return a | b << 16;
+}
+
+static int read_trailer(inflate_t* z) {
+    uint32_t check;
+    int i;
+
+    drop(z, z->bitcnt & 7);
+    for (check = 0, i = 0; i < 4; i++)
+        check = check << 8 | bits(z, 8);
+    if (z->overrun > z->bitcnt)
+        return GPG_ERR_TRUNCATED;
+    if (check != z->adler) {
+        TRACE(TRACE_ERROR, "inflate: Adler-32 mismatch\n");
+        return GPG_ERR_BAD_DATA;
+    }
+    return 0;
+}
+
+void inflate_init(inflate_t* z, int zlib, inflate_read_t read, void* opaque) {
+    z->read = read;
+    z->opaque = opaque;
+    z->zlib = zlib;
+    z->mode = zlib ? MODE_HEADER : MODE_BLOCK;
+    z->last = 0;
+    z->fixed = 0;
+    z->bitbuf = 0;
+    z->bitcnt = 0;
+    z->overrun = 0;
+    z->copy = 0;
+    z->dist = 0;
+    z->adler = 1;
+    z->wpos = 0;
+    z->whave = 0;
+    z->inpos = 0;
+    z->inlen = 0;
+}
+
+int inflate_read(inflate_t* z, unsigned char* out, size_t size, size_t* ret_len) {
+    unsigned base = z->whave;
+    size_t o = 0, summed = 0;
+    int err = 0;
+
+    while (o < size && !err) {
+        switch (z->mode) {
+        case MODE_HEADER:
+            err = read_header(z);
+            break;
+        case MODE_BLOCK:
+            err = read_block(z);
+            break;
+        case MODE_STORED:
+            err = copy_stored(z, out, &o, size);
+            break;
+        case MODE_CODES:
+            err = decode_codes(z, out, &o, size, base);
+            break;
+        case MODE_MATCH:
+            copy_match(z, out, &o, size);
+            break;
+        case MODE_TRAILER:
+            if (z->zlib) {
+                z->adler = adler32(z->adler, out + summed, o - summed);
+                summed = o;
+                err = read_trailer(z);
+            }
+            z->mode = MODE_DONE;
+            break;
+        default:
+            err = GPG_ERR_EOF;
+            break;
+        }
+    }
+    if (z->zlib)
+        z->adler = adler32(z->adler, out + summed, o - summed);
+    z->whave = base + o < INFLATE_WINDOW ? base + o : INFLATE_WINDOW;
+    *ret_len = o;
+    return err;
+}
@@ -0,0 +1,69 @@
+/* inflate.h - streaming DEFLATE (RFC 1951) and ZLIB (RFC 1950) decoder
+ *
+ * Decompresses the body of a compressed data packet (COMPRESS_ALGO_ZIP
+ * is raw DEFLATE, COMPRESS_ALGO_ZLIB adds the zlib header and Adler-32
+ * trailer) in pieces of whatever size the caller asks for.  Input is
+ * pulled through a read callback, so only output ever has to stop
+ * mid-block; all state, including the 32 KiB history window, is in one
+ * fixed-size inflate_t and nothing depends on the message size.
+ *
+ * Literal/length codes are decoded through a table indexed by the next
+ * INFLATE_LEN_BITS input bits whose entries hold up to two literals
+ * (the common case in text), distance codes through a single-symbol
+ * INFLATE_DIST_BITS table; longer codes fall back to a canonical
+ * bit-by-bit decode.
+ */
+#ifndef INFLATE_H
+#define INFLATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define INFLATE_WINDOW 32768   // Largest DEFLATE distance
+#define INFLATE_INBUF 2048     // Input read ahead per callback
+#define INFLATE_LEN_BITS 10
+#define INFLATE_DIST_BITS 8
+
+// Read up to SIZE bytes of compressed input into BUF; 0 at EOF.
+typedef size_t (*inflate_read_t)(void* opaque, unsigned char* buf, size_t size);
+
+// Canonical Huffman code, with the lookup table in the caller.
+typedef struct {
+    uint16_t count[16];        // Codes of each length
+    uint16_t symbol[288];      // Symbols ordered by code
+} inflate_huff_t;
+
+typedef struct inflate_s {
+    inflate_read_t read;
+    void* opaque;
+    int zlib;                  // Header and Adler-32 trailer expected
+    int mode;                  // Where inflate_read resumes
+    int last;                  // BFINAL of the current block
+    int fixed;                 // The tables hold the fixed codes
+    uint32_t bitbuf;           // Input bits, LSB first
+    unsigned bitcnt;
+    unsigned overrun;          // Zero bits appended past EOF
+    unsigned copy;             // Bytes left of a match or stored block
+    unsigned dist;             // Distance of the pending match
+    uint32_t adler;
+    unsigned wpos;             // Next write position in WINDOW
+    unsigned whave;            // Valid bytes in WINDOW, up to its size
+    size_t inpos, inlen;
+    inflate_huff_t lenhuff, disthuff;
+    uint32_t lentab[1 << INFLATE_LEN_BITS];
+    uint16_t disttab[1 << INFLATE_DIST_BITS];
+    unsigned char in[INFLATE_INBUF];
+    unsigned char window[INFLATE_WINDOW];
+} inflate_t;
+
+// Start decoding a stream; ZLIB selects RFC 1950 framing.
+void inflate_init(inflate_t* z, int zlib, inflate_read_t read, void* opaque);
+
+// Decompress up to SIZE bytes to OUT and set *RET_LEN.  Returns 0,
+// GPG_ERR_EOF once the end of the stream has been reached (*RET_LEN
+// may still be non-zero), GPG_ERR_BAD_DATA for a corrupt stream or
+// GPG_ERR_TRUNCATED if the input ends early.
+int inflate_read(inflate_t* z, unsigned char* out, size_t size,
+                 size_t* ret_len);
+
+#endif /* INFLATE_H */
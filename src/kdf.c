@@ -0,0 +1,154 @@
+/* kdf.c  - Key Derivation Functions
+ * Copyright (C) 1998, 2008, 2011 Free Software Foundation, Inc.
+ * Copyright (C) 2013 g10 Code GmbH
+ *
+ * This file is part of Libgcrypt.
+ *
+ * Libgcrypt is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser general Public License as
+ * published by the Free Software Foundation; either version 2.1 of
+ * the License, or (at your option) any later version.
+ *
+ * Libgcrypt is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Only the OpenPGP S2K modes, on SHA-1 (src/sha1.c).
+ */
+
+#include "gcrypt.h"
+#include "memory.h"
+#include "sha1.h"
+#include "trace.h"
+#include "prof.h"
+
+/* Transform a passphrase into a suitable key of length KEYSIZE and
+   store this key in the caller provided buffer KEYBUFFER.  The caller
+   must provide an HASHALGO, a valid ALGO and depending on that algo a
+   SALT of 8 bytes and the number of ITERATIONS.  Code taken from
+   gnupg/agent/protect.c:hash_passphrase.  */
+static gpg_err_code_t
+openpgp_s2k (const void *passphrase, size_t passphraselen,
+             int algo, int hashalgo,
+             const void *salt, size_t saltlen,
+             unsigned long iterations,
+             size_t keysize, void *keybuffer)
+{
+  SHA1_CTX md;
+  unsigned char digest[20];
+  unsigned char *pattern = NULL;
+  size_t patlen, count, used = 0;
+  int pass, i;
+  static const unsigned char zeroes[20];
+
+  if ((algo == GCRY_KDF_SALTED_S2K || algo == GCRY_KDF_ITERSALTED_S2K)
+      && (!salt || saltlen != 8))
+    return GPG_ERR_INV_VALUE;
+  if (hashalgo != GCRY_MD_SHA1)
+    return GPG_ERR_DIGEST_ALGO;
+
+  if (algo == GCRY_KDF_ITERSALTED_S2K)
+    {
+      /* The salt and passphrase repeated back to back; SHA1Repeat()
+         hashes that without copying it out COUNT times. */
+      patlen = saltlen + passphraselen;
+      pattern = xmalloc (patlen);
+      memcpy (pattern, salt, saltlen);
+      memcpy (pattern + saltlen, passphrase, passphraselen);
+    }
+
+  for (pass=0; used < keysize; pass++)
+    {
+      SHA1Init (&md);
+      /* Preset the hash context with zeroes for the extra passes.  */
+      SHA1Update (&md, zeroes, pass);
+
+      if (algo == GCRY_KDF_ITERSALTED_S2K)
+        {
+          count = iterations;
+          if (count < patlen)
+            count = patlen;
+          SHA1Repeat (&md, pattern, patlen, count);
+        }
+      else
+        {
+          if (algo == GCRY_KDF_SALTED_S2K)
+            SHA1Update (&md, salt, saltlen);
+          SHA1Update (&md, passphrase, passphraselen);
+        }
+
+      SHA1Final (digest, &md);
+      i = sizeof digest > keysize - used ? keysize - used : sizeof digest;
+      memcpy ((char*)keybuffer+used, digest, i);
+      used += i;
+    }
+  TRACE (TRACE_DEBUG, "openpgp_s2k: %d passes\n", pass);
+
+  wipememory (digest, sizeof digest);
+  if (pattern)
+    {
+      wipememory (pattern, patlen);
+      xfree (pattern);
+    }
+  return 0;
+}
+
+
+/* Derive a key from a passphrase.  KEYSIZE gives the requested size
+   of the keys in octets.  KEYBUFFER is a caller provided buffer
+   filled on success with the derived key.  The input passphrase is
+   taken from (PASSPHRASE,PASSPHRASELEN) which is an arbitrary memory
+   buffer.  ALGO specifies the KDF algorithm to use; these are the
+   constants GCRY_KDF_*.  SUBALGO specifies an algorithm used
+   internally by the KDF algorithms; this is usually a hash algorithm
+   but certain KDF algorithm may use it differently.  {SALT,SALTLEN}
+   is a salt as needed by most KDF algorithms.  ITERATIONS is a
+   positive integer parameter to most KDFs.  0 is returned on success,
+   or an error code on failure.  */
+gpg_error_t
+gcry_kdf_derive (const void *passphrase, size_t passphraselen,
+                 int algo, int subalgo,
+                 const void *salt, size_t saltlen,
+                 unsigned long iterations,
+                 size_t keysize, void *keybuffer)
+{
+  gpg_err_code_t ec;
+
+  PROF_BEGIN (PROF_S2K);
+  if (!passphrase)
+    {
+      ec = GPG_ERR_INV_DATA;
+      goto leave;
+    }
+  if (!keybuffer || !keysize)
+    {
+      ec = GPG_ERR_INV_VALUE;
+      goto leave;
+    }
+
+
+  switch (algo)
+    {
+    case GCRY_KDF_SIMPLE_S2K:
+    case GCRY_KDF_SALTED_S2K:
+    case GCRY_KDF_ITERSALTED_S2K:
+      if (!passphraselen)
+        ec = GPG_ERR_INV_DATA;
+      else
+        ec = openpgp_s2k (passphrase, passphraselen, algo, subalgo,
+                          salt, saltlen, iterations, keysize, keybuffer);
+      break;
+
+    default:
+      ec = GPG_ERR_UNKNOWN_ALGORITHM;
+      break;
+    }
+
+ leave:
+  PROF_END (PROF_S2K, algo == GCRY_KDF_ITERSALTED_S2K ? iterations : 0);
+  return gpg_error (ec);
+}
@@ -1,7 +1,14 @@
+#include "gcrypt.h"
 #include "libgcrypt.h"
 #include "memory.h"
 #include "printf.h"
 #include "sboxes.h"
+#include "trace.h"
+#include "smp.h"
+#include "prof.h"
+
+/* One line per cipher block; compiled out below TRACE_BLOCK. */
+#define printBlock(b) TRACE(TRACE_BLOCK, "%08X%08X\n", (b).msb, (b).lsb)
 
 u32 buf_get_le32(const void *_buf) {
     if (!_buf) {
@@ -83,26 +90,8 @@ void buf_xor_2dst(void *_dst1, void *_dst2, const void *_src, size_t len) {
 }
 
 void cipher_block_cpy(void *_dst, const void *_src, size_t blocksize) {
-    byte *dst = _dst;
-    const byte *src = _src;
-    u32 s[4];
-
-    if (blocksize == 8) {
-        s[0] = buf_get_he32(src);
-        s[1] = buf_get_he32(src + 4);
-        buf_put_he32(dst, s[0]);
-        buf_put_he32(dst + 4, s[1]);
-    }
-    else /* blocksize == 16 */ {
-        s[0] = buf_get_he32(src);
-        s[1] = buf_get_he32(src + 4);
-        s[2] = buf_get_he32(src + 8);
-        s[3] = buf_get_he32(src + 12);
-        buf_put_he32(dst, s[0]);
-        buf_put_he32(dst + 4, s[1]);
-        buf_put_he32(dst + 8, s[2]);
-        buf_put_he32(dst + 12, s[3]);
-    }
+    // memcpy moves whole words when both blocks are aligned
+    memcpy(_dst, _src, blocksize);
 }
 
 void cipher_block_xor_n_copy_2(void *dst_xor, const void *src_xor,
@@ -204,29 +193,133 @@ void printUint32Hex(uint32_t data)
   printf("%08X\n", data);
 }
 
-int _gcry_cipher_setkey(gcry_cipher_hd_t hd, const byte *key, size_t keylen)
+static int cast5_setkey(void *context, const byte *key, size_t keylen)
 {
-    // printf("_gcry_cipher_setkey\n");
-    uint32_t *keywords;
-    int i;
-        
-    Key key2 = {0, 0, 0, 0};
+    CAST5_context *ctx = context;
     int j = 0;
+
+    if (keylen != 16)
+        return GPG_ERR_INV_KEYLEN;
     for (int i = 0; i < 4; i++)
     {
-        hd->key[i] = (key[j] << 24) + (key[j + 1] << 16) + (key[j + 2] << 8) + key[j + 3];
-        // printf("key[%d] = 0x%08x\n", i, hd->key[i]);
+        ctx->key[i] = (key[j] << 24) + (key[j + 1] << 16) + (key[j + 2] << 8) + key[j + 3];
+        // printf("key[%d] = 0x%08x\n", i, ctx->key[i]);
         j += 4;
     }
-    
+    keySchedule(ctx->key, &ctx->ks, 0);
+
     return 0;//GPG_ERR_NO_ERROR;
 }
 
+static void cast5_encrypt_block(void *context, byte *out, const byte *in)
+{
+    CAST5_context *ctx = context;
+
+    bytesFromBlock(encrypt(&ctx->ks, blockFromBytes((uint8_t *)in), 0), out);
+}
+
+static void _gcry_cast5_cfb_dec(void *context, unsigned char *iv, void *outbuf_arg,
+                                const void *inbuf_arg, size_t nblocks);
+
+/* The ciphers this build can decrypt.  OpenPGP and libgcrypt share
+   the algorithm ids for all of them. */
+static const gcry_cipher_spec_t cipher_specs[] = {
+    { GCRY_CIPHER_CAST5,  "CAST5",  8,  16, cast5_setkey,
+      cast5_encrypt_block, _gcry_cast5_cfb_dec, NULL, NULL },
+    { GCRY_CIPHER_AES,    "AES",    16, 16, aes_setkey, aes_encrypt, aes_cfb_dec,
+      aes_ecb_enc, aes_ecb_dec },
+    { GCRY_CIPHER_AES192, "AES192", 16, 24, aes_setkey, aes_encrypt, aes_cfb_dec,
+      aes_ecb_enc, aes_ecb_dec },
+    { GCRY_CIPHER_AES256, "AES256", 16, 32, aes_setkey, aes_encrypt, aes_cfb_dec,
+      aes_ecb_enc, aes_ecb_dec },
+};
+
+static const gcry_cipher_spec_t *spec_from_algo(int algo)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof cipher_specs / sizeof *cipher_specs; i++)
+        if (cipher_specs[i].algo == algo)
+            return &cipher_specs[i];
+    return NULL;
+}
+
+size_t gcry_cipher_get_algo_keylen(int algo)
+{
+    const gcry_cipher_spec_t *spec = spec_from_algo(algo);
+
+    return spec ? spec->keylen : 0;
+}
+
+size_t gcry_cipher_get_algo_blklen(int algo)
+{
+    const gcry_cipher_spec_t *spec = spec_from_algo(algo);
+
+    return spec ? spec->blocksize : 0;
+}
+
+const char *gcry_cipher_algo_name(int algo)
+{
+    const gcry_cipher_spec_t *spec = spec_from_algo(algo);
+
+    return spec ? spec->name : "?";
+}
+
+int _gcry_cipher_open(gcry_cipher_hd_t *handle, int algo, int mode)
+{
+    const gcry_cipher_spec_t *spec = spec_from_algo(algo);
+    gcry_cipher_hd_t h;
+
+    *handle = NULL;
+    if (!spec)
+        return GPG_ERR_CIPHER_ALGO;
+    switch (mode)
+    {
+    case GCRY_CIPHER_MODE_CFB:
+        break;
+    case GCRY_CIPHER_MODE_OCB:
+    case GCRY_CIPHER_MODE_EAX:
+        /* Both are defined for 128-bit blocks only. */
+        if (spec->blocksize != 16 || !spec->ecb_enc)
+            return GPG_ERR_INV_CIPHER_MODE;
+        if (mode == GCRY_CIPHER_MODE_OCB && !spec->ecb_dec)
+            return GPG_ERR_INV_CIPHER_MODE;
+        break;
+    default:
+        return GPG_ERR_INV_CIPHER_MODE;
+    }
+    h = xmalloc_clear(sizeof *h);
+    if (!h)
+        return GPG_ERR_ENOMEM;
+    h->spec = spec;
+    h->mode = mode;
+    *handle = h;
+    return 0;
+}
+
+int _gcry_cipher_setkey(gcry_cipher_hd_t hd, const byte *key, size_t keylen)
+{
+    int rc;
+
+    // printf("_gcry_cipher_setkey\n");
+    PROF_BEGIN(PROF_SETKEY);
+    rc = hd->spec->setkey(&hd->context, key, keylen);
+    if (rc) {
+        PROF_END(PROF_SETKEY, 0);
+        return rc;
+    }
+    /* The key-only parts of the AEAD modes. */
+    if (hd->mode == GCRY_CIPHER_MODE_OCB)
+        _gcry_cipher_ocb_setkey(hd);
+    else if (hd->mode == GCRY_CIPHER_MODE_EAX)
+        _gcry_cipher_eax_setkey(hd);
+    PROF_END(PROF_SETKEY, keylen);
+    return 0;
+}
+
 void
 _gcry_cipher_close (gcry_cipher_hd_t h)
 {
-  size_t off;
-
   if (!h)
     return;
 
@@ -244,30 +337,62 @@ _gcry_cipher_close (gcry_cipher_hd_t h)
      actual size of this structure because we have no way to known
      how large the allocated area was when using a standard malloc. */
 //   off = h->handle_offset;
-//   wipememory (h, h->actual_handle_size);
+  wipememory (h, sizeof *h);
 
-  xfree ((char*)h - off);
+  xfree (h);
 }
 
 int _gcry_cipher_setiv(gcry_cipher_hd_t c, const void *iv, size_t ivlen) {
     //printf("_gcry_cipher_setiv %d\n", ivlen);
+    c->marks.tag = 0;
+    c->marks.finalize = 0;
+    if (c->mode == GCRY_CIPHER_MODE_OCB)
+        return _gcry_cipher_ocb_set_nonce(c, iv, ivlen);
+    if (c->mode == GCRY_CIPHER_MODE_EAX)
+        return _gcry_cipher_eax_set_nonce(c, iv, ivlen);
     c->unused = 0;
-    if (iv) {
+    if (ivlen > c->spec->blocksize)
+        ivlen = c->spec->blocksize;
+    memset(c->u_iv.iv, 0, c->spec->blocksize);
+    if (iv)
         memcpy(c->u_iv.iv, iv, ivlen);
-    } else {
-        memset(c->u_iv.iv, 0, ivlen);
-    }
     return 0;
 }
 
+int _gcry_cipher_authenticate(gcry_cipher_hd_t c, const void *abuf, size_t abuflen)
+{
+    if (c->mode == GCRY_CIPHER_MODE_OCB)
+        return _gcry_cipher_ocb_authenticate(c, abuf, abuflen);
+    if (c->mode == GCRY_CIPHER_MODE_EAX)
+        return _gcry_cipher_eax_authenticate(c, abuf, abuflen);
+    return GPG_ERR_INV_CIPHER_MODE;
+}
+
+int _gcry_cipher_final(gcry_cipher_hd_t c)
+{
+    c->marks.finalize = 1;
+    return 0;
+}
+
+int _gcry_cipher_checktag(gcry_cipher_hd_t c, const void *intag, size_t taglen)
+{
+    if (c->mode == GCRY_CIPHER_MODE_OCB)
+        return _gcry_cipher_ocb_check_tag(c, intag, taglen);
+    if (c->mode == GCRY_CIPHER_MODE_EAX)
+        return _gcry_cipher_eax_check_tag(c, intag, taglen);
+    return GPG_ERR_INV_CIPHER_MODE;
+}
+
 void cipher_sync(gcry_cipher_hd_t c) {
     // printf("cipher_sync %d\n", c->unused);
     if (c->unused) {
+        size_t blocksize = c->spec->blocksize;
+
         memmove(c->u_iv.iv + c->unused,
                 c->u_iv.iv,
-                8 - c->unused);
+                blocksize - c->unused);
         memcpy(c->u_iv.iv,
-               c->lastiv + 8 - c->unused,
+               c->lastiv + blocksize - c->unused,
                c->unused);
         c->unused = 0;
     }
@@ -284,7 +409,7 @@ _gcry_cipher_decrypt (gcry_cipher_hd_t h, void *out, size_t outsize,
                       const void *in, size_t inlen)
 {
     // printf("Caller params - in: %p, inlen: %zu\n", in, inlen);
-    printf("_gcry_cipher_decrypt inlen: %d, outSize: %d, unused: %d\n", inlen, outsize, h->unused);
+    TRACE(TRACE_DEBUG, "_gcry_cipher_decrypt inlen: %d, outSize: %d, unused: %d\n", inlen, outsize, h->unused);
   if (!in) /* Caller requested in-place encryption. */
     {
       // printf("Caller requested in-place encryption.\n");
@@ -317,6 +442,10 @@ if (inlen != outsize) {
 //       return -1;// GPG_ERR_MISSING_KEY;
 //     }
 
+  if (h->mode == GCRY_CIPHER_MODE_OCB)
+    return _gcry_cipher_ocb_decrypt (h, out, outsize, in, inlen);
+  if (h->mode == GCRY_CIPHER_MODE_EAX)
+    return _gcry_cipher_eax_decrypt (h, out, outsize, in, inlen);
   return _gcry_cipher_cfb_decrypt (h, out, outsize, in, inlen);
 }
 
@@ -330,31 +459,26 @@ static void hexdump(const char *desc, const void *data, size_t len) {
     printf("\n");
 }
 
-static void ascii_dump(const unsigned char *data, size_t len) {
-    // Print the data directly, allowing special characters to be interpreted
-    for (size_t i = 0; i < len; i++) {
-        printf("%c", data[i]);
-    }
-
-    // for (size_t i = 0; i < len; i++) {
-    //     printf("%02x", data[i]);
-    // }
-}
+#ifdef USE_ARM_ASM
+/* src/cast5-arm.s; NBLOCKS must be even and non-zero. */
+extern void cast5_arm_cfb_dec(const KeySchedule *ks, unsigned char *outbuf,
+                              const unsigned char *inbuf, unsigned char *iv,
+                              size_t nblocks);
+#endif
 
-static void _gcry_cast5_cfb_dec(gcry_cipher_hd_t context, unsigned char *iv, void *outbuf_arg,
+static void _gcry_cast5_cfb_dec(void *context, unsigned char *iv, void *outbuf_arg,
                               const void *inbuf_arg, size_t nblocks) {
                                 #define CAST5_BLOCKSIZE 8
-    // CAST5_context *ctx = context;
-    printf("_gcry_cast5_cfb_dec\n");
+    CAST5_context *ctx = context;
     unsigned char *outbuf = outbuf_arg;
     const unsigned char *inbuf = inbuf_arg;
-    unsigned char tmpbuf[CAST5_BLOCKSIZE * 3];
+    unsigned char tmpbuf[CAST5_BLOCKSIZE * 3] __attribute__ ((aligned (4)));
     struct Block ivBlock, tmpBlock;
 // for (int i = 0; i < 4; i++)
 //     {
 //         printf("key[%d] = 0x%08x\n", i, context->key[i]);
 //     }
-    printf("nblocks: %d\n", nblocks);
+    TRACE(TRACE_DEBUG, "_gcry_cast5_cfb_dec nblocks: %d\n", nblocks);
     // hexdump("Input buffer", inbuf_arg, nblocks * CAST5_BLOCKSIZE);
     // hexdump("IV", iv, CAST5_BLOCKSIZE);
 // #ifdef USE_AMD64_ASM
@@ -368,16 +492,19 @@ static void _gcry_cast5_cfb_dec(gcry_cipher_hd_t context, unsigned char *iv, voi
 //             }
 //         }
 //     }
-// #elif defined(USE_ARM_ASM)
-//     {
-//         while (nblocks >= 2) {
-//             *gcry*cast5_arm_cfb_dec(ctx, outbuf, inbuf, iv);
-//             nblocks -= 2;
-//             outbuf += 2 * CAST5_BLOCKSIZE;
-//             inbuf += 2 * CAST5_BLOCKSIZE;
-//         }
-//     }
 // #endif
+#ifdef USE_ARM_ASM
+    /* Even block counts go to the two-way interleaved assembly; an odd
+       trailing block falls through to the C tail loop below. */
+    if (nblocks >= 2) {
+        size_t n = nblocks & ~(size_t)1;
+
+        cast5_arm_cfb_dec(&ctx->ks, outbuf, inbuf, iv, n);
+        nblocks -= n;
+        outbuf += n * CAST5_BLOCKSIZE;
+        inbuf += n * CAST5_BLOCKSIZE;
+    }
+#endif
     int debugCount = 1;
 // #if !defined(USE_AMD64_ASM) && !defined(USE_ARM_ASM)
     for (; nblocks >= 3; nblocks -= 3) {
@@ -393,7 +520,7 @@ static void _gcry_cast5_cfb_dec(gcry_cipher_hd_t context, unsigned char *iv, voi
         for (int i = 0; i < 3; i++) {
             struct Block block = blockFromBytes(tmpbuf + (i * CAST5_BLOCKSIZE));
             // if(debugCount>0 && i==0){ printf("%d in :",i); printBlock(block);}
-            block = encrypt(context->key, block, 0);//debugCount>0 && i==0);
+            block = encrypt(&ctx->ks, block, 0);//debugCount>0 && i==0);
             // if(debugCount>0 && i==0){ printf("%d enc:",i); printBlock(block);}
             bytesFromBlock(block, tmpbuf + (i * CAST5_BLOCKSIZE));
         }
@@ -406,7 +533,6 @@ static void _gcry_cast5_cfb_dec(gcry_cipher_hd_t context, unsigned char *iv, voi
             // hexdump("OUT", outbuf, CAST5_BLOCKSIZE * 3);
 //            ascii_dump(outbuf, CAST5_BLOCKSIZE * 3);
        }
-        ascii_dump(outbuf, CAST5_BLOCKSIZE * 3);
 
         outbuf += CAST5_BLOCKSIZE * 3;
         inbuf += CAST5_BLOCKSIZE * 3;
@@ -419,7 +545,7 @@ static void _gcry_cast5_cfb_dec(gcry_cipher_hd_t context, unsigned char *iv, voi
         // if(debugCount>0) hexdump("\nIN ", inbuf, CAST5_BLOCKSIZE);
         // Convert IV to Block struct, encrypt, and convert back
         ivBlock = blockFromBytes(iv);
-        ivBlock = encrypt(context->key, ivBlock, debugCount>0);
+        ivBlock = encrypt(&ctx->ks, ivBlock, TRACE_ON(TRACE_BLOCK) && debugCount>0);
         bytesFromBlock(ivBlock, iv);
 
         // XOR the encrypted IV with input and copy to output
@@ -429,7 +555,6 @@ static void _gcry_cast5_cfb_dec(gcry_cipher_hd_t context, unsigned char *iv, voi
             hexdump("OUT", outbuf, CAST5_BLOCKSIZE);
             ascii_dump(outbuf, CAST5_BLOCKSIZE);
         }*/
-                    ascii_dump(outbuf, CAST5_BLOCKSIZE);
 
         outbuf += CAST5_BLOCKSIZE;
         inbuf += CAST5_BLOCKSIZE;
@@ -439,7 +564,6 @@ static void _gcry_cast5_cfb_dec(gcry_cipher_hd_t context, unsigned char *iv, voi
     // printf("\n\n_gcry_cast5_cfb_dec END\n");
     // Clear sensitive data
     wipememory(tmpbuf, sizeof(tmpbuf));
-    return 0;
 }
 
 
@@ -449,16 +573,79 @@ static inline unsigned int _gcry_blocksize_shift(gcry_cipher_hd_t c)
 {
   /* Only blocksizes 8 and 16 are used. Return value in such way
    * that compiler can optimize calling functions based on this.  */
-  return //c->spec->blocksize == 8 ?
-   3;// : 4;
+  return c->spec->blocksize == 8 ? 3 : 4;
 }
 
-size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
+struct cfb_part {
+    gcry_cipher_hd_t c;
+    unsigned char iv[MAX_BLOCKSIZE];
+    unsigned char *outbuf;
+    const unsigned char *inbuf;
+    size_t nblocks;
+};
+
+static void cfb_dec_part(void *arg)
+{
+    struct cfb_part *p = arg;
+
+    p->c->spec->cfb_dec(&p->c->context, p->iv, p->outbuf, p->inbuf, p->nblocks);
+}
+
+/* CFB decryption of block i needs only ciphertext block i-1, so NBLOCKS
+   split into contiguous ranges, one per core, each starting from the
+   ciphertext block before it.  The caller takes the first range.  */
+static void cfb_dec_bulk(gcry_cipher_hd_t c, unsigned char *outbuf,
+                         const unsigned char *inbuf, size_t nblocks,
+                         size_t blocksize_shift)
+{
+    struct cfb_part part[SMP_MAX_CPUS];
+    smp_work_t work[SMP_MAX_CPUS];
+    size_t blocksize = (size_t)1 << blocksize_shift;
+    size_t per, start = 0, share;
+    unsigned int n = smp_cpus(), i;
+
+    /* Rounded to the nearest core, so that an 8 KiB chunk less the MDC
+       filter's 22 byte holdback still goes four ways.  */
+    share = ((nblocks << blocksize_shift) + CFB_SMP_MIN_BYTES / 2) / CFB_SMP_MIN_BYTES;
+    if (n > share)
+        n = share;
+    /* The cfb_dec functions trace from TRACE_DEBUG up, and the trace
+       ring takes one writer at a time.  */
+    if (n <= 1 || TRACE_ON(TRACE_DEBUG)) {
+        c->spec->cfb_dec(&c->context, c->u_iv.iv, outbuf, inbuf, nblocks);
+        return;
+    }
+
+    /* Take every IV before any range is decrypted: in place, range i-1
+       overwrites the block range i starts from.  */
+    per = nblocks / n;
+    for (i = 0; i < n; i++) {
+        part[i].c = c;
+        part[i].outbuf = outbuf + (start << blocksize_shift);
+        part[i].inbuf = inbuf + (start << blocksize_shift);
+        part[i].nblocks = i == n - 1 ? nblocks - start : per;
+        memcpy(part[i].iv, i ? part[i].inbuf - blocksize : c->u_iv.iv, blocksize);
+        start += per;
+    }
+
+    for (i = 1; i < n; i++) {
+        work[i].fn = cfb_dec_part;
+        work[i].arg = &part[i];
+        smp_queue(&work[i]);
+    }
+    cfb_dec_part(&part[0]);
+    for (i = 1; i < n; i++)
+        smp_wait(&work[i]);
+
+    memcpy(c->u_iv.iv, part[n - 1].iv, blocksize);
+}
+
+static size_t cfb_decrypt(gcry_cipher_hd_t c,
                           unsigned char *outbuf, size_t outbuflen,
                           const unsigned char *inbuf, size_t inbuflen) {
                             // if(inbuflen!=10) inbuflen  = 64;
-    printf("_gcry_cipher_cfb_decrypt inbuflen %d outbuflen %d cfb_bulk %d\n", 
-           inbuflen, outbuflen, 1);
+    TRACE(TRACE_DEBUG, "_gcry_cipher_cfb_decrypt inbuflen %d outbuflen %d cfb_bulk %d\n",
+          inbuflen, outbuflen, 1);
     // printf("inbuf: ");
     // for (size_t i = 0; i < inbuflen; i++) {
     //     printf("%02x", inbuf[i]);
@@ -467,13 +654,12 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
     // }
     // printf("\n");
     // printf("Initial iv address: %p\n", (void*)c->u_iv.iv);
-    printf("Initial iv contents: ");
-    for (int i = 0; i < 8; i++) printf("%02X", c->u_iv.iv[i]);
-    printf("\n");
+    TRACE(TRACE_BLOCK, "Initial iv contents: %08X%08X\n",
+          blockFromBytes(c->u_iv.iv).msb, blockFromBytes(c->u_iv.iv).lsb);
 
     unsigned char *ivp;
     size_t blocksize_shift = _gcry_blocksize_shift(c);
-    size_t blocksize = 8;//1 << blocksize_shift;
+    size_t blocksize = 1 << blocksize_shift;
     size_t blocksize_x_2 = blocksize + blocksize;
     unsigned int burn, nburn;
 
@@ -505,10 +691,10 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
     /* Now we can process complete blocks. We use a loop as long as we
        have at least 2 blocks and use conditions for the rest. This
        also allows to use a bulk encryption function if available. */
-    if (inbuflen >= blocksize_x_2 && 1){//c->bulk.cfb_dec) {
+    if (inbuflen >= blocksize_x_2 && c->spec->cfb_dec) {
         // printf("cfb_decrypt 3 %d %d %d\n", inbuflen, outbuflen, c->unused);
         size_t nblocks = inbuflen >> blocksize_shift;
-        _gcry_cast5_cfb_dec(c, c->u_iv.iv, outbuf, inbuf, nblocks);
+        cfb_dec_bulk(c, outbuf, inbuf, nblocks, blocksize_shift);
 
         outbuf += nblocks << blocksize_shift;
         inbuf  += nblocks << blocksize_shift;
@@ -517,12 +703,7 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
         // printf("cfb_decrypt 4 %d %d %d\n", inbuflen, outbuflen, c->unused);
         while (inbuflen >= blocksize_x_2) {
             /* Encrypt the IV. */
-            struct Block ivBlock = blockFromBytes(c->u_iv.iv);
-            printBlock(ivBlock);
-            
-            ivBlock = encrypt(c->key, ivBlock, 0);
-            bytesFromBlock(ivBlock, c->u_iv.iv);
-            printBlock(ivBlock);
+            c->spec->encrypt(&c->context, c->u_iv.iv, c->u_iv.iv);
             
             /* XOR the input with the IV and store input into IV. */
             cipher_block_xor_n_copy(outbuf, c->u_iv.iv, inbuf, blocksize);
@@ -534,16 +715,11 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
     }
 
     if (inbuflen >= blocksize) {
-        printf("cfb_decrypt 5 %d %d %d\n", inbuflen, outbuflen, c->unused);
+        TRACE(TRACE_DEBUG, "cfb_decrypt 5 %d %d %d\n", inbuflen, outbuflen, c->unused);
         /* Save the current IV and then encrypt the IV. */
         cipher_block_cpy(c->lastiv, c->u_iv.iv, blocksize);
 
-        struct Block ivBlock = blockFromBytes(c->u_iv.iv);
-        printBlock(ivBlock);
-        
-        ivBlock = encrypt(c->key, ivBlock, 0);
-        bytesFromBlock(ivBlock, c->u_iv.iv);
-        printBlock(ivBlock);
+        c->spec->encrypt(&c->context, c->u_iv.iv, c->u_iv.iv);
 
         /* XOR the input with the IV and store input into IV */
         cipher_block_xor_n_copy(outbuf, c->u_iv.iv, inbuf, blocksize);
@@ -554,16 +730,11 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
     }
 
     if (inbuflen) {
-        printf("cfb_decrypt 6 %d %d %d\n", inbuflen, outbuflen, c->unused);
+        TRACE(TRACE_DEBUG, "cfb_decrypt 6 %d %d %d\n", inbuflen, outbuflen, c->unused);
         /* Save the current IV and then encrypt the IV. */
         cipher_block_cpy(c->lastiv, c->u_iv.iv, blocksize);
 
-        struct Block ivBlock = blockFromBytes(c->u_iv.iv);
-        printBlock(ivBlock);
-
-        ivBlock = encrypt(c->key, ivBlock, 0);
-        bytesFromBlock(ivBlock, c->u_iv.iv);
-        printBlock(ivBlock);
+        c->spec->encrypt(&c->context, c->u_iv.iv, c->u_iv.iv);
 
         c->unused = blocksize;
         /* Apply the XOR. */
@@ -573,8 +744,7 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
         inbuf += inbuflen;
         inbuflen = 0;
 
-        ivBlock = blockFromBytes(c->u_iv.iv);
-        printBlock(ivBlock);
+        printBlock(blockFromBytes(c->u_iv.iv));
     }
 
     // if (burn > 0)
@@ -583,10 +753,21 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
     return 0;
 }
 
+size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
+                          unsigned char *outbuf, size_t outbuflen,
+                          const unsigned char *inbuf, size_t inbuflen) {
+    size_t rc;
+
+    PROF_BEGIN(PROF_CFB);
+    rc = cfb_decrypt(c, outbuf, outbuflen, inbuf, inbuflen);
+    PROF_END(PROF_CFB, inbuflen);
+    return rc;
+}
+
 int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
                           unsigned char *outbuf, size_t outbuflen,
                           const unsigned char *inbuf, size_t inbuflen) {
-    printf("_gcry_cipher_cfb_encrypt inbuflen %d outbuflen %d\n", inbuflen, outbuflen);
+    TRACE(TRACE_DEBUG, "_gcry_cipher_cfb_encrypt inbuflen %d outbuflen %d\n", inbuflen, outbuflen);
     // printf("inbuf: ");
     // for (size_t i = 0; i < inbuflen; i++) {
     //     printf("%02x", inbuf[i]);
@@ -595,11 +776,10 @@ int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
     // }
     // printf("\n");
     // printf("Initial iv address: %p\n", (void*)c->u_iv.iv);
-    // printf("Initial iv contents: ");
-    for (int i = 0; i < 8; i++) printf("%02x", c->u_iv.iv[i]);
-    printf("\n");
+    TRACE(TRACE_BLOCK, "Initial iv contents: %08X%08X\n",
+          blockFromBytes(c->u_iv.iv).msb, blockFromBytes(c->u_iv.iv).lsb);
     unsigned char *ivp;
-    size_t blocksize = 8;
+    size_t blocksize = c->spec->blocksize;
     size_t blocksize_x_2 = blocksize + blocksize;
     unsigned int burn = 0;
     (void)burn; // Suppress unused variable warning
@@ -608,7 +788,7 @@ int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
         return -1; /* Buffer too short */
 
     if (inbuflen <= c->unused) {
-        printf("cfb_encrypt 1 %d %d %d\n", inbuflen, outbuflen, c->unused);
+        TRACE(TRACE_DEBUG, "cfb_encrypt 1 %d %d %d\n", inbuflen, outbuflen, c->unused);
         /* Short enough to be encoded by the remaining XOR mask. */
         ivp = c->u_iv.iv + blocksize - c->unused;
         buf_xor_2dst_v2(outbuf, ivp, inbuf, inbuflen);
@@ -619,7 +799,7 @@ int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
     burn = 0;
 
     if (c->unused) {
-        printf("cfb_encrypt 2 %d %d %d\n", inbuflen, outbuflen, c->unused);
+        TRACE(TRACE_DEBUG, "cfb_encrypt 2 %d %d %d\n", inbuflen, outbuflen, c->unused);
         /* XOR the input with the IV and store input into IV */
         inbuflen -= c->unused;
         ivp = c->u_iv.iv + blocksize - c->unused;
@@ -630,13 +810,10 @@ int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
     }
 
     /* Now we can process complete blocks. */
-    printf("cfb_encrypt 4 %d %d %d\n", inbuflen, outbuflen, c->unused);
+    TRACE(TRACE_DEBUG, "cfb_encrypt 4 %d %d %d\n", inbuflen, outbuflen, c->unused);
     while (inbuflen >= blocksize_x_2) {
         /* Encrypt the IV. */
-        struct Block ivBlock = blockFromBytes(c->u_iv.iv);
-        ivBlock = encrypt(c->key, ivBlock, 0);
-        bytesFromBlock(ivBlock, c->u_iv.iv);
-        printBlock(ivBlock);
+        c->spec->encrypt(&c->context, c->u_iv.iv, c->u_iv.iv);
         /* XOR the input with the IV and store input into IV. */
         cipher_block_xor_2dst(outbuf, c->u_iv.iv, inbuf, blocksize);
 
@@ -650,12 +827,7 @@ int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
         /* Save the current IV and then encrypt the IV. */
         cipher_block_cpy(c->lastiv, c->u_iv.iv, blocksize);
 
-        struct Block ivBlock = blockFromBytes(c->u_iv.iv);
-                printBlock(ivBlock);
-
-        ivBlock = encrypt(c->key, ivBlock, 0);
-        bytesFromBlock(ivBlock, c->u_iv.iv);
-        printBlock(ivBlock);
+        c->spec->encrypt(&c->context, c->u_iv.iv, c->u_iv.iv);
 
         /* XOR the input with the IV and store input into IV */
         cipher_block_xor_2dst(outbuf, c->u_iv.iv, inbuf, blocksize);
@@ -670,12 +842,7 @@ int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
         /* Save the current IV and then encrypt the IV. */
         cipher_block_cpy(c->lastiv, c->u_iv.iv, blocksize);
 
-        struct Block ivBlock = blockFromBytes(c->u_iv.iv);
-                printBlock(ivBlock);
-
-        ivBlock = encrypt(c->key, ivBlock, 0);
-        bytesFromBlock(ivBlock, c->u_iv.iv);
-        printBlock(ivBlock);
+        c->spec->encrypt(&c->context, c->u_iv.iv, c->u_iv.iv);
 
         c->unused = blocksize;
 //  printf("Before buf_xor_2dst - iv address: %p\n", (void*)c->u_iv.iv);
@@ -698,15 +865,30 @@ int _gcry_cipher_cfb_encrypt(gcry_cipher_hd_t c,
         // printf("After bytesFromBlock IV: ");
         // for (int i = 0; i < 8; i++) printf("%02x", c->u_iv.iv[i]);
         // printf("\n");
-        ivBlock = blockFromBytes(c->u_iv.iv);
-        printBlock(ivBlock);
+        printBlock(blockFromBytes(c->u_iv.iv));
     }
 
     return 0;
 }
 
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define be_to_cpu32(x) (x)
+#else
+#define be_to_cpu32(x) __builtin_bswap32(x)  /* REV on ARMv6 and later */
+#endif
+#define cpu_to_be32(x) be_to_cpu32(x)
+
+/* Word aligned blocks are moved with two LDR/STR plus REV.  Unaligned
+ * ones keep the byte path: with the MMU off every access is strongly
+ * ordered and ARMv7 faults on unaligned word accesses. */
 void bytesFromBlock(struct Block block, uint8_t *bytes)
 {
+    if (((uintptr_t)bytes & 3) == 0) {
+        uint32_t *words = (uint32_t *)bytes;
+        words[0] = cpu_to_be32(block.msb);
+        words[1] = cpu_to_be32(block.lsb);
+        return;
+    }
     bytes[7] = (block.lsb & 0x000000FF) >> 0;
     bytes[6] = (block.lsb & 0x0000FF00) >> 8;
     bytes[5] = (block.lsb & 0x00FF0000) >> 16;
@@ -742,11 +924,6 @@ static void splitI(uint32_t I, uint8_t *Ia, uint8_t *Ib, uint8_t *Ic, uint8_t *I
 // static const uint64_t MOD_2_32 = (uint64_t)2 << 31;
 static const uint32_t MOD_2_32_MINUS_1 = 0xFFFFFFFF;
 
-static void printBlock(struct Block block)
-{
-    printf("%08X%08X\n", block.msb, block.lsb);
-}
-
 static uint32_t sumMod2_32b(uint32_t a, uint32_t b)
 {
 
@@ -768,20 +945,22 @@ static uint32_t cyclicShift(uint32_t x, uint8_t shift)
     uint8_t s = shift % 32;
     return (x << s) | (x >> (32 - s));
 }
-static struct Block run(const Key key, struct Block data, int reverse, int debug)
+/* Expand KEY into the 16 masking and 16 rotation subkeys (RFC 2144,
+ * section 2.4).  This is done once per key by _gcry_cipher_setkey; the
+ * block functions only ever read the result. */
+void keySchedule(const Key key, KeySchedule *ks, int debug)
 {
     Key x = {0};
     memcpy(x, key, sizeof(Key));
     Key z = {0};
-    
+
     if(debug) {
-        printf("\n=== Starting run() ===\n");
+        printf("\n=== Starting keySchedule() ===\n");
         printf("Input Key: ");
         for (int i = 0; i < 4; i++) {
             printf("%08X", key[i]);
         }
-        printf("\nInput Block - MSB: %08X LSB: %08X\n", data.msb, data.lsb);
-        printf("Reverse mode: %d\n", reverse);
+        printf("\n");
     }
 
     uint32_t K[32] = {0};
@@ -906,6 +1085,23 @@ static struct Block run(const Key key, struct Block data, int reverse, int debug
     //     }
     // }
 
+    for (int i = 0; i < ROUND_COUNT; ++i) {
+        ks->Km[i] = K[i];
+        ks->Kr[i] = K[16 + i] & 0x1F;
+    }
+    wipememory(K, sizeof(K));
+    wipememory(x, sizeof(x));
+    wipememory(z, sizeof(z));
+}
+
+static struct Block run(const KeySchedule *ks, struct Block data, int reverse, int debug)
+{
+    if(debug) {
+        printf("\n=== Starting run() ===\n");
+        printf("Input Block - MSB: %08X LSB: %08X\n", data.msb, data.lsb);
+        printf("Reverse mode: %d\n", reverse);
+    }
+
     uint32_t L[ROUND_COUNT + 1] = {0};
     L[0] = data.msb;
     uint32_t R[ROUND_COUNT + 1] = {0};
@@ -915,13 +1111,13 @@ static struct Block run(const Key key, struct Block data, int reverse, int debug
 
     for (int i = 0; i < ROUND_COUNT; ++i) {
         int rIndex = reverse ? (ROUND_COUNT - 1 - i) : i;
-        uint32_t Kmi = K[rIndex];
-        uint8_t Kri = K[16 + rIndex] & 0x1F;
+        uint32_t Kmi = ks->Km[rIndex];
+        uint8_t Kri = ks->Kr[rIndex];
 
         if(debug) {
             printf("\nRound %2d:\n", i);
-            printf("Using K[%2d] = %08X, K[%2d] = %08X (shift: %d)\n", 
-                   rIndex, Kmi, 16+rIndex, K[16 + rIndex], Kri);
+            printf("Using Km[%2d] = %08X, Kr[%2d] = %02X\n",
+                   rIndex, Kmi, rIndex, Kri);
             printf("Input L: %08X R: %08X\n", L[i], R[i]);
         }
 
@@ -995,14 +1191,69 @@ static struct Block run(const Key key, struct Block data, int reverse, int debug
     return data;
 }
 
-struct Block encrypt(const Key key, struct Block data, int debug)
+/* The three CAST5 round functions (RFC 2144, section 2.2).  Macros rather
+ * than helpers so they are expanded in place even under -fno-inline.
+ * The rotate is masked so Kr == 0 stays well defined and branch free. */
+#define ROL32(x, n) (((x) << ((n) & 31)) | ((x) >> ((32 - (n)) & 31)))
+
+#define F1(D, m, r) ( I = ROL32((m) + (D), (r)), \
+    (((S1[I >> 24] ^ S2[(I >> 16) & 0xff]) - S3[(I >> 8) & 0xff]) + S4[I & 0xff]) )
+#define F2(D, m, r) ( I = ROL32((m) ^ (D), (r)), \
+    (((S1[I >> 24] - S2[(I >> 16) & 0xff]) + S3[(I >> 8) & 0xff]) ^ S4[I & 0xff]) )
+#define F3(D, m, r) ( I = ROL32((m) - (D), (r)), \
+    (((S1[I >> 24] + S2[(I >> 16) & 0xff]) ^ S3[(I >> 8) & 0xff]) - S4[I & 0xff]) )
+
+#define ROUND(F, i) \
+    do { t = l; l = r; r = t ^ F(r, Km[i], Kr[i]); } while (0)
+
+/* Fully unrolled 16 round encryption; round i uses f1/f2/f3 for i % 3 ==
+ * 0/1/2 and L/R never leave registers. */
+static struct Block encryptBlock(const KeySchedule *ks, struct Block data)
+{
+    const uint32_t *Km = ks->Km;
+    const uint8_t *Kr = ks->Kr;
+    uint32_t l = data.msb, r = data.lsb, t, I;
+
+    ROUND(F1,  0); ROUND(F2,  1); ROUND(F3,  2); ROUND(F1,  3);
+    ROUND(F2,  4); ROUND(F3,  5); ROUND(F1,  6); ROUND(F2,  7);
+    ROUND(F3,  8); ROUND(F1,  9); ROUND(F2, 10); ROUND(F3, 11);
+    ROUND(F1, 12); ROUND(F2, 13); ROUND(F3, 14); ROUND(F1, 15);
+
+    data.msb = r;
+    data.lsb = l;
+    return data;
+}
+
+/* Same as encryptBlock with the subkeys applied in reverse order. */
+static struct Block decryptBlock(const KeySchedule *ks, struct Block data)
 {
-    return run(key, data, FALSE, debug);
+    const uint32_t *Km = ks->Km;
+    const uint8_t *Kr = ks->Kr;
+    uint32_t l = data.msb, r = data.lsb, t, I;
+
+    ROUND(F1, 15); ROUND(F3, 14); ROUND(F2, 13); ROUND(F1, 12);
+    ROUND(F3, 11); ROUND(F2, 10); ROUND(F1,  9); ROUND(F3,  8);
+    ROUND(F2,  7); ROUND(F1,  6); ROUND(F3,  5); ROUND(F2,  4);
+    ROUND(F1,  3); ROUND(F3,  2); ROUND(F2,  1); ROUND(F1,  0);
+
+    data.msb = r;
+    data.lsb = l;
+    return data;
+}
+
+#undef ROUND
+
+/* DEBUG selects the traced reference implementation in run(). */
+struct Block encrypt(const KeySchedule *ks, struct Block data, int debug)
+{
+    if (debug)
+        return run(ks, data, FALSE, debug);
+    return encryptBlock(ks, data);
 }
 
-struct Block decrypt(const Key key, struct Block data)
+struct Block decrypt(const KeySchedule *ks, struct Block data)
 {
-    return run(key, data, TRUE,0);
+    return decryptBlock(ks, data);
 }
 
 struct Block xorBlock(struct Block block, struct Block val)
@@ -1018,6 +1269,13 @@ struct Block blockFromBytes(uint8_t *bytes)
   struct Block block = {
       .msb = 0,
       .lsb = 0};
+  if (((uintptr_t)bytes & 3) == 0)
+  {
+    const uint32_t *words = (const uint32_t *)bytes;
+    block.msb = be_to_cpu32(words[0]);
+    block.lsb = be_to_cpu32(words[1]);
+    return block;
+  }
   for (int i = 0; i < 8; i++)
   {
     if (i < 4)
@@ -3,10 +3,15 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include "aes.h"
 
 /* The maximum supported size of a block in bytes */
 #define MAX_BLOCKSIZE 16
 
+/* CFB decryption takes about this many bytes per core (see smp.h);
+   below it, waking another core costs more than it saves.  */
+#define CFB_SMP_MIN_BYTES 2048
+
 /* Types */
 typedef unsigned short int u16;
 typedef unsigned int u32;
@@ -20,6 +25,12 @@ struct Block {
     uint32_t lsb;
 };
 
+/* Expanded CAST5 key: 16 masking subkeys and 16 5-bit rotation subkeys */
+typedef struct {
+    uint32_t Km[16];
+    uint8_t Kr[16];
+} KeySchedule;
+
 /* Alignment types */
 typedef union {
     int a;
@@ -38,8 +49,47 @@ typedef union {
     char c[1];
 } cipher_context_alignment_t;
 
+/* Per-key CAST5 state */
+typedef struct {
+    Key key;
+    KeySchedule ks;  /* Expanded from KEY by cast5_setkey */
+} CAST5_context;
+
+/* One supported block cipher, after libgcrypt's gcry_cipher_spec_t.
+   The CFB code in libgcrypt.c works only through this. */
+typedef struct gcry_cipher_spec {
+    int algo;          /* GCRY_CIPHER_xxx, which is also the OpenPGP id */
+    const char *name;
+    size_t blocksize;  /* 8 or 16 */
+    size_t keylen;     /* In bytes */
+    int (*setkey)(void *ctx, const byte *key, size_t keylen);
+    void (*encrypt)(void *ctx, byte *out, const byte *in);
+    /* CFB-decrypt NBLOCKS full blocks and update IV; NULL if none. */
+    void (*cfb_dec)(void *ctx, unsigned char *iv, void *out, const void *in,
+                    size_t nblocks);
+    /* Independent blocks, for OCB and EAX; NULL if the cipher has none
+       (only 16-byte block ciphers do). */
+    void (*ecb_enc)(void *ctx, void *out, const void *in, size_t nblocks);
+    void (*ecb_dec)(void *ctx, void *out, const void *in, size_t nblocks);
+} gcry_cipher_spec_t;
+
+#define OCB_BLOCK_LEN 16
+/* L[i] for i below this is precomputed at setkey; larger NTZs, i.e.
+   chunks of more than 1 MiB, double L[15] on the fly. */
+#define OCB_L_TABLE_SIZE 16
+
+/* One OMAC (CMAC) computation of EAX.  The last block is held back in
+   BUF until we know whether more data follows it. */
+typedef struct {
+    unsigned char iv[16];
+    unsigned char buf[16];
+    size_t buflen;
+} eax_cmac_t;
+
 /* The handle structure */
 struct gcry_cipher_handle {
+    const gcry_cipher_spec_t *spec;
+
     /* The initialization vector. */
     union {
         cipher_context_alignment_t iv_align;
@@ -50,9 +100,48 @@ struct gcry_cipher_handle {
     unsigned char lastiv[MAX_BLOCKSIZE];
     int unused;  /* Number of unused bytes in LASTIV */
 
+    int mode;    /* GCRY_CIPHER_MODE_CFB, _OCB or _EAX */
+    struct {
+        unsigned int tag : 1;       /* The tag has been computed */
+        unsigned int finalize : 1;  /* Next decrypt call is the last */
+    } marks;
+
+    /* Mode specific state for the AEAD modes */
+    union {
+        struct {
+            unsigned char L_star[OCB_BLOCK_LEN];
+            unsigned char L_dollar[OCB_BLOCK_LEN];
+            unsigned char L[OCB_L_TABLE_SIZE][OCB_BLOCK_LEN];
+            unsigned char offset[OCB_BLOCK_LEN];
+            unsigned char checksum[OCB_BLOCK_LEN];
+            uint64_t data_nblocks;
+            unsigned char aad_offset[OCB_BLOCK_LEN];
+            unsigned char aad_sum[OCB_BLOCK_LEN];
+            unsigned char aad_leftover[OCB_BLOCK_LEN];
+            size_t aad_nleftover;
+            uint64_t aad_nblocks;
+            unsigned char tag[OCB_BLOCK_LEN];
+            unsigned int data_finalized : 1;
+            unsigned int aad_finalized : 1;
+        } ocb;
+        struct {
+            unsigned char subkeys[2][16];   /* K1 and K2 of OMAC */
+            unsigned char nonce_mac[16];    /* N' */
+            eax_cmac_t cmac_header;
+            eax_cmac_t cmac_ciphertext;
+            unsigned char ctr[16];
+            unsigned char keystream[16];
+            size_t unused;                  /* Bytes left in KEYSTREAM */
+            unsigned char tag[16];
+        } eax;
+    } u_mode;
+
     /* Cipher context */
-    cipher_context_alignment_t context;
-    Key key;
+    union {
+        cipher_context_alignment_t align;
+        CAST5_context cast5;
+        AES_context aes;
+    } context;
 };
 
 typedef struct gcry_cipher_handle *gcry_cipher_hd_t;
@@ -60,8 +149,21 @@ typedef struct gcry_cipher_handle *gcry_cipher_hd_t;
 /* CAST5 function prototypes */
 void bytesFromBlock(struct Block block, uint8_t *bytes);
 struct Block blockFromBytes(uint8_t *bytes);
+/* Allocate a handle for ALGO in MODE (GCRY_CIPHER_MODE_CFB, _OCB or
+   _EAX); GPG_ERR_CIPHER_ALGO or GPG_ERR_INV_CIPHER_MODE if unsupported. */
+int
+_gcry_cipher_open (gcry_cipher_hd_t *handle, int algo, int mode);
 int
 _gcry_cipher_setiv (gcry_cipher_hd_t c, const void *iv, size_t ivlen);
+/* AEAD modes: additional data, then decrypt (after _gcry_cipher_final
+   for the last call, which may be a partial block), then the tag. */
+int
+_gcry_cipher_authenticate (gcry_cipher_hd_t c, const void *abuf, size_t abuflen);
+int
+_gcry_cipher_final (gcry_cipher_hd_t c);
+/* 0 or GPG_ERR_CHECKSUM. */
+int
+_gcry_cipher_checktag (gcry_cipher_hd_t c, const void *intag, size_t taglen);
 int
 _gcry_cipher_setkey (gcry_cipher_hd_t hd, const byte *key, size_t keylen);
 /* Function prototypes */
@@ -73,7 +175,36 @@ size_t _gcry_cipher_cfb_decrypt(gcry_cipher_hd_t c,
                                unsigned char *outbuf, size_t outbuflen,
                                const unsigned char *inbuf, size_t inbuflen);
 
+int _gcry_cipher_encrypt(gcry_cipher_hd_t h, void *out, size_t outsize,
+                         const void *in, size_t inlen);
+int _gcry_cipher_decrypt(gcry_cipher_hd_t h, void *out, size_t outsize,
+                         const void *in, size_t inlen);
+
 void cipher_sync(gcry_cipher_hd_t c);
+
+/* cipher-ocb.c */
+void _gcry_cipher_ocb_setkey (gcry_cipher_hd_t c);
+int _gcry_cipher_ocb_set_nonce (gcry_cipher_hd_t c, const unsigned char *nonce,
+                                size_t noncelen);
+int _gcry_cipher_ocb_authenticate (gcry_cipher_hd_t c, const unsigned char *abuf,
+                                   size_t abuflen);
+int _gcry_cipher_ocb_decrypt (gcry_cipher_hd_t c, unsigned char *outbuf,
+                              size_t outbuflen, const unsigned char *inbuf,
+                              size_t inbuflen);
+int _gcry_cipher_ocb_check_tag (gcry_cipher_hd_t c, const unsigned char *intag,
+                                size_t taglen);
+
+/* cipher-eax.c */
+void _gcry_cipher_eax_setkey (gcry_cipher_hd_t c);
+int _gcry_cipher_eax_set_nonce (gcry_cipher_hd_t c, const unsigned char *nonce,
+                                size_t noncelen);
+int _gcry_cipher_eax_authenticate (gcry_cipher_hd_t c, const unsigned char *abuf,
+                                   size_t abuflen);
+int _gcry_cipher_eax_decrypt (gcry_cipher_hd_t c, unsigned char *outbuf,
+                              size_t outbuflen, const unsigned char *inbuf,
+                              size_t inbuflen);
+int _gcry_cipher_eax_check_tag (gcry_cipher_hd_t c, const unsigned char *intag,
+                                size_t taglen);
 void
 _gcry_cipher_close (gcry_cipher_hd_t h);
 /* Buffer handling functions */
@@ -97,9 +228,9 @@ enum
 };
 typedef uint32_t Key[KEY_LEN];
 struct Block blockFromBytes(uint8_t *bytes);
-struct Block encrypt(const Key key, struct Block data, int debug);
-struct Block decrypt(const Key key, struct Block data);
-static void printBlock(struct Block block);
+void keySchedule(const Key key, KeySchedule *ks, int debug);
+struct Block encrypt(const KeySchedule *ks, struct Block data, int debug);
+struct Block decrypt(const KeySchedule *ks, struct Block data);
 
 
 #define TRUE 1
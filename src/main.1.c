@@ -6,9 +6,23 @@
 #include "passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword.gpg.h"
 #include "fwddecl.h"
 #include "gpg.h"
-
+#include "gcrypt.h"
+#include "smp.h"
+#include "mmu.h"
+#include "prof.h"
+#include "payload.h"
+#include "semihost.h"
+#include "sink.h"
+#include "session.h"
+#include "encrypted.aes128.10k.h"
+
+#ifdef BOARD_RASPI2B
+// BCM2836 PL011 UART0 address
+#define UART0_DR *((volatile uint32_t *)0x3f201000)
+#else
 // QEMU Versatile PB UART0 address
 #define UART0_DR *((volatile uint32_t *)0x101f1000)
+#endif
 
 extern char __text_start[], __text_end[];
 extern char __data_start[], __data_end[];
@@ -24,6 +38,7 @@ void verify_wiped(void *ptr, size_t len);
 int unified_decrypt(ctrl_t ctrl, const unsigned char *session_key, size_t key_len,
                     const char *passphrase, const unsigned char *encrypted_data,
                     size_t data_len);
+int decrypt_message(ctrl_t ctrl, const char *filename);
 
 size_t strlen(const char *str)
 {
@@ -171,9 +186,285 @@ int unified_decrypt(ctrl_t ctrl, const unsigned char *session_key, size_t key_le
     return 0;
 }
 
+#ifdef BOARD_RASPI2B
+// Generic timer count; CNTFRQ gives its rate
+static uint64_t read_cntvct(void)
+{
+    uint32_t lo, hi;
+
+    __asm__ volatile("isb\n\tmrrc p15, 1, %0, %1, c14" : "=r"(lo), "=r"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/**
+ * Time AES-128 CFB decryption of 256 KiB in 8 KiB requests, as the
+ * decrypt filter issues them, on one core and then on all of them, and
+ * check that both give the same plaintext.
+ */
+static void cfb_smp_report(void)
+{
+    static unsigned char buf[2][256 * 1024];
+    static const unsigned char key[16] = { 1 };
+    unsigned char iv[16] = { 0 };
+    unsigned int cpus[2] = { 1, 0 }, us[2], freq, k;
+    gcry_cipher_hd_t hd;
+    uint64_t t0, t1;
+    size_t off;
+
+    // Whole ticks per microsecond: no 64-bit division without libgcc
+    __asm__ volatile("mrc p15, 0, %0, c14, c0, 0" : "=r"(freq));
+    freq = freq >= 1000000 ? freq / 1000000 : 1;
+    for (k = 0; k < 2; k++)
+    {
+        for (off = 0; off < sizeof buf[k]; off++)
+            buf[k][off] = off * 7;
+        smp_limit(cpus[k]);
+        cpus[k] = smp_cpus();
+        if (_gcry_cipher_open(&hd, GCRY_CIPHER_AES, GCRY_CIPHER_MODE_CFB)
+            || _gcry_cipher_setkey(hd, key, sizeof key))
+        {
+            printf("cfb-smp: cipher setup failed\n");
+            return;
+        }
+        _gcry_cipher_setiv(hd, iv, sizeof iv);
+        t0 = read_cntvct();
+        for (off = 0; off < sizeof buf[k]; off += 8192)
+            _gcry_cipher_decrypt(hd, buf[k] + off, 8192, NULL, 0);
+        t1 = read_cntvct();
+        _gcry_cipher_close(hd);
+        us[k] = (uint32_t)(t1 - t0) / freq;
+    }
+    smp_limit(0);
+
+    printf("cfb-smp  aes 262144 bytes: %u core %u us, %u cores %u us, speedup x%u.%02u (%s)\n",
+           cpus[0], us[0], cpus[1], us[1],
+           us[1] ? us[0] / us[1] : 0, us[1] ? us[0] % us[1] * 100 / us[1] : 0,
+           memcmp(buf[0], buf[1], sizeof buf[0]) ? "MISMATCH" : "same plaintext");
+}
+
+/**
+ * Time 16 decryptions of an AES-128 SEIPD message (10 KiB, MDC) end to
+ * end in one session, on one core and then on all of them.  A first
+ * decryption puts the passphrase's key in the S2K cache, so the times
+ * are the packet pipeline and the CFB and MDC passes.
+ */
+static void mdc_smp_report(void)
+{
+    static struct session_msg_s queue[16];
+    struct decrypt_session_s s;
+    unsigned int cpus[2] = { 1, 0 }, us[2], freq, k, i, failed;
+    uint32_t crc[2];
+    uint64_t t0, t1;
+
+    __asm__ volatile("mrc p15, 0, %0, c14, c0, 0" : "=r"(freq));
+    freq = freq >= 1000000 ? freq / 1000000 : 1;
+    for (i = 0; i < 16; i++)
+    {
+        queue[i].data = encrypted_aes128_10k_gpg;
+        queue[i].len = encrypted_aes128_10k_gpg_len;
+        queue[i].passphrase = "password";
+    }
+    session_open(&s);
+    session_decrypt(&s, &queue[0]);
+    for (k = 0; k < 2; k++)
+    {
+        smp_limit(cpus[k]);
+        cpus[k] = smp_cpus();
+        t0 = read_cntvct();
+        failed = session_run(&s, queue, 16);
+        t1 = read_cntvct();
+        if (failed)
+        {
+            printf("mdc-smp: %u of 16 decryptions failed, rc=%d\n", failed, queue[15].rc);
+            break;
+        }
+        us[k] = (uint32_t)(t1 - t0) / freq;
+        crc[k] = queue[15].text_crc;
+    }
+    session_close(&s);
+    smp_limit(0);
+    if (k < 2)
+        return;
+
+    printf("mdc-smp  aes %u bytes x 16: %u core %u us, %u cores %u us, speedup x%u.%02u (%s)\n",
+           encrypted_aes128_10k_gpg_len, cpus[0], us[0], cpus[1], us[1],
+           us[1] ? us[0] / us[1] : 0, us[1] ? us[0] % us[1] * 100 / us[1] : 0,
+           crc[0] != crc[1] ? "MISMATCH" : "same plaintext");
+}
+#endif
+
+/**
+ * Decrypt the message the loader put at PAYLOAD_ADDR (payload.h) in
+ * place of the built-in tests
+ */
+static void decrypt_payload(struct payload_header *p)
+{
+    printf("=== Payload at %p: %u byte message at %p ===\n",
+           (void *)p, (unsigned)p->length, (void *)payload_data(p));
+    if (PROF_ON)
+        prof_reset();
+    payload_decrypt(p, (void *)PAYLOAD_END);
+    if (PROF_ON)
+        prof_dump();
+
+    printf("Payload result: rc=%u text=%u crc=%08x", (unsigned)p->result_rc,
+           (unsigned)p->result_len, (unsigned)p->result_crc);
+    if (p->result_out)
+        printf(" plaintext at %08x", (unsigned)p->result_out);
+    if (p->text_len != PAYLOAD_UNKNOWN || p->text_crc != PAYLOAD_UNKNOWN)
+        printf(" %s", payload_ok(p) ? "ok" : "FAIL");
+    printf("\n");
+}
+
+// Split LINE into words in place and return its end
+static char *cmdline_split(char *line)
+{
+    char *p;
+
+    for (p = line; *p; p++)
+        if (*p == ' ')
+            *p = '\0';
+    return p;
+}
+
+// Value of NAME=value among the words from LINE to END
+static char *cmdline_arg(char *line, char *end, const char *name)
+{
+    size_t n = strlen(name);
+    char *p;
+
+    for (p = line; p < end; p += strlen(p) + 1)
+        if (!memcmp(p, name, n) && p[n] == '=')
+            return p + n + 1;
+    return NULL;
+}
+
+static int hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * Decrypt a file on the host, streamed through semihosting, as the
+ * command line (make run USE_SEMIHOSTING=1 SEMIHOST_ARGS=...) says:
+ *   in=FILE [out=FILE] passphrase=P | session-key=HEX
+ * The plaintext goes to out=, or else into a CRC-32 digest.
+ * @return 0 if the command line names no input
+ */
+static int decrypt_semihost_file(char *cmdline)
+{
+    struct server_control_s ctrl;
+    struct sink_digest_s digest;
+    struct sink_file_s file;
+    // NUL-terminated for do_proc_packets, as in unified_decrypt
+    unsigned char key[33] = { 0 };
+    char *end, *in, *out, *pass, *hex;
+    size_t i;
+    int rc;
+
+    end = cmdline_split(cmdline);
+    in = cmdline_arg(cmdline, end, "in");
+    if (!in)
+        return 0;
+    out = cmdline_arg(cmdline, end, "out");
+    pass = cmdline_arg(cmdline, end, "passphrase");
+    hex = cmdline_arg(cmdline, end, "session-key");
+
+    memset(&ctrl, 0, sizeof ctrl);
+    if (hex)
+    {
+        for (i = 0; i < sizeof key - 1 && hex_digit(hex[2 * i]) >= 0
+                    && hex_digit(hex[2 * i + 1]) >= 0; i++)
+            key[i] = hex_digit(hex[2 * i]) << 4 | hex_digit(hex[2 * i + 1]);
+        if (!i || hex[2 * i] || strlen((char *)key) != i)
+        {
+            printf("session-key: up to 32 bytes in hex, none of them 0\n");
+            return 1;
+        }
+        ctrl.session_key = key;
+    }
+    else if (pass)
+        ctrl.passphrase = pass;
+    else
+    {
+        printf("%s: no passphrase= or session-key=\n", in);
+        return 1;
+    }
+
+    sink_digest_init(&digest);
+    ctrl.sink = &digest.sink;
+    if (out)
+    {
+        if (sink_file_open(&file, out))
+        {
+            printf("can't create '%s'\n", out);
+            return 1;
+        }
+        ctrl.sink = &file.sink;
+    }
+
+    printf("=== Decrypting %s from the host ===\n", in);
+    if (PROF_ON)
+        prof_reset();
+    rc = gpg_err_code(decrypt_message(&ctrl, in));
+    if (out && sink_file_close(&file) && !rc)
+        rc = GPG_ERR_EIO;
+    if (PROF_ON)
+        prof_dump();
+
+    if (out)
+        printf("File result: rc=%u text=%u written to %s\n", (unsigned)rc,
+               (unsigned)file.sink.total, out);
+    else
+        printf("File result: rc=%u text=%u crc=%08x\n", (unsigned)rc,
+               (unsigned)digest.sink.total, (unsigned)digest.crc);
+    wipememory(key, sizeof key);
+    if (pass)
+        wipememory(pass, strlen(pass));
+    return 1;
+}
+
 void main()
 {
+    struct payload_header *payload;
+    static char cmdline[512];
+
     init_printf(0, putc_uart);
+    printf("SCTLR %08x (MMU %s, D-cache %s, I-cache %s, branch prediction %s)\n",
+           mmu_sctlr(), mmu_sctlr() & 1 ? "on" : "off", mmu_sctlr() & 4 ? "on" : "off",
+           mmu_sctlr() & 0x1000 ? "on" : "off", mmu_sctlr() & 0x800 ? "on" : "off");
+    smp_init();
+
+#ifdef BOARD_RASPI2B
+    printf("%u cores online\n", smp_cpus());
+    cfb_smp_report();
+    mdc_smp_report();
+#endif
+
+    payload = payload_find((void *)PAYLOAD_ADDR, PAYLOAD_END - PAYLOAD_ADDR);
+    if (payload)
+    {
+        decrypt_payload(payload);
+        printf("Exit via: CTRL-A + X\n");
+        while (1)
+        {
+            __asm__("wfi");
+        }
+    }
+    if (!semihost_cmdline(cmdline, sizeof cmdline) && decrypt_semihost_file(cmdline))
+    {
+        printf("Exit via: CTRL-A + X\n");
+        while (1)
+        {
+            __asm__("wfi");
+        }
+    }
 
     printf("=== Starting dual decryption test with SEPARATE control structures ===\n\n");
 
@@ -196,45 +487,38 @@ void main()
     printf("Distance between ctrl1 and ctrl2: %ld bytes\n", 
            (char*)ctrl2 - (char*)ctrl1);
 
-    // Allocate TWO SEPARATE key buffers as well
-    unsigned char *key_buffer1 = malloc(32);
-    unsigned char *key_buffer2 = malloc(32);
-    
-    if (!key_buffer1 || !key_buffer2)
-    {
-        printf("Failed to allocate key buffers\n");
-        goto cleanup;
-    }
+    // Per-stage cycles of each message alone, with make PROFILE=1
+    if (PROF_ON)
+        prof_reset();
 
     // ========== First Decryption with ctrl1 ==========
     printf("\n--- Test 1: Password-based file decryption (using ctrl1) ---\n");
 
-    // Set up first key in key_buffer1
-    const unsigned char key_bytes_password[] = {
-        0xaa, 0x26, 0x54, 0x2a, 0xfd, 0x6f, 0x97, 0x09,
-        0x82, 0xee, 0xdb, 0x0c, 0xa8, 0x47, 0x7f, 0xd7};
-    memcpy(key_buffer1, key_bytes_password, sizeof(key_bytes_password));
-
-    int rc1 = unified_decrypt(ctrl1, key_buffer1, sizeof(key_bytes_password), NULL,
+    // S2K on target: iterated+salted SHA-1, count 0xFF
+    int rc1 = unified_decrypt(ctrl1, NULL, 0,
+                              "passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword",
                               __passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword_gpg,
                               __passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword_gpg_len);
 
     printf("First decryption result: %d\n", rc1);
+    if (PROF_ON) {
+        prof_dump();
+        prof_reset();
+    }
 
     // ========== Second Decryption with ctrl2 (COMPLETELY SEPARATE) ==========
     printf("\n--- Test 2: WikiLeaks file decryption (using ctrl2) ---\n");
 
-    // Set up second key in key_buffer2
-    const unsigned char key_bytes_wikileaks[] = {
-        0x42, 0x7c, 0x02, 0x8e, 0x28, 0xee, 0xb1, 0x54,
-        0x64, 0xc3, 0x76, 0xd7, 0xdc, 0xca, 0x6c, 0xa2};
-    memcpy(key_buffer2, key_bytes_wikileaks, sizeof(key_bytes_wikileaks));
-
-    int rc2 = unified_decrypt(ctrl2, key_buffer2, sizeof(key_bytes_wikileaks), NULL,
+    int rc2 = unified_decrypt(ctrl2, NULL, 0,
+                              "2af14ef19220d275b0f87907f4ab5075dc9b75b574ef8c2e06e32e8311776945",
                               __7379ab5047b143c0b6cfe5d8d79ad240b4b4f8cced55aa26f86d1d3d370c0d4c_gpg,
                               __7379ab5047b143c0b6cfe5d8d79ad240b4b4f8cced55aa26f86d1d3d370c0d4c_gpg_len);
 
     printf("Second decryption result: %d\n", rc2);
+    if (PROF_ON) {
+        prof_dump();
+        prof_reset();
+    }
 
     printf("\n=== All decryption tests completed ===\n");
     printf("Both decryptions should have succeeded with same code paths\n");
@@ -256,18 +540,6 @@ cleanup:
         free(ctrl2);
     }
 
-    if (key_buffer1)
-    {
-        wipememory(key_buffer1, 32);
-        free(key_buffer1);
-    }
-    
-    if (key_buffer2)
-    {
-        wipememory(key_buffer2, 32);
-        free(key_buffer2);
-    }
-
     while (1)
     {
         __asm__("wfi");
@@ -0,0 +1,296 @@
+#include <stdint.h>
+#include <stddef.h>
+#include "printf.h"
+#include <string.h>
+#include "encrypted.1k.h"
+#include "encrypted.10k.h"
+#include "encrypted.100k.h"
+#include "7379ab5047b143c0b6cfe5d8d79ad240b4b4f8cced55aa26f86d1d3d370c0d4c.gpg.h"
+#include "passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword.gpg.h"
+#include "fwddecl.h"
+#include "gpg.h"
+#include "sink.h"
+#include "smp.h"
+#include "prof.h"
+#include "payload.h"
+#include "session.h"
+#include "memory.h"
+
+/*
+ * On-target benchmark (make bench): decrypt every bundled message
+ * BENCH_ITERS times into a CRC-32 sink with the console muted, check
+ * each result against the known plaintext, and print one line per
+ * message:
+ *
+ *   bench name=10k bytes=8071 iters=10 cycles=123456789 mhz=900 mbps=0.65 ok
+ *
+ * bytes is the message size, cycles the PMCCNTR total over the timed
+ * iterations and mbps bytes * iters / cycles at BENCH_MHZ.  Each message
+ * is decrypted once more untimed first, which fills the S2K cache, so
+ * the figures are for the steady state.  A wrong result ends the line
+ * with FAIL and what came out instead of ok.
+ *
+ * A message the loader put at PAYLOAD_ADDR (payload.h, make run-bench
+ * PAYLOAD=...) comes last as name=payload, into the CRC-32 sink like
+ * the rest and checked against the length and CRC-32 in its header when
+ * they are given.
+ *
+ * name=batch-1k is the 1k message BENCH_BATCH times over as the queue
+ * of one decrypt session (session.h), so bytes is BENCH_BATCH times its
+ * size.  Its line is followed by the session's own report of the last
+ * iteration and the heap in use before and after the iterations, which
+ * must be the same.
+ */
+
+#ifndef BENCH_ITERS
+#define BENCH_ITERS 10
+#endif
+#ifndef BENCH_MHZ
+#define BENCH_MHZ 900   // Raspberry Pi 2 Cortex-A7
+#endif
+#ifndef BENCH_BATCH
+#define BENCH_BATCH 100
+#endif
+
+#ifdef BOARD_RASPI2B
+// BCM2836 PL011 UART0 address
+#define UART0_DR *((volatile uint32_t *)0x3f201000)
+#else
+// QEMU Versatile PB UART0 address
+#define UART0_DR *((volatile uint32_t *)0x101f1000)
+#endif
+
+int decrypt_memory(ctrl_t ctrl, const unsigned char *data, size_t length);
+
+struct bench_vector
+{
+    const char *name;
+    const unsigned char *data;
+    size_t len;
+    const char *passphrase;     // NULL: session key vector_key
+    int rc;                     // Expected gpg_err_code
+    size_t text_len;            // Expected plaintext length and CRC-32,
+    uint32_t text_crc;          // or PAYLOAD_UNKNOWN
+    const struct payload_header *payload;   // Key material from here
+    unsigned batch;             // >0: that many times in one session
+};
+
+// 1k, 10k and 100k were made with passphrase "password" and salt
+// 0a0b0c0d0e0f1011; this is the resulting S2K SHA-1 CAST5 key.
+static const unsigned char vector_key[16] = {
+    0x69, 0x3b, 0x78, 0x47, 0xfa, 0x44, 0xcd, 0xc6,
+    0xe1, 0xc4, 0x03, 0xf5, 0xe4, 0x4e, 0x95, 0xc1
+};
+
+// The 7379... message holds a compression algorithm that compress.c
+// rejects; it is decrypted to the end all the same, so its figure is
+// the S2K, CFB and parsing without the plaintext.
+static const struct bench_vector vectors[] = {
+    { "1k", encrypted_1k_gpg, sizeof encrypted_1k_gpg,
+      NULL, 0, 1006, 0xfeb57eee, NULL, 0 },
+    { "10k", encrypted_10k_gpg, sizeof encrypted_10k_gpg,
+      NULL, 0, 8048, 0x2b774b28, NULL, 0 },
+    { "100k", encrypted_100k_gpg, sizeof encrypted_100k_gpg,
+      NULL, 0, 100343, 0x7a818559, NULL, 0 },
+    { "lorem", __passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword_gpg,
+      sizeof __passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword_gpg,
+      "passwordpasswordpasswordpasswordpasswordpasswordpasswordpassword",
+      0, 87222, 0x88ac9056, NULL, 0 },
+    { "7379", __7379ab5047b143c0b6cfe5d8d79ad240b4b4f8cced55aa26f86d1d3d370c0d4c_gpg,
+      sizeof __7379ab5047b143c0b6cfe5d8d79ad240b4b4f8cced55aa26f86d1d3d370c0d4c_gpg,
+      "2af14ef19220d275b0f87907f4ab5075dc9b75b574ef8c2e06e32e8311776945",
+      GPG_ERR_COMPR_ALGO, 0, 0, NULL, 0 },
+    { "batch-1k", encrypted_1k_gpg, sizeof encrypted_1k_gpg,
+      NULL, 0, 1006, 0xfeb57eee, NULL, BENCH_BATCH },
+};
+
+// The payload's key material while it is benched
+static unsigned char payload_key[PAYLOAD_KEY_MAX + 1];
+
+// The queue of a batch vector and the totals of its last session
+static struct session_msg_s batch_queue[BENCH_BATCH];
+static struct session_stats_s batch_stats;
+
+size_t strlen(const char *str)
+{
+    const char *s;
+    for (s = str; *s; ++s)
+        ;
+    return (s - str);
+}
+
+void uart_putc(char c)
+{
+    UART0_DR = c;
+}
+
+void putc_uart(void *p, char c)
+{
+    (void)p;
+    uart_putc(c);
+}
+
+static void putc_discard(void *p, char c)
+{
+    (void)p;
+    (void)c;
+}
+
+/**
+ * Decrypt V->batch copies of V as the queue of one decrypt session, the
+ * last one's result into DIGEST
+ * @return The gpg_err_code of the first failure, else 0
+ */
+static int decrypt_batch(const struct bench_vector *v, struct sink_digest_s *digest)
+{
+    struct decrypt_session_s s;
+    struct session_msg_s *m;
+    unsigned i;
+    int rc = 0;
+
+    for (i = 0; i < v->batch; i++)
+    {
+        m = &batch_queue[i];
+        memset(m, 0, sizeof *m);
+        m->data = v->data;
+        m->len = v->len;
+        if (v->passphrase)
+            m->passphrase = v->passphrase;
+        else
+        {
+            m->session_key = vector_key;
+            m->key_len = sizeof vector_key;
+        }
+    }
+    session_open(&s);
+    session_run(&s, batch_queue, v->batch);
+    batch_stats = s.stats;
+    session_close(&s);
+
+    for (i = 0; i < v->batch && !rc; i++)
+        rc = batch_queue[i].rc;
+    sink_digest_init(digest);
+    digest->sink.total = m->text_len;
+    digest->crc = m->text_crc;
+    return rc;
+}
+
+/**
+ * Decrypt V once into DIGEST
+ * @return The gpg_err_code of the result
+ */
+static int decrypt_vector(const struct bench_vector *v, struct sink_digest_s *digest)
+{
+    struct server_control_s ctrl;
+    // do_proc_packets copies the session key with strlen(); keep it
+    // NUL-terminated in a 32 byte buffer as unified_decrypt does.
+    unsigned char key[32] = { 0 };
+    char passphrase[80];
+    int rc;
+
+    if (v->batch)
+        return decrypt_batch(v, digest);
+    if (v->payload)
+    {
+        rc = payload_setup(v->payload, &ctrl, payload_key, digest);
+        if (rc)
+            return rc;
+        return gpg_err_code(decrypt_memory(&ctrl, v->data, v->len));
+    }
+
+    memset(&ctrl, 0, sizeof ctrl);
+    if (v->passphrase)
+    {
+        memcpy(passphrase, v->passphrase, strlen(v->passphrase) + 1);
+        ctrl.passphrase = passphrase;
+    }
+    else
+    {
+        memcpy(key, vector_key, sizeof vector_key);
+        ctrl.session_key = key;
+    }
+    sink_digest_init(digest);
+    ctrl.sink = &digest->sink;
+    return gpg_err_code(decrypt_memory(&ctrl, v->data, v->len));
+}
+
+static int vector_ok(const struct bench_vector *v, int rc, const struct sink_digest_s *digest)
+{
+    return rc == v->rc
+        && (v->text_len == PAYLOAD_UNKNOWN || digest->sink.total == v->text_len)
+        && (v->text_crc == PAYLOAD_UNKNOWN || digest->crc == v->text_crc);
+}
+
+static void bench_vector(const struct bench_vector *v)
+{
+    struct sink_digest_s digest;
+    size_t bytes = v->batch ? v->len * v->batch : v->len;
+    uint64_t cycles = 0, mbps;
+    heap_stats_t heap[2];
+    uint32_t t0;
+    int i, rc, ok;
+
+    heap_get_stats(&heap[0]);
+    init_printf(0, putc_discard);
+    rc = decrypt_vector(v, &digest);
+    ok = vector_ok(v, rc, &digest);
+    for (i = 0; i < BENCH_ITERS && ok; i++)
+    {
+        t0 = prof_cycles();
+        rc = decrypt_vector(v, &digest);
+        // One decryption (or batch) stays well below 2^32 cycles
+        cycles += prof_cycles() - t0;
+        ok = vector_ok(v, rc, &digest);
+    }
+    init_printf(0, putc_uart);
+    heap_get_stats(&heap[1]);
+
+    // Hundredths of MB/s: bytes * iters * MHz / cycles
+    mbps = prof_udiv64((uint64_t)bytes * i * BENCH_MHZ * 100, cycles);
+    printf("bench name=%s bytes=%u iters=%u cycles=", v->name, (unsigned)bytes, i);
+    prof_put_u64(cycles, 0);
+    printf(" mhz=%u mbps=", BENCH_MHZ);
+    prof_put_u64(prof_udiv64(mbps, 100), 0);
+    printf(".%02u", (unsigned)(mbps - prof_udiv64(mbps, 100) * 100));
+    if (ok)
+        printf(" ok\n");
+    else
+        printf(" FAIL rc=%u text=%u crc=%08x\n",
+               (unsigned)rc, (unsigned)digest.sink.total, (unsigned)digest.crc);
+    if (v->batch)
+    {
+        session_report(&batch_stats, BENCH_MHZ);
+        printf("# heap %u bytes in use before, %u after\n",
+               (unsigned)heap[0].in_use, (unsigned)heap[1].in_use);
+    }
+}
+
+void main()
+{
+    struct payload_header *p;
+    struct bench_vector pv;
+    size_t i;
+
+    init_printf(0, putc_uart);
+    smp_init();
+    printf("# bench: %u iterations per message, %u MHz, %u cores\n",
+           BENCH_ITERS, BENCH_MHZ, smp_cpus());
+    for (i = 0; i < sizeof vectors / sizeof vectors[0]; i++)
+        bench_vector(&vectors[i]);
+
+    p = payload_find((void *)PAYLOAD_ADDR, PAYLOAD_END - PAYLOAD_ADDR);
+    if (p)
+    {
+        memset(&pv, 0, sizeof pv);
+        pv.name = "payload";
+        pv.data = payload_data(p);
+        pv.len = p->length;
+        pv.text_len = p->text_len;
+        pv.text_crc = p->text_crc;
+        pv.payload = p;
+        bench_vector(&pv);
+        wipememory(payload_key, sizeof payload_key);
+        wipememory(p->key, sizeof p->key);
+    }
+    printf("# bench done\n");
+}
@@ -28,6 +28,8 @@
 #include "gpg.h"
 #include "common/util.h"
 #include "packet.h"
+#include "sink.h"
+#include "s2k-cache.h"
 #include "common/iobuf.h"
 // #include "options.h"
 #include "keydb.h"
@@ -35,6 +37,7 @@
 // #include "main.h"
 #include "common/status.h"
 #include "common/i18n.h"
+#include "memory.h"
 // #include "trustdb.h"
 // #include "keyserver-internal.h"
 // #include "photoid.h"
@@ -42,7 +45,7 @@
 // #include "call-dirmngr.h"
 #include "common/compliance.h"
 #include "printf.h"
-// #include "sha1.h"
+#include "gcrypt.h"
 /* Put an upper limit on nested packets.  The 32 is an arbitrary
    value, a much lower should actually be sufficient.  */
 #define MAX_NESTING_DEPTH 32
@@ -111,6 +114,7 @@ struct mainproc_context
   struct symlist_item *symenc_list; /* List of sym. encryption packets. */
   int seen_pkt_encrypted_aead;      /* PKT_ENCRYPTED_AEAD packet seen. */
   int seen_pkt_encrypted_mdc;       /* PKT_ENCRYPTED_MDC packet seen. */
+  gpg_error_t decrypt_err;          /* Why proc_encrypted failed, or 0. */
   struct
   {
     unsigned int sig_seen : 1; /* Set to true if a signature packet
@@ -139,6 +143,20 @@ void reset_literals_seen(void)
   literals_seen = 0;
 }
 
+/* Wipe and free a DEK together with its key.  */
+static void
+release_dek(DEK *dek)
+{
+  if (!dek)
+    return;
+  if (dek->key)
+  {
+    wipememory(dek->key, dek->keylen);
+    xfree(dek->key);
+  }
+  xfree(dek);
+}
+
 // static void
 // release_list( CTX c )
 // {
@@ -265,113 +283,114 @@ void reset_literals_seen(void)
 //   return 1;
 // }
 
-// static gpg_error_t
-// symkey_decrypt_seskey (DEK *dek, byte *seskey, size_t slen)
-// {
-//   printf ("symkey_decrypt_seskey\n");
-//   gpg_error_t err;
-//   gcry_cipher_hd_t hd;
-//   enum gcry_cipher_modes ciphermode;
-//   unsigned int noncelen, keylen;
-
-//   if (dek->use_aead)
-//     {
-//       err = openpgp_aead_algo_info (dek->use_aead, &ciphermode, &noncelen);
-//       if (err)
-//         return err;
-//     }
-//   else
-//     {
-//       ciphermode = GCRY_CIPHER_MODE_CFB;
-//       noncelen = 0;
-//     }
+/* Replace the S2K key in DEK by the session key KEY of KEYLEN bytes.
+ * DEK->KEY is allocated for the S2K cipher's key length, which the
+ * session key's cipher need not share.  */
+static gpg_error_t
+replace_dek_key (DEK *dek, const byte *key, unsigned int keylen)
+{
+  if (keylen > 32) /* DIM(dek->key) upstream.  */
+    return gpg_error (GPG_ERR_TOO_LARGE);
+  if (keylen != dek->keylen)
+    {
+      wipememory (dek->key, dek->keylen);
+      xfree (dek->key);
+      dek->key = xmalloc (keylen);
+    }
+  dek->keylen = keylen;
+  memcpy (dek->key, key, keylen);
+  return 0;
+}
 
-//   /* Check that the session key has a size of 16 to 32 bytes.  */
-//   if ((dek->use_aead && (slen < (noncelen + 16 + 16)
-//                          || slen > (noncelen + 32 + 16)))
-//       || (!dek->use_aead && (slen < 17 || slen > 33)))
-//     {
-//       printf ( _("weird size for an encrypted session key (%d)\n"),
-// 		  (int)slen);
-//       return gpg_error (GPG_ERR_BAD_KEY);
-//     }
+static gpg_error_t
+symkey_decrypt_seskey (DEK *dek, byte *seskey, size_t slen)
+{
+  gpg_error_t err;
+  gcry_cipher_hd_t hd = NULL;
+  enum gcry_cipher_modes ciphermode;
+  unsigned int noncelen, keylen;
 
-//   err = openpgp_cipher_open (&hd, dek->algo, ciphermode, 1);
-//   if (!err)
-//     err = gcry_cipher_setkey (hd, dek->key, dek->keylen);
-//   if (!err)
-//     err = gcry_cipher_setiv (hd, noncelen? seskey : NULL, noncelen);
-//   if (err)
-//     goto leave;
+  if (dek->use_aead)
+    {
+      err = openpgp_aead_algo_info (dek->use_aead, &ciphermode, &noncelen);
+      if (err)
+        return err;
+    }
+  else
+    {
+      ciphermode = GCRY_CIPHER_MODE_CFB;
+      noncelen = 0;
+    }
 
-//   if (dek->use_aead)
-//     {
-//       byte ad[4];
-
-//       ad[0] = (0xc0 | PKT_SYMKEY_ENC);
-//       ad[1] = 5;
-//       ad[2] = dek->algo;
-//       ad[3] = dek->use_aead;
-//       err = gcry_cipher_authenticate (hd, ad, 4);
-//       if (err)
-//         goto leave;
-//       gcry_cipher_final (hd);
-//       keylen = slen - noncelen - 16;
-//       err = gcry_cipher_decrypt (hd, seskey+noncelen, keylen, NULL, 0);
-//       if (err)
-//         goto leave;
-//       err = gcry_cipher_checktag (hd, seskey+noncelen+keylen, 16);
-//       if (err)
-//         goto leave;
-//       /* Now we replace the dek components with the real session key to
-//        * decrypt the contents of the sequencing packet. */
-//       if (keylen > DIM(dek->key))
-//         {
-//           err = gpg_error (GPG_ERR_TOO_LARGE);
-//           goto leave;
-//         }
-//       dek->keylen = keylen;
-//       memcpy (dek->key, seskey + noncelen, dek->keylen);
-//     }
-//   else
-//     {
-//       gcry_cipher_decrypt (hd, seskey, slen, NULL, 0);
-
-//       /* Here we can only test whether the algo given in decrypted
-//        * session key is a valid OpenPGP algo.  With 11 defined
-//        * symmetric algorithms we will miss 4.3% of wrong passphrases
-//        * here.  The actual checking is done later during bulk
-//        * decryption; we can't bring this check forward easily.  We
-//        * need to use the GPG_ERR_CHECKSUM so that we won't run into
-//        * the gnupg < 2.2 bug compatible case which would terminate the
-//        * process on GPG_ERR_CIPHER_ALGO.  Note that with AEAD (above)
-//        * we will have a reliable test here.  */
-//       if (openpgp_cipher_test_algo (seskey[0])
-//           || openpgp_cipher_get_algo_keylen (seskey[0]) != slen - 1)
-//         {
-//           err = gpg_error (GPG_ERR_CHECKSUM);
-//           goto leave;
-//         }
+  /* Check that the session key has a size of 16 to 32 bytes.  */
+  if ((dek->use_aead && (slen < (noncelen + 16 + 16)
+                         || slen > (noncelen + 32 + 16)))
+      || (!dek->use_aead && (slen < 17 || slen > 33)))
+    {
+      printf ("weird size for an encrypted session key (%d)\n", (int)slen);
+      return gpg_error (GPG_ERR_BAD_KEY);
+    }
 
-//       /* Now we replace the dek components with the real session key to
-//        * decrypt the contents of the sequencing packet. */
-//       keylen = slen-1;
-//       if (keylen > DIM(dek->key))
-//         {
-//           err = gpg_error (GPG_ERR_TOO_LARGE);
-//           goto leave;
-//         }
-//       dek->algo = seskey[0];
-//       dek->keylen = slen-1;
-//       memcpy (dek->key, seskey + 1, dek->keylen);
-//     }
+  err = gpg_error (_gcry_cipher_open (&hd, dek->algo, ciphermode));
+  if (!err)
+    err = gpg_error (_gcry_cipher_setkey (hd, dek->key, dek->keylen));
+  if (!err)
+    err = gpg_error (_gcry_cipher_setiv (hd, noncelen? seskey : NULL,
+                                         noncelen));
+  if (err)
+    goto leave;
 
-//   /*log_hexdump( "thekey", dek->key, dek->keylen );*/
+  if (dek->use_aead)
+    {
+      byte ad[4];
+
+      ad[0] = (0xc0 | PKT_SYMKEY_ENC);
+      ad[1] = 5;
+      ad[2] = dek->algo;
+      ad[3] = dek->use_aead;
+      err = gpg_error (_gcry_cipher_authenticate (hd, ad, 4));
+      if (err)
+        goto leave;
+      _gcry_cipher_final (hd);
+      keylen = slen - noncelen - 16;
+      err = gpg_error (_gcry_cipher_decrypt (hd, seskey+noncelen, keylen,
+                                             NULL, 0));
+      if (err)
+        goto leave;
+      err = gpg_error (_gcry_cipher_checktag (hd, seskey+noncelen+keylen, 16));
+      if (err)
+        goto leave;
+      /* Now we replace the dek components with the real session key to
+       * decrypt the contents of the sequencing packet. */
+      err = replace_dek_key (dek, seskey + noncelen, keylen);
+    }
+  else
+    {
+      _gcry_cipher_decrypt (hd, seskey, slen, NULL, 0);
+
+      /* Here we can only test whether the algo given in decrypted
+       * session key is a valid OpenPGP algo.  With 11 defined
+       * symmetric algorithms we will miss 4.3% of wrong passphrases
+       * here.  The actual checking is done later during bulk
+       * decryption; we can't bring this check forward easily.  Note
+       * that with AEAD (above) we will have a reliable test here.  */
+      if (gcry_cipher_get_algo_keylen (seskey[0]) != slen - 1)
+        {
+          err = gpg_error (GPG_ERR_CHECKSUM);
+          goto leave;
+        }
+
+      /* Now we replace the dek components with the real session key to
+       * decrypt the contents of the sequencing packet. */
+      err = replace_dek_key (dek, seskey + 1, slen - 1);
+      if (!err)
+        dek->algo = seskey[0];
+    }
 
-//  leave:
-//   gcry_cipher_close (hd);
-//   return 0;
-// }
+ leave:
+  _gcry_cipher_close (hd);
+  return err;
+}
 
 #define GETPASSWORD_FLAG_SYMDECRYPT 1
 // void derive_key(const uint8_t *salt, const char *password, unsigned int pass_len, uint32_t iterations, uint8_t *key)
@@ -586,9 +605,13 @@ DEK *passphrase_to_dek(int cipher_algo, STRING2KEY *s2k,
   //   {
   //     int err;
 
-  dek->keylen = 16; // openpgp_cipher_get_algo_keylen (dek->algo);
-  // if (!(dek->keylen > 0 && dek->keylen <= DIM(dek->key)))
-  //   BUG ();
+  dek->keylen = gcry_cipher_get_algo_keylen (dek->algo);
+  if (!(dek->keylen > 0 && dek->keylen <= 32)) // DIM(dek->key)
+  {
+    printf("unsupported cipher algorithm %d\n", dek->algo);
+    xfree(dek);
+    return NULL;
+  }
   //     err = gcry_kdf_derive (pw, strlen (pw),
   //                            s2k->mode == 3? GCRY_KDF_ITERSALTED_S2K :
   //                            s2k->mode == 1? GCRY_KDF_SALTED_S2K :
@@ -623,8 +646,40 @@ DEK *passphrase_to_dek(int cipher_algo, STRING2KEY *s2k,
     dek->key = malloc(key_len);
         memcpy(dek->key, derivedKey , key_len);
   }
-  // else
-  //   derive_key(s2k->salt, passphrase, strlen(passphrase), iterations, dek->key);
+  else
+  {
+    gpg_error_t err;
+
+    dek->key = xmalloc(dek->keylen);
+    if (!nocache && (s2k->mode == 1 || s2k->mode == 3))
+    {
+      s2k_cache_id(s2k, s2k_cacheidbuf);
+      s2k_cacheid = s2k_cacheidbuf;
+    }
+    /* A message with the same passphrase and salt costs no KDF.  */
+    if (s2k_cacheid && !s2k_cache_get(s2k, passphrase, dek->key, dek->keylen))
+      err = 0;
+    else
+    {
+      err = gcry_kdf_derive(passphrase, passphrase ? strlen(passphrase) : 0,
+                            s2k->mode == 3 ? GCRY_KDF_ITERSALTED_S2K :
+                            s2k->mode == 1 ? GCRY_KDF_SALTED_S2K :
+                            /* */            GCRY_KDF_SIMPLE_S2K,
+                            s2k->hash_algo, s2k->salt, 8,
+                            iterations, dek->keylen, dek->key);
+      if (!err && s2k_cacheid)
+        s2k_cache_put(s2k, passphrase, dek->key, dek->keylen);
+    }
+    if (err)
+    {
+      printf("gcry_kdf_derive failed: %d\n", err);
+      xfree(dek->key);
+      xfree(dek);
+      return NULL;
+    }
+  }
+  if (s2k_cacheid)
+    memcpy(dek->s2k_cacheid, s2k_cacheid, sizeof dek->s2k_cacheid);
 
   printf("DEK Information:\n");
   printf("Algorithm: %d\n", dek->algo);
@@ -665,12 +720,12 @@ proc_symkey_enc(CTX c, PACKET *pkt)
   {
     // printf("no DEK\n");
     int algo = enc->cipher_algo;
-    const char *s = "CAST5"; // openpgp_cipher_algo_name (algo);
+    const char *s = gcry_cipher_algo_name (algo);
     const char *a =          //(enc->aead_algo ? openpgp_aead_algo_name (enc->aead_algo)
         /**/                 //:
         "CFB";               //);
 
-    if (1) //! openpgp_cipher_test_algo (algo))
+    if (gcry_cipher_get_algo_keylen (algo)) //! openpgp_cipher_test_algo (algo))
     {
       if (1) //! opt.quiet)
       {
@@ -721,7 +776,7 @@ proc_symkey_enc(CTX c, PACKET *pkt)
       // }
       // printf("\n");
       c->dek = passphrase_to_dek(algo,
-                                 &enc->s2k, 0, 1, NULL, 0, 0, c->passphrase, c->session_key); // derivedKey);
+                                 &enc->s2k, 0, 0, NULL, 0, 0, c->passphrase, c->session_key); // derivedKey);
       // printf("LEAVING EARLY\n");
       // goto leave;
       // c->dek = passphrase_to_dek (algo, &enc->s2k, 0, 0, NULL,
@@ -738,35 +793,19 @@ proc_symkey_enc(CTX c, PACKET *pkt)
            be a valid one, which will make the returned dek
            appear valid, so we won't try any public keys that
            come later. */
-        // if (enc->seskeylen)
-        //   {
-        //     err = symkey_decrypt_seskey (c->dek,
-        //                                  enc->seskey, enc->seskeylen);
-        //     if (err)
-        //       {
-        //         printf ("decryption of the symmetrically encrypted"
-        //                    " session key failed: %s\n",
-        //                    gpg_strerror (err));
-        //         if (gpg_err_code (err) != GPG_ERR_BAD_KEY
-        //             && gpg_err_code (err) != GPG_ERR_CHECKSUM)
-        //           log_fatal ("process terminated to be bug compatible\n");
-        //         else
-        //           printf (STATUS_ERROR,
-        //                              "symkey_decrypt.maybe_error"
-        //                              " 11_BAD_PASSPHRASE");
-
-        //         if (c->dek->s2k_cacheid[0])
-        //           {
-        //             // if (opt.debug)
-        //             //   log_debug ("cleared passphrase cached with ID:"
-        //             //              " %s\n", c->dek->s2k_cacheid);
-        //             // passphrase_clear_cache (c->dek->s2k_cacheid);
-        //           }
-        //         xfree (c->dek);
-        //         c->dek = NULL;
-        //       }
-        //   }
-        // else
+        if (enc->seskeylen)
+          {
+            err = symkey_decrypt_seskey (c->dek,
+                                         enc->seskey, enc->seskeylen);
+            if (err)
+              {
+                printf ("decryption of the symmetrically encrypted"
+                        " session key failed: %d\n", err);
+                release_dek (c->dek);
+                c->dek = NULL;
+              }
+          }
+        if (c->dek)
         c->dek->algo_info_printed = 1;
       }
     } 
@@ -788,7 +827,7 @@ leave:
     c->symenc_list = symitem;
   }
   c->symkeys++;
-  //   free_packet (pkt, NULL);
+  free_packet (pkt, NULL);
 }
 
 // static void
@@ -1096,6 +1135,8 @@ proc_encrypted(CTX c, PACKET *pkt)
   //       compliance_de_vs |= 1;
   //   }
 // printf("pkt->pkt.encrypted: %p\n", (void*)pkt->pkt.encrypted);
+  if (!result && !c->dek)
+    result = gpg_error (GPG_ERR_NO_SECKEY); /* E.g. a bad session key.  */
   if (!result)
   {
     int compl_error;
@@ -1110,6 +1151,15 @@ proc_encrypted(CTX c, PACKET *pkt)
    * printf printed in the cry_cipher_checktag never gets ignored.  */
   if (!result && early_plaintext)
     result = gpg_error(GPG_ERR_BAD_DATA);
+  /* A sink error (see proc_plaintext) does not reach decrypt_data's
+   * return value either.  It goes first: inside a compressed packet it
+   * also fails the uncompression below.  */
+  if (!result && c->decrypt_err)
+    result = c->decrypt_err;
+  /* An error in a compressed packet inside the encrypted data does
+   * not reach decrypt_data's return value.  */
+  if (!result && c->any.uncompress_failed)
+    result = gpg_error(GPG_ERR_BAD_DATA);
   // else if (!result && pkt->pkt.encrypted->aead_algo
   //          && log_get_errorcount (0))
   //   result = gpg_error (GPG_ERR_BAD_SIGNATURE);
@@ -1147,12 +1197,11 @@ proc_encrypted(CTX c, PACKET *pkt)
   //     printf (("decryption forced to fail!\n"));
   //     printf (STATUS_DECRYPTION_FAILED);
   //   }
-  else if (!result || (gpg_err_code(result) == GPG_ERR_BAD_SIGNATURE && !pkt->pkt.encrypted->aead_algo && 1)) // opt.ignore_mdc_error))
+  else if (!result || (gpg_err_code(result) == GPG_ERR_BAD_SIGNATURE && !pkt->pkt.encrypted->aead_algo && 0)) // opt.ignore_mdc_error))
   {
     /* All is fine or for an MDC message the MDC failed but the
      * --ignore-mdc-error option is active.  For compatibility
      * reasons we issue GOODMDC also for AEAD messages.  */
-    printf(STATUS_DECRYPTION_OKAY);
     // if (opt.verbose > 1)
     printf(("decryption okay\n"));
 
@@ -1161,41 +1210,26 @@ proc_encrypted(CTX c, PACKET *pkt)
     //     printf (STATUS_GOODMDC);
     //     compliance_de_vs |= 4;
     //   }
-    // else if (pkt->pkt.encrypted->mdc_method && !result)
-    //   {
-    //     printf (STATUS_GOODMDC);
-    //     compliance_de_vs |= 4;
-    //   }
     // else
-    printf(("WARNING: message was not integrity protected\n"));
+    if (pkt->pkt.encrypted->mdc_method && !result)
+    {
+      // printf (STATUS_GOODMDC);
+      compliance_de_vs |= 4;
+    }
+    else
+      printf(("WARNING: message was not integrity protected\n"));
   }
   else if (gpg_err_code(result) == GPG_ERR_BAD_SIGNATURE || gpg_err_code(result) == GPG_ERR_TRUNCATED)
   {
     // glo_ctrl.lasterr = result;
+    c->decrypt_err = result;
     printf(("WARNING: encrypted message has been manipulated!\n"));
-    printf(STATUS_BADMDC);
-    printf(STATUS_DECRYPTION_FAILED);
   }
   else
   {
-    if (gpg_err_code(result) == GPG_ERR_BAD_KEY || gpg_err_code(result) == GPG_ERR_CHECKSUM || gpg_err_code(result) == GPG_ERR_CIPHER_ALGO)
-    {
-      if (c->symkeys)
-        printf(STATUS_ERROR,
-               "symkey_decrypt.maybe_error"
-               " 11_BAD_PASSPHRASE");
-
-      // if (*c->dek->s2k_cacheid != '\0')
-      //   {
-      //     if (opt.debug)
-      //       log_debug ("cleared passphrase cached with ID: %s\n",
-      //                  c->dek->s2k_cacheid);
-      //     passphrase_clear_cache (c->dek->s2k_cacheid);
-      //   }
-    }
     // glo_ctrl.lasterr = result;
-    printf(STATUS_DECRYPTION_FAILED);
-    printf(("decryption failed: %s\n")); //, gpg_strerror (result));
+    c->decrypt_err = result;
+    printf("decryption failed: %d\n", result); //, gpg_strerror (result));
     /* Hmmm: does this work when we have encrypted using multiple
      * ways to specify the session key (symmmetric and PK). */
   }
@@ -1211,11 +1245,10 @@ proc_encrypted(CTX c, PACKET *pkt)
       printf("COMMMENTED OUT\n");
   }
 
-  xfree(c->dek);
+  release_dek(c->dek);
   c->dek = NULL;
   free_packet(pkt, NULL);
   c->last_was_session_key = 0;
-  printf(STATUS_END_DECRYPTION);
 
   /* Bump the counter even if we have not seen a literal data packet
    * inside an encryption container.  This acts as a sentinel in case
@@ -1250,6 +1283,31 @@ have_seen_pkt_encrypted_aead_or_mdc(CTX c)
   return 0;
 }
 
+static void
+proc_plaintext(CTX c, PACKET *pkt)
+{
+  PKT_plaintext *pt = pkt->pkt.plaintext;
+  CTX cc;
+  int rc;
+
+  /* This is a literal data packet.  Bumb a counter for later checks.  */
+  literals_seen++;
+
+  rc = handle_plaintext(pt, c->ctrl->sink);
+  if (rc)
+  {
+    /* The sink's error fails the message.  The literal data sits in
+     * contexts below the one do_proc_packets returns from, so record
+     * it all the way up.  */
+    printf("handle plaintext failed: %d\n", rc);
+    for (cc = c; cc; cc = cc->anchor)
+      if (!cc->decrypt_err)
+        cc->decrypt_err = rc;
+  }
+  free_packet(pkt, NULL);
+  c->last_was_session_key = 0;
+}
+
 // static void
 // proc_plaintext( CTX c, PACKET *pkt )
 // {
@@ -1406,38 +1464,33 @@ proc_encrypt_cb(iobuf_t a, void *info)
   return proc_encryption_packets(c->ctrl, info, a);
 }
 
-// static int
-// proc_compressed (CTX c, PACKET *pkt)
-// {
-//   PKT_compressed *zd = pkt->pkt.compressed;
-//   int rc;
+static int
+proc_compressed (CTX c, PACKET *pkt)
+{
+  PKT_compressed *zd = pkt->pkt.compressed;
+  int rc;
 
-//   /*printf("zip: compressed data packet\n");*/
-//   if (c->sigs_only)
-//     rc = handle_compressed (c->ctrl, c, zd, proc_compressed_cb, c);
-//   else if( c->encrypt_only )
-//     rc = handle_compressed (c->ctrl, c, zd, proc_encrypt_cb, c);
-//   else
-//     rc = handle_compressed (c->ctrl, c, zd, NULL, NULL);
+  /*printf("zip: compressed data packet\n");*/
+  if( c->encrypt_only )
+    rc = handle_compressed (c->ctrl, c, zd, proc_encrypt_cb, c);
+  else
+    rc = handle_compressed (c->ctrl, c, zd, NULL, NULL);
 
-//   if (gpg_err_code (rc) == GPG_ERR_BAD_DATA)
-//     {
-//       if  (!c->any.uncompress_failed)
-//         {
-//           CTX cc;
+  /* There is no error count to bump here; the flag is what makes
+   * proc_encrypted fail, also for an unsupported algorithm.  */
+  if (rc && !c->any.uncompress_failed)
+    {
+      CTX cc;
 
-//           for (cc=c; cc; cc = cc->anchor)
-//             cc->any.uncompress_failed = 1;
-//           printf ("uncompressing failed: %s\n", gpg_strerror (rc));
-//         }
-//     }
-//   else if (rc)
-//     printf ("uncompressing failed: %s\n", gpg_strerror (rc));
+      for (cc=c; cc; cc = cc->anchor)
+        cc->any.uncompress_failed = 1;
+      printf ("uncompressing failed: %d\n", rc);
+    }
 
-//   free_packet (pkt, NULL);
-//   c->last_was_session_key = 0;
-//   return rc;
-// }
+  free_packet (pkt, NULL);
+  c->last_was_session_key = 0;
+  return rc;
+}
 
 // /*
 //  * Check the signature.  If R_PK is not NULL a copy of the public key
@@ -1904,7 +1957,6 @@ check_nesting(CTX c)
   if (level > MAX_NESTING_DEPTH)
   {
     printf("input data with too deeply nested packets\n");
-    printf(STATUS_UNEXPECTED, "1");
     return GPG_ERR_BAD_DATA;
   }
 
@@ -1917,7 +1969,17 @@ do_proc_packets(ctrl_t ctrl, CTX c, iobuf_t a)
   // printf("do_proc_packets %d\n%s\n", ctrl->enc_length, ctrl->passphrase);
 
   // printf("do_proc_packets\n");// %s\n", ctrl->passphrase);
-  // Copy across any main ctx passphrase or session_key
+  PACKET *pkt;
+  struct parse_packet_ctx_s parsectx;
+  int rc = 0;
+  int any_data = 0;
+  int newpkt;
+
+  rc = check_nesting(c);
+  if (rc)
+    return rc;
+
+  // Copy across any main ctx passphrase or session_key; freed on leave
   if (ctrl->passphrase != NULL)
   {
     c->passphrase = malloc(strlen(ctrl->passphrase) + 1);
@@ -1937,16 +1999,6 @@ do_proc_packets(ctrl_t ctrl, CTX c, iobuf_t a)
   c->enc_len = ctrl->enc_length;
 
   // log_printhex(c->iobuf->d.buf,c->iobuf->d.len,"do_proc_packets");
-  PACKET *pkt;
-  struct parse_packet_ctx_s parsectx;
-  int rc = 0;
-  int any_data = 0;
-  int newpkt;
-
-  rc = check_nesting(c);
-  if (rc)
-    return rc;
-
   pkt = xmalloc(sizeof *pkt);
   c->iobuf = a;
   init_packet(pkt);
@@ -2027,7 +2079,9 @@ do_proc_packets(ctrl_t ctrl, CTX c, iobuf_t a)
         proc_encrypted(c, pkt);
         break;
       // case PKT_PLAINTEXT:   proc_plaintext (c, pkt); break;
-      // case PKT_COMPRESSED:  rc = proc_compressed (c, pkt); break;
+      case PKT_COMPRESSED:
+        rc = proc_compressed(c, pkt);
+        break;
       // case PKT_ONEPASS_SIG: newpkt = add_onepass_sig (c, pkt); break;
       // case PKT_GPG_CONTROL: newpkt = add_gpg_control (c, pkt); break;
       default:
@@ -2035,6 +2089,22 @@ do_proc_packets(ctrl_t ctrl, CTX c, iobuf_t a)
         break;
       }
     }
+    else
+    {
+      /* The packets inside the decrypted data.  */
+      switch (pkt->pkttype)
+      {
+      case PKT_PLAINTEXT:
+        proc_plaintext(c, pkt);
+        break;
+      case PKT_COMPRESSED:
+        rc = proc_compressed(c, pkt);
+        break;
+      default:
+        newpkt = 0;
+        break;
+      }
+    }
     //     else
     //       {
     //         switch (pkt->pkttype)
@@ -2090,17 +2160,35 @@ do_proc_packets(ctrl_t ctrl, CTX c, iobuf_t a)
       free_packet(pkt, &parsectx);
   }
 
-  if (rc == GPG_ERR_INV_PACKET)
-    printf(STATUS_NODATA, "3");
-
   if (any_data)
     rc = 0;
-  else if (rc == -1)
-    printf(STATUS_NODATA, "2");
+  /* The plaintext has gone to the sink; this is how the caller learns
+     that it must not be trusted.  */
+  if (!rc)
+    rc = c->decrypt_err;
 
 leave:
   //  release_list (c);
-  xfree(c->dek);
+  release_dek(c->dek);
+  c->dek = NULL;
+  while (c->symenc_list)
+  {
+    struct symlist_item *tmp = c->symenc_list->next;
+    xfree(c->symenc_list);
+    c->symenc_list = tmp;
+  }
+  if (c->passphrase)
+  {
+    wipememory(c->passphrase, strlen(c->passphrase));
+    free(c->passphrase);
+    c->passphrase = NULL;
+  }
+  if (c->session_key)
+  {
+    wipememory(c->session_key, strlen((char *)c->session_key));
+    free(c->session_key);
+    c->session_key = NULL;
+  }
   free_packet(pkt, &parsectx);
   deinit_parse_packet(&parsectx);
   xfree(pkt);
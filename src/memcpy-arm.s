@@ -0,0 +1,129 @@
+/* memcpy-arm.s - ARM memcpy/memset for Cortex-A7
+ *
+ * After newlib's libc/machine/arm/memcpy.S (archive/newlib-xtensa-*):
+ * align the destination with byte moves, then move 32 bytes per
+ * iteration with LDM/STM when the source is word aligned too.  newlib
+ * falls back to unaligned LDR for a misaligned source; that faults while
+ * the MMU is off (all memory is strongly ordered), so this version uses
+ * byte-element VLD1/VST1 instead, which never take an alignment fault.
+ *
+ * Built only with USE_ARM_ASM=1 (see Makefile); otherwise memory.c
+ * provides both in C.  memmove in memory.c relies on memcpy copying
+ * strictly forwards and loading each chunk before storing it.  Each
+ * function has a .text.<name> section of its own for
+ * src/section-order.ld.
+ */
+
+    .syntax unified
+    .arm
+    .fpu neon-vfpv4
+
+/* void *memcpy(void *dst, const void *src, size_t n) */
+    .section .text.memcpy,"ax",%progbits
+    .align 3
+    .global memcpy
+    .type   memcpy, %function
+memcpy:
+    mov     ip, r0                      /* r0 is the return value */
+    cmp     r2, #16
+    blo     .Lcpy_bytes
+
+.Lcpy_head:
+    tst     ip, #3
+    beq     .Lcpy_dst_aligned
+    ldrb    r3, [r1], #1
+    sub     r2, r2, #1
+    strb    r3, [ip], #1
+    b       .Lcpy_head
+
+.Lcpy_dst_aligned:
+    tst     r1, #3
+    bne     .Lcpy_neon
+
+    push    {r4-r10}
+    subs    r2, r2, #32
+    blo     .Lcpy_ldm_done
+.Lcpy_ldm:
+    ldmia   r1!, {r3-r10}
+    subs    r2, r2, #32
+    stmia   ip!, {r3-r10}
+    bhs     .Lcpy_ldm
+.Lcpy_ldm_done:
+    add     r2, r2, #32
+    pop     {r4-r10}
+
+.Lcpy_words:
+    subs    r2, r2, #4
+    ldrhs   r3, [r1], #4
+    strhs   r3, [ip], #4
+    bhs     .Lcpy_words
+    add     r2, r2, #4
+    b       .Lcpy_bytes
+
+.Lcpy_neon:
+    subs    r2, r2, #32
+    blo     .Lcpy_neon_done
+.Lcpy_neon_loop:
+    vld1.8  {d0-d3}, [r1]!
+    subs    r2, r2, #32
+    vst1.8  {d0-d3}, [ip]!
+    bhs     .Lcpy_neon_loop
+.Lcpy_neon_done:
+    add     r2, r2, #32
+
+.Lcpy_bytes:
+    subs    r2, r2, #1
+    ldrbhs  r3, [r1], #1
+    strbhs  r3, [ip], #1
+    bhs     .Lcpy_bytes
+    bx      lr
+    .size   memcpy, .-memcpy
+
+/* void *memset(void *dst, int c, size_t n) */
+    .section .text.memset,"ax",%progbits
+    .align 3
+    .global memset
+    .type   memset, %function
+memset:
+    mov     ip, r0                      /* r0 is the return value */
+    and     r1, r1, #0xff
+    cmp     r2, #16
+    blo     .Lset_bytes
+
+.Lset_head:
+    tst     ip, #3
+    beq     .Lset_dst_aligned
+    strb    r1, [ip], #1
+    sub     r2, r2, #1
+    b       .Lset_head
+
+.Lset_dst_aligned:
+    orr     r1, r1, r1, lsl #8
+    orr     r1, r1, r1, lsl #16
+    push    {r4, r5}
+    mov     r3, r1
+    mov     r4, r1
+    mov     r5, r1
+    subs    r2, r2, #32
+    blo     .Lset_stm_done
+.Lset_stm:
+    stmia   ip!, {r1, r3, r4, r5}
+    subs    r2, r2, #32
+    stmia   ip!, {r1, r3, r4, r5}
+    bhs     .Lset_stm
+.Lset_stm_done:
+    add     r2, r2, #32
+    pop     {r4, r5}
+
+.Lset_words:
+    subs    r2, r2, #4
+    strhs   r1, [ip], #4
+    bhs     .Lset_words
+    add     r2, r2, #4
+
+.Lset_bytes:
+    subs    r2, r2, #1
+    strbhs  r1, [ip], #1
+    bhs     .Lset_bytes
+    bx      lr
+    .size   memset, .-memset
@@ -1,158 +1,329 @@
 #include "memory.h"
 #include "printf.h"
+#include "prof.h"
 
 // External symbols from linker script
 extern char __heap_start[], __heap_end[];
 
-// Memory allocator definitions
-#define HEAP_SIZE (__heap_end - __heap_start)  // Use linker-defined heap (2MB)
-#define BLOCK_SIZE 16          // Minimum block size
-#define MAX_BLOCKS (HEAP_SIZE / BLOCK_SIZE)
+/*
+ * Two-level segregated fit (TLSF) allocator over the linker-defined heap.
+ *
+ * Free blocks are kept in size-class lists indexed by (fl, sl): fl is the
+ * position of the size's top bit, sl splits each power of two into
+ * SL_INDEX_COUNT linear steps.  Two bitmaps record which lists are
+ * non-empty, so malloc finds a fitting class with one or two ctz and
+ * free coalesces through boundary tags; neither walks the heap.
+ */
 
-// Block header structure
+#define ALIGN_SIZE_LOG2 (sizeof(size_t) == 8 ? 4 : 3)
+#define ALIGN_SIZE (1 << ALIGN_SIZE_LOG2)  // Payload alignment (8 on ARM)
+
+#define SL_INDEX_COUNT_LOG2 4
+#define SL_INDEX_COUNT (1 << SL_INDEX_COUNT_LOG2)
+#define FL_INDEX_MAX 30                    // Largest block is < 1GB
+#define FL_INDEX_SHIFT (SL_INDEX_COUNT_LOG2 + ALIGN_SIZE_LOG2)
+#define FL_INDEX_COUNT (FL_INDEX_MAX - FL_INDEX_SHIFT + 1)
+#define SMALL_BLOCK_SIZE (1 << FL_INDEX_SHIFT)
+
+// Low bits of block_header_t.size
+#define BLOCK_FREE      1
+#define BLOCK_PREV_FREE 2
+#define BLOCK_FLAGS     (BLOCK_FREE | BLOCK_PREV_FREE)
+
+// Block header structure.  The size is the payload size; the free list
+// links overlay the payload and only exist while the block is free.
 typedef struct block_header {
-    size_t size;  // Size including header
-    uint8_t is_free;
-    struct block_header* next;
+    struct block_header* prev_phys;  // Physically previous block
+    size_t size;                     // Payload size | BLOCK_* flags
+    struct block_header* next_free;
+    struct block_header* prev_free;
 } block_header_t;
 
-// Use linker-defined heap instead of static array
-static uint8_t* heap = (uint8_t*)__heap_start;
-static block_header_t* free_list = NULL;
+#define BLOCK_OVERHEAD offsetof(block_header_t, next_free)
+#define BLOCK_SIZE_MIN (sizeof(block_header_t) - BLOCK_OVERHEAD)
+#define BLOCK_SIZE_MAX ((size_t)1 << FL_INDEX_MAX)
+
+static uint8_t *heap_lo, *heap_hi;
 static uint8_t heap_initialized = 0;
 
-// Debug function to print heap state
-void print_heap_debug(void) {
-    if (!heap_initialized) {
-        printf("Heap not initialized\n");
-        return;
+static uint32_t fl_bitmap;
+static uint32_t sl_bitmap[FL_INDEX_COUNT];
+static block_header_t* blocks[FL_INDEX_COUNT][SL_INDEX_COUNT];
+
+// Statistics, kept up to date by malloc/free/xrealloc
+static size_t stat_heap_size;
+static size_t stat_in_use;
+static size_t stat_peak;
+static size_t stat_free;
+static size_t stat_count;
+
+static inline int fls_size(size_t x) {
+    return (int)(sizeof(size_t) * 8 - 1) - __builtin_clzl(x);
+}
+
+static inline size_t block_size(const block_header_t* b) {
+    return b->size & ~(size_t)BLOCK_FLAGS;
+}
+
+static inline void* block_to_ptr(block_header_t* b) {
+    return (uint8_t*)b + BLOCK_OVERHEAD;
+}
+
+static inline block_header_t* block_from_ptr(void* p) {
+    return (block_header_t*)((uint8_t*)p - BLOCK_OVERHEAD);
+}
+
+static inline block_header_t* block_next(block_header_t* b) {
+    return (block_header_t*)((uint8_t*)block_to_ptr(b) + block_size(b));
+}
+
+// Map a size to the list it is filed under.
+static void mapping_insert(size_t size, int* fli, int* sli) {
+    int fl, sl;
+
+    if (size < SMALL_BLOCK_SIZE) {
+        fl = 0;
+        sl = size / (SMALL_BLOCK_SIZE / SL_INDEX_COUNT);
+    } else {
+        fl = fls_size(size);
+        sl = (size >> (fl - SL_INDEX_COUNT_LOG2)) ^ (1 << SL_INDEX_COUNT_LOG2);
+        fl -= FL_INDEX_SHIFT - 1;
     }
-    
-    // printf("=== Heap Debug ===\n");
-    block_header_t* curr = free_list;
-    size_t total_free = 0;
-    size_t largest_free = 0;
-    int block_count = 0;
-    
-    while (curr) {
-        // printf("Block %d: addr=%p, size=%zu, free=%d\n", 
-        //        block_count, (void*)curr, curr->size, curr->is_free);
-        
-        if (curr->is_free) {
-            total_free += curr->size;
-            if (curr->size > largest_free) {
-                largest_free = curr->size;
-            }
-        }
-        
-        curr = curr->next;
-        block_count++;
-        
-        // Safety check to prevent infinite loops
-        if (block_count > 1000) {
-            printf("ERROR: Too many blocks, possible corruption\n");
-            break;
-        }
+    *fli = fl;
+    *sli = sl;
+}
+
+// Map a request to the first list whose blocks are all large enough.
+static void mapping_search(size_t size, int* fli, int* sli) {
+    if (size >= SMALL_BLOCK_SIZE)
+        size += ((size_t)1 << (fls_size(size) - SL_INDEX_COUNT_LOG2)) - 1;
+    mapping_insert(size, fli, sli);
+}
+
+static block_header_t* search_suitable_block(int* fli, int* sli) {
+    int fl = *fli, sl = *sli;
+    uint32_t sl_map = sl_bitmap[fl] & (~0U << sl);
+
+    if (!sl_map) {
+        uint32_t fl_map = fl_bitmap & (~0U << (fl + 1));
+        if (!fl_map)
+            return NULL;
+        fl = __builtin_ctz(fl_map);
+        sl_map = sl_bitmap[fl];
     }
-    
-    // printf("Total free: %zu bytes, Largest free block: %zu bytes\n", 
-    //        total_free, largest_free);
-    // printf("==================\n");
+    sl = __builtin_ctz(sl_map);
+    *fli = fl;
+    *sli = sl;
+    return blocks[fl][sl];
+}
+
+static void insert_free_block(block_header_t* b) {
+    int fl, sl;
+    block_header_t* head;
+
+    mapping_insert(block_size(b), &fl, &sl);
+    head = blocks[fl][sl];
+    b->next_free = head;
+    b->prev_free = NULL;
+    if (head)
+        head->prev_free = b;
+    blocks[fl][sl] = b;
+    fl_bitmap |= 1U << fl;
+    sl_bitmap[fl] |= 1U << sl;
+
+    b->size |= BLOCK_FREE;
+    block_next(b)->size |= BLOCK_PREV_FREE;
+    stat_free += block_size(b);
+}
+
+static void remove_free_block(block_header_t* b) {
+    int fl, sl;
+
+    mapping_insert(block_size(b), &fl, &sl);
+    if (b->prev_free)
+        b->prev_free->next_free = b->next_free;
+    else
+        blocks[fl][sl] = b->next_free;
+    if (b->next_free)
+        b->next_free->prev_free = b->prev_free;
+    if (!blocks[fl][sl]) {
+        sl_bitmap[fl] &= ~(1U << sl);
+        if (!sl_bitmap[fl])
+            fl_bitmap &= ~(1U << fl);
+    }
+
+    b->size &= ~(size_t)BLOCK_FREE;
+    block_next(b)->size &= ~(size_t)BLOCK_PREV_FREE;
+    stat_free -= block_size(b);
+}
+
+// Cut a used block down to SIZE and return the tail to the free lists.
+static void block_trim_used(block_header_t* b, size_t size) {
+    block_header_t* rest;
+    block_header_t* next;
+    size_t remain = block_size(b) - size;
+
+    if (remain < sizeof(block_header_t))
+        return;
+
+    rest = (block_header_t*)((uint8_t*)block_to_ptr(b) + size);
+    rest->prev_phys = b;
+    rest->size = remain - BLOCK_OVERHEAD;
+    b->size = size | (b->size & BLOCK_PREV_FREE);
+    stat_in_use -= remain;
+
+    // Keep the tail coalesced with a free successor.
+    next = block_next(rest);
+    next->prev_phys = rest;
+    if (next->size & BLOCK_FREE) {
+        remove_free_block(next);
+        rest->size += BLOCK_OVERHEAD + block_size(next);
+        block_next(rest)->prev_phys = rest;
+    }
+    insert_free_block(rest);
 }
 
-// Initialize heap
+// Initialize heap: one free block spanning the region, followed by a
+// zero-sized used sentinel so block_next() never leaves the heap.
 static void init_heap(void) {
+    block_header_t *first, *sentinel;
+    size_t size;
+
     if (heap_initialized) return;
-    
-    free_list = (block_header_t*)heap;
-    free_list->size = HEAP_SIZE;
-    free_list->is_free = 1;
-    free_list->next = NULL;
-    
+
+    heap_lo = (uint8_t*)(((uintptr_t)__heap_start + ALIGN_SIZE - 1) & ~(uintptr_t)(ALIGN_SIZE - 1));
+    heap_hi = (uint8_t*)((uintptr_t)__heap_end & ~(uintptr_t)(ALIGN_SIZE - 1));
+    size = heap_hi - heap_lo - 2 * BLOCK_OVERHEAD;
+    if (size >= BLOCK_SIZE_MAX)
+        size = BLOCK_SIZE_MAX - ALIGN_SIZE;
+
+    first = (block_header_t*)heap_lo;
+    first->prev_phys = NULL;
+    first->size = size;
+    sentinel = block_next(first);
+    sentinel->prev_phys = first;
+    sentinel->size = 0;
+    insert_free_block(first);
+
+    stat_heap_size = size;
     heap_initialized = 1;
-    // printf("Heap initialized: %zu KB at %p\n", HEAP_SIZE/1024, (void*)heap);
+    // printf("Heap initialized: %zu KB at %p\n", stat_heap_size/1024, (void*)heap_lo);
+}
+
+static size_t adjust_request(size_t size) {
+    size = (size + ALIGN_SIZE - 1) & ~(size_t)(ALIGN_SIZE - 1);
+    return size < BLOCK_SIZE_MIN ? BLOCK_SIZE_MIN : size;
+}
+
+void heap_get_stats(heap_stats_t* st) {
+    int fl, sl;
+    block_header_t* b;
+
+    if (!heap_initialized) init_heap();
+
+    st->heap_size = stat_heap_size;
+    st->in_use = stat_in_use;
+    st->peak_in_use = stat_peak;
+    st->free_bytes = stat_free;
+    st->allocations = stat_count;
+
+    // The largest free block is in the highest non-empty list.
+    st->largest_free = 0;
+    if (fl_bitmap) {
+        fl = fls_size(fl_bitmap);
+        sl = fls_size(sl_bitmap[fl]);
+        for (b = blocks[fl][sl]; b; b = b->next_free)
+            if (block_size(b) > st->largest_free)
+                st->largest_free = block_size(b);
+    }
+    st->fragmentation = stat_free
+        ? 100 - (unsigned)((uint64_t)st->largest_free * 100 / stat_free)
+        : 0;
+}
+
+// Debug function to print heap state
+void print_heap_debug(void) {
+    heap_stats_t st;
+
+    heap_get_stats(&st);
+    printf("heap: %d/%d bytes in use (peak %d) in %d blocks, "
+           "%d free, largest %d, fragmentation %d%%\n",
+           (int)st.in_use, (int)st.heap_size, (int)st.peak_in_use,
+           (int)st.allocations, (int)st.free_bytes, (int)st.largest_free,
+           (int)st.fragmentation);
 }
 
 // Memory allocation
-void* malloc(size_t size) {
+static void* heap_alloc(size_t size) {
+    block_header_t* b;
+    int fl, sl;
+
     if (!heap_initialized) init_heap();
-    if (size == 0) return NULL;
-    
-    // Align size to BLOCK_SIZE
-    size_t total_size = (size + sizeof(block_header_t) + (BLOCK_SIZE-1)) & ~(BLOCK_SIZE-1);
-    
-    block_header_t *curr = free_list;
-    
-    // Find first fit
-    while (curr) {
-        if (curr->is_free && curr->size >= total_size) {
-            // Split block if too large
-            if (curr->size >= total_size + BLOCK_SIZE + sizeof(block_header_t)) {
-                block_header_t* next = (block_header_t*)((uint8_t*)curr + total_size);
-                next->size = curr->size - total_size;
-                next->is_free = 1;
-                next->next = curr->next;
-                curr->size = total_size;
-                curr->next = next;
-            }
-            
-            curr->is_free = 0;
-            void* ptr = (void*)((uint8_t*)curr + sizeof(block_header_t));
-            // printf("malloc(%zu) -> %p (total_size=%zu)\n", size, ptr, total_size);
-            return ptr;
-        }
-        curr = curr->next;
+    if (size == 0 || size > BLOCK_SIZE_MAX / 2) return NULL;
+
+    size = adjust_request(size);
+    mapping_search(size, &fl, &sl);
+    if (fl >= FL_INDEX_COUNT || !(b = search_suitable_block(&fl, &sl))) {
+        // printf("malloc(%zu) FAILED - no space available\n", size);
+        print_heap_debug();
+        return NULL;  // No space found
     }
-    
-    // printf("malloc(%zu) FAILED - no space available\n", size);
-    print_heap_debug();
-    return NULL;  // No space found
+
+    remove_free_block(b);
+    stat_in_use += block_size(b);
+    stat_count++;
+    block_trim_used(b, size);
+    if (stat_in_use > stat_peak)
+        stat_peak = stat_in_use;
+    return block_to_ptr(b);
 }
 
-// Fixed memory deallocation
-void free(void* ptr) {
+// Memory deallocation with boundary-tag coalescing
+static void heap_free(void* ptr) {
+    block_header_t *b, *prev, *next;
+
     if (!ptr) return;
-    
-    block_header_t* header = (block_header_t*)((uint8_t*)ptr - sizeof(block_header_t));
-    
-    // Sanity check - make sure this looks like a valid header
-    if ((uint8_t*)header < heap || (uint8_t*)header >= heap + HEAP_SIZE) {
-        // printf("free(%p) - invalid pointer, header at %p outside heap\n", ptr, (void*)header);
+
+    b = block_from_ptr(ptr);
+
+    // Sanity check - make sure this looks like a valid, allocated block
+    if ((uint8_t*)b < heap_lo || (uint8_t*)b >= heap_hi || (b->size & BLOCK_FREE)) {
+        // printf("free(%p) - invalid pointer or double free\n", ptr);
         return;
     }
-    
-    // printf("free(%p) - freeing block of size %zu\n", ptr, header->size);
-    header->is_free = 1;
-    
-    // Forward coalescing - merge with next block if it's free
-    if (header->next && header->next->is_free && 
-        (uint8_t*)header + header->size == (uint8_t*)header->next) {
-        // printf("Coalescing forward: %zu + %zu = %zu\n", 
-        //        header->size, header->next->size, header->size + header->next->size);
-        header->size += header->next->size;
-        header->next = header->next->next;
+
+    stat_in_use -= block_size(b);
+    stat_count--;
+
+    if (b->size & BLOCK_PREV_FREE) {
+        prev = b->prev_phys;
+        remove_free_block(prev);
+        prev->size += BLOCK_OVERHEAD + block_size(b);
+        b = prev;
     }
-    
-    // Backward coalescing - find previous block and merge if possible
-    block_header_t* prev = NULL;
-    block_header_t* curr = free_list;
-    
-    // Find the previous block
-    while (curr && curr != header) {
-        if (curr->is_free && (uint8_t*)curr + curr->size == (uint8_t*)header) {
-            // Found previous block that can be coalesced
-            // printf("Coalescing backward: %zu + %zu = %zu\n", 
-            //        curr->size, header->size, curr->size + header->size);
-            curr->size += header->size;
-            curr->next = header->next;
-            return; // We're done
-        }
-        prev = curr;
-        curr = curr->next;
+    next = block_next(b);
+    if (next->size & BLOCK_FREE) {
+        remove_free_block(next);
+        b->size += BLOCK_OVERHEAD + block_size(next);
+        next = block_next(b);
     }
-    
-    // If we get here, no backward coalescing was possible
-    // The block is already marked as free and forward coalescing is done
+    next->prev_phys = b;
+    insert_free_block(b);
+}
+
+void* malloc(size_t size) {
+    void* ptr;
+
+    PROF_BEGIN(PROF_MALLOC);
+    ptr = heap_alloc(size);
+    PROF_END(PROF_MALLOC, size);
+    return ptr;
+}
+
+void free(void* ptr) {
+    PROF_BEGIN(PROF_FREE);
+    heap_free(ptr);
+    PROF_END(PROF_FREE, 0);
 }
 
 // Rest of the memory functions remain the same...
@@ -211,6 +382,8 @@ void xfree(void* p) {
 
 void* xrealloc(void* p, size_t n) {
     void* new_ptr;
+    block_header_t *b, *next;
+    size_t old_size, want;
     
     if (!p) {
         return malloc(n);
@@ -220,11 +393,30 @@ void* xrealloc(void* p, size_t n) {
         free(p);
         return NULL;
     }
+    if (n > BLOCK_SIZE_MAX / 2) {
+        return NULL;
+    }
     
-    block_header_t* header = (block_header_t*)((uint8_t*)p - sizeof(block_header_t));
-    size_t old_size = header->size - sizeof(block_header_t);
+    b = block_from_ptr(p);
+    old_size = block_size(b);
+    want = adjust_request(n);
     
-    if (n <= old_size) {
+    if (want <= old_size) {
+        block_trim_used(b, want);
+        return p;
+    }
+    
+    // Grow in place by absorbing a free successor.
+    next = block_next(b);
+    if ((next->size & BLOCK_FREE) &&
+        old_size + BLOCK_OVERHEAD + block_size(next) >= want) {
+        remove_free_block(next);
+        b->size += BLOCK_OVERHEAD + block_size(next);
+        block_next(b)->prev_phys = b;
+        stat_in_use += block_size(b) - old_size;
+        block_trim_used(b, want);
+        if (stat_in_use > stat_peak)
+            stat_peak = stat_in_use;
         return p;
     }
     
@@ -239,37 +431,137 @@ void* xrealloc(void* p, size_t n) {
     return new_ptr;
 }
 
-// Rest of the functions remain the same...
+/*
+ * memset/memcpy/memmove move a machine word at a time once the
+ * destination is aligned.  Only aligned word accesses are made: with the
+ * MMU off all memory is strongly ordered and an unaligned LDR/STR faults.
+ * When source and destination disagree on alignment, aligned source
+ * words are merged with shifts, which may read bytes just outside
+ * [src, src + n) but never outside the words that contain it.
+ *
+ * With USE_ARM_ASM, memcpy and memset come from memcpy-arm.s instead.
+ */
+typedef unsigned long word_t __attribute__((__may_alias__));
+#define WORD_SIZE sizeof(word_t)
+#define WORD_MASK (WORD_SIZE - 1)
+#define MEM_SMALL (4 * WORD_SIZE)  // Below this the byte loop is cheaper
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define WORD_MERGE(lo, hi, sh) (((lo) << (sh)) | ((hi) >> (8 * WORD_SIZE - (sh))))
+#else
+#define WORD_MERGE(lo, hi, sh) (((lo) >> (sh)) | ((hi) << (8 * WORD_SIZE - (sh))))
+#endif
+
+#ifndef USE_ARM_ASM
 void* memset(void* dest, int c, size_t n) {
     unsigned char* p = dest;
+    word_t* w;
+    word_t v;
+
+    if (n >= MEM_SMALL) {
+        while ((uintptr_t)p & WORD_MASK) {
+            *p++ = (unsigned char)c;
+            n--;
+        }
+        v = (unsigned char)c;
+        v |= v << 8;
+        v |= v << 16;
+        if (WORD_SIZE > 4)
+            v |= v << 16 << 16;
+        w = (word_t*)p;
+        for (; n >= 4 * WORD_SIZE; n -= 4 * WORD_SIZE, w += 4) {
+            w[0] = v;
+            w[1] = v;
+            w[2] = v;
+            w[3] = v;
+        }
+        for (; n >= WORD_SIZE; n -= WORD_SIZE)
+            *w++ = v;
+        p = (unsigned char*)w;
+    }
     while (n--) {
         *p++ = (unsigned char)c;
     }
     return dest;
 }
 
+// Copies strictly forwards and reads ahead of what it writes, so memmove
+// can also use it when the destination overlaps below the source.
 void* memcpy(void* dest, const void* src, size_t n) {
     unsigned char* d = dest;
     const unsigned char* s = src;
+    const word_t* ws;
+    word_t* wd;
+    word_t w0, w1, w2, w3;
+    unsigned off;
+
+    if (n >= MEM_SMALL) {
+        while ((uintptr_t)d & WORD_MASK) {
+            *d++ = *s++;
+            n--;
+        }
+        wd = (word_t*)d;
+        off = (uintptr_t)s & WORD_MASK;
+        if (!off) {
+            ws = (const word_t*)s;
+            for (; n >= 4 * WORD_SIZE; n -= 4 * WORD_SIZE, ws += 4, wd += 4) {
+                w0 = ws[0];
+                w1 = ws[1];
+                w2 = ws[2];
+                w3 = ws[3];
+                wd[0] = w0;
+                wd[1] = w1;
+                wd[2] = w2;
+                wd[3] = w3;
+            }
+            for (; n >= WORD_SIZE; n -= WORD_SIZE)
+                *wd++ = *ws++;
+            s = (const unsigned char*)ws;
+        } else {
+            ws = (const word_t*)(s - off);
+            w0 = *ws++;
+            for (; n >= WORD_SIZE; n -= WORD_SIZE) {
+                w1 = *ws++;
+                *wd++ = WORD_MERGE(w0, w1, 8 * off);
+                w0 = w1;
+            }
+            s = (const unsigned char*)ws - WORD_SIZE + off;
+        }
+        d = (unsigned char*)wd;
+    }
     while (n--) {
         *d++ = *s++;
     }
     return dest;
 }
+#endif /* !USE_ARM_ASM */
 
 void* memmove(void* dest, const void* src, size_t n) {
     unsigned char* d = (unsigned char*)dest;
     const unsigned char* s = (const unsigned char*)src;
-    if (d > s && d < s + n) {
-        d += n;
-        s += n;
-        while (n--) {
+    const word_t* ws;
+    word_t* wd;
+
+    // No overlap, or destination below source: a forward copy is safe.
+    if ((uintptr_t)d - (uintptr_t)s >= n)
+        return memcpy(dest, src, n);
+
+    d += n;
+    s += n;
+    if (n >= MEM_SMALL && !(((uintptr_t)d ^ (uintptr_t)s) & WORD_MASK)) {
+        while ((uintptr_t)d & WORD_MASK) {
             *--d = *--s;
+            n--;
         }
-    } else {
-        while (n--) {
-            *d++ = *s++;
-        }
+        wd = (word_t*)d;
+        ws = (const word_t*)s;
+        for (; n >= WORD_SIZE; n -= WORD_SIZE)
+            *--wd = *--ws;
+        d = (unsigned char*)wd;
+        s = (const unsigned char*)ws;
+    }
+    while (n--) {
+        *--d = *--s;
     }
     return dest;
 }
@@ -299,12 +591,6 @@ void *xtrycalloc(size_t nmemb, size_t size) {
     return ptr;
 }
 
-int open(const char *pathname, int flags, ...) {
-    if (strcmp(pathname, "stdout") == 0) return 1;
-    if (strcmp(pathname, "stdin") == 0) return 0;
-    return -1;
-}
-
 char *strchr(const char *s, int c) {
     while (*s != (char)c) {
         if (!*s++)
@@ -313,6 +599,16 @@ char *strchr(const char *s, int c) {
     return (char *)s;
 }
 
+int memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = s1, *b = s2;
+
+    for (; n; n--, a++, b++) {
+        if (*a != *b)
+            return *a - *b;
+    }
+    return 0;
+}
+
 int strcmp(const char *s1, const char *s2) {
     while (*s1 && (*s1 == *s2)) {
         s1++;
@@ -13,6 +13,21 @@ void* xmalloc_clear(size_t n);
 void* xcalloc(size_t n, size_t m);
 void xfree(void* p);
 void* xrealloc(void* p, size_t n);
+
+// Heap statistics (sizes are payload bytes)
+typedef struct heap_stats {
+    size_t heap_size;        // Bytes managed by the allocator
+    size_t in_use;           // Bytes in allocated blocks
+    size_t peak_in_use;      // High-water mark of in_use
+    size_t free_bytes;       // Bytes in free blocks
+    size_t largest_free;     // Largest single allocation that can succeed
+    size_t allocations;      // Live allocations
+    unsigned fragmentation;  // 100 * (1 - largest_free / free_bytes)
+} heap_stats_t;
+
+void heap_get_stats(heap_stats_t* st);
+void print_heap_debug(void);
+
 void* memset(void* dest, int c, size_t n);
 void* memcpy(void* dest, const void* src, size_t n);
 void* memmove(void* dest, const void* src, size_t n);
@@ -20,11 +35,15 @@ void* memmove(void* dest, const void* src, size_t n);
 void *xtrycalloc(size_t nmemb, size_t size);
 /* Secure memory wiping */
 void wipememory(void *ptr, size_t len);
-int open(const char *pathname, int flags, ...);
 char *strchr(const char *s, int c);
 /* String comparison */
+int memcmp(const void *s1, const void *s2, size_t n);
 int strcmp(const char *s1, const char *s2);
 
 /* String duplication for xstrdup */
 char *strdup(const char *s);
+char *xstrdup(const char *string);
+
+/* Provided by main.1.c on the target */
+size_t strlen(const char *str);
 #endif // MEMORY_H
\ No newline at end of file
@@ -70,6 +70,8 @@
 // #include "common/i18n.h"
 // #include "common/zb32.h"
 #include "common/openpgpdefs.h"
+#include "gcrypt.h"
+#include "printf.h"
 // /* FIXME: Libgcrypt 1.9 will support EAX.  Until we name this a
 //  * requirement we hardwire the enum used for EAX.  */
 // #define MY_GCRY_CIPHER_MODE_EAX 14
@@ -656,49 +658,49 @@
 // }
 
 
-// // /* Map the OpenPGP AEAD algorithm with ID ALGO to a string
-// //  * representation of the algorithm name.  For unknown algorithm IDs
-// //  * this function returns "?".  */
-// // const char *
-// // openpgp_aead_algo_name (aead_algo_t algo)
-// // {
-// //   switch (algo)
-// //     {
-// //     case AEAD_ALGO_NONE:  break;
-// //     case AEAD_ALGO_EAX:   return "EAX";
-// //     case AEAD_ALGO_OCB:   return "OCB";
-// //     }
-
-// //   return "?";
-// // }
-
+/* Map the OpenPGP AEAD algorithm with ID ALGO to a string
+ * representation of the algorithm name.  For unknown algorithm IDs
+ * this function returns "?".  */
+const char *
+openpgp_aead_algo_name (aead_algo_t algo)
+{
+  switch (algo)
+    {
+    case AEAD_ALGO_NONE:  break;
+    case AEAD_ALGO_EAX:   return "EAX";
+    case AEAD_ALGO_OCB:   return "OCB";
+    }
 
-// // /* Return information for the AEAD algorithm ALGO.  The corresponding
-// //  * Libgcrypt ciphermode is stored at R_MODE and the required number of
-// //  * octets for the nonce at R_NONCELEN.  On error and error code is
-// //  * returned.  Note that the taglen is always 128 bits.  */
-// // gpg_error_t
-// // openpgp_aead_algo_info (aead_algo_t algo, enum gcry_cipher_modes *r_mode,
-// //                         unsigned int *r_noncelen)
-// // {
-// //   switch (algo)
-// //     {
-// //     case AEAD_ALGO_OCB:
-// //       *r_mode = GCRY_CIPHER_MODE_OCB;
-// //       *r_noncelen = 15;
-// //       break;
+  return "?";
+}
 
-// //     case AEAD_ALGO_EAX:  /* Only for decryption of some old data.  */
-// //       *r_mode = MY_GCRY_CIPHER_MODE_EAX;
-// //       *r_noncelen = 16;
-// //       break;
 
-// //     default:
-// //       log_error ("unsupported AEAD algo %d\n", algo);
-// //       return gpg_error (GPG_ERR_INV_CIPHER_MODE);
-// //     }
-// //   return 0;
-// // }
+/* Return information for the AEAD algorithm ALGO.  The corresponding
+ * Libgcrypt ciphermode is stored at R_MODE and the required number of
+ * octets for the nonce at R_NONCELEN.  On error and error code is
+ * returned.  Note that the taglen is always 128 bits.  */
+gpg_error_t
+openpgp_aead_algo_info (aead_algo_t algo, enum gcry_cipher_modes *r_mode,
+                        unsigned int *r_noncelen)
+{
+  switch (algo)
+    {
+    case AEAD_ALGO_OCB:
+      *r_mode = GCRY_CIPHER_MODE_OCB;
+      *r_noncelen = 15;
+      break;
+
+    case AEAD_ALGO_EAX:  /* Only for decryption of some old data.  */
+      *r_mode = GCRY_CIPHER_MODE_EAX;
+      *r_noncelen = 16;
+      break;
+
+    default:
+      printf ("unsupported AEAD algo %d\n", algo);
+      return gpg_error (GPG_ERR_INV_CIPHER_MODE);
+    }
+  return 0;
+}
 
 
 // // /* Return 0 if ALGO is a supported OpenPGP public key algorithm.  */
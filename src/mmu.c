@@ -0,0 +1,119 @@
+#include <stdint.h>
+#include "mmu.h"
+
+#ifdef USE_MMU
+
+#define SECTION_SHIFT 20
+
+// Short-descriptor section entries
+#define SECT          0x00002      // Section, domain 0
+#define SECT_B        0x00004
+#define SECT_C        0x00008
+#define SECT_XN       0x00010
+#define SECT_AP_RW    0x00c00      // Read/write at any privilege
+#define SECT_TEX1     0x01000
+#define SECT_S        0x10000
+#define SECT_NORMAL   (SECT | SECT_AP_RW | SECT_TEX1 | SECT_C | SECT_B | SECT_S)
+#define SECT_DEVICE   (SECT | SECT_AP_RW | SECT_B | SECT_XN)
+
+// Table walks: inner and outer write-back write-allocate, shareable
+#define TTBR_WALK     0x6a
+
+#define SCTLR_M       (1u << 0)
+#define SCTLR_A       (1u << 1)
+#define SCTLR_C       (1u << 2)
+#define SCTLR_Z       (1u << 11)
+#define SCTLR_I       (1u << 12)
+#define ACTLR_SMP     (1u << 6)
+
+static uint32_t ttb[4096] __attribute__((aligned(16384)));
+static volatile int ttb_ready;
+
+// Clean and invalidate the data/unified cache at LEVEL (0 is L1) by
+// set/way: if a loader left it on, its dirty lines reach RAM first.
+static void dcache_flush_level(unsigned int level) {
+    uint32_t ccsidr, linelog, ways, sets, waylog, way, set;
+
+    __asm__ volatile("mcr p15, 2, %0, c0, c0, 0\n\tisb" : : "r"(level << 1));
+    __asm__ volatile("mrc p15, 1, %0, c0, c0, 0" : "=r"(ccsidr));
+    linelog = (ccsidr & 7) + 4;
+    ways = ((ccsidr >> 3) & 0x3ff) + 1;
+    sets = ((ccsidr >> 13) & 0x7fff) + 1;
+    waylog = ways > 1 ? __builtin_clz(ways - 1) : 0;
+    for (way = 0; way < ways; way++)
+        for (set = 0; set < sets; set++)
+            __asm__ volatile("mcr p15, 0, %0, c7, c14, 2" // DCCISW
+                             : : "r"((way << waylog) | (set << linelog) | (level << 1)));
+}
+
+// The same for the data caches up to LEVELS deep, stopping at the
+// Level of Coherency.
+static void dcache_flush(unsigned int levels) {
+    uint32_t clidr;
+    unsigned int level, loc;
+
+    __asm__ volatile("mrc p15, 1, %0, c0, c0, 1" : "=r"(clidr));
+    loc = (clidr >> 24) & 7;
+    for (level = 0; level < loc && level < levels; level++)
+        if (((clidr >> (3 * level)) & 7) >= 2)    // Data or unified
+            dcache_flush_level(level);
+    __asm__ volatile("dsb" ::: "memory");
+}
+
+void mmu_init(unsigned int cpu) {
+    uint32_t r;
+    unsigned int i;
+
+    // Core 0 fills the table with its caches still off, so it is in RAM
+    // for the other cores and for the table walks of all of them.  The
+    // L2 is shared: core 0 also flushes it, and only then lets the
+    // others go on.
+    if (cpu == 0) {
+        for (i = 0; i < 4096; i++)
+            ttb[i] = ((uint32_t)i << SECTION_SHIFT)
+                     | ((uint32_t)i < (MMU_RAM_END >> SECTION_SHIFT) ? SECT_NORMAL : SECT_DEVICE);
+        dcache_flush(7);
+        ttb_ready = 1;
+        __asm__ volatile("dsb\n\tsev" ::: "memory");
+    } else {
+        while (!ttb_ready)
+            __asm__ volatile("wfe");
+        dcache_flush(1);
+    }
+
+    __asm__ volatile("mcr p15, 0, %0, c7, c5, 0\n\t"    // ICIALLU
+                     "mcr p15, 0, %0, c7, c5, 6\n\t"    // BPIALL
+                     "mcr p15, 0, %0, c8, c7, 0\n\t"    // TLBIALL
+                     "dsb\n\tisb" : : "r"(0) : "memory");
+
+    // Take part in coherency before any cacheable access.
+    __asm__ volatile("mrc p15, 0, %0, c1, c0, 1" : "=r"(r));
+    __asm__ volatile("mcr p15, 0, %0, c1, c0, 1\n\tisb" : : "r"(r | ACTLR_SMP));
+
+    __asm__ volatile("mcr p15, 0, %0, c2, c0, 2" : : "r"(0));            // TTBCR: TTBR0 only
+    __asm__ volatile("mcr p15, 0, %0, c2, c0, 0" : : "r"((uint32_t)(uintptr_t)ttb | TTBR_WALK));
+    __asm__ volatile("mcr p15, 0, %0, c3, c0, 0" : : "r"(0x55555555));   // DACR: all clients
+    __asm__ volatile("dsb\n\tisb" ::: "memory");
+
+    __asm__ volatile("mrc p15, 0, %0, c1, c0, 0" : "=r"(r));
+    r &= ~SCTLR_A;
+    r |= SCTLR_M | SCTLR_C | SCTLR_Z | SCTLR_I;
+    __asm__ volatile("mcr p15, 0, %0, c1, c0, 0\n\tisb" : : "r"(r) : "memory");
+}
+
+#else /* !USE_MMU */
+
+void mmu_init(unsigned int cpu) {
+    (void)cpu;
+}
+
+#endif /* !USE_MMU */
+
+uint32_t mmu_sctlr(void) {
+    uint32_t r = 0;
+
+#ifdef __arm__
+    __asm__ volatile("mrc p15, 0, %0, c1, c0, 0" : "=r"(r));
+#endif
+    return r;
+}
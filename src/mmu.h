@@ -0,0 +1,33 @@
+/* mmu.h - identity map, caches and branch prediction (make USE_MMU=1)
+ *
+ * mmu_init runs on every core from start.s, before main or
+ * smp_secondary_main.  Core 0 builds a 1 MiB section translation table
+ * mapping all 4 GiB to themselves: RAM as normal write-back
+ * write-allocate shareable memory, everything else (the versatilepb
+ * UART at 0x101f1000, the BCM2836 peripherals and local interrupt
+ * block) as device memory, never executable.  Each core then cleans
+ * and invalidates its data caches, invalidates its I-cache, TLB and
+ * branch predictor, joins coherency
+ * and turns on the MMU, D-cache, I-cache and branch prediction, with
+ * alignment checking off: normal memory takes unaligned word accesses.
+ *
+ * Without USE_MMU, mmu_init does nothing and the kernel runs in
+ * whatever state the loader left.
+ */
+#ifndef MMU_H
+#define MMU_H
+
+#include <stdint.h>
+
+#ifdef BOARD_RASPI2B
+#define MMU_RAM_END 0x3f000000     // Peripherals from here
+#else
+#define MMU_RAM_END 0x08000000     // QEMU's default 128 MiB
+#endif
+
+void mmu_init(unsigned int cpu);
+
+// SCTLR as it is now, for the boot log.
+uint32_t mmu_sctlr(void);
+
+#endif /* MMU_H */
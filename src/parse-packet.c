@@ -38,6 +38,7 @@
 #include "common/mbox-util.h"
 #include "printf.h"
 #include "memory.h"
+#include "prof.h"
 static int mpi_print_mode;
 static int list_mode;
 static estream_t listfp;
@@ -57,12 +58,9 @@ static int copy_packet(IOBUF inp, IOBUF out, int pkttype,
                        unsigned long pktlen, int partial);
 static void skip_packet(IOBUF inp, int pkttype,
                         unsigned long pktlen, int partial);
-static void *read_rest(IOBUF inp, size_t pktlen);
 static int parse_marker(IOBUF inp, int pkttype, unsigned long pktlen);
 static int parse_symkeyenc(IOBUF inp, int pkttype, unsigned long pktlen,
                            PACKET *packet);
-static int parse_pubkeyenc(IOBUF inp, int pkttype, unsigned long pktlen,
-                           PACKET *packet);
 static int parse_onepass_sig(IOBUF inp, int pkttype, unsigned long pktlen,
                              PKT_onepass_sig *ops);
 static int parse_key(IOBUF inp, int pkttype, unsigned long pktlen,
@@ -86,8 +84,6 @@ static gpg_error_t parse_encrypted_aead(IOBUF inp, int pkttype,
                                         int partial);
 static int parse_mdc(IOBUF inp, int pkttype, unsigned long pktlen,
                      PACKET *packet, int new_ctb);
-static int parse_gpg_control(IOBUF inp, int pkttype, unsigned long pktlen,
-                             PACKET *packet, int partial);
 
 /* Read a 16-bit value in MSB order (big endian) from an iobuf.  */
 static unsigned short
@@ -382,10 +378,12 @@ int dbg_parse_packet(parse_packet_ctx_t ctx, PACKET *pkt,
   // printf("dbg_parse_packet\n");
   int skip, rc;
 
+  PROF_BEGIN(PROF_PARSE);
   do
   {
     rc = parse(ctx, pkt, 0, NULL, &skip, NULL, 0, "parse", dbg_f, dbg_l);
   } while (skip && !rc);
+  PROF_END(PROF_PARSE, 0);
   return rc;
 }
 #else  /*!DEBUG_PARSE_PACKET*/
@@ -393,10 +391,12 @@ int parse_packet(parse_packet_ctx_t ctx, PACKET *pkt)
 {
   int skip, rc;
 
+  PROF_BEGIN(PROF_PARSE);
   do
   {
     rc = parse(ctx, pkt, 0, NULL, &skip, NULL, 0);
   } while (skip && !rc);
+  PROF_END(PROF_PARSE, 0);
   return rc;
 }
 #endif /*!DEBUG_PARSE_PACKET*/
@@ -958,9 +958,9 @@ printf("\nProcessing packet type: %s (%d)\n\n",
     case PKT_PLAINTEXT:
       rc = parse_plaintext (inp, pkttype, pktlen, pkt, new_ctb, partial);
       break;
-    // case PKT_COMPRESSED:
-    //   rc = parse_compressed (inp, pkttype, pktlen, pkt, new_ctb);
-    //  break;
+    case PKT_COMPRESSED:
+      rc = parse_compressed (inp, pkttype, pktlen, pkt, new_ctb);
+      break;
     case PKT_ENCRYPTED:
     case PKT_ENCRYPTED_MDC:
       rc = parse_encrypted (inp, pkttype, pktlen, pkt, new_ctb, partial);
@@ -968,9 +968,9 @@ printf("\nProcessing packet type: %s (%d)\n\n",
     case PKT_MDC:
       rc = parse_mdc (inp, pkttype, pktlen, pkt, new_ctb);
       break;
-    // case PKT_ENCRYPTED_AEAD:
-    //   rc = parse_encrypted_aead (inp, pkttype, pktlen, pkt, partial);
-    //   break;
+    case PKT_ENCRYPTED_AEAD:
+      rc = parse_encrypted_aead (inp, pkttype, pktlen, pkt, partial);
+      break;
     // case PKT_GPG_CONTROL:
     //   rc = parse_gpg_control (inp, pkttype, pktlen, pkt, partial);
     //   break;
@@ -1121,38 +1121,6 @@ copy_packet(IOBUF inp, IOBUF out, int pkttype,
 //   iobuf_skip_rest (inp, pktlen, partial);
 // }
 
-/* Read PKTLEN bytes from INP and return them in a newly allocated
- * buffer.  In case of an error (including reading fewer than PKTLEN
- * bytes from INP before EOF is returned), NULL is returned and an
- * error message is logged.  */
-static void *
-read_rest(IOBUF inp, size_t pktlen)
-{
-  int c;
-  byte *buf, *p;
-
-  buf = xtrymalloc(pktlen);
-  if (!buf)
-  {
-    gpg_error_t err = gpg_error_from_syserror();
-    printf("error reading rest of packet: %s\n", gpg_strerror(err));
-    return NULL;
-  }
-  for (p = buf; pktlen; pktlen--)
-  {
-    c = iobuf_get(inp);
-    if (c == -1)
-    {
-      printf("premature eof while reading rest of packet\n");
-      xfree(buf);
-      return NULL;
-    }
-    *p++ = c;
-  }
-
-  return buf;
-}
-
 // /* Read a special size+body from INP.  On success store an opaque MPI
 //    with it at R_DATA.  On error return an error code and store NULL at
 //    R_DATA.  Even in the error case store the number of read bytes at
@@ -1271,7 +1239,7 @@ parse_symkeyenc(IOBUF inp, int pkttype, unsigned long pktlen,
   {
     printf("packet(%d) with unknown version %d\n", pkttype, version);
     if (list_mode)
-      printf(listfp, ":symkey enc packet: [unknown version]\n");
+      printf(":symkey enc packet: [unknown version]\n");
     rc = gpg_error(GPG_ERR_INV_PACKET);
     goto leave;
   }
@@ -1279,7 +1247,7 @@ parse_symkeyenc(IOBUF inp, int pkttype, unsigned long pktlen,
   { /* (we encode the seskeylen in a byte) */
     printf("packet(%d) too large\n", pkttype);
     if (list_mode)
-      printf(listfp, ":symkey enc packet: [too large]\n");
+      printf(":symkey enc packet: [too large]\n");
     rc = gpg_error(GPG_ERR_INV_PACKET);
     goto leave;
   }
@@ -1312,14 +1280,14 @@ parse_symkeyenc(IOBUF inp, int pkttype, unsigned long pktlen,
   default:
     printf("unknown S2K mode %d\n", s2kmode);
     if (list_mode)
-      printf(listfp, ":symkey enc packet: [unknown S2K mode]\n");
+      printf(":symkey enc packet: [unknown S2K mode]\n");
     goto leave;
   }
   if (minlen > pktlen)
   {
     printf("packet with S2K %d too short\n", s2kmode);
     if (list_mode)
-      printf(listfp, ":symkey enc packet: [too short]\n");
+      printf(":symkey enc packet: [too short]\n");
     rc = gpg_error(GPG_ERR_INV_PACKET);
     goto leave;
   }
@@ -1395,93 +1363,11 @@ leave:
 too_short:
   printf("packet(%d) too short\n", pkttype);
   if (list_mode)
-    printf(listfp, ":symkey enc packet: [too short]\n");
+    printf(":symkey enc packet: [too short]\n");
   rc = gpg_error(GPG_ERR_INV_PACKET);
   goto leave;
 }
 
-static int
-parse_pubkeyenc(IOBUF inp, int pkttype, unsigned long pktlen,
-                PACKET *packet)
-{
-  int rc = 0;
-  int i, ndata;
-  PKT_pubkey_enc *k;
-
-  k = packet->pkt.pubkey_enc = xmalloc_clear(sizeof *packet->pkt.pubkey_enc);
-  if (pktlen < 12)
-  {
-    printf("packet(%d) too short\n", pkttype);
-    if (list_mode)
-      es_fputs(":pubkey enc packet: [too short]\n", listfp);
-    rc = gpg_error(GPG_ERR_INV_PACKET);
-    goto leave;
-  }
-  k->version = iobuf_get_noeof(inp);
-  pktlen--;
-  if (k->version != 2 && k->version != 3)
-  {
-    printf("packet(%d) with unknown version %d\n", pkttype, k->version);
-    if (list_mode)
-      es_fputs(":pubkey enc packet: [unknown version]\n", listfp);
-    rc = gpg_error(GPG_ERR_INV_PACKET);
-    goto leave;
-  }
-  k->keyid[0] = read_32(inp);
-  pktlen -= 4;
-  k->keyid[1] = read_32(inp);
-  pktlen -= 4;
-  k->pubkey_algo = iobuf_get_noeof(inp);
-  pktlen--;
-  k->throw_keyid = 0; /* Only used as flag for build_packet.  */
-  if (list_mode)
-    printf(listfp,
-           ":pubkey enc packet: version %d, algo %d, keyid %08lX%08lX\n",
-           k->version, k->pubkey_algo, (ulong)k->keyid[0],
-           (ulong)k->keyid[1]);
-
-  ndata = pubkey_get_nenc(k->pubkey_algo);
-  if (!ndata)
-  {
-    if (list_mode)
-      printf(listfp, "\tunsupported algorithm %d\n", k->pubkey_algo);
-//    unknown_pubkey_warning(k->pubkey_algo);
-    k->data[0] = NULL; /* No need to store the encrypted data.  */
-  }
-  else
-  {
-    for (i = 0; i < ndata; i++)
-    {
-      if (k->pubkey_algo == PUBKEY_ALGO_ECDH && i == 1)
-      {
-        size_t n;
-        rc = read_size_body(inp, pktlen, &n, k->data + i);
-        pktlen -= n;
-      }
-      else
-      {
-        int n = pktlen;
-        k->data[i] = mpi_read(inp, &n, 0);
-        pktlen -= n;
-        if (!k->data[i])
-          rc = gpg_error(GPG_ERR_INV_PACKET);
-      }
-      if (rc)
-        goto leave;
-      if (list_mode)
-      {
-        printf(listfp, "\tdata: ");
-        mpi_print(listfp, k->data[i], mpi_print_mode);
-        es_putc('\n', listfp);
-      }
-    }
-  }
-
-leave:
-  iobuf_skip_rest(inp, pktlen, 0);
-  return rc;
-}
-
 // /* Dump a subpacket to LISTFP.  BUFFER contains the subpacket in
 //    question and points to the type field in the subpacket header (not
 //    the start of the header).  TYPE is the subpacket's type with the
@@ -3364,7 +3250,7 @@ parse_plaintext(IOBUF inp, int pkttype, unsigned long pktlen,
 
   if (list_mode)
   {
-    printf(listfp, ":literal data packet:\n"
+    printf(":literal data packet:\n"
                    "\tmode %c (%X), created %lu, name=\"",
            mode >= ' ' && mode < 'z' ? mode : '?', mode,
            (ulong)pt->timestamp);
@@ -3373,13 +3259,13 @@ parse_plaintext(IOBUF inp, int pkttype, unsigned long pktlen,
       if (*p >= ' ' && *p <= 'z')
       printf("COMMMENTED OUT\n");//        es_putc(*p, listfp);
       else
-        printf(listfp, "\\x%02x", *p);
+        printf("\\x%02x", *p);
     }
-    printf(listfp, "\",\n\traw data: ");
+    printf("\",\n\traw data: ");
     if (partial)
-      printf(listfp, "unknown length\n");
+      printf("unknown length\n");
     else
-      printf(listfp, "%lu bytes\n", (ulong)pt->len);
+      printf("%lu bytes\n", (ulong)pt->len);
   }
 
 leave:
@@ -3404,7 +3290,7 @@ parse_compressed(IOBUF inp, int pkttype, unsigned long pktlen,
   zd->new_ctb = new_ctb;
   zd->buf = inp;
   if (list_mode)
-    printf(listfp, ":compressed packet: algo=%d\n", zd->algorithm);
+    printf(":compressed packet: algo=%d\n", zd->algorithm);
   return 0;
 }
 
@@ -3495,12 +3381,12 @@ parse_encrypted(IOBUF inp, int pkttype, unsigned long pktlen,
   if (list_mode)
   {
     if (orig_pktlen)
-      printf(listfp, ":encrypted data packet:\n\tlength: %lu\n",
+      printf(":encrypted data packet:\n\tlength: %lu\n",
              orig_pktlen);
     else
-      printf(listfp, ":encrypted data packet:\n\tlength: unknown\n");
+      printf(":encrypted data packet:\n\tlength: unknown\n");
     if (ed->mdc_method)
-      printf(listfp, "\tmdc_method: %d\n", ed->mdc_method);
+      printf("\tmdc_method: %d\n", ed->mdc_method);
   }
 
 // After allocating ed
@@ -3532,7 +3418,7 @@ parse_mdc(IOBUF inp, int pkttype, unsigned long pktlen,
 
   mdc = pkt->pkt.mdc = xmalloc(sizeof *pkt->pkt.mdc);
   if (list_mode)
-    printf(listfp, ":mdc packet: length=%lu\n", pktlen);
+    printf(":mdc packet: length=%lu\n", pktlen);
   if (!new_ctb || pktlen != 20)
   {
     printf("mdc_packet with invalid encoding\n");
@@ -3556,9 +3442,7 @@ parse_encrypted_aead(iobuf_t inp, int pkttype, unsigned long pktlen,
   unsigned long orig_pktlen = pktlen;
   int version;
 
-  ed = pkt->pkt.encrypted = xtrymalloc(sizeof *pkt->pkt.encrypted);
-  if (!ed)
-    return gpg_error_from_syserror();
+  ed = pkt->pkt.encrypted = xmalloc(sizeof *pkt->pkt.encrypted);
   ed->len = 0;
   ed->extralen = 0; /* (only used in build_packet.)  */
   ed->buf = NULL;
@@ -3607,12 +3491,12 @@ parse_encrypted_aead(iobuf_t inp, int pkttype, unsigned long pktlen,
 
   if (list_mode)
   {
-    printf(listfp, ":aead encrypted packet: cipher=%u aead=%u cb=%u\n",
+    printf(":aead encrypted packet: cipher=%u aead=%u cb=%u\n",
            ed->cipher_algo, ed->aead_algo, ed->chunkbyte);
     if (orig_pktlen)
-      printf(listfp, "\tlength: %lu\n", orig_pktlen);
+      printf("\tlength: %lu\n", orig_pktlen);
     else
-      printf(listfp, "\tlength: unknown\n");
+      printf("\tlength: unknown\n");
   }
 
   ed->buf = inp;
@@ -3621,82 +3505,6 @@ leave:
   return rc;
 }
 
-/*
- * This packet is internally generated by us (in armor.c) to transfer
- * some information to the lower layer.  To make sure that this packet
- * is really a GPG faked one and not one coming from outside, we
- * first check that there is a unique tag in it.
- *
- * The format of such a control packet is:
- *   n byte  session marker
- *   1 byte  control type CTRLPKT_xxxxx
- *   m byte  control data
- */
-static int
-parse_gpg_control(IOBUF inp, int pkttype, unsigned long pktlen,
-                  PACKET *packet, int partial)
-{
-  byte *p;
-  const byte *sesmark;
-  size_t sesmarklen;
-  int i;
-
-  (void)pkttype;
-
-  if (list_mode)
-    printf(listfp, ":packet 63: length %lu ", pktlen);
-
-  sesmark = get_session_marker(&sesmarklen);
-  if (pktlen < sesmarklen + 1) /* 1 is for the control bytes */
-    goto skipit;
-  for (i = 0; i < sesmarklen; i++, pktlen--)
-  {
-    if (sesmark[i] != iobuf_get_noeof(inp))
-      goto skipit;
-  }
-  if (pktlen > 4096)
-    goto skipit; /* Definitely too large.  We skip it to avoid an
-                    overflow in the malloc.  */
-  if (list_mode)
-    es_fputs("- gpg control packet", listfp);
-
-  packet->pkt.gpg_control = xmalloc(sizeof *packet->pkt.gpg_control + pktlen - 1);
-  packet->pkt.gpg_control->control = iobuf_get_noeof(inp);
-  pktlen--;
-  packet->pkt.gpg_control->datalen = pktlen;
-  p = packet->pkt.gpg_control->data;
-  for (; pktlen; pktlen--, p++)
-    *p = iobuf_get_noeof(inp);
-
-  return 0;
-
-skipit:
-  if (list_mode)
-  {
-    int c;
-
-    i = 0;
-    printf(listfp, "- private (rest length %lu)\n", pktlen);
-    if (partial)
-    {
-      while ((c = iobuf_get(inp)) != -1)
-        dump_hex_line(c, &i);
-    }
-    else
-    {
-      for (; pktlen; pktlen--)
-      {
-        dump_hex_line((c = iobuf_get(inp)), &i);
-        if (c == -1)
-          break;
-      }
-    }
-    es_putc('\n', listfp);
-  }
-  iobuf_skip_rest(inp, pktlen, 0);
-  return gpg_error(GPG_ERR_INV_PACKET);
-}
-
 /* Create a GPG control packet to be used internally as a placeholder.  */
 PACKET *
 create_gpg_control(ctrlpkttype_t type, const byte *data, size_t datalen)
@@ -0,0 +1,117 @@
+#include <string.h>
+#include "payload.h"
+#include "memory.h"
+
+int decrypt_memory(ctrl_t ctrl, const unsigned char* data, size_t length);
+
+struct payload_header* payload_find(void* base, size_t size) {
+    struct payload_header* p = base;
+    uintptr_t lo = (uintptr_t)base, hi = lo + size, msg;
+
+    if (size < sizeof *p || memcmp(p->magic, PAYLOAD_MAGIC, sizeof p->magic))
+        return NULL;
+    if (p->header_size != sizeof *p || p->key_len > PAYLOAD_KEY_MAX)
+        return NULL;
+    msg = (uintptr_t)payload_data(p);
+    if (msg < lo + sizeof *p || msg > hi || p->length == 0 || p->length > hi - msg)
+        return NULL;
+    return p;
+}
+
+const unsigned char* payload_data(const struct payload_header* p) {
+    if (p->addr)
+        return (const unsigned char*)(uintptr_t)p->addr;
+    return (const unsigned char*)p + p->header_size;
+}
+
+int payload_setup(const struct payload_header* p, struct server_control_s* ctrl,
+                  unsigned char* key, struct sink_digest_s* digest) {
+    memset(ctrl, 0, sizeof *ctrl);
+    memset(key, 0, PAYLOAD_KEY_MAX + 1);
+    sink_digest_init(digest);
+    ctrl->sink = &digest->sink;
+
+    if (p->key_kind != PAYLOAD_KEY_PASSPHRASE && p->key_kind != PAYLOAD_KEY_SESSION)
+        return GPG_ERR_NOT_SUPPORTED;
+    // do_proc_packets copies the key material with strlen(), so it has
+    // to be NUL-terminated and a key with a 0 byte in it cannot go through.
+    if (p->key_len == 0 || p->key_len > PAYLOAD_KEY_MAX || memchr(p->key, 0, p->key_len))
+        return GPG_ERR_INV_KEYLEN;
+    if (p->key_kind == PAYLOAD_KEY_SESSION && p->key_len > 32)
+        return GPG_ERR_INV_KEYLEN;
+
+    memcpy(key, p->key, p->key_len);
+    if (p->key_kind == PAYLOAD_KEY_SESSION)
+        ctrl->session_key = key;
+    else
+        ctrl->passphrase = (char*)key;
+    return 0;
+}
+
+/**
+ * Where the plaintext of P goes with PAYLOAD_OUTPUT: out_addr, or the
+ * first 16-byte boundary after the message, up to out_size bytes or
+ * the end of the window.  It has to lie in the window, from BASE to
+ * END, and may not overlap the header or the message.
+ * @return The size, 0 if there is no room
+ */
+static size_t output_area(const struct payload_header* p, uintptr_t base, uintptr_t end,
+                          byte** out) {
+    uintptr_t hdr = (uintptr_t)p, msg = (uintptr_t)payload_data(p);
+    uintptr_t lo = hdr < msg ? hdr : msg, hi = msg + p->length;
+    uintptr_t a = p->out_addr ? p->out_addr : (hi + 15) & ~(uintptr_t)15;
+    size_t size;
+
+    if (a < base || a >= end)
+        return 0;
+    size = p->out_size ? p->out_size : end - a;
+    if (size > end - a || (a < hi && a + size > lo))
+        return 0;
+    *out = (byte*)a;
+    return size;
+}
+
+int payload_decrypt(struct payload_header* p, void* end) {
+    struct server_control_s ctrl;
+    struct sink_digest_s digest;
+    struct sink_memory_s mem;
+    unsigned char key[PAYLOAD_KEY_MAX + 1];
+    byte* out = NULL;
+    size_t size = 0;
+    int rc;
+
+    p->result_rc = PAYLOAD_UNKNOWN;
+    p->result_len = p->result_crc = p->result_out = 0;
+    rc = payload_setup(p, &ctrl, key, &digest);
+    if (!rc && (p->flags & PAYLOAD_OUTPUT)) {
+        // payload_find has the header at the start of the window.
+        size = output_area(p, (uintptr_t)p, (uintptr_t)end, &out);
+        if (size) {
+            sink_memory_init(&mem, out, size);
+            ctrl.sink = &mem.sink;
+        } else {
+            rc = GPG_ERR_TOO_LARGE;
+        }
+    }
+    if (!rc)
+        rc = gpg_err_code(decrypt_memory(&ctrl, payload_data(p), p->length));
+
+    // The memory sink keeps no digest; take it over what it holds.
+    if (ctrl.sink == &mem.sink) {
+        digest.sink.write(&digest.sink, out, mem.len);
+        digest.sink.total = mem.len;
+        p->result_out = (uint32_t)(uintptr_t)out;
+    }
+    p->result_rc = rc;
+    p->result_len = digest.sink.total;
+    p->result_crc = digest.crc;
+    wipememory(key, sizeof key);
+    wipememory(p->key, sizeof p->key);
+    return rc;
+}
+
+int payload_ok(const struct payload_header* p) {
+    return p->result_rc == 0
+        && (p->text_len == PAYLOAD_UNKNOWN || p->result_len == p->text_len)
+        && (p->text_crc == PAYLOAD_UNKNOWN || p->result_crc == p->text_crc);
+}
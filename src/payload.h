@@ -0,0 +1,106 @@
+/* payload.h - messages loaded next to the kernel at boot
+ *
+ * Instead of a message compiled in as a C array, QEMU's generic loader
+ * can put one in RAM before the kernel starts:
+ *
+ *   -device loader,file=msg.payload,addr=0x04000000,force-raw=on
+ *
+ * (make run PAYLOAD=msg.payload).  The file is a payload_header,
+ * written by scripts/mkpayload.py, followed by the OpenPGP message; the
+ * header says where the message is, how long it is, the passphrase or
+ * session key to decrypt it with and, if known, the length and CRC-32
+ * of the plaintext to expect.  payload_find looks for the header at the
+ * start of a window of RAM and payload_decrypt decrypts the message
+ * where it lies, so the input may be as large as the window and changes
+ * without a rebuild.
+ *
+ * payload_decrypt writes its results back into the header (rc, text
+ * length and CRC-32) for a debugger or a memory dump to read, and wipes
+ * the key material there.  With PAYLOAD_OUTPUT the plaintext itself is
+ * also left in RAM, at out_addr or else right after the message.
+ *
+ * All fields are little-endian, as the kernel reads them.
+ */
+#ifndef PAYLOAD_H
+#define PAYLOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "fwddecl.h"
+#include "gpg.h"
+#include "sink.h"
+#include "smp.h"
+
+// Where the Makefile has the loader put it (PAYLOAD_ADDR); the window
+// ends at the lowest core stack (start.s, smp.h).
+#ifndef PAYLOAD_ADDR
+#define PAYLOAD_ADDR 0x04000000
+#endif
+#define PAYLOAD_END (0x08000000 - SMP_MAX_CPUS * SMP_STACK_SIZE)
+
+#define PAYLOAD_MAGIC "GPGLOAD1"
+#define PAYLOAD_UNKNOWN 0xffffffffu     // text_len, text_crc not given
+
+// flags
+#define PAYLOAD_OUTPUT 1                // Keep the plaintext in RAM
+
+// key_kind
+#define PAYLOAD_KEY_PASSPHRASE 0
+#define PAYLOAD_KEY_SESSION 1           // Raw session key, as vector_key
+
+#define PAYLOAD_KEY_MAX 128
+
+struct payload_header {
+    char magic[8];              // PAYLOAD_MAGIC, no NUL
+    uint32_t header_size;       // sizeof (struct payload_header)
+    uint32_t addr;              // Message address; 0: right after the header
+    uint32_t length;            // Message bytes
+    uint32_t flags;
+    uint32_t key_kind;
+    uint32_t key_len;
+    uint8_t key[PAYLOAD_KEY_MAX];
+    uint32_t text_len;          // Expected plaintext, or PAYLOAD_UNKNOWN
+    uint32_t text_crc;
+    uint32_t out_addr;          // PAYLOAD_OUTPUT: 0 for after the message
+    uint32_t out_size;          // 0 for up to the end of the window
+
+    // Written by payload_decrypt
+    uint32_t result_rc;         // gpg_err_code, PAYLOAD_UNKNOWN before
+    uint32_t result_len;
+    uint32_t result_crc;
+    uint32_t result_out;        // Plaintext address with PAYLOAD_OUTPUT
+};
+
+/**
+ * Look for a payload at BASE, SIZE bytes of RAM
+ * @return The header, or NULL if there is none or it does not fit
+ */
+struct payload_header* payload_find(void* base, size_t size);
+
+/**
+ * The message of P
+ */
+const unsigned char* payload_data(const struct payload_header* p);
+
+/**
+ * Set up CTRL (cleared first) to decrypt P into DIGEST.  KEY must hold
+ * PAYLOAD_KEY_MAX + 1 bytes and stay alive while CTRL is used.
+ * @return 0, GPG_ERR_NOT_SUPPORTED for an unknown key_kind or
+ *         GPG_ERR_INV_KEYLEN for key material that cannot be passed on
+ */
+int payload_setup(const struct payload_header* p, struct server_control_s* ctrl,
+                  unsigned char* key, struct sink_digest_s* digest);
+
+/**
+ * Decrypt P, found at the start of a window ending at END, record the
+ * results in its header and wipe its key
+ * @return The gpg_err_code of the result
+ */
+int payload_decrypt(struct payload_header* p, void* end);
+
+/**
+ * Whether the results of P match what its header expects
+ */
+int payload_ok(const struct payload_header* p);
+
+#endif /* PAYLOAD_H */
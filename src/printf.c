@@ -15,6 +15,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 
 #include "printf.h"
+#include "trace.h"
 #include <stddef.h>
 typedef void (*putcf)(void *, char);
 static putcf stdout_putf;
@@ -291,11 +292,19 @@ void init_printf(void *putp, void (*putf)(void *, char))
 void tfp_printf(char *fmt, ...)
 {
     va_list va;
+    trace_drain();
     va_start(va, fmt);
     tfp_format(stdout_putp, stdout_putf, fmt, va);
     va_end(va);
 }
 
+void tfp_write(const char *buf, size_t len)
+{
+    trace_drain();
+    while (len--)
+        stdout_putf(stdout_putp, *buf++);
+}
+
 static void putcp(void *p, char c)
 {
     *(*((char **)p))++ = c;
@@ -70,11 +70,13 @@ regs Kusti, 23.10.2004
 #define __TFP_PRINTF__
 
 #include <stdarg.h>
+#include <stddef.h>
 
 void init_printf(void* putp, void (*putf) (void*,char));
 
 void tfp_printf(char *fmt, ...);
 void tfp_sprintf(char* s,char *fmt, ...);
+void tfp_write(const char* buf,size_t len);
 
 void tfp_format(void* putp,void (*putf) (void*,char),char *fmt, va_list va);
 
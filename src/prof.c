@@ -0,0 +1,265 @@
+#include "prof.h"
+#include "printf.h"
+
+#define PROF_EVENTS 4
+#define PROF_DEPTH 16   // Deeper scopes are not counted
+
+// Counts widened to 64 bits (see pmu_read)
+struct sample {
+    uint64_t cyc;
+    uint64_t ev[PROF_EVENTS];
+};
+
+struct frame {
+    int scope;
+    struct sample start;
+    struct sample child;    // Spent in scopes called from this one
+};
+
+struct scope_stat {
+    uint32_t calls;
+    uint64_t bytes;         // Bytes and cycles of outermost entries only,
+    uint64_t total;         // so that recursion does not count twice
+    uint64_t self;
+    uint64_t ev[PROF_EVENTS];  // Self
+};
+
+static const char* const scope_name[PROF_NSCOPES] = {
+    "decrypt_memory", "parse_packet", "s2k", "setkey",
+    "cfb_decrypt", "iobuf underflow", "malloc", "free",
+};
+
+// Cortex-A7 event numbers, and their column heads
+static const uint8_t event_id[PROF_EVENTS] = { 0x08, 0x03, 0x01, 0x10 };
+static const char* const event_name[PROF_EVENTS] = {
+    "instr", "L1D refill", "L1I refill", "br miss",
+};
+
+static int initialized;
+static struct frame stack[PROF_DEPTH];
+static int depth;
+static int active[PROF_NSCOPES];    // Entries of each scope on the stack
+static struct scope_stat stats[PROF_NSCOPES];
+
+#ifdef __arm__
+// Wraps of each counter seen so far, times 2^32: PMCCNTR first, then
+// the event counters
+static uint64_t wraps[1 + PROF_EVENTS];
+
+static void pmu_init(void) {
+    int i;
+
+    for (i = 0; i < PROF_EVENTS; i++) {
+        __asm__ volatile("mcr p15, 0, %0, c9, c12, 5" : : "r"(i));          // PMSELR
+        __asm__ volatile("isb\n\tmcr p15, 0, %0, c9, c13, 1" : : "r"((uint32_t)event_id[i]));  // PMXEVTYPER
+    }
+    __asm__ volatile("mcr p15, 0, %0, c9, c12, 1" : : "r"(0x80000000u | ((1u << PROF_EVENTS) - 1)));  // PMCNTENSET
+    __asm__ volatile("mcr p15, 0, %0, c9, c12, 0\n\tisb" : : "r"(0x7));     // PMCR: E, reset all
+    __asm__ volatile("mcr p15, 0, %0, c9, c12, 3" : : "r"(0x80000000u | ((1u << PROF_EVENTS) - 1)));  // PMOVSR: clear
+    for (i = 0; i <= PROF_EVENTS; i++)
+        wraps[i] = 0;
+}
+
+static uint32_t pmu_counter(int k) {
+    uint32_t c;
+
+    if (k == 0) {
+        __asm__ volatile("isb\n\tmrc p15, 0, %0, c9, c13, 0" : "=r"(c));    // PMCCNTR
+    } else {
+        __asm__ volatile("mcr p15, 0, %0, c9, c12, 5\n\tisb" : : "r"(k - 1));  // PMSELR
+        __asm__ volatile("mrc p15, 0, %0, c9, c13, 2" : "=r"(c));           // PMXEVCNTR
+    }
+    return c;
+}
+
+// PMCCNTR wraps every 4.8 s at 900 MHz, well within an S2K scope, so
+// each count is widened with the counter's overflow flag: if it is set
+// the count is read again after clearing it, which puts that read after
+// the wrap.  A scope is right as long as no counter wraps twice between
+// two reads, i.e. some scope begins or ends at least every 2^32 cycles.
+static uint64_t pmu_read64(int k) {
+    uint32_t bit = k ? 1u << (k - 1) : 0x80000000u, ovs, c;
+
+    c = pmu_counter(k);
+    __asm__ volatile("mrc p15, 0, %0, c9, c12, 3" : "=r"(ovs));             // PMOVSR
+    if (ovs & bit) {
+        __asm__ volatile("mcr p15, 0, %0, c9, c12, 3\n\tisb" : : "r"(bit));
+        wraps[k] += (uint64_t)1 << 32;
+        c = pmu_counter(k);
+    }
+    return wraps[k] + c;
+}
+
+static void pmu_read(struct sample* s) {
+    int i;
+
+    s->cyc = pmu_read64(0);
+    for (i = 0; i < PROF_EVENTS; i++)
+        s->ev[i] = pmu_read64(1 + i);
+}
+#else
+static void pmu_init(void) {
+}
+
+static void pmu_read(struct sample* s) {
+    int i;
+
+#if defined(__x86_64__) || defined(__i386__)
+    s->cyc = __builtin_ia32_rdtsc();
+#else
+    s->cyc = 0;
+#endif
+    for (i = 0; i < PROF_EVENTS; i++)
+        s->ev[i] = 0;
+}
+#endif
+
+uint32_t prof_cycles(void) {
+#ifdef __arm__
+    static int started;
+    uint32_t c;
+
+    if (!started) {
+        __asm__ volatile("mrc p15, 0, %0, c9, c12, 0" : "=r"(c));                   // PMCR
+        __asm__ volatile("mcr p15, 0, %0, c9, c12, 0" : : "r"(c | 1));              // E
+        __asm__ volatile("mcr p15, 0, %0, c9, c12, 1\n\tisb" : : "r"(0x80000000u));  // PMCNTENSET C
+        started = 1;
+    }
+    __asm__ volatile("isb\n\tmrc p15, 0, %0, c9, c13, 0" : "=r"(c));               // PMCCNTR
+    return c;
+#elif defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+void prof_begin(int scope) {
+    struct frame* f;
+
+    if (!initialized) {
+        pmu_init();
+        initialized = 1;
+    }
+    if (depth++ >= PROF_DEPTH)
+        return;
+    f = &stack[depth - 1];
+    f->scope = scope;
+    f->child = (struct sample){ 0 };
+    active[scope]++;
+    pmu_read(&f->start);
+}
+
+void prof_end(int scope, size_t bytes) {
+    struct sample now, d;
+    struct frame* f;
+    struct scope_stat* st;
+    int i;
+
+    pmu_read(&now);
+    if (depth-- > PROF_DEPTH)
+        return;
+    f = &stack[depth];
+    // Pop the innermost entry even when it is not SCOPE, so that later
+    // scopes are not taken for nested ones.
+    active[f->scope]--;
+    if (f->scope != scope)
+        return;     // Unbalanced; leave it out
+
+    d.cyc = now.cyc - f->start.cyc;
+    for (i = 0; i < PROF_EVENTS; i++)
+        d.ev[i] = now.ev[i] - f->start.ev[i];
+
+    st = &stats[scope];
+    st->calls++;
+    if (!active[scope]) {
+        st->bytes += bytes;
+        st->total += d.cyc;
+    }
+    st->self += d.cyc - f->child.cyc;
+    for (i = 0; i < PROF_EVENTS; i++)
+        st->ev[i] += d.ev[i] - f->child.ev[i];
+
+    if (depth > 0 && depth <= PROF_DEPTH) {
+        f = &stack[depth - 1];
+        f->child.cyc += d.cyc;
+        for (i = 0; i < PROF_EVENTS; i++)
+            f->child.ev[i] += d.ev[i];
+    }
+}
+
+void prof_reset(void) {
+    int i;
+
+    for (i = 0; i < PROF_NSCOPES; i++)
+        stats[i] = (struct scope_stat){ 0 };
+}
+
+// N / D by shift and subtract: there is no libgcc for 64-bit division.
+uint64_t prof_udiv64(uint64_t n, uint64_t d) {
+    uint64_t q = 0, r = 0;
+    int i;
+
+    if (!d)
+        return 0;
+    for (i = 63; i >= 0; i--) {
+        r = (r << 1) | ((n >> i) & 1);
+        if (r >= d) {
+            r -= d;
+            q |= (uint64_t)1 << i;
+        }
+    }
+    return q;
+}
+
+// V in decimal, right-aligned in WIDTH columns.
+void prof_put_u64(uint64_t v, int width) {
+    char buf[21];
+    int n = 0;
+
+    do {
+        uint64_t q = prof_udiv64(v, 10);
+
+        buf[n++] = '0' + (char)(v - q * 10);
+        v = q;
+    } while (v);
+    for (; width > n; width--)
+        printf(" ");
+    while (n)
+        printf("%c", buf[--n]);
+}
+
+void prof_dump(void) {
+    uint64_t cpb;
+    int i, k;
+
+    printf("%s", "scope               calls       total        self       bytes  cyc/byte");
+    for (k = 0; k < PROF_EVENTS; k++)
+        printf(" %11s", event_name[k]);
+    printf("\n");
+    for (i = 0; i < PROF_NSCOPES; i++) {
+        const struct scope_stat* st = &stats[i];
+
+        if (!st->calls)
+            continue;
+        printf("%s", scope_name[i]);
+        for (k = 0; scope_name[i][k]; k++)
+            ;
+        for (; k < 16; k++)
+            printf(" ");
+        prof_put_u64(st->calls, 9);
+        prof_put_u64(st->total, 12);
+        prof_put_u64(st->self, 12);
+        prof_put_u64(st->bytes, 12);
+        if (st->bytes) {
+            cpb = prof_udiv64(st->total * 100, st->bytes);
+            prof_put_u64(prof_udiv64(cpb, 100), 7);
+            printf(".%02u", (unsigned)(cpb - prof_udiv64(cpb, 100) * 100));
+        } else {
+            printf("         -");
+        }
+        for (k = 0; k < PROF_EVENTS; k++)
+            prof_put_u64(st->ev[k], 12);
+        printf("\n");
+    }
+}
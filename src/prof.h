@@ -0,0 +1,74 @@
+/* prof.h - cycle and PMU event counts per stage (make PROFILE=1)
+ *
+ * PROF_BEGIN(scope) and PROF_END(scope, bytes) around a stage count a
+ * call, the bytes it handled and the cycles (PMCCNTR) and PMU events
+ * spent in it.  Scopes nest: total cycles include the scopes called,
+ * self cycles and the events leave them out, so the self column of a
+ * run adds up to the total of the outermost scope.  A scope entered
+ * again from inside itself adds to calls and self only.  prof_dump
+ * prints the table (calls, cycles, total cycles per byte, events) and
+ * prof_reset clears it.  Without PROFILE both macros compile to
+ * nothing, like TRACE.
+ *
+ * The events are the Cortex-A7's instructions retired, L1 D-cache and
+ * I-cache refills and mispredicted branches.  QEMU counts cycles and
+ * instructions from its own clock and leaves the rest at 0; the host
+ * build reads the TSC and has no events.  Only core 0 may enter scopes.
+ *
+ * The counters are 32 bits wide; prof.c carries their overflow flags
+ * into 64-bit counts, which holds while some scope begins or ends at
+ * least every 2^32 cycles (4.8 s at 900 MHz).  An unbalanced PROF_END
+ * pops the innermost scope uncounted.
+ */
+#ifndef PROF_H
+#define PROF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef PROFILE
+#define PROF_ON 1
+#else
+#define PROF_ON 0
+#endif
+
+enum {
+    PROF_DECRYPT,    /* decrypt_memory */
+    PROF_PARSE,      /* parse_packet */
+    PROF_S2K,        /* gcry_kdf_derive; bytes are the S2K count */
+    PROF_SETKEY,     /* _gcry_cipher_setkey */
+    PROF_CFB,        /* _gcry_cipher_cfb_decrypt */
+    PROF_UNDERFLOW,  /* iobuf underflow, the filters below it included */
+    PROF_MALLOC,
+    PROF_FREE,
+    PROF_NSCOPES
+};
+
+#define PROF_BEGIN(scope)                                          \
+    do {                                                           \
+        if (PROF_ON)                                               \
+            prof_begin(scope);                                     \
+    } while (0)
+
+#define PROF_END(scope, bytes)                                     \
+    do {                                                           \
+        if (PROF_ON)                                               \
+            prof_end((scope), (bytes));                            \
+    } while (0)
+
+void prof_begin(int scope);
+void prof_end(int scope, size_t bytes);
+void prof_reset(void);
+void prof_dump(void);
+
+// The cycle counter alone, for timing without PROFILE: PMCCNTR, which
+// the first call starts without resetting it, or the TSC on the host.
+// Differences of two reads are right up to 2^32 cycles.
+uint32_t prof_cycles(void);
+
+// For other reports of 64-bit counts (main.bench.c): N / D and V in
+// decimal right-aligned in WIDTH columns, without libgcc.
+uint64_t prof_udiv64(uint64_t n, uint64_t d);
+void prof_put_u64(uint64_t v, int width);
+
+#endif /* PROF_H */
@@ -0,0 +1,116 @@
+#include "s2k-cache.h"
+#include "memory.h"
+#include "sha1.h"
+#include "trace.h"
+
+struct s2k_entry {
+    unsigned long used;     // LRU stamp, 0 for a free slot
+    int mode;
+    byte hash_algo;
+    byte salt[8];
+    u32 count;              // Coded, as in the packet
+    byte fpr[20];           // SHA-1 of salt and passphrase
+    size_t keylen;
+    byte key[S2K_CACHE_MAXKEY];
+};
+
+static struct s2k_entry cache[S2K_CACHE_SIZE ? S2K_CACHE_SIZE : 1];
+static unsigned long lru_clock;
+
+static void fingerprint(const STRING2KEY* s2k, const char* passphrase,
+                        byte fpr[20]) {
+    SHA1_CTX ctx;
+
+    SHA1Init(&ctx);
+    SHA1Update(&ctx, s2k->salt, sizeof s2k->salt);
+    SHA1Update(&ctx, (const unsigned char*)passphrase, strlen(passphrase));
+    SHA1Final(fpr, &ctx);
+}
+
+static struct s2k_entry* lookup(const STRING2KEY* s2k, const byte fpr[20]) {
+    int i;
+
+    for (i = 0; i < S2K_CACHE_SIZE; i++) {
+        struct s2k_entry* e = &cache[i];
+
+        if (e->used && e->mode == s2k->mode && e->hash_algo == s2k->hash_algo
+            && e->count == s2k->count
+            && !memcmp(e->salt, s2k->salt, sizeof e->salt)
+            && !memcmp(e->fpr, fpr, sizeof e->fpr))
+            return e;
+    }
+    return NULL;
+}
+
+static int cacheable(const STRING2KEY* s2k, const char* passphrase,
+                     size_t keylen) {
+    return S2K_CACHE_SIZE && passphrase && keylen <= S2K_CACHE_MAXKEY
+        && (s2k->mode == 1 || s2k->mode == 3);
+}
+
+void s2k_cache_id(const STRING2KEY* s2k, char id[1 + 16 + 1]) {
+    static const char hex[] = "0123456789ABCDEF";
+    int i;
+
+    id[0] = 'S';
+    for (i = 0; i < 8; i++) {
+        id[1 + 2 * i] = hex[s2k->salt[i] >> 4];
+        id[2 + 2 * i] = hex[s2k->salt[i] & 15];
+    }
+    id[17] = 0;
+}
+
+int s2k_cache_get(const STRING2KEY* s2k, const char* passphrase,
+                  byte* key, size_t keylen) {
+    struct s2k_entry* e;
+    byte fpr[20];
+
+    if (!cacheable(s2k, passphrase, keylen))
+        return -1;
+    fingerprint(s2k, passphrase, fpr);
+    e = lookup(s2k, fpr);
+    wipememory(fpr, sizeof fpr);
+    // A shorter key is a prefix of a longer one from the same S2K.
+    if (!e || e->keylen < keylen) {
+        TRACE(TRACE_DEBUG, "s2k cache miss\n");
+        return -1;
+    }
+    TRACE(TRACE_DEBUG, "s2k cache hit, slot %d\n", (int)(e - cache));
+    e->used = ++lru_clock;
+    memcpy(key, e->key, keylen);
+    return 0;
+}
+
+void s2k_cache_put(const STRING2KEY* s2k, const char* passphrase,
+                   const byte* key, size_t keylen) {
+    struct s2k_entry* e;
+    byte fpr[20];
+    int i;
+
+    if (!cacheable(s2k, passphrase, keylen))
+        return;
+    fingerprint(s2k, passphrase, fpr);
+    e = lookup(s2k, fpr);
+    if (!e) {
+        // Free slot, else the least recently used one
+        e = &cache[0];
+        for (i = 1; i < S2K_CACHE_SIZE && e->used; i++)
+            if (cache[i].used < e->used)
+                e = &cache[i];
+    }
+    wipememory(e, sizeof *e);
+    e->used = ++lru_clock;
+    e->mode = s2k->mode;
+    e->hash_algo = s2k->hash_algo;
+    memcpy(e->salt, s2k->salt, sizeof e->salt);
+    e->count = s2k->count;
+    memcpy(e->fpr, fpr, sizeof e->fpr);
+    e->keylen = keylen;
+    memcpy(e->key, key, keylen);
+    wipememory(fpr, sizeof fpr);
+}
+
+void s2k_cache_clear(void) {
+    wipememory(cache, sizeof cache);
+    lru_clock = 0;
+}
@@ -0,0 +1,38 @@
+/* s2k-cache.h - derived keys of recent S2K specifiers
+ *
+ * Messages encrypted with the same passphrase and S2K salt derive the
+ * same key, and mode 3 costs a million SHA-1 compressions at count
+ * 0xFF.  passphrase_to_dek() looks the key up here first and stores
+ * what it derives.  An entry matches on S2K mode, hash algorithm,
+ * salt, coded count and a SHA-1 fingerprint of salt and passphrase;
+ * the passphrase itself is not kept.  The least recently used entry
+ * is wiped and reused when the cache is full.
+ *
+ * Only the salted modes (1 and 3) are cached, as in gpg-agent.
+ */
+#ifndef S2K_CACHE_H
+#define S2K_CACHE_H
+
+#include <stddef.h>
+#include "packet.h"
+
+#ifndef S2K_CACHE_SIZE
+#define S2K_CACHE_SIZE 8  // Entries; 0 disables the cache
+#endif
+#define S2K_CACHE_MAXKEY 32  // Largest key kept (AES-256)
+
+// Fill ID with gpg-agent's cache id for S2K: 'S' and the salt in hex.
+void s2k_cache_id(const STRING2KEY* s2k, char id[1 + 16 + 1]);
+
+// Copy the cached key for S2K and PASSPHRASE into KEY; 0 if found.
+int s2k_cache_get(const STRING2KEY* s2k, const char* passphrase,
+                  byte* key, size_t keylen);
+
+// Remember KEY as the result of S2K on PASSPHRASE.
+void s2k_cache_put(const STRING2KEY* s2k, const char* passphrase,
+                   const byte* key, size_t keylen);
+
+// Wipe every entry.
+void s2k_cache_clear(void);
+
+#endif /* S2K_CACHE_H */
@@ -0,0 +1,185 @@
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "semihost.h"
+#include "memory.h"
+
+#ifdef USE_SEMIHOSTING
+
+// The trap the debugger or emulator intercepts
+#ifdef __thumb__
+#define SEMIHOST_TRAP "svc 0xab"
+#else
+#define SEMIHOST_TRAP "svc 0x123456"
+#endif
+
+#define SYS_OPEN 0x01
+#define SYS_CLOSE 0x02
+#define SYS_WRITE 0x05
+#define SYS_READ 0x06
+#define SYS_SEEK 0x0a
+#define SYS_FLEN 0x0c
+#define SYS_GET_CMDLINE 0x15
+
+// SYS_OPEN modes: fopen's "rb", "r+b", "wb", "ab"
+#define MODE_RB 1
+#define MODE_RPLUSB 3
+#define MODE_WB 5
+#define MODE_AB 9
+
+static int semihost_call(int op, void *arg)
+{
+    register int r0 __asm__("r0") = op;
+    register void *r1 __asm__("r1") = arg;
+
+    // SVC overwrites lr when it traps in SVC mode
+    __asm__ volatile(SEMIHOST_TRAP : "+r"(r0) : "r"(r1) : "memory", "lr");
+    return r0;
+}
+
+int open(const char *pathname, int flags, ...)
+{
+    uint32_t args[3];
+
+    if ((flags & O_ACCMODE) == O_RDWR)
+        args[1] = MODE_RPLUSB;
+    else if ((flags & O_ACCMODE) == O_WRONLY)
+        args[1] = flags & O_APPEND ? MODE_AB : MODE_WB;
+    else
+        args[1] = MODE_RB;
+    args[0] = (uint32_t)(uintptr_t)pathname;
+    args[2] = strlen(pathname);
+    return semihost_call(SYS_OPEN, args);
+}
+
+int close(int fd)
+{
+    uint32_t args[1] = { fd };
+
+    return semihost_call(SYS_CLOSE, args) ? -1 : 0;
+}
+
+// SYS_READ and SYS_WRITE return the bytes they did not transfer, or
+// more than were asked for on an error.
+
+ssize_t read(int fd, void *buf, size_t count)
+{
+    uint32_t args[3] = { fd, (uint32_t)(uintptr_t)buf, count };
+    uint32_t left = semihost_call(SYS_READ, args);
+
+    return left > count ? -1 : (ssize_t)(count - left);
+}
+
+ssize_t write(int fd, const void *buf, size_t count)
+{
+    uint32_t args[3] = { fd, (uint32_t)(uintptr_t)buf, count };
+    uint32_t left = semihost_call(SYS_WRITE, args);
+
+    return left > count ? -1 : (ssize_t)(count - left);
+}
+
+static int flen(int fd)
+{
+    uint32_t args[1] = { fd };
+
+    return semihost_call(SYS_FLEN, args);
+}
+
+// SYS_SEEK only goes to absolute positions; SEEK_CUR is not supported.
+off_t lseek(int fd, off_t offset, int whence)
+{
+    uint32_t args[2];
+    int len;
+
+    if (whence == SEEK_END)
+    {
+        len = flen(fd);
+        if (len < 0)
+            return -1;
+        offset += len;
+    }
+    else if (whence != SEEK_SET)
+        return -1;
+    args[0] = fd;
+    args[1] = offset;
+    return semihost_call(SYS_SEEK, args) ? -1 : offset;
+}
+
+int fstat(int fd, struct stat *st)
+{
+    int len = flen(fd);
+
+    if (len < 0)
+        return -1;
+    memset(st, 0, sizeof *st);
+    st->st_mode = S_IFREG;
+    st->st_size = len;
+    return 0;
+}
+
+int semihost_cmdline(char *buf, size_t size)
+{
+    uint32_t args[2] = { (uint32_t)(uintptr_t)buf, size };
+
+    if (size == 0 || semihost_call(SYS_GET_CMDLINE, args))
+        return -1;
+    buf[args[1] < size ? args[1] : size - 1] = '\0';
+    return 0;
+}
+
+#else /* !USE_SEMIHOSTING */
+
+int open(const char *pathname, int flags, ...)
+{
+    (void)flags;
+    if (strcmp(pathname, "stdout") == 0) return 1;
+    if (strcmp(pathname, "stdin") == 0) return 0;
+    return -1;
+}
+
+int close(int fd)
+{
+    (void)fd;
+    return 0;
+}
+
+ssize_t read(int fd, void *buf, size_t count)
+{
+    (void)fd;
+    (void)buf;
+    (void)count;
+    return 0;
+}
+
+ssize_t write(int fd, const void *buf, size_t count)
+{
+    (void)fd;
+    (void)buf;
+    (void)count;
+    return -1;
+}
+
+off_t lseek(int fd, off_t offset, int whence)
+{
+    (void)fd;
+    (void)offset;
+    (void)whence;
+    return -1;
+}
+
+int fstat(int fd, struct stat *st)
+{
+    (void)fd;
+    (void)st;
+    return -1;
+}
+
+int semihost_cmdline(char *buf, size_t size)
+{
+    (void)buf;
+    (void)size;
+    return -1;
+}
+
+#endif /* !USE_SEMIHOSTING */
@@ -0,0 +1,28 @@
+/* semihost.h - files on the host through ARM semihosting (make USE_SEMIHOSTING=1)
+ *
+ * semihost.c gives the kernel the POSIX calls that the file filter of
+ * common/iobuf.c makes: open, close, read, write, lseek and fstat (for
+ * the size only).  With USE_SEMIHOSTING they become SYS_OPEN, SYS_CLOSE,
+ * SYS_READ, SYS_WRITE, SYS_SEEK and SYS_FLEN requests to the debugger
+ * or emulator, as in newlib's libgloss/arm/syscalls.c, so that
+ * iobuf_open, iobuf_create and decrypt_message work on the host's files
+ * under QEMU -semihosting-config enable=on.  Without it there are no
+ * files: open fails and read reports EOF, as before.
+ *
+ * The host build uses the C library's calls instead of these.
+ *
+ * semihost_cmdline returns the command line QEMU passes with -append,
+ * for the kernel to take its file names from.
+ */
+#ifndef SEMIHOST_H
+#define SEMIHOST_H
+
+#include <stddef.h>
+
+/**
+ * Copy the command line into BUF, SIZE bytes, NUL-terminated
+ * @return 0, or -1 without semihosting or if it does not fit
+ */
+int semihost_cmdline(char *buf, size_t size);
+
+#endif /* SEMIHOST_H */
@@ -0,0 +1,151 @@
+#include <string.h>
+#include "session.h"
+#include "libgcrypt.h"
+#include "memory.h"
+#include "printf.h"
+#include "prof.h"
+
+int decrypt_memory(ctrl_t ctrl, const unsigned char* data, size_t length);
+
+// Buffers one message has out at a time: the block, decrypt and
+// literal data filters and handle_plaintext, and two for armor and
+// compression.
+#define SESSION_BUFFERS 6
+
+void session_open(struct decrypt_session_s* s) {
+    memset(s, 0, sizeof *s);
+    s->stats.min_cycles = 0xffffffffu;
+    iobuf_buffer_cache(SESSION_BUFFERS);
+}
+
+static void release_cipher(struct decrypt_session_s* s) {
+    _gcry_cipher_close(s->cipher_hd);
+    s->cipher_hd = NULL;
+    wipememory(s->cipher_key, sizeof s->cipher_key);
+    s->cipher_keylen = 0;
+}
+
+int session_cipher(struct decrypt_session_s* s, struct gcry_cipher_handle** hd,
+                   int algo, int mode, const unsigned char* key, size_t keylen) {
+    int rc;
+
+    *hd = NULL;
+    if (s->cipher_lent || keylen > sizeof s->cipher_key)
+        return 0;
+    if (!s->cipher_hd || s->cipher_algo != algo || s->cipher_mode != mode
+        || s->cipher_keylen != keylen || memcmp(s->cipher_key, key, keylen)) {
+        release_cipher(s);
+        rc = _gcry_cipher_open(&s->cipher_hd, algo, mode);
+        if (!rc)
+            rc = _gcry_cipher_setkey(s->cipher_hd, key, keylen);
+        if (rc) {
+            release_cipher(s);
+            return rc;
+        }
+        s->cipher_algo = algo;
+        s->cipher_mode = mode;
+        memcpy(s->cipher_key, key, keylen);
+        s->cipher_keylen = keylen;
+        s->stats.rekeys++;
+    }
+    // setiv resets the mode state for every packet and AEAD chunk
+    s->cipher_lent = 1;
+    *hd = s->cipher_hd;
+    return 0;
+}
+
+/**
+ * Point the control structure of S at the key material and sink of M
+ */
+static int setup(struct decrypt_session_s* s, const struct session_msg_s* m) {
+    size_t len;
+
+    memset(&s->ctrl, 0, sizeof s->ctrl);
+    wipememory(s->key, sizeof s->key);
+    sink_digest_init(&s->digest);
+    s->ctrl.sink = m->sink ? m->sink : &s->digest.sink;
+    s->ctrl.sink->total = 0;
+    s->ctrl.session = s;
+    s->cipher_lent = 0;
+
+    // do_proc_packets copies the key material with strlen(), as in
+    // payload_setup
+    if (m->session_key) {
+        if (m->key_len == 0 || m->key_len > 32 || memchr(m->session_key, 0, m->key_len))
+            return GPG_ERR_INV_KEYLEN;
+        memcpy(s->key, m->session_key, m->key_len);
+        s->ctrl.session_key = s->key;
+    } else if (m->passphrase) {
+        len = strlen(m->passphrase);
+        if (len > SESSION_KEY_MAX)
+            return GPG_ERR_INV_KEYLEN;
+        memcpy(s->key, m->passphrase, len);
+        s->ctrl.passphrase = (char*)s->key;
+    } else {
+        return GPG_ERR_NO_PASSPHRASE;
+    }
+    return 0;
+}
+
+int session_decrypt(struct decrypt_session_s* s, struct session_msg_s* m) {
+    struct session_stats_s* st = &s->stats;
+    uint32_t t0 = prof_cycles();
+    int rc;
+
+    rc = setup(s, m);
+    if (!rc)
+        rc = gpg_err_code(decrypt_memory(&s->ctrl, m->data, m->len));
+    m->cycles = prof_cycles() - t0;
+    m->rc = rc;
+    m->text_len = s->ctrl.sink->total;
+    m->text_crc = s->ctrl.sink == &s->digest.sink ? s->digest.crc : 0;
+    wipememory(s->key, sizeof s->key);
+
+    st->messages++;
+    if (rc)
+        st->failed++;
+    st->bytes += m->len;
+    st->text += m->text_len;
+    st->cycles += m->cycles;
+    if (m->cycles < st->min_cycles)
+        st->min_cycles = m->cycles;
+    if (m->cycles > st->max_cycles)
+        st->max_cycles = m->cycles;
+    return rc;
+}
+
+unsigned session_run(struct decrypt_session_s* s, struct session_msg_s* queue, size_t n) {
+    unsigned failed = 0;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        if (session_decrypt(s, &queue[i]))
+            failed++;
+    return failed;
+}
+
+void session_report(const struct session_stats_s* st, unsigned mhz) {
+    uint64_t mbps = 0;
+
+    // Hundredths of MB/s: bytes * MHz / cycles
+    if (st->cycles)
+        mbps = prof_udiv64(st->bytes * mhz * 100, st->cycles);
+    printf("session msgs=%u failed=%u rekeys=%u bytes=", st->messages, st->failed, st->rekeys);
+    prof_put_u64(st->bytes, 0);
+    printf(" text=");
+    prof_put_u64(st->text, 0);
+    printf(" cycles=");
+    prof_put_u64(st->cycles, 0);
+    printf(" per-msg=");
+    prof_put_u64(st->messages ? prof_udiv64(st->cycles, st->messages) : 0, 0);
+    printf(" min=%u max=%u mhz=%u mbps=", st->messages ? (unsigned)st->min_cycles : 0,
+           (unsigned)st->max_cycles, mhz);
+    prof_put_u64(prof_udiv64(mbps, 100), 0);
+    printf(".%02u\n", (unsigned)(mbps - prof_udiv64(mbps, 100) * 100));
+}
+
+void session_close(struct decrypt_session_s* s) {
+    release_cipher(s);
+    iobuf_buffer_cache(0);
+    wipememory(s, sizeof *s);
+}
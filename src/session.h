@@ -0,0 +1,121 @@
+/* session.h - decrypt a queue of messages with one set of allocations
+ *
+ * decrypt_memory on its own sets everything up for every message: the
+ * 8 KiB buffers of the iobuf pipeline and of handle_plaintext, and a
+ * cipher handle that is allocated, keyed and wiped again.  A session
+ * keeps them from one message to the next.  session_open turns on the
+ * iobuf buffer cache (common/iobuf.h), and decrypt_data borrows the
+ * session's cipher handle through ctrl->session, keying it again only
+ * when the algorithm, mode or key differ from the last message's.
+ * Thousands of small messages then need no more heap than one and no
+ * setup beyond what changed between them.
+ *
+ * session_decrypt takes one message and session_run a queue of them.
+ * Each message gets its result, plaintext length, CRC-32 (unless it
+ * brings a sink of its own) and cycles.  The session adds them up for
+ * session_report.  Cycles are PMCCNTR on the target and the TSC on the
+ * host (prof_cycles).  session_close frees what was kept and wipes the
+ * key material.
+ *
+ * The buffer cache is global, so only one session may be open at a
+ * time, on core 0.
+ */
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "fwddecl.h"
+#include "gpg.h"
+#include "sink.h"
+
+#define SESSION_KEY_MAX 128     // Passphrase bytes; session keys are <= 32
+
+struct session_msg_s {
+    const unsigned char* data;
+    size_t len;
+    const char* passphrase;             // NUL-terminated, or
+    const unsigned char* session_key;   // KEY_LEN raw bytes
+    size_t key_len;
+    plaintext_sink_t sink;              // NULL: CRC-32 only
+
+    // Written by session_decrypt
+    int rc;                             // gpg_err_code
+    size_t text_len;
+    uint32_t text_crc;                  // 0 with a sink of its own
+    uint32_t cycles;
+};
+
+struct session_stats_s {
+    unsigned messages;
+    unsigned failed;
+    unsigned rekeys;        // Messages that keyed the cipher handle
+    uint64_t bytes;         // Message bytes
+    uint64_t text;          // Plaintext bytes
+    uint64_t cycles;
+    uint32_t min_cycles;    // Of one message
+    uint32_t max_cycles;
+};
+
+struct decrypt_session_s {
+    struct server_control_s ctrl;
+    struct sink_digest_s digest;
+    // The key of the current message, NUL-terminated for do_proc_packets
+    unsigned char key[SESSION_KEY_MAX + 1];
+
+    // The cipher handle kept between messages and what it is keyed with
+    struct gcry_cipher_handle* cipher_hd;
+    int cipher_algo;
+    int cipher_mode;
+    unsigned char cipher_key[32];
+    size_t cipher_keylen;
+    int cipher_lent;        // Taken by the current message already
+
+    struct session_stats_s stats;
+};
+
+/**
+ * Start a session in S and turn on the buffer cache
+ */
+void session_open(struct decrypt_session_s* s);
+
+/**
+ * Decrypt M with what S kept from the messages before it and fill in
+ * its results
+ * @return gpg_err_code of the result, GPG_ERR_INV_KEYLEN for key
+ *         material that cannot be passed on or GPG_ERR_NO_PASSPHRASE
+ *         for none
+ */
+int session_decrypt(struct decrypt_session_s* s, struct session_msg_s* m);
+
+/**
+ * Decrypt the N messages of QUEUE in order
+ * @return How many failed
+ */
+unsigned session_run(struct decrypt_session_s* s, struct session_msg_s* queue, size_t n);
+
+/**
+ * Print the totals ST of a session (s->stats) as one line, with the
+ * throughput at MHZ:
+ *
+ *   session msgs=100 failed=0 rekeys=1 bytes=104400 text=100600
+ *     cycles=... per-msg=... min=... max=... mhz=900 mbps=12.34
+ */
+void session_report(const struct session_stats_s* st, unsigned mhz);
+
+/**
+ * Free what S kept, wipe its key material and turn the buffer cache off
+ */
+void session_close(struct decrypt_session_s* s);
+
+/**
+ * For decrypt_data: the session's handle for ALGO in MODE keyed with
+ * KEY in *HD, keyed again first if it was not.  The handle stays the
+ * session's and must not be closed.  *HD is NULL if the current
+ * message has it already, for the caller to open its own.
+ * @return 0, or the error from opening or keying it
+ */
+int session_cipher(struct decrypt_session_s* s, struct gcry_cipher_handle** hd,
+                   int algo, int mode, const unsigned char* key, size_t keylen);
+
+#endif /* SESSION_H */
@@ -10,36 +10,33 @@ Test Vectors (from FIPS PUB 180-1)
   84983E44 1C3BD26E BAAE4AA1 F95129E5 E54670F1
 A million repetitions of "a"
   34AA973C D4C4DAA4 F61EEB2B DBAD2731 6534016F
-*/
-
-/* #define LITTLE_ENDIAN * This should be #define'd already, if true. */
-/* #define SHA1HANDSOFF * Copies data before messing with it. */
 
-#define SHA1HANDSOFF
+Reworked for the OpenPGP S2K (kdf.c), which hashes up to 62 MiB per
+key: the block is read a word at a time instead of copied and swapped
+in place, the message schedule lives in a local array, and
+SHA1Repeat() feeds a repeated salt+passphrase from blocks converted to
+words once, so S2K never goes through SHA1Update().
+*/
 
-#include <stdio.h>
-// #include <string.h>
-// #include "printf.h"
-/* for uint32_t */
 #include <stdint.h>
-
 #include "sha1.h"
 #include "memory.h"
 
 #define rol(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
 
-/* blk0() and blk() perform the initial expand. */
-/* I got the idea of expanding during the round function from SSLeay */
-#if BYTE_ORDER == LITTLE_ENDIAN
-#define blk0(i) (block->l[i] = (rol(block->l[i],24)&0xFF00FF00) \
-    |(rol(block->l[i],8)&0x00FF00FF))
-#elif BYTE_ORDER == BIG_ENDIAN
-#define blk0(i) block->l[i]
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define be_to_cpu32(x) (x)
 #else
-#error "Endianness not defined!"
+#define be_to_cpu32(x) __builtin_bswap32(x)  /* REV on ARMv6 and later */
 #endif
-#define blk(i) (block->l[i&15] = rol(block->l[(i+13)&15]^block->l[(i+8)&15] \
-    ^block->l[(i+2)&15]^block->l[i&15],1))
+
+typedef uint32_t u32_alias __attribute__((__may_alias__));
+
+/* blk0() and blk() perform the initial expand. */
+/* I got the idea of expanding during the round function from SSLeay */
+#define blk0(i) (W[i] = in[i])
+#define blk(i) (W[i&15] = rol(W[(i+13)&15]^W[(i+8)&15] \
+    ^W[(i+2)&15]^W[i&15],1))
 
 /* (R0+R1), R2, R3, R4 are the different operations used in SHA1 */
 #define R0(v,w,x,y,z,i) z+=((w&(x^y))^y)+blk0(i)+0x5A827999+rol(v,5);w=rol(w,30);
@@ -48,21 +45,18 @@ A million repetitions of "a"
 #define R3(v,w,x,y,z,i) z+=(((w|x)&y)|(w&x))+blk(i)+0x8F1BBCDC+rol(v,5);w=rol(w,30);
 #define R4(v,w,x,y,z,i) z+=(w^x^y)+blk(i)+0xCA62C1D6+rol(v,5);w=rol(w,30);
 
-/* Hash a single 512-bit block. This is the core of the algorithm. */
-void SHA1Transform(
+
+/* Hash a single 512-bit block given as 16 message words. This is the
+   core of the algorithm. */
+
+static void sha1_compress(
     uint32_t state[5],
-    const unsigned char buffer[64]
+    const uint32_t in[16]
 )
 {
     uint32_t a, b, c, d, e;
-    typedef union
-    {
-        unsigned char c[64];
-        uint32_t l[16];
-    } CHAR64LONG16;
+    uint32_t W[16];
 
-    CHAR64LONG16 block[1];      /* use array to appear as a pointer */
-    memcpy(block, buffer, 64);
     /* Copy context->state[] to working vars */
     a = state[0];
     b = state[1];
@@ -156,14 +150,50 @@ void SHA1Transform(
     state[2] += c;
     state[3] += d;
     state[4] += e;
-    /* Wipe variables */
-    a = b = c = d = e = 0;
-#ifdef SHA1HANDSOFF
-    memset(block, '\0', sizeof(block));
-#endif
 }
 
+
+/* Big-endian word at P, which need not be aligned. */
+
+static uint32_t load_be32(
+    const unsigned char *p
+)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+        | ((uint32_t)p[2] << 8) | p[3];
+}
+
+
+/* Hash a single 512-bit block. Word aligned input is read with LDR
+   plus REV; with the MMU off an unaligned LDR faults, so anything else
+   is assembled from bytes. */
+
+void SHA1Transform(
+    uint32_t state[5],
+    const unsigned char buffer[64]
+)
+{
+    uint32_t in[16];
+    int i;
+
+    if (((uintptr_t)buffer & 3) == 0)
+    {
+        const u32_alias *words = (const u32_alias *)buffer;
+
+        for (i = 0; i < 16; i++)
+            in[i] = be_to_cpu32(words[i]);
+    }
+    else
+    {
+        for (i = 0; i < 16; i++)
+            in[i] = load_be32(buffer + 4 * i);
+    }
+    sha1_compress(state, in);
+}
+
+
 /* SHA1Init - Initialize new context */
+
 void SHA1Init(
     SHA1_CTX * context
 )
@@ -177,7 +207,9 @@ void SHA1Init(
     context->count[0] = context->count[1] = 0;
 }
 
+
 /* Run your data through this. */
+
 void SHA1Update(
     SHA1_CTX * context,
     const unsigned char *data,
@@ -185,7 +217,10 @@ void SHA1Update(
 )
 {
     uint32_t i;
-    uint32_t j = context->count[0];
+
+    uint32_t j;
+
+    j = context->count[0];
     if ((context->count[0] += len << 3) < j)
         context->count[1]++;
     context->count[1] += (len >> 29);
@@ -206,6 +241,96 @@ void SHA1Update(
 }
 
 
+/* Feed N bytes of PATTERN starting at *OFF, wrapping around. */
+
+static void repeat_update(
+    SHA1_CTX * context,
+    const unsigned char *pattern,
+    uint32_t patlen,
+    uint32_t *off,
+    uint32_t n
+)
+{
+    uint32_t k;
+
+    while (n)
+    {
+        k = patlen - *off;
+        if (k > n)
+            k = n;
+        SHA1Update(context, pattern + *off, k);
+        *off += k;
+        if (*off == patlen)
+            *off = 0;
+        n -= k;
+    }
+}
+
+
+/* Largest table of converted blocks SHA1Repeat() builds. A pattern
+   of P bytes repeats every P / gcd(P, 64) blocks; this covers any
+   salt plus a passphrase of up to 248 bytes. */
+#define REPEAT_TABLE_MAX 16384
+
+void SHA1Repeat(
+    SHA1_CTX * context,
+    const unsigned char *pattern,
+    uint32_t patlen,
+    uint32_t len
+)
+{
+    uint32_t off = 0, n, nblocks, period, g, i, j, b;
+    uint32_t *table;
+
+    /* Top up a partly filled buffer so that blocks line up. */
+    n = (64 - ((context->count[0] >> 3) & 63)) & 63;
+    if (n > len)
+        n = len;
+    repeat_update(context, pattern, patlen, &off, n);
+    len -= n;
+
+    nblocks = len / 64;
+    for (g = patlen, j = 64; j; )
+    {
+        i = g % j;
+        g = j;
+        j = i;
+    }
+    period = patlen / g;
+    if (nblocks > period && period * 64 <= REPEAT_TABLE_MAX)
+    {
+        /* Block I of the stream is block I % PERIOD of the table. */
+        table = xmalloc(period * 64);
+        for (b = 0; b < period; b++)
+            for (i = 0; i < 16; i++)
+            {
+                uint32_t w = 0;
+
+                for (j = 0; j < 4; j++)
+                    w = (w << 8) | pattern[(off + b * 64 + i * 4 + j) % patlen];
+                table[b * 16 + i] = w;
+            }
+
+        for (i = 0, b = 0; i < nblocks; i++)
+        {
+            sha1_compress(context->state, table + b * 16);
+            if (++b == period)
+                b = 0;
+        }
+
+        if ((context->count[0] += nblocks << 9) < (nblocks << 9))
+            context->count[1]++;
+        context->count[1] += nblocks >> 23;
+        off = (uint32_t)((off + (uint64_t)nblocks * 64) % patlen);
+        len -= nblocks * 64;
+        wipememory(table, period * 64);
+        xfree(table);
+    }
+
+    repeat_update(context, pattern, patlen, &off, len);
+}
+
+
 /* Add padding and return the message digest. */
 
 void SHA1Final(
@@ -213,20 +338,17 @@ void SHA1Final(
     SHA1_CTX * context
 )
 {
+    static const unsigned char pad[64] = { 0200 };
     unsigned i;
     unsigned char finalcount[8];
-    unsigned char c;
+
     for (i = 0; i < 8; i++)
     {
         finalcount[i] = (unsigned char) ((context->count[(i >= 4 ? 0 : 1)] >> ((3 - (i & 3)) * 8)) & 255);      /* Endian independent */
     }
-    c = 0200;
-    SHA1Update(context, &c, 1);
-    while ((context->count[0] & 504) != 448)
-    {
-        c = 0000;
-        SHA1Update(context, &c, 1);
-    }
+    /* 0x80, then zeros up to 56 mod 64 */
+    i = (context->count[0] >> 3) & 63;
+    SHA1Update(context, pad, i < 56 ? 56 - i : 120 - i);
     SHA1Update(context, finalcount, 8); /* Should cause a SHA1Transform() */
     for (i = 0; i < 20; i++)
     {
@@ -243,13 +365,9 @@ void SHA1(
     const char *str,
     int len)
 {
-    // printf('SHA1)\n');
     SHA1_CTX ctx;
-    unsigned int ii;
 
     SHA1Init(&ctx);
-    for (ii=0; ii<len; ii+=1)
-        SHA1Update(&ctx, (const unsigned char*)str + ii, 1);
+    SHA1Update(&ctx, (const unsigned char*)str, len);
     SHA1Final((unsigned char *)hash_out, &ctx);
 }
-
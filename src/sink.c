@@ -0,0 +1,151 @@
+#include "sink.h"
+#include "memory.h"
+#include "printf.h"
+#include "trace.h"
+
+#define SINK_CHUNK 8192  // Bytes per write(); one decrypt filter buffer
+
+// Memory sink
+
+static int memory_write(plaintext_sink_t sink, const byte* buf, size_t len) {
+    struct sink_memory_s* m = (struct sink_memory_s*)sink;
+
+    if (len > m->size - m->len)
+        return gpg_error(GPG_ERR_BUFFER_TOO_SHORT);
+    memcpy(m->buf + m->len, buf, len);
+    m->len += len;
+    return 0;
+}
+
+void sink_memory_init(struct sink_memory_s* m, void* buf, size_t size) {
+    memset(m, 0, sizeof *m);
+    m->sink.write = memory_write;
+    m->buf = buf;
+    m->size = size;
+}
+
+// Digest sink: table-driven CRC-32, reflected polynomial 0xEDB88320
+
+static u32 crc32_table[256];
+
+static void crc32_init_table(void) {
+    u32 c;
+    int i, k;
+
+    for (i = 0; i < 256; i++) {
+        c = i;
+        for (k = 0; k < 8; k++)
+            c = (c & 1) ? (c >> 1) ^ 0xEDB88320 : c >> 1;
+        crc32_table[i] = c;
+    }
+}
+
+static int digest_write(plaintext_sink_t sink, const byte* buf, size_t len) {
+    struct sink_digest_s* d = (struct sink_digest_s*)sink;
+    u32 c = ~d->crc;
+
+    while (len--)
+        c = crc32_table[(c ^ *buf++) & 0xff] ^ (c >> 8);
+    d->crc = ~c;
+    return 0;
+}
+
+void sink_digest_init(struct sink_digest_s* d) {
+    if (!crc32_table[1])
+        crc32_init_table();
+    memset(d, 0, sizeof *d);
+    d->sink.write = digest_write;
+}
+
+// UART sink
+
+static int uart_write(plaintext_sink_t sink, const byte* buf, size_t len) {
+    (void)sink;
+    tfp_write((const char*)buf, len);
+    return 0;
+}
+
+void sink_uart_init(plaintext_sink_t sink) {
+    memset(sink, 0, sizeof *sink);
+    sink->write = uart_write;
+}
+
+// Discard sink: no callbacks, only the byte count
+
+void sink_discard_init(plaintext_sink_t sink) {
+    memset(sink, 0, sizeof *sink);
+}
+
+// File sink
+
+static int file_write(plaintext_sink_t sink, const byte* buf, size_t len) {
+    struct sink_file_s* f = (struct sink_file_s*)sink;
+
+    return iobuf_write(f->out, buf, len) ? gpg_error(GPG_ERR_EIO) : 0;
+}
+
+int sink_file_open(struct sink_file_s* f, const char* fname) {
+    memset(f, 0, sizeof *f);
+    f->out = iobuf_create(fname, 0);
+    if (!f->out)
+        return gpg_error(GPG_ERR_EACCES);
+    f->sink.write = file_write;
+    return 0;
+}
+
+// Write out what is still buffered and close the file
+int sink_file_close(struct sink_file_s* f) {
+    int rc = 0;
+
+    if (f->out && iobuf_close(f->out))
+        rc = gpg_error(GPG_ERR_EIO);
+    f->out = NULL;
+    return rc;
+}
+
+int handle_plaintext(PKT_plaintext* pt, plaintext_sink_t sink) {
+    struct plaintext_sink_s uart;
+    int limited = !pt->is_partial && pt->len;
+    byte* buffer;
+    unsigned want;
+    int n, rc = 0;
+
+    if (!sink) {
+        sink_uart_init(&uart);
+        sink = &uart;
+    }
+    if (sink->begin && (rc = sink->begin(sink, pt)))
+        goto out;
+
+    buffer = iobuf_buffer_get(SINK_CHUNK);
+    for (;;) {
+        want = SINK_CHUNK;
+        if (limited) {
+            if (!pt->len)
+                break;
+            if (pt->len < want)
+                want = pt->len;
+        }
+        n = iobuf_read(pt->buf, buffer, want);
+        if (n == -1) {
+            if (limited)
+                rc = gpg_error(GPG_ERR_TRUNCATED);
+            break;
+        }
+        TRACE(TRACE_DEBUG, "handle_plaintext %d bytes\n", n);
+        if (limited)
+            pt->len -= n;
+        if (sink->write && (rc = sink->write(sink, buffer, n)))
+            break;
+        sink->total += n;
+    }
+    iobuf_buffer_put(buffer, SINK_CHUNK);
+    if (!rc && sink->end)
+        rc = sink->end(sink);
+
+out:
+    // On error free_plaintext() skips whatever the sink did not take.
+    if (!rc)
+        pt->buf = NULL;
+    return rc;
+}
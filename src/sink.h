@@ -0,0 +1,61 @@
+/* sink.h - destinations for decrypted literal data
+ *
+ * The body of every literal data packet goes to the sink in
+ * ctrl->sink: begin() once with the packet (mode, name, timestamp,
+ * length), write() once per decrypted chunk as it comes out of the
+ * decrypt filter, end() after the last one.  Each callback may be NULL;
+ * a non-zero return stops delivery and fails the decryption with that
+ * error.  Without a sink the text goes to the UART as before.
+ *
+ * A custom sink fills in the callbacks and opaque.  The built-in ones
+ * embed the sink as their first member, so &s.sink is what goes into
+ * ctrl->sink.
+ */
+#ifndef SINK_H
+#define SINK_H
+
+#include <stddef.h>
+#include "packet.h"
+
+typedef struct plaintext_sink_s *plaintext_sink_t;
+
+struct plaintext_sink_s {
+    int (*begin)(plaintext_sink_t sink, const PKT_plaintext* pt);
+    int (*write)(plaintext_sink_t sink, const byte* buf, size_t len);
+    int (*end)(plaintext_sink_t sink);
+    void* opaque;      // For custom sinks
+    size_t total;      // Bytes write() took so far, kept by handle_plaintext()
+};
+
+// Copy into a caller-provided buffer; overflowing it is an error
+struct sink_memory_s {
+    struct plaintext_sink_s sink;
+    byte* buf;
+    size_t size;
+    size_t len;
+};
+
+// CRC-32 (as in zlib and PNG) of everything written
+struct sink_digest_s {
+    struct plaintext_sink_s sink;
+    u32 crc;
+};
+
+// Write to a file (semihost.c on the target) through an output iobuf
+// in large blocks; open with sink_file_open, always sink_file_close
+struct sink_file_s {
+    struct plaintext_sink_s sink;
+    iobuf_t out;
+};
+
+void sink_memory_init(struct sink_memory_s* m, void* buf, size_t size);
+void sink_digest_init(struct sink_digest_s* d);
+void sink_uart_init(plaintext_sink_t sink);
+void sink_discard_init(plaintext_sink_t sink);
+int sink_file_open(struct sink_file_s* f, const char* fname);
+int sink_file_close(struct sink_file_s* f);
+
+// Deliver the body of PT to SINK, or to the UART if SINK is NULL.
+int handle_plaintext(PKT_plaintext* pt, plaintext_sink_t sink);
+
+#endif /* SINK_H */
@@ -0,0 +1,130 @@
+#include <stddef.h>
+#include <stdint.h>
+#include "smp.h"
+
+// The boot stub parks cores 1-3 in WFE until their mailbox 3 in the
+// BCM2836 local peripherals holds an address, then jumps there.
+#define LOCAL_MAILBOX3_SET(cpu) (*(volatile uint32_t*)(uintptr_t)(0x4000008c + 0x10 * (cpu)))
+
+// Give up waiting for a core that never checks in after this many polls.
+#define SMP_BOOT_SPINS 10000000
+
+extern char _start[];
+
+static spinlock_t queue_lock;
+static smp_work_t* queue[SMP_QUEUE_LEN];  // Claimed or withdrawn slots are NULL
+static unsigned int queue_head, queue_tail;
+static volatile unsigned int cpus_online = 1;
+static unsigned int cpu_limit = SMP_MAX_CPUS;
+
+static inline void cpu_wfe(void) {
+#ifdef __arm__
+    __asm__ volatile("wfe" ::: "memory");
+#endif
+}
+
+// Wake cores waiting in cpu_wfe, once the stores before are visible.
+static inline void cpu_sev(void) {
+#ifdef __arm__
+    __asm__ volatile("dsb\n\tsev" ::: "memory");
+#endif
+}
+
+void spin_lock(spinlock_t* lock) {
+    while (__atomic_exchange_n(&lock->locked, 1, __ATOMIC_ACQUIRE))
+        while (__atomic_load_n(&lock->locked, __ATOMIC_RELAXED))
+            cpu_wfe();
+}
+
+void spin_unlock(spinlock_t* lock) {
+    __atomic_store_n(&lock->locked, 0, __ATOMIC_RELEASE);
+    cpu_sev();
+}
+
+void smp_init(void) {
+#ifdef BOARD_RASPI2B
+    unsigned int cpu;
+    long spins;
+
+    for (cpu = 1; cpu < SMP_MAX_CPUS; cpu++)
+        LOCAL_MAILBOX3_SET(cpu) = (uint32_t)(uintptr_t)_start;
+    cpu_sev();
+    for (spins = 0; spins < SMP_BOOT_SPINS; spins++)
+        if (__atomic_load_n(&cpus_online, __ATOMIC_ACQUIRE) == SMP_MAX_CPUS)
+            break;
+#endif
+}
+
+unsigned int smp_cpus(void) {
+    unsigned int n = __atomic_load_n(&cpus_online, __ATOMIC_ACQUIRE);
+
+    return n < cpu_limit ? n : cpu_limit;
+}
+
+void smp_limit(unsigned int limit) {
+    cpu_limit = limit ? limit : SMP_MAX_CPUS;
+}
+
+void smp_queue(smp_work_t* w) {
+    w->state = SMP_WORK_QUEUED;
+    if (smp_cpus() == 1)
+        return;
+    spin_lock(&queue_lock);
+    if (queue_tail - queue_head < SMP_QUEUE_LEN)
+        queue[queue_tail++ % SMP_QUEUE_LEN] = w;
+    spin_unlock(&queue_lock);
+}
+
+static void run(smp_work_t* w) {
+    w->fn(w->arg);
+    __atomic_store_n(&w->state, SMP_WORK_DONE, __ATOMIC_RELEASE);
+    cpu_sev();
+}
+
+void smp_wait(smp_work_t* w) {
+    unsigned int i;
+    int mine = 0;
+
+    if (cpus_online == 1) {
+        run(w);
+        return;
+    }
+
+    // Withdraw W from the queue, so that no core finds it after it has
+    // gone out of scope.
+    spin_lock(&queue_lock);
+    if (__atomic_load_n(&w->state, __ATOMIC_RELAXED) == SMP_WORK_QUEUED) {
+        for (i = queue_head; i != queue_tail; i++)
+            if (queue[i % SMP_QUEUE_LEN] == w)
+                queue[i % SMP_QUEUE_LEN] = NULL;
+        __atomic_store_n(&w->state, SMP_WORK_RUNNING, __ATOMIC_RELAXED);
+        mine = 1;
+    }
+    spin_unlock(&queue_lock);
+
+    if (mine)
+        run(w);
+    while (__atomic_load_n(&w->state, __ATOMIC_ACQUIRE) != SMP_WORK_DONE)
+        cpu_wfe();
+}
+
+void smp_secondary_main(unsigned int cpu) {
+    smp_work_t* w;
+
+    (void)cpu;
+    __atomic_add_fetch(&cpus_online, 1, __ATOMIC_RELEASE);
+    cpu_sev();
+    for (;;) {
+        w = NULL;
+        spin_lock(&queue_lock);
+        while (!w && queue_head != queue_tail)
+            w = queue[queue_head++ % SMP_QUEUE_LEN];
+        if (w)
+            __atomic_store_n(&w->state, SMP_WORK_RUNNING, __ATOMIC_RELAXED);
+        spin_unlock(&queue_lock);
+        if (w)
+            run(w);
+        else
+            cpu_wfe();
+    }
+}
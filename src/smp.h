@@ -0,0 +1,55 @@
+/* smp.h - secondary cores, spinlocks and a work queue
+ *
+ * On raspi2b (make BOARD=raspi2b) smp_init releases cores 1-3, which
+ * then run queued smp_work_t items.  Everywhere else, the host build
+ * included, no other core comes up and smp_wait runs the work on the
+ * caller, so code that queues work needs no single-core path of its own.
+ *
+ *   smp_work_t w[3];          // one per helper, plus the caller's share
+ *   for (i = 0; i < 3; i++) { w[i].fn = part; w[i].arg = &p[i + 1]; smp_queue(&w[i]); }
+ *   part(&p[0]);
+ *   for (i = 0; i < 3; i++) smp_wait(&w[i]);
+ */
+#ifndef SMP_H
+#define SMP_H
+
+#define SMP_MAX_CPUS 4
+#define SMP_QUEUE_LEN 16        // Queued items beyond this run in smp_wait
+
+// Secondary core stacks sit below the boot stack, this far apart.
+#define SMP_STACK_SIZE 0x100000
+
+typedef struct {
+    volatile unsigned int locked;
+} spinlock_t;
+
+enum { SMP_WORK_QUEUED, SMP_WORK_RUNNING, SMP_WORK_DONE };
+
+typedef struct smp_work {
+    void (*fn)(void* arg);
+    void* arg;
+    volatile int state;         // SMP_WORK_*, set by smp_queue
+} smp_work_t;
+
+void spin_lock(spinlock_t* lock);
+void spin_unlock(spinlock_t* lock);
+
+// Release the secondary cores, where the board has them, and wait for
+// them to come up.  Call once from main.
+void smp_init(void);
+
+// Cores that take work, the caller included; at most LIMIT of them
+// (0 lifts the limit, which is otherwise SMP_MAX_CPUS).
+unsigned int smp_cpus(void);
+void smp_limit(unsigned int limit);
+
+// Hand W to the next idle core.  W must stay valid until smp_wait.
+void smp_queue(smp_work_t* w);
+
+// Return once W has run: on the caller if no core has taken it yet.
+void smp_wait(smp_work_t* w);
+
+// Entry of cores 1..SMP_MAX_CPUS-1 from start.s, on their own stack.
+void smp_secondary_main(unsigned int cpu);
+
+#endif /* SMP_H */
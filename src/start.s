@@ -1,13 +1,51 @@
 .section ".text.boot"
 .global _start
+.fpu neon-vfpv4
+.arch_extension virt
 
 _start:
-    // Set up stack
+    // Drop from HYP to SVC if the boot stub entered there (raspi2b)
+    mrs r0, cpsr
+    and r1, r0, #0x1f
+    cmp r1, #0x1a
+    bne 1f
+    bic r0, r0, #0x1f
+    orr r0, r0, #0xd3           // SVC, IRQ and FIQ masked
+    msr spsr_hyp, r0
+    adr r0, 1f
+    msr elr_hyp, r0
+    eret
+1:
+    // One stack per core below 0x8000000, SMP_STACK_SIZE apart (smp.h)
+    mrc p15, 0, r4, c0, c0, 5   // MPIDR
+    and r4, r4, #3
     mov sp, #0x8000000
+    sub sp, sp, r4, lsl #20
+
+    // Enable VFP/NEON: full access to CP10/CP11, then FPEXC.EN
+    mrc p15, 0, r0, c1, c0, 2
+    orr r0, r0, #(0xf << 20)
+    mcr p15, 0, r0, c1, c0, 2
+    isb
+    mov r0, #0x40000000
+    vmsr fpexc, r0
+
+    // Identity map and caches with make USE_MMU=1 (src/mmu.h)
+    mov r0, r4
+    bl mmu_init
+
+    // Cores 1-3 only get here once smp_init has released them
+    cmp r4, #0
+    bne 2f
 
     // Jump to main
     bl main
 
-    // Loop forever if main returns
+    // Loop forever if main returns (scripts/icount.py stops counting here)
+hang:
+    b hang
+
+2:
+    mov r0, r4
+    bl smp_secondary_main
     b .
-    
\ No newline at end of file
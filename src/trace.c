@@ -0,0 +1,117 @@
+#include <stdarg.h>
+#include "trace.h"
+#include "memory.h"
+#include "printf.h"
+
+// Ring size in bytes; a power of two
+#ifndef TRACE_RING_SIZE
+#define TRACE_RING_SIZE 16384
+#endif
+#define TRACE_DATA_CHUNK 1024  // Largest payload in one data record
+
+// Record header.  Events carry LEN arguments after it, data records LEN
+// payload bytes.  Padding at the end of the ring is an empty data record.
+struct trace_rec {
+    uint16_t size;     // Bytes to the next record
+    uint16_t len;
+    const char* fmt;   // NULL for data and padding
+    uintptr_t arg[];
+};
+
+// Every record is a whole number of headers, so padding always fits one.
+#define REC_UNIT sizeof(struct trace_rec)
+#define REC_SIZE(n) ((sizeof(struct trace_rec) + (n) + REC_UNIT - 1) & ~(REC_UNIT - 1))
+
+static uintptr_t ring[TRACE_RING_SIZE / sizeof(uintptr_t)];
+static size_t ring_head;  // Next write offset
+static size_t ring_tail;  // Next read offset
+static size_t ring_used;  // Bytes from tail to head, padding included
+
+static struct trace_rec* ring_at(size_t off) {
+    return (struct trace_rec*)((uint8_t*)ring + off);
+}
+
+// Claim SIZE contiguous bytes, draining the ring first if they don't fit.
+static struct trace_rec* ring_reserve(size_t size) {
+    struct trace_rec* r;
+    size_t pad = 0;
+
+    if (ring_head + size > TRACE_RING_SIZE)
+        pad = TRACE_RING_SIZE - ring_head;
+    if (ring_used + pad + size > TRACE_RING_SIZE) {
+        trace_drain();
+        pad = 0;
+    }
+    if (pad) {
+        r = ring_at(ring_head);
+        r->size = pad;
+        r->len = 0;
+        r->fmt = NULL;
+        ring_used += pad;
+        ring_head = 0;
+    }
+
+    r = ring_at(ring_head);
+    r->size = size;
+    ring_head = (ring_head + size) & (TRACE_RING_SIZE - 1);
+    ring_used += size;
+    return r;
+}
+
+void trace_event(int nargs, const char* fmt, ...) {
+    struct trace_rec* r;
+    va_list va;
+    int i;
+
+    r = ring_reserve(REC_SIZE(nargs * sizeof(uintptr_t)));
+    r->len = nargs;
+    r->fmt = fmt;
+    va_start(va, fmt);
+    for (i = 0; i < nargs; i++)
+        r->arg[i] = va_arg(va, uintptr_t);
+    va_end(va);
+}
+
+void trace_data(const void* data, size_t len) {
+    const uint8_t* p = data;
+    struct trace_rec* r;
+    size_t n;
+
+    while (len) {
+        n = len < TRACE_DATA_CHUNK ? len : TRACE_DATA_CHUNK;
+        r = ring_reserve(REC_SIZE(n));
+        r->len = n;
+        r->fmt = NULL;
+        memcpy(r->arg, p, n);
+        p += n;
+        len -= n;
+    }
+}
+
+// Format and print everything recorded so far, oldest first.
+void trace_drain(void) {
+    static int draining;
+    struct trace_rec* r;
+    uintptr_t a[6];
+    int i;
+
+    // printf calls back in here to keep the console in order.
+    if (draining || !ring_used)
+        return;
+    draining = 1;
+
+    while (ring_used) {
+        r = ring_at(ring_tail);
+        if (r->fmt) {
+            for (i = 0; i < 6; i++)
+                a[i] = i < r->len ? r->arg[i] : 0;
+            printf((char*)r->fmt, a[0], a[1], a[2], a[3], a[4], a[5]);
+        } else if (r->len) {
+            tfp_write((const char*)r->arg, r->len);
+        }
+        ring_tail = (ring_tail + r->size) & (TRACE_RING_SIZE - 1);
+        ring_used -= r->size;
+    }
+    ring_head = ring_tail = 0;
+    draining = 0;
+}
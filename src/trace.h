@@ -0,0 +1,73 @@
+/* trace.h - leveled, buffered tracing for the decrypt path
+ *
+ * TRACE(level, fmt, ...) records a printf-style event and TRACE_DATA
+ * records raw bytes.  Levels above TRACE_LEVEL,
+ * which the Makefile sets, compile to nothing, argument evaluation
+ * included, even at -O0.
+ *
+ * Enabled events are not formatted when they happen.  The format
+ * pointer and up to six arguments are appended to a binary ring, and
+ * printf only runs when the ring is drained: by trace_drain(), when a
+ * record does not fit, or before any direct printf so that the console
+ * keeps its order.  %s arguments are stored as pointers and so must
+ * still be valid at drain time; string literals are, stack buffers are
+ * not.
+ *
+ * TRACE casts every argument to uintptr_t, which is what trace_event
+ * reads back, so ints, size_ts and pointers may be mixed.  Anything
+ * wider than a pointer (uint64_t on ARM) keeps only its low word.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TRACE_OFF   0
+#define TRACE_ERROR 1
+#define TRACE_INFO  2   /* Per message */
+#define TRACE_DEBUG 3   /* Per call on the decrypt path */
+#define TRACE_BLOCK 4   /* Per cipher block */
+
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL TRACE_INFO
+#endif
+
+#define TRACE_ON(level) ((level) <= TRACE_LEVEL)
+
+/* Number of arguments after the format, at most six. */
+#define TRACE_NARG(...) TRACE_NARG_(__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define TRACE_NARG_(fmt, a1, a2, a3, a4, a5, a6, n, ...) n
+
+/* The format and its arguments, each of them cast to uintptr_t. */
+#define TRACE_ARGS(...) TRACE_CAT(TRACE_ARGS, TRACE_NARG(__VA_ARGS__))(__VA_ARGS__)
+#define TRACE_CAT(a, n) TRACE_CAT_(a, n)
+#define TRACE_CAT_(a, n) a##n
+#define TRACE_U(a) (uintptr_t)(a)
+#define TRACE_ARGS0(f) f
+#define TRACE_ARGS1(f, a) f, TRACE_U(a)
+#define TRACE_ARGS2(f, a, b) f, TRACE_U(a), TRACE_U(b)
+#define TRACE_ARGS3(f, a, b, c) f, TRACE_U(a), TRACE_U(b), TRACE_U(c)
+#define TRACE_ARGS4(f, a, b, c, d) f, TRACE_U(a), TRACE_U(b), TRACE_U(c), TRACE_U(d)
+#define TRACE_ARGS5(f, a, b, c, d, e) \
+    f, TRACE_U(a), TRACE_U(b), TRACE_U(c), TRACE_U(d), TRACE_U(e)
+#define TRACE_ARGS6(f, a, b, c, d, e, g) \
+    f, TRACE_U(a), TRACE_U(b), TRACE_U(c), TRACE_U(d), TRACE_U(e), TRACE_U(g)
+
+#define TRACE(level, ...)                                          \
+    do {                                                           \
+        if (TRACE_ON(level))                                       \
+            trace_event(TRACE_NARG(__VA_ARGS__), TRACE_ARGS(__VA_ARGS__)); \
+    } while (0)
+
+#define TRACE_DATA(level, data, len)                               \
+    do {                                                           \
+        if (TRACE_ON(level))                                       \
+            trace_data((data), (len));                             \
+    } while (0)
+
+void trace_event(int nargs, const char *fmt, ...);
+void trace_data(const void *data, size_t len);
+void trace_drain(void);
+
+#endif /* TRACE_H */